@@ -0,0 +1,29 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAYFONT_H
+#define DISPLAYFONT_H
+
+#include <stdint.h>
+
+// The 5x7 font the display library draws text with (Adafruit glcdfont), so
+// text can be drawn without it. Each glyph is DISPLAY_FONT_GLYPH_COLUMNS
+// bytes, one per column from the left, the top pixel in bit 0. Characters are
+// DISPLAY_CHAR_WIDTH wide, the last column is blank.
+
+#define DISPLAY_FONT_GLYPH_COUNT 255
+#define DISPLAY_FONT_GLYPH_COLUMNS 5
+#define DISPLAY_FONT_GLYPH_ROWS 8
+
+extern const uint8_t
+    displayFont_glyphs[DISPLAY_FONT_GLYPH_COUNT * DISPLAY_FONT_GLYPH_COLUMNS];
+
+#endif
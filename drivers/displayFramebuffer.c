@@ -0,0 +1,546 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#define DISPLAY_FRAMEBUFFER_DIRECT // display_* below are the LCD.
+#include "displayFramebuffer.h"
+#include "display.h"
+#include "displayGlyphCache.h"
+#include "displayText.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Half-open: x0 <= x < x1, y0 <= y < y1.
+typedef struct {
+  int16_t x0, y0, x1, y1;
+} displayFramebuffer_rect_t;
+
+// Pixels of one color, still growing downwards while flushing.
+typedef struct {
+  int16_t x, y, w, h;
+  display_pixel_t color;
+  bool continued; // Grown on the current row.
+} displayFramebuffer_span_t;
+
+static display_pixel_t framebuffer[DISPLAY_HEIGHT][DISPLAY_WIDTH];
+static display_pixel_t shown[DISPLAY_HEIGHT][DISPLAY_WIDTH]; // On the LCD.
+static displayFramebuffer_rect_t
+    dirtyRects[DISPLAY_FRAMEBUFFER_DIRTY_RECT_COUNT];
+static uint16_t dirtyRectCount;
+
+static displayText_t text;
+
+static int32_t displayFramebuffer_area(const displayFramebuffer_rect_t *rect) {
+  return (int32_t)(rect->x1 - rect->x0) * (rect->y1 - rect->y0);
+}
+
+// Grows rect to hold other.
+static void displayFramebuffer_union(displayFramebuffer_rect_t *rect,
+                                     const displayFramebuffer_rect_t *other) {
+  if (other->x0 < rect->x0)
+    rect->x0 = other->x0;
+  if (other->y0 < rect->y0)
+    rect->y0 = other->y0;
+  if (other->x1 > rect->x1)
+    rect->x1 = other->x1;
+  if (other->y1 > rect->y1)
+    rect->y1 = other->y1;
+}
+
+// Marks the pixels from (x0, y0) to (x1, y1), both included, as changed.
+static void displayFramebuffer_markDirty(int16_t x0, int16_t y0, int16_t x1,
+                                         int16_t y1) {
+  displayFramebuffer_rect_t rect = {
+      x0 < 0 ? 0 : x0, y0 < 0 ? 0 : y0,
+      x1 >= DISPLAY_WIDTH ? DISPLAY_WIDTH : x1 + 1,
+      y1 >= DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y1 + 1};
+  if (rect.x0 >= rect.x1 || rect.y0 >= rect.y1)
+    return;
+  // Take in every rectangle it overlaps or touches, again after it grew.
+  for (uint16_t i = 0; i < dirtyRectCount;) {
+    displayFramebuffer_rect_t *dirty = &dirtyRects[i];
+    if (dirty->x0 <= rect.x1 && rect.x0 <= dirty->x1 && dirty->y0 <= rect.y1 &&
+        rect.y0 <= dirty->y1) {
+      displayFramebuffer_union(&rect, dirty);
+      *dirty = dirtyRects[--dirtyRectCount];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+  if (dirtyRectCount < DISPLAY_FRAMEBUFFER_DIRTY_RECT_COUNT) {
+    dirtyRects[dirtyRectCount++] = rect;
+    return;
+  }
+  // Full, merge into the rectangle that grows least.
+  uint16_t best = 0;
+  int32_t bestGrowth = INT32_MAX;
+  for (uint16_t i = 0; i < dirtyRectCount; i++) {
+    displayFramebuffer_rect_t merged = dirtyRects[i];
+    displayFramebuffer_union(&merged, &rect);
+    int32_t growth = displayFramebuffer_area(&merged) -
+                     displayFramebuffer_area(&dirtyRects[i]);
+    if (growth < bestGrowth) {
+      best = i;
+      bestGrowth = growth;
+    }
+  }
+  displayFramebuffer_union(&dirtyRects[best], &rect);
+}
+
+// Fills a clipped rectangle without marking it.
+static void displayFramebuffer_fill(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    uint16_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  int16_t x1 = x + w > DISPLAY_WIDTH ? DISPLAY_WIDTH : x + w;
+  int16_t y1 = y + h > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y + h;
+  if (x < 0)
+    x = 0;
+  if (y < 0)
+    y = 0;
+  for (int16_t row = y; row < y1; row++)
+    for (int16_t column = x; column < x1; column++)
+      framebuffer[row][column] = color;
+}
+
+// Sets a clipped pixel without marking it.
+static void displayFramebuffer_set(int16_t x, int16_t y, uint16_t color) {
+  if (x >= 0 && x < DISPLAY_WIDTH && y >= 0 && y < DISPLAY_HEIGHT)
+    framebuffer[y][x] = color;
+}
+
+void displayFramebuffer_init() {
+  display_init();
+  display_fillScreen(DISPLAY_BLACK);
+  memset(framebuffer, 0, sizeof(framebuffer)); // DISPLAY_BLACK is 0.
+  memset(shown, 0, sizeof(shown));
+  dirtyRectCount = 0;
+  displayText_init(&text, displayFramebuffer_drawChar);
+}
+
+void displayFramebuffer_drawPixel(int16_t x0, int16_t y0, uint16_t color) {
+  displayFramebuffer_set(x0, y0, color);
+  displayFramebuffer_markDirty(x0, y0, x0, y0);
+}
+
+void displayFramebuffer_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  displayFramebuffer_fill(x, y, w, h, color);
+  displayFramebuffer_markDirty(x, y, x + w - 1, y + h - 1);
+}
+
+void displayFramebuffer_drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                      uint16_t color) {
+  displayFramebuffer_fillRect(x, y, 1, h, color);
+}
+
+void displayFramebuffer_drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                      uint16_t color) {
+  displayFramebuffer_fillRect(x, y, w, 1, color);
+}
+
+// Bresenham, the same pixels as Adafruit_GFX::drawLine().
+void displayFramebuffer_drawLine(int16_t x0, int16_t y0, int16_t x1,
+                                 int16_t y1, uint16_t color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  int16_t swap;
+  if (steep) {
+    swap = x0, x0 = y0, y0 = swap;
+    swap = x1, x1 = y1, y1 = swap;
+  }
+  if (x0 > x1) {
+    swap = x0, x0 = x1, x1 = swap;
+    swap = y0, y0 = y1, y1 = swap;
+  }
+  int16_t dx = x1 - x0;
+  int16_t dy = abs(y1 - y0);
+  int16_t err = dx / 2;
+  int16_t yStep = y0 < y1 ? 1 : -1;
+  if (steep)
+    displayFramebuffer_markDirty(y0 < y1 ? y0 : y1, x0, y0 < y1 ? y1 : y0, x1);
+  else
+    displayFramebuffer_markDirty(x0, y0 < y1 ? y0 : y1, x1, y0 < y1 ? y1 : y0);
+  for (; x0 <= x1; x0++) {
+    if (steep)
+      displayFramebuffer_set(y0, x0, color);
+    else
+      displayFramebuffer_set(x0, y0, color);
+    err -= dy;
+    if (err < 0) {
+      y0 += yStep;
+      err += dx;
+    }
+  }
+}
+
+void displayFramebuffer_drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color) {
+  displayFramebuffer_drawFastHLine(x, y, w, color);
+  displayFramebuffer_drawFastHLine(x, y + h - 1, w, color);
+  displayFramebuffer_drawFastVLine(x, y, h, color);
+  displayFramebuffer_drawFastVLine(x + w - 1, y, h, color);
+}
+
+void displayFramebuffer_fillScreen(uint16_t color) {
+  displayFramebuffer_fillRect(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, color);
+}
+
+// Draws the quarters of a circle in corners (bit 0 upper left, then
+// clockwise), as Adafruit_GFX::drawCircleHelper().
+static void displayFramebuffer_circleCorners(int16_t x0, int16_t y0, int16_t r,
+                                             uint8_t corners, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddFX = 1;
+  int16_t ddFY = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFY += 2;
+      f += ddFY;
+    }
+    x++;
+    ddFX += 2;
+    f += ddFX;
+    if (corners & 0x4) {
+      displayFramebuffer_set(x0 + x, y0 + y, color);
+      displayFramebuffer_set(x0 + y, y0 + x, color);
+    }
+    if (corners & 0x2) {
+      displayFramebuffer_set(x0 + x, y0 - y, color);
+      displayFramebuffer_set(x0 + y, y0 - x, color);
+    }
+    if (corners & 0x8) {
+      displayFramebuffer_set(x0 - y, y0 + x, color);
+      displayFramebuffer_set(x0 - x, y0 + y, color);
+    }
+    if (corners & 0x1) {
+      displayFramebuffer_set(x0 - y, y0 - x, color);
+      displayFramebuffer_set(x0 - x, y0 - y, color);
+    }
+  }
+}
+
+// Fills the right (bit 0) and left (bit 1) halves of a circle, stretched down
+// by delta, as Adafruit_GFX::fillCircleHelper().
+static void displayFramebuffer_fillCircleHalves(int16_t x0, int16_t y0,
+                                                int16_t r, uint8_t halves,
+                                                int16_t delta, uint16_t color) {
+  int16_t f = 1 - r;
+  int16_t ddFX = 1;
+  int16_t ddFY = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddFY += 2;
+      f += ddFY;
+    }
+    x++;
+    ddFX += 2;
+    f += ddFX;
+    if (halves & 0x1) {
+      displayFramebuffer_fill(x0 + x, y0 - y, 1, 2 * y + 1 + delta, color);
+      displayFramebuffer_fill(x0 + y, y0 - x, 1, 2 * x + 1 + delta, color);
+    }
+    if (halves & 0x2) {
+      displayFramebuffer_fill(x0 - x, y0 - y, 1, 2 * y + 1 + delta, color);
+      displayFramebuffer_fill(x0 - y, y0 - x, 1, 2 * x + 1 + delta, color);
+    }
+  }
+}
+
+void displayFramebuffer_drawCircle(int16_t x0, int16_t y0, int16_t r,
+                                   uint16_t color) {
+  displayFramebuffer_set(x0, y0 + r, color);
+  displayFramebuffer_set(x0, y0 - r, color);
+  displayFramebuffer_set(x0 + r, y0, color);
+  displayFramebuffer_set(x0 - r, y0, color);
+  displayFramebuffer_circleCorners(x0, y0, r, 0xF, color);
+  displayFramebuffer_markDirty(x0 - r, y0 - r, x0 + r, y0 + r);
+}
+
+void displayFramebuffer_fillCircle(int16_t x0, int16_t y0, int16_t r,
+                                   uint16_t color) {
+  displayFramebuffer_fill(x0, y0 - r, 1, 2 * r + 1, color);
+  displayFramebuffer_fillCircleHalves(x0, y0, r, 0x3, 0, color);
+  displayFramebuffer_markDirty(x0 - r, y0 - r, x0 + r, y0 + r);
+}
+
+void displayFramebuffer_drawTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                     int16_t y1, int16_t x2, int16_t y2,
+                                     uint16_t color) {
+  displayFramebuffer_drawLine(x0, y0, x1, y1, color);
+  displayFramebuffer_drawLine(x1, y1, x2, y2, color);
+  displayFramebuffer_drawLine(x2, y2, x0, y0, color);
+}
+
+// Scan lines from the top, as Adafruit_GFX::fillTriangle().
+void displayFramebuffer_fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                     int16_t y1, int16_t x2, int16_t y2,
+                                     uint16_t color) {
+  int16_t swap;
+  // Sort by y, y0 <= y1 <= y2.
+  if (y0 > y1) {
+    swap = y0, y0 = y1, y1 = swap;
+    swap = x0, x0 = x1, x1 = swap;
+  }
+  if (y1 > y2) {
+    swap = y2, y2 = y1, y1 = swap;
+    swap = x2, x2 = x1, x1 = swap;
+  }
+  if (y0 > y1) {
+    swap = y0, y0 = y1, y1 = swap;
+    swap = x0, x0 = x1, x1 = swap;
+  }
+  int16_t left = x0 < x1 ? (x0 < x2 ? x0 : x2) : (x1 < x2 ? x1 : x2);
+  int16_t right = x0 > x1 ? (x0 > x2 ? x0 : x2) : (x1 > x2 ? x1 : x2);
+  displayFramebuffer_markDirty(left, y0, right, y2);
+  if (y0 == y2) { // One line.
+    displayFramebuffer_fill(left, y0, right - left + 1, 1, color);
+    return;
+  }
+  int16_t dx01 = x1 - x0, dy01 = y1 - y0;
+  int16_t dx02 = x2 - x0, dy02 = y2 - y0;
+  int16_t dx12 = x2 - x1, dy12 = y2 - y1;
+  int32_t sa = 0, sb = 0;
+  int16_t a, b, y;
+  // The upper part ends on the row above y1, or on y1 if the bottom is flat.
+  int16_t last = y1 == y2 ? y1 : y1 - 1;
+  for (y = y0; y <= last; y++) {
+    a = x0 + sa / dy01;
+    b = x0 + sb / dy02;
+    sa += dx01;
+    sb += dx02;
+    if (a > b)
+      swap = a, a = b, b = swap;
+    displayFramebuffer_fill(a, y, b - a + 1, 1, color);
+  }
+  sa = (int32_t)dx12 * (y - y1);
+  sb = (int32_t)dx02 * (y - y0);
+  for (; y <= y2; y++) {
+    a = x1 + sa / dy12;
+    b = x0 + sb / dy02;
+    sa += dx12;
+    sb += dx02;
+    if (a > b)
+      swap = a, a = b, b = swap;
+    displayFramebuffer_fill(a, y, b - a + 1, 1, color);
+  }
+}
+
+// Marks a rounded rectangle. With a radius over half the size, the corners
+// stick out of it.
+static void displayFramebuffer_markRoundRect(int16_t x0, int16_t y0, int16_t w,
+                                             int16_t h, int16_t r) {
+  int16_t x1 = x0 + w - 1, y1 = y0 + h - 1;
+  displayFramebuffer_markDirty(x1 - 2 * r < x0 ? x1 - 2 * r : x0,
+                               y1 - 2 * r < y0 ? y1 - 2 * r : y0,
+                               x0 + 2 * r > x1 ? x0 + 2 * r : x1,
+                               y0 + 2 * r > y1 ? y0 + 2 * r : y1);
+}
+
+void displayFramebuffer_drawRoundRect(int16_t x0, int16_t y0, int16_t w,
+                                      int16_t h, int16_t radius,
+                                      uint16_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  int16_t r = radius;
+  displayFramebuffer_fill(x0 + r, y0, w - 2 * r, 1, color);
+  displayFramebuffer_fill(x0 + r, y0 + h - 1, w - 2 * r, 1, color);
+  displayFramebuffer_fill(x0, y0 + r, 1, h - 2 * r, color);
+  displayFramebuffer_fill(x0 + w - 1, y0 + r, 1, h - 2 * r, color);
+  displayFramebuffer_circleCorners(x0 + r, y0 + r, r, 0x1, color);
+  displayFramebuffer_circleCorners(x0 + w - r - 1, y0 + r, r, 0x2, color);
+  displayFramebuffer_circleCorners(x0 + w - r - 1, y0 + h - r - 1, r, 0x4,
+                                   color);
+  displayFramebuffer_circleCorners(x0 + r, y0 + h - r - 1, r, 0x8, color);
+  displayFramebuffer_markRoundRect(x0, y0, w, h, r);
+}
+
+void displayFramebuffer_fillRoundRect(int16_t x0, int16_t y0, int16_t w,
+                                      int16_t h, int16_t radius,
+                                      uint16_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  int16_t r = radius;
+  displayFramebuffer_fill(x0 + r, y0, w - 2 * r, h, color);
+  displayFramebuffer_fillCircleHalves(x0 + w - r - 1, y0 + r, r, 0x1,
+                                      h - 2 * r - 1, color);
+  displayFramebuffer_fillCircleHalves(x0 + r, y0 + r, r, 0x2, h - 2 * r - 1,
+                                      color);
+  displayFramebuffer_markRoundRect(x0, y0, w, h, r);
+}
+
+// Rows of w bits, most significant bit first, padded to whole bytes.
+void displayFramebuffer_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                   int16_t w, int16_t h, uint16_t color) {
+  int16_t byteWidth = (w + 7) / 8;
+  for (int16_t j = 0; j < h; j++)
+    for (int16_t i = 0; i < w; i++)
+      if (bitmap[j * byteWidth + i / 8] & (0x80 >> (i & 7)))
+        displayFramebuffer_set(x + i, y + j, color);
+  displayFramebuffer_markDirty(x, y, x + w - 1, y + h - 1);
+}
+
+// Copies the visible part of a w by h block of pixels to (x, y).
+static void displayFramebuffer_blit(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    const display_pixel_t *pixels) {
+  int16_t left = x < 0 ? -x : 0;
+  int16_t top = y < 0 ? -y : 0;
+  int16_t right = x + w > DISPLAY_WIDTH ? DISPLAY_WIDTH - x : w;
+  int16_t bottom = y + h > DISPLAY_HEIGHT ? DISPLAY_HEIGHT - y : h;
+  for (int16_t row = top; row < bottom; row++)
+    memcpy(&framebuffer[y + row][x + left], &pixels[row * w + left],
+           (right - left) * sizeof(display_pixel_t));
+}
+
+// Copies the rasterized character from the glyph cache, or fills the
+// rectangles of the glyph. The background is only drawn if bg differs from
+// color.
+void displayFramebuffer_drawChar(int16_t x, int16_t y, unsigned char c,
+                                 uint16_t color, uint16_t bg, uint8_t size) {
+  int16_t width = DISPLAY_CHAR_WIDTH * size;
+  int16_t height = DISPLAY_CHAR_HEIGHT * size;
+  if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT || x + width - 1 < 0 ||
+      y + height - 1 < 0)
+    return;
+  const display_pixel_t *pixels =
+      displayGlyphCache_getPixels(c, color, bg, size);
+  uint16_t count;
+  const displayGlyphCache_rect_t *rects;
+  if (pixels) {
+    displayFramebuffer_blit(x, y, width, height, pixels);
+  } else if ((rects = displayGlyphCache_getRects(c, &count))) {
+    for (uint16_t i = 0; i < count; i++)
+      if (rects[i].foreground || bg != color)
+        displayFramebuffer_fill(x + rects[i].x * size, y + rects[i].y * size,
+                                rects[i].w * size, rects[i].h * size,
+                                rects[i].foreground ? color : bg);
+  } else {
+    return;
+  }
+  displayFramebuffer_markDirty(x, y, x + width - 1, y + height - 1);
+}
+
+void displayFramebuffer_setCursor(int16_t x, int16_t y) {
+  text.cursorX = x;
+  text.cursorY = y;
+}
+
+void displayFramebuffer_setTextColor(uint16_t c) {
+  text.color = c;
+  text.bgColor = c; // Transparent.
+}
+
+void displayFramebuffer_setTextColorBg(uint16_t c, uint16_t bg) {
+  text.color = c;
+  text.bgColor = bg;
+}
+
+void displayFramebuffer_setTextSize(uint8_t s) { text.size = s > 0 ? s : 1; }
+
+void displayFramebuffer_setTextWrap(bool w) { text.wrap = w; }
+
+size_t displayFramebuffer_printChar(char c) {
+  return displayText_printChar(&text, c);
+}
+
+size_t displayFramebuffer_print(const char str[]) {
+  return displayText_print(&text, str);
+}
+
+size_t displayFramebuffer_printDecimalInt(int num) {
+  return displayText_printDecimalInt(&text, num);
+}
+
+size_t displayFramebuffer_println(const char str[]) {
+  return displayText_print(&text, str) + displayText_println(&text);
+}
+
+size_t displayFramebuffer_printlnChar(char c) {
+  return displayText_printChar(&text, c) + displayText_println(&text);
+}
+
+size_t displayFramebuffer_printlnDecimalInt(int num) {
+  return displayText_printDecimalInt(&text, num) + displayText_println(&text);
+}
+
+// Sends span to the LCD with the cheapest call.
+static void displayFramebuffer_send(const displayFramebuffer_span_t *span) {
+  if (span->h == 1 && span->w == 1)
+    display_drawPixel(span->x, span->y, span->color);
+  else if (span->h == 1)
+    display_drawFastHLine(span->x, span->y, span->w, span->color);
+  else if (span->w == 1)
+    display_drawFastVLine(span->x, span->y, span->h, span->color);
+  else
+    display_fillRect(span->x, span->y, span->w, span->h, span->color);
+}
+
+// Sends the changed pixels of rect. A span starts at a changed pixel and goes
+// on while the color stays the same; a span equal to one on the row above
+// makes that one taller instead.
+static void
+displayFramebuffer_flushRect(const displayFramebuffer_rect_t *rect) {
+  displayFramebuffer_span_t open[DISPLAY_FRAMEBUFFER_OPEN_SPAN_COUNT];
+  uint16_t openCount = 0;
+  for (int16_t y = rect->y0; y < rect->y1; y++) {
+    display_pixel_t *row = framebuffer[y];
+    display_pixel_t *shownRow = shown[y];
+    for (uint16_t i = 0; i < openCount; i++)
+      open[i].continued = false;
+    for (int16_t x = rect->x0; x < rect->x1;) {
+      if (row[x] == shownRow[x]) {
+        x++;
+        continue;
+      }
+      displayFramebuffer_span_t span = {x, y, 0, 1, row[x], true};
+      while (x < rect->x1 && row[x] == span.color)
+        shownRow[x++] = span.color;
+      span.w = x - span.x;
+      uint16_t i;
+      for (i = 0; i < openCount; i++)
+        if (!open[i].continued && open[i].x == span.x && open[i].w == span.w &&
+            open[i].color == span.color)
+          break;
+      if (i < openCount) {
+        open[i].h++;
+        open[i].continued = true;
+      } else if (openCount < DISPLAY_FRAMEBUFFER_OPEN_SPAN_COUNT) {
+        open[openCount++] = span;
+      } else {
+        displayFramebuffer_send(&span);
+      }
+    }
+    // Send the spans that ended on the row above.
+    for (uint16_t i = 0; i < openCount;) {
+      if (open[i].continued) {
+        i++;
+      } else {
+        displayFramebuffer_send(&open[i]);
+        open[i] = open[--openCount];
+      }
+    }
+  }
+  for (uint16_t i = 0; i < openCount; i++)
+    displayFramebuffer_send(&open[i]);
+}
+
+void displayFramebuffer_flush() {
+  for (uint16_t i = 0; i < dirtyRectCount; i++)
+    displayFramebuffer_flushRect(&dirtyRects[i]);
+  dirtyRectCount = 0;
+}
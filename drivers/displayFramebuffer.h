@@ -0,0 +1,93 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAYFRAMEBUFFER_H
+#define DISPLAYFRAMEBUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// An RGB565 copy of the screen in memory. Programs built with
+// -DDISPLAY_FRAMEBUFFER=1 draw into it through the usual display_* calls (see
+// the end of display.h) and call display_flush() when a frame is done.
+// - Every drawing call marks its bounding box dirty. A box that overlaps or
+//   touches a dirty rectangle is merged into it; with
+//   DISPLAY_FRAMEBUFFER_DIRTY_RECT_COUNT rectangles, a new one is merged into
+//   the one it grows least.
+// - A second copy holds what the LCD shows, so flushing only sends pixels that
+//   really changed: a digit drawn in black and then in green costs nothing
+//   where the two overlap, a bar that grows only sends its new end.
+// - The LCD is reached through the library's own burst writes: each span of
+//   equal, changed pixels in a row is one window and one flood
+//   (display_drawFastHLine()), and spans repeated on the rows below are
+//   merged into one display_fillRect().
+// - Characters are copied from the glyph cache (displayGlyphCache.h) a row at
+//   a time.
+// The framebuffer assumes the rotation display_init() leaves, landscape with
+// the origin in the upper left. Calls that are not listed here (rotation,
+// size, touch, tests) go to the LCD.
+
+#define DISPLAY_FRAMEBUFFER_DIRTY_RECT_COUNT 16
+#define DISPLAY_FRAMEBUFFER_OPEN_SPAN_COUNT 32 // Spans merged down at once.
+
+// Initializes the LCD, clears it and the framebuffer to black.
+void displayFramebuffer_init();
+
+// Same as their display_* counterparts, but draw into the framebuffer.
+void displayFramebuffer_drawPixel(int16_t x0, int16_t y0, uint16_t color);
+void displayFramebuffer_drawLine(int16_t x0, int16_t y0, int16_t x1,
+                                 int16_t y1, uint16_t color);
+void displayFramebuffer_drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                      uint16_t color);
+void displayFramebuffer_drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                      uint16_t color);
+void displayFramebuffer_drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color);
+void displayFramebuffer_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                 uint16_t color);
+void displayFramebuffer_fillScreen(uint16_t color);
+void displayFramebuffer_drawCircle(int16_t x0, int16_t y0, int16_t r,
+                                   uint16_t color);
+void displayFramebuffer_fillCircle(int16_t x0, int16_t y0, int16_t r,
+                                   uint16_t color);
+void displayFramebuffer_drawTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                     int16_t y1, int16_t x2, int16_t y2,
+                                     uint16_t color);
+void displayFramebuffer_fillTriangle(int16_t x0, int16_t y0, int16_t x1,
+                                     int16_t y1, int16_t x2, int16_t y2,
+                                     uint16_t color);
+void displayFramebuffer_drawRoundRect(int16_t x0, int16_t y0, int16_t w,
+                                      int16_t h, int16_t radius,
+                                      uint16_t color);
+void displayFramebuffer_fillRoundRect(int16_t x0, int16_t y0, int16_t w,
+                                      int16_t h, int16_t radius,
+                                      uint16_t color);
+void displayFramebuffer_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                                   int16_t w, int16_t h, uint16_t color);
+void displayFramebuffer_drawChar(int16_t x, int16_t y, unsigned char c,
+                                 uint16_t color, uint16_t bg, uint8_t size);
+void displayFramebuffer_setCursor(int16_t x, int16_t y);
+void displayFramebuffer_setTextColor(uint16_t c);
+void displayFramebuffer_setTextColorBg(uint16_t c, uint16_t bg);
+void displayFramebuffer_setTextSize(uint8_t s);
+void displayFramebuffer_setTextWrap(bool w);
+size_t displayFramebuffer_println(const char str[]);
+size_t displayFramebuffer_printlnChar(char c);
+size_t displayFramebuffer_printlnDecimalInt(int num);
+size_t displayFramebuffer_print(const char str[]);
+size_t displayFramebuffer_printChar(char c);
+size_t displayFramebuffer_printDecimalInt(int num);
+
+// Sends every changed pixel to the LCD.
+void displayFramebuffer_flush();
+
+#endif
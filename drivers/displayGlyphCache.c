@@ -0,0 +1,140 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#define DISPLAY_FRAMEBUFFER_DIRECT // display_* below are the LCD.
+#define DISPLAY_QUEUE_DIRECT
+#include "displayGlyphCache.h"
+#include "display.h"
+#include "displayFont.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#define MAX_PIXEL_COUNT                                                        \
+  (DISPLAY_CHAR_WIDTH * DISPLAY_GLYPH_CACHE_MAX_SIZE * DISPLAY_CHAR_HEIGHT *   \
+   DISPLAY_GLYPH_CACHE_MAX_SIZE)
+
+// A rasterized character.
+typedef struct {
+  unsigned char c;
+  uint8_t size; // 0 if the entry is free.
+  uint16_t color, bg;
+  uint32_t lastUse;
+  display_pixel_t pixels[MAX_PIXEL_COUNT];
+} displayGlyphCache_entry_t;
+
+static displayGlyphCache_rect_t glyphRects[DISPLAY_FONT_GLYPH_COUNT]
+                                          [DISPLAY_GLYPH_CACHE_MAX_RECTS];
+static uint8_t glyphRectCounts[DISPLAY_FONT_GLYPH_COUNT]; // 0 until split.
+static displayGlyphCache_entry_t entries[DISPLAY_GLYPH_CACHE_ENTRY_COUNT];
+static uint32_t useCount; // Orders the entries by last use.
+
+// Returns true if the font pixel (column, row) of glyph is set.
+static bool displayGlyphCache_isSet(const uint8_t *glyph, uint8_t column,
+                                    uint8_t row) {
+  return column < DISPLAY_FONT_GLYPH_COLUMNS && (glyph[column] >> row) & 0x1;
+}
+
+// Splits c into rows of runs of one color, and makes a run as tall as the
+// rows below that have the same run.
+static void displayGlyphCache_split(unsigned char c) {
+  const uint8_t *glyph = &displayFont_glyphs[c * DISPLAY_FONT_GLYPH_COLUMNS];
+  displayGlyphCache_rect_t *rects = glyphRects[c];
+  uint8_t count = 0;
+  for (uint8_t row = 0; row < DISPLAY_CHAR_HEIGHT; row++) {
+    for (uint8_t column = 0; column < DISPLAY_CHAR_WIDTH;) {
+      bool foreground = displayGlyphCache_isSet(glyph, column, row);
+      uint8_t start = column;
+      while (column < DISPLAY_CHAR_WIDTH &&
+             displayGlyphCache_isSet(glyph, column, row) == foreground)
+        column++;
+      // The run is the bottom of a rectangle above, or starts a new one.
+      uint8_t i;
+      for (i = 0; i < count; i++)
+        if (rects[i].x == start && rects[i].w == column - start &&
+            rects[i].foreground == foreground &&
+            rects[i].y + rects[i].h == row)
+          break;
+      if (i < count) {
+        rects[i].h++;
+      } else {
+        displayGlyphCache_rect_t rect = {start, row, foreground,
+                                         column - start, 1};
+        rects[count++] = rect;
+      }
+    }
+  }
+  glyphRectCounts[c] = count;
+}
+
+const displayGlyphCache_rect_t *displayGlyphCache_getRects(unsigned char c,
+                                                           uint16_t *count) {
+  if (c >= DISPLAY_FONT_GLYPH_COUNT)
+    return NULL;
+  if (!glyphRectCounts[c])
+    displayGlyphCache_split(c);
+  *count = glyphRectCounts[c];
+  return glyphRects[c];
+}
+
+const uint16_t *displayGlyphCache_getPixels(unsigned char c, uint16_t color,
+                                            uint16_t bg, uint8_t size) {
+  if (size == 0 || size > DISPLAY_GLYPH_CACHE_MAX_SIZE || bg == color ||
+      c >= DISPLAY_FONT_GLYPH_COUNT)
+    return NULL;
+  // Look it up, else take the least recently used entry.
+  displayGlyphCache_entry_t *entry = &entries[0];
+  for (uint16_t i = 0; i < DISPLAY_GLYPH_CACHE_ENTRY_COUNT; i++) {
+    displayGlyphCache_entry_t *candidate = &entries[i];
+    if (candidate->size == size && candidate->c == c &&
+        candidate->color == color && candidate->bg == bg) {
+      candidate->lastUse = ++useCount;
+      return candidate->pixels;
+    }
+    if (candidate->lastUse < entry->lastUse)
+      entry = candidate;
+  }
+  entry->c = c;
+  entry->size = size;
+  entry->color = color;
+  entry->bg = bg;
+  entry->lastUse = ++useCount;
+  const uint8_t *glyph = &displayFont_glyphs[c * DISPLAY_FONT_GLYPH_COLUMNS];
+  uint16_t width = DISPLAY_CHAR_WIDTH * size;
+  display_pixel_t *pixel = entry->pixels;
+  for (uint16_t y = 0; y < DISPLAY_CHAR_HEIGHT * size; y++)
+    for (uint16_t x = 0; x < width; x++)
+      *pixel++ =
+          displayGlyphCache_isSet(glyph, x / size, y / size) ? color : bg;
+  return entry->pixels;
+}
+
+void displayGlyphCache_drawChar(int16_t x, int16_t y, unsigned char c,
+                                uint16_t color, uint16_t bg, uint8_t size) {
+  if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT ||
+      x + DISPLAY_CHAR_WIDTH * size - 1 < 0 ||
+      y + DISPLAY_CHAR_HEIGHT * size - 1 < 0)
+    return;
+  uint16_t count;
+  const displayGlyphCache_rect_t *rects = displayGlyphCache_getRects(c, &count);
+  if (!rects)
+    return;
+  for (uint16_t i = 0; i < count; i++) {
+    const displayGlyphCache_rect_t *rect = &rects[i];
+    if (!rect->foreground && bg == color)
+      continue; // Transparent.
+    uint16_t rectColor = rect->foreground ? color : bg;
+    if (size == 1 && rect->w == 1 && rect->h == 1)
+      display_drawPixel(x + rect->x, y + rect->y, rectColor);
+    else
+      display_fillRect(x + rect->x * size, y + rect->y * size, rect->w * size,
+                       rect->h * size, rectColor);
+  }
+}
@@ -0,0 +1,55 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAYGLYPHCACHE_H
+#define DISPLAYGLYPHCACHE_H
+
+#include <stdint.h>
+
+// Characters of displayFont.h prepared for drawing at any text size.
+// - Each glyph is split once into rectangles of one color: runs along a row,
+//   merged with the same runs on the rows below. That is about 14 per
+//   character, where the library fills every font pixel on its own, up to 48.
+//   Drawn scaled, each rectangle is one fill, one address window.
+// - A character with its size and colors is also rasterized into a packed
+//   RGB565 block, DISPLAY_CHAR_WIDTH * size by DISPLAY_CHAR_HEIGHT * size,
+//   that a framebuffer copies row by row. The last
+//   DISPLAY_GLYPH_CACHE_ENTRY_COUNT blocks used are kept, for sizes up to
+//   DISPLAY_GLYPH_CACHE_MAX_SIZE. Transparent text (bg equal to color) has no
+//   block, it only draws the foreground rectangles.
+
+#define DISPLAY_GLYPH_CACHE_MAX_RECTS 44   // Most rectangles in a glyph.
+#define DISPLAY_GLYPH_CACHE_ENTRY_COUNT 16 // Rasterized characters kept.
+#define DISPLAY_GLYPH_CACHE_MAX_SIZE 6     // Largest text size rasterized.
+
+// A rectangle of a glyph, in font pixels.
+typedef struct {
+  uint8_t x : 3, y : 3, foreground : 1; // Background otherwise.
+  uint8_t w : 3, h : 4;
+} displayGlyphCache_rect_t;
+
+// Returns the rectangles that make up c and their number in count, or NULL if
+// the font has no such character.
+const displayGlyphCache_rect_t *displayGlyphCache_getRects(unsigned char c,
+                                                           uint16_t *count);
+
+// Returns c rasterized at size in color on bg, row after row, or NULL if text
+// of that size is not cached, the text is transparent or the font has no such
+// character. The block stays valid until DISPLAY_GLYPH_CACHE_ENTRY_COUNT other
+// characters have been rasterized.
+const uint16_t *displayGlyphCache_getPixels(unsigned char c, uint16_t color,
+                                            uint16_t bg, uint8_t size);
+
+// Same as display_drawChar(), with one fill per rectangle of the glyph.
+void displayGlyphCache_drawChar(int16_t x, int16_t y, unsigned char c,
+                                uint16_t color, uint16_t bg, uint8_t size);
+
+#endif
@@ -0,0 +1,439 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#define DISPLAY_QUEUE_DIRECT // display_* below are the LCD.
+#include "displayQueue.h"
+#include "display.h"
+#include "displayGlyphCache.h"
+#include "displayText.h"
+#include <string.h>
+
+#ifdef ZYBO_BOARD
+#include "xtime_l.h"
+#else
+#include <time.h>
+#endif
+
+#define MICROS_PER_SECOND 1000000
+
+typedef enum {
+  COMMAND_FILL, // Rectangle, lines along an axis and pixels.
+  COMMAND_LINE,
+  COMMAND_CIRCLE,
+  COMMAND_FILL_CIRCLE,
+  COMMAND_TRIANGLE,
+  COMMAND_FILL_TRIANGLE,
+  COMMAND_ROUND_RECT,
+  COMMAND_FILL_ROUND_RECT,
+  COMMAND_BITMAP,
+  COMMAND_CHAR
+} displayQueue_kind_t;
+
+// A recorded call. Every command draws inside its box, x0 <= x < x1 and
+// y0 <= y < y1; the box of a fill is the rectangle, clipped to the screen.
+typedef struct {
+  displayQueue_kind_t kind;
+  int16_t x0, y0, x1, y1;
+  int16_t args[6]; // Coordinates and sizes, as passed to the display_* call.
+  uint16_t color;
+  uint16_t bg;           // COMMAND_CHAR.
+  const uint8_t *bitmap; // COMMAND_BITMAP.
+} displayQueue_command_t;
+
+// Sent commands come first, then the closed frames waiting to be sent, then
+// the frame being recorded.
+static displayQueue_command_t commands[DISPLAY_QUEUE_COMMAND_COUNT];
+static uint16_t commandCount;
+static uint16_t sentCount;  // Commands before this one are on the LCD.
+static uint16_t frameStart; // First command of the frame being recorded.
+static uint32_t budgetMicros = DISPLAY_QUEUE_NO_BUDGET;
+static displayText_t text;
+
+static uint32_t displayQueue_getMicros() {
+#ifdef ZYBO_BOARD
+  XTime time;
+  XTime_GetTime(&time);
+  return time / (COUNTS_PER_SECOND / MICROS_PER_SECOND);
+#else
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec * MICROS_PER_SECOND + time.tv_nsec / 1000;
+#endif
+}
+
+static bool displayQueue_overlap(const displayQueue_command_t *a,
+                                 const displayQueue_command_t *b) {
+  return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+// Returns true if a lies inside b.
+static bool displayQueue_inside(const displayQueue_command_t *a,
+                                const displayQueue_command_t *b) {
+  return a->x0 >= b->x0 && a->x1 <= b->x1 && a->y0 >= b->y0 && a->y1 <= b->y1;
+}
+
+// Grows fill a into the fill of a and b if that is a rectangle of one color.
+static bool displayQueue_merge(displayQueue_command_t *a,
+                               const displayQueue_command_t *b) {
+  if (a->kind != COMMAND_FILL || b->kind != COMMAND_FILL ||
+      a->color != b->color)
+    return false;
+  bool sameColumns = a->x0 == b->x0 && a->x1 == b->x1;
+  bool sameRows = a->y0 == b->y0 && a->y1 == b->y1;
+  bool rowsTouch = a->y0 <= b->y1 && b->y0 <= a->y1;
+  bool columnsTouch = a->x0 <= b->x1 && b->x0 <= a->x1;
+  if (displayQueue_inside(b, a))
+    return true;
+  if (!(displayQueue_inside(a, b) || (sameColumns && rowsTouch) ||
+        (sameRows && columnsTouch)))
+    return false;
+  if (b->x0 < a->x0)
+    a->x0 = b->x0;
+  if (b->y0 < a->y0)
+    a->y0 = b->y0;
+  if (b->x1 > a->x1)
+    a->x1 = b->x1;
+  if (b->y1 > a->y1)
+    a->y1 = b->y1;
+  return true;
+}
+
+// Top to bottom, then left to right.
+static bool displayQueue_before(const displayQueue_command_t *a,
+                                const displayQueue_command_t *b) {
+  return a->y0 < b->y0 || (a->y0 == b->y0 && a->x0 < b->x0);
+}
+
+// Sorts the frame being recorded by address window and merges its fills that
+// end up next to each other. Commands only move past the ones they do not
+// overlap, so everything still draws over what it did.
+static void displayQueue_close() {
+  for (uint16_t i = frameStart + 1; i < commandCount; i++) {
+    displayQueue_command_t command = commands[i];
+    uint16_t j = i;
+    while (j > frameStart && displayQueue_before(&command, &commands[j - 1]) &&
+           !displayQueue_overlap(&command, &commands[j - 1])) {
+      commands[j] = commands[j - 1];
+      j--;
+    }
+    commands[j] = command;
+  }
+  uint16_t count = frameStart;
+  for (uint16_t i = frameStart; i < commandCount; i++)
+    if (count == frameStart ||
+        !displayQueue_merge(&commands[count - 1], &commands[i]))
+      commands[count++] = commands[i];
+  commandCount = count;
+  frameStart = count;
+}
+
+// Draws command on the LCD.
+static void displayQueue_draw(const displayQueue_command_t *command) {
+  const int16_t *a = command->args;
+  uint16_t color = command->color;
+  int16_t w = command->x1 - command->x0;
+  int16_t h = command->y1 - command->y0;
+  switch (command->kind) {
+  case COMMAND_FILL:
+    if (w == 1 && h == 1)
+      display_drawPixel(command->x0, command->y0, color);
+    else if (h == 1)
+      display_drawFastHLine(command->x0, command->y0, w, color);
+    else if (w == 1)
+      display_drawFastVLine(command->x0, command->y0, h, color);
+    else
+      display_fillRect(command->x0, command->y0, w, h, color);
+    break;
+  case COMMAND_LINE:
+    display_drawLine(a[0], a[1], a[2], a[3], color);
+    break;
+  case COMMAND_CIRCLE:
+    display_drawCircle(a[0], a[1], a[2], color);
+    break;
+  case COMMAND_FILL_CIRCLE:
+    display_fillCircle(a[0], a[1], a[2], color);
+    break;
+  case COMMAND_TRIANGLE:
+    display_drawTriangle(a[0], a[1], a[2], a[3], a[4], a[5], color);
+    break;
+  case COMMAND_FILL_TRIANGLE:
+    display_fillTriangle(a[0], a[1], a[2], a[3], a[4], a[5], color);
+    break;
+  case COMMAND_ROUND_RECT:
+    display_drawRoundRect(a[0], a[1], a[2], a[3], a[4], color);
+    break;
+  case COMMAND_FILL_ROUND_RECT:
+    display_fillRoundRect(a[0], a[1], a[2], a[3], a[4], color);
+    break;
+  case COMMAND_BITMAP:
+    display_drawBitmap(a[0], a[1], command->bitmap, a[2], a[3], color);
+    break;
+  case COMMAND_CHAR:
+    displayGlyphCache_drawChar(a[0], a[1], a[2], color, command->bg, a[3]);
+    break;
+  }
+}
+
+// Sends the closed frames until budget microseconds have gone by.
+static void displayQueue_send(uint32_t budget) {
+  uint32_t start = displayQueue_getMicros();
+  while (sentCount < frameStart) {
+    displayQueue_draw(&commands[sentCount++]);
+    if (budget != DISPLAY_QUEUE_NO_BUDGET &&
+        displayQueue_getMicros() - start >= budget)
+      break;
+  }
+  if (sentCount == commandCount) {
+    commandCount = 0;
+    sentCount = 0;
+    frameStart = 0;
+  }
+}
+
+// Appends command, whose box is set.
+static void displayQueue_record(const displayQueue_command_t *command) {
+  if (command->x0 >= command->x1 || command->y0 >= command->y1)
+    return;
+  if (commandCount == DISPLAY_QUEUE_COMMAND_COUNT) {
+    displayQueue_close();
+    displayQueue_send(DISPLAY_QUEUE_NO_BUDGET);
+  }
+  if (command->kind == COMMAND_FILL) {
+    // Drop what the fill paints over. That leaves the frames sorted.
+    uint16_t count = sentCount;
+    uint16_t closedCount = frameStart;
+    for (uint16_t i = sentCount; i < commandCount; i++) {
+      if (!displayQueue_inside(&commands[i], command))
+        commands[count++] = commands[i];
+      else if (i < closedCount)
+        frameStart--;
+    }
+    commandCount = count;
+    // Merge into an earlier fill, unless a command in between is in the way.
+    for (uint16_t i = commandCount; i > sentCount; i--) {
+      if (displayQueue_merge(&commands[i - 1], command))
+        return;
+      if (displayQueue_overlap(&commands[i - 1], command))
+        break;
+    }
+  }
+  commands[commandCount++] = *command;
+}
+
+// Records a fill of the rectangle, clipped to the screen.
+static void displayQueue_recordFill(int16_t x, int16_t y, int16_t w, int16_t h,
+                                    uint16_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  displayQueue_command_t command = {
+      COMMAND_FILL, x < 0 ? 0 : x, y < 0 ? 0 : y,
+      x + w > DISPLAY_WIDTH ? DISPLAY_WIDTH : x + w,
+      y + h > DISPLAY_HEIGHT ? DISPLAY_HEIGHT : y + h, {0}, color, 0, NULL};
+  displayQueue_record(&command);
+}
+
+// Records a call of kind drawing inside (x0, y0) to (x1, y1), both included.
+static void displayQueue_recordShape(displayQueue_kind_t kind, int16_t x0,
+                                     int16_t y0, int16_t x1, int16_t y1,
+                                     const int16_t args[], uint16_t argCount,
+                                     uint16_t color) {
+  displayQueue_command_t command = {kind, x0, y0, x1 + 1, y1 + 1, {0}, color,
+                                    0, NULL};
+  memcpy(command.args, args, argCount * sizeof(args[0]));
+  displayQueue_record(&command);
+}
+
+void displayQueue_init() {
+  displayQueue_begin();
+  display_init();
+  displayText_init(&text, displayQueue_drawChar);
+}
+
+void displayQueue_begin() {
+  displayQueue_close();
+  displayQueue_send(DISPLAY_QUEUE_NO_BUDGET);
+}
+
+void displayQueue_drawPixel(int16_t x0, int16_t y0, uint16_t color) {
+  displayQueue_recordFill(x0, y0, 1, 1, color);
+}
+
+void displayQueue_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                           uint16_t color) {
+  int16_t left = x0 < x1 ? x0 : x1, right = x0 < x1 ? x1 : x0;
+  int16_t top = y0 < y1 ? y0 : y1, bottom = y0 < y1 ? y1 : y0;
+  if (x0 == x1 || y0 == y1) { // The same pixels as a fill.
+    displayQueue_recordFill(left, top, right - left + 1, bottom - top + 1,
+                            color);
+    return;
+  }
+  int16_t args[] = {x0, y0, x1, y1};
+  displayQueue_recordShape(COMMAND_LINE, left, top, right, bottom, args, 4,
+                           color);
+}
+
+void displayQueue_drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                uint16_t color) {
+  displayQueue_recordFill(x, y, 1, h, color);
+}
+
+void displayQueue_drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                uint16_t color) {
+  displayQueue_recordFill(x, y, w, 1, color);
+}
+
+void displayQueue_drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color) {
+  displayQueue_recordFill(x, y, w, 1, color);
+  displayQueue_recordFill(x, y + h - 1, w, 1, color);
+  displayQueue_recordFill(x, y, 1, h, color);
+  displayQueue_recordFill(x + w - 1, y, 1, h, color);
+}
+
+void displayQueue_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color) {
+  displayQueue_recordFill(x, y, w, h, color);
+}
+
+void displayQueue_fillScreen(uint16_t color) {
+  displayQueue_recordFill(0, 0, DISPLAY_WIDTH, DISPLAY_HEIGHT, color);
+}
+
+void displayQueue_drawCircle(int16_t x0, int16_t y0, int16_t r,
+                             uint16_t color) {
+  int16_t args[] = {x0, y0, r};
+  displayQueue_recordShape(COMMAND_CIRCLE, x0 - r, y0 - r, x0 + r, y0 + r,
+                           args, 3, color);
+}
+
+void displayQueue_fillCircle(int16_t x0, int16_t y0, int16_t r,
+                             uint16_t color) {
+  int16_t args[] = {x0, y0, r};
+  displayQueue_recordShape(COMMAND_FILL_CIRCLE, x0 - r, y0 - r, x0 + r, y0 + r,
+                           args, 3, color);
+}
+
+// Records a triangle of kind inside the box of its corners.
+static void displayQueue_recordTriangle(displayQueue_kind_t kind, int16_t x0,
+                                        int16_t y0, int16_t x1, int16_t y1,
+                                        int16_t x2, int16_t y2,
+                                        uint16_t color) {
+  int16_t left = x0 < x1 ? (x0 < x2 ? x0 : x2) : (x1 < x2 ? x1 : x2);
+  int16_t right = x0 > x1 ? (x0 > x2 ? x0 : x2) : (x1 > x2 ? x1 : x2);
+  int16_t top = y0 < y1 ? (y0 < y2 ? y0 : y2) : (y1 < y2 ? y1 : y2);
+  int16_t bottom = y0 > y1 ? (y0 > y2 ? y0 : y2) : (y1 > y2 ? y1 : y2);
+  int16_t args[] = {x0, y0, x1, y1, x2, y2};
+  displayQueue_recordShape(kind, left, top, right, bottom, args, 6, color);
+}
+
+void displayQueue_drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                               int16_t x2, int16_t y2, uint16_t color) {
+  displayQueue_recordTriangle(COMMAND_TRIANGLE, x0, y0, x1, y1, x2, y2, color);
+}
+
+void displayQueue_fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                               int16_t x2, int16_t y2, uint16_t color) {
+  displayQueue_recordTriangle(COMMAND_FILL_TRIANGLE, x0, y0, x1, y1, x2, y2,
+                              color);
+}
+
+// Records a rounded rectangle of kind. With a radius over half the size, the
+// corners stick out of it.
+static void displayQueue_recordRoundRect(displayQueue_kind_t kind, int16_t x0,
+                                         int16_t y0, int16_t w, int16_t h,
+                                         int16_t r, uint16_t color) {
+  if (w <= 0 || h <= 0)
+    return;
+  int16_t x1 = x0 + w - 1, y1 = y0 + h - 1;
+  int16_t args[] = {x0, y0, w, h, r};
+  displayQueue_recordShape(kind, x1 - 2 * r < x0 ? x1 - 2 * r : x0,
+                           y1 - 2 * r < y0 ? y1 - 2 * r : y0,
+                           x0 + 2 * r > x1 ? x0 + 2 * r : x1,
+                           y0 + 2 * r > y1 ? y0 + 2 * r : y1, args, 5, color);
+}
+
+void displayQueue_drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+                                int16_t radius, uint16_t color) {
+  displayQueue_recordRoundRect(COMMAND_ROUND_RECT, x0, y0, w, h, radius,
+                               color);
+}
+
+void displayQueue_fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+                                int16_t radius, uint16_t color) {
+  displayQueue_recordRoundRect(COMMAND_FILL_ROUND_RECT, x0, y0, w, h, radius,
+                               color);
+}
+
+void displayQueue_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                             int16_t w, int16_t h, uint16_t color) {
+  displayQueue_command_t command = {
+      COMMAND_BITMAP, x, y, x + w, y + h, {x, y, w, h}, color, 0, bitmap};
+  displayQueue_record(&command);
+}
+
+void displayQueue_drawChar(int16_t x, int16_t y, unsigned char c,
+                           uint16_t color, uint16_t bg, uint8_t size) {
+  displayQueue_command_t command = {
+      COMMAND_CHAR, x, y, x + DISPLAY_CHAR_WIDTH * size,
+      y + DISPLAY_CHAR_HEIGHT * size, {x, y, c, size}, color, bg, NULL};
+  displayQueue_record(&command);
+}
+
+void displayQueue_setCursor(int16_t x, int16_t y) {
+  text.cursorX = x;
+  text.cursorY = y;
+}
+
+void displayQueue_setTextColor(uint16_t c) {
+  text.color = c;
+  text.bgColor = c; // Transparent.
+}
+
+void displayQueue_setTextColorBg(uint16_t c, uint16_t bg) {
+  text.color = c;
+  text.bgColor = bg;
+}
+
+void displayQueue_setTextSize(uint8_t s) { text.size = s > 0 ? s : 1; }
+
+void displayQueue_setTextWrap(bool w) { text.wrap = w; }
+
+size_t displayQueue_printChar(char c) {
+  return displayText_printChar(&text, c);
+}
+
+size_t displayQueue_print(const char str[]) {
+  return displayText_print(&text, str);
+}
+
+size_t displayQueue_printDecimalInt(int num) {
+  return displayText_printDecimalInt(&text, num);
+}
+
+size_t displayQueue_println(const char str[]) {
+  return displayText_print(&text, str) + displayText_println(&text);
+}
+
+size_t displayQueue_printlnChar(char c) {
+  return displayText_printChar(&text, c) + displayText_println(&text);
+}
+
+size_t displayQueue_printlnDecimalInt(int num) {
+  return displayText_printDecimalInt(&text, num) + displayText_println(&text);
+}
+
+void displayQueue_setBudget(uint32_t micros) { budgetMicros = micros; }
+
+bool displayQueue_submit() {
+  displayQueue_close();
+  displayQueue_send(budgetMicros);
+  return commandCount == 0;
+}
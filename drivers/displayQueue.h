@@ -0,0 +1,98 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAYQUEUE_H
+#define DISPLAYQUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Records drawing calls in a list and sends them to the LCD later, in one
+// pass. Programs built with -DDISPLAY_QUEUE=1 record through the usual
+// display_* calls (see the end of display.h); display_flush() sends them.
+// - A fill (pixel, line along an axis, rectangle) that lines up with an
+//   earlier fill of the same color, or overlaps it, is merged into it if
+//   nothing recorded in between overlaps it: a bar drawn line by line costs
+//   one window. Anything a fill covers completely is dropped.
+// - Sending a frame first sorts it by address window, top to bottom, without
+//   moving a command past one it overlaps, and merges the fills that end up
+//   next to each other.
+// - Characters are drawn with one fill per rectangle of the glyph
+//   (displayGlyphCache.h).
+// - With a budget, a flush sends commands until it has taken that long and
+//   leaves the rest for the next flush, so a main loop that flushes on every
+//   pass never holds up the detector for much longer than the budget. What is
+//   recorded meanwhile is drawn after the rest.
+// The queue holds DISPLAY_QUEUE_COMMAND_COUNT commands; recording into a full
+// queue sends it all first. Do not use it with DISPLAY_FRAMEBUFFER, which
+// does its own batching.
+
+#define DISPLAY_QUEUE_COMMAND_COUNT 128
+#define DISPLAY_QUEUE_NO_BUDGET 0 // Flushes send everything.
+
+// Sends what is queued, initializes the LCD and clears the text settings.
+void displayQueue_init();
+
+// Starts a frame: sends what is left of the previous one, whatever the budget.
+// Recording without it appends to the queue.
+void displayQueue_begin();
+
+// Same as their display_* counterparts, but record the call.
+void displayQueue_drawPixel(int16_t x0, int16_t y0, uint16_t color);
+void displayQueue_drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                           uint16_t color);
+void displayQueue_drawFastVLine(int16_t x, int16_t y, int16_t h,
+                                uint16_t color);
+void displayQueue_drawFastHLine(int16_t x, int16_t y, int16_t w,
+                                uint16_t color);
+void displayQueue_drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color);
+void displayQueue_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color);
+void displayQueue_fillScreen(uint16_t color);
+void displayQueue_drawCircle(int16_t x0, int16_t y0, int16_t r,
+                             uint16_t color);
+void displayQueue_fillCircle(int16_t x0, int16_t y0, int16_t r,
+                             uint16_t color);
+void displayQueue_drawTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                               int16_t x2, int16_t y2, uint16_t color);
+void displayQueue_fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                               int16_t x2, int16_t y2, uint16_t color);
+void displayQueue_drawRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+                                int16_t radius, uint16_t color);
+void displayQueue_fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
+                                int16_t radius, uint16_t color);
+void displayQueue_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
+                             int16_t w, int16_t h, uint16_t color);
+void displayQueue_drawChar(int16_t x, int16_t y, unsigned char c,
+                           uint16_t color, uint16_t bg, uint8_t size);
+void displayQueue_setCursor(int16_t x, int16_t y);
+void displayQueue_setTextColor(uint16_t c);
+void displayQueue_setTextColorBg(uint16_t c, uint16_t bg);
+void displayQueue_setTextSize(uint8_t s);
+void displayQueue_setTextWrap(bool w);
+size_t displayQueue_println(const char str[]);
+size_t displayQueue_printlnChar(char c);
+size_t displayQueue_printlnDecimalInt(int num);
+size_t displayQueue_print(const char str[]);
+size_t displayQueue_printChar(char c);
+size_t displayQueue_printDecimalInt(int num);
+
+// Sets how long a flush may take, in microseconds, or DISPLAY_QUEUE_NO_BUDGET.
+void displayQueue_setBudget(uint32_t micros);
+
+// Ends the frame being recorded and sends the queue, within the budget. The
+// bitmaps of recorded drawBitmap() calls must still be there. Returns true if
+// the queue is empty.
+bool displayQueue_submit();
+
+#endif
@@ -0,0 +1,61 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "displayText.h"
+#include "display.h"
+#include <stdio.h>
+
+#define DEFAULT_COLOR DISPLAY_WHITE
+#define NUMBER_BUFFER_SIZE 12 // Sign, 10 digits and the '\0'.
+
+void displayText_init(displayText_t *text, displayText_drawChar_t drawChar) {
+  text->cursorX = 0;
+  text->cursorY = 0;
+  text->color = DEFAULT_COLOR;
+  text->bgColor = DEFAULT_COLOR;
+  text->size = 1;
+  text->wrap = true;
+  text->drawChar = drawChar;
+}
+
+size_t displayText_printChar(displayText_t *text, char c) {
+  if (c == '\n') {
+    text->cursorY += text->size * DISPLAY_CHAR_HEIGHT;
+    text->cursorX = 0;
+  } else if (c != '\r') {
+    text->drawChar(text->cursorX, text->cursorY, c, text->color, text->bgColor,
+                   text->size);
+    text->cursorX += text->size * DISPLAY_CHAR_WIDTH;
+    if (text->wrap &&
+        text->cursorX > DISPLAY_WIDTH - text->size * DISPLAY_CHAR_WIDTH) {
+      text->cursorY += text->size * DISPLAY_CHAR_HEIGHT;
+      text->cursorX = 0;
+    }
+  }
+  return 1;
+}
+
+size_t displayText_print(displayText_t *text, const char str[]) {
+  size_t count = 0;
+  while (str[count])
+    displayText_printChar(text, str[count++]);
+  return count;
+}
+
+size_t displayText_printDecimalInt(displayText_t *text, int num) {
+  char buffer[NUMBER_BUFFER_SIZE];
+  snprintf(buffer, sizeof(buffer), "%d", num);
+  return displayText_print(text, buffer);
+}
+
+size_t displayText_println(displayText_t *text) {
+  return displayText_print(text, "\r\n");
+}
@@ -0,0 +1,51 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef DISPLAYTEXT_H
+#define DISPLAYTEXT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// The text cursor, colors and size of the display library, and its rules for
+// moving the cursor (Adafruit_GFX::write()), for the modules that lay out text
+// themselves: displayFramebuffer.h and displayQueue.h. They only provide how a
+// character is drawn.
+
+typedef void (*displayText_drawChar_t)(int16_t x, int16_t y, unsigned char c,
+                                       uint16_t color, uint16_t bg,
+                                       uint8_t size);
+
+typedef struct {
+  int16_t cursorX, cursorY;
+  uint16_t color, bgColor; // Equal for transparent text.
+  uint8_t size;
+  bool wrap; // Move to the next line at the right edge.
+  displayText_drawChar_t drawChar;
+} displayText_t;
+
+// Sets the library defaults: white transparent text of size 1 at (0, 0),
+// wrapped.
+void displayText_init(displayText_t *text, displayText_drawChar_t drawChar);
+
+// Draws c at the cursor and moves it. '\n' goes to the next line, '\r' is
+// ignored. Returns 1.
+size_t displayText_printChar(displayText_t *text, char c);
+
+// Returns the number of characters printed.
+size_t displayText_print(displayText_t *text, const char str[]);
+size_t displayText_printDecimalInt(displayText_t *text, int num);
+
+// Ends the line as println() does. Returns the number of characters printed.
+size_t displayText_println(displayText_t *text);
+
+#endif
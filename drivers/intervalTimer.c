@@ -18,6 +18,7 @@
 #define LOAD 0x20
 #define START 0x80
 #define SHIFT 32
+#define NANOSECONDS_PER_SECOND 1000000000ULL
 
 // Takes the offset, reads timer 0, and returns the value
 int32_t timer_readRegister0(int32_t offset) {
@@ -164,38 +165,64 @@ void intervalTimer_resetAll() {
   intervalTimer_reset(INTERVAL_TIMER_TIMER_2);
 }
 
+// Takes the timer number and the offset, and returns the register value
+static uint32_t timer_readRegister(uint32_t timerNumber, int32_t offset) {
+  if (timerNumber == INTERVAL_TIMER_TIMER_0) {
+    return timer_readRegister0(offset);
+  } else if (timerNumber == INTERVAL_TIMER_TIMER_1) {
+    return timer_readRegister1(offset);
+  } else {
+    return timer_readRegister2(offset);
+  }
+}
+
 // Use this function to ascertain how long a given timer has been running.
 // Note that it should not be an error to call this function on a running timer
 // though it usually makes more sense to call this after intervalTimer_stop()
 // has been called. The timerNumber argument determines which timer is read.
 double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber) {
-  uint32_t timer0;
-  uint64_t timer1;
-  double total;
-  double time;
-
-  // Read in the couhnter bits and save them as timer0 and timer1. Shift the
-  // bits from timer1 and then OR them with timer0. Find the total timer by
-  // dividing by the frequency
+  uint32_t ticksPerSecond = intervalTimer_getTicksPerSecond(timerNumber);
+  if (ticksPerSecond == 0)
+    return 0.0;
+  return (double)intervalTimer_getTicks64(timerNumber) / ticksPerSecond;
+}
+
+// Returns the 64-bit tick count of a timer with a hi-lo-hi read.
+uint64_t intervalTimer_getTicks64(uint32_t timerNumber) {
+  if (timerNumber > INTERVAL_TIMER_TIMER_2)
+    return 0;
+  uint32_t high, low, highAgain;
+  // If the low half wrapped between the reads, the high half has changed, so
+  // the low half may belong to either high value. Read again; the next wrap
+  // is 2^32 ticks (43 s) away.
+  highAgain = timer_readRegister(timerNumber, TCR1_OFFSET);
+  do {
+    high = highAgain;
+    low = timer_readRegister(timerNumber, TCR0_OFFSET);
+    highAgain = timer_readRegister(timerNumber, TCR1_OFFSET);
+  } while (high != highAgain);
+  return ((uint64_t)high << SHIFT) | low;
+}
+
+// Returns the clock frequency of a timer.
+uint32_t intervalTimer_getTicksPerSecond(uint32_t timerNumber) {
   if (timerNumber == INTERVAL_TIMER_TIMER_0) {
-    timer0 = timer_readRegister0(TCR0_OFFSET);
-    timer1 = timer_readRegister0(TCR1_OFFSET);
-    total = (timer1 << SHIFT) | timer0;
-    time = total / XPAR_AXI_TIMER_0_CLOCK_FREQ_HZ;
-    return time;
+    return XPAR_AXI_TIMER_0_CLOCK_FREQ_HZ;
   } else if (timerNumber == INTERVAL_TIMER_TIMER_1) {
-
-    timer0 = timer_readRegister1(TCR0_OFFSET);
-    timer1 = timer_readRegister1(TCR1_OFFSET);
-    total = (timer1 << SHIFT) | timer0;
-    time = total / XPAR_AXI_TIMER_1_CLOCK_FREQ_HZ;
-    return time;
+    return XPAR_AXI_TIMER_1_CLOCK_FREQ_HZ;
   } else if (timerNumber == INTERVAL_TIMER_TIMER_2) {
-
-    timer0 = timer_readRegister2(TCR0_OFFSET);
-    timer1 = timer_readRegister2(TCR1_OFFSET);
-    total = (timer1 << SHIFT) | timer0;
-    time = total / XPAR_AXI_TIMER_2_CLOCK_FREQ_HZ;
-    return time;
+    return XPAR_AXI_TIMER_2_CLOCK_FREQ_HZ;
   }
+  return 0;
+}
+
+// Converts ticks to nanoseconds. Whole seconds and the remainder are converted
+// separately so that the multiplication cannot overflow.
+uint64_t intervalTimer_ticksToNanoseconds(uint32_t timerNumber,
+                                          uint64_t ticks) {
+  uint32_t ticksPerSecond = intervalTimer_getTicksPerSecond(timerNumber);
+  if (ticksPerSecond == 0)
+    return 0;
+  return (ticks / ticksPerSecond) * NANOSECONDS_PER_SECOND +
+         (ticks % ticksPerSecond) * NANOSECONDS_PER_SECOND / ticksPerSecond;
 }
@@ -74,4 +74,21 @@ intervalTimer_status_t intervalTimer_testAll();
 // has been called. The timerNumber argument determines which timer is read.
 double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber);
 
+// Returns the 64-bit tick count of a timer, running or not. The two 32-bit
+// counter halves are read high, low, high and the read is repeated if the high
+// half changed in between, so the result never tears when the low half wraps.
+// This is only a few bus reads and no floating point, so it can be used to
+// take start/stop snapshots in hot code (the difference of two snapshots is
+// the elapsed ticks); convert with intervalTimer_ticksToNanoseconds() when
+// reporting.
+uint64_t intervalTimer_getTicks64(uint32_t timerNumber);
+
+// Returns the clock frequency of a timer in ticks per second (0 for an invalid
+// timerNumber).
+uint32_t intervalTimer_getTicksPerSecond(uint32_t timerNumber);
+
+// Converts a tick count (or a difference of two) of a timer to nanoseconds.
+uint64_t intervalTimer_ticksToNanoseconds(uint32_t timerNumber,
+                                          uint64_t ticks);
+
 #endif /* INTERVALTIMER_H_ */
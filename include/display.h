@@ -156,4 +156,84 @@ void display_clearOldTouchData();
 }
 #endif
 
+// Drawing can go through a layer that batches it (define one of these per
+// target, see drivers/):
+// - DISPLAY_FRAMEBUFFER draws into a framebuffer in memory; display_flush()
+//   sends what changed (displayFramebuffer.h).
+// - DISPLAY_QUEUE records the calls; display_flush() sends them, within the
+//   time set with display_setFlushBudget() (displayQueue.h).
+// Without either, display_flush() does nothing, so code can call it either
+// way.
+#define DISPLAY_NO_FLUSH_BUDGET 0 // Flushes send everything.
+#if defined(DISPLAY_FRAMEBUFFER)
+#include "displayFramebuffer.h"
+#ifndef DISPLAY_FRAMEBUFFER_DIRECT
+#define display_init displayFramebuffer_init
+#define display_drawPixel displayFramebuffer_drawPixel
+#define display_drawLine displayFramebuffer_drawLine
+#define display_drawFastVLine displayFramebuffer_drawFastVLine
+#define display_drawFastHLine displayFramebuffer_drawFastHLine
+#define display_drawRect displayFramebuffer_drawRect
+#define display_fillRect displayFramebuffer_fillRect
+#define display_fillScreen displayFramebuffer_fillScreen
+#define display_drawCircle displayFramebuffer_drawCircle
+#define display_fillCircle displayFramebuffer_fillCircle
+#define display_drawTriangle displayFramebuffer_drawTriangle
+#define display_fillTriangle displayFramebuffer_fillTriangle
+#define display_drawRoundRect displayFramebuffer_drawRoundRect
+#define display_fillRoundRect displayFramebuffer_fillRoundRect
+#define display_drawBitmap displayFramebuffer_drawBitmap
+#define display_drawChar displayFramebuffer_drawChar
+#define display_setCursor displayFramebuffer_setCursor
+#define display_setTextColor displayFramebuffer_setTextColor
+#define display_setTextColorBg displayFramebuffer_setTextColorBg
+#define display_setTextSize displayFramebuffer_setTextSize
+#define display_setTextWrap displayFramebuffer_setTextWrap
+#define display_println displayFramebuffer_println
+#define display_printlnChar displayFramebuffer_printlnChar
+#define display_printlnDecimalInt displayFramebuffer_printlnDecimalInt
+#define display_print displayFramebuffer_print
+#define display_printChar displayFramebuffer_printChar
+#define display_printDecimalInt displayFramebuffer_printDecimalInt
+#define display_flush displayFramebuffer_flush
+#endif
+#define display_setFlushBudget(micros) // Flushes are short.
+#elif defined(DISPLAY_QUEUE)
+#include "displayQueue.h"
+#ifndef DISPLAY_QUEUE_DIRECT
+#define display_init displayQueue_init
+#define display_drawPixel displayQueue_drawPixel
+#define display_drawLine displayQueue_drawLine
+#define display_drawFastVLine displayQueue_drawFastVLine
+#define display_drawFastHLine displayQueue_drawFastHLine
+#define display_drawRect displayQueue_drawRect
+#define display_fillRect displayQueue_fillRect
+#define display_fillScreen displayQueue_fillScreen
+#define display_drawCircle displayQueue_drawCircle
+#define display_fillCircle displayQueue_fillCircle
+#define display_drawTriangle displayQueue_drawTriangle
+#define display_fillTriangle displayQueue_fillTriangle
+#define display_drawRoundRect displayQueue_drawRoundRect
+#define display_fillRoundRect displayQueue_fillRoundRect
+#define display_drawBitmap displayQueue_drawBitmap
+#define display_drawChar displayQueue_drawChar
+#define display_setCursor displayQueue_setCursor
+#define display_setTextColor displayQueue_setTextColor
+#define display_setTextColorBg displayQueue_setTextColorBg
+#define display_setTextSize displayQueue_setTextSize
+#define display_setTextWrap displayQueue_setTextWrap
+#define display_println displayQueue_println
+#define display_printlnChar displayQueue_printlnChar
+#define display_printlnDecimalInt displayQueue_printlnDecimalInt
+#define display_print displayQueue_print
+#define display_printChar displayQueue_printChar
+#define display_printDecimalInt displayQueue_printDecimalInt
+#define display_flush displayQueue_submit
+#define display_setFlushBudget displayQueue_setBudget
+#endif
+#else
+#define display_flush()                // Already on the LCD.
+#define display_setFlushBudget(micros) // Nothing to flush.
+#endif
+
 #endif /* DISPLAY_H_ */
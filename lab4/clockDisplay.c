@@ -58,6 +58,7 @@ void clockDisplay_init() {
   display_fillScreen(DISPLAY_BLACK);
   display_setTextSize(CLOCKDISPLAY_TEXT_SIZE);
   clockDisplay_drawTriangles();
+  display_flush();
 }
 
 // Updates the time display with latest time, making sure to update only those
@@ -146,6 +147,8 @@ void clockDisplay_updateTimeDisplay(bool forceUpdateAll) {
       timeOld[i] = timeNew[i];
     }
   }
+  // With the framebuffer, only the pixels that really changed are sent.
+  display_flush();
 }
 
 // Reads the touched coordinates and performs the increment or decrement,
@@ -0,0 +1,177 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "adcBuffer.h"
+#include "intervalTimer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define ADC_BUFFER_MASK (ADC_BUFFER_CAPACITY - 1)
+
+#if (ADC_BUFFER_CAPACITY & ADC_BUFFER_MASK) != 0
+#error "ADC_BUFFER_CAPACITY must be a power of two."
+#endif
+
+static isr_AdcValue_t data[ADC_BUFFER_CAPACITY];
+static uint32_t writeIndex;   // Written only by the producer.
+static uint32_t readIndex;    // Written only by the consumer.
+static uint32_t droppedCount; // Written only by the producer.
+
+// Empties the buffer.
+void adcBuffer_init() {
+  __atomic_store_n(&writeIndex, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&readIndex, 0, __ATOMIC_RELEASE);
+  __atomic_store_n(&droppedCount, 0, __ATOMIC_RELEASE);
+}
+
+// Adds a sample, publishing it with a release store of the write index.
+bool adcBuffer_push(isr_AdcValue_t adcValue) {
+  uint32_t in = __atomic_load_n(&writeIndex, __ATOMIC_RELAXED);
+  uint32_t out = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
+  if (in - out == ADC_BUFFER_CAPACITY) {
+    __atomic_store_n(&droppedCount,
+                     __atomic_load_n(&droppedCount, __ATOMIC_RELAXED) + 1,
+                     __ATOMIC_RELAXED);
+    return false;
+  }
+  data[in & ADC_BUFFER_MASK] = adcValue;
+  __atomic_store_n(&writeIndex, in + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Removes the oldest sample.
+bool adcBuffer_pop(isr_AdcValue_t *adcValue) {
+  return adcBuffer_drain(adcValue, 1) == 1;
+}
+
+// Removes up to maxCount samples. The copy is split in two when it wraps
+// around the end of the storage.
+uint32_t adcBuffer_drain(isr_AdcValue_t values[], uint32_t maxCount) {
+  uint32_t out = __atomic_load_n(&readIndex, __ATOMIC_RELAXED);
+  uint32_t in = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+  uint32_t count = in - out;
+  if (count > maxCount)
+    count = maxCount;
+  uint32_t start = out & ADC_BUFFER_MASK;
+  uint32_t firstCount = ADC_BUFFER_CAPACITY - start;
+  if (firstCount > count)
+    firstCount = count;
+  for (uint32_t i = 0; i < firstCount; i++)
+    values[i] = data[start + i];
+  for (uint32_t i = firstCount; i < count; i++)
+    values[i] = data[i - firstCount];
+  __atomic_store_n(&readIndex, out + count, __ATOMIC_RELEASE);
+  return count;
+}
+
+// Returns the number of samples in the buffer.
+uint32_t adcBuffer_elementCount() {
+  uint32_t out = __atomic_load_n(&readIndex, __ATOMIC_ACQUIRE);
+  uint32_t in = __atomic_load_n(&writeIndex, __ATOMIC_ACQUIRE);
+  return in - out;
+}
+
+// Returns the number of samples dropped because the buffer was full.
+uint32_t adcBuffer_getDroppedCount() {
+  return __atomic_load_n(&droppedCount, __ATOMIC_RELAXED);
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_ITERATION_COUNT 10000 // Random push bursts followed by drains.
+#define TEST_MAX_BURST 300 // Samples pushed (or drained) per step, at most.
+#define TEST_TIMING_COUNT ADC_BUFFER_CAPACITY // Samples used for timing.
+#define TEST_TIMER INTERVAL_TIMER_TIMER_0     // Times pop() and drain().
+
+// Pushes a counter sequence in random bursts, drains it in random sizes and
+// checks that every sample comes out once and in order. Then fills the buffer
+// past capacity to check that the extra samples are dropped, and times
+// draining a full buffer one sample at a time and in one call.
+bool adcBuffer_runTest() {
+  printf("******** adcBuffer_runTest() **********\n\r");
+  static isr_AdcValue_t values[ADC_BUFFER_CAPACITY];
+  bool success = true;
+  isr_AdcValue_t nextIn = 0, nextOut = 0;
+  adcBuffer_init();
+  for (uint32_t i = 0; i < TEST_ITERATION_COUNT && success; i++) {
+    // The bursts and drains are a random walk; skip the burst when it could
+    // overflow the buffer so that no sample is ever dropped.
+    uint32_t burst = (nextIn - nextOut > ADC_BUFFER_CAPACITY - TEST_MAX_BURST)
+                         ? 0
+                         : rand() % TEST_MAX_BURST;
+    for (uint32_t j = 0; j < burst; j++)
+      adcBuffer_push(nextIn++);
+    uint32_t count = adcBuffer_drain(values, rand() % TEST_MAX_BURST);
+    for (uint32_t j = 0; j < count && success; j++) {
+      if (values[j] != nextOut++) {
+        printf("adcBuffer_runTest: drained %lu, expected %lu.\n\r",
+               (unsigned long)values[j], (unsigned long)(nextOut - 1));
+        success = false;
+      }
+    }
+    if (adcBuffer_elementCount() != nextIn - nextOut) {
+      printf("adcBuffer_runTest: element count %lu, expected %lu.\n\r",
+             (unsigned long)adcBuffer_elementCount(),
+             (unsigned long)(nextIn - nextOut));
+      success = false;
+    }
+  }
+  if (adcBuffer_getDroppedCount() != 0) {
+    printf("adcBuffer_runTest: %lu samples dropped by the random bursts.\n\r",
+           (unsigned long)adcBuffer_getDroppedCount());
+    success = false;
+  }
+  // Fill past capacity: the extra samples must be dropped, not overwrite.
+  adcBuffer_init();
+  for (uint32_t i = 0; i < ADC_BUFFER_CAPACITY + TEST_MAX_BURST; i++)
+    adcBuffer_push(i);
+  if (adcBuffer_elementCount() != ADC_BUFFER_CAPACITY ||
+      adcBuffer_getDroppedCount() != TEST_MAX_BURST) {
+    printf("adcBuffer_runTest: %lu elements and %lu dropped after "
+           "overfilling.\n\r",
+           (unsigned long)adcBuffer_elementCount(),
+           (unsigned long)adcBuffer_getDroppedCount());
+    success = false;
+  }
+  // Time one pop() per sample against a single drain().
+  intervalTimer_init(TEST_TIMER);
+  intervalTimer_reset(TEST_TIMER);
+  intervalTimer_start(TEST_TIMER);
+  isr_AdcValue_t value;
+  for (uint32_t i = 0; i < TEST_TIMING_COUNT; i++)
+    adcBuffer_pop(&value);
+  intervalTimer_stop(TEST_TIMER);
+  double popSeconds = intervalTimer_getTotalDurationInSeconds(TEST_TIMER);
+  if (value != TEST_TIMING_COUNT - 1 || adcBuffer_elementCount() != 0) {
+    printf("adcBuffer_runTest: pop() returned %lu last.\n\r",
+           (unsigned long)value);
+    success = false;
+  }
+  for (uint32_t i = 0; i < TEST_TIMING_COUNT; i++)
+    adcBuffer_push(i);
+  intervalTimer_reset(TEST_TIMER);
+  intervalTimer_start(TEST_TIMER);
+  uint32_t count = adcBuffer_drain(values, TEST_TIMING_COUNT);
+  intervalTimer_stop(TEST_TIMER);
+  double drainSeconds = intervalTimer_getTotalDurationInSeconds(TEST_TIMER);
+  if (count != TEST_TIMING_COUNT || values[count - 1] != count - 1) {
+    printf("adcBuffer_runTest: drain() returned %lu samples.\n\r",
+           (unsigned long)count);
+    success = false;
+  }
+  printf("adcBuffer_runTest: pop() %.1lf ns/sample, drain() %.1lf "
+         "ns/sample.\n\r",
+         popSeconds * 1e9 / TEST_TIMING_COUNT,
+         drainSeconds * 1e9 / TEST_TIMING_COUNT);
+  printf("adcBuffer_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,64 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ADCBUFFER_H_
+#define ADCBUFFER_H_
+
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Lock-free buffer for the ADC samples that isr_function() hands to
+// detector(). There is exactly one producer (the ISR, adcBuffer_push()) and
+// one consumer (the main loop, adcBuffer_pop() and adcBuffer_drain()), so each
+// index is written by only one side:
+// - The producer writes the sample, then publishes the new write index with a
+//   release store. The consumer reads the write index with an acquire load,
+//   so every sample it can see is completely written.
+// - The consumer does the same with the read index, so the producer never
+//   overwrites a slot that is still being read.
+// Neither side ever disables interrupts. When the buffer is full, new samples
+// are dropped and counted (the producer cannot move the consumer's index).
+//
+// Indices run freely and are masked on access, so the capacity must be a power
+// of two. Use adcBuffer_drain() to move everything that is available into a
+// local array with one pair of index accesses instead of one per sample.
+
+#define ADC_BUFFER_CAPACITY                                                    \
+  32768 // Power of two, about 0.33 seconds of samples at 100 kHz.
+
+// Empties the buffer and clears the dropped-sample count. Call before
+// interrupts are enabled.
+void adcBuffer_init();
+
+// Producer only (isr_function()). Adds a sample. Returns false, and counts the
+// sample as dropped, if the buffer is full.
+bool adcBuffer_push(isr_AdcValue_t adcValue);
+
+// Consumer only. Removes the oldest sample into *adcValue. Returns false if the
+// buffer is empty.
+bool adcBuffer_pop(isr_AdcValue_t *adcValue);
+
+// Consumer only. Removes up to maxCount of the oldest samples into values[],
+// oldest first, and returns the number removed.
+uint32_t adcBuffer_drain(isr_AdcValue_t values[], uint32_t maxCount);
+
+// Returns the number of samples in the buffer. Safe from either side, the
+// value may be stale by the time it is used.
+uint32_t adcBuffer_elementCount();
+
+// Returns the number of samples dropped because the buffer was full.
+uint32_t adcBuffer_getDroppedCount();
+
+// Checks ordering, the drop-when-full behavior and drains of every size
+// against a simple counter sequence, and reports the time per sample of
+// adcBuffer_pop() and adcBuffer_drain(). Returns true if everything matches.
+bool adcBuffer_runTest();
+
+#endif /* ADCBUFFER_H_ */
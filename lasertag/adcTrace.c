@@ -0,0 +1,238 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "adcTrace.h"
+#include "intervalTimer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAGIC "ADCT"
+#define MAGIC_SIZE 4
+#define PACING_TIMER INTERVAL_TIMER_TIMER_2 // Paces a real-time replay.
+
+// Little-endian field access, independent of the host byte order.
+static void adcTrace_put16(uint8_t out[], uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static void adcTrace_put32(uint8_t out[], uint32_t value) {
+  adcTrace_put16(out, value & 0xFFFF);
+  adcTrace_put16(out + 2, value >> 16);
+}
+
+static uint16_t adcTrace_get16(const uint8_t in[]) {
+  return in[0] | (in[1] << 8);
+}
+
+static uint32_t adcTrace_get32(const uint8_t in[]) {
+  return adcTrace_get16(in) | ((uint32_t)adcTrace_get16(in + 2) << 16);
+}
+
+// Writes the header.
+uint32_t adcTrace_encodeHeader(uint32_t sampleCount, uint8_t out[]) {
+  memcpy(out, MAGIC, MAGIC_SIZE);
+  adcTrace_put16(out + 4, ADC_TRACE_VERSION);
+  adcTrace_put16(out + 6, ADC_TRACE_BLOCK_SIZE);
+  adcTrace_put32(out + 8, ADC_TRACE_SAMPLE_RATE);
+  adcTrace_put32(out + 12, sampleCount);
+  return ADC_TRACE_HEADER_SIZE;
+}
+
+// Reads and checks the header.
+uint32_t adcTrace_decodeHeader(const uint8_t in[], uint32_t size,
+                               adcTrace_header_t *header) {
+  if (size < ADC_TRACE_HEADER_SIZE || memcmp(in, MAGIC, MAGIC_SIZE) != 0 ||
+      adcTrace_get16(in + 4) != ADC_TRACE_VERSION ||
+      adcTrace_get16(in + 6) > ADC_TRACE_BLOCK_SIZE)
+    return 0;
+  header->sampleRate = adcTrace_get32(in + 8);
+  header->sampleCount = adcTrace_get32(in + 12);
+  return ADC_TRACE_HEADER_SIZE;
+}
+
+// Writes the count, the first sample, the deltas and the checksum. Deltas wrap
+// modulo 2^16, so any 16-bit sample sequence round-trips.
+uint32_t adcTrace_encodeBlock(const isr_AdcValue_t samples[], uint16_t count,
+                              uint8_t out[]) {
+  uint16_t checksum = samples[0];
+  adcTrace_put16(out, count);
+  adcTrace_put16(out + 2, samples[0]);
+  uint32_t size = 4;
+  for (uint16_t i = 1; i < count; i++) {
+    adcTrace_put16(out + size, (uint16_t)(samples[i] - samples[i - 1]));
+    checksum += samples[i];
+    size += 2;
+  }
+  adcTrace_put16(out + size, checksum);
+  return size + 2;
+}
+
+// Reads a block and checks its length and checksum.
+uint32_t adcTrace_decodeBlock(const uint8_t in[], uint32_t size,
+                              isr_AdcValue_t samples[], uint16_t *count) {
+  if (size < 2)
+    return 0;
+  uint16_t n = adcTrace_get16(in);
+  uint32_t blockSize = 2 * n + 4;
+  if (n == 0 || n > ADC_TRACE_BLOCK_SIZE || size < blockSize)
+    return 0;
+  uint16_t value = adcTrace_get16(in + 2);
+  uint16_t checksum = value;
+  samples[0] = value;
+  for (uint16_t i = 1; i < n; i++) {
+    value += adcTrace_get16(in + 2 + 2 * i);
+    samples[i] = value;
+    checksum += value;
+  }
+  if (checksum != adcTrace_get16(in + blockSize - 2))
+    return 0;
+  *count = n;
+  return blockSize;
+}
+
+// Looks for the magic followed by a valid header.
+int32_t adcTrace_find(const uint8_t data[], uint32_t size) {
+  adcTrace_header_t header;
+  for (uint32_t i = 0; i + ADC_TRACE_HEADER_SIZE <= size; i++) {
+    if (data[i] == MAGIC[0] &&
+        adcTrace_decodeHeader(data + i, size - i, &header))
+      return i;
+  }
+  return -1;
+}
+
+// Adds every block to the ADC buffer, waits until it is due in real-time mode,
+// and lets process() consume it.
+uint32_t adcTrace_replay(const uint8_t trace[], uint32_t size, bool realTime,
+                         void (*process)()) {
+  adcTrace_header_t header;
+  uint32_t offset = adcTrace_decodeHeader(trace, size, &header);
+  if (offset == 0)
+    return 0;
+  intervalTimer_reset(PACING_TIMER);
+  intervalTimer_start(PACING_TIMER);
+  uint32_t replayedCount = 0;
+  isr_AdcValue_t samples[ADC_TRACE_BLOCK_SIZE];
+  while (replayedCount < header.sampleCount) {
+    uint16_t count;
+    uint32_t blockSize =
+        adcTrace_decodeBlock(trace + offset, size - offset, samples, &count);
+    if (blockSize == 0)
+      break;
+    offset += blockSize;
+    for (uint16_t i = 0; i < count; i++) {
+      if (realTime) {
+        // Busy-wait until this sample is due.
+        double dueSeconds = (double)replayedCount / header.sampleRate;
+        while (intervalTimer_getTotalDurationInSeconds(PACING_TIMER) <
+               dueSeconds)
+          ;
+      }
+      isr_addDataToAdcBuffer(samples[i]);
+      replayedCount++;
+    }
+    process();
+  }
+  intervalTimer_stop(PACING_TIMER);
+  return replayedCount;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_SAMPLE_COUNT 10000 // Not a multiple of the block size.
+#define TEST_ADC_MAX_VALUE 4095 // 12-bit ADC.
+
+// Encodes samples[] into a trace, decodes it and compares.
+static bool adcTrace_testRoundTrip(const isr_AdcValue_t samples[],
+                                   uint32_t count, uint8_t trace[]) {
+  uint32_t size = adcTrace_encodeHeader(count, trace);
+  for (uint32_t i = 0; i < count; i += ADC_TRACE_BLOCK_SIZE) {
+    uint16_t blockCount = (count - i < ADC_TRACE_BLOCK_SIZE)
+                              ? count - i
+                              : ADC_TRACE_BLOCK_SIZE;
+    size += adcTrace_encodeBlock(&samples[i], blockCount, trace + size);
+  }
+  if (size != ADC_TRACE_MAX_SIZE(count)) {
+    printf("adcTrace_runTest: trace is %ld bytes, expected %ld.\n\r",
+           (long)size, (long)ADC_TRACE_MAX_SIZE(count));
+    return false;
+  }
+  adcTrace_header_t header;
+  uint32_t offset = adcTrace_decodeHeader(trace, size, &header);
+  if (offset == 0 || header.sampleCount != count ||
+      header.sampleRate != ADC_TRACE_SAMPLE_RATE) {
+    printf("adcTrace_runTest: bad header.\n\r");
+    return false;
+  }
+  uint32_t decodedCount = 0;
+  isr_AdcValue_t decoded[ADC_TRACE_BLOCK_SIZE];
+  while (decodedCount < count) {
+    uint16_t blockCount;
+    uint32_t blockSize = adcTrace_decodeBlock(trace + offset, size - offset,
+                                              decoded, &blockCount);
+    if (blockSize == 0) {
+      printf("adcTrace_runTest: block at byte %ld rejected.\n\r", (long)offset);
+      return false;
+    }
+    for (uint16_t i = 0; i < blockCount; i++) {
+      if (decoded[i] != samples[decodedCount + i]) {
+        printf("adcTrace_runTest: sample %ld is %ld, expected %ld.\n\r",
+               (long)(decodedCount + i), (long)decoded[i],
+               (long)samples[decodedCount + i]);
+        return false;
+      }
+    }
+    offset += blockSize;
+    decodedCount += blockCount;
+  }
+  return offset == size;
+}
+
+// Round-trips random and full-scale step samples, then corrupts and truncates
+// a block.
+bool adcTrace_runTest() {
+  printf("******** adcTrace_runTest() **********\n\r");
+  static isr_AdcValue_t samples[TEST_SAMPLE_COUNT];
+  static uint8_t trace[ADC_TRACE_MAX_SIZE(TEST_SAMPLE_COUNT)];
+  bool success = true;
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    samples[i] = rand() % (TEST_ADC_MAX_VALUE + 1);
+  success &= adcTrace_testRoundTrip(samples, TEST_SAMPLE_COUNT, trace);
+  // Largest possible deltas, in both directions.
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    samples[i] = (i & 1) ? 0xFFFF : 0;
+  success &= adcTrace_testRoundTrip(samples, TEST_SAMPLE_COUNT, trace);
+  // A flipped bit in the first block and a truncated block must be rejected.
+  isr_AdcValue_t decoded[ADC_TRACE_BLOCK_SIZE];
+  uint16_t count;
+  trace[ADC_TRACE_HEADER_SIZE + 10] ^= 0x04;
+  if (adcTrace_decodeBlock(trace + ADC_TRACE_HEADER_SIZE,
+                           ADC_TRACE_MAX_BLOCK_BYTES, decoded, &count) != 0) {
+    printf("adcTrace_runTest: corrupted block accepted.\n\r");
+    success = false;
+  }
+  trace[ADC_TRACE_HEADER_SIZE + 10] ^= 0x04;
+  if (adcTrace_decodeBlock(trace + ADC_TRACE_HEADER_SIZE,
+                           ADC_TRACE_MAX_BLOCK_BYTES - 1, decoded,
+                           &count) != 0) {
+    printf("adcTrace_runTest: truncated block accepted.\n\r");
+    success = false;
+  }
+  if (adcTrace_find(trace, sizeof(trace)) != 0) {
+    printf("adcTrace_runTest: header not found.\n\r");
+    success = false;
+  }
+  printf("adcTrace_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,85 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ADCTRACE_H_
+#define ADCTRACE_H_
+
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Binary format for recorded ADC samples, so that a trace captured on the
+// board (runningModes_captureRawAdcValues()) can be replayed through
+// isr_addDataToAdcBuffer() on the host or the emulator and give exactly the
+// same detector input.
+//
+// All fields are little-endian.
+// Header (ADC_TRACE_HEADER_SIZE bytes):
+//   "ADCT", uint16 version, uint16 block size, uint32 sample rate in Hz,
+//   uint32 sample count.
+// Then blocks of at most ADC_TRACE_BLOCK_SIZE samples, until sample count:
+//   uint16 n, int16 first sample, int16 delta x (n - 1), uint16 checksum.
+// Each delta is the difference to the previous sample, and the checksum is the
+// sum of the n samples modulo 2^16, so a block corrupted on the UART is
+// detected. Samples are 16-bit values (the ADC delivers 12 bits).
+
+#define ADC_TRACE_VERSION 1
+#define ADC_TRACE_SAMPLE_RATE 100000 // isr_function() rate in Hz.
+#define ADC_TRACE_BLOCK_SIZE 256 // Maximum samples per block.
+#define ADC_TRACE_HEADER_SIZE 16 // Bytes.
+#define ADC_TRACE_MAX_BLOCK_BYTES                                              \
+  (2 * ADC_TRACE_BLOCK_SIZE + 4) // Largest encoded block.
+#define ADC_TRACE_MAX_SIZE(sampleCount)                                        \
+  (ADC_TRACE_HEADER_SIZE + 2 * (sampleCount) +                                 \
+   4 * (((sampleCount) + ADC_TRACE_BLOCK_SIZE - 1) /                           \
+        ADC_TRACE_BLOCK_SIZE)) // Bytes for a trace of sampleCount samples.
+
+typedef struct {
+  uint32_t sampleRate;  // Hz.
+  uint32_t sampleCount; // Samples in the trace.
+} adcTrace_header_t;
+
+// Writes the header for a trace of sampleCount samples to out[]. Returns
+// ADC_TRACE_HEADER_SIZE.
+uint32_t adcTrace_encodeHeader(uint32_t sampleCount, uint8_t out[]);
+
+// Reads the header at the start of in[]. Returns ADC_TRACE_HEADER_SIZE, or 0
+// if in[] does not start with a valid header.
+uint32_t adcTrace_decodeHeader(const uint8_t in[], uint32_t size,
+                               adcTrace_header_t *header);
+
+// Encodes count (1 to ADC_TRACE_BLOCK_SIZE) samples as one block in out[].
+// Returns the number of bytes written.
+uint32_t adcTrace_encodeBlock(const isr_AdcValue_t samples[], uint16_t count,
+                              uint8_t out[]);
+
+// Decodes the block at the start of in[] into samples[] (room for
+// ADC_TRACE_BLOCK_SIZE) and sets *count. Returns the number of bytes read, or
+// 0 if the block is truncated, too long or fails its checksum.
+uint32_t adcTrace_decodeBlock(const uint8_t in[], uint32_t size,
+                              isr_AdcValue_t samples[], uint16_t *count);
+
+// Returns the offset of the first header in data[], or -1 if there is none.
+// Use it on a UART log that has text around the trace.
+int32_t adcTrace_find(const uint8_t data[], uint32_t size);
+
+// Replays the trace in trace[] through isr_addDataToAdcBuffer() one block at a
+// time and calls process() after every block to consume the samples (e.g.,
+// detector_processAvailable()). If realTime is true, samples are added at
+// ADC_TRACE_SAMPLE_RATE (paced with INTERVAL_TIMER_TIMER_2), otherwise as fast
+// as process() keeps up. Returns the number of samples replayed. Stops early
+// at a bad block.
+uint32_t adcTrace_replay(const uint8_t trace[], uint32_t size, bool realTime,
+                         void (*process)());
+
+// Encodes and decodes random and full-scale traces, and checks that corrupted
+// and truncated blocks are rejected. Returns true if everything matches.
+bool adcTrace_runTest();
+
+#endif /* ADCTRACE_H_ */
@@ -0,0 +1,295 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "adpcm.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define STEP_COUNT 89 // Entries in the IMA step table.
+#define SEEK_CHUNK 32 // Samples decoded and dropped at a time by a seek.
+#define SIGN_BIT 0x8  // Of a nibble, the other three bits are the magnitude.
+
+// Standard IMA-ADPCM tables.
+static const int16_t stepSizes[STEP_COUNT] = {
+    7,     8,     9,     10,    11,    12,    13,    14,    16,    17,
+    19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+    50,    55,    60,    66,    73,    80,    88,    97,    107,   118,
+    130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+    337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+    876,   963,   1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+    2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+    5894,  6484,  7132,  7845,  8630,  9493,  10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767};
+static const int8_t indexAdjustments[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+// Applies nibble to the predictor and step index, exactly as the decoder does.
+static void adpcm_step(int32_t *predictor, int16_t *stepIndex, uint8_t nibble) {
+  int32_t step = stepSizes[*stepIndex];
+  int32_t difference = step >> 3;
+  if (nibble & 4)
+    difference += step;
+  if (nibble & 2)
+    difference += step >> 1;
+  if (nibble & 1)
+    difference += step >> 2;
+  *predictor += (nibble & SIGN_BIT) ? -difference : difference;
+  if (*predictor > INT16_MAX)
+    *predictor = INT16_MAX;
+  else if (*predictor < INT16_MIN)
+    *predictor = INT16_MIN;
+  *stepIndex += indexAdjustments[nibble & 7];
+  if (*stepIndex < 0)
+    *stepIndex = 0;
+  else if (*stepIndex >= STEP_COUNT)
+    *stepIndex = STEP_COUNT - 1;
+}
+
+// Picks the nibble whose reconstruction is closest to sample.
+static uint8_t adpcm_quantize(int32_t predictor, int16_t stepIndex,
+                              int16_t sample) {
+  int32_t step = stepSizes[stepIndex];
+  int32_t difference = sample - predictor;
+  uint8_t nibble = 0;
+  if (difference < 0) {
+    nibble = SIGN_BIT;
+    difference = -difference;
+  }
+  if (difference >= step) {
+    nibble |= 4;
+    difference -= step;
+  }
+  step >>= 1;
+  if (difference >= step) {
+    nibble |= 2;
+    difference -= step;
+  }
+  step >>= 1;
+  if (difference >= step)
+    nibble |= 1;
+  return nibble;
+}
+
+// The encoder runs the decoder alongside, so the block headers hold exactly
+// the state the decoder will have.
+void adpcm_encode(const int16_t samples[], uint32_t sampleCount,
+                  uint8_t out[]) {
+  int32_t predictor = sampleCount > 0 ? samples[0] : 0;
+  int16_t stepIndex = 0;
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    uint32_t blockOffset = i % ADPCM_BLOCK_SAMPLES;
+    if (blockOffset == 0) {
+      out[0] = predictor & 0xFF;
+      out[1] = (predictor >> 8) & 0xFF;
+      out[2] = stepIndex;
+      out[3] = 0;
+      out += ADPCM_BLOCK_HEADER_SIZE;
+    }
+    uint8_t nibble = adpcm_quantize(predictor, stepIndex, samples[i]);
+    adpcm_step(&predictor, &stepIndex, nibble);
+    if (blockOffset % 2 == 0) {
+      *out = nibble;
+    } else {
+      *out |= nibble << 4;
+      out++;
+    }
+  }
+}
+
+void adpcm_initDecoder(adpcm_decoder_t *decoder, const uint8_t data[],
+                       uint32_t sampleCount) {
+  decoder->data = data;
+  decoder->blockSource = NULL;
+  decoder->context = NULL;
+  decoder->sampleCount = sampleCount;
+  decoder->position = 0;
+  decoder->predictor = 0;
+  decoder->stepIndex = 0;
+}
+
+void adpcm_initStreamDecoder(adpcm_decoder_t *decoder,
+                             adpcm_blockSource_t blockSource, void *context,
+                             uint32_t sampleCount) {
+  adpcm_initDecoder(decoder, NULL, sampleCount);
+  decoder->blockSource = blockSource;
+  decoder->context = context;
+}
+
+// Returns block, NULL if the stream does not have it yet.
+static const uint8_t *adpcm_getBlock(adpcm_decoder_t *decoder,
+                                     uint32_t block) {
+  if (decoder->blockSource)
+    return decoder->blockSource(decoder->context, block);
+  return &decoder->data[block * ADPCM_BLOCK_SIZE];
+}
+
+bool adpcm_isReady(adpcm_decoder_t *decoder) {
+  return adpcm_getBlock(decoder, decoder->position / ADPCM_BLOCK_SAMPLES) !=
+         NULL;
+}
+
+// Decodes a block at a time: the header once, then the nibbles in a tight
+// loop.
+uint32_t adpcm_decode(adpcm_decoder_t *decoder, int16_t samples[],
+                      uint32_t count) {
+  if (count > decoder->sampleCount - decoder->position)
+    count = decoder->sampleCount - decoder->position;
+  uint32_t decodedCount = 0;
+  while (decodedCount < count) {
+    uint32_t block = decoder->position / ADPCM_BLOCK_SAMPLES;
+    uint32_t blockOffset = decoder->position % ADPCM_BLOCK_SAMPLES;
+    const uint8_t *blockData = adpcm_getBlock(decoder, block);
+    if (blockData && blockOffset == 0) {
+      decoder->predictor = (int16_t)(blockData[0] | (blockData[1] << 8));
+      decoder->stepIndex = blockData[2] < STEP_COUNT ? blockData[2] : 0;
+    }
+    uint32_t blockCount = ADPCM_BLOCK_SAMPLES - blockOffset;
+    if (blockCount > count - decodedCount)
+      blockCount = count - decodedCount;
+    // Without its header the rest of the block cannot be decoded.
+    if (!blockData || decoder->stepIndex == ADPCM_LOST_BLOCK) {
+      memset(&samples[decodedCount], 0, blockCount * sizeof(samples[0]));
+      decodedCount += blockCount;
+      decoder->stepIndex = ADPCM_LOST_BLOCK;
+      decoder->position += blockCount;
+      continue;
+    }
+    const uint8_t *nibbles = &blockData[ADPCM_BLOCK_HEADER_SIZE];
+    int32_t predictor = decoder->predictor;
+    int16_t stepIndex = decoder->stepIndex;
+    for (uint32_t i = blockOffset; i < blockOffset + blockCount; i++) {
+      uint8_t nibble = (nibbles[i / 2] >> ((i % 2) * 4)) & 0xF;
+      adpcm_step(&predictor, &stepIndex, nibble);
+      samples[decodedCount++] = predictor;
+    }
+    decoder->predictor = predictor;
+    decoder->stepIndex = stepIndex;
+    decoder->position += blockCount;
+  }
+  return decodedCount;
+}
+
+void adpcm_seek(adpcm_decoder_t *decoder, uint32_t position) {
+  int16_t dropped[SEEK_CHUNK];
+  if (position > decoder->sampleCount)
+    position = decoder->sampleCount;
+  decoder->position = position - position % ADPCM_BLOCK_SAMPLES;
+  while (decoder->position < position) {
+    uint32_t count = position - decoder->position;
+    adpcm_decode(decoder, dropped, count < SEEK_CHUNK ? count : SEEK_CHUNK);
+  }
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_SAMPLE_COUNT 2000 // Not a multiple of ADPCM_BLOCK_SAMPLES.
+#define TEST_SAMPLE_RATE 48000.0
+#define TEST_MIN_SNR_DB 20.0 // IMA-ADPCM gives roughly 20-30 dB on sounds.
+#define TEST_DECODE_CHUNK 100 // Decoded in pieces that straddle blocks.
+#define TEST_SEEK_POSITION 700 // In the middle of the third block.
+#define TEST_LOST_BLOCK 1 // Withheld by the test block source.
+
+// Encodes and decodes samples and returns the SNR in dB.
+static double adpcm_testSnr(const int16_t samples[]) {
+  static uint8_t encoded[ADPCM_ENCODED_SIZE(TEST_SAMPLE_COUNT)];
+  static int16_t decoded[TEST_SAMPLE_COUNT];
+  adpcm_encode(samples, TEST_SAMPLE_COUNT, encoded);
+  adpcm_decoder_t decoder;
+  adpcm_initDecoder(&decoder, encoded, TEST_SAMPLE_COUNT);
+  uint32_t count = 0, decodedCount;
+  while ((decodedCount = adpcm_decode(&decoder, &decoded[count],
+                                      TEST_DECODE_CHUNK)) > 0)
+    count += decodedCount;
+  if (count != TEST_SAMPLE_COUNT) {
+    printf("adpcm_runTest: decoded %lu samples, expected %d.\n\r",
+           (unsigned long)count, TEST_SAMPLE_COUNT);
+    return 0.0;
+  }
+  // Seeking lands on the same sample as decoding from the start.
+  int16_t sample;
+  adpcm_seek(&decoder, TEST_SEEK_POSITION);
+  if (adpcm_decode(&decoder, &sample, 1) != 1 ||
+      sample != decoded[TEST_SEEK_POSITION]) {
+    printf("adpcm_runTest: seek to %d decoded %d, expected %d.\n\r",
+           TEST_SEEK_POSITION, sample, decoded[TEST_SEEK_POSITION]);
+    return 0.0;
+  }
+  double signal = 0.0, noise = 0.0;
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    signal += (double)samples[i] * samples[i];
+    noise += (double)(samples[i] - decoded[i]) * (samples[i] - decoded[i]);
+  }
+  if (noise == 0.0)
+    return INFINITY;
+  return 10.0 * log10(signal / noise);
+}
+
+// Block source over the stream in context that never has TEST_LOST_BLOCK.
+static const uint8_t *adpcm_testBlockSource(void *context, uint32_t block) {
+  const uint8_t *encoded = context;
+  return block == TEST_LOST_BLOCK ? NULL : &encoded[block * ADPCM_BLOCK_SIZE];
+}
+
+// Decodes samples from a block source and checks that the lost block is
+// silent and the others decode as they do from memory.
+static bool adpcm_testStream(const int16_t samples[]) {
+  static uint8_t encoded[ADPCM_ENCODED_SIZE(TEST_SAMPLE_COUNT)];
+  static int16_t expected[TEST_SAMPLE_COUNT], decoded[TEST_SAMPLE_COUNT];
+  adpcm_encode(samples, TEST_SAMPLE_COUNT, encoded);
+  adpcm_decoder_t decoder;
+  adpcm_initDecoder(&decoder, encoded, TEST_SAMPLE_COUNT);
+  adpcm_decode(&decoder, expected, TEST_SAMPLE_COUNT);
+  adpcm_initStreamDecoder(&decoder, adpcm_testBlockSource, encoded,
+                          TEST_SAMPLE_COUNT);
+  uint32_t count = 0, decodedCount;
+  while ((decodedCount = adpcm_decode(&decoder, &decoded[count],
+                                      TEST_DECODE_CHUNK)) > 0)
+    count += decodedCount;
+  for (uint32_t i = 0; i < count; i++) {
+    int16_t sample =
+        i / ADPCM_BLOCK_SAMPLES == TEST_LOST_BLOCK ? 0 : expected[i];
+    if (decoded[i] != sample) {
+      printf("adpcm_runTest: streamed sample %lu is %d, expected %d.\n\r",
+             (unsigned long)i, decoded[i], sample);
+      return false;
+    }
+  }
+  return count == TEST_SAMPLE_COUNT;
+}
+
+bool adpcm_runTest() {
+  printf("******** adpcm_runTest() **********\n\r");
+  static int16_t samples[TEST_SAMPLE_COUNT];
+  bool success = true;
+  // A chirp from 200 Hz to 4 kHz at half scale.
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    double t = i / TEST_SAMPLE_RATE;
+    double frequency = 200.0 + 3800.0 * i / TEST_SAMPLE_COUNT;
+    samples[i] = 16000.0 * sin(M_PI * frequency * t);
+  }
+  double snr = adpcm_testSnr(samples);
+  printf("adpcm_runTest: chirp SNR %.1lf dB.\n\r", snr);
+  success &= snr >= TEST_MIN_SNR_DB;
+  success &= adpcm_testStream(samples);
+  // A full-scale 100 Hz sine, the predictor must clamp at the peaks.
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    samples[i] = INT16_MAX * sin(2.0 * M_PI * 100.0 * i / TEST_SAMPLE_RATE);
+  snr = adpcm_testSnr(samples);
+  printf("adpcm_runTest: full-scale sine SNR %.1lf dB.\n\r", snr);
+  success &= snr >= TEST_MIN_SNR_DB;
+  // Silence must stay exactly silent (infinite SNR).
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    samples[i] = 0;
+  success &= adpcm_testSnr(samples) == INFINITY;
+  printf("adpcm_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,89 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ADPCM_H_
+#define ADPCM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// IMA-ADPCM for the sound effects: 4 bits per 16-bit sample, so the assets
+// are about a quarter of the raw wav2c arrays. sounds/wav2adpcm converts them
+// on the host and the mixer decodes them while playing.
+//
+// The stream is a sequence of blocks of ADPCM_BLOCK_SAMPLES samples (the last
+// one may be shorter):
+//   int16 predictor, uint8 step index, uint8 0 (little-endian), then one
+//   nibble per sample, low nibble first.
+// The header holds the decoder state before the first sample of the block, so
+// any block can be decoded on its own, and a bit error stays in its block.
+
+#define ADPCM_BLOCK_SAMPLES 256
+#define ADPCM_BLOCK_HEADER_SIZE 4 // Bytes.
+#define ADPCM_BLOCK_SIZE                                                       \
+  (ADPCM_BLOCK_HEADER_SIZE + ADPCM_BLOCK_SAMPLES / 2) // Bytes.
+#define ADPCM_ENCODED_SIZE(sampleCount)                                        \
+  (((sampleCount) / ADPCM_BLOCK_SAMPLES) * ADPCM_BLOCK_SIZE +                  \
+   ((sampleCount) % ADPCM_BLOCK_SAMPLES                                        \
+        ? ADPCM_BLOCK_HEADER_SIZE +                                            \
+              ((sampleCount) % ADPCM_BLOCK_SAMPLES + 1) / 2                    \
+        : 0)) // Bytes for sampleCount samples.
+
+// Returns block of a stream that is not all in memory (see soundStream.h), or
+// NULL if it is not there yet.
+typedef const uint8_t *(*adpcm_blockSource_t)(void *context, uint32_t block);
+
+// Position in a stream being decoded.
+typedef struct {
+  const uint8_t *data;              // NULL if the blocks come from source.
+  adpcm_blockSource_t blockSource;
+  void *context;                    // Passed to blockSource.
+  uint32_t sampleCount;
+  uint32_t position; // Next sample to decode.
+  int32_t predictor;
+  int16_t stepIndex; // ADPCM_LOST_BLOCK while a missing block plays.
+} adpcm_decoder_t;
+
+#define ADPCM_LOST_BLOCK -1
+
+// Encodes sampleCount samples into out[] (ADPCM_ENCODED_SIZE(sampleCount)
+// bytes).
+void adpcm_encode(const int16_t samples[], uint32_t sampleCount,
+                  uint8_t out[]);
+
+// Starts decoding the stream in data[] from its first sample.
+void adpcm_initDecoder(adpcm_decoder_t *decoder, const uint8_t data[],
+                       uint32_t sampleCount);
+
+// Starts decoding a stream whose blocks come from blockSource(context, block)
+// instead of memory. A block that is not there when its first sample is
+// decoded plays as silence, to its end.
+void adpcm_initStreamDecoder(adpcm_decoder_t *decoder,
+                             adpcm_blockSource_t blockSource, void *context,
+                             uint32_t sampleCount);
+
+// Returns true if the block that holds the next sample is in memory or its
+// blockSource has it, so decoding it now does not play it as silence.
+bool adpcm_isReady(adpcm_decoder_t *decoder);
+
+// Decodes the next count samples into samples[]. Returns how many there were,
+// fewer than count at the end of the stream.
+uint32_t adpcm_decode(adpcm_decoder_t *decoder, int16_t samples[],
+                      uint32_t count);
+
+// Moves the decoder to position. It starts over at the block that holds
+// position and decodes up to it, so a position at a block boundary is free.
+void adpcm_seek(adpcm_decoder_t *decoder, uint32_t position);
+
+// Encodes and decodes a chirp, a full-scale sine and silence and checks the
+// SNR, seeking and a stream with a missing block. Returns true if it is all
+// good enough.
+bool adpcm_runTest();
+
+#endif /* ADPCM_H_ */
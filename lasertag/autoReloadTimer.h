@@ -11,18 +11,29 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define AUTORELOADTIMER_H_
 
 #include "globalDefines.h"
+#include "tickTasks.h"
 #include <stdbool.h>
 
 // The auto-reload timer is always looking at the remaining shot-count from the
 // trigger state-machine. When it goes to 0, it starts a configurable delay and
 // after the delay expires, it sets the remaining shots to a specific value.
 
-#ifndef AUTO_RELOAD_EXPIRE_VALUE
-// Default, Defined in terms of 100 kHz ticks.
+#ifdef AUTO_RELOAD_EXPIRE_VALUE
+#error "define AUTO_RELOAD_EXPIRE_MS (ms) instead of AUTO_RELOAD_EXPIRE_VALUE"
+#endif
+
+#ifndef AUTO_RELOAD_EXPIRE_MS
+// Default, Defined in ms.
 // Can be changed in the globalDefines.h file.
-#define AUTO_RELOAD_EXPIRE_VALUE 300000
+#define AUTO_RELOAD_EXPIRE_MS 3000
 #endif
 
+// In autoReloadTimer_tick() ticks, which run at the slow rate in tickTasks.h.
+// Wrong by TICK_TASKS_SLOW_DIVISOR if isr.c calls autoReloadTimer_tick()
+// directly instead of through tickScheduler_tick().
+#define AUTO_RELOAD_EXPIRE_VALUE                                               \
+  TICK_TASKS_MS_TO_SLOW_TICKS(AUTO_RELOAD_EXPIRE_MS)
+
 #ifndef AUTO_RELOAD_SHOT_VALUE
 #define AUTO_RELOAD_SHOT_VALUE 10 // Default, can be changed in globalDefines.h
 #endif
@@ -0,0 +1,591 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Host benchmark for the lasertag DSP code. Generates synthetic shot traces
+// (shotTrace.h), feeds them through the ADC buffer with the stub isr in
+// hostStubs.c, and runs every engine configuration on them. For each one it
+// reports the time per ADC sample, the throughput and how many shots were
+// detected correctly. The hit decision is the one in hitDecision.h with a
+// lockout of LOCKOUT_TIMER_EXPIRE_MS after every hit.
+//
+// Usage: ./benchmark [-s shots] [-a amplitude] [-n noiseRms]
+//                    [-m delay:gain] [-o probability:offset] [-f fudge]
+//                    [-r seed] [-w trace.bin]
+// Without options the built-in scenarios are run, after timing the hit
+// decision in hitDecision.h against the full sort it replaces. With options, a
+// single scenario built from the clean one plus the options is run. -w also
+// writes its samples as an adcTrace.h trace, for the replay program.
+//
+// A shot that starts while the lockout from an earlier hit is running cannot
+// be detected, so overlapping shots show up as missed for every engine.
+
+#include "adcBuffer.h"
+#include "adcTrace.h"
+#include "detector.h"
+#include "filter.h"
+#include "filterFixed.h"
+#include "firDecimator.h"
+#include "hitDecision.h"
+#include "iirBank.h"
+#include "iirSos.h"
+#include "intervalTimer.h"
+#include "lockoutTimer.h"
+#include "powerTracker.h"
+#include "queue.h"
+#include "shotTrace.h"
+#include "slidingDft.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define BENCHMARK_ISR_BLOCK_SIZE                                               \
+  1000 // Samples the "ISR" pushes before the detector runs (10 ms).
+#define BENCHMARK_BLOCK_SIZE 250 // Samples drained and filtered per block.
+#define BENCHMARK_LOCKOUT_SAMPLES                                              \
+  (LOCKOUT_TIMER_EXPIRE_MS * FILTER_SAMPLE_FREQUENCY_IN_KHZ)
+#define BENCHMARK_BLOCK_OUTPUT_SIZE                                            \
+  (BENCHMARK_BLOCK_SIZE / FILTER_FIR_DECIMATION_FACTOR + 1)
+#define BENCHMARK_DEFAULT_FUDGE_FACTOR 200.0 // Hit if max > fudge * median.
+#define BENCHMARK_TIMER INTERVAL_TIMER_TIMER_0 // Times the detector side.
+#define BENCHMARK_SHOT_SPAN                                                    \
+  (2 * SHOT_TRACE_SHOT_LENGTH) // A hit this long after a shot starts counts.
+#define BENCHMARK_SCENARIO_COUNT                                               \
+  (sizeof(benchmark_scenarios) / sizeof(benchmark_scenarios[0]))
+#define BENCHMARK_ENGINE_COUNT                                                 \
+  (sizeof(benchmark_engines) / sizeof(benchmark_engines[0]))
+#define BENCHMARK_DECISION_COUNT 10000000 // Hit decisions timed per method.
+#define BENCHMARK_DECISION_VECTOR_COUNT 64 // Power vectors cycled through.
+#define BENCHMARK_DECISION_FUDGE_FACTOR                                        \
+  50.0 // Most, but not all, of the power vectors are hits.
+#define BENCHMARK_DECISION_METHOD_COUNT                                        \
+  (sizeof(benchmark_decisionMethods) / sizeof(benchmark_decisionMethods[0]))
+
+typedef struct {
+  const char *name;
+  shotTrace_config_t config;
+} benchmark_scenario_t;
+
+static const benchmark_scenario_t benchmark_scenarios[] = {
+    {"clean", {20, 0.5, 0.01, 0, 0.0, 0.0, 0, 1}},
+    {"noisy", {20, 0.2, 0.3, 0, 0.0, 0.0, 0, 2}},
+    {"multipath", {20, 0.5, 0.05, 37, 0.7, 0.0, 0, 3}},
+    {"overlap", {20, 0.5, 0.05, 0, 0.0, 0.5, 5000, 4}},
+};
+
+/*********************************************************************************************************
+************************************** Hit scoring
+**************************************
+**********************************************************************************************************/
+
+// Per-run hit-detection state and results.
+static uint32_t benchmark_sampleTime; // ADC sample the detector is at.
+static uint32_t benchmark_lockoutEnd; // No hits before this sample.
+static double benchmark_fudgeFactor = BENCHMARK_DEFAULT_FUDGE_FACTOR;
+static const shotTrace_shot_t *benchmark_shots;
+static uint32_t benchmark_shotCount;
+static bool *benchmark_shotDetected;
+static uint32_t benchmark_correctHitCount;
+static uint32_t benchmark_wrongFrequencyHitCount;
+static uint32_t benchmark_falseHitCount;
+
+// Clears the results for a new run over shots[].
+static void benchmark_resetScore(const shotTrace_shot_t shots[],
+                                 uint32_t shotCount) {
+  benchmark_sampleTime = 0;
+  benchmark_lockoutEnd = BENCHMARK_LOCKOUT_SAMPLES; // Lockout at startup.
+  benchmark_shots = shots;
+  benchmark_shotCount = shotCount;
+  free(benchmark_shotDetected);
+  benchmark_shotDetected = calloc(shotCount, sizeof(bool));
+  benchmark_correctHitCount = 0;
+  benchmark_wrongFrequencyHitCount = 0;
+  benchmark_falseHitCount = 0;
+}
+
+// Scores a hit at the current sample: correct if a shot at that frequency
+// started within the last BENCHMARK_SHOT_SPAN samples, wrong frequency if only
+// shots at other frequencies did, false otherwise.
+static void benchmark_scoreHit(uint32_t frequencyNumber) {
+  bool shotActive = false;
+  for (uint32_t i = 0; i < benchmark_shotCount; i++) {
+    const shotTrace_shot_t *shot = &benchmark_shots[i];
+    if (benchmark_sampleTime < shot->startSample ||
+        benchmark_sampleTime >= shot->startSample + BENCHMARK_SHOT_SPAN)
+      continue;
+    shotActive = true;
+    if (shot->frequencyNumber == frequencyNumber &&
+        !benchmark_shotDetected[i]) {
+      benchmark_shotDetected[i] = true;
+      benchmark_correctHitCount++;
+      return;
+    }
+  }
+  if (shotActive)
+    benchmark_wrongFrequencyHitCount++;
+  else
+    benchmark_falseHitCount++;
+}
+
+// Hit decision after every decimated sample, with a lockout after each hit.
+static void benchmark_checkForHit(const double powerValues[]) {
+  benchmark_sampleTime += FILTER_FIR_DECIMATION_FACTOR;
+  if (benchmark_sampleTime < benchmark_lockoutEnd)
+    return;
+  uint32_t frequencyNumber;
+  if (hitDecision_isHit(powerValues, NULL, benchmark_fudgeFactor,
+                        &frequencyNumber)) {
+    benchmark_scoreHit(frequencyNumber);
+    benchmark_lockoutEnd = benchmark_sampleTime + BENCHMARK_LOCKOUT_SAMPLES;
+  }
+}
+
+// The detector.c functions that detectorBatch.c needs.
+double detector_getScaledAdcValue(isr_AdcValue_t adcValue) {
+  return adcValue / (SHOT_TRACE_ADC_MAX_VALUE / 2.0) - 1.0;
+}
+
+void detector_runHitDetection() {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  detector_getCurrentPowerValues(powerValues);
+  benchmark_checkForHit(powerValues);
+}
+
+/*********************************************************************************************************
+****************************************** Engines
+******************************************
+**********************************************************************************************************/
+
+// One engine configuration: init() resets everything, drain() processes every
+// sample in the ADC buffer and calls benchmark_checkForHit() after every
+// decimated sample.
+typedef struct {
+  const char *name;
+  bool (*init)();
+  void (*drain)();
+} benchmark_engine_t;
+
+// Drains up to BENCHMARK_BLOCK_SIZE samples and scales them into block[].
+// Returns the number of samples.
+static uint32_t benchmark_drainBlock(double block[]) {
+  isr_AdcValue_t adcValues[BENCHMARK_BLOCK_SIZE];
+  uint32_t count = adcBuffer_drain(adcValues, BENCHMARK_BLOCK_SIZE);
+  for (uint32_t i = 0; i < count; i++)
+    block[i] = detector_getScaledAdcValue(adcValues[i]);
+  return count;
+}
+
+// Samples since the last decimated sample, for the per-sample engines.
+static uint32_t benchmark_decimationCount;
+
+// filter.c, one sample at a time, as a straightforward detector() does.
+static bool benchmark_filterInit() {
+  filter_init();
+  benchmark_decimationCount = 0;
+  return true;
+}
+
+static void benchmark_filterDrain() {
+  isr_AdcValue_t adcValue;
+  while (adcBuffer_pop(&adcValue)) {
+    filter_addNewInput(detector_getScaledAdcValue(adcValue));
+    if (++benchmark_decimationCount < FILTER_FIR_DECIMATION_FACTOR)
+      continue;
+    benchmark_decimationCount = 0;
+    filter_firFilter();
+    double powerValues[FILTER_FREQUENCY_COUNT];
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      filter_iirFilter(i);
+      powerValues[i] = filter_computePower(i, false, false);
+    }
+    benchmark_checkForHit(powerValues);
+  }
+}
+
+// detector_processAvailable() from detectorBatch.c, with its filter history
+// cleared so no state is left from the previous engine or scenario.
+static bool benchmark_processAvailableInit() {
+  filter_init();
+  return detector_initProcessAvailable();
+}
+
+static void benchmark_processAvailableDrain() {
+  detector_processAvailable(UINT32_MAX, 0);
+}
+
+// Block FIR, then the IIR stage picked by iirStage() for each decimated sample.
+static bool benchmark_blockInit() {
+  filter_init();
+  powerTracker_init();
+  return firDecimator_init() && iirSos_init() && iirBank_init();
+}
+
+static void benchmark_blockDrain(void (*iirStage)(double firOutput)) {
+  double block[BENCHMARK_BLOCK_SIZE];
+  double firOutputs[BENCHMARK_BLOCK_OUTPUT_SIZE];
+  uint32_t count;
+  while ((count = benchmark_drainBlock(block)) > 0) {
+    uint32_t outputCount = firDecimator_processBlock(block, count, firOutputs);
+    for (uint32_t i = 0; i < outputCount; i++)
+      iirStage(firOutputs[i]);
+  }
+}
+
+static void benchmark_filterIirStage(double firOutput) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  queue_overwritePush(filter_getYQueue(), firOutput);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    filter_iirFilter(i);
+    powerValues[i] = filter_computePower(i, false, false);
+  }
+  benchmark_checkForHit(powerValues);
+}
+
+static void benchmark_powerTrackerIirStage(double firOutput) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  queue_overwritePush(filter_getYQueue(), firOutput);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    filter_iirFilter(i);
+    powerValues[i] = powerTracker_computePower(i, false, false);
+  }
+  benchmark_checkForHit(powerValues);
+}
+
+static void benchmark_iirSosIirStage(double firOutput) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  queue_overwritePush(filter_getYQueue(), firOutput);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    iirSos_iirFilter(i);
+    powerValues[i] = filter_computePower(i, false, false);
+  }
+  benchmark_checkForHit(powerValues);
+}
+
+static void benchmark_iirBankIirStage(double firOutput) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  float outputs[FILTER_FREQUENCY_COUNT];
+  iirBank_filter((float)firOutput, outputs);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    queue_overwritePush(filter_getIirOutputQueue(i), outputs[i]);
+    powerValues[i] = filter_computePower(i, false, false);
+  }
+  benchmark_checkForHit(powerValues);
+}
+
+static void benchmark_slidingDftIirStage(double firOutput) {
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  slidingDft_addNewInput(firOutput);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = slidingDft_computePower(i, false, false);
+  benchmark_checkForHit(powerValues);
+}
+
+static void benchmark_blockFilterDrain() {
+  benchmark_blockDrain(benchmark_filterIirStage);
+}
+
+static void benchmark_blockPowerTrackerDrain() {
+  benchmark_blockDrain(benchmark_powerTrackerIirStage);
+}
+
+static void benchmark_blockIirSosDrain() {
+  benchmark_blockDrain(benchmark_iirSosIirStage);
+}
+
+static void benchmark_blockIirBankDrain() {
+  benchmark_blockDrain(benchmark_iirBankIirStage);
+}
+
+static bool benchmark_slidingDftInit() {
+  filter_init();
+  slidingDft_init();
+  return firDecimator_init();
+}
+
+static void benchmark_blockSlidingDftDrain() {
+  benchmark_blockDrain(benchmark_slidingDftIirStage);
+}
+
+// Fixed-point filters, one sample at a time.
+static bool benchmark_fixedInit() {
+  filter_init();
+  benchmark_decimationCount = 0;
+  return filterFixed_init();
+}
+
+static void benchmark_fixedDrain() {
+  isr_AdcValue_t adcValue;
+  while (adcBuffer_pop(&adcValue)) {
+    filterFixed_addNewInput(
+        filterFixed_doubleToQ15(detector_getScaledAdcValue(adcValue)));
+    if (++benchmark_decimationCount < FILTER_FIR_DECIMATION_FACTOR)
+      continue;
+    benchmark_decimationCount = 0;
+    filterFixed_firFilter();
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      filterFixed_iirFilter(i);
+      filterFixed_computePower(i, false);
+    }
+    double powerValues[FILTER_FREQUENCY_COUNT];
+    filterFixed_getCurrentPowerValues(powerValues);
+    benchmark_checkForHit(powerValues);
+  }
+}
+
+static const benchmark_engine_t benchmark_engines[] = {
+    {"filter.c", benchmark_filterInit, benchmark_filterDrain},
+    {"processAvailable", benchmark_processAvailableInit,
+     benchmark_processAvailableDrain},
+    {"block FIR + filter.c", benchmark_blockInit, benchmark_blockFilterDrain},
+    {"block FIR + powerTracker", benchmark_blockInit,
+     benchmark_blockPowerTrackerDrain},
+    {"block FIR + iirSos", benchmark_blockInit, benchmark_blockIirSosDrain},
+    {"block FIR + iirBank", benchmark_blockInit, benchmark_blockIirBankDrain},
+    {"block FIR + slidingDft", benchmark_slidingDftInit,
+     benchmark_blockSlidingDftDrain},
+    {"filterFixed", benchmark_fixedInit, benchmark_fixedDrain},
+};
+
+/*********************************************************************************************************
+************************************** Hit decision
+**************************************
+**********************************************************************************************************/
+
+// One way to decide whether powerValues[] is a hit.
+typedef struct {
+  const char *name;
+  bool (*isHit)(const double powerValues[], double fudgeFactor);
+} benchmark_decisionMethod_t;
+
+// hitDecision_isHit(): linear scan for the maximum, selection network for
+// the median.
+static bool benchmark_networkIsHit(const double powerValues[],
+                                   double fudgeFactor) {
+  uint32_t maxPowerFreqNo;
+  return hitDecision_isHit(powerValues, NULL, fudgeFactor, &maxPowerFreqNo);
+}
+
+// The usual detector_sort() approach: insertion sort of a copy, then the
+// maximum is the last element and the median is element
+// HIT_DECISION_MEDIAN_RANK.
+static bool benchmark_insertionSortIsHit(const double powerValues[],
+                                         double fudgeFactor) {
+  double sorted[FILTER_FREQUENCY_COUNT];
+  for (uint32_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    double value = powerValues[i];
+    int32_t j = i - 1;
+    while (j >= 0 && sorted[j] > value) {
+      sorted[j + 1] = sorted[j];
+      j--;
+    }
+    sorted[j + 1] = value;
+  }
+  return sorted[FILTER_FREQUENCY_COUNT - 1] >
+         fudgeFactor * sorted[HIT_DECISION_MEDIAN_RANK];
+}
+
+// Comparison function for qsort().
+static int benchmark_compareDoubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// Same as benchmark_insertionSortIsHit() but with qsort().
+static bool benchmark_qsortIsHit(const double powerValues[],
+                                 double fudgeFactor) {
+  double sorted[FILTER_FREQUENCY_COUNT];
+  for (uint32_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    sorted[i] = powerValues[i];
+  qsort(sorted, FILTER_FREQUENCY_COUNT, sizeof(double),
+        benchmark_compareDoubles);
+  return sorted[FILTER_FREQUENCY_COUNT - 1] >
+         fudgeFactor * sorted[HIT_DECISION_MEDIAN_RANK];
+}
+
+static const benchmark_decisionMethod_t benchmark_decisionMethods[] = {
+    {"selection network", benchmark_networkIsHit},
+    {"insertion sort", benchmark_insertionSortIsHit},
+    {"qsort", benchmark_qsortIsHit},
+};
+
+// Times every method over the same random power vectors, each with one much
+// larger power, and checks that they all find the same number of hits.
+static void benchmark_runHitDecision() {
+  static double vectors[BENCHMARK_DECISION_VECTOR_COUNT]
+                       [FILTER_FREQUENCY_COUNT];
+  for (uint32_t i = 0; i < BENCHMARK_DECISION_VECTOR_COUNT; i++)
+    for (uint32_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      vectors[i][j] = (double)rand() / RAND_MAX *
+                      ((j == i % FILTER_FREQUENCY_COUNT) ? 100 : 1);
+  printf("\nHit decision: %d decisions per method.\n",
+         BENCHMARK_DECISION_COUNT);
+  printf("%-26s %8s %8s\n", "method", "ns/dec", "hits");
+  uint32_t firstHitCount = 0;
+  for (uint32_t i = 0; i < BENCHMARK_DECISION_METHOD_COUNT; i++) {
+    const benchmark_decisionMethod_t *method = &benchmark_decisionMethods[i];
+    uint32_t hitCount = 0; // Accumulated so the calls are not optimized away.
+    intervalTimer_reset(BENCHMARK_TIMER);
+    intervalTimer_start(BENCHMARK_TIMER);
+    for (uint32_t j = 0; j < BENCHMARK_DECISION_COUNT; j++)
+      hitCount += method->isHit(vectors[j % BENCHMARK_DECISION_VECTOR_COUNT],
+                                BENCHMARK_DECISION_FUDGE_FACTOR);
+    intervalTimer_stop(BENCHMARK_TIMER);
+    double seconds = intervalTimer_getTotalDurationInSeconds(BENCHMARK_TIMER);
+    printf("%-26s %8.1f %8lu\n", method->name,
+           seconds * 1e9 / BENCHMARK_DECISION_COUNT, (unsigned long)hitCount);
+    if (i == 0)
+      firstHitCount = hitCount;
+    else if (hitCount != firstHitCount)
+      printf("%s finds %lu hits, %s finds %lu.\n", method->name,
+             (unsigned long)hitCount, benchmark_decisionMethods[0].name,
+             (unsigned long)firstHitCount);
+  }
+}
+
+/*********************************************************************************************************
+****************************************** Runs
+******************************************
+**********************************************************************************************************/
+
+// Runs one engine over a trace. The trace is pushed through the ADC buffer
+// BENCHMARK_ISR_BLOCK_SIZE samples at a time and only the detector side is
+// timed.
+static void benchmark_runEngine(const benchmark_engine_t *engine,
+                                const isr_AdcValue_t samples[],
+                                uint32_t sampleCount,
+                                const shotTrace_shot_t shots[],
+                                uint32_t shotCount) {
+  if (!engine->init()) {
+    printf("%-26s failed to initialize.\n", engine->name);
+    return;
+  }
+  isr_init();
+  benchmark_resetScore(shots, shotCount);
+  intervalTimer_reset(BENCHMARK_TIMER);
+  for (uint32_t i = 0; i < sampleCount; i += BENCHMARK_ISR_BLOCK_SIZE) {
+    for (uint32_t j = i; j < i + BENCHMARK_ISR_BLOCK_SIZE && j < sampleCount;
+         j++)
+      isr_addDataToAdcBuffer(samples[j]);
+    intervalTimer_start(BENCHMARK_TIMER);
+    engine->drain();
+    intervalTimer_stop(BENCHMARK_TIMER);
+  }
+  double seconds = intervalTimer_getTotalDurationInSeconds(BENCHMARK_TIMER);
+  printf("%-26s %8.1f %8.2f %5lu/%-5lu %6lu %6lu %6lu\n", engine->name,
+         seconds * 1e9 / sampleCount, sampleCount / seconds / 1e6,
+         (unsigned long)benchmark_correctHitCount, (unsigned long)shotCount,
+         (unsigned long)benchmark_wrongFrequencyHitCount,
+         (unsigned long)benchmark_falseHitCount,
+         (unsigned long)(shotCount - benchmark_correctHitCount));
+}
+
+// Writes samples[] to fileName as an adcTrace.h trace. Returns false if the
+// file cannot be written.
+static bool benchmark_writeTrace(const char *fileName,
+                                 const isr_AdcValue_t samples[],
+                                 uint32_t sampleCount) {
+  FILE *file = fopen(fileName, "wb");
+  if (!file)
+    return false;
+  uint8_t data[ADC_TRACE_MAX_BLOCK_BYTES];
+  uint32_t size = adcTrace_encodeHeader(sampleCount, data);
+  bool success = fwrite(data, 1, size, file) == size;
+  for (uint32_t i = 0; i < sampleCount && success; i += ADC_TRACE_BLOCK_SIZE) {
+    uint16_t count = (sampleCount - i < ADC_TRACE_BLOCK_SIZE)
+                         ? sampleCount - i
+                         : ADC_TRACE_BLOCK_SIZE;
+    size = adcTrace_encodeBlock(&samples[i], count, data);
+    success = fwrite(data, 1, size, file) == size;
+  }
+  return fclose(file) == 0 && success;
+}
+
+// Generates the trace for a scenario, writes it to traceFileName unless that
+// is NULL, and runs every engine over it.
+static void benchmark_runScenario(const char *name,
+                                  const shotTrace_config_t *config,
+                                  const char *traceFileName) {
+  isr_AdcValue_t *samples =
+      malloc(shotTrace_getMaxSampleCount(config) * sizeof(isr_AdcValue_t));
+  shotTrace_shot_t *shots =
+      malloc(shotTrace_getMaxShotCount(config) * sizeof(shotTrace_shot_t));
+  uint32_t shotCount;
+  uint32_t sampleCount = shotTrace_generate(config, samples, shots, &shotCount);
+  printf("\nScenario %s: %lu samples, amplitude %.2f, noise %.2f, multipath "
+         "%lu:%.2f, overlap %.2f:%lu\n",
+         name, (unsigned long)sampleCount, config->amplitude, config->noiseRms,
+         (unsigned long)config->multipathDelay, config->multipathGain,
+         config->overlapProbability, (unsigned long)config->overlapOffset);
+  if (traceFileName && !benchmark_writeTrace(traceFileName, samples,
+                                             sampleCount))
+    printf("Cannot write %s.\n", traceFileName);
+  printf("%-26s %8s %8s %11s %6s %6s %6s\n", "engine", "ns/samp", "Msamp/s",
+         "hits/shots", "wrong", "false", "missed");
+  for (uint32_t i = 0; i < BENCHMARK_ENGINE_COUNT; i++)
+    benchmark_runEngine(&benchmark_engines[i], samples, sampleCount, shots,
+                        shotCount);
+  free(samples);
+  free(shots);
+}
+
+int main(int argc, char *argv[]) {
+  shotTrace_config_t config = benchmark_scenarios[0].config;
+  const char *traceFileName = NULL;
+  bool custom = false;
+  int option;
+  while ((option = getopt(argc, argv, "s:a:n:m:o:f:r:w:")) != -1) {
+    custom = true;
+    switch (option) {
+    case 's':
+      config.shotCount = strtoul(optarg, NULL, 0);
+      break;
+    case 'a':
+      config.amplitude = atof(optarg);
+      break;
+    case 'n':
+      config.noiseRms = atof(optarg);
+      break;
+    case 'm':
+      sscanf(optarg, "%u:%lf", &config.multipathDelay, &config.multipathGain);
+      break;
+    case 'o':
+      sscanf(optarg, "%lf:%u", &config.overlapProbability,
+             &config.overlapOffset);
+      break;
+    case 'f':
+      benchmark_fudgeFactor = atof(optarg);
+      break;
+    case 'r':
+      config.seed = strtoul(optarg, NULL, 0);
+      break;
+    case 'w':
+      traceFileName = optarg;
+      break;
+    default:
+      fprintf(stderr,
+              "usage: %s [-s shots] [-a amplitude] [-n noiseRms] "
+              "[-m delay:gain] [-o probability:offset] [-f fudge] "
+              "[-r seed] [-w trace.bin]\n",
+              argv[0]);
+      return 1;
+    }
+  }
+  printf("Fudge factor %.1f, lockout %d samples.\n", benchmark_fudgeFactor,
+         BENCHMARK_LOCKOUT_SAMPLES);
+  intervalTimer_initAll();
+  if (custom) {
+    benchmark_runScenario("custom", &config, traceFileName);
+  } else {
+    benchmark_runHitDecision();
+    for (uint32_t i = 0; i < BENCHMARK_SCENARIO_COUNT; i++)
+      benchmark_runScenario(benchmark_scenarios[i].name,
+                            &benchmark_scenarios[i].config, NULL);
+  }
+  return 0;
+}
@@ -0,0 +1,110 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Host versions of the board-only pieces the DSP code uses: the interval
+// timers (on top of clock_gettime(), ticking at 100 MHz like the board) and
+// the ADC buffer functions in isr.h (on top of adcBuffer.h, with the benchmark
+// playing the part of the ISR).
+
+#include "adcBuffer.h"
+#include "intervalTimer.h"
+#include "isr.h"
+#include <time.h>
+
+#define TIMER_COUNT 3 // Same as the board.
+#define TICKS_PER_SECOND 100000000 // Same as the board's AXI timers.
+#define NANOSECONDS_PER_SECOND 1000000000
+
+static double accumulatedSeconds[TIMER_COUNT];
+static double startSeconds[TIMER_COUNT];
+static bool running[TIMER_COUNT];
+
+// Returns a monotonic time in seconds.
+static double hostStubs_now() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+intervalTimer_status_t intervalTimer_init(uint32_t timerNumber) {
+  if (timerNumber >= TIMER_COUNT)
+    return INTERVAL_TIMER_STATUS_FAIL;
+  accumulatedSeconds[timerNumber] = 0.0;
+  running[timerNumber] = false;
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+intervalTimer_status_t intervalTimer_initAll() {
+  for (uint32_t i = 0; i < TIMER_COUNT; i++)
+    intervalTimer_init(i);
+  return INTERVAL_TIMER_STATUS_OK;
+}
+
+void intervalTimer_start(uint32_t timerNumber) {
+  if (!running[timerNumber]) {
+    startSeconds[timerNumber] = hostStubs_now();
+    running[timerNumber] = true;
+  }
+}
+
+void intervalTimer_stop(uint32_t timerNumber) {
+  if (running[timerNumber]) {
+    accumulatedSeconds[timerNumber] +=
+        hostStubs_now() - startSeconds[timerNumber];
+    running[timerNumber] = false;
+  }
+}
+
+void intervalTimer_reset(uint32_t timerNumber) {
+  intervalTimer_init(timerNumber);
+}
+
+void intervalTimer_resetAll() { intervalTimer_initAll(); }
+
+double intervalTimer_getTotalDurationInSeconds(uint32_t timerNumber) {
+  double seconds = accumulatedSeconds[timerNumber];
+  if (running[timerNumber])
+    seconds += hostStubs_now() - startSeconds[timerNumber];
+  return seconds;
+}
+
+uint64_t intervalTimer_getTicks64(uint32_t timerNumber) {
+  return intervalTimer_getTotalDurationInSeconds(timerNumber) *
+         TICKS_PER_SECOND;
+}
+
+uint32_t intervalTimer_getTicksPerSecond(uint32_t timerNumber) {
+  return timerNumber < TIMER_COUNT ? TICKS_PER_SECOND : 0;
+}
+
+uint64_t intervalTimer_ticksToNanoseconds(uint32_t timerNumber,
+                                          uint64_t ticks) {
+  if (timerNumber >= TIMER_COUNT)
+    return 0;
+  return ticks * (NANOSECONDS_PER_SECOND / TICKS_PER_SECOND);
+}
+
+void isr_init() { adcBuffer_init(); }
+
+// Nothing is timed on the host, the benchmark pushes the samples itself.
+void isr_function() {}
+
+void isr_addDataToAdcBuffer(uint32_t adcData) { adcBuffer_push(adcData); }
+
+uint32_t isr_removeDataFromAdcBuffer() {
+  isr_AdcValue_t adcValue = 0;
+  adcBuffer_pop(&adcValue);
+  return adcValue;
+}
+
+uint32_t isr_adcBufferElementCount() { return adcBuffer_elementCount(); }
+
+uint32_t isr_drainAdcBuffer(isr_AdcValue_t values[], uint32_t maxCount) {
+  return adcBuffer_drain(values, maxCount);
+}
@@ -0,0 +1,149 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Replays an ADC trace recorded with runningModes_captureRawAdcValues() (or
+// written by benchmark -w) through isr_addDataToAdcBuffer() and
+// detector_processAvailable(), and prints every hit. The trace may be embedded
+// in a UART log, the first valid trace header in the file is used. The
+// detector sees exactly the recorded samples, so a false hit from the field
+// shows up at the same sample every time. The profiler statistics of the
+// detector stages are printed at the end.
+//
+// Usage: ./replay [-r] [-f fudge] trace.bin
+//   -r replays at the recorded sample rate instead of as fast as possible.
+
+#include "adcBuffer.h"
+#include "adcTrace.h"
+#include "detector.h"
+#include "filter.h"
+#include "hitDecision.h"
+#include "intervalTimer.h"
+#include "lockoutTimer.h"
+#include "profiler.h"
+#include "shotTrace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define REPLAY_DEFAULT_FUDGE_FACTOR 200.0 // Same default as the benchmark.
+#define REPLAY_TIMER INTERVAL_TIMER_TIMER_0 // Wall-clock time of the replay.
+#define REPLAY_LOCKOUT_SAMPLES                                                 \
+  (LOCKOUT_TIMER_EXPIRE_MS * FILTER_SAMPLE_FREQUENCY_IN_KHZ)
+
+static double replay_fudgeFactor = REPLAY_DEFAULT_FUDGE_FACTOR;
+static uint32_t replay_sampleTime; // ADC sample the detector is at.
+static uint32_t replay_lockoutEnd; // No hits before this sample.
+static uint32_t replay_hitCount;
+
+// The detector.c functions that detectorBatch.c needs.
+double detector_getScaledAdcValue(isr_AdcValue_t adcValue) {
+  return adcValue / (SHOT_TRACE_ADC_MAX_VALUE / 2.0) - 1.0;
+}
+
+// Same decision as the benchmark: hitDecision_isHit() with a lockout of
+// LOCKOUT_TIMER_EXPIRE_MS at startup and after every hit.
+void detector_runHitDetection() {
+  replay_sampleTime += FILTER_FIR_DECIMATION_FACTOR;
+  if (replay_sampleTime < replay_lockoutEnd)
+    return;
+  double powerValues[FILTER_FREQUENCY_COUNT];
+  detector_getCurrentPowerValues(powerValues);
+  uint32_t frequencyNumber;
+  if (!hitDecision_isHit(powerValues, NULL, replay_fudgeFactor,
+                         &frequencyNumber))
+    return;
+  uint32_t maxFrequencyNumber;
+  double maxPower, median;
+  hitDecision_findMaxAndMedian(powerValues, NULL, &maxFrequencyNumber,
+                               &maxPower, &median);
+  printf("hit %lu: sample %lu (%.5f s), frequency %lu, power %.3e, "
+         "median %.3e\n",
+         (unsigned long)++replay_hitCount, (unsigned long)replay_sampleTime,
+         (double)replay_sampleTime / ADC_TRACE_SAMPLE_RATE,
+         (unsigned long)frequencyNumber, maxPower, median);
+  replay_lockoutEnd = replay_sampleTime + REPLAY_LOCKOUT_SAMPLES;
+}
+
+// Consumes everything adcTrace_replay() has added.
+static void replay_process() { detector_processAvailable(UINT32_MAX, 0); }
+
+// Reads the whole file. Returns NULL if it cannot be read.
+static uint8_t *replay_readFile(const char *fileName, uint32_t *size) {
+  FILE *file = fopen(fileName, "rb");
+  if (!file)
+    return NULL;
+  fseek(file, 0, SEEK_END);
+  *size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *data = malloc(*size);
+  if (data && fread(data, 1, *size, file) != *size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  return data;
+}
+
+int main(int argc, char *argv[]) {
+  bool realTime = false;
+  int option;
+  while ((option = getopt(argc, argv, "rf:")) != -1) {
+    switch (option) {
+    case 'r':
+      realTime = true;
+      break;
+    case 'f':
+      replay_fudgeFactor = atof(optarg);
+      break;
+    default:
+      optind = argc; // Print the usage.
+    }
+  }
+  if (optind != argc - 1) {
+    fprintf(stderr, "usage: %s [-r] [-f fudge] trace.bin\n", argv[0]);
+    return 1;
+  }
+  uint32_t size;
+  uint8_t *data = replay_readFile(argv[optind], &size);
+  if (!data) {
+    fprintf(stderr, "%s: cannot read %s.\n", argv[0], argv[optind]);
+    return 1;
+  }
+  int32_t offset = adcTrace_find(data, size);
+  adcTrace_header_t header;
+  if (offset < 0 ||
+      !adcTrace_decodeHeader(data + offset, size - offset, &header)) {
+    fprintf(stderr, "%s: no ADC trace in %s.\n", argv[0], argv[optind]);
+    return 1;
+  }
+  printf("Trace at byte %ld: %lu samples at %lu Hz.\n", (long)offset,
+         (unsigned long)header.sampleCount, (unsigned long)header.sampleRate);
+  intervalTimer_initAll();
+  filter_init();
+  if (!detector_initProcessAvailable())
+    return 1;
+  isr_init();
+  profiler_init();
+  replay_lockoutEnd = REPLAY_LOCKOUT_SAMPLES;
+  intervalTimer_start(REPLAY_TIMER);
+  uint32_t replayedCount =
+      adcTrace_replay(data + offset, size - offset, realTime, replay_process);
+  intervalTimer_stop(REPLAY_TIMER);
+  double seconds = intervalTimer_getTotalDurationInSeconds(REPLAY_TIMER);
+  printf("Replayed %lu samples in %.3f s (%.1fx real time), %lu hits.\n",
+         (unsigned long)replayedCount, seconds,
+         replayedCount / (double)header.sampleRate / seconds,
+         (unsigned long)replay_hitCount);
+  profiler_printStatistics();
+  if (replayedCount != header.sampleCount)
+    printf("Stopped at a bad block after %lu of %lu samples.\n",
+           (unsigned long)replayedCount, (unsigned long)header.sampleCount);
+  free(data);
+  return replayedCount == header.sampleCount ? 0 : 1;
+}
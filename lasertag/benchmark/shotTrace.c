@@ -0,0 +1,113 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "shotTrace.h"
+#include "filter.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define ADC_MID_SCALE 2048.0  // ADC value for 0.0.
+#define ADC_HALF_SCALE 2047.0 // ADC value span for 1.0.
+
+// The trace generator has its own random number generator (xorshift32), so a
+// seed gives the same trace everywhere.
+static uint32_t randomState;
+
+// Returns a uniformly distributed value in [0, 1).
+static double shotTrace_random() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState / 4294967296.0;
+}
+
+// Returns a normally distributed value with unit variance (Box-Muller).
+static double shotTrace_gaussian() {
+  double u = 1.0 - shotTrace_random(); // (0, 1], so log() is finite.
+  return sqrt(-2.0 * log(u)) * cos(2.0 * M_PI * shotTrace_random());
+}
+
+// Adds one shot (a square wave starting at the low half of its period) to
+// signal[], clipped to sampleCount.
+static void shotTrace_addShot(double signal[], uint32_t sampleCount,
+                              uint32_t startSample, uint16_t frequencyNumber,
+                              double amplitude) {
+  uint16_t periodTickCount = filter_frequencyTickTable[frequencyNumber];
+  for (uint32_t i = 0; i < SHOT_TRACE_SHOT_LENGTH; i++) {
+    if (startSample + i >= sampleCount)
+      break;
+    signal[startSample + i] +=
+        ((i % periodTickCount) < periodTickCount / 2) ? -amplitude : amplitude;
+  }
+}
+
+// Returns the number of samples a trace needs at most.
+uint32_t shotTrace_getMaxSampleCount(const shotTrace_config_t *config) {
+  return config->shotCount * (SHOT_TRACE_MAX_GAP + SHOT_TRACE_SHOT_LENGTH) +
+         SHOT_TRACE_MAX_GAP;
+}
+
+// Returns the number of shots a trace has at most.
+uint32_t shotTrace_getMaxShotCount(const shotTrace_config_t *config) {
+  return 2 * config->shotCount;
+}
+
+// Generates the trace.
+uint32_t shotTrace_generate(const shotTrace_config_t *config,
+                            isr_AdcValue_t samples[], shotTrace_shot_t shots[],
+                            uint32_t *shotCount) {
+  uint32_t sampleCount = shotTrace_getMaxSampleCount(config);
+  double *signal = calloc(sampleCount, sizeof(double));
+  randomState = config->seed ? config->seed : 1;
+  uint32_t startSample = 0;
+  *shotCount = 0;
+  for (uint32_t shot = 0; shot < config->shotCount; shot++) {
+    startSample += SHOT_TRACE_MIN_GAP +
+                   (uint32_t)(shotTrace_random() *
+                              (SHOT_TRACE_MAX_GAP - SHOT_TRACE_MIN_GAP));
+    uint16_t frequencyNumber =
+        (uint16_t)(shotTrace_random() * FILTER_FREQUENCY_COUNT);
+    shots[*shotCount].startSample = startSample;
+    shots[*shotCount].frequencyNumber = frequencyNumber;
+    (*shotCount)++;
+    shotTrace_addShot(signal, sampleCount, startSample, frequencyNumber,
+                      config->amplitude);
+    if (config->multipathDelay != 0)
+      shotTrace_addShot(signal, sampleCount,
+                        startSample + config->multipathDelay, frequencyNumber,
+                        config->amplitude * config->multipathGain);
+    if (shotTrace_random() < config->overlapProbability) {
+      // Any other frequency.
+      uint16_t otherFrequencyNumber =
+          (frequencyNumber + 1 +
+           (uint16_t)(shotTrace_random() * (FILTER_FREQUENCY_COUNT - 1))) %
+          FILTER_FREQUENCY_COUNT;
+      shots[*shotCount].startSample = startSample + config->overlapOffset;
+      shots[*shotCount].frequencyNumber = otherFrequencyNumber;
+      (*shotCount)++;
+      shotTrace_addShot(signal, sampleCount,
+                        startSample + config->overlapOffset,
+                        otherFrequencyNumber, config->amplitude);
+    }
+    startSample += SHOT_TRACE_SHOT_LENGTH;
+  }
+  sampleCount = startSample + SHOT_TRACE_MAX_GAP;
+  for (uint32_t i = 0; i < sampleCount; i++) {
+    double value = ADC_MID_SCALE +
+                   ADC_HALF_SCALE *
+                       (signal[i] + config->noiseRms * shotTrace_gaussian());
+    if (value < 0.0)
+      value = 0.0;
+    else if (value > SHOT_TRACE_ADC_MAX_VALUE)
+      value = SHOT_TRACE_ADC_MAX_VALUE;
+    samples[i] = (isr_AdcValue_t)lround(value);
+  }
+  free(signal);
+  return sampleCount;
+}
@@ -0,0 +1,64 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SHOTTRACE_H_
+#define SHOTTRACE_H_
+
+#include "isr.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Synthetic ADC traces for the host benchmark. A trace is a sequence of shots,
+// each a square wave at one of the user frequencies in
+// filter_frequencyTickTable that lasts one pulse width (200 ms at 100 kHz),
+// separated by random gaps of silence. On top of that a trace can have:
+// - Gaussian noise,
+// - multipath: a delayed, attenuated copy of every shot,
+// - overlap: a second shot at another frequency that starts part-way through
+//   a shot.
+// Samples are 12-bit unipolar ADC values, as read by isr_function().
+
+#define SHOT_TRACE_ADC_MAX_VALUE 4095 // 12-bit ADC.
+#define SHOT_TRACE_SHOT_LENGTH 20000  // Samples per shot (200 ms).
+#define SHOT_TRACE_MIN_GAP                                                     \
+  60000 // Shortest silence before a shot, longer than the lockout.
+#define SHOT_TRACE_MAX_GAP 100000 // Longest silence before a shot.
+
+typedef struct {
+  uint32_t shotCount;         // Shots in the trace (not counting overlaps).
+  double amplitude;           // Shot amplitude, fraction of ADC half-scale.
+  double noiseRms;            // Noise RMS, fraction of ADC half-scale.
+  uint32_t multipathDelay;    // Echo delay in samples, 0 for no echo.
+  double multipathGain;       // Echo amplitude relative to the shot.
+  double overlapProbability;  // Chance that a shot is overlapped.
+  uint32_t overlapOffset;     // Overlapping shot starts this many samples in.
+  uint32_t seed;              // The same seed gives the same trace.
+} shotTrace_config_t;
+
+typedef struct {
+  uint32_t startSample;     // First sample of the shot.
+  uint16_t frequencyNumber; // Index into filter_frequencyTickTable.
+} shotTrace_shot_t;
+
+// Returns the number of samples a trace with this configuration needs at most.
+uint32_t shotTrace_getMaxSampleCount(const shotTrace_config_t *config);
+
+// Returns the number of shots (including overlaps) a trace with this
+// configuration has at most.
+uint32_t shotTrace_getMaxShotCount(const shotTrace_config_t *config);
+
+// Generates a trace into samples[] and the shots it contains, in order of
+// their start, into shots[]. Both arrays must be sized with the functions
+// above. Returns the number of samples; the number of shots is written to
+// *shotCount.
+uint32_t shotTrace_generate(const shotTrace_config_t *config,
+                            isr_AdcValue_t samples[], shotTrace_shot_t shots[],
+                            uint32_t *shotCount);
+
+#endif /* SHOTTRACE_H_ */
@@ -30,6 +30,40 @@ typedef uint32_t detector_status_t;   // Used to return status from tests.
 
 typedef uint16_t detector_hitCount_t;
 
+// Uncomment the line below to have detector() compute the power at each user
+// frequency with the sliding DFT in slidingDft.h instead of filter_iirFilter()
+// and filter_computePower(). Power values are read back with
+// detector_getCurrentPowerValues() and passed to detector_sort() as usual.
+// #define DETECTOR_USE_SLIDING_DFT
+
+// Uncomment the line below to run the FIR filter, the IIR filters and the
+// power computation in fixed point (filterFixed.h) instead. Power values are
+// converted back to filter_getCurrentPowerValues() units and read with
+// detector_getCurrentPowerValues().
+// #define FILTER_FIXED
+
+// Uncomment the line below to run the IIR filters as the float32 bank in
+// iirBank.h (one NEON pass per decimated sample for all the channels) instead
+// of filter_iirFilter(). The power is still computed from the filter.c output
+// queues.
+// #define DETECTOR_USE_IIR_BANK
+
+// Uncomment the line below to compute the power from the filter.c output
+// queues with powerTracker_computePower() (powerTracker.h), which keeps an
+// exact running sum and never drifts, instead of filter_computePower(). Works
+// with filter_iirFilter() and with DETECTOR_USE_IIR_BANK.
+// #define DETECTOR_USE_POWER_TRACKER
+
+#if defined(DETECTOR_USE_SLIDING_DFT) + defined(FILTER_FIXED) +               \
+        defined(DETECTOR_USE_IIR_BANK) >                                       \
+    1
+#error "Define at most one of the detector engine switches above."
+#endif
+#if defined(DETECTOR_USE_POWER_TRACKER) &&                                     \
+    (defined(DETECTOR_USE_SLIDING_DFT) || defined(FILTER_FIXED))
+#error "DETECTOR_USE_POWER_TRACKER needs the filter.c output queues."
+#endif
+
 typedef detector_status_t (*sortTestFunctionPtr)(bool, uint32_t, uint32_t,
                                                  double[], double[], bool);
 
@@ -50,6 +84,40 @@ void detector_init(bool ignoredFrequencies[]);
 // Your frequency is simply the frequency indicated by the slide switches
 void detector(bool interruptsCurrentlyEnabled);
 
+// Batch version of detector(). Drains the ADC samples that have arrived with
+// isr_drainAdcBuffer() in blocks, runs each block through the block FIR
+// decimator (firDecimator.h), then runs the IIR filters, power computation and
+// detector_runHitDetection() for every decimated sample. Returns after the ADC
+// buffer is empty, after maxSamples samples, or after the first block that
+// ends more than maxMicros microseconds after the call (0 means no time
+// limit). The time is read from interval timer 1, which runningModes.c keeps
+// running for the whole game. Returns the number of ADC samples processed.
+// Can be called with interrupts enabled. With FILTER_FIXED, the fixed-point
+// filters in filterFixed.h run in place of the FIR decimator and filter.c.
+// With DETECTOR_USE_IIR_BANK, iirBank.h runs in place of filter_iirFilter().
+uint32_t detector_processAvailable(uint32_t maxSamples, uint32_t maxMicros);
+
+// Clears the filter history that detector_processAvailable() keeps outside of
+// filter.c: the FIR decimator, and the sliding DFT, the IIR bank, the power
+// tracker or the fixed-point filters when they are selected. Call it after
+// detector_init() (filter_init() must have been called), before every run.
+// Returns false if the filters cannot be set up (the error is printed).
+bool detector_initProcessAvailable();
+
+// Runs hit detection on the current power values: the part of detector() that
+// follows the power computation (lockout, sort, threshold, hit counts).
+// Called by detector_processAvailable() after every decimated sample.
+void detector_runHitDetection();
+
+// Copies the current power values of the engine selected above into
+// powerValues[]: filter_getCurrentPowerValues(),
+// slidingDft_getCurrentPowerValues() with DETECTOR_USE_SLIDING_DFT,
+// filterFixed_getCurrentPowerValues() with FILTER_FIXED or
+// powerTracker_getCurrentPowerValues() with DETECTOR_USE_POWER_TRACKER.
+// Everything that reads the detector's power values (hit detection, the
+// histogram) should use this.
+void detector_getCurrentPowerValues(double powerValues[]);
+
 // Returns true if a hit was detected.
 bool detector_hitDetected();
 
@@ -82,7 +150,8 @@ void detector_setFudgeFactorIndex(uint32_t);
 // maxPowerFreqNo is the frequency number with the highest value contained in
 // the unsortedValues. unsortedValues contains the unsorted values. sortedValues
 // contains the sorted values. Note: it is assumed that the size of both of the
-// array arguments is 10.
+// array arguments is 10. On the hit path, hitDecision_isHit() in hitDecision.h
+// finds the maximum and the median without sorting.
 detector_status_t detector_sort(uint32_t *maxPowerFreqNo,
                                 double unsortedValues[], double sortedValues[]);
 
@@ -0,0 +1,190 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "detector.h"
+#include "filter.h"
+#include "filterFixed.h"
+#include "firDecimator.h"
+#include "iirBank.h"
+#include "intervalTimer.h"
+#include "isr.h"
+#include "powerTracker.h"
+#include "profiler.h"
+#include "queue.h"
+#include "slidingDft.h"
+#include <stdbool.h>
+#include <stdio.h>
+
+// Batch entry point for the detector, see detector_processAvailable() in
+// detector.h. Kept out of detector.c so that it works with any detector.c
+// that provides detector_getScaledAdcValue() and detector_runHitDetection().
+
+#define BLOCK_SIZE 250 // ADC samples drained and filtered per block.
+#define BLOCK_OUTPUT_SIZE (BLOCK_SIZE / FILTER_FIR_DECIMATION_FACTOR + 1)
+#define MICROS_PER_SECOND 1000000
+#define BUDGET_TIMER INTERVAL_TIMER_TIMER_1 // Running for the whole game.
+
+#ifdef FILTER_FIXED
+static uint16_t decimationCount; // ADC samples since the last FIR output.
+
+// Runs the fixed-point FIR filter on every FILTER_FIR_DECIMATION_FACTOR-th
+// sample, then the IIR filters, the power computation and hit detection. The
+// IIR filters read the FIR output from inside filterFixed.c, so they run right
+// after each FIR output instead of after the block.
+static void detector_processBlock(const isr_AdcValue_t adcValues[],
+                                  uint32_t count) {
+  for (uint32_t i = 0; i < count; i++) {
+    filterFixed_addNewInput(
+        filterFixed_doubleToQ15(detector_getScaledAdcValue(adcValues[i])));
+    if (++decimationCount < FILTER_FIR_DECIMATION_FACTOR)
+      continue;
+    decimationCount = 0;
+    profiler_start(PROFILER_SCOPE_FIR);
+    filterFixed_firFilter();
+    profiler_stop(PROFILER_SCOPE_FIR);
+    profiler_start(PROFILER_SCOPE_IIR);
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      filterFixed_iirFilter(j);
+    profiler_stop(PROFILER_SCOPE_IIR);
+    profiler_start(PROFILER_SCOPE_POWER);
+    for (uint16_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      filterFixed_computePower(j, false);
+    profiler_stop(PROFILER_SCOPE_POWER);
+    profiler_start(PROFILER_SCOPE_SORT);
+    detector_runHitDetection();
+    profiler_stop(PROFILER_SCOPE_SORT);
+  }
+}
+#else
+// Computes the power of IIR filter filterNumber from the filter.c output queue,
+// with powerTracker.h if DETECTOR_USE_POWER_TRACKER is defined.
+static void detector_computePower(uint16_t filterNumber) {
+#ifdef DETECTOR_USE_POWER_TRACKER
+  powerTracker_computePower(filterNumber, false, false);
+#else
+  filter_computePower(filterNumber, false, false);
+#endif
+}
+
+// Runs the IIR filters (or the sliding DFT), the power computation and hit
+// detection for one decimated sample.
+static void detector_processDecimatedSample(double firOutput) {
+#if defined(DETECTOR_USE_IIR_BANK)
+  // One pass advances all the channels. The outputs go to the filter.c output
+  // queues so that filter_computePower() sees them as usual.
+  float iirOutputs[FILTER_FREQUENCY_COUNT];
+  profiler_start(PROFILER_SCOPE_IIR);
+  iirBank_filter((float)firOutput, iirOutputs);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    queue_overwritePush(filter_getIirOutputQueue(i), iirOutputs[i]);
+  profiler_stop(PROFILER_SCOPE_IIR);
+  profiler_start(PROFILER_SCOPE_POWER);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    detector_computePower(i);
+  profiler_stop(PROFILER_SCOPE_POWER);
+#elif defined(DETECTOR_USE_SLIDING_DFT)
+  profiler_start(PROFILER_SCOPE_IIR);
+  slidingDft_addNewInput(firOutput);
+  profiler_stop(PROFILER_SCOPE_IIR);
+  profiler_start(PROFILER_SCOPE_POWER);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    slidingDft_computePower(i, false, false);
+  profiler_stop(PROFILER_SCOPE_POWER);
+#else
+  queue_overwritePush(filter_getYQueue(), firOutput);
+  profiler_start(PROFILER_SCOPE_IIR);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    filter_iirFilter(i);
+  profiler_stop(PROFILER_SCOPE_IIR);
+  profiler_start(PROFILER_SCOPE_POWER);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    detector_computePower(i);
+  profiler_stop(PROFILER_SCOPE_POWER);
+#endif
+  profiler_start(PROFILER_SCOPE_SORT);
+  detector_runHitDetection();
+  profiler_stop(PROFILER_SCOPE_SORT);
+}
+
+// Runs a block of ADC samples through the block FIR decimator, then each
+// decimated sample through detector_processDecimatedSample().
+static void detector_processBlock(const isr_AdcValue_t adcValues[],
+                                  uint32_t count) {
+  static double scaledValues[BLOCK_SIZE];
+  static double firOutputs[BLOCK_OUTPUT_SIZE];
+  for (uint32_t i = 0; i < count; i++)
+    scaledValues[i] = detector_getScaledAdcValue(adcValues[i]);
+  profiler_start(PROFILER_SCOPE_FIR);
+  uint32_t outputCount =
+      firDecimator_processBlock(scaledValues, count, firOutputs);
+  profiler_stop(PROFILER_SCOPE_FIR);
+  for (uint32_t i = 0; i < outputCount; i++)
+    detector_processDecimatedSample(firOutputs[i]);
+}
+#endif
+
+// Reads the power values from the engine that computed them.
+void detector_getCurrentPowerValues(double powerValues[]) {
+#if defined(DETECTOR_USE_SLIDING_DFT)
+  slidingDft_getCurrentPowerValues(powerValues);
+#elif defined(FILTER_FIXED)
+  filterFixed_getCurrentPowerValues(powerValues);
+#elif defined(DETECTOR_USE_POWER_TRACKER)
+  powerTracker_getCurrentPowerValues(powerValues);
+#else
+  filter_getCurrentPowerValues(powerValues);
+#endif
+}
+
+// Sets up the engine selected in detector.h.
+bool detector_initProcessAvailable() {
+#if defined(FILTER_FIXED)
+  decimationCount = 0;
+  return filterFixed_init();
+#else
+#ifdef DETECTOR_USE_POWER_TRACKER
+  powerTracker_init();
+#endif
+#if defined(DETECTOR_USE_SLIDING_DFT)
+  slidingDft_init();
+#elif defined(DETECTOR_USE_IIR_BANK)
+  if (!iirBank_init()) {
+    printf("detector_initProcessAvailable(): iirBank_init() failed.\n\r");
+    return false;
+  }
+#endif
+  return firDecimator_init();
+#endif
+}
+
+// Drains and processes blocks of ADC samples until the buffer is empty,
+// maxSamples have been processed or maxMicros have elapsed.
+uint32_t detector_processAvailable(uint32_t maxSamples, uint32_t maxMicros) {
+  static isr_AdcValue_t adcValues[BLOCK_SIZE];
+  // The budget is checked in integer ticks, converting only maxMicros.
+  uint64_t startTicks = intervalTimer_getTicks64(BUDGET_TIMER);
+  uint64_t budgetTicks = (uint64_t)maxMicros *
+                         intervalTimer_getTicksPerSecond(BUDGET_TIMER) /
+                         MICROS_PER_SECOND;
+  uint32_t processedCount = 0;
+  while (processedCount < maxSamples) {
+    uint32_t blockSize = maxSamples - processedCount;
+    if (blockSize > BLOCK_SIZE)
+      blockSize = BLOCK_SIZE;
+    blockSize = isr_drainAdcBuffer(adcValues, blockSize);
+    if (blockSize == 0)
+      break;
+    detector_processBlock(adcValues, blockSize);
+    processedCount += blockSize;
+    if (maxMicros != 0 &&
+        intervalTimer_getTicks64(BUDGET_TIMER) - startTicks >= budgetTicks)
+      break;
+  }
+  return processedCount;
+}
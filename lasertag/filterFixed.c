@@ -0,0 +1,352 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "filterFixed.h"
+#include "filter.h"
+#include "iirSos.h"
+#include "powerTracker.h"
+#include "ringBuffer.h"
+#include <math.h>
+#include <stdio.h>
+
+#define Q15_MAX INT16_MAX // Largest Q15 value.
+#define Q15_MIN INT16_MIN // Smallest Q15 value.
+#define Q15_SCALE (1 << FILTER_FIXED_Q15_FRACTION_BITS) // 1.0 in Q15.
+#define FIR_ABS_COEFFICIENT_SUM_LIMIT                                          \
+  2.0 // sum(|h|) must be below this for the Q31 accumulator.
+#define COEFFICIENT_MAGNITUDE_BITS                                             \
+  30 // Scaled coefficients are kept below 2^30 (one bit of headroom).
+#define MAX_COEFFICIENT_FRACTION_BITS 62 // Keeps shifts inside int64_t.
+#define IIR_STATE_TO_POWER_SHIFT                                               \
+  (FILTER_FIXED_IIR_STATE_FRACTION_BITS -                                      \
+   FILTER_FIXED_POWER_FRACTION_BITS) // Q24 -> Q16 before squaring.
+
+// Converts the input headroom back out when going to double.
+#define HEADROOM_SCALE ((double)(1 << FILTER_FIXED_INPUT_HEADROOM_BITS))
+
+// FIR coefficients and input history (xQueue). xQueue holds
+// FILTER_FIXED_MAX_FIR_COEFFICIENT_COUNT samples (a power of two) so the FIR
+// can index it with a mask.
+static filterFixed_q15_t
+    firCoefficients[FILTER_FIXED_MAX_FIR_COEFFICIENT_COUNT];
+static filterFixed_q15_t xQueueData[FILTER_FIXED_MAX_FIR_COEFFICIENT_COUNT];
+static ringBuffer_int16_t xQueue;
+static uint32_t firCoefficientCount;
+
+// IIR filters as fixed-point second-order sections. Each section has its own
+// binary point (fraction bits) and is evaluated in direct form I, so the only
+// rounding is when the 64-bit accumulator is stored back to Q24.
+typedef struct {
+  filterFixed_q31_t b[3]; // b0, b1, b2
+  filterFixed_q31_t a[2]; // a1, a2
+  int16_t fractionBits;
+} filterFixed_section_t;
+static filterFixed_section_t iirSections[FILTER_FREQUENCY_COUNT]
+                                        [IIR_SOS_MAX_SECTION_COUNT];
+static uint16_t iirSectionCount[FILTER_FREQUENCY_COUNT];
+
+// Newest FIR output (IIR input). The IIR input history and the output history
+// of every section (Q24): history[i] holds the last two inputs to section i,
+// which are also the last two outputs of section i - 1.
+static filterFixed_q15_t firOutput;
+static filterFixed_q31_t iirHistory[FILTER_FREQUENCY_COUNT]
+                                   [IIR_SOS_MAX_SECTION_COUNT + 1][2];
+
+// IIR outputs (rounded to Q16) used to compute power, with their exact
+// running sums of squares (powerTracker.h). The storage is the next power of
+// two above the window size.
+#define OUTPUT_QUEUE_CAPACITY 2048
+#if OUTPUT_QUEUE_CAPACITY <= FILTER_FIXED_OUTPUT_QUEUE_SIZE
+#error "OUTPUT_QUEUE_CAPACITY must be larger than the power window."
+#endif
+static int32_t outputQueueData[FILTER_FREQUENCY_COUNT][OUTPUT_QUEUE_CAPACITY];
+static powerTracker_window_t outputWindow[FILTER_FREQUENCY_COUNT];
+static filterFixed_power_t currentPowerValue[FILTER_FREQUENCY_COUNT];
+
+/*********************************************************************************************************
+****************************************** Helper Functions
+******************************************
+**********************************************************************************************************/
+
+// Shifts value right by shift bits with round-to-nearest. A negative shift
+// shifts left.
+static int64_t filterFixed_roundShift(int64_t value, int16_t shift) {
+  if (shift <= 0)
+    return value * ((int64_t)1 << -shift);
+  return (value + ((int64_t)1 << (shift - 1))) >> shift;
+}
+
+// Clamps value into the Q15 range.
+static filterFixed_q15_t filterFixed_saturateQ15(int64_t value) {
+  if (value > Q15_MAX)
+    return Q15_MAX;
+  if (value < Q15_MIN)
+    return Q15_MIN;
+  return (filterFixed_q15_t)value;
+}
+
+// Returns the number of fraction bits that scales the largest coefficient in
+// coefficients[] to just below 2^COEFFICIENT_MAGNITUDE_BITS.
+static int16_t filterFixed_computeFractionBits(const double coefficients[],
+                                               uint32_t count) {
+  double maxMagnitude = 0.0;
+  for (uint32_t i = 0; i < count; i++)
+    if (fabs(coefficients[i]) > maxMagnitude)
+      maxMagnitude = fabs(coefficients[i]);
+  if (maxMagnitude == 0.0)
+    return MAX_COEFFICIENT_FRACTION_BITS;
+  int exponent;
+  frexp(maxMagnitude, &exponent); // maxMagnitude < 2^exponent.
+  int16_t fractionBits = COEFFICIENT_MAGNITUDE_BITS - exponent;
+  return (fractionBits > MAX_COEFFICIENT_FRACTION_BITS)
+             ? MAX_COEFFICIENT_FRACTION_BITS
+             : fractionBits;
+}
+
+// Converts a coefficient to a 32-bit integer with fractionBits fraction bits.
+static filterFixed_q31_t filterFixed_quantize(double coefficient,
+                                              int16_t fractionBits) {
+  return (filterFixed_q31_t)llround(ldexp(coefficient, fractionBits));
+}
+
+/*********************************************************************************************************
+****************************************** Main Filter Functions
+******************************************
+**********************************************************************************************************/
+
+// Must call this prior to using any filterFixed functions.
+bool filterFixed_init() {
+  firCoefficientCount = filter_getFirCoefficientCount();
+  if (firCoefficientCount > FILTER_FIXED_MAX_FIR_COEFFICIENT_COUNT) {
+    printf("filterFixed_init(): FIR is larger than the maximum supported "
+           "size.\n\r");
+    return false;
+  }
+  // FIR coefficients are Q15. The Q31 accumulator is safe as long as
+  // sum(|h|) * max(|x|) < 2.
+  const double *firCoefficientArray = filter_getFirCoefficientArray();
+  double absCoefficientSum = 0.0;
+  for (uint32_t i = 0; i < firCoefficientCount; i++) {
+    firCoefficients[i] = filterFixed_saturateQ15(
+        llround(ldexp(firCoefficientArray[i], FILTER_FIXED_Q15_FRACTION_BITS)));
+    absCoefficientSum += fabs(firCoefficientArray[i]);
+  }
+  if (absCoefficientSum >= FIR_ABS_COEFFICIENT_SUM_LIMIT) {
+    printf("filterFixed_init(): sum of |FIR coefficients| (%lf) could overflow "
+           "the Q31 accumulator.\n\r",
+           absCoefficientSum);
+    return false;
+  }
+  ringBuffer_int16_init(&xQueue, xQueueData,
+                        FILTER_FIXED_MAX_FIR_COEFFICIENT_COUNT);
+  ringBuffer_int16_fill(&xQueue, 0);
+  firOutput = 0;
+  // The IIR filters are converted to second-order sections in double, then
+  // each section gets its own binary point.
+  for (uint16_t filterNumber = 0; filterNumber < FILTER_FREQUENCY_COUNT;
+       filterNumber++) {
+    iirSos_section_t sections[IIR_SOS_MAX_SECTION_COUNT];
+    iirSectionCount[filterNumber] = iirSos_convertFilter(
+        filterNumber, sections, IIR_SOS_MAX_SECTION_COUNT);
+    if (iirSectionCount[filterNumber] == 0)
+      return false;
+    for (uint16_t i = 0; i < iirSectionCount[filterNumber]; i++) {
+      double coefficients[5] = {sections[i].b[0], sections[i].b[1],
+                                sections[i].b[2], sections[i].a[0],
+                                sections[i].a[1]};
+      filterFixed_section_t *section = &iirSections[filterNumber][i];
+      section->fractionBits = filterFixed_computeFractionBits(coefficients, 5);
+      for (uint16_t k = 0; k < 3; k++)
+        section->b[k] =
+            filterFixed_quantize(coefficients[k], section->fractionBits);
+      for (uint16_t k = 0; k < 2; k++)
+        section->a[k] =
+            filterFixed_quantize(coefficients[k + 3], section->fractionBits);
+    }
+    for (uint16_t i = 0; i <= IIR_SOS_MAX_SECTION_COUNT; i++)
+      iirHistory[filterNumber][i][0] = iirHistory[filterNumber][i][1] = 0;
+    if (!powerTracker_initWindow(&outputWindow[filterNumber],
+                                 outputQueueData[filterNumber],
+                                 OUTPUT_QUEUE_CAPACITY,
+                                 FILTER_FIXED_OUTPUT_QUEUE_SIZE))
+      return false;
+    currentPowerValue[filterNumber] = 0;
+  }
+  return true;
+}
+
+// Converts a value in the range [-1.0, 1.0] to the Q15 sample format.
+filterFixed_q15_t filterFixed_doubleToQ15(double x) {
+  return filterFixed_saturateQ15(llround(ldexp(
+      x, FILTER_FIXED_Q15_FRACTION_BITS - FILTER_FIXED_INPUT_HEADROOM_BITS)));
+}
+
+// Use this to copy an input into the input queue of the FIR-filter (xQueue).
+void filterFixed_addNewInput(filterFixed_q15_t x) {
+  ringBuffer_int16_overwritePushFast(&xQueue, x);
+}
+
+// Invokes the FIR-filter. Coefficient i is applied to the input that is i
+// samples old, so firCoefficients[0] multiplies the newest input.
+filterFixed_q15_t filterFixed_firFilter() {
+  filterFixed_q31_t accumulator = 0; // Q30 products summed in a Q31 register.
+  for (uint32_t i = 0; i < firCoefficientCount; i++) {
+    accumulator += (filterFixed_q31_t)firCoefficients[i] *
+                   ringBuffer_int16_readNewestFast(&xQueue, i);
+  }
+  filterFixed_q15_t y = filterFixed_saturateQ15(
+      filterFixed_roundShift(accumulator, FILTER_FIXED_Q15_FRACTION_BITS));
+  firOutput = y;
+  return y;
+}
+
+// Use this to invoke a single iir filter. Input is the newest FIR output.
+// Each section computes
+// y = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+// and its output is the input of the next section.
+filterFixed_q31_t filterFixed_iirFilter(uint16_t filterNumber) {
+  filterFixed_q31_t x = (filterFixed_q31_t)firOutput
+                        << (FILTER_FIXED_IIR_STATE_FRACTION_BITS -
+                            FILTER_FIXED_Q15_FRACTION_BITS);
+  for (uint16_t i = 0; i < iirSectionCount[filterNumber]; i++) {
+    const filterFixed_section_t *section = &iirSections[filterNumber][i];
+    filterFixed_q31_t *input = iirHistory[filterNumber][i];
+    filterFixed_q31_t *output = iirHistory[filterNumber][i + 1];
+    int64_t accumulator = (int64_t)section->b[0] * x +
+                          (int64_t)section->b[1] * input[0] +
+                          (int64_t)section->b[2] * input[1] -
+                          (int64_t)section->a[0] * output[0] -
+                          (int64_t)section->a[1] * output[1];
+    input[1] = input[0];
+    input[0] = x;
+    x = (filterFixed_q31_t)filterFixed_roundShift(accumulator,
+                                                  section->fractionBits);
+  }
+  // The last section's output history is updated here since no section reads
+  // it as an input.
+  filterFixed_q31_t *lastOutput =
+      iirHistory[filterNumber][iirSectionCount[filterNumber]];
+  lastOutput[1] = lastOutput[0];
+  lastOutput[0] = x;
+  // Keep the power window up to date: add the newest square, drop the oldest.
+  powerTracker_pushSample(
+      &outputWindow[filterNumber],
+      (int32_t)filterFixed_roundShift(x, IIR_STATE_TO_POWER_SHIFT));
+  return x;
+}
+
+// Computes the power for the outputs of IIR filter [filterNumber].
+filterFixed_power_t filterFixed_computePower(uint16_t filterNumber,
+                                             bool forceComputeFromScratch) {
+  if (forceComputeFromScratch)
+    powerTracker_rescanWindow(&outputWindow[filterNumber]);
+  currentPowerValue[filterNumber] = outputWindow[filterNumber].sumOfSquares;
+  return currentPowerValue[filterNumber];
+}
+
+// Returns the last-computed power for IIR filter [filterNumber].
+double filterFixed_getCurrentPowerValue(uint16_t filterNumber) {
+  double scale = HEADROOM_SCALE / (1 << FILTER_FIXED_POWER_FRACTION_BITS);
+  return (double)currentPowerValue[filterNumber] * scale * scale;
+}
+
+// Copies the current power values into powerValues[].
+void filterFixed_getCurrentPowerValues(double powerValues[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = filterFixed_getCurrentPowerValue(i);
+}
+
+// Converts a Q15 FIR output back to double-precision filter units.
+double filterFixed_firOutputToDouble(filterFixed_q15_t y) {
+  return ldexp(y, -FILTER_FIXED_Q15_FRACTION_BITS) * HEADROOM_SCALE;
+}
+
+// Converts a Q24 IIR output back to double-precision filter units.
+double filterFixed_iirOutputToDouble(filterFixed_q31_t z) {
+  return ldexp(z, -FILTER_FIXED_IIR_STATE_FRACTION_BITS) * HEADROOM_SCALE;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+// Returns the signal-to-noise ratio in dB, given the accumulated signal energy
+// and error energy.
+static double filterFixed_computeSnrDb(double signalEnergy,
+                                       double noiseEnergy) {
+  if (noiseEnergy == 0.0)
+    return INFINITY;
+  return 10.0 * log10(signalEnergy / noiseEnergy);
+}
+
+// Prints one line of the SNR report and returns true if it passed.
+static bool filterFixed_reportSnr(const char *stageName, double snrDb) {
+  bool passed = snrDb >= FILTER_FIXED_MIN_SNR_DB;
+  printf("filterFixed_runTest: %s SNR: %6.1lf dB (%s)\n\r", stageName, snrDb,
+         passed ? "passed" : "failed");
+  return passed;
+}
+
+// Runs a square wave at each user frequency through both filter chains and
+// compares the results.
+#define TEST_PULSE_WIDTH_IN_TICKS 20000 // Same pulse width as filterTest.c.
+#define TEST_SQUARE_WAVE_AMPLITUDE 1.0  // Full-scale input.
+bool filterFixed_runTest() {
+  printf("******** filterFixed_runTest() **********\n\r");
+  double firSignal = 0.0, firNoise = 0.0;
+  double iirSignal = 0.0, iirNoise = 0.0;
+  double powerSignal = 0.0, powerNoise = 0.0;
+  for (uint16_t testFrequency = 0; testFrequency < FILTER_FREQUENCY_COUNT;
+       testFrequency++) {
+    filter_init();
+    if (!filterFixed_init())
+      return false;
+    uint16_t periodTickCount = filter_frequencyTickTable[testFrequency];
+    for (uint32_t tick = 0; tick < TEST_PULSE_WIDTH_IN_TICKS; tick++) {
+      double x = ((tick % periodTickCount) < (periodTickCount / 2))
+                     ? -TEST_SQUARE_WAVE_AMPLITUDE
+                     : TEST_SQUARE_WAVE_AMPLITUDE;
+      filter_addNewInput(x);
+      filterFixed_addNewInput(filterFixed_doubleToQ15(x));
+      if ((tick % FILTER_FIR_DECIMATION_FACTOR) !=
+          FILTER_FIR_DECIMATION_FACTOR - 1)
+        continue;
+      double firReference = filter_firFilter();
+      double firError =
+          filterFixed_firOutputToDouble(filterFixed_firFilter()) - firReference;
+      firSignal += firReference * firReference;
+      firNoise += firError * firError;
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+        double iirReference = filter_iirFilter(i);
+        double iirError =
+            filterFixed_iirOutputToDouble(filterFixed_iirFilter(i)) -
+            iirReference;
+        iirSignal += iirReference * iirReference;
+        iirNoise += iirError * iirError;
+      }
+    }
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      double powerReference = filter_computePower(i, true, false);
+      filterFixed_computePower(i, false);
+      double powerError = filterFixed_getCurrentPowerValue(i) - powerReference;
+      powerSignal += powerReference * powerReference;
+      powerNoise += powerError * powerError;
+    }
+  }
+  bool success = true;
+  success &= filterFixed_reportSnr(
+      "FIR output", filterFixed_computeSnrDb(firSignal, firNoise));
+  success &= filterFixed_reportSnr(
+      "IIR output", filterFixed_computeSnrDb(iirSignal, iirNoise));
+  success &= filterFixed_reportSnr(
+      "power", filterFixed_computeSnrDb(powerSignal, powerNoise));
+  printf("filterFixed_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,112 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FILTERFIXED_H_
+#define FILTERFIXED_H_
+
+#include "filter.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Fixed-point version of the filter chain in filter.h. The coefficients are
+// taken from the double-precision tables in filter.c (via
+// filter_getFirCoefficientArray(), etc.) and converted once in
+// filterFixed_init(), so both engines always implement the same filters.
+//
+// Number formats:
+// - Samples (FIR input and output) are Q15. Inputs are scaled by 1/2
+//   (FILTER_FIXED_INPUT_HEADROOM_BITS) so the FIR overshoot on a full-scale
+//   square wave does not clip.
+// - FIR coefficients are Q15 and are accumulated in a Q31 (32-bit)
+//   accumulator. filterFixed_init() checks that the sum of the absolute FIR
+//   coefficients is below 2 so the accumulator can never overflow.
+// - The 10th-order direct-form IIR filters cannot be run in fixed point: their
+//   poles move off the passband with anything less than about 40 bits of
+//   coefficient precision. Each IIR filter is therefore converted to a cascade
+//   of second-order sections (see iirSos.h). Section coefficients are 32-bit
+//   with a binary point per section, products are summed in 64 bits (one
+//   SMLAL each on the Cortex-A9) and section outputs are kept in Q24.
+// - Power is the sum of squares of the IIR outputs (rounded to Q16) over the
+//   output window, kept as an exact 64-bit integer by a powerTracker_window_t
+//   (powerTracker.h).
+//
+// Measured against the double-precision filters with the filter.c
+// coefficients (filterFixed_runTest(), square waves at all 10 frequencies):
+// FIR output 79 dB, IIR output 79 dB and power 73 dB SNR. The test fails if
+// any stage drops below FILTER_FIXED_MIN_SNR_DB.
+//
+// The filterFixed_ functions can stand in for their filter_ counterparts; the
+// power values are returned in the same units. Define FILTER_FIXED (see
+// detector.h) to have detector_processAvailable() run this chain and
+// detector_getCurrentPowerValues() return its power values.
+
+typedef int16_t filterFixed_q15_t; // Sample type (FIR input/output).
+typedef int32_t filterFixed_q31_t; // Accumulator/IIR-state type.
+typedef int64_t filterFixed_power_t; // Power (sum of squares) type.
+
+#define FILTER_FIXED_Q15_FRACTION_BITS 15 // Q15: 15 bits after the point.
+#define FILTER_FIXED_IIR_STATE_FRACTION_BITS 24 // IIR outputs are Q24.
+#define FILTER_FIXED_POWER_FRACTION_BITS                                       \
+  16 // IIR outputs are rounded to Q16 before squaring.
+#define FILTER_FIXED_INPUT_HEADROOM_BITS                                       \
+  1 // Inputs are scaled by 1/2 to leave room for FIR overshoot.
+#define FILTER_FIXED_OUTPUT_QUEUE_SIZE                                         \
+  FILTER_INPUT_PULSE_WIDTH // Power is computed over this many IIR outputs.
+#define FILTER_FIXED_MAX_FIR_COEFFICIENT_COUNT                                 \
+  128 // Largest FIR that can be converted (power of two, xQueue size).
+#define FILTER_FIXED_MIN_SNR_DB                                                \
+  60.0 // Minimum SNR (vs. double reference) for filterFixed_runTest().
+
+// Must call this prior to using any filterFixed functions. filter_init() must
+// have been called first so that the coefficient tables are available.
+// Returns false if the coefficients cannot be represented (the error is
+// printed).
+bool filterFixed_init();
+
+// Converts a value in the range [-1.0, 1.0] (e.g., a scaled ADC value) to the
+// Q15 sample format used by filterFixed_addNewInput(). Saturates.
+filterFixed_q15_t filterFixed_doubleToQ15(double x);
+
+// Use this to copy an input into the input queue of the FIR-filter (xQueue).
+void filterFixed_addNewInput(filterFixed_q15_t x);
+
+// Invokes the FIR-filter. Input is contents of xQueue.
+// Output is returned and becomes the input of the IIR filters.
+filterFixed_q15_t filterFixed_firFilter();
+
+// Use this to invoke a single iir filter. Input is the newest FIR output.
+// Output (Q24) is returned and is also added to the power window.
+filterFixed_q31_t filterFixed_iirFilter(uint16_t filterNumber);
+
+// Computes the power for the outputs of IIR filter [filterNumber]. The running
+// sum is an exact integer, so incremental updates never drift and
+// forceComputeFromScratch is only needed to (re)synchronize after the output
+// queue has been modified outside of filterFixed_iirFilter().
+filterFixed_power_t filterFixed_computePower(uint16_t filterNumber,
+                                             bool forceComputeFromScratch);
+
+// Returns the last-computed power for IIR filter [filterNumber], converted to
+// the same units as filter_getCurrentPowerValue().
+double filterFixed_getCurrentPowerValue(uint16_t filterNumber);
+
+// Copies the current power values (in filter_getCurrentPowerValues() units)
+// into powerValues[].
+void filterFixed_getCurrentPowerValues(double powerValues[]);
+
+// Converts a Q15 FIR output or a Q24 IIR output back to the units used by the
+// double-precision filters.
+double filterFixed_firOutputToDouble(filterFixed_q15_t y);
+double filterFixed_iirOutputToDouble(filterFixed_q31_t z);
+
+// Runs a square wave at each user frequency through both the double and the
+// fixed-point filters and reports the SNR of the fixed-point FIR, IIR and power
+// outputs. Returns true if every SNR is at least FILTER_FIXED_MIN_SNR_DB.
+bool filterFixed_runTest();
+
+#endif /* FILTERFIXED_H_ */
@@ -37,6 +37,9 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "isr.h"
 #endif
 #include "histogram.h"
+#include "intervalTimer.h"
+#include "powerTracker.h"
+#include "slidingDft.h"
 #include "utils.h"
 #include <math.h>
 #include <stdio.h>
@@ -295,6 +298,7 @@ void filterTest_plotInputValues(double xValues[], double yValues[],
       display_drawLine(x0Point, y0Point, x1Point, y1Point, PLOT_COLOR);
     }
   }
+  display_flush();
 }
 
 // Helper function to create input waveform when testing only the filter.c code.
@@ -601,6 +605,109 @@ void filterTest_runSquareWaveIirPowerTest(uint16_t filterNumber,
       testPeriodPowerValue, filterNumber); // Finally, plot the results.
 }
 
+// Runs the square wave at each user frequency (as in
+// filterTest_runSquareWaveIirPowerTest()) through the IIR filters with
+// filter_computePower() and through the sliding DFT in slidingDft.h, and
+// compares the power each one reports. For every test frequency, prints the
+// power of the matching channel from both paths and the rejection, i.e., how
+// far below the matching channel the strongest other channel is. Also reports
+// the time each path takes per decimated sample, in ns and in CPU cycles.
+// Returns true if the sliding DFT always picks the right channel and its
+// power on that channel is within FILTER_TEST_SLIDING_DFT_MAX_ERROR_DB of the
+// IIR power.
+#define FILTER_TEST_SLIDING_DFT_MAX_ERROR_DB                                   \
+  1.0 // Allowed difference between the two paths on the matching channel.
+#define FILTER_TEST_CPU_CLOCK_FREQUENCY_HZ                                     \
+  650.0E6 // Zybo Cortex-A9 clock, to convert time to cycles.
+#define FILTER_TEST_IIR_TIMER INTERVAL_TIMER_TIMER_0 // Times the IIR path.
+#define FILTER_TEST_DFT_TIMER INTERVAL_TIMER_TIMER_1 // Times the sliding DFT.
+bool filterTest_runSlidingDftComparisonTest(bool printMessageFlag) {
+  if (!filterTest_initFlag) {
+    printf("Must call filterTest_init() before running any filter tests.\n\r");
+    return false;
+  }
+  if (printMessageFlag)
+    printf("running filterTest_runSlidingDftComparisonTest() - comparing the "
+           "sliding DFT with the IIR filters.\n\r");
+  bool success = true;
+  uint32_t sampleCount = 0;
+  intervalTimer_init(FILTER_TEST_IIR_TIMER);
+  intervalTimer_init(FILTER_TEST_DFT_TIMER);
+  intervalTimer_reset(FILTER_TEST_IIR_TIMER);
+  intervalTimer_reset(FILTER_TEST_DFT_TIMER);
+  for (uint16_t testPeriodIndex = 0; testPeriodIndex < FILTER_FREQUENCY_COUNT;
+       testPeriodIndex++) {
+    filter_init();
+    slidingDft_init();
+    uint16_t currentPeriodTickCount =
+        filterTest_firTestTickCounts[testPeriodIndex];
+    for (uint32_t tick = 0; tick < FILTER_TEST_PULSE_WIDTH_LENGTH; tick++) {
+      filter_addNewInput(computeFilterInput(tick % currentPeriodTickCount,
+                                            currentPeriodTickCount));
+      if (!filterTest_decimatingFirFilter())
+        continue;
+      double firOutput =
+          filterTest_readMostRecentValueFromQueue(filter_getYQueue());
+      intervalTimer_start(FILTER_TEST_IIR_TIMER);
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+        filter_iirFilter(i);
+        filter_computePower(i, false, false);
+      }
+      intervalTimer_stop(FILTER_TEST_IIR_TIMER);
+      intervalTimer_start(FILTER_TEST_DFT_TIMER);
+      slidingDft_addNewInput(firOutput);
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+        slidingDft_computePower(i, false, false);
+      intervalTimer_stop(FILTER_TEST_DFT_TIMER);
+      sampleCount++;
+    }
+    double iirPower[FILTER_FREQUENCY_COUNT];
+    double dftPower[FILTER_FREQUENCY_COUNT];
+    filter_getCurrentPowerValues(iirPower);
+    slidingDft_getCurrentPowerValues(dftPower);
+    // Strongest channel other than the one that matches the test frequency.
+    uint16_t iirOther = (testPeriodIndex == 0) ? 1 : 0;
+    uint16_t dftOther = iirOther;
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      if (i == testPeriodIndex)
+        continue;
+      if (iirPower[i] > iirPower[iirOther])
+        iirOther = i;
+      if (dftPower[i] > dftPower[dftOther])
+        dftOther = i;
+    }
+    double errorDb =
+        10.0 * log10(dftPower[testPeriodIndex] / iirPower[testPeriodIndex]);
+    double iirRejectionDb =
+        10.0 * log10(iirPower[testPeriodIndex] / iirPower[iirOther]);
+    double dftRejectionDb =
+        10.0 * log10(dftPower[testPeriodIndex] / dftPower[dftOther]);
+    if (printMessageFlag)
+      printf("freq %d: IIR power %le (rejection %.1lf dB), DFT power %le "
+             "(rejection %.1lf dB), difference %.2lf dB.\n\r",
+             testPeriodIndex, iirPower[testPeriodIndex], iirRejectionDb,
+             dftPower[testPeriodIndex], dftRejectionDb, errorDb);
+    if (dftRejectionDb <= 0.0 ||
+        fabs(errorDb) > FILTER_TEST_SLIDING_DFT_MAX_ERROR_DB) {
+      printf("Sliding DFT power for frequency %d does not match the IIR "
+             "path.\n\r",
+             testPeriodIndex);
+      success = false;
+    }
+  }
+  double iirSeconds =
+      intervalTimer_getTotalDurationInSeconds(FILTER_TEST_IIR_TIMER);
+  double dftSeconds =
+      intervalTimer_getTotalDurationInSeconds(FILTER_TEST_DFT_TIMER);
+  printf("IIR filters + power: %.0lf ns/sample (%.0lf cycles), sliding DFT: "
+         "%.0lf ns/sample (%.0lf cycles).\n\r",
+         iirSeconds * 1E9 / sampleCount,
+         iirSeconds * FILTER_TEST_CPU_CLOCK_FREQUENCY_HZ / sampleCount,
+         dftSeconds * 1E9 / sampleCount,
+         dftSeconds * FILTER_TEST_CPU_CLOCK_FREQUENCY_HZ / sampleCount);
+  return success;
+}
+
 // Pushes a single 1.0 through the xQueue. Golden output data are just the FIR
 // coefficients in reverse order. If this test passes, you are multiplying the
 // coefficient with the correct element of xQueue. This is equivalent to passing
@@ -947,6 +1054,58 @@ bool filterTest_runPowerTest() {
   return firstComputeStatus & incrementalComputeStatus;
 }
 
+// Long-run check of the drift-free power computation in powerTracker.h. Pushes
+// FILTER_TEST_POWER_SOAK_SAMPLE_COUNT random outputs through one IIR output
+// queue, updating the power incrementally after every push, then checks that
+// the incremental sum of squares is bit-exact with a from-scratch sum of the
+// final queue. The input alternates between loud and quiet stretches, as
+// during play, and the drift of a plain double running sum over the same input
+// is printed for comparison.
+#define FILTER_TEST_POWER_SOAK_SAMPLE_COUNT 100000000 // 10^8 outputs.
+#define FILTER_TEST_POWER_SOAK_REPORT_PERIOD                                   \
+  10000000 // Print progress this often.
+#define FILTER_TEST_POWER_SOAK_BURST_LENGTH                                    \
+  20000 // Outputs per loud or quiet stretch.
+#define FILTER_TEST_POWER_SOAK_QUIET_SCALE 1.0E-3 // Amplitude when quiet.
+#define FILTER_TEST_POWER_SOAK_FILTER_NUMBER 0   // Output queue that is used.
+bool filterTest_runPowerSoakTest() {
+  printf("===== Starting filterTest_runPowerSoakTest() =====\n\r");
+  uint16_t filterNumber = FILTER_TEST_POWER_SOAK_FILTER_NUMBER;
+  filter_init();
+  powerTracker_init();
+  queue_t *q = filter_getIirOutputQueue(filterNumber);
+  filterTest_fillQueueWithRandomValues(q);
+  powerTracker_computePower(filterNumber, true, false);
+  double doubleRunningSum = filterTest_computeGoldenPowerValue(q);
+  for (uint32_t sample = 1; sample <= FILTER_TEST_POWER_SOAK_SAMPLE_COUNT;
+       sample++) {
+    double scale = ((sample / FILTER_TEST_POWER_SOAK_BURST_LENGTH) % 2)
+                       ? FILTER_TEST_POWER_SOAK_QUIET_SCALE
+                       : 1.0;
+    double value = scale * (2.0 * filterTest_randomValue0To1() - 1.0);
+    double oldest = queue_readElementAt(q, 0);
+    queue_overwritePush(q, value);
+    powerTracker_computePower(filterNumber, false, false);
+    doubleRunningSum += value * value - oldest * oldest;
+    if (sample % FILTER_TEST_POWER_SOAK_REPORT_PERIOD == 0)
+      printf("%ld outputs processed.\n\r", (long)sample);
+  }
+  powerTracker_sum_t incrementalSum =
+      powerTracker_getSumOfSquares(filterNumber);
+  powerTracker_computePower(filterNumber, true, false);
+  powerTracker_sum_t fromScratchSum =
+      powerTracker_getSumOfSquares(filterNumber);
+  bool success = (incrementalSum == fromScratchSum);
+  printf("Incremental sum of squares: %lld, from scratch: %lld.\n\r",
+         (long long)incrementalSum, (long long)fromScratchSum);
+  printf("A double running sum drifted by %le (%le relative).\n\r",
+         fabs(doubleRunningSum - filterTest_computeGoldenPowerValue(q)),
+         fabs(doubleRunningSum / filterTest_computeGoldenPowerValue(q) - 1.0));
+  printf("+++++ Exiting filterTest_runPowerSoakTest %s +++++\n\r",
+         success ? "passed" : "failed");
+  return success;
+}
+
 // Copies powerValues to currentPowerValues, the same array
 // that is used to hold the values after power has been computed
 // by filter_computePower().
@@ -991,6 +1150,8 @@ bool filterTest_runTest() {
                                              PRINT_INFO_MESSAGES);
   // Verifies correct functionality of the power computation.
   success &= filterTest_runPowerTest();
+  // Compares the sliding-DFT detector front end with the IIR filters.
+  success &= filterTest_runSlidingDftComparisonTest(PRINT_INFO_MESSAGES);
   // Plots the frequency response of the FIR filter against all user and other
   // test frequencies. All frequencies are expressed as a square wave.
   filterTest_runSquareWaveFirPowerTest(PRINT_INFO_MESSAGES, PLOT_INPUT);
@@ -17,4 +17,9 @@ void filterTest_init();
 // response on the TFT.
 bool filterTest_runTest();
 
+// Runs 10^8 outputs through the incremental power computation in
+// powerTracker.h and checks that it is bit-exact with a from-scratch
+// computation at the end. Takes a few minutes on the board.
+bool filterTest_runPowerSoakTest();
+
 #endif /* FILTERTEST_H_ */
@@ -0,0 +1,145 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "firDecimator.h"
+#include "filter.h"
+#include "intervalTimer.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Coefficients in reverse order: reversedCoefficients[0] multiplies the oldest
+// sample in the window, so the dot product walks both arrays forward.
+static double reversedCoefficients[FIR_DECIMATOR_MAX_TAP_COUNT];
+// Doubled delay line. The window is delayLine[writeIndex .. writeIndex +
+// tapCount - 1], oldest first.
+static double delayLine[2 * FIR_DECIMATOR_MAX_TAP_COUNT];
+static uint32_t tapCount;
+static uint32_t writeIndex;
+static uint16_t inputsUntilNextOutput;
+
+// Loads the FIR coefficients and clears the delay line.
+bool firDecimator_init() {
+  tapCount = filter_getFirCoefficientCount();
+  if (tapCount > FIR_DECIMATOR_MAX_TAP_COUNT) {
+    printf("firDecimator_init(): %ld taps is more than the maximum (%d).\n\r",
+           (long)tapCount, FIR_DECIMATOR_MAX_TAP_COUNT);
+    return false;
+  }
+  const double *coefficients = filter_getFirCoefficientArray();
+  for (uint32_t i = 0; i < tapCount; i++)
+    reversedCoefficients[i] = coefficients[tapCount - 1 - i];
+  for (uint32_t i = 0; i < 2 * tapCount; i++)
+    delayLine[i] = 0.0;
+  writeIndex = 0;
+  inputsUntilNextOutput = FILTER_FIR_DECIMATION_FACTOR;
+  return true;
+}
+
+// Filters a block of inputs, computing only the outputs that are kept.
+uint32_t firDecimator_processBlock(const double input[], uint32_t inputCount,
+                                   double output[]) {
+  uint32_t outputCount = 0;
+  uint32_t inputIndex = 0;
+  while (inputIndex < inputCount) {
+    // Copy inputs until the next output is due (or the block runs out).
+    uint32_t copyCount = inputCount - inputIndex;
+    if (copyCount > inputsUntilNextOutput)
+      copyCount = inputsUntilNextOutput;
+    for (uint32_t i = 0; i < copyCount; i++) {
+      double x = input[inputIndex++];
+      delayLine[writeIndex] = x;
+      delayLine[writeIndex + tapCount] = x;
+      if (++writeIndex == tapCount)
+        writeIndex = 0;
+    }
+    inputsUntilNextOutput -= copyCount;
+    if (inputsUntilNextOutput > 0)
+      break;
+    const double *window = &delayLine[writeIndex];
+    double y = 0.0;
+    for (uint32_t i = 0; i < tapCount; i++)
+      y += reversedCoefficients[i] * window[i];
+    output[outputCount++] = y;
+    inputsUntilNextOutput = FILTER_FIR_DECIMATION_FACTOR;
+  }
+  return outputCount;
+}
+
+// Returns the number of inputs that must still arrive before the next output.
+uint16_t firDecimator_getInputsUntilNextOutput() {
+  return inputsUntilNextOutput;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_INPUT_COUNT 20000 // Inputs run through both filters.
+#define TEST_MAX_BLOCK_SIZE 257 // Blocks are 1 to this many inputs.
+#define TEST_TOLERANCE 1e-12 // Allowed difference (summation order).
+#define TEST_TIMER INTERVAL_TIMER_TIMER_0 // Used to time both filters.
+#define TEST_OUTPUT_COUNT (TEST_INPUT_COUNT / FILTER_FIR_DECIMATION_FACTOR)
+
+// Runs the same random input through both filters and compares the outputs.
+bool firDecimator_runTest() {
+  printf("******** firDecimator_runTest() **********\n\r");
+  static double input[TEST_INPUT_COUNT];
+  static double blockOutput[TEST_OUTPUT_COUNT + 1];
+  static double referenceOutput[TEST_OUTPUT_COUNT];
+  for (uint32_t i = 0; i < TEST_INPUT_COUNT; i++)
+    input[i] = 2.0 * rand() / RAND_MAX - 1.0;
+  // Reference: one sample at a time through filter.c.
+  filter_init();
+  intervalTimer_init(TEST_TIMER);
+  intervalTimer_reset(TEST_TIMER);
+  intervalTimer_start(TEST_TIMER);
+  uint32_t referenceCount = 0;
+  for (uint32_t i = 0; i < TEST_INPUT_COUNT; i++) {
+    filter_addNewInput(input[i]);
+    if ((i % FILTER_FIR_DECIMATION_FACTOR) == FILTER_FIR_DECIMATION_FACTOR - 1)
+      referenceOutput[referenceCount++] = filter_firFilter();
+  }
+  intervalTimer_stop(TEST_TIMER);
+  double referenceSeconds = intervalTimer_getTotalDurationInSeconds(TEST_TIMER);
+  // Block filter, random block sizes.
+  if (!firDecimator_init())
+    return false;
+  intervalTimer_reset(TEST_TIMER);
+  intervalTimer_start(TEST_TIMER);
+  uint32_t outputCount = 0;
+  for (uint32_t inputIndex = 0; inputIndex < TEST_INPUT_COUNT;) {
+    uint32_t blockSize = 1 + rand() % TEST_MAX_BLOCK_SIZE;
+    if (blockSize > TEST_INPUT_COUNT - inputIndex)
+      blockSize = TEST_INPUT_COUNT - inputIndex;
+    outputCount += firDecimator_processBlock(&input[inputIndex], blockSize,
+                                             &blockOutput[outputCount]);
+    inputIndex += blockSize;
+  }
+  intervalTimer_stop(TEST_TIMER);
+  double blockSeconds = intervalTimer_getTotalDurationInSeconds(TEST_TIMER);
+  bool success = (outputCount == referenceCount);
+  if (!success)
+    printf("firDecimator_runTest: %ld outputs, expected %ld.\n\r",
+           (long)outputCount, (long)referenceCount);
+  for (uint32_t i = 0; i < referenceCount && success; i++) {
+    if (fabs(blockOutput[i] - referenceOutput[i]) > TEST_TOLERANCE) {
+      printf("firDecimator_runTest: output %ld is %le, expected %le.\n\r",
+             (long)i, blockOutput[i], referenceOutput[i]);
+      success = false;
+    }
+  }
+  printf("firDecimator_runTest: filter.c %.1lf ns/input, block %.1lf "
+         "ns/input.\n\r",
+         referenceSeconds * 1e9 / TEST_INPUT_COUNT,
+         blockSeconds * 1e9 / TEST_INPUT_COUNT);
+  printf("firDecimator_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,57 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef FIRDECIMATOR_H_
+#define FIRDECIMATOR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Block version of the decimating FIR filter in filter.h. Instead of pushing
+// one sample at a time (filter_addNewInput()) and filtering every
+// FILTER_FIR_DECIMATION_FACTOR samples (filter_firFilter()), the caller hands
+// over a whole block of scaled ADC samples, e.g., everything that was drained
+// from the ADC buffer in one go, and gets back only the outputs that are kept.
+//
+// The delay line is stored twice, back to back: every sample is written at
+// index i and at index i + tap count. The newest tap-count samples are then
+// always contiguous, so each output is a straight dot product with no modulo
+// and no function calls, and outputs that the decimator throws away are never
+// computed.
+//
+// Outputs are identical (to rounding) to calling filter_addNewInput() for
+// every sample and filter_firFilter() after every FILTER_FIR_DECIMATION_FACTOR
+// samples. To feed the IIR filters in filter.c, push each output onto
+// filter_getYQueue() with queue_overwritePush() and call filter_iirFilter() as
+// usual.
+
+#define FIR_DECIMATOR_MAX_TAP_COUNT 128 // Largest FIR that can be loaded.
+
+// Loads the coefficients returned by filter_getFirCoefficientArray() and clears
+// the delay line. filter_init() must have been called first. Returns false if
+// the FIR is larger than FIR_DECIMATOR_MAX_TAP_COUNT (the error is printed).
+bool firDecimator_init();
+
+// Filters inputCount samples from input[] and writes the decimated outputs to
+// output[], which must hold at least
+// inputCount / FILTER_FIR_DECIMATION_FACTOR + 1 values. The decimation phase
+// carries over between calls, so blocks may be any size. Returns the number
+// of outputs written.
+uint32_t firDecimator_processBlock(const double input[], uint32_t inputCount,
+                                   double output[]);
+
+// Returns the number of inputs that must still arrive before the next output.
+uint16_t firDecimator_getInputsUntilNextOutput();
+
+// Compares firDecimator_processBlock() against filter_addNewInput() and
+// filter_firFilter() on random blocks of random sizes and reports the time
+// each one takes per input sample. Returns true if the outputs match.
+bool firDecimator_runTest();
+
+#endif /* FIRDECIMATOR_H_ */
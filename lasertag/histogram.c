@@ -39,6 +39,16 @@ static char
 
 #define ONE_HALF(x) ((x) / 2) // Integer divide by 2.
 
+// Rows y0 <= y < y1 and columns x0 <= x < x1 of the screen.
+typedef struct {
+  int16_t x0, y0, x1, y1;
+} histogram_rect_t;
+
+static uint16_t updateLimit; // Bars redrawn per histogram_updateDisplay().
+static uint16_t nextUpdateBar; // Where histogram_updateDisplay() starts.
+// The bar on the screen has another color than histogram_barColors[].
+static bool recolorFlag[HISTOGRAM_MAX_BAR_COUNT];
+
 static bool initFlag =
     false; // Keep track whether histogram_init() has been called.
 // These are the default colors for the bars.
@@ -113,9 +123,12 @@ void histogram_init(uint16_t barCount) {
        (HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS - 1))
           ? topLabelMaxWidthInChars
           : HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS - 1;
+  updateLimit = HISTOGRAM_NO_UPDATE_LIMIT;
+  nextUpdateBar = 0;
   for (int i = 0; i < histogram_barCount; i++) {
     currentBarData[i] = 0;
     previousBarData[i] = 0;
+    recolorFlag[i] = false;
     topLabel[i][0] = 0;    // Start out with empty strings.
     oldTopLabel[i][0] = 0; // Start out with empty strings.
   }
@@ -127,6 +140,7 @@ void histogram_init(uint16_t barCount) {
   }
   display_fillScreen(DISPLAY_BLACK);
   histogram_drawBottomLabels();
+  display_flush();
   initFlag = true;
 }
 
@@ -138,6 +152,7 @@ void histogram_redrawBottomLabels() {
                        (DISPLAY_CHAR_HEIGHT * HISTOGRAM_BOTTOM_LABEL_TEXT_SIZE),
                    display_width(), display_height(), DISPLAY_BLACK);
   histogram_drawBottomLabels();
+  display_flush();
 }
 
 // This function only updates the data for the histogram.
@@ -166,124 +181,157 @@ bool histogram_setBarData(histogram_index_t barIndex, histogram_data_t data,
            data, HISTOGRAM_MAX_BAR_DATA_IN_PIXELS - 1, barIndex);
     return false;
   }
-  // If it has changed, update the data in the array but don't render anything
-  // on the display.
-  if (data !=
-      currentBarData[barIndex]) { // Only modify the data if it has changed.
-    previousBarData[barIndex] =
-        currentBarData[barIndex]; // Save the old data so you render things
-                                  // properly.
-    // Copy the old string so that you can render things properly.
-    currentBarData[barIndex] = data; // Store the data because it changed.
-  }
-  // If the label has changed, move the previous data to old, new data to
-  // current. Labels are handled separately from data because the label may
-  // change even if the underlying bar data does not. This allows the top label
-  // to change and to be redrawn even if the bars stay the same height.
-  if (strncmp(barTopLabel, topLabel[barIndex],
-              HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS)) {
-    // If you get here, the new label is different from the last one.
-    strncpy(oldTopLabel[barIndex], topLabel[barIndex],
-            HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    // Copy the current label to become the new old label.
-    strncpy(topLabel[barIndex], barTopLabel,
-            HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-    // Copy the new label to become the current label.
-    uint16_t barTopLabelLength =
-        strlen(barTopLabel); // Get the length of the label.
-    // Only copy as many characters as will fit in the available screen space.
-    uint16_t charCopyLimit = (barTopLabelLength < topLabelMaxWidthInChars)
-                                 ? barTopLabelLength
-                                 : topLabelMaxWidthInChars;
-    for (uint16_t i = 0; i < charCopyLimit; i++)
-      topLabel[barIndex][i] = barTopLabel[i];
-    // Null terminate the string in any case.
-    topLabel[barIndex][charCopyLimit] = 0;
-  }
+  // Only store the data, histogram_updateDisplay() compares it with what is
+  // on the screen (previousBarData, oldTopLabel) and draws the difference.
+  currentBarData[barIndex] = data;
+  // Only keep as many characters as will fit in the available screen space.
+  uint16_t labelLength = strlen(barTopLabel);
+  if (labelLength > topLabelMaxWidthInChars)
+    labelLength = topLabelMaxWidthInChars;
+  memcpy(topLabel[barIndex], barTopLabel, labelLength);
+  topLabel[barIndex][labelLength] = 0;
   return true; // Everything is OK.
 }
 
-// Internal helper function.
-// Erases the old text (using a fillRect because it is small and fast) to erase
-// the old label, if required. Finds the position for the label, just above the
-// top of the bar.
-void histogram_drawTopLabel(uint16_t barIndex, histogram_data_t data,
-                            const char topLabel[], bool eraseOldLabel) {
-  if (eraseOldLabel) {
-    // Erase with a fillRect because the rect is small and should be faster than
-    // hitting individual label pixels.
-    display_fillRect(barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                     display_height() - data - HISTOGRAM_BAR_Y_GAP -
-                         DISPLAY_CHAR_HEIGHT - 1,
-                     histogram_barWidth, DISPLAY_CHAR_HEIGHT, DISPLAY_BLACK);
+// Returns the rows and columns a bar of height data covers. The bar is
+// data - 1 pixels tall, the row above the bottom labels stays black.
+static histogram_rect_t histogram_getBarRect(uint16_t barIndex,
+                                             histogram_data_t data) {
+  int16_t x = barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP);
+  int16_t bottom = display_height() - HISTOGRAM_BAR_Y_GAP;
+  histogram_rect_t rect = {x, bottom - data, x + histogram_barWidth,
+                           bottom - 1};
+  return rect;
+}
+
+// Returns the rows and columns the top label takes, centered above a bar of
+// height data with a row of black in between. No label is drawn over an
+// empty bar.
+static histogram_rect_t histogram_getLabelRect(uint16_t barIndex,
+                                               histogram_data_t data,
+                                               const char label[]) {
+  int16_t width = data ? strlen(label) * DISPLAY_CHAR_WIDTH : 0;
+  int16_t x = barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) +
+              ONE_HALF(histogram_barWidth - width);
+  int16_t y =
+      display_height() - data - HISTOGRAM_BAR_Y_GAP - DISPLAY_CHAR_HEIGHT - 1;
+  histogram_rect_t rect = {x, y, x + width, y + DISPLAY_CHAR_HEIGHT};
+  return rect;
+}
+
+static void histogram_fillRect(histogram_rect_t rect, uint16_t color) {
+  if (rect.x0 < rect.x1 && rect.y0 < rect.y1)
+    display_fillRect(rect.x0, rect.y0, rect.x1 - rect.x0, rect.y1 - rect.y0,
+                     color);
+}
+
+// Fills rect, but not where it overlaps hole: the bands above and below the
+// hole, then the parts to its left and right.
+static void histogram_fillAround(histogram_rect_t rect, histogram_rect_t hole,
+                                 uint16_t color) {
+  if (hole.x0 >= rect.x1 || hole.x1 <= rect.x0 || hole.y0 >= rect.y1 ||
+      hole.y1 <= rect.y0 || hole.x0 >= hole.x1) {
+    histogram_fillRect(rect, color);
+    return;
+  }
+  int16_t top = hole.y0 > rect.y0 ? hole.y0 : rect.y0;
+  int16_t bottom = hole.y1 < rect.y1 ? hole.y1 : rect.y1;
+  histogram_rect_t above = {rect.x0, rect.y0, rect.x1, top};
+  histogram_rect_t below = {rect.x0, bottom, rect.x1, rect.y1};
+  histogram_rect_t left = {rect.x0, top, hole.x0, bottom};
+  histogram_rect_t right = {hole.x1, top, rect.x1, bottom};
+  histogram_fillRect(above, color);
+  histogram_fillRect(below, color);
+  histogram_fillRect(left, color);
+  histogram_fillRect(right, color);
+}
+
+// Returns true if the bar or its top label differ from what is on the screen.
+static bool histogram_isBarChanged(uint16_t barIndex) {
+  return recolorFlag[barIndex] ||
+         currentBarData[barIndex] != previousBarData[barIndex] ||
+         strncmp(topLabel[barIndex], oldTopLabel[barIndex],
+                 HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
+}
+
+// Draws only what changed since the bar was last drawn:
+// - A bar that grew gets the strip above its old top, one that shrank has the
+//   strip below its new top erased. A bar whose color changed is filled again.
+// - A label that moved, or changed length, is drawn again and what is left of
+//   the old one is erased. Otherwise only the characters that changed are.
+// Labels are drawn with a black background, so the pixels under them never
+// need erasing first.
+static void histogram_updateBar(uint16_t barIndex) {
+  histogram_data_t oldData = previousBarData[barIndex];
+  histogram_data_t data = currentBarData[barIndex];
+  histogram_rect_t oldBar = histogram_getBarRect(barIndex, oldData);
+  histogram_rect_t bar = histogram_getBarRect(barIndex, data);
+  histogram_rect_t oldLabel =
+      histogram_getLabelRect(barIndex, oldData, oldTopLabel[barIndex]);
+  histogram_rect_t label =
+      histogram_getLabelRect(barIndex, data, topLabel[barIndex]);
+  if (recolorFlag[barIndex]) {
+    histogram_fillRect(bar, histogram_barColors[barIndex]);
+    recolorFlag[barIndex] = false;
+  } else if (data > oldData) {
+    histogram_rect_t strip = {bar.x0, bar.y0, bar.x1,
+                              oldBar.y0 < bar.y1 ? oldBar.y0 : bar.y1};
+    histogram_fillRect(strip, histogram_barColors[barIndex]);
+  }
+  if (data < oldData) {
+    histogram_rect_t strip = {oldBar.x0, oldBar.y0, oldBar.x1,
+                              bar.y0 < oldBar.y1 ? bar.y0 : oldBar.y1};
+    histogram_fillAround(strip, label, DISPLAY_BLACK);
   }
-  uint16_t topLabelXOffset = ONE_HALF(
-      histogram_barWidth -
-      (strlen(topLabel) *
-       DISPLAY_CHAR_WIDTH)); // This helps to center the label over the bar.
-  display_setCursor(
-      barIndex * (histogram_barWidth + HISTOGRAM_BAR_X_GAP) +
-          topLabelXOffset, // This is the location of the top label.
-      display_height() - data - HISTOGRAM_BAR_Y_GAP - DISPLAY_CHAR_HEIGHT - 1);
-  display_setTextSize(TOP_LABEL_TEXT_SIZE); // Use tiny text to pack more
-                                            // characters into the label.
-  display_setTextColor(
-      histogram_barTopLabelColors[barIndex]); // Set the color of the label.
-  display_print(topLabel);                    // Draw the label.
+  bool labelMoved = oldLabel.x0 != label.x0 || oldLabel.x1 != label.x1 ||
+                    oldLabel.y0 != label.y0;
+  if (labelMoved) {
+    // A bar that grew has already painted over the bottom of the old label.
+    if (bar.y0 < bar.y1 && oldLabel.y1 > bar.y0)
+      oldLabel.y1 = bar.y0;
+    histogram_fillAround(oldLabel, label, DISPLAY_BLACK);
+  }
+  uint16_t labelLength = (label.x1 - label.x0) / DISPLAY_CHAR_WIDTH;
+  for (uint16_t i = 0; i < labelLength; i++)
+    if (labelMoved || topLabel[barIndex][i] != oldTopLabel[barIndex][i])
+      display_drawChar(label.x0 + i * DISPLAY_CHAR_WIDTH, label.y0,
+                       topLabel[barIndex][i],
+                       histogram_barTopLabelColors[barIndex], DISPLAY_BLACK,
+                       TOP_LABEL_TEXT_SIZE);
+  // This is what is on the screen now.
+  previousBarData[barIndex] = data;
+  strncpy(oldTopLabel[barIndex], topLabel[barIndex],
+          HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
 }
 
 // This updates the display.
-// It loops across all bars, checking:
-// If the height of the bar has changed, redraw both the bar and the top label.
-// If the height of the bar has not changed, but the top label has changed,
-// update the label.
+// It loops across the bars, starting after the last one it updated, and
+// redraws the ones that changed, up to the limit set with
+// histogram_setUpdateLimit(). The others are drawn by the next calls.
 void histogram_updateDisplay() {
   if (!initFlag) {
     printf("Error! histogram_displayUpdate(): must call histogram_init() "
            "before calling this function.\n\r");
     return;
   }
-  for (int i = 0; i < histogram_barCount; i++) {
-    histogram_data_t oldData = previousBarData[i]; // Get the previous data.
-    histogram_data_t data = currentBarData[i];     // Get the current bar data.
-    if (oldData !=
-        data) { // If the are not equal, redraw the bar and the top-label.
-      // Erase the old bar and extend the erase rectangle to include the
-      // top-label so that everything is erased at once. Also, redraw the top
-      // label.
-      display_fillRect(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                       display_height() - oldData - HISTOGRAM_BAR_Y_GAP -
-                           DISPLAY_CHAR_HEIGHT - 1,
-                       histogram_barWidth, oldData + DISPLAY_CHAR_HEIGHT + 1,
-                       DISPLAY_BLACK);
-      // Draw the new bar.
-      display_fillRect(i * (histogram_barWidth + HISTOGRAM_BAR_X_GAP),
-                       display_height() - data - HISTOGRAM_BAR_Y_GAP,
-                       histogram_barWidth, data - 1, histogram_barColors[i]);
-      if (data != 0) { // Only draw the top label if the bar-data != 0.
-        histogram_drawTopLabel(i, data, topLabel[i],
-                               false); // false means that the old label does
-                                       // not need to be erased.
-        previousBarData[i] = currentBarData[i]; // Old data and new data are the
-                                                // same after the update.
-        // Old label and new label are the same after the update.
-        strncpy(oldTopLabel[i], topLabel[i],
-                HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
-      }
-    } else if ((data != 0) &&
-               strncmp(topLabel[i], oldTopLabel[i],
-                       HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS)) {
-      histogram_drawTopLabel(
-          i, data, topLabel[i],
-          true); // True means that the old label needs to be erased.
-      // After the update, copy the label to old data so that it won't reupdate
-      // until the next change.
-      strncpy(oldTopLabel[i], topLabel[i],
-              HISTOGRAM_BAR_TOP_MAX_LABEL_WIDTH_IN_CHARS);
+  uint16_t updatedCount = 0;
+  for (uint16_t n = 0; n < histogram_barCount; n++) {
+    uint16_t i = (nextUpdateBar + n) % histogram_barCount;
+    if (!histogram_isBarChanged(i))
+      continue;
+    if (updateLimit != HISTOGRAM_NO_UPDATE_LIMIT &&
+        updatedCount == updateLimit) {
+      nextUpdateBar = i; // Start here next time.
+      break;
     }
+    histogram_updateBar(i);
+    updatedCount++;
   }
+  display_flush();
 }
 
+void histogram_setUpdateLimit(uint16_t barCount) { updateLimit = barCount; }
+
 // Set the bar-color for each bar. This overwrites the defaults. Call
 // histogram_init() to restore the defaults.
 void histogram_setBarColor(histogram_index_t barIndex, uint16_t color) {
@@ -292,6 +340,8 @@ void histogram_setBarColor(histogram_index_t barIndex, uint16_t color) {
            barIndex);
     return;
   }
+  if (histogram_barColors[barIndex] != color)
+    recolorFlag[barIndex] = true; // Filled again by the next update.
   histogram_barColors[barIndex] = color;
 }
 
@@ -399,8 +449,7 @@ void histogram_plotUserFrequencyPower(double powerValues[]) {
              normalizedPowerValues[i]);
       printf("Dumping current and normalized power values.\n\r");
       for (int tmp_i = 0; tmp_i < FILTER_FREQUENCY_COUNT; tmp_i++) {
-        printf("currentPowerValue[%d]:%lf\n\r", tmp_i,
-               filter_getCurrentPowerValue(tmp_i));
+        printf("currentPowerValue[%d]:%lf\n\r", tmp_i, powerValues[tmp_i]);
         printf("normalizedPowerValue[%d]:%lf\n\r", tmp_i,
                normalizedPowerValues[tmp_i]);
       }
@@ -58,6 +58,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
    HISTOGRAM_TOP_LABEL_HEIGHT) // Max value (height) for histogram bar, in
                                // pixels.
 #define HISTOGRAM_MAX_BAR_LABEL_WIDTH 6 // Defined in terms of characters.
+#define HISTOGRAM_NO_UPDATE_LIMIT 0 // histogram_updateDisplay() draws all bars.
 
 typedef uint16_t histogram_index_t; // Used to index each histogram bar.
 typedef uint16_t histogram_data_t;  // The data associated with each bar.
@@ -85,8 +86,15 @@ void histogram_redrawBottomLabels();
 void histogram_setBottomLabelTextSize(uint16_t);
 
 // Call this to draw the histogram with the data from histogram_setBarData().
+// Only the part of each bar that grew or shrank is drawn, and only the
+// characters of its top label that changed.
 void histogram_updateDisplay();
 
+// Draws at most barCount changed bars per histogram_updateDisplay() call, the
+// next call continues with the bars after them. HISTOGRAM_NO_UPDATE_LIMIT (the
+// default after histogram_init()) draws every changed bar.
+void histogram_setUpdateLimit(uint16_t barCount);
+
 // Used to plot the power response for user frequencies 0-9.
 void histogram_plotUserFrequencyPower(double powerValue[]);
 
@@ -0,0 +1,159 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "hitDecision.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#if FILTER_FREQUENCY_COUNT != 10
+#error "The selection network in hitDecision.c is built for 10 frequencies."
+#endif
+
+// Orders v[a] <= v[b] without branches.
+#define COMPARE_EXCHANGE(v, a, b)                                              \
+  {                                                                            \
+    double x = v[a], y = v[b];                                                 \
+    v[a] = (x < y) ? x : y;                                                    \
+    v[b] = (x > y) ? x : y;                                                    \
+  }
+
+// Returns the lower median of 10 values. v[] is modified.
+static double hitDecision_median(double v[]) {
+  COMPARE_EXCHANGE(v, 2, 7);
+  COMPARE_EXCHANGE(v, 0, 5);
+  COMPARE_EXCHANGE(v, 1, 4);
+  COMPARE_EXCHANGE(v, 6, 9);
+  COMPARE_EXCHANGE(v, 0, 3);
+  COMPARE_EXCHANGE(v, 5, 8);
+  COMPARE_EXCHANGE(v, 0, 2);
+  COMPARE_EXCHANGE(v, 3, 6);
+  COMPARE_EXCHANGE(v, 7, 9);
+  COMPARE_EXCHANGE(v, 0, 1);
+  COMPARE_EXCHANGE(v, 5, 7);
+  COMPARE_EXCHANGE(v, 8, 9);
+  COMPARE_EXCHANGE(v, 1, 2);
+  COMPARE_EXCHANGE(v, 4, 6);
+  COMPARE_EXCHANGE(v, 7, 8);
+  COMPARE_EXCHANGE(v, 3, 5);
+  COMPARE_EXCHANGE(v, 2, 5);
+  COMPARE_EXCHANGE(v, 6, 8);
+  COMPARE_EXCHANGE(v, 1, 3);
+  COMPARE_EXCHANGE(v, 4, 7);
+  COMPARE_EXCHANGE(v, 2, 3);
+  COMPARE_EXCHANGE(v, 6, 7);
+  COMPARE_EXCHANGE(v, 3, 4);
+  COMPARE_EXCHANGE(v, 5, 6);
+  COMPARE_EXCHANGE(v, 4, 5);
+  return v[HIT_DECISION_MEDIAN_RANK];
+}
+
+// Finds the largest (non-ignored) power and the median power.
+void hitDecision_findMaxAndMedian(const double powerValues[],
+                                  const bool ignoredFrequencies[],
+                                  uint32_t *maxPowerFreqNo, double *maxPower,
+                                  double *median) {
+  double v[FILTER_FREQUENCY_COUNT];
+  uint32_t maxIndex = 0;
+  double maxValue = -1.0; // Power is never negative.
+  for (uint32_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    v[i] = powerValues[i];
+    if (ignoredFrequencies != NULL && ignoredFrequencies[i])
+      continue;
+    if (v[i] > maxValue) {
+      maxValue = v[i];
+      maxIndex = i;
+    }
+  }
+  *maxPowerFreqNo = maxIndex;
+  *maxPower = maxValue;
+  *median = hitDecision_median(v);
+}
+
+// Compares the largest (non-ignored) power with the scaled median.
+bool hitDecision_isHit(const double powerValues[],
+                       const bool ignoredFrequencies[], double fudgeFactor,
+                       uint32_t *maxPowerFreqNo) {
+  double maxPower, median;
+  hitDecision_findMaxAndMedian(powerValues, ignoredFrequencies,
+                               maxPowerFreqNo, &maxPower, &median);
+  return maxPower > fudgeFactor * median;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_RANDOM_COUNT 100000 // Random power vectors checked.
+
+// Comparison function for qsort().
+static int hitDecision_compareDoubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// Checks one power vector against qsort(). Returns true if max, its frequency
+// and the median all match.
+static bool hitDecision_checkVector(const double powerValues[]) {
+  double sorted[FILTER_FREQUENCY_COUNT];
+  for (uint32_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    sorted[i] = powerValues[i];
+  qsort(sorted, FILTER_FREQUENCY_COUNT, sizeof(double),
+        hitDecision_compareDoubles);
+  uint32_t maxPowerFreqNo;
+  double maxPower, median;
+  hitDecision_findMaxAndMedian(powerValues, NULL, &maxPowerFreqNo, &maxPower,
+                               &median);
+  return median == sorted[HIT_DECISION_MEDIAN_RANK] &&
+         maxPower == sorted[FILTER_FREQUENCY_COUNT - 1] &&
+         powerValues[maxPowerFreqNo] == maxPower;
+}
+
+// Checks the selection network and the ignored-frequency handling. The timing
+// comparison with a full sort is in the host benchmark (lasertag/benchmark).
+bool hitDecision_runTest() {
+  printf("******** hitDecision_runTest() **********\n\r");
+  bool success = true;
+  double v[FILTER_FREQUENCY_COUNT];
+  // 0-1 principle: a comparator network that selects correctly for every 0/1
+  // input selects correctly for every input.
+  for (uint32_t bits = 0; bits < (1 << FILTER_FREQUENCY_COUNT); bits++) {
+    for (uint32_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+      v[i] = (bits >> i) & 1;
+    if (!hitDecision_checkVector(v)) {
+      printf("hitDecision_runTest: wrong result for 0/1 input %lx.\n\r",
+             (unsigned long)bits);
+      success = false;
+      break;
+    }
+  }
+  for (uint32_t i = 0; i < TEST_RANDOM_COUNT && success; i++) {
+    for (uint32_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+      v[j] = (double)rand() / RAND_MAX;
+    if (!hitDecision_checkVector(v)) {
+      printf("hitDecision_runTest: wrong result for random input %ld.\n\r",
+             (long)i);
+      success = false;
+    }
+  }
+  // The largest power is at an ignored frequency: the next one must win.
+  for (uint32_t j = 0; j < FILTER_FREQUENCY_COUNT; j++)
+    v[j] = j;
+  bool ignored[FILTER_FREQUENCY_COUNT] = {false};
+  ignored[FILTER_FREQUENCY_COUNT - 1] = true;
+  uint32_t maxPowerFreqNo;
+  hitDecision_isHit(v, ignored, 1.0, &maxPowerFreqNo);
+  if (maxPowerFreqNo != FILTER_FREQUENCY_COUNT - 2) {
+    printf("hitDecision_runTest: ignored frequency %d was picked.\n\r",
+           (int)maxPowerFreqNo);
+    success = false;
+  }
+  printf("hitDecision_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,51 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef HITDECISION_H_
+#define HITDECISION_H_
+
+#include "filter.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Hit decision without a full sort. After every power update the detector
+// only needs the frequency with the most power and the median power (the
+// threshold is the median times a fudge factor), so instead of sorting all
+// FILTER_FREQUENCY_COUNT values like detector_sort():
+// - the maximum and its frequency number come from one linear scan,
+// - the median comes from a selection network: the 29-comparator sorting
+//   network for 10 inputs with every comparator that cannot reach output
+//   HIT_DECISION_MEDIAN_RANK removed (25 remain). Each comparator is a
+//   branch-free min/max pair, so the time does not depend on the data.
+
+#define HIT_DECISION_MEDIAN_RANK                                               \
+  (FILTER_FREQUENCY_COUNT / 2 - 1) // Lower median: sortedValues[4].
+
+// Finds the largest power among the frequencies that are not ignored
+// (ignoredFrequencies may be NULL) and the median of all the powers. The
+// frequency number of the largest power is written to *maxPowerFreqNo.
+void hitDecision_findMaxAndMedian(const double powerValues[],
+                                  const bool ignoredFrequencies[],
+                                  uint32_t *maxPowerFreqNo, double *maxPower,
+                                  double *median);
+
+// Returns true if the largest power among the frequencies that are not
+// ignored is greater than fudgeFactor times the median power. The frequency
+// number of the largest power is written to *maxPowerFreqNo either way.
+bool hitDecision_isHit(const double powerValues[],
+                       const bool ignoredFrequencies[], double fudgeFactor,
+                       uint32_t *maxPowerFreqNo);
+
+// Checks the median against a full sort for every 0/1 input (which covers
+// every ordering) and for random inputs, and checks that an ignored frequency
+// is never picked. Returns true if the results match. The host benchmark
+// (lasertag/benchmark) times hitDecision_isHit() against a full sort.
+bool hitDecision_runTest();
+
+#endif /* HITDECISION_H_ */
@@ -0,0 +1,212 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "iirBank.h"
+#include "intervalTimer.h"
+#include <math.h>
+#include <stdio.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE__)
+#include <xmmintrin.h>
+#endif
+
+// Coefficients of one section for every channel. Channels that need fewer
+// sections, and the padding lanes, get a pass-through (b0 = 1) or a zero
+// section.
+typedef struct {
+  float b0[IIR_BANK_LANE_COUNT];
+  float b1[IIR_BANK_LANE_COUNT];
+  float b2[IIR_BANK_LANE_COUNT];
+  float a1[IIR_BANK_LANE_COUNT];
+  float a2[IIR_BANK_LANE_COUNT];
+} __attribute__((aligned(16))) iirBank_section_t;
+
+// The two TDF-II state variables of one section for every channel.
+typedef struct {
+  float s1[IIR_BANK_LANE_COUNT];
+  float s2[IIR_BANK_LANE_COUNT];
+} __attribute__((aligned(16))) iirBank_state_t;
+
+static iirBank_section_t sections[IIR_SOS_MAX_SECTION_COUNT];
+static iirBank_state_t state[IIR_SOS_MAX_SECTION_COUNT];
+static uint16_t sectionCount;
+
+// Converts the IIR filters in filter.c and clears the state.
+bool iirBank_init() {
+  iirSos_section_t converted[FILTER_FREQUENCY_COUNT][IIR_SOS_MAX_SECTION_COUNT];
+  uint16_t convertedCount[FILTER_FREQUENCY_COUNT];
+  sectionCount = 0;
+  for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++) {
+    convertedCount[channel] = iirSos_convertFilter(
+        channel, converted[channel], IIR_SOS_MAX_SECTION_COUNT);
+    if (convertedCount[channel] == 0)
+      return false;
+    if (convertedCount[channel] > sectionCount)
+      sectionCount = convertedCount[channel];
+  }
+  for (uint16_t i = 0; i < sectionCount; i++) {
+    for (uint16_t lane = 0; lane < IIR_BANK_LANE_COUNT; lane++) {
+      iirSos_section_t section = {{0.0, 0.0, 0.0}, {0.0, 0.0}};
+      if (lane < FILTER_FREQUENCY_COUNT) {
+        if (i < convertedCount[lane])
+          section = converted[lane][i];
+        else
+          section.b[0] = 1.0; // Pass-through.
+      }
+      sections[i].b0[lane] = section.b[0];
+      sections[i].b1[lane] = section.b[1];
+      sections[i].b2[lane] = section.b[2];
+      sections[i].a1[lane] = section.a[0];
+      sections[i].a2[lane] = section.a[1];
+    }
+  }
+  iirBank_reset();
+  return true;
+}
+
+// Clears the filter state.
+void iirBank_reset() {
+  for (uint16_t i = 0; i < IIR_SOS_MAX_SECTION_COUNT; i++) {
+    for (uint16_t lane = 0; lane < IIR_BANK_LANE_COUNT; lane++) {
+      state[i].s1[lane] = 0.0f;
+      state[i].s2[lane] = 0.0f;
+    }
+  }
+}
+
+// Advances every channel by one sample. Each section computes
+// y = b0*x + s1, s1 = b1*x - a1*y + s2, s2 = b2*x - a2*y
+// and its output is the input of the next section of the same channel.
+void iirBank_filter(float input, float output[]) {
+  float y[IIR_BANK_LANE_COUNT] __attribute__((aligned(16)));
+#if defined(__ARM_NEON)
+  for (uint16_t lane = 0; lane < IIR_BANK_LANE_COUNT;
+       lane += IIR_BANK_VECTOR_WIDTH) {
+    float32x4_t x = vdupq_n_f32(input);
+    for (uint16_t i = 0; i < sectionCount; i++) {
+      const iirBank_section_t *c = &sections[i];
+      iirBank_state_t *s = &state[i];
+      float32x4_t s1 = vld1q_f32(&s->s1[lane]);
+      float32x4_t s2 = vld1q_f32(&s->s2[lane]);
+      float32x4_t out = vmlaq_f32(s1, vld1q_f32(&c->b0[lane]), x);
+      s1 = vmlaq_f32(s2, vld1q_f32(&c->b1[lane]), x);
+      s1 = vmlsq_f32(s1, vld1q_f32(&c->a1[lane]), out);
+      s2 = vmulq_f32(vld1q_f32(&c->b2[lane]), x);
+      s2 = vmlsq_f32(s2, vld1q_f32(&c->a2[lane]), out);
+      vst1q_f32(&s->s1[lane], s1);
+      vst1q_f32(&s->s2[lane], s2);
+      x = out;
+    }
+    vst1q_f32(&y[lane], x);
+  }
+#elif defined(__SSE__)
+  for (uint16_t lane = 0; lane < IIR_BANK_LANE_COUNT;
+       lane += IIR_BANK_VECTOR_WIDTH) {
+    __m128 x = _mm_set1_ps(input);
+    for (uint16_t i = 0; i < sectionCount; i++) {
+      const iirBank_section_t *c = &sections[i];
+      iirBank_state_t *s = &state[i];
+      __m128 out =
+          _mm_add_ps(_mm_mul_ps(_mm_load_ps(&c->b0[lane]), x),
+                     _mm_load_ps(&s->s1[lane]));
+      __m128 s1 = _mm_sub_ps(
+          _mm_add_ps(_mm_mul_ps(_mm_load_ps(&c->b1[lane]), x),
+                     _mm_load_ps(&s->s2[lane])),
+          _mm_mul_ps(_mm_load_ps(&c->a1[lane]), out));
+      __m128 s2 = _mm_sub_ps(_mm_mul_ps(_mm_load_ps(&c->b2[lane]), x),
+                             _mm_mul_ps(_mm_load_ps(&c->a2[lane]), out));
+      _mm_store_ps(&s->s1[lane], s1);
+      _mm_store_ps(&s->s2[lane], s2);
+      x = out;
+    }
+    _mm_store_ps(&y[lane], x);
+  }
+#else
+  for (uint16_t lane = 0; lane < IIR_BANK_LANE_COUNT; lane++)
+    y[lane] = input;
+  for (uint16_t i = 0; i < sectionCount; i++) {
+    const iirBank_section_t *c = &sections[i];
+    iirBank_state_t *s = &state[i];
+    for (uint16_t lane = 0; lane < IIR_BANK_LANE_COUNT; lane++) {
+      float x = y[lane];
+      float out = c->b0[lane] * x + s->s1[lane];
+      s->s1[lane] = c->b1[lane] * x - c->a1[lane] * out + s->s2[lane];
+      s->s2[lane] = c->b2[lane] * x - c->a2[lane] * out;
+      y[lane] = out;
+    }
+  }
+#endif
+  for (uint16_t channel = 0; channel < FILTER_FREQUENCY_COUNT; channel++)
+    output[channel] = y[channel];
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_PULSE_WIDTH_IN_TICKS 20000 // Same pulse width as filterTest.c.
+#define TEST_REFERENCE_TIMER INTERVAL_TIMER_TIMER_0 // Times filter_iirFilter().
+#define TEST_BANK_TIMER INTERVAL_TIMER_TIMER_1 // Times iirBank_filter().
+
+// Runs a square wave at each user frequency through both engines and compares
+// the outputs of every channel.
+bool iirBank_runTest() {
+  printf("******** iirBank_runTest() **********\n\r");
+  double signal = 0.0, noise = 0.0;
+  uint32_t sampleCount = 0;
+  intervalTimer_init(TEST_REFERENCE_TIMER);
+  intervalTimer_init(TEST_BANK_TIMER);
+  intervalTimer_reset(TEST_REFERENCE_TIMER);
+  intervalTimer_reset(TEST_BANK_TIMER);
+  for (uint16_t testFrequency = 0; testFrequency < FILTER_FREQUENCY_COUNT;
+       testFrequency++) {
+    filter_init();
+    if (!iirBank_init())
+      return false;
+    uint16_t periodTickCount = filter_frequencyTickTable[testFrequency];
+    for (uint32_t tick = 0; tick < TEST_PULSE_WIDTH_IN_TICKS; tick++) {
+      double x = ((tick % periodTickCount) < (periodTickCount / 2)) ? -1.0
+                                                                      : 1.0;
+      filter_addNewInput(x);
+      if ((tick % FILTER_FIR_DECIMATION_FACTOR) !=
+          FILTER_FIR_DECIMATION_FACTOR - 1)
+        continue;
+      double firOutput = filter_firFilter();
+      double reference[FILTER_FREQUENCY_COUNT];
+      float output[FILTER_FREQUENCY_COUNT];
+      intervalTimer_start(TEST_REFERENCE_TIMER);
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+        reference[i] = filter_iirFilter(i);
+      intervalTimer_stop(TEST_REFERENCE_TIMER);
+      intervalTimer_start(TEST_BANK_TIMER);
+      iirBank_filter((float)firOutput, output);
+      intervalTimer_stop(TEST_BANK_TIMER);
+      sampleCount++;
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+        double error = output[i] - reference[i];
+        signal += reference[i] * reference[i];
+        noise += error * error;
+      }
+    }
+  }
+  double snrDb = (noise == 0.0) ? INFINITY : 10.0 * log10(signal / noise);
+  bool success = snrDb >= IIR_BANK_MIN_SNR_DB;
+  printf("iirBank_runTest: SNR vs. filter_iirFilter(): %.1lf dB.\n\r", snrDb);
+  printf("iirBank_runTest: 10 x filter_iirFilter() %.0lf ns/sample, "
+         "iirBank_filter() %.0lf ns/sample.\n\r",
+         intervalTimer_getTotalDurationInSeconds(TEST_REFERENCE_TIMER) * 1e9 /
+             sampleCount,
+         intervalTimer_getTotalDurationInSeconds(TEST_BANK_TIMER) * 1e9 /
+             sampleCount);
+  printf("iirBank_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,61 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef IIRBANK_H_
+#define IIRBANK_H_
+
+#include "filter.h"
+#include "iirSos.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Runs all FILTER_FREQUENCY_COUNT IIR filters together. The coefficients and
+// state are stored structure-of-arrays: for every second-order section there
+// is one array per coefficient, indexed by channel, so a decimated sample is a
+// single pass over contiguous arrays that advances every channel at once.
+//
+// The Cortex-A9 NEON unit only does single-precision arithmetic, and the
+// direct-form filters in filter.c cannot run in float32 (see iirSos.h), so the
+// bank runs each channel as a cascade of float32 biquads (transposed direct
+// form II) converted from the filter.c tables with iirSos_convertFilter().
+//
+// The inner loop is selected at compile time:
+// - NEON (__ARM_NEON, the Zybo build compiles this file with -mfpu=neon).
+// - SSE (__SSE__, the x86 emulator build).
+// - Plain C for anything else.
+// The channel count is padded to a multiple of the vector width.
+//
+// Define DETECTOR_USE_IIR_BANK (see detector.h) to have
+// detector_processAvailable() run the bank in place of filter_iirFilter().
+
+#define IIR_BANK_VECTOR_WIDTH 4 // float32 lanes in a NEON/SSE register.
+#define IIR_BANK_LANE_COUNT                                                    \
+  (((FILTER_FREQUENCY_COUNT + IIR_BANK_VECTOR_WIDTH - 1) /                     \
+    IIR_BANK_VECTOR_WIDTH) *                                                   \
+   IIR_BANK_VECTOR_WIDTH) // Channels padded to whole vectors.
+#define IIR_BANK_MIN_SNR_DB                                                    \
+  60.0 // Minimum SNR (vs. filter_iirFilter()) for iirBank_runTest().
+
+// Converts the IIR filters in filter.c and clears the state. filter_init()
+// must have been called first. Returns false if a filter cannot be converted.
+bool iirBank_init();
+
+// Clears the filter state without reloading the coefficients.
+void iirBank_reset();
+
+// Advances every channel by one decimated sample (the FIR output) and writes
+// the FILTER_FREQUENCY_COUNT outputs to output[].
+void iirBank_filter(float input, float output[]);
+
+// Runs square waves at every user frequency through both iirBank_filter() and
+// filter_iirFilter(), reports the SNR and the time per decimated sample of
+// each. Returns true if the SNR is at least IIR_BANK_MIN_SNR_DB.
+bool iirBank_runTest();
+
+#endif /* IIRBANK_H_ */
@@ -0,0 +1,481 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "iirSos.h"
+#include "filter.h"
+#include "queue.h"
+#include <complex.h>
+#include <math.h>
+#include <stdio.h>
+
+#define ROOT_MAX_ITERATION_COUNT 1000 // Durand-Kerner iteration limit.
+#define ROOT_CONVERGENCE_TOLERANCE 1e-14 // Stop when no root moves more.
+#define ROOT_POLISH_ITERATION_COUNT 4 // Newton steps on each simple root.
+#define ROOT_UNIT_RESIDUAL                                                     \
+  1e-12 // Relative residual below which z = +/-1 is taken to be a root.
+#define ROOT_IMAGINARY_TOLERANCE 1e-9 // Smaller imaginary parts are real roots.
+#define GAIN_GRID_POINT_COUNT                                                  \
+  4096 // Frequencies used to find the peak gain of each section.
+
+// Sections are built from pairs of roots. A missing root (lower-order
+// numerator) is marked by isPresent == false.
+typedef struct {
+  double complex root[2];
+  bool isPresent[2];
+} iirSos_rootPair_t;
+
+/*********************************************************************************************************
+****************************************** Polynomial Roots
+******************************************
+**********************************************************************************************************/
+
+// Evaluates the polynomial c[0]*x^n + c[1]*x^(n-1) + ... + c[n] at x.
+static double complex iirSos_evaluate(const double c[], uint16_t degree,
+                                      double complex x) {
+  double complex value = c[0];
+  for (uint16_t i = 1; i <= degree; i++)
+    value = value * x + c[i];
+  return value;
+}
+
+// Evaluates the derivative of the polynomial at x.
+static double complex iirSos_evaluateDerivative(const double c[],
+                                                uint16_t degree,
+                                                double complex x) {
+  double complex value = 0.0;
+  for (uint16_t i = 0; i < degree; i++)
+    value = value * x + c[i] * (degree - i);
+  return value;
+}
+
+// Returns sum(|c[i]| * |x|^(n-i)), the scale used to judge a residual.
+static double iirSos_evaluateScale(const double c[], uint16_t degree,
+                                   double complex x) {
+  double scale = fabs(c[0]);
+  for (uint16_t i = 1; i <= degree; i++)
+    scale = scale * cabs(x) + fabs(c[i]);
+  return scale;
+}
+
+// Finds all roots of the monic polynomial c[] (c[0] == 1) with the
+// Durand-Kerner (Weierstrass) iteration, then polishes each one with a few
+// Newton steps. The roots must be simple (see iirSos_deflateUnitRoots()).
+static void iirSos_findRoots(const double c[], uint16_t degree,
+                             double complex roots[]) {
+  double complex seed = 0.4 + 0.9 * I;
+  double complex power = 1.0;
+  for (uint16_t i = 0; i < degree; i++) {
+    roots[i] = power;
+    power *= seed;
+  }
+  for (uint16_t iteration = 0; iteration < ROOT_MAX_ITERATION_COUNT;
+       iteration++) {
+    double largestStep = 0.0;
+    for (uint16_t i = 0; i < degree; i++) {
+      double complex denominator = 1.0;
+      for (uint16_t j = 0; j < degree; j++)
+        if (j != i)
+          denominator *= roots[i] - roots[j];
+      double complex step = iirSos_evaluate(c, degree, roots[i]) / denominator;
+      roots[i] -= step;
+      if (cabs(step) > largestStep)
+        largestStep = cabs(step);
+    }
+    if (largestStep < ROOT_CONVERGENCE_TOLERANCE)
+      break;
+  }
+  for (uint16_t i = 0; i < degree; i++) {
+    for (uint16_t k = 0; k < ROOT_POLISH_ITERATION_COUNT; k++) {
+      double complex slope = iirSos_evaluateDerivative(c, degree, roots[i]);
+      if (slope == 0.0)
+        break;
+      roots[i] -= iirSos_evaluate(c, degree, roots[i]) / slope;
+    }
+  }
+}
+
+// The bilinear transform places the zeros of lowpass, highpass and bandpass
+// designs at z = 1 and z = -1 with high multiplicity. Iterative root finders
+// only resolve an m-fold root to about 1/m of the available precision, so these
+// roots are divided out exactly first. c[] is monic and is deflated in place;
+// the roots that were removed are appended to roots[]. Returns the remaining
+// degree.
+static uint16_t iirSos_deflateUnitRoots(double c[], uint16_t degree,
+                                        double complex roots[],
+                                        uint16_t *rootCount) {
+  const double unitRoots[] = {1.0, -1.0};
+  for (uint16_t r = 0; r < 2; r++) {
+    while (degree > 0) {
+      double residual = creal(iirSos_evaluate(c, degree, unitRoots[r]));
+      if (fabs(residual) >
+          ROOT_UNIT_RESIDUAL * iirSos_evaluateScale(c, degree, unitRoots[r]))
+        break;
+      // Synthetic division by (x - root); the remainder is dropped.
+      for (uint16_t i = 1; i < degree; i++)
+        c[i] += c[i - 1] * unitRoots[r];
+      degree--;
+      roots[(*rootCount)++] = unitRoots[r];
+    }
+  }
+  return degree;
+}
+
+// Groups roots into conjugate pairs and pairs of real roots. Real roots are
+// sorted and paired from the two ends so that zeros at +1 and -1 end up in the
+// same section. If there are fewer roots than pairCount * 2 the remaining
+// pairs are padded with missing roots. Returns false if the roots do not come
+// in conjugate pairs.
+static bool iirSos_pairRoots(double complex roots[], uint16_t rootCount,
+                             iirSos_rootPair_t pairs[], uint16_t pairCount) {
+  double realRoots[IIR_SOS_MAX_ORDER];
+  uint16_t realCount = 0;
+  uint16_t pairIndex = 0;
+  bool isUsed[IIR_SOS_MAX_ORDER] = {false};
+  for (uint16_t i = 0; i < rootCount; i++) {
+    if (fabs(cimag(roots[i])) <= ROOT_IMAGINARY_TOLERANCE) {
+      realRoots[realCount++] = creal(roots[i]);
+      isUsed[i] = true;
+    }
+  }
+  for (uint16_t i = 0; i < rootCount; i++) {
+    if (isUsed[i] || cimag(roots[i]) < 0.0)
+      continue;
+    // Find the closest unused root in the lower half-plane.
+    int16_t conjugateIndex = -1;
+    for (uint16_t j = 0; j < rootCount; j++) {
+      if (isUsed[j] || cimag(roots[j]) >= 0.0)
+        continue;
+      if (conjugateIndex < 0 ||
+          cabs(roots[j] - conj(roots[i])) <
+              cabs(roots[conjugateIndex] - conj(roots[i])))
+        conjugateIndex = j;
+    }
+    if (conjugateIndex < 0 || pairIndex >= pairCount)
+      return false;
+    isUsed[i] = isUsed[conjugateIndex] = true;
+    pairs[pairIndex].root[0] = roots[i];
+    pairs[pairIndex].root[1] = conj(roots[i]);
+    pairs[pairIndex].isPresent[0] = pairs[pairIndex].isPresent[1] = true;
+    pairIndex++;
+  }
+  for (uint16_t i = 0; i < rootCount; i++)
+    if (!isUsed[i])
+      return false; // A complex root without a conjugate.
+  // Sort the real roots (insertion sort, there are only a few).
+  for (uint16_t i = 1; i < realCount; i++) {
+    double value = realRoots[i];
+    int16_t j = i - 1;
+    while (j >= 0 && realRoots[j] > value) {
+      realRoots[j + 1] = realRoots[j];
+      j--;
+    }
+    realRoots[j + 1] = value;
+  }
+  uint16_t low = 0, high = realCount;
+  while (low < high) {
+    if (pairIndex >= pairCount)
+      return false;
+    pairs[pairIndex].root[0] = realRoots[low++];
+    pairs[pairIndex].isPresent[0] = true;
+    pairs[pairIndex].isPresent[1] = (low < high);
+    if (low < high)
+      pairs[pairIndex].root[1] = realRoots[--high];
+    pairIndex++;
+  }
+  for (; pairIndex < pairCount; pairIndex++)
+    pairs[pairIndex].isPresent[0] = pairs[pairIndex].isPresent[1] = false;
+  return true;
+}
+
+// Expands a root pair into the coefficients c[0] + c[1]z^-1 + c[2]z^-2 with
+// c[0] == 1.
+static void iirSos_expandPair(const iirSos_rootPair_t *pair, double c[3]) {
+  c[0] = 1.0;
+  c[1] = 0.0;
+  c[2] = 0.0;
+  if (pair->isPresent[0] && pair->isPresent[1]) {
+    c[1] = -creal(pair->root[0] + pair->root[1]);
+    c[2] = creal(pair->root[0] * pair->root[1]);
+  } else if (pair->isPresent[0]) {
+    c[1] = -creal(pair->root[0]);
+  }
+}
+
+// Returns the largest distance from the origin of the roots in the pair.
+static double iirSos_pairRadius(const iirSos_rootPair_t *pair) {
+  double radius = 0.0;
+  for (uint16_t i = 0; i < 2; i++)
+    if (pair->isPresent[i] && cabs(pair->root[i]) > radius)
+      radius = cabs(pair->root[i]);
+  return radius;
+}
+
+// Returns the complex response of one section at e^(j*omega).
+static double complex iirSos_sectionResponse(const iirSos_section_t *section,
+                                             double omega) {
+  double complex z1 = cexp(-I * omega); // z^-1
+  double complex z2 = z1 * z1;
+  return (section->b[0] + section->b[1] * z1 + section->b[2] * z2) /
+         (1.0 + section->a[0] * z1 + section->a[1] * z2);
+}
+
+/*********************************************************************************************************
+****************************************** Conversion
+******************************************
+**********************************************************************************************************/
+
+// Converts one direct-form filter into second-order sections.
+uint16_t iirSos_convert(const double b[], uint32_t bCount, const double a[],
+                        uint32_t aCount, iirSos_section_t sections[],
+                        uint16_t maxSectionCount) {
+  if (bCount == 0 || b[0] == 0.0) {
+    printf("iirSos_convert(): the first B coefficient must be non-zero.\n\r");
+    return 0;
+  }
+  uint16_t numeratorDegree = bCount - 1;
+  uint16_t denominatorDegree = aCount;
+  uint16_t order = (numeratorDegree > denominatorDegree) ? numeratorDegree
+                                                          : denominatorDegree;
+  uint16_t sectionCount = (order + 1) / 2;
+  if (order > IIR_SOS_MAX_ORDER || sectionCount > maxSectionCount) {
+    printf("iirSos_convert(): order %d is too large.\n\r", order);
+    return 0;
+  }
+  if (sectionCount == 0) {
+    sections[0].b[0] = b[0];
+    sections[0].b[1] = sections[0].b[2] = 0.0;
+    sections[0].a[0] = sections[0].a[1] = 0.0;
+    return 1;
+  }
+  // Roots of B(z) = b0*z^n + ... + bn (monic) and A(z) = z^m + a1*z^(m-1)...
+  double monic[IIR_SOS_MAX_ORDER + 1];
+  double complex zeros[IIR_SOS_MAX_ORDER];
+  double complex poles[IIR_SOS_MAX_ORDER];
+  for (uint16_t i = 0; i <= numeratorDegree; i++)
+    monic[i] = b[i] / b[0];
+  uint16_t zeroCount = 0;
+  uint16_t remainingDegree =
+      iirSos_deflateUnitRoots(monic, numeratorDegree, zeros, &zeroCount);
+  iirSos_findRoots(monic, remainingDegree, zeros + zeroCount);
+  monic[0] = 1.0;
+  for (uint16_t i = 0; i < denominatorDegree; i++)
+    monic[i + 1] = a[i];
+  iirSos_findRoots(monic, denominatorDegree, poles);
+  iirSos_rootPair_t zeroPairs[IIR_SOS_MAX_SECTION_COUNT];
+  iirSos_rootPair_t polePairs[IIR_SOS_MAX_SECTION_COUNT];
+  if (!iirSos_pairRoots(zeros, numeratorDegree, zeroPairs, sectionCount) ||
+      !iirSos_pairRoots(poles, denominatorDegree, polePairs, sectionCount)) {
+    printf("iirSos_convert(): roots do not form conjugate pairs.\n\r");
+    return 0;
+  }
+  // Order the pole pairs from the farthest from the unit circle (smallest
+  // radius) to the closest.
+  for (uint16_t i = 1; i < sectionCount; i++) {
+    iirSos_rootPair_t pair = polePairs[i];
+    int16_t j = i - 1;
+    while (j >= 0 &&
+           iirSos_pairRadius(&polePairs[j]) > iirSos_pairRadius(&pair)) {
+      polePairs[j + 1] = polePairs[j];
+      j--;
+    }
+    polePairs[j + 1] = pair;
+  }
+  // Starting with the sharpest pole pair, give each one the nearest remaining
+  // zero pair.
+  bool isZeroPairUsed[IIR_SOS_MAX_SECTION_COUNT] = {false};
+  for (int16_t section = sectionCount - 1; section >= 0; section--) {
+    int16_t bestIndex = -1;
+    double bestDistance = INFINITY;
+    for (uint16_t i = 0; i < sectionCount; i++) {
+      if (isZeroPairUsed[i])
+        continue;
+      double distance = INFINITY;
+      if (zeroPairs[i].isPresent[0] && polePairs[section].isPresent[0])
+        distance = cabs(zeroPairs[i].root[0] - polePairs[section].root[0]);
+      if (bestIndex < 0 || distance < bestDistance) {
+        bestIndex = i;
+        bestDistance = distance;
+      }
+    }
+    isZeroPairUsed[bestIndex] = true;
+    iirSos_expandPair(&zeroPairs[bestIndex], sections[section].b);
+    double denominator[3];
+    iirSos_expandPair(&polePairs[section], denominator);
+    sections[section].a[0] = denominator[1];
+    sections[section].a[1] = denominator[2];
+  }
+  // Spread the gain: scale each section so that the peak gain of the cascade
+  // up to and including it is 1.0. The last section takes whatever gain is
+  // left so that the overall gain is b[0].
+  double appliedGain = 1.0;
+  for (uint16_t section = 0; section < sectionCount; section++) {
+    double sectionGain;
+    if (section == sectionCount - 1) {
+      sectionGain = b[0] / appliedGain;
+    } else {
+      double peak = 0.0;
+      for (uint32_t k = 0; k <= GAIN_GRID_POINT_COUNT; k++) {
+        double omega = M_PI * k / GAIN_GRID_POINT_COUNT;
+        double complex response = 1.0; // Earlier sections are already scaled.
+        for (uint16_t i = 0; i <= section; i++)
+          response *= iirSos_sectionResponse(&sections[i], omega);
+        if (cabs(response) > peak)
+          peak = cabs(response);
+      }
+      sectionGain = 1.0 / peak;
+    }
+    for (uint16_t i = 0; i < 3; i++)
+      sections[section].b[i] *= sectionGain;
+    appliedGain *= sectionGain;
+  }
+  return sectionCount;
+}
+
+// Converts IIR filter [filterNumber] from filter.c.
+uint16_t iirSos_convertFilter(uint16_t filterNumber,
+                              iirSos_section_t sections[],
+                              uint16_t maxSectionCount) {
+  uint32_t bCount = filter_getIirBCoefficientCount();
+  uint32_t aCount = filter_getIirACoefficientCount();
+  // Some A arrays include the leading 1, some do not.
+  uint32_t aStartingIndex = (aCount == bCount) ? 1 : 0;
+  return iirSos_convert(filter_getIirBCoefficientArray(filterNumber), bCount,
+                        filter_getIirACoefficientArray(filterNumber) +
+                            aStartingIndex,
+                        aCount - aStartingIndex, sections, maxSectionCount);
+}
+
+// Returns the magnitude response of the cascade.
+double iirSos_getMagnitudeResponse(const iirSos_section_t sections[],
+                                   uint16_t sectionCount,
+                                   double normalizedFrequency) {
+  double complex response = 1.0;
+  for (uint16_t i = 0; i < sectionCount; i++)
+    response *= iirSos_sectionResponse(&sections[i],
+                                       2.0 * M_PI * normalizedFrequency);
+  return cabs(response);
+}
+
+/*********************************************************************************************************
+****************************************** Engine
+******************************************
+**********************************************************************************************************/
+
+// Coefficients in the engine's precision: b0, b1, b2, a1, a2.
+#define SECTION_COEFFICIENT_COUNT 5
+static iirSos_value_t engineCoefficients[FILTER_FREQUENCY_COUNT]
+                                        [IIR_SOS_MAX_SECTION_COUNT]
+                                        [SECTION_COEFFICIENT_COUNT];
+static iirSos_state_t engineState[FILTER_FREQUENCY_COUNT]
+                                 [IIR_SOS_MAX_SECTION_COUNT];
+static uint16_t engineSectionCount[FILTER_FREQUENCY_COUNT];
+
+// Converts all filters and clears their state.
+bool iirSos_init() {
+  for (uint16_t filterNumber = 0; filterNumber < FILTER_FREQUENCY_COUNT;
+       filterNumber++) {
+    iirSos_section_t sections[IIR_SOS_MAX_SECTION_COUNT];
+    engineSectionCount[filterNumber] =
+        iirSos_convertFilter(filterNumber, sections, IIR_SOS_MAX_SECTION_COUNT);
+    if (engineSectionCount[filterNumber] == 0)
+      return false;
+    for (uint16_t i = 0; i < engineSectionCount[filterNumber]; i++) {
+      iirSos_value_t *c = engineCoefficients[filterNumber][i];
+      c[0] = sections[i].b[0];
+      c[1] = sections[i].b[1];
+      c[2] = sections[i].b[2];
+      c[3] = sections[i].a[0];
+      c[4] = sections[i].a[1];
+    }
+  }
+  iirSos_reset();
+  return true;
+}
+
+// Clears the state of every filter.
+void iirSos_reset() {
+  for (uint16_t filterNumber = 0; filterNumber < FILTER_FREQUENCY_COUNT;
+       filterNumber++) {
+    for (uint16_t i = 0; i < IIR_SOS_MAX_SECTION_COUNT; i++) {
+      engineState[filterNumber][i].s1 = 0;
+      engineState[filterNumber][i].s2 = 0;
+    }
+  }
+}
+
+// Runs one input through the cascade for IIR filter [filterNumber].
+iirSos_value_t iirSos_filter(uint16_t filterNumber, iirSos_value_t input) {
+  iirSos_value_t x = input;
+  for (uint16_t i = 0; i < engineSectionCount[filterNumber]; i++) {
+    const iirSos_value_t *c = engineCoefficients[filterNumber][i];
+    iirSos_state_t *s = &engineState[filterNumber][i];
+    iirSos_value_t y = c[0] * x + s->s1;
+    s->s1 = c[1] * x - c[3] * y + s->s2;
+    s->s2 = c[2] * x - c[4] * y;
+    x = y;
+  }
+  return x;
+}
+
+// Drop-in replacement for filter_iirFilter().
+double iirSos_iirFilter(uint16_t filterNumber) {
+  queue_t *yQueue = filter_getYQueue();
+  double input = queue_readElementAt(yQueue, queue_elementCount(yQueue) - 1);
+  double output = iirSos_filter(filterNumber, input);
+  queue_overwritePush(filter_getIirOutputQueue(filterNumber), output);
+  return output;
+}
+
+// Returns the number of bytes of state used by the engine.
+uint32_t iirSos_getStateSizeInBytes() { return sizeof(engineState); }
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_PULSE_WIDTH_IN_TICKS 20000 // Same pulse width as filterTest.c.
+
+// Runs a square wave at each user frequency through both engines and compares
+// the outputs of every filter.
+bool iirSos_runTest() {
+  printf("******** iirSos_runTest() **********\n\r");
+  double signal = 0.0, noise = 0.0;
+  for (uint16_t testFrequency = 0; testFrequency < FILTER_FREQUENCY_COUNT;
+       testFrequency++) {
+    filter_init();
+    if (!iirSos_init())
+      return false;
+    uint16_t periodTickCount = filter_frequencyTickTable[testFrequency];
+    for (uint32_t tick = 0; tick < TEST_PULSE_WIDTH_IN_TICKS; tick++) {
+      double x = ((tick % periodTickCount) < (periodTickCount / 2)) ? -1.0
+                                                                      : 1.0;
+      filter_addNewInput(x);
+      if ((tick % FILTER_FIR_DECIMATION_FACTOR) !=
+          FILTER_FIR_DECIMATION_FACTOR - 1)
+        continue;
+      double firOutput = filter_firFilter();
+      for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+        double reference = filter_iirFilter(i);
+        double error = iirSos_filter(i, firOutput) - reference;
+        signal += reference * reference;
+        noise += error * error;
+      }
+    }
+  }
+  double snrDb = (noise == 0.0) ? INFINITY : 10.0 * log10(signal / noise);
+  bool success = snrDb >= IIR_SOS_MIN_SNR_DB;
+  printf("iirSos_runTest: SNR vs. filter_iirFilter(): %.1lf dB.\n\r", snrDb);
+  printf("iirSos_runTest: state is %ld bytes for %d filters (%ld bytes of "
+         "coefficients).\n\r",
+         (long)iirSos_getStateSizeInBytes(), FILTER_FREQUENCY_COUNT,
+         (long)sizeof(engineCoefficients));
+  printf("iirSos_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
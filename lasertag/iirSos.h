@@ -0,0 +1,114 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef IIRSOS_H_
+#define IIRSOS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Second-order-section (biquad cascade) version of the IIR filters in
+// filter.c. The high-order direct form needs more than 40 bits of coefficient
+// precision to keep its poles in place, which rules out fixed-point and
+// float32 arithmetic, and it keeps its history in yQueue and zQueue. A cascade
+// of biquads with the same poles and zeros only needs about 24 bits, and in
+// transposed direct form II (TDF-II) each section's history is just two state
+// values.
+//
+// This file provides the conversion from the filter.c tables (also used by
+// filterFixed.c and iirBank.c) and a TDF-II engine that can stand in for
+// filter_iirFilter().
+//
+// Sections are ordered from the pole pair farthest from the unit circle to the
+// one closest to it. The overall gain is spread across the sections so that
+// the peak gain from the filter input to the output of every section (except
+// the last) is 1.0, which keeps intermediate values in the same range as the
+// input.
+
+#define IIR_SOS_MAX_ORDER 16 // Largest direct-form order that can be converted.
+#define IIR_SOS_MAX_SECTION_COUNT                                              \
+  ((IIR_SOS_MAX_ORDER + 1) / 2) // One section per pole pair.
+#define IIR_SOS_MIN_SNR_DB                                                     \
+  60.0 // Minimum SNR (vs. filter_iirFilter()) for iirSos_runTest().
+
+// Each section computes:
+// y[n] = b[0]*x[n] + b[1]*x[n-1] + b[2]*x[n-2] - a[0]*y[n-1] - a[1]*y[n-2]
+// The leading 1 of the denominator is not stored.
+typedef struct {
+  double b[3]; // Numerator, section gain included.
+  double a[2]; // Denominator (a1, a2).
+} iirSos_section_t;
+
+// The engine runs in double unless IIR_SOS_SINGLE_PRECISION is defined.
+#ifdef IIR_SOS_SINGLE_PRECISION
+typedef float iirSos_value_t;
+#else
+typedef double iirSos_value_t;
+#endif
+
+// TDF-II state of one section:
+// y = b0*x + s1, s1 = b1*x - a1*y + s2, s2 = b2*x - a2*y
+typedef struct {
+  iirSos_value_t s1;
+  iirSos_value_t s2;
+} iirSos_state_t;
+
+// Converts one direct-form filter into second-order sections.
+// b[0..bCount-1] are the numerator coefficients and a[0..aCount-1] are the
+// denominator coefficients without the leading 1. Writes the sections into
+// sections[] and returns the number of sections, or 0 if the filter cannot be
+// converted (an error message is printed).
+uint16_t iirSos_convert(const double b[], uint32_t bCount, const double a[],
+                        uint32_t aCount, iirSos_section_t sections[],
+                        uint16_t maxSectionCount);
+
+// Converts IIR filter [filterNumber] from filter.c using the tables returned by
+// filter_getIirBCoefficientArray() and filter_getIirACoefficientArray(). A
+// leading 1 in the A table is detected and skipped.
+uint16_t iirSos_convertFilter(uint16_t filterNumber,
+                              iirSos_section_t sections[],
+                              uint16_t maxSectionCount);
+
+// Returns the magnitude of the frequency response of the cascade at
+// normalizedFrequency (cycles per sample, 0.0 to 0.5).
+double iirSos_getMagnitudeResponse(const iirSos_section_t sections[],
+                                   uint16_t sectionCount,
+                                   double normalizedFrequency);
+
+/*********************************************************************************************************
+****************************************** Engine
+******************************************
+**********************************************************************************************************/
+
+// Converts all FILTER_FREQUENCY_COUNT filters and clears their state.
+// filter_init() must have been called first. Returns false if a filter cannot
+// be converted.
+bool iirSos_init();
+
+// Clears the state of every filter.
+void iirSos_reset();
+
+// Runs one input through IIR filter [filterNumber] and returns the output.
+iirSos_value_t iirSos_filter(uint16_t filterNumber, iirSos_value_t input);
+
+// Drop-in replacement for filter_iirFilter(). Input is the newest value in
+// filter_getYQueue(); the output is returned and is also pushed onto
+// filter_getIirOutputQueue(filterNumber), so filter_computePower() works
+// unchanged. zQueue is not used.
+double iirSos_iirFilter(uint16_t filterNumber);
+
+// Returns the number of bytes of state used by the engine for all filters.
+uint32_t iirSos_getStateSizeInBytes();
+
+// Runs square waves at each user frequency through both iirSos_filter() and
+// filter_iirFilter() and reports the SNR. Returns true if the SNR is at least
+// IIR_SOS_MIN_SNR_DB.
+bool iirSos_runTest();
+
+#endif /* IIRSOS_H_ */
@@ -18,11 +18,22 @@ typedef uint32_t
 // accurate timing. A buffer for storing values from the Analog to Digital
 // Converter (ADC) is implemented in isr.c Values are added to this buffer by
 // the code in isr.c. Values are removed from this queue by code in detector.c
+//
+// isr.c can keep its samples in the lock-free buffer in adcBuffer.h. The ISR
+// then calls adcBuffer_push() and isr_drainAdcBuffer() is just
+// adcBuffer_drain(), which takes everything that has arrived in one call
+// without disabling interrupts.
 
 // Performs inits for anything in isr.c
 void isr_init();
 
-// This function is invoked by the timer interrupt at 100 kHz.
+// This function is invoked by the timer interrupt at 100 kHz. Bracket its body
+// with profiler_start(PROFILER_SCOPE_ISR) and profiler_stop(PROFILER_SCOPE_ISR)
+// to get its cycle statistics (see profiler.h), and with isrMonitor_enter()
+// and isrMonitor_exit() to detect overruns and missed ticks (see isrMonitor.h).
+// The state-machine tick functions are not called directly: isr_init() calls
+// tickTasks_init() and isr_function() calls tickScheduler_tick(), which runs
+// each of them at its own rate (see tickTasks.h).
 void isr_function();
 
 // This adds data to the ADC queue. Data are removed from this queue and used by
@@ -35,4 +46,11 @@ uint32_t isr_removeDataFromAdcBuffer();
 // This returns the number of values in the ADC buffer.
 uint32_t isr_adcBufferElementCount();
 
+// Removes up to maxCount of the oldest values from the ADC buffer into
+// values[], oldest first, and returns the number removed. Must be safe to call
+// with interrupts enabled: detector_processAvailable() reads its samples only
+// through this function. An isr.c that keeps its own queue disables interrupts
+// around each pop, one built on adcBuffer.h simply calls adcBuffer_drain().
+uint32_t isr_drainAdcBuffer(isr_AdcValue_t values[], uint32_t maxCount);
+
 #endif /* ISR_H_ */
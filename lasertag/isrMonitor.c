@@ -0,0 +1,187 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "isrMonitor.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MISSED_TICK_GAP_CYCLES                                                 \
+  (ISR_MONITOR_PERIOD_CYCLES * 3 / 2) // Longer gaps have missed ticks in them.
+#define PERCENTILE 0.999
+
+static volatile uint32_t tickCount;
+static volatile uint32_t overrunCount;
+static volatile uint32_t missedTickCount;
+static volatile uint32_t maxCycles;
+static volatile uint64_t totalCycles;
+static volatile uint64_t elapsedCycles;
+static volatile uint32_t buckets[ISR_MONITOR_BUCKET_COUNT];
+static uint32_t entryCycles; // Timestamp of the current tick.
+
+void isrMonitor_init() {
+  tickCount = 0;
+  overrunCount = 0;
+  missedTickCount = 0;
+  maxCycles = 0;
+  totalCycles = 0;
+  elapsedCycles = 0;
+  for (uint16_t i = 0; i < ISR_MONITOR_BUCKET_COUNT; i++)
+    buckets[i] = 0;
+}
+
+// Accounts for the gap since the previous entry, then starts the tick.
+static void isrMonitor_recordEntry(uint32_t cycles) {
+  if (tickCount > 0) {
+    uint32_t gap = cycles - entryCycles;
+    elapsedCycles += gap;
+    // Round to whole periods, so jitter does not count as a missed tick.
+    if (gap > MISSED_TICK_GAP_CYCLES)
+      missedTickCount +=
+          (gap + ISR_MONITOR_PERIOD_CYCLES / 2) / ISR_MONITOR_PERIOD_CYCLES -
+          1;
+  }
+  entryCycles = cycles;
+  tickCount++;
+}
+
+// Records the duration of the tick that started at entryCycles.
+static void isrMonitor_recordExit(uint32_t cycles) {
+  uint32_t duration = cycles - entryCycles;
+  uint32_t bucket = duration / ISR_MONITOR_BUCKET_CYCLES;
+  buckets[bucket < ISR_MONITOR_BUCKET_COUNT ? bucket
+                                            : ISR_MONITOR_BUCKET_COUNT - 1]++;
+  totalCycles += duration;
+  if (duration > maxCycles)
+    maxCycles = duration;
+  if (duration > ISR_MONITOR_BUDGET_CYCLES)
+    overrunCount++;
+}
+
+void isrMonitor_enter() { isrMonitor_recordEntry(profiler_getCycles()); }
+
+void isrMonitor_exit() { isrMonitor_recordExit(profiler_getCycles()); }
+
+// Copies the counters and finds the 99.9th percentile in the histogram.
+void isrMonitor_getStatistics(isrMonitor_statistics_t *statistics) {
+  memset(statistics, 0, sizeof(*statistics));
+  statistics->tickCount = tickCount;
+  statistics->overrunCount = overrunCount;
+  statistics->missedTickCount = missedTickCount;
+  statistics->maxCycles = maxCycles;
+  statistics->elapsedCycles = elapsedCycles;
+  uint32_t recordedCount = 0;
+  for (uint16_t i = 0; i < ISR_MONITOR_BUCKET_COUNT; i++)
+    recordedCount += buckets[i];
+  if (recordedCount == 0)
+    return;
+  statistics->meanCycles = (double)totalCycles / recordedCount;
+  uint32_t rank = (uint32_t)(PERCENTILE * (recordedCount - 1)) + 1;
+  uint32_t seen = 0;
+  for (uint16_t i = 0; i < ISR_MONITOR_BUCKET_COUNT; i++) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      // Upper edge of the bucket; the last bucket is open-ended.
+      uint32_t upperEdge = (i + 1) * ISR_MONITOR_BUCKET_CYCLES - 1;
+      statistics->p999Cycles =
+          (i < ISR_MONITOR_BUCKET_COUNT - 1 && upperEdge < maxCycles)
+              ? upperEdge
+              : maxCycles;
+      break;
+    }
+  }
+}
+
+void isrMonitor_printStatistics(uint32_t isrInvocationCount) {
+  isrMonitor_statistics_t statistics;
+  isrMonitor_getStatistics(&statistics);
+  printf("ISR ticks: %lu, overruns: %lu, missed: %lu, unmonitored: %ld\n\r",
+         (unsigned long)statistics.tickCount,
+         (unsigned long)statistics.overrunCount,
+         (unsigned long)statistics.missedTickCount,
+         (long)isrInvocationCount - (long)statistics.tickCount);
+  printf("ISR duration (us): mean %.3lf, p99.9 %.3lf, max %.3lf, budget "
+         "%.3lf\n\r",
+         profiler_cyclesToMicros(statistics.meanCycles),
+         profiler_cyclesToMicros(statistics.p999Cycles),
+         profiler_cyclesToMicros(statistics.maxCycles),
+         profiler_cyclesToMicros(ISR_MONITOR_BUDGET_CYCLES));
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_TICK_COUNT 10000 // Synthetic ticks.
+#define TEST_NORMAL_CYCLES 2000 // Duration of most ticks.
+#define TEST_SLOW_CYCLES 5000 // Every TEST_SLOW_PERIOD-th tick.
+#define TEST_SLOW_PERIOD 500
+#define TEST_OVERRUN_CYCLES 8000 // Every TEST_OVERRUN_PERIOD-th tick.
+#define TEST_OVERRUN_PERIOD 2000
+#define TEST_SKIP_PERIOD 1000 // Every this many ticks, skip two periods.
+#define TEST_SKIPPED_TICKS 2
+#define TEST_JITTER_CYCLES 1000 // Entry jitter, must not count as missed.
+#define TEST_START_CYCLES 0xFFF00000 // The cycle counter wraps during the test.
+
+// Prints and returns false if actual != expected.
+static bool isrMonitor_testEqual(const char *name, uint32_t actual,
+                                 uint32_t expected) {
+  if (actual == expected)
+    return true;
+  printf("isrMonitor_runTest: %s is %lu, expected %lu.\n\r", name,
+         (unsigned long)actual, (unsigned long)expected);
+  return false;
+}
+
+// Runs TEST_TICK_COUNT ticks with a few slow ticks and overruns, skipped
+// periods and jitter.
+bool isrMonitor_runTest() {
+  printf("******** isrMonitor_runTest() **********\n\r");
+  isrMonitor_init();
+  uint32_t period = 0;
+  uint32_t expectedOverruns = 0, expectedMissed = 0;
+  for (uint32_t i = 0; i < TEST_TICK_COUNT; i++) {
+    if (i > 0 && i % TEST_SKIP_PERIOD == 0) {
+      period += TEST_SKIPPED_TICKS;
+      expectedMissed += TEST_SKIPPED_TICKS;
+    }
+    uint32_t jitter = (i % 2) ? TEST_JITTER_CYCLES : 0;
+    uint32_t entry =
+        TEST_START_CYCLES + period * ISR_MONITOR_PERIOD_CYCLES + jitter;
+    uint32_t duration = TEST_NORMAL_CYCLES;
+    if (i % TEST_OVERRUN_PERIOD == TEST_OVERRUN_PERIOD - 1) {
+      duration = TEST_OVERRUN_CYCLES;
+      expectedOverruns++;
+    } else if (i % TEST_SLOW_PERIOD == TEST_SLOW_PERIOD - 1) {
+      duration = TEST_SLOW_CYCLES;
+    }
+    isrMonitor_recordEntry(entry);
+    isrMonitor_recordExit(entry + duration);
+    period++;
+  }
+  isrMonitor_statistics_t statistics;
+  isrMonitor_getStatistics(&statistics);
+  bool success = true;
+  success &= isrMonitor_testEqual("tick count", statistics.tickCount,
+                                  TEST_TICK_COUNT);
+  success &= isrMonitor_testEqual("overrun count", statistics.overrunCount,
+                                  expectedOverruns);
+  success &= isrMonitor_testEqual("missed tick count",
+                                  statistics.missedTickCount, expectedMissed);
+  success &= isrMonitor_testEqual("max", statistics.maxCycles,
+                                  TEST_OVERRUN_CYCLES);
+  // 15 slow ticks and 5 overruns are the top 0.2%, so p99.9 is a slow tick.
+  success &= isrMonitor_testEqual(
+      "p99.9 bucket", statistics.p999Cycles / ISR_MONITOR_BUCKET_CYCLES,
+      TEST_SLOW_CYCLES / ISR_MONITOR_BUCKET_CYCLES);
+  isrMonitor_printStatistics(TEST_TICK_COUNT);
+  isrMonitor_init();
+  printf("isrMonitor_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,73 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef ISRMONITOR_H_
+#define ISRMONITOR_H_
+
+#include "profiler.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Checks that every isr_function() tick fits in its 10 us slot. Call
+// isrMonitor_enter() first thing in isr_function() and isrMonitor_exit() last
+// thing. Both timestamp with the PMU cycle counter (profiler_getCycles()).
+// - The duration of every tick goes into a histogram (ISR_MONITOR_BUCKET_CYCLES
+//   wide buckets up to twice the period) for the maximum and the 99.9th
+//   percentile.
+// - A tick longer than ISR_MONITOR_BUDGET_CYCLES is an overrun: the next timer
+//   interrupt was already pending when it returned.
+// - A gap of more than 1.5 periods between two entries means ticks were
+//   missed, e.g., while interrupts were disabled or after an overrun.
+// Statistics are read by the main loop while the ISR updates them, so a
+// snapshot may mix two consecutive ticks.
+
+#define ISR_MONITOR_TICK_RATE_HZ 100000 // isr_function() rate.
+#define ISR_MONITOR_PERIOD_CYCLES                                              \
+  (PROFILER_CPU_CLOCK_HZ / ISR_MONITOR_TICK_RATE_HZ) // 6500 cycles (10 us).
+#define ISR_MONITOR_BUDGET_CYCLES                                              \
+  ISR_MONITOR_PERIOD_CYCLES // Longer ticks count as overruns.
+#define ISR_MONITOR_BUCKET_CYCLES 32 // Histogram resolution (about 50 ns).
+#define ISR_MONITOR_BUCKET_COUNT                                               \
+  (2 * ISR_MONITOR_PERIOD_CYCLES / ISR_MONITOR_BUCKET_CYCLES +                 \
+   1) // Up to two periods, the last bucket holds everything longer.
+
+typedef struct {
+  uint32_t tickCount;       // Ticks monitored since isrMonitor_init().
+  uint32_t overrunCount;    // Ticks longer than ISR_MONITOR_BUDGET_CYCLES.
+  uint32_t missedTickCount; // Ticks that never ran, from the entry gaps.
+  uint32_t maxCycles;       // Longest tick.
+  double meanCycles;        // Mean tick duration.
+  uint32_t p999Cycles;      // 99.9th percentile tick duration.
+  uint64_t elapsedCycles;   // From the first to the last monitored entry.
+} isrMonitor_statistics_t;
+
+// Clears the statistics. Call before interrupts are enabled; profiler_init()
+// must have enabled the cycle counter.
+void isrMonitor_init();
+
+// Timestamps the entry into isr_function().
+void isrMonitor_enter();
+
+// Timestamps the exit from isr_function() and records the tick.
+void isrMonitor_exit();
+
+// Fills statistics with the current values.
+void isrMonitor_getStatistics(isrMonitor_statistics_t *statistics);
+
+// Prints the statistics to the UART. isrInvocationCount is
+// interrupts_isrInvocationCount(); ticks the monitor did not see are reported
+// as unmonitored (isr_function() not instrumented, or monitoring started
+// late).
+void isrMonitor_printStatistics(uint32_t isrInvocationCount);
+
+// Feeds synthetic ticks with known durations, overruns and gaps through the
+// monitor and checks the statistics. Returns true if they match.
+bool isrMonitor_runTest();
+
+#endif /* ISRMONITOR_H_ */
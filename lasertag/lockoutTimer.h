@@ -9,9 +9,15 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #ifndef LOCKOUTTIMER_H_
 #define LOCKOUTTIMER_H_
+#include "tickTasks.h"
 #include <stdbool.h>
 
-#define LOCKOUT_TIMER_EXPIRE_VALUE 50000 // Defined in terms of 100 kHz ticks.
+#define LOCKOUT_TIMER_EXPIRE_MS 500 // How long the detector is locked out.
+// In lockoutTimer_tick() ticks, which run at the slow rate in tickTasks.h.
+// Assumes isr.c runs lockoutTimer_tick() through tickScheduler_tick(). An
+// isr.c that still calls it on every 100 kHz tick gets a 5 ms lockout.
+#define LOCKOUT_TIMER_EXPIRE_VALUE                                             \
+  TICK_TASKS_MS_TO_SLOW_TICKS(LOCKOUT_TIMER_EXPIRE_MS)
 
 // Calling this starts the timer.
 void lockoutTimer_start();
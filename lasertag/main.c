@@ -15,14 +15,62 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 //#define TEST_MAIN // Used for general testing.
 
+// Leave uncommented to run the lock-free ADC buffer test.
+// #define ADC_BUFFER_TEST_RUN
+
+// Leave uncommented to run the ADC trace encoder/decoder test.
+// #define ADC_TRACE_TEST_RUN
+
+// Leave uncommented to check the IMA-ADPCM encoder and decoder SNR.
+// #define ADPCM_TEST_RUN
+
+// Leave uncommented to compare the fixed-point filters with filter.c.
+// #define FILTER_FIXED_TEST_RUN
+
+// Leave uncommented to compare the block FIR decimator with filter.c.
+// #define FIR_DECIMATOR_TEST_RUN
+
+// Leave uncommented to check and time the sort-free hit decision.
+// #define HIT_DECISION_TEST_RUN
+
+// Leave uncommented to compare the vectorized IIR bank with filter.c.
+// #define IIR_BANK_TEST_RUN
+
+// Leave uncommented to compare the biquad-cascade IIR filters with filter.c.
+// #define IIR_SOS_TEST_RUN
+
+// Leave uncommented to check the ISR budget monitor on synthetic ticks.
+// #define ISR_MONITOR_TEST_RUN
+
+// Leave uncommented to run the 10^8-sample power computation soak test.
+// #define POWER_SOAK_TEST_RUN
+
+// Leave uncommented to check the cycle-counter profiler percentiles.
+// #define PROFILER_TEST_RUN
+
 // Leave uncommented to run the queue test.
 // #define QUEUE_TEST_RUN
 
+// Leave uncommented to check the polyphase resampler on sines.
+// #define RESAMPLER_TEST_RUN
+
+// Leave uncommented to run the ring buffer test.
+// #define RING_BUFFER_TEST_RUN
+
+// Leave uncommented to compare the sliding DFT with Goertzel and sine inputs.
+// #define SLIDING_DFT_TEST_RUN
+
 // Leave uncommented to run the sound test.
 // #define SOUND_TEST_RUN
 
-// Leave uncommented to simply dump raw ADC values to the console.
-// #define JUST_DUMP_RAW_ADC_VALUES
+// Leave uncommented to check the sound mixer (mixing, saturation, stealing).
+// #define SOUND_MIXER_TEST_RUN
+
+// Leave uncommented to run the tick scheduler test.
+// #define TICK_SCHEDULER_TEST_RUN
+
+// Leave uncommented to capture raw ADC values and send them over the UART.
+// #define CAPTURE_RAW_ADC_VALUES
 
 // Leave uncommented to run two-player mode.
 // #define RUNNING_MODES_TWO_TEAMS
@@ -37,13 +85,28 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #ifdef LASER_TAG_MAIN
 
+#include "adcBuffer.h"
+#include "adcTrace.h"
+#include "adpcm.h"
 #include "detector.h"
 #include "drivers/buttons.h"
 #include "filter.h"
+#include "filterFixed.h"
 #include "filterTest.h"
+#include "firDecimator.h"
 #include "gameModes.h"
+#include "hitDecision.h"
+#include "iirBank.h"
+#include "iirSos.h"
+#include "isrMonitor.h"
+#include "profiler.h"
+#include "resampler.h"
+#include "ringBuffer.h"
 #include "runningModes.h"
+#include "slidingDft.h"
 #include "sound.h"
+#include "soundMixer.h"
+#include "tickScheduler.h"
 #include <assert.h>
 #include <stdio.h>
 
@@ -55,14 +118,82 @@ int main() {
   queue_runTest();
 #endif
 
+#ifdef RING_BUFFER_TEST_RUN
+  ringBuffer_runTest();
+#endif
+
+#ifdef ADC_BUFFER_TEST_RUN
+  adcBuffer_runTest();
+#endif
+
+#ifdef ADC_TRACE_TEST_RUN
+  adcTrace_runTest();
+#endif
+
+#ifdef ADPCM_TEST_RUN
+  adpcm_runTest();
+#endif
+
 #ifdef FILTER_TEST_RUN
   filterTest_runTest();
 #endif
 
+#ifdef POWER_SOAK_TEST_RUN
+  filterTest_runPowerSoakTest();
+#endif
+
+#ifdef FILTER_FIXED_TEST_RUN
+  filterFixed_runTest();
+#endif
+
+#ifdef FIR_DECIMATOR_TEST_RUN
+  firDecimator_runTest();
+#endif
+
+#ifdef HIT_DECISION_TEST_RUN
+  hitDecision_runTest();
+#endif
+
+#ifdef IIR_BANK_TEST_RUN
+  iirBank_runTest();
+#endif
+
+#ifdef IIR_SOS_TEST_RUN
+  iirSos_runTest();
+#endif
+
+#ifdef ISR_MONITOR_TEST_RUN
+  isrMonitor_runTest();
+#endif
+
+#ifdef PROFILER_TEST_RUN
+  profiler_runTest();
+#endif
+
+#ifdef RESAMPLER_TEST_RUN
+  resampler_runTest();
+#endif
+
+#ifdef SLIDING_DFT_TEST_RUN
+  slidingDft_runTest();
+#endif
+
 #ifdef SOUND_TEST_RUN
   sound_runTest();
 #endif
 
+#ifdef SOUND_MIXER_TEST_RUN
+  soundMixer_runTest();
+#endif
+
+#ifdef TICK_SCHEDULER_TEST_RUN
+  tickScheduler_runTest();
+#endif
+
+#ifdef CAPTURE_RAW_ADC_VALUES
+  runningModes_captureRawAdcValues();
+#endif
+
 #ifdef RUNNING_MODES_TWO_TEAMS
   gameModes_twoTeams();
 #endif
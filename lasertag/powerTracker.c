@@ -0,0 +1,118 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "powerTracker.h"
+#include <math.h>
+#include <stdio.h>
+
+static powerTracker_sum_t sumOfSquares[FILTER_FREQUENCY_COUNT];
+// Square of the oldest output in the queue at the last call, subtracted when
+// it leaves.
+static powerTracker_sum_t oldestSquare[FILTER_FREQUENCY_COUNT];
+static double currentPowerValue[FILTER_FREQUENCY_COUNT];
+
+// Rounds an output to fixed point and returns its (exact) square.
+static powerTracker_sum_t powerTracker_square(double value) {
+  if (value > POWER_TRACKER_MAX_MAGNITUDE)
+    value = POWER_TRACKER_MAX_MAGNITUDE;
+  else if (value < -POWER_TRACKER_MAX_MAGNITUDE)
+    value = -POWER_TRACKER_MAX_MAGNITUDE;
+  int32_t fixed = (int32_t)lround(ldexp(value, POWER_TRACKER_FRACTION_BITS));
+  return (powerTracker_sum_t)fixed * fixed;
+}
+
+// Clears the running sums.
+void powerTracker_init() {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    sumOfSquares[i] = 0;
+    oldestSquare[i] = 0;
+    currentPowerValue[i] = 0.0;
+  }
+}
+
+// Computes the power of the outputs of IIR filter [filterNumber].
+double powerTracker_computePower(uint16_t filterNumber,
+                                 bool forceComputeFromScratch,
+                                 bool debugPrint) {
+  queue_t *q = filter_getIirOutputQueue(filterNumber);
+  queue_size_t elementCount = queue_elementCount(q);
+  if (forceComputeFromScratch) {
+    powerTracker_sum_t sum = 0;
+    for (queue_size_t i = 0; i < elementCount; i++)
+      sum += powerTracker_square(queue_readElementAt(q, i));
+    sumOfSquares[filterNumber] = sum;
+  } else {
+    sumOfSquares[filterNumber] +=
+        powerTracker_square(queue_readElementAt(q, elementCount - 1)) -
+        oldestSquare[filterNumber];
+  }
+  oldestSquare[filterNumber] = powerTracker_square(queue_readElementAt(q, 0));
+  currentPowerValue[filterNumber] = ldexp(
+      (double)sumOfSquares[filterNumber], -2 * POWER_TRACKER_FRACTION_BITS);
+  if (debugPrint)
+    printf("powerTracker_computePower(%d): %le\n\r", filterNumber,
+           currentPowerValue[filterNumber]);
+  return currentPowerValue[filterNumber];
+}
+
+// Returns the running sum of squares for filterNumber.
+powerTracker_sum_t powerTracker_getSumOfSquares(uint16_t filterNumber) {
+  return sumOfSquares[filterNumber];
+}
+
+// Returns the last power value computed for filterNumber.
+double powerTracker_getCurrentPowerValue(uint16_t filterNumber) {
+  return currentPowerValue[filterNumber];
+}
+
+// Copies the last computed power values.
+void powerTracker_getCurrentPowerValues(double powerValues[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = currentPowerValue[i];
+}
+
+// Sets up a window of fixed-point samples, filled with zeros.
+bool powerTracker_initWindow(powerTracker_window_t *window, int32_t storage[],
+                             uint32_t capacity, uint32_t windowSize) {
+  if (capacity <= windowSize) {
+    printf("powerTracker_initWindow(): capacity %ld is not larger than the "
+           "window (%ld).\n\r",
+           (long)capacity, (long)windowSize);
+    return false;
+  }
+  if (!ringBuffer_int32_init(&window->samples, storage, capacity))
+    return false;
+  ringBuffer_int32_fill(&window->samples, 0);
+  window->windowSize = windowSize;
+  window->sumOfSquares = 0;
+  return true;
+}
+
+// Adds the newest square and drops the one that left the window. The sample
+// that left is the one windowSize pushes old.
+powerTracker_sum_t powerTracker_pushSample(powerTracker_window_t *window,
+                                           int32_t sample) {
+  ringBuffer_int32_overwritePushFast(&window->samples, sample);
+  int32_t oldest =
+      ringBuffer_int32_readNewestFast(&window->samples, window->windowSize);
+  window->sumOfSquares += (powerTracker_sum_t)sample * sample -
+                          (powerTracker_sum_t)oldest * oldest;
+  return window->sumOfSquares;
+}
+
+// Sums the squares of the samples in the window.
+powerTracker_sum_t powerTracker_rescanWindow(powerTracker_window_t *window) {
+  powerTracker_sum_t sum = 0;
+  for (uint32_t i = 0; i < window->windowSize; i++) {
+    int32_t value = ringBuffer_int32_readNewestFast(&window->samples, i);
+    sum += (powerTracker_sum_t)value * value;
+  }
+  window->sumOfSquares = sum;
+  return sum;
+}
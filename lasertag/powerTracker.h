@@ -0,0 +1,89 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef POWERTRACKER_H_
+#define POWERTRACKER_H_
+
+#include "filter.h"
+#include "ringBuffer.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Drop-in replacement for filter_computePower() that never drifts.
+//
+// The incremental path of filter_computePower() adds the newest square and
+// subtracts the oldest one from a running double. Each update rounds, so over
+// hours of play the running sum wanders away from the true sum of squares and
+// has to be recomputed from scratch now and then. Here every IIR output is
+// rounded to a fixed-point integer with POWER_TRACKER_FRACTION_BITS fractional
+// bits before it is squared, and the running sum is an int64_t. Adding and
+// subtracting integer squares is exact, so the incremental sum is always
+// bit-for-bit equal to a from-scratch sum of the same window and the O(window)
+// rescan is only needed once, at startup.
+//
+// Outputs are clamped to +/- POWER_TRACKER_MAX_MAGNITUDE so that a full
+// window of squares fits in the accumulator.
+//
+// Engines that already have fixed-point outputs (filterFixed.c) keep them in a
+// powerTracker_window_t, which does the same exact update on their samples.
+// Define DETECTOR_USE_POWER_TRACKER (see detector.h) to have
+// detector_processAvailable() use powerTracker_computePower() in place of
+// filter_computePower().
+
+typedef int64_t powerTracker_sum_t; // Sum of squares, in integer units.
+
+#define POWER_TRACKER_FRACTION_BITS 20 // Resolution of 2^-20 per output.
+#define POWER_TRACKER_MAX_MAGNITUDE                                            \
+  64.0 // Outputs are clamped to this, 2000 * (64 * 2^20)^2 < 2^63.
+
+// Exact running sum of squares of the last windowSize samples pushed into
+// it. The caller provides the sample storage.
+typedef struct {
+  ringBuffer_int32_t samples;
+  uint32_t windowSize;
+  powerTracker_sum_t sumOfSquares;
+} powerTracker_window_t;
+
+// Clears the running sums. Call after filter_init().
+void powerTracker_init();
+
+// Same contract as filter_computePower(): computes the power of the outputs
+// in filter_getIirOutputQueue(filterNumber). If forceComputeFromScratch is
+// true the whole queue is summed, otherwise the newest output is added and the
+// output that left the queue since the last call is subtracted, so call this
+// once per filter_iirFilter(). Prints the result if debugPrint is true.
+double powerTracker_computePower(uint16_t filterNumber,
+                                 bool forceComputeFromScratch, bool debugPrint);
+
+// Returns the running sum of squares for filterNumber, in units of
+// 2^(-2 * POWER_TRACKER_FRACTION_BITS).
+powerTracker_sum_t powerTracker_getSumOfSquares(uint16_t filterNumber);
+
+// Returns the last power value computed for filterNumber.
+double powerTracker_getCurrentPowerValue(uint16_t filterNumber);
+
+// Copies the last computed power values into powerValues[], like
+// filter_getCurrentPowerValues().
+void powerTracker_getCurrentPowerValues(double powerValues[]);
+
+// Sets up window to keep its samples in storage[0..capacity-1] and fills it
+// with zeros. capacity must be a power of two larger than windowSize. Returns
+// false (and prints an error) otherwise.
+bool powerTracker_initWindow(powerTracker_window_t *window, int32_t storage[],
+                             uint32_t capacity, uint32_t windowSize);
+
+// Pushes sample into window, adds its square to the running sum and subtracts
+// the square of the sample that left the window. Returns the new sum.
+powerTracker_sum_t powerTracker_pushSample(powerTracker_window_t *window,
+                                           int32_t sample);
+
+// Recomputes the running sum of window from its samples and returns it.
+powerTracker_sum_t powerTracker_rescanWindow(powerTracker_window_t *window);
+
+#endif /* POWERTRACKER_H_ */
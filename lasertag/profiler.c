@@ -0,0 +1,233 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+#ifdef ZYBO_BOARD
+#include "xpseudo_asm.h"
+#include "xreg_cortexa9.h"
+#else
+#include <time.h>
+#endif
+
+#define PMCR_ENABLE 0x1 // Enables all counters.
+#define PMCR_CYCLE_COUNTER_RESET 0x4 // Clears the cycle counter.
+#define PMCNTENSET_CYCLE_COUNTER 0x80000000 // Enables the cycle counter.
+#define EXACT_BUCKET_COUNT 16 // Cycle counts below this get their own bucket.
+#define SUB_BUCKET_BITS 3 // 8 buckets per power of two above that.
+#define OVERHEAD_CALIBRATION_COUNT 1000 // Empty scopes timed by init.
+#define PERCENTILE 0.99
+
+typedef struct {
+  uint32_t startCycles;
+  uint32_t count;
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  uint64_t totalCycles;
+  uint32_t buckets[PROFILER_BUCKET_COUNT];
+} profiler_scopeData_t;
+
+static const char *scopeNames[PROFILER_SCOPE_COUNT] = {"isr", "fir", "iir",
+                                                       "power", "sort"};
+static profiler_scopeData_t scopes[PROFILER_SCOPE_COUNT];
+static uint32_t overheadCycles; // Cost of an empty start/stop pair.
+
+// Enables and clears the cycle counter (no divider, counts every CPU cycle).
+void profiler_init() {
+#ifdef ZYBO_BOARD
+  mtcp(XREG_CP15_PERF_MONITOR_CTRL, PMCR_ENABLE | PMCR_CYCLE_COUNTER_RESET);
+  mtcp(XREG_CP15_COUNT_ENABLE_SET, PMCNTENSET_CYCLE_COUNTER);
+#endif
+  overheadCycles = 0;
+  profiler_reset();
+  // The smallest empty scope is the probe overhead.
+  for (uint32_t i = 0; i < OVERHEAD_CALIBRATION_COUNT; i++) {
+    profiler_start(PROFILER_SCOPE_ISR);
+    profiler_stop(PROFILER_SCOPE_ISR);
+  }
+  overheadCycles = scopes[PROFILER_SCOPE_ISR].minCycles;
+  profiler_reset();
+}
+
+// Clears every scope.
+void profiler_reset() {
+  memset(scopes, 0, sizeof(scopes));
+  for (uint16_t i = 0; i < PROFILER_SCOPE_COUNT; i++)
+    scopes[i].minCycles = UINT32_MAX;
+}
+
+// Reads PMCCNTR, or the monotonic clock in CPU cycles.
+uint32_t profiler_getCycles() {
+#ifdef ZYBO_BOARD
+  return mfcp(XREG_CP15_PERF_CYCLE_COUNTER);
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  uint64_t nanoseconds = (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+  return nanoseconds * (PROFILER_CPU_CLOCK_HZ / 1000000) / 1000;
+#endif
+}
+
+void profiler_start(profiler_scope_t scope) {
+  scopes[scope].startCycles = profiler_getCycles();
+}
+
+void profiler_stop(profiler_scope_t scope) {
+  uint32_t cycles = profiler_getCycles() - scopes[scope].startCycles;
+  profiler_record(scope, cycles > overheadCycles ? cycles - overheadCycles : 0);
+}
+
+// Cycle counts below EXACT_BUCKET_COUNT map to themselves. Above that, the
+// bucket is the position of the leading one and the SUB_BUCKET_BITS below it.
+static uint16_t profiler_getBucket(uint32_t cycles) {
+  if (cycles < EXACT_BUCKET_COUNT)
+    return cycles;
+  uint16_t msb = 31 - __builtin_clz(cycles);
+  uint16_t subBucket =
+      (cycles >> (msb - SUB_BUCKET_BITS)) & ((1 << SUB_BUCKET_BITS) - 1);
+  return EXACT_BUCKET_COUNT +
+         ((msb - (SUB_BUCKET_BITS + 1)) << SUB_BUCKET_BITS) + subBucket;
+}
+
+// Largest cycle count that maps to bucket.
+static uint32_t profiler_getBucketUpperEdge(uint16_t bucket) {
+  if (bucket < EXACT_BUCKET_COUNT)
+    return bucket;
+  uint16_t octave = (bucket - EXACT_BUCKET_COUNT) >> SUB_BUCKET_BITS;
+  uint16_t subBucket =
+      (bucket - EXACT_BUCKET_COUNT) & ((1 << SUB_BUCKET_BITS) - 1);
+  uint16_t shift = octave + 1; // Width of a sub-bucket is 2^shift.
+  uint64_t lower = (uint64_t)((1 << SUB_BUCKET_BITS) + subBucket) << shift;
+  return lower + (1ULL << shift) - 1;
+}
+
+void profiler_record(profiler_scope_t scope, uint32_t cycles) {
+  profiler_scopeData_t *data = &scopes[scope];
+  data->count++;
+  data->totalCycles += cycles;
+  if (cycles < data->minCycles)
+    data->minCycles = cycles;
+  if (cycles > data->maxCycles)
+    data->maxCycles = cycles;
+  data->buckets[profiler_getBucket(cycles)]++;
+}
+
+const char *profiler_getScopeName(profiler_scope_t scope) {
+  return scopeNames[scope];
+}
+
+// Walks the histogram up to the bucket that holds the 99th percentile.
+void profiler_getStatistics(profiler_scope_t scope,
+                            profiler_statistics_t *statistics) {
+  const profiler_scopeData_t *data = &scopes[scope];
+  memset(statistics, 0, sizeof(*statistics));
+  if (data->count == 0)
+    return;
+  statistics->count = data->count;
+  statistics->minCycles = data->minCycles;
+  statistics->maxCycles = data->maxCycles;
+  statistics->meanCycles = (double)data->totalCycles / data->count;
+  uint32_t rank = (uint32_t)(PERCENTILE * (data->count - 1)) + 1;
+  uint32_t seen = 0;
+  for (uint16_t i = 0; i < PROFILER_BUCKET_COUNT; i++) {
+    seen += data->buckets[i];
+    if (seen >= rank) {
+      uint32_t upperEdge = profiler_getBucketUpperEdge(i);
+      statistics->p99Cycles =
+          upperEdge < data->maxCycles ? upperEdge : data->maxCycles;
+      break;
+    }
+  }
+}
+
+double profiler_cyclesToMicros(double cycles) {
+  return cycles * 1.0E6 / PROFILER_CPU_CLOCK_HZ;
+}
+
+// One line per scope that has been recorded.
+void profiler_printStatistics() {
+  printf("%-6s %10s %9s %9s %9s %9s (us)\n\r", "scope", "count", "min",
+         "mean", "max", "p99");
+  for (uint16_t i = 0; i < PROFILER_SCOPE_COUNT; i++) {
+    profiler_statistics_t statistics;
+    profiler_getStatistics(i, &statistics);
+    if (statistics.count == 0)
+      continue;
+    printf("%-6s %10lu %9.3lf %9.3lf %9.3lf %9.3lf\n\r", scopeNames[i],
+           (unsigned long)statistics.count,
+           profiler_cyclesToMicros(statistics.minCycles),
+           profiler_cyclesToMicros(statistics.meanCycles),
+           profiler_cyclesToMicros(statistics.maxCycles),
+           profiler_cyclesToMicros(statistics.p99Cycles));
+  }
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_SAMPLE_COUNT 1000 // Cycle counts recorded per distribution.
+#define TEST_SPIKE_CYCLES 100000 // The slow 2% in the second distribution.
+#define TEST_RESOLUTION (1.0 / (1 << SUB_BUCKET_BITS)) // Relative bucket width.
+
+// Checks that p99 is within one bucket above expected.
+static bool profiler_testPercentile(uint32_t expected) {
+  profiler_statistics_t statistics;
+  profiler_getStatistics(PROFILER_SCOPE_ISR, &statistics);
+  if (statistics.p99Cycles < expected ||
+      statistics.p99Cycles > expected * (1.0 + TEST_RESOLUTION)) {
+    printf("profiler_runTest: p99 is %lu cycles, expected %lu.\n\r",
+           (unsigned long)statistics.p99Cycles, (unsigned long)expected);
+    return false;
+  }
+  return true;
+}
+
+// Records a ramp and a mostly fast distribution with 2% spikes, checks their
+// 99th percentiles and the bucket edges, then times an empty scope.
+bool profiler_runTest() {
+  printf("******** profiler_runTest() **********\n\r");
+  bool success = true;
+  for (uint32_t cycles = 1; cycles != 0; cycles <<= 1) {
+    for (uint32_t c = cycles; c < cycles + 3 && c != 0; c++) {
+      uint16_t bucket = profiler_getBucket(c);
+      if (bucket >= PROFILER_BUCKET_COUNT ||
+          profiler_getBucketUpperEdge(bucket) < c ||
+          (bucket > 0 && profiler_getBucketUpperEdge(bucket - 1) >= c)) {
+        printf("profiler_runTest: %lu cycles in bucket %d.\n\r",
+               (unsigned long)c, bucket);
+        success = false;
+      }
+    }
+  }
+  profiler_init();
+  for (uint32_t i = 1; i <= TEST_SAMPLE_COUNT; i++)
+    profiler_record(PROFILER_SCOPE_ISR, i * 10);
+  success &= profiler_testPercentile(TEST_SAMPLE_COUNT * 10 * PERCENTILE);
+  profiler_reset();
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    profiler_record(PROFILER_SCOPE_ISR,
+                    (i % 50 == 0) ? TEST_SPIKE_CYCLES : 1000);
+  success &= profiler_testPercentile(TEST_SPIKE_CYCLES);
+  profiler_reset();
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++) {
+    profiler_start(PROFILER_SCOPE_ISR);
+    profiler_stop(PROFILER_SCOPE_ISR);
+  }
+  printf("profiler_runTest: probe overhead %lu cycles, empty scope after "
+         "correction:\n\r",
+         (unsigned long)overheadCycles);
+  profiler_printStatistics();
+  profiler_reset();
+  printf("profiler_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
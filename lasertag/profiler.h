@@ -0,0 +1,90 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Cycle-accurate timing of the hot paths. Each scope is bracketed with
+// profiler_start() and profiler_stop(), like an interval timer, but the time
+// comes from the Cortex-A9 PMU cycle counter (PMCCNTR, enabled in
+// profiler_init()), which costs a single coprocessor read instead of two AXI
+// bus reads. Every start/stop pair is recorded individually: min, mean, max
+// and a log-linear histogram (8 buckets per power of two, so about 12%
+// resolution) that gives the 99th percentile.
+//
+// The emulator and host builds (no ZYBO_BOARD) use clock_gettime() scaled to
+// PROFILER_CPU_CLOCK_HZ instead of the PMU.
+//
+// The cycle counter is 32 bits and wraps every 6.6 s, so a single scope must
+// be shorter than that. Scopes do not nest with themselves, but different
+// scopes can overlap, and the ISR scope can interrupt any other.
+
+#define PROFILER_CPU_CLOCK_HZ 650000000 // Zybo Cortex-A9 clock, PMU counts it.
+#define PROFILER_BUCKET_COUNT 240 // Histogram buckets for 32-bit cycle counts.
+
+// Probe scopes. Add new ones before PROFILER_SCOPE_COUNT and give them a name
+// in profiler.c.
+typedef enum {
+  PROFILER_SCOPE_ISR,   // isr_function(), one 10 us tick.
+  PROFILER_SCOPE_FIR,   // Decimating FIR, one block of ADC samples.
+  PROFILER_SCOPE_IIR,   // All IIR filters, one decimated sample.
+  PROFILER_SCOPE_POWER, // All power computations, one decimated sample.
+  PROFILER_SCOPE_SORT,  // detector_runHitDetection() (sort and hit decision).
+  PROFILER_SCOPE_COUNT
+} profiler_scope_t;
+
+typedef struct {
+  uint32_t count;    // Recorded start/stop pairs.
+  uint32_t minCycles;
+  uint32_t maxCycles;
+  double meanCycles;
+  uint32_t p99Cycles; // Upper edge of the bucket holding the 99th percentile.
+} profiler_statistics_t;
+
+// Enables the PMU cycle counter, measures the probe overhead and clears all
+// scopes.
+void profiler_init();
+
+// Clears the statistics of every scope.
+void profiler_reset();
+
+// Returns the current cycle count.
+uint32_t profiler_getCycles();
+
+// Marks the start of scope.
+void profiler_start(profiler_scope_t scope);
+
+// Records the cycles since profiler_start(scope), less the probe overhead.
+void profiler_stop(profiler_scope_t scope);
+
+// Records cycles for scope directly, e.g., for a duration measured elsewhere.
+void profiler_record(profiler_scope_t scope, uint32_t cycles);
+
+// Returns the name of scope.
+const char *profiler_getScopeName(profiler_scope_t scope);
+
+// Fills statistics for scope. count is 0 if nothing has been recorded.
+void profiler_getStatistics(profiler_scope_t scope,
+                            profiler_statistics_t *statistics);
+
+// Converts cycles to microseconds.
+double profiler_cyclesToMicros(double cycles);
+
+// Prints a table of every scope (min/mean/max/p99 in microseconds) to the
+// UART.
+void profiler_printStatistics();
+
+// Checks the percentile computation on known distributions and reports the
+// probe overhead. Returns true if the percentiles are right.
+bool profiler_runTest();
+
+#endif /* PROFILER_H_ */
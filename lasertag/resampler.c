@@ -0,0 +1,186 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "resampler.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define POSITION_ONE (1 << RESAMPLER_POSITION_BITS) // 1.0 in Q16.
+#define POSITION_MASK (POSITION_ONE - 1)
+#define PHASE_SHIFT (RESAMPLER_POSITION_BITS - RESAMPLER_PHASE_BITS)
+#define CENTER_TAP (RESAMPLER_TAP_COUNT / 2 - 1) // Output follows this tap.
+#define MAX_RATIO 4 // 16 taps are too short for a sharper cutoff.
+#define CUTOFF 0.9 // Of the lower Nyquist rate.
+#define Q15_ONE 32768.0
+
+// sin(pi x) / (pi x).
+static double resampler_sinc(double x) {
+  return x == 0.0 ? 1.0 : sin(M_PI * x) / (M_PI * x);
+}
+
+// Blackman window over -RESAMPLER_TAP_COUNT / 2 to RESAMPLER_TAP_COUNT / 2.
+static double resampler_window(double x) {
+  double angle = M_PI * x / (RESAMPLER_TAP_COUNT / 2);
+  return 0.42 + 0.5 * cos(angle) + 0.08 * cos(2.0 * angle);
+}
+
+// Phase p is designed for the middle of the positions that select it, p + 0.5
+// phases past the center tap, so truncating the position is unbiased. Every
+// phase is normalized to unity gain at DC.
+bool resampler_initFilter(resampler_filter_t *filter, uint32_t inputRate,
+                          uint32_t outputRate) {
+  if (inputRate == 0 || outputRate == 0 ||
+      inputRate > MAX_RATIO * outputRate || outputRate > MAX_RATIO * inputRate)
+    return false;
+  filter->inputRate = inputRate;
+  filter->outputRate = outputRate;
+  filter->step = ((uint64_t)inputRate << RESAMPLER_POSITION_BITS) / outputRate;
+  double cutoff =
+      CUTOFF * (outputRate < inputRate ? (double)outputRate / inputRate : 1.0);
+  for (uint16_t phase = 0; phase < RESAMPLER_PHASE_COUNT; phase++) {
+    double taps[RESAMPLER_TAP_COUNT];
+    double sum = 0.0;
+    double fraction = (phase + 0.5) / RESAMPLER_PHASE_COUNT;
+    for (uint16_t k = 0; k < RESAMPLER_TAP_COUNT; k++) {
+      double distance = (double)k - CENTER_TAP - fraction;
+      taps[k] = resampler_sinc(cutoff * distance) * resampler_window(distance);
+      sum += taps[k];
+    }
+    for (uint16_t k = 0; k < RESAMPLER_TAP_COUNT; k++) {
+      double tap = round(taps[k] / sum * Q15_ONE);
+      filter->taps[phase][k] = tap > INT16_MAX ? INT16_MAX : tap;
+    }
+  }
+  return true;
+}
+
+// The first output needs one input sample, it lands RESAMPLER_TAP_COUNT / 2
+// samples before it.
+void resampler_init(resampler_t *resampler, const resampler_filter_t *filter) {
+  resampler->filter = filter;
+  resampler->position = POSITION_ONE;
+  resampler->newest = 0;
+  memset(resampler->history, 0, sizeof(resampler->history));
+}
+
+// Writing every sample twice, RESAMPLER_TAP_COUNT apart, keeps the last
+// RESAMPLER_TAP_COUNT samples contiguous from &history[newest + 1].
+uint32_t resampler_process(resampler_t *resampler, const int16_t input[],
+                           uint32_t inputCount, uint32_t *consumedCount,
+                           int16_t output[], uint32_t outputCount) {
+  const resampler_filter_t *filter = resampler->filter;
+  uint32_t position = resampler->position;
+  uint16_t newest = resampler->newest;
+  int16_t *history = resampler->history;
+  uint32_t consumed = 0, produced = 0;
+  while (produced < outputCount) {
+    while (position >= POSITION_ONE && consumed < inputCount) {
+      newest = (newest + 1) % RESAMPLER_TAP_COUNT;
+      history[newest] = history[newest + RESAMPLER_TAP_COUNT] =
+          input[consumed++];
+      position -= POSITION_ONE;
+    }
+    if (position >= POSITION_ONE)
+      break; // Out of input.
+    const int16_t *window = &history[newest + 1];
+    const int16_t *taps =
+        filter->taps[(position & POSITION_MASK) >> PHASE_SHIFT];
+    int32_t sum = 0; // At most about 1.3 * 2^30 with these taps.
+    for (uint16_t k = 0; k < RESAMPLER_TAP_COUNT; k++)
+      sum += window[k] * taps[k];
+    sum = (sum + (1 << 14)) >> 15;
+    output[produced++] =
+        sum > INT16_MAX ? INT16_MAX : (sum < INT16_MIN ? INT16_MIN : sum);
+    position += filter->step;
+  }
+  resampler->position = position;
+  resampler->newest = newest;
+  *consumedCount = consumed;
+  return produced;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_INPUT_COUNT 4800 // 0.1 s at 48 kHz.
+#define TEST_OUTPUT_SIZE (MAX_RATIO * TEST_INPUT_COUNT)
+#define TEST_CHUNK 100 // Input is fed in pieces, like the mixer does.
+#define TEST_FREQUENCY 1000.0
+#define TEST_AMPLITUDE 16000.0
+#define TEST_MIN_SNR_DB 40.0
+#define TEST_CASE_COUNT 4
+
+// Converts a sine from inputRate to outputRate and returns the SNR in dB
+// against the ideal sine at the output rate, or 0 if the output has the wrong
+// length.
+static double resampler_testSnr(uint32_t inputRate, uint32_t outputRate) {
+  static resampler_filter_t filter;
+  static int16_t input[TEST_INPUT_COUNT], output[TEST_OUTPUT_SIZE];
+  resampler_t resampler;
+  if (!resampler_initFilter(&filter, inputRate, outputRate))
+    return 0.0;
+  resampler_init(&resampler, &filter);
+  for (uint32_t i = 0; i < TEST_INPUT_COUNT; i++)
+    input[i] =
+        TEST_AMPLITUDE * sin(2.0 * M_PI * TEST_FREQUENCY * i / inputRate);
+  uint32_t inputPosition = 0, outputCount = 0;
+  while (inputPosition < TEST_INPUT_COUNT) {
+    uint32_t consumed, chunk = TEST_INPUT_COUNT - inputPosition;
+    chunk = chunk < TEST_CHUNK ? chunk : TEST_CHUNK;
+    outputCount += resampler_process(&resampler, &input[inputPosition], chunk,
+                                     &consumed, &output[outputCount],
+                                     TEST_OUTPUT_SIZE - outputCount);
+    inputPosition += consumed;
+  }
+  // One output per step of input, until the input runs out.
+  uint32_t expectedCount =
+      (((uint64_t)TEST_INPUT_COUNT << RESAMPLER_POSITION_BITS) + filter.step -
+       1) /
+      filter.step;
+  if (outputCount != expectedCount) {
+    printf("resampler_runTest: %lu to %lu Hz gave %lu samples, expected "
+           "%lu.\n\r",
+           (unsigned long)inputRate, (unsigned long)outputRate,
+           (unsigned long)outputCount, (unsigned long)expectedCount);
+    return 0.0;
+  }
+  // Skip the outputs that see the silence before the sine.
+  double signal = 0.0, noise = 0.0;
+  for (uint32_t j = 0; j < outputCount; j++) {
+    double time = (double)j * filter.step / POSITION_ONE - CENTER_TAP - 1;
+    if (time < RESAMPLER_TAP_COUNT / 2)
+      continue;
+    double expected =
+        TEST_AMPLITUDE * sin(2.0 * M_PI * TEST_FREQUENCY * time / inputRate);
+    signal += expected * expected;
+    noise += (output[j] - expected) * (output[j] - expected);
+  }
+  return 10.0 * log10(signal / noise);
+}
+
+bool resampler_runTest() {
+  printf("******** resampler_runTest() **********\n\r");
+  const uint32_t rates[TEST_CASE_COUNT][2] = {
+      {48000, 32000}, {48000, 16000}, {22050, 48000}, {32000, 48000}};
+  bool success = true;
+  for (uint16_t i = 0; i < TEST_CASE_COUNT; i++) {
+    double snr = resampler_testSnr(rates[i][0], rates[i][1]);
+    printf("resampler_runTest: %lu to %lu Hz, SNR %.1lf dB.\n\r",
+           (unsigned long)rates[i][0], (unsigned long)rates[i][1], snr);
+    success &= snr >= TEST_MIN_SNR_DB;
+  }
+  resampler_filter_t filter;
+  success &= !resampler_initFilter(&filter, 48000, 0);
+  success &= !resampler_initFilter(&filter, 48000, 2000);
+  printf("resampler_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -0,0 +1,70 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef RESAMPLER_H_
+#define RESAMPLER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Fixed-point polyphase resampler, so a sound plays at the codec rate whatever
+// rate it was recorded at.
+// - A filter holds RESAMPLER_PHASE_COUNT windowed-sinc FIRs of
+//   RESAMPLER_TAP_COUNT Q15 taps, one per fractional position between two
+//   input samples. The cutoff is just below the lower of the two Nyquist
+//   rates, so downsampling does not alias. resampler_initFilter() designs it
+//   in floating point; call it outside the ISR.
+// - The position in the input is Q16 and advances by inputRate / outputRate
+//   per output sample. Each output is one RESAMPLER_TAP_COUNT-tap dot product
+//   with the phase that the fractional position falls in.
+// - The input comes in pieces: resampler_process() takes what it needs and
+//   remembers the last RESAMPLER_TAP_COUNT samples. The output lags the input
+//   by RESAMPLER_TAP_COUNT / 2 input samples.
+
+#define RESAMPLER_TAP_COUNT 16
+#define RESAMPLER_PHASE_BITS 5
+#define RESAMPLER_PHASE_COUNT (1 << RESAMPLER_PHASE_BITS)
+#define RESAMPLER_POSITION_BITS 16 // Fractional bits of the input position.
+
+// Taps and step for one input rate to output rate conversion.
+typedef struct {
+  uint32_t inputRate;
+  uint32_t outputRate;
+  uint32_t step; // Input samples per output sample, Q16.
+  int16_t taps[RESAMPLER_PHASE_COUNT][RESAMPLER_TAP_COUNT]; // Q15.
+} resampler_filter_t;
+
+// Conversion state of one stream.
+typedef struct {
+  const resampler_filter_t *filter;
+  uint32_t position; // Q16 input position of the next output.
+  uint16_t newest;   // Index of the newest sample in history.
+  int16_t history[2 * RESAMPLER_TAP_COUNT]; // Each sample is stored twice.
+} resampler_t;
+
+// Designs the filter that converts inputRate to outputRate. Returns false if
+// either rate is 0 or the ratio is outside 1/4 to 4.
+bool resampler_initFilter(resampler_filter_t *filter, uint32_t inputRate,
+                          uint32_t outputRate);
+
+// Starts a stream through filter, with silence before its first sample.
+void resampler_init(resampler_t *resampler, const resampler_filter_t *filter);
+
+// Converts input[] into up to outputCount samples in output[]. Sets
+// *consumedCount to the number of input samples used and returns the number
+// of output samples written; it stops early when it runs out of input.
+uint32_t resampler_process(resampler_t *resampler, const int16_t input[],
+                           uint32_t inputCount, uint32_t *consumedCount,
+                           int16_t output[], uint32_t outputCount);
+
+// Converts sines between the codec rates and checks the SNR and the number of
+// output samples. Returns true if they are good enough.
+bool resampler_runTest();
+
+#endif /* RESAMPLER_H_ */
@@ -0,0 +1,97 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "ringBuffer.h"
+#include <stdio.h>
+
+// Defines the checked functions declared by RINGBUFFER_DECLARE(). PRINT_TYPE
+// and FORMAT are used by print() (e.g. double and "%lf").
+#define RINGBUFFER_DEFINE(NAME, TYPE, PRINT_TYPE, FORMAT)                      \
+  bool NAME##_init(NAME##_t *q, TYPE *storage, ringBuffer_index_t capacity) {  \
+    if (capacity == 0 || (capacity & (capacity - 1)) != 0) {                   \
+      printf(#NAME "_init(): capacity %lu is not a power of two.\n\r",         \
+             (unsigned long)capacity);                                         \
+      return false;                                                            \
+    }                                                                          \
+    q->indexIn = 0;                                                            \
+    q->indexOut = 0;                                                           \
+    q->mask = capacity - 1;                                                    \
+    q->data = storage;                                                         \
+    q->underflowFlag = false;                                                  \
+    q->overflowFlag = false;                                                   \
+    return true;                                                               \
+  }                                                                            \
+                                                                               \
+  ringBuffer_index_t NAME##_size(const NAME##_t *q) { return q->mask + 1; }    \
+                                                                               \
+  ringBuffer_index_t NAME##_elementCount(const NAME##_t *q) {                  \
+    return q->indexIn - q->indexOut;                                           \
+  }                                                                            \
+                                                                               \
+  bool NAME##_full(const NAME##_t *q) {                                        \
+    return NAME##_elementCount(q) == NAME##_size(q);                           \
+  }                                                                            \
+                                                                               \
+  bool NAME##_empty(const NAME##_t *q) { return q->indexIn == q->indexOut; }   \
+                                                                               \
+  void NAME##_push(NAME##_t *q, TYPE value) {                                  \
+    if (NAME##_full(q)) {                                                      \
+      printf(#NAME "_push(): buffer is full.\n\r");                            \
+      q->overflowFlag = true;                                                  \
+      return;                                                                  \
+    }                                                                          \
+    NAME##_pushFast(q, value);                                                 \
+    q->underflowFlag = false;                                                  \
+  }                                                                            \
+                                                                               \
+  TYPE NAME##_pop(NAME##_t *q) {                                               \
+    if (NAME##_empty(q)) {                                                     \
+      printf(#NAME "_pop(): buffer is empty.\n\r");                            \
+      q->underflowFlag = true;                                                 \
+      return RINGBUFFER_RETURN_ERROR_VALUE;                                    \
+    }                                                                          \
+    q->overflowFlag = false;                                                   \
+    return NAME##_popFast(q);                                                  \
+  }                                                                            \
+                                                                               \
+  void NAME##_overwritePush(NAME##_t *q, TYPE value) {                         \
+    if (NAME##_full(q))                                                        \
+      NAME##_pop(q);                                                           \
+    NAME##_push(q, value);                                                     \
+  }                                                                            \
+                                                                               \
+  TYPE NAME##_readElementAt(const NAME##_t *q, ringBuffer_index_t index) {     \
+    if (index >= NAME##_elementCount(q)) {                                     \
+      printf(#NAME "_readElementAt(): index %lu is out of range (%lu "         \
+                   "elements).\n\r",                                           \
+             (unsigned long)index, (unsigned long)NAME##_elementCount(q));     \
+      return RINGBUFFER_RETURN_ERROR_VALUE;                                    \
+    }                                                                          \
+    return NAME##_readElementAtFast(q, index);                                 \
+  }                                                                            \
+                                                                               \
+  void NAME##_fill(NAME##_t *q, TYPE fillValue) {                              \
+    for (ringBuffer_index_t i = 0; i <= q->mask; i++)                          \
+      q->data[i] = fillValue;                                                  \
+    q->indexIn = q->indexOut + q->mask + 1;                                    \
+  }                                                                            \
+                                                                               \
+  bool NAME##_underflow(const NAME##_t *q) { return q->underflowFlag; }        \
+                                                                               \
+  bool NAME##_overflow(const NAME##_t *q) { return q->overflowFlag; }          \
+                                                                               \
+  void NAME##_print(const NAME##_t *q) {                                       \
+    for (ringBuffer_index_t i = 0; i < NAME##_elementCount(q); i++)            \
+      printf(FORMAT "\n\r", (PRINT_TYPE)NAME##_readElementAtFast(q, i));       \
+  }
+
+RINGBUFFER_DEFINE(ringBuffer_int16, int16_t, int, "%d")
+RINGBUFFER_DEFINE(ringBuffer_int32, int32_t, long, "%ld")
+RINGBUFFER_DEFINE(ringBuffer_float, float, double, "%lf")
+RINGBUFFER_DEFINE(ringBuffer_double, double, double, "%lf")
@@ -0,0 +1,124 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef RINGBUFFER_H_
+#define RINGBUFFER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Ring buffers for the sample path. Unlike queue_t (queue.h) these have a
+// compile-time element type, a power-of-two capacity and no name, and the
+// caller provides the storage (usually a static array), so nothing is
+// malloc'd.
+//
+// indexIn and indexOut are free-running counters: the element count is
+// indexIn - indexOut and an array slot is counter & mask, so there is no
+// modulo and no wasted slot (a buffer of capacity 2^n holds 2^n elements).
+//
+// Every element type gets two sets of functions:
+// - Checked functions with the same behavior as their queue_ counterparts
+//   (flags, error messages, QUEUE_RETURN_ERROR_VALUE-style return of 0). Use
+//   these in tests and anywhere speed does not matter.
+// - Unchecked "Fast" functions (static inline) for hot loops. They do no
+//   bounds checks and never print; the caller must guarantee the access is
+//   valid.
+//
+// Instances for int16_t, int32_t, float and double are declared below. For
+// example, the int16_t buffer is ringBuffer_int16_t and its functions are
+// ringBuffer_int16_push(), ringBuffer_int16_readNewestFast(), etc.
+
+#define RINGBUFFER_RETURN_ERROR_VALUE 0 // Returned by failed checked reads.
+
+// Big enough to address everything in the buffer.
+typedef uint32_t ringBuffer_index_t;
+
+// Declares the buffer type, the checked functions and the inline unchecked
+// functions for one element type. NAME is the prefix (e.g. ringBuffer_int16)
+// and TYPE is the element type.
+#define RINGBUFFER_DECLARE(NAME, TYPE)                                         \
+  typedef struct {                                                             \
+    /* Counts every push; data[indexIn & mask] is the next open slot. */       \
+    ringBuffer_index_t indexIn;                                                \
+    /* Counts every pop; data[indexOut & mask] is the oldest element. */       \
+    ringBuffer_index_t indexOut;                                               \
+    /* capacity - 1, capacity is a power of two. */                            \
+    ringBuffer_index_t mask;                                                   \
+    /* Caller-provided storage, capacity elements. */                          \
+    TYPE *data;                                                                \
+    /* Same meaning as in queue_t. */                                          \
+    bool underflowFlag;                                                        \
+    bool overflowFlag;                                                         \
+  } NAME##_t;                                                                  \
+                                                                               \
+  /* Initializes the buffer to use storage[0..capacity-1], empty. Returns */   \
+  /* false (and prints an error) if capacity is not a power of two. */         \
+  bool NAME##_init(NAME##_t *q, TYPE *storage, ringBuffer_index_t capacity);   \
+  /* Returns the capacity of the buffer. */                                    \
+  ringBuffer_index_t NAME##_size(const NAME##_t *q);                           \
+  /* Returns a count of the elements currently contained in the buffer. */     \
+  ringBuffer_index_t NAME##_elementCount(const NAME##_t *q);                   \
+  /* Returns true if the buffer is full. */                                    \
+  bool NAME##_full(const NAME##_t *q);                                         \
+  /* Returns true if the buffer is empty. */                                   \
+  bool NAME##_empty(const NAME##_t *q);                                        \
+  /* Pushes value if not full, otherwise sets the overflowFlag and prints. */  \
+  void NAME##_push(NAME##_t *q, TYPE value);                                   \
+  /* Pops the oldest value if not empty, otherwise sets the underflowFlag, */  \
+  /* prints and returns RINGBUFFER_RETURN_ERROR_VALUE. */                      \
+  TYPE NAME##_pop(NAME##_t *q);                                                \
+  /* Pushes value, first dropping the oldest value if the buffer is full. */   \
+  void NAME##_overwritePush(NAME##_t *q, TYPE value);                          \
+  /* Reads element index (0 is the oldest). Prints an error and returns */     \
+  /* RINGBUFFER_RETURN_ERROR_VALUE if index is out of range. */                \
+  TYPE NAME##_readElementAt(const NAME##_t *q, ringBuffer_index_t index);      \
+  /* Fills the buffer to capacity with fillValue. */                           \
+  void NAME##_fill(NAME##_t *q, TYPE fillValue);                               \
+  /* Returns true if an underflow or an overflow has occurred. */              \
+  bool NAME##_underflow(const NAME##_t *q);                                    \
+  bool NAME##_overflow(const NAME##_t *q);                                     \
+  /* Prints the contents, oldest first. */                                     \
+  void NAME##_print(const NAME##_t *q);                                        \
+                                                                               \
+  /* Unchecked push; the buffer must not be full. */                           \
+  static inline void NAME##_pushFast(NAME##_t *q, TYPE value) {                \
+    q->data[q->indexIn++ & q->mask] = value;                                   \
+  }                                                                            \
+  /* Unchecked pop; the buffer must not be empty. */                           \
+  static inline TYPE NAME##_popFast(NAME##_t *q) {                             \
+    return q->data[q->indexOut++ & q->mask];                                   \
+  }                                                                            \
+  /* Pushes value, dropping the oldest value if the buffer is full. */         \
+  static inline void NAME##_overwritePushFast(NAME##_t *q, TYPE value) {       \
+    q->data[q->indexIn++ & q->mask] = value;                                   \
+    q->indexOut += ((q->indexIn - q->indexOut) > q->mask + 1);                 \
+  }                                                                            \
+  /* Unchecked read of element index (0 is the oldest). */                     \
+  static inline TYPE NAME##_readElementAtFast(const NAME##_t *q,               \
+                                              ringBuffer_index_t index) {      \
+    return q->data[(q->indexOut + index) & q->mask];                           \
+  }                                                                            \
+  /* Unchecked read of the element pushed age pushes ago (0 is the newest). */ \
+  /* Any age below the capacity is valid once capacity elements have been */   \
+  /* pushed, even if they have since been popped. */                           \
+  static inline TYPE NAME##_readNewestFast(const NAME##_t *q,                  \
+                                           ringBuffer_index_t age) {           \
+    return q->data[(q->indexIn - 1 - age) & q->mask];                          \
+  }
+
+RINGBUFFER_DECLARE(ringBuffer_int16, int16_t)
+RINGBUFFER_DECLARE(ringBuffer_int32, int32_t)
+RINGBUFFER_DECLARE(ringBuffer_float, float)
+RINGBUFFER_DECLARE(ringBuffer_double, double)
+
+// Performs a comprehensive test of all four buffer types, using queue_t as the
+// reference. Returns false if the test fails, true otherwise.
+bool ringBuffer_runTest();
+
+#endif /* RINGBUFFER_H_ */
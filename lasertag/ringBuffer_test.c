@@ -0,0 +1,125 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "queue.h"
+#include "ringBuffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_CAPACITY 64 // Power of two, so the ring buffer holds 64 elements.
+#define TEST_ITERATION_COUNT 10000
+#define TEST_MAX_VALUE 30000 // Representable exactly by every element type.
+#define TEST_BAD_CAPACITY 60 // Not a power of two, init() must reject it.
+
+// Runs the same random mix of push, pop and overwritePush on a ring buffer and
+// on a queue_t of the same capacity, and compares the contents after every
+// operation with both the checked and the unchecked read functions. Also
+// checks readNewestFast() against the queue, the flags and init() with a bad
+// capacity. Defined once per element type.
+#define RINGBUFFER_DEFINE_TEST(NAME, TYPE)                                     \
+  static bool NAME##_test() {                                                  \
+    static TYPE storage[TEST_CAPACITY];                                        \
+    NAME##_t buffer;                                                           \
+    queue_t reference;                                                         \
+    bool success = true;                                                       \
+    printf("Testing " #NAME ".\n\r");                                          \
+    if (NAME##_init(&buffer, storage, TEST_BAD_CAPACITY)) {                    \
+      printf("* " #NAME "_init() accepted capacity %d.\n\r",                   \
+             TEST_BAD_CAPACITY);                                               \
+      success = false;                                                         \
+    }                                                                          \
+    NAME##_init(&buffer, storage, TEST_CAPACITY);                              \
+    queue_init(&reference, TEST_CAPACITY, "ringBuffer_reference");             \
+    NAME##_pop(&buffer);                                                       \
+    if (!NAME##_underflow(&buffer) || !NAME##_empty(&buffer)) {                \
+      printf("* " #NAME "_pop() on an empty buffer did not underflow.\n\r");   \
+      success = false;                                                         \
+    }                                                                          \
+    for (uint32_t i = 0; i < TEST_ITERATION_COUNT && success; i++) {           \
+      TYPE value = (TYPE)(rand() % TEST_MAX_VALUE);                            \
+      switch (rand() % 3) {                                                    \
+      case 0: /* Push (only if there is room, to keep the output quiet). */    \
+        if (!queue_full(&reference)) {                                         \
+          NAME##_push(&buffer, value);                                         \
+          queue_push(&reference, value);                                       \
+        }                                                                      \
+        break;                                                                 \
+      case 1: /* Pop (only if not empty). */                                   \
+        if (!queue_empty(&reference) &&                                        \
+            NAME##_pop(&buffer) != (TYPE)queue_pop(&reference)) {              \
+          printf("* " #NAME "_pop() does not match queue_pop().\n\r");         \
+          success = false;                                                     \
+        }                                                                      \
+        break;                                                                 \
+      default:                                                                 \
+        NAME##_overwritePush(&buffer, value);                                  \
+        queue_overwritePush(&reference, value);                                \
+        break;                                                                 \
+      }                                                                        \
+      if (NAME##_elementCount(&buffer) != queue_elementCount(&reference)) {    \
+        printf("* " #NAME "_elementCount(): %lu, queue_elementCount(): "        \
+               "%lu\n\r",                                                      \
+               (unsigned long)NAME##_elementCount(&buffer),                    \
+               (unsigned long)queue_elementCount(&reference));                 \
+        success = false;                                                       \
+      }                                                                        \
+      for (uint32_t j = 0; j < queue_elementCount(&reference) && success;      \
+           j++) {                                                              \
+        TYPE expected = (TYPE)queue_readElementAt(&reference, j);              \
+        if (NAME##_readElementAt(&buffer, j) != expected ||                    \
+            NAME##_readElementAtFast(&buffer, j) != expected) {                \
+          printf("* " #NAME "_readElementAt(%lu) does not match the "          \
+                 "queue.\n\r",                                                 \
+                 (unsigned long)j);                                            \
+          success = false;                                                     \
+        }                                                                      \
+      }                                                                        \
+    }                                                                          \
+    /* Fill both, then check the full flag, overflow and readNewestFast(). */  \
+    while (!queue_full(&reference)) {                                          \
+      TYPE value = (TYPE)(rand() % TEST_MAX_VALUE);                            \
+      NAME##_overwritePushFast(&buffer, value);                                \
+      queue_overwritePush(&reference, value);                                  \
+    }                                                                          \
+    NAME##_push(&buffer, 0);                                                   \
+    if (!NAME##_full(&buffer) || !NAME##_overflow(&buffer)) {                  \
+      printf("* " #NAME "_push() on a full buffer did not overflow.\n\r");     \
+      success = false;                                                         \
+    }                                                                          \
+    for (uint32_t age = 0; age < TEST_CAPACITY; age++) {                       \
+      if (NAME##_readNewestFast(&buffer, age) !=                               \
+          (TYPE)queue_readElementAt(&reference, TEST_CAPACITY - 1 - age)) {    \
+        printf("* " #NAME "_readNewestFast(%lu) does not match the "           \
+               "queue.\n\r",                                                   \
+               (unsigned long)age);                                            \
+        success = false;                                                       \
+        break;                                                                 \
+      }                                                                        \
+    }                                                                          \
+    queue_garbageCollect(&reference);                                          \
+    printf(#NAME " test %s.\n\r", success ? "passed" : "failed");              \
+    return success;                                                            \
+  }
+
+RINGBUFFER_DEFINE_TEST(ringBuffer_int16, int16_t)
+RINGBUFFER_DEFINE_TEST(ringBuffer_int32, int32_t)
+RINGBUFFER_DEFINE_TEST(ringBuffer_float, float)
+RINGBUFFER_DEFINE_TEST(ringBuffer_double, double)
+
+// Performs a comprehensive test of all four buffer types.
+bool ringBuffer_runTest() {
+  printf("******** ringBuffer_runTest() **********\n\r");
+  bool success = true;
+  success &= ringBuffer_int16_test();
+  success &= ringBuffer_int32_test();
+  success &= ringBuffer_float_test();
+  success &= ringBuffer_double_test();
+  printf("ringBuffer_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
@@ -8,6 +8,7 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 */
 
 #include "runningModes.h"
+#include "adcTrace.h"
 #include "detector.h"
 #include "display.h"
 #include "drivers/buttons.h"
@@ -18,12 +19,15 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #include "interrupts.h"
 #include "intervalTimer.h"
 #include "isr.h"
+#include "isrMonitor.h"
 #include "ledTimer.h"
 #include "leds.h"
 #include "lockoutTimer.h"
 #include "mio.h"
+#include "profiler.h"
 #include "queue.h"
 #include "sound.h"
+#include "tickScheduler.h"
 #include "transmitter.h"
 #include "trigger.h"
 #include "utils.h"
@@ -39,6 +43,10 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 // the ability to ignore frequencies in detector.c
 //#define IGNORE_OWN_FREQUENCY 1
 
+// Uncomment this code to overlay the ISR budget statistics (see isrMonitor.h)
+// on the histogram in continuous and shooter modes.
+//#define ISR_MONITOR_OVERLAY 1
+
 #define MAX_HIT_COUNT 100000
 
 #define MAX_BUFFER_SIZE 100 // Used for a generic message buffer.
@@ -56,7 +64,14 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
   INTERVAL_TIMER_TIMER_2 // Used to compute cumulative run-time in main.
 
 #define SYSTEM_TICKS_PER_HISTOGRAM_UPDATE                                      \
-  30000 // Update the histogram about 3 times per second.
+  10000 // Update the histogram about 10 times per second.
+// Continuous mode draws this many histogram bars at a time, so one update is
+// spread over several passes of the main loop, all of them before the next
+// update.
+#define RUNNING_MODE_HISTOGRAM_BARS_PER_UPDATE 2
+#define SYSTEM_TICKS_PER_HISTOGRAM_BAR_UPDATE                                  \
+  (SYSTEM_TICKS_PER_HISTOGRAM_UPDATE *                                         \
+   RUNNING_MODE_HISTOGRAM_BARS_PER_UPDATE / HISTOGRAM_BAR_COUNT)
 
 #define RUNNING_MODE_WARNING_TEXT_SIZE 2 // Upsize the text for visibility.
 #define RUNNING_MODE_WARNING_TEXT_COLOR DISPLAY_RED // Red for more visibility.
@@ -64,19 +79,30 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 #define RUNNING_MODE_NORMAL_TEXT_COLOR DISPLAY_WHITE // White for reporting.
 #define RUNNING_MODE_SCREEN_X_ORIGIN 0 // Origin for reporting text.
 #define RUNNING_MODE_SCREEN_Y_ORIGIN 0 // Origin for reporting text.
+#define RUNNING_MODE_OVERLAY_TEXT_COLOR DISPLAY_YELLOW // ISR monitor overlay.
+#define RUNNING_MODE_FLUSH_BUDGET_MICROS 200 // Display time per main loop pass.
 
-// Detector should be invoked this often for good performance.
-#define SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND 30000
+// The detector should keep up with the ADC, which delivers
+// FILTER_SAMPLE_FREQUENCY_IN_KHZ * 1000 samples per second.
+#define SUGGESTED_DETECTOR_SAMPLES_PER_SECOND 99000
 // ADC queue should have no more than this number of unprocessed elements for
 // good performance.
 #define SUGGESTED_REMAINING_ELEMENT_COUNT 500
+// Each detector_processAvailable() call drains at most this many ADC samples
+// and returns after the first block that takes it past this many
+// microseconds, so the rest of the loop still runs regularly.
+#define DETECTOR_MAX_SAMPLES_PER_CALL 2000
+#define DETECTOR_MAX_MICROS_PER_CALL 5000
+
+#define RAW_ADC_CAPTURE_SAMPLE_COUNT                                           \
+  300000 // Samples recorded by runningModes_captureRawAdcValues() (3 s).
 
 // Defined to make things more readable.
 #define INTERRUPTS_CURRENTLY_ENABLED true
 #define INTERRUPTS_CURRENTLY_DISABLE false
 
-// Keep track of detector invocations.
-static uint32_t detectorInvocationCount = 0;
+// ADC samples processed by detector_processAvailable().
+static uint32_t detectorSampleCount = 0;
 
 // This array is indexed by frequency number. If array-element[freq_no] == true,
 // the frequency is ignored, e.g., no hit will ever occur at that frequency.
@@ -141,23 +167,50 @@ void runningModes_printRunTimeStatistics() {
   display_print("Total interrupts:            ");
   display_printlnDecimalInt(interruptCount);
   display_printChar('\n');
-  display_print("Detector invocation count: ");
-  // Print out detector invocations per second.
-  display_printlnDecimalInt(detectorInvocationCount);
+  display_print("Detector sample count: ");
+  // Print out the ADC samples processed per second.
+  display_printlnDecimalInt(detectorSampleCount);
   display_printChar('\n');
-  display_print("Detector invocations per second: ");
-  sprintf(sprintfBuffer, "%5.2f", detectorInvocationCount / runningSeconds);
+  display_print("Detector samples per second: ");
+  sprintf(sprintfBuffer, "%5.2f", detectorSampleCount / runningSeconds);
   display_print(sprintfBuffer);
   display_printChar('\n');
   display_printChar('\n');
-  // If the detector invocation rate is too low, inform the user.
-  if (detectorInvocationCount / runningSeconds <
-      SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND) {
+  // The per-scope table does not fit on the screen with the warnings below.
+  profiler_printStatistics(); // To the UART.
+  // Print out the ISR budget statistics on one line, the details go to the
+  // UART.
+  isrMonitor_statistics_t isrStatistics;
+  isrMonitor_getStatistics(&isrStatistics);
+  sprintf(sprintfBuffer, "ISR p99.9/max %.2f/%.2fus ovr %lu miss %lu",
+          profiler_cyclesToMicros(isrStatistics.p999Cycles),
+          profiler_cyclesToMicros(isrStatistics.maxCycles),
+          (unsigned long)isrStatistics.overrunCount,
+          (unsigned long)isrStatistics.missedTickCount);
+  display_println(sprintfBuffer);
+  isrMonitor_printStatistics(interruptCount);
+  // Print out the longest scheduler tick, the per-task table goes to the UART.
+  sprintf(sprintfBuffer, "Tick tasks max (us): %.2f, %d per tick",
+          profiler_cyclesToMicros(tickScheduler_getMaxTickCycles()),
+          tickScheduler_getMaxTasksPerTick());
+  display_println(sprintfBuffer);
+  tickScheduler_printStatistics();
+  // Overruns corrupt hit detection, make them stand out.
+  if (isrStatistics.overrunCount > 0 || isrStatistics.missedTickCount > 0) {
+    display_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
+    display_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
+    display_println("ISR overran 10 us slot."); // One row at size 2.
+    display_setTextColor(RUNNING_MODE_NORMAL_TEXT_COLOR);
+    display_setTextSize(RUNNING_MODE_NORMAL_TEXT_SIZE);
+  }
+  // If the detector falls behind the ADC, inform the user.
+  if (detectorSampleCount / runningSeconds <
+      SUGGESTED_DETECTOR_SAMPLES_PER_SECOND) {
     display_setTextColor(RUNNING_MODE_WARNING_TEXT_COLOR);
     display_setTextSize(RUNNING_MODE_WARNING_TEXT_SIZE);
-    display_print("Detector should be called at least ");
-    display_printDecimalInt(SUGGESTED_DETECTOR_INVOCATIONS_PER_SECOND);
-    display_println(" times per second.");
+    display_print("Detector should process at least ");
+    display_printDecimalInt(SUGGESTED_DETECTOR_SAMPLES_PER_SECOND);
+    display_println(" samples per second.");
     display_printChar('\n');
   }
   // If the unprocessed element count is too high, inform the user.
@@ -169,6 +222,24 @@ void runningModes_printRunTimeStatistics() {
     display_printDecimalInt(SUGGESTED_REMAINING_ELEMENT_COUNT);
     display_println(" elements.");
   }
+  display_flush();
+}
+
+// Draws one line of ISR budget statistics over the top of the histogram.
+static void runningModes_drawIsrMonitorOverlay() {
+  char sprintfBuffer[MAX_BUFFER_SIZE];
+  isrMonitor_statistics_t statistics;
+  isrMonitor_getStatistics(&statistics);
+  sprintf(sprintfBuffer, "ISR p99.9 %5.2fus max %5.2fus ovr %lu miss %lu",
+          profiler_cyclesToMicros(statistics.p999Cycles),
+          profiler_cyclesToMicros(statistics.maxCycles),
+          (unsigned long)statistics.overrunCount,
+          (unsigned long)statistics.missedTickCount);
+  display_setTextSize(RUNNING_MODE_NORMAL_TEXT_SIZE);
+  display_setTextColorBg(RUNNING_MODE_OVERLAY_TEXT_COLOR, DISPLAY_BLACK);
+  display_setCursor(RUNNING_MODE_SCREEN_X_ORIGIN, RUNNING_MODE_SCREEN_Y_ORIGIN);
+  display_print(sprintfBuffer);
+  display_flush();
 }
 
 // Group all of the inits together to reduce visual clutter.
@@ -182,6 +253,8 @@ void runningModes_initAll() {
   transmitter_init();
   filter_init();
   isr_init();
+  profiler_init();
+  isrMonitor_init();
   hitLedTimer_init();
   trigger_init();
   lockoutTimer_init();
@@ -212,6 +285,7 @@ void runningModes_continuous() {
   ignoredFrequenciesArray[runningModes_getFrequencySetting()] = true;
 #endif
   detector_init(ignoredFrequenciesArray);
+  detector_initProcessAvailable();
 
   // sound_init();
   // Prints an error message if an internal failure occurs because the argument
@@ -236,30 +310,44 @@ void runningModes_continuous() {
   interrupts_enableArmInts();  // The ARM will start seeing interrupts after
                                // this.
   transmitter_run();           // Start the transmitter.
-  detectorInvocationCount = 0; // Keep track of detector invocations.
+  detectorSampleCount = 0;     // Keep track of processed samples.
+  // A queued display sends a histogram update over several passes.
+  display_setFlushBudget(RUNNING_MODE_FLUSH_BUDGET_MICROS);
+  histogram_setUpdateLimit(RUNNING_MODE_HISTOGRAM_BARS_PER_UPDATE);
   while (!(buttons_read() &
            BUTTONS_BTN3_MASK)) { // Run until you detect btn3 pressed.
     transmitter_setFrequencyNumber(runningModes_getFrequencySetting());
-    detectorInvocationCount++; // Used for run-time statistics.
-    histogramSystemTicks++;    // Keep track of ticks so you know when to update
-                               // the histogram.
+    histogramSystemTicks++; // Keep track of ticks so you know when to update
+                            // the histogram.
     // Run filters, compute power, etc.
     intervalTimer_start(MAIN_CUMULATIVE_TIMER); // Measure run-time when you are
                                                 // doing something.
-    detector(INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
+    detectorSampleCount += detector_processAvailable(
+        DETECTOR_MAX_SAMPLES_PER_CALL,
+        DETECTOR_MAX_MICROS_PER_CALL); // Used for run-time statistics.
     intervalTimer_stop(MAIN_CUMULATIVE_TIMER);
     // If enough ticks have transpired, update the histogram.
     if (histogramSystemTicks >= SYSTEM_TICKS_PER_HISTOGRAM_UPDATE) {
       double powerValues[FILTER_FREQUENCY_COUNT]; // Copy the current power
                                                   // values to here.
-      filter_getCurrentPowerValues(
+      detector_getCurrentPowerValues(
           powerValues); // Copy the current power values.
       histogram_plotUserFrequencyPower(
           powerValues); // Plot the power values on the TFT.
+#ifdef ISR_MONITOR_OVERLAY
+      runningModes_drawIsrMonitorOverlay();
+#endif
       histogramSystemTicks =
           0; // Reset the tick count and wait for the next update time.
+    } else if (histogramSystemTicks % SYSTEM_TICKS_PER_HISTOGRAM_BAR_UPDATE ==
+               0) {
+      histogram_updateDisplay(); // Draw the bars the last update left.
     }
+    display_flush(); // Send some of what is left of the last update.
   }
+  histogram_setUpdateLimit(HISTOGRAM_NO_UPDATE_LIMIT);
+  histogram_updateDisplay(); // Draw what is left before the statistics.
+  display_setFlushBudget(DISPLAY_NO_FLUSH_BUDGET);
   interrupts_disableArmInts();           // Stop interrupts.
   runningModes_printRunTimeStatistics(); // Print the run-time statistics.
 }
@@ -275,8 +363,9 @@ void runningModes_shooter() {
   ignoredFrequencies[runningModes_getFrequencySetting()] = true;
 #endif
   detector_init(ignoredFrequencies);
+  detector_initProcessAvailable();
   uint16_t hitCount = 0;
-  detectorInvocationCount = 0; // Keep track of detector invocations.
+  detectorSampleCount = 0; // Keep track of processed samples.
   sound_init();
   trigger_enable();         // Makes the trigger state machine responsive to the
                             // trigger.
@@ -298,6 +387,8 @@ void runningModes_shooter() {
                               // this.
   lockoutTimer_start(); // Ignore erroneous hits at startup (when all power
                         // values are essentially 0).
+  // A queued display sends a histogram update over several passes.
+  display_setFlushBudget(RUNNING_MODE_FLUSH_BUDGET_MICROS);
   while ((!(buttons_read() & BUTTONS_BTN3_MASK)) &&
          hitCount < MAX_HIT_COUNT) { // Run until you detect btn3 pressed.
     transmitter_setFrequencyNumber(
@@ -308,19 +399,29 @@ void runningModes_shooter() {
     histogramSystemTicks++; // Keep track of ticks so you know when to update
                             // the histogram.
     // Run filters, compute power, run hit-detection.
-    detectorInvocationCount++;              // Used for run-time statistics.
-    detector(INTERRUPTS_CURRENTLY_ENABLED); // Interrupts are currently enabled.
-    if (detector_hitDetected()) {           // Hit detected
-      hitCount++;                           // increment the hit count.
-      detector_clearHit();                  // Clear the hit.
+    detectorSampleCount += detector_processAvailable(
+        DETECTOR_MAX_SAMPLES_PER_CALL,
+        DETECTOR_MAX_MICROS_PER_CALL); // Used for run-time statistics.
+    if (detector_hitDetected()) { // Hit detected
+      hitCount++;                 // increment the hit count.
+      detector_clearHit();        // Clear the hit.
       detector_hitCount_t
           hitCounts[DETECTOR_HIT_ARRAY_SIZE]; // Store the hit-counts here.
       detector_getHitCounts(hitCounts);       // Get the current hit counts.
       histogram_plotUserHits(hitCounts);      // Plot the hit counts on the TFT.
     }
+    sound_service(); // Read ahead streamed sounds.
+#ifdef ISR_MONITOR_OVERLAY
+    if (histogramSystemTicks >= SYSTEM_TICKS_PER_HISTOGRAM_UPDATE) {
+      runningModes_drawIsrMonitorOverlay();
+      histogramSystemTicks = 0;
+    }
+#endif
+    display_flush(); // Send some of what is left of the last update.
     intervalTimer_stop(
         MAIN_CUMULATIVE_TIMER); // All done with actual processing.
   }
+  display_setFlushBudget(DISPLAY_NO_FLUSH_BUDGET);
   interrupts_disableArmInts(); // Done with loop, disable the interrupts.
   hitLedTimer_turnLedOff();    // Save power :-)
   runningModes_printRunTimeStatistics(); // Print the run-time statistics to the
@@ -328,22 +429,45 @@ void runningModes_shooter() {
   printf("Shooter mode terminated after detecting %d shots.\n\r", hitCount);
 }
 
-// This mode simply dumps raw ADC values to the console.
-// I wrote this to determine if bipolar mode was working for the ADC.
-// Just loops forever, you must manually stop the program with an external
-// reset.
-void runningModes_dumpRawAdcValues() {
+// Records RAW_ADC_CAPTURE_SAMPLE_COUNT samples exactly as the ISR hands them
+// to the detector, encoding them into an adcTrace.h trace as they arrive, then
+// writes the trace to the UART. The UART is far slower than the ADC, so the
+// whole trace is kept in memory until the capture is done. Capture the UART
+// output to a file and replay it on the host (see lasertag/benchmark).
+void runningModes_captureRawAdcValues() {
+  static uint8_t trace[ADC_TRACE_MAX_SIZE(RAW_ADC_CAPTURE_SAMPLE_COUNT)];
+  isr_AdcValue_t block[ADC_TRACE_BLOCK_SIZE];
+  uint16_t blockCount = 0;
+  uint32_t capturedCount = 0;
   runningModes_initAll();
+  uint32_t traceSize =
+      adcTrace_encodeHeader(RAW_ADC_CAPTURE_SAMPLE_COUNT, trace);
+  printf("Capturing %d ADC samples.\n\r", RAW_ADC_CAPTURE_SAMPLE_COUNT);
   interrupts_initAll(true); // Sets up interrupts and the XADC.
-  // We don't need interrupts, so just loop and print out raw ADC values.
-  while (1) {
-    // In bipolar mode, the ADC returns a 12-bit signed value.
-    // As such, you will need to do your own sign-extension out to 16 bits
-    // in order to get to a C primitive type.
-    // Thus, if bit-11 is a 1, bits 15-12 must also be set to 1, and
-    // if bit-11 is a 0, bits 15-12 must also be set to a 0.
-    int16_t signExtendedValue = interrupts_getAdcData();
-    signExtendedValue |= (signExtendedValue & 0x800) ? 0xF000 : 0x0000;
-    printf("raw ADC value: %d\n", signExtendedValue);
+  interrupts_enableTimerGlobalInts();
+  interrupts_startArmPrivateTimer();
+  interrupts_enableArmInts(); // The ISR starts filling the ADC buffer.
+  while (capturedCount < RAW_ADC_CAPTURE_SAMPLE_COUNT) {
+    // Drain through isr.h like the detector does, it is safe with interrupts
+    // enabled. Never past the end of the block or of the capture.
+    uint32_t count = ADC_TRACE_BLOCK_SIZE - blockCount;
+    if (count > RAW_ADC_CAPTURE_SAMPLE_COUNT - capturedCount)
+      count = RAW_ADC_CAPTURE_SAMPLE_COUNT - capturedCount;
+    count = isr_drainAdcBuffer(&block[blockCount], count);
+    blockCount += count;
+    capturedCount += count;
+    // Encode every full block, and the last partial one.
+    if (blockCount == ADC_TRACE_BLOCK_SIZE ||
+        capturedCount == RAW_ADC_CAPTURE_SAMPLE_COUNT) {
+      traceSize += adcTrace_encodeBlock(block, blockCount, trace + traceSize);
+      blockCount = 0;
+    }
   }
+  interrupts_disableArmInts();
+  // The text lines around the trace are skipped by adcTrace_find().
+  printf("ADC trace: %ld bytes follow.\n\r", (long)traceSize);
+  fflush(stdout);
+  fwrite(trace, 1, traceSize, stdout);
+  fflush(stdout);
+  printf("\n\rADC trace done.\n\r");
 }
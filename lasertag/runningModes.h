@@ -49,7 +49,8 @@ void runningModes_testShootAllChannels();
 // Returns the current switch-setting
 uint16_t runningModes_getFrequencySetting();
 
-// A simple test mode that continuously prints out raw ADC values.
-void runningModes_dumpRawAdcValues();
+// Records a few seconds of raw ADC samples and writes them to the UART as an
+// adcTrace.h trace, for replay on the host or the emulator.
+void runningModes_captureRawAdcValues();
 
 #endif /* RUNNINGMODES_H_ */
@@ -0,0 +1,167 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "slidingDft.h"
+#include "ringBuffer.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define POWER_SCALE (2.0 / SLIDING_DFT_WINDOW_SIZE) // |X|^2 to filter power.
+
+// e^(-jw) for each bin.
+static double twiddleReal[FILTER_FREQUENCY_COUNT];
+static double twiddleImag[FILTER_FREQUENCY_COUNT];
+// e^(-jwN), applied to the sample leaving the window.
+static double windowTwiddleReal[FILTER_FREQUENCY_COUNT];
+static double windowTwiddleImag[FILTER_FREQUENCY_COUNT];
+// Current value of each bin.
+static double binReal[FILTER_FREQUENCY_COUNT];
+static double binImag[FILTER_FREQUENCY_COUNT];
+static double currentPowerValue[FILTER_FREQUENCY_COUNT];
+
+// The last SLIDING_DFT_WINDOW_CAPACITY decimated samples, so the sample that
+// leaves the window is still there when the next one arrives.
+static double windowStorage[SLIDING_DFT_WINDOW_CAPACITY];
+static ringBuffer_double_t window;
+
+// Computes the bin frequencies and clears the window and the bins.
+void slidingDft_init() {
+  ringBuffer_double_init(&window, windowStorage, SLIDING_DFT_WINDOW_CAPACITY);
+  ringBuffer_double_fill(&window, 0.0);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    // Tick counts are at the 100 kHz input rate, the bins run decimated.
+    double w = 2.0 * M_PI * FILTER_FIR_DECIMATION_FACTOR /
+               filter_frequencyTickTable[i];
+    twiddleReal[i] = cos(w);
+    twiddleImag[i] = -sin(w);
+    windowTwiddleReal[i] = cos(w * SLIDING_DFT_WINDOW_SIZE);
+    windowTwiddleImag[i] = -sin(w * SLIDING_DFT_WINDOW_SIZE);
+    binReal[i] = 0.0;
+    binImag[i] = 0.0;
+    currentPowerValue[i] = 0.0;
+  }
+}
+
+// Adds a sample to the window and advances every bin.
+void slidingDft_addNewInput(double x) {
+  ringBuffer_double_overwritePushFast(&window, x);
+  double oldest =
+      ringBuffer_double_readNewestFast(&window, SLIDING_DFT_WINDOW_SIZE);
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    double real = twiddleReal[i] * binReal[i] - twiddleImag[i] * binImag[i];
+    double imag = twiddleReal[i] * binImag[i] + twiddleImag[i] * binReal[i];
+    binReal[i] = real + x - oldest * windowTwiddleReal[i];
+    binImag[i] = imag - oldest * windowTwiddleImag[i];
+  }
+}
+
+// Recomputes one bin from the window, oldest sample first. After the newest
+// sample, X = s1 - e^(jw) * s2.
+static void slidingDft_goertzel(uint16_t filterNumber) {
+  double coefficient = 2.0 * twiddleReal[filterNumber];
+  double s1 = 0.0, s2 = 0.0;
+  for (int32_t age = SLIDING_DFT_WINDOW_SIZE - 1; age >= 0; age--) {
+    double s = ringBuffer_double_readNewestFast(&window, age) +
+               coefficient * s1 - s2;
+    s2 = s1;
+    s1 = s;
+  }
+  binReal[filterNumber] = s1 - twiddleReal[filterNumber] * s2;
+  binImag[filterNumber] = twiddleImag[filterNumber] * s2;
+}
+
+// Computes the power at filterNumber from its bin.
+double slidingDft_computePower(uint16_t filterNumber,
+                               bool forceComputeFromScratch, bool debugPrint) {
+  if (forceComputeFromScratch)
+    slidingDft_goertzel(filterNumber);
+  double real = binReal[filterNumber];
+  double imag = binImag[filterNumber];
+  currentPowerValue[filterNumber] = POWER_SCALE * (real * real + imag * imag);
+  if (debugPrint)
+    printf("slidingDft_computePower(%d): %le\n\r", filterNumber,
+           currentPowerValue[filterNumber]);
+  return currentPowerValue[filterNumber];
+}
+
+// Returns the last power value computed for filterNumber.
+double slidingDft_getCurrentPowerValue(uint16_t filterNumber) {
+  return currentPowerValue[filterNumber];
+}
+
+// Copies the last computed power values.
+void slidingDft_getCurrentPowerValues(double powerValues[]) {
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    powerValues[i] = currentPowerValue[i];
+}
+
+// Copies and normalizes the last computed power values.
+void slidingDft_getNormalizedPowerValues(double normalizedArray[],
+                                         uint16_t *indexOfMaxValue) {
+  *indexOfMaxValue = 0;
+  for (uint16_t i = 1; i < FILTER_FREQUENCY_COUNT; i++) {
+    if (currentPowerValue[i] > currentPowerValue[*indexOfMaxValue])
+      *indexOfMaxValue = i;
+  }
+  double maxValue = currentPowerValue[*indexOfMaxValue];
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++)
+    normalizedArray[i] =
+        (maxValue > 0.0) ? currentPowerValue[i] / maxValue : 0.0;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_SAMPLE_COUNT 20000 // Random samples run through the bins.
+#define TEST_CHECK_PERIOD 997 // Compare with Goertzel every this many samples.
+#define TEST_RELATIVE_TOLERANCE 1e-9 // Incremental vs. Goertzel power.
+#define TEST_SINE_TOLERANCE 0.02 // Sine power vs. N/2 (leakage from -w).
+
+// Runs random input and compares the incremental power with Goertzel, then
+// checks that a unit sinusoid at each user frequency gives a power of N/2.
+bool slidingDft_runTest() {
+  printf("******** slidingDft_runTest() **********\n\r");
+  bool success = true;
+  slidingDft_init();
+  for (uint32_t n = 1; n <= TEST_SAMPLE_COUNT && success; n++) {
+    slidingDft_addNewInput(2.0 * rand() / RAND_MAX - 1.0);
+    if (n % TEST_CHECK_PERIOD != 0)
+      continue;
+    for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+      double incremental = slidingDft_computePower(i, false, false);
+      double forced = slidingDft_computePower(i, true, false);
+      if (fabs(incremental - forced) > TEST_RELATIVE_TOLERANCE * forced) {
+        printf("slidingDft_runTest: sample %ld, bin %d: incremental %le, "
+               "Goertzel %le.\n\r",
+               (long)n, i, incremental, forced);
+        success = false;
+      }
+    }
+  }
+  for (uint16_t i = 0; i < FILTER_FREQUENCY_COUNT; i++) {
+    slidingDft_init();
+    double w = 2.0 * M_PI * FILTER_FIR_DECIMATION_FACTOR /
+               filter_frequencyTickTable[i];
+    for (uint32_t n = 0; n < SLIDING_DFT_WINDOW_SIZE; n++)
+      slidingDft_addNewInput(sin(w * n));
+    double power = slidingDft_computePower(i, false, false);
+    double expected = SLIDING_DFT_WINDOW_SIZE / 2.0;
+    if (fabs(power - expected) > TEST_SINE_TOLERANCE * expected) {
+      printf("slidingDft_runTest: sine at frequency %d has power %le, "
+             "expected %le.\n\r",
+             i, power, expected);
+      success = false;
+    }
+  }
+  printf("slidingDft_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
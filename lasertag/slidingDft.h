@@ -0,0 +1,72 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SLIDINGDFT_H_
+#define SLIDINGDFT_H_
+
+#include "filter.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Detector front end that replaces the IIR bandpass filters and their power
+// computation. The detector only needs the power at the FILTER_FREQUENCY_COUNT
+// user frequencies over the last FILTER_INPUT_PULSE_WIDTH decimated samples,
+// so instead of filtering and squaring, this module keeps one DFT bin per user
+// frequency over that same window and updates every bin in O(1) per sample
+// (sliding DFT):
+//   X[n] = e^(-jw) * X[n-1] + x[n] - e^(-jwN) * x[n-N]
+// A forced power computation recomputes the bins from the window with the
+// Goertzel algorithm, which also removes any accumulated rounding error.
+//
+// Power is scaled by 2/N so that a sinusoid at a user frequency gives the same
+// power as the sum of squares of an ideal (unity gain) bandpass output over the
+// window, i.e., roughly the value filter_computePower() returns.
+//
+// Usage from detector(), after each decimated sample (FIR output):
+//   slidingDft_addNewInput(firOutput);
+//   for each filterNumber: slidingDft_computePower(filterNumber, false, false);
+//   slidingDft_getCurrentPowerValues(powerValues); // Then detector_sort().
+
+#define SLIDING_DFT_WINDOW_SIZE                                                \
+  FILTER_INPUT_PULSE_WIDTH // Same window as the IIR output queues.
+#define SLIDING_DFT_WINDOW_CAPACITY                                            \
+  2048 // Power of two that holds the window plus the sample leaving it.
+
+// Computes the bin frequencies from filter_frequencyTickTable and clears the
+// window and the bins.
+void slidingDft_init();
+
+// Adds one decimated sample (the FIR output) to the window and advances every
+// bin.
+void slidingDft_addNewInput(double x);
+
+// Same contract as filter_computePower(): computes the power at filterNumber,
+// from scratch (Goertzel over the window) if forceComputeFromScratch is true,
+// otherwise from the current bin. Prints the result if debugPrint is true.
+double slidingDft_computePower(uint16_t filterNumber,
+                               bool forceComputeFromScratch, bool debugPrint);
+
+// Returns the last power value computed for filterNumber.
+double slidingDft_getCurrentPowerValue(uint16_t filterNumber);
+
+// Copies the last computed power values into powerValues[], like
+// filter_getCurrentPowerValues().
+void slidingDft_getCurrentPowerValues(double powerValues[]);
+
+// Copies the last computed power values into normalizedArray[], divided by the
+// largest one, like filter_getNormalizedPowerValues().
+void slidingDft_getNormalizedPowerValues(double normalizedArray[],
+                                         uint16_t *indexOfMaxValue);
+
+// Checks the incremental power against the Goertzel (forced) power on random
+// input, and the power of a sinusoid at each user frequency against its
+// expected value. Returns true if both match.
+bool slidingDft_runTest();
+
+#endif /* SLIDINGDFT_H_ */
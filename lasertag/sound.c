@@ -9,14 +9,18 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #include "sound.h"
 #include "interrupts.h" // Just for sound_runTest().
-#include "sounds/bcfire01_48k.wav.h"
-#include "sounds/gameBoyStartup.wav.h"
-#include "sounds/gameOver48k.wav.h"
-#include "sounds/gunEmpty48k.wav.h"
-#include "sounds/ouch48k.wav.h"
-#include "sounds/pacmanDeath.wav.h"
-#include "sounds/powerUp48k.wav.h"
-#include "sounds/screamAndDie48k.wav.h"
+#include "sounds/bcfire01_48k.adpcm.h"
+#include "sounds/gameBoyStartup.adpcm.h"
+#include "sounds/gameOver48k.adpcm.h"
+#include "sounds/gunEmpty48k.adpcm.h"
+#include "sounds/ouch48k.adpcm.h"
+#include "sounds/pacmanDeath.adpcm.h"
+#include "sounds/powerUp48k.adpcm.h"
+#include "sounds/screamAndDie48k.adpcm.h"
+#include "sounds/soundAssets.h"
+#include "soundDma.h"
+#include "soundMixer.h"
+#include "soundStream.h"
 #include "timer_ps.h"
 #include "xiicps.h"
 #include "xil_printf.h"
@@ -39,9 +43,34 @@ For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
 
 #define SOUND_MULTIPLIER INT16_MAX / 3 // Primitive volume control.
 
+// The PL330 DMA fills the I2S TX FIFO (see soundDma.h). Comment this out to
+// fill it from sound_tick() instead, e.g., if the hardware design does not
+// connect the I2S TX DMA request to the PL330.
+#define SOUND_DMA 1
+
+#define SOUND_DEFAULT_SAMPLE_RATE 48000 // The rate AudioInitialize() sets.
 #define ONE_SECOND_OF_SOUND_ARRAY_SIZE                                         \
-  48000 // The sample rate is 48k so that is 1 second's worth.
-uint16_t soundOfSilence[ONE_SECOND_OF_SOUND_ARRAY_SIZE];
+  SOUND_DEFAULT_SAMPLE_RATE // Played at this rate, so that is 1 second.
+#define SSM2603_SAMPLING_CONTROL_REG 8 // Codec register that sets the rate.
+#define I2S_LRCLK_DIVIDER 31           // LRCLK is BCLK / 64.
+
+// Codec sampling control (SSM2603 register 8: SR bits 5-2, CLKDIV2 bit 6) and
+// I2S bit-clock divider for every rate the codec can play. The divider scales
+// with the rate from the value AudioInitialize() uses for 48 kHz.
+typedef struct {
+  uint32_t sampleRate;
+  uint16_t samplingControl;
+  uint32_t bitClockDivider;
+} sound_rate_t;
+
+static const sound_rate_t sound_rates[] = {{48000, 0b000000000, 3},
+                                           {32000, 0b000011000, 5},
+                                           {24000, 0b001000000, 7},
+                                           {16000, 0b001011000, 11}};
+#define SOUND_RATE_COUNT (sizeof(sound_rates) / sizeof(sound_rates[0]))
+
+// The codec rate, every sound is resampled to it.
+static uint32_t sound_sampleRate = SOUND_DEFAULT_SAMPLE_RATE;
 
 // Declared below the sound state-machine code.
 int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr);
@@ -57,12 +86,73 @@ static bool sound_initFlag = false;
 // playing a sound.
 static volatile bool sound_playSoundFlag = false;
 
-// Keep track of the base pointer to the sound array with current sample-rate
-// and sample count.
-static uint16_t *sound_array; // Base pointer to the sound array.
-
-// static uint32_t sound_sampleRate;  // Sample rate for this sound.
-static uint32_t sound_sampleCount; // Number of samples in this sound.
+// Mixer priorities. A sound can take the mixer voice of one with the same or a
+// lower priority.
+#define SOUND_PRIORITY_SILENCE 0
+#define SOUND_PRIORITY_GUN 1
+#define SOUND_PRIORITY_HIT 2
+#define SOUND_PRIORITY_GAME 3
+
+// The generated arrays, or their offsets in the SD card bank when they are
+// streamed (see sounds/soundAssets.h).
+#ifdef SOUND_ASSETS_ON_SD
+#define SOUND_EFFECT_DATA(name, NAME) NULL
+#define SOUND_EFFECT_STREAMED true
+#else
+#define SOUND_EFFECT_DATA(name, NAME) name##_adpcm
+#define SOUND_EFFECT_STREAMED false
+#endif
+
+// Descriptor of the generated sound name (NAME in its macros), played once at
+// unity gain.
+#define SOUND_EFFECT(name, NAME, soundPriority)                                \
+  {.adpcm = SOUND_EFFECT_DATA(name, NAME),                                     \
+   .sampleCount = NAME##_ADPCM_NUMBER_OF_SAMPLES,                              \
+   .sampleRate = NAME##_ADPCM_SAMPLE_RATE,                                     \
+   .loopStart = 0,                                                             \
+   .loopEnd = SOUND_MIXER_NO_LOOP,                                             \
+   .gain = SOUND_MIXER_UNITY_GAIN,                                             \
+   .priority = soundPriority,                                                  \
+   .streamed = SOUND_EFFECT_STREAMED,                                          \
+   .bankOffset = NAME##_ADPCM_BANK_OFFSET}
+
+// One descriptor per sound_sounds_t: IMA-ADPCM data (see adpcm.h), length,
+// rate, loop points, default mixer gain and priority. The mixer resamples each
+// sound from its own rate to sound_sampleRate. The silence has no data, the
+// mixer only counts its samples: it keeps sound_isBusy() true for a second.
+static const soundMixer_sound_t sound_effects[] = {
+    [sound_gameStart_e] =
+        SOUND_EFFECT(gameBoyStartup, GAMEBOYSTARTUP, SOUND_PRIORITY_GAME),
+    [sound_gunFire_e] =
+        SOUND_EFFECT(bcfire01_48k, BCFIRE01_48K, SOUND_PRIORITY_GUN),
+    [sound_hit_e] = SOUND_EFFECT(ouch48k, OUCH48K, SOUND_PRIORITY_HIT),
+    [sound_gunClick_e] =
+        SOUND_EFFECT(gunEmpty48k, GUNEMPTY48K, SOUND_PRIORITY_GUN),
+    [sound_gunReload_e] =
+        SOUND_EFFECT(powerUp48k, POWERUP48K, SOUND_PRIORITY_GUN),
+    [sound_loseLife_e] =
+        SOUND_EFFECT(screamAndDie48k, SCREAMANDDIE48K, SOUND_PRIORITY_GAME),
+    [sound_gameOver_e] =
+        SOUND_EFFECT(pacmanDeath, PACMANDEATH, SOUND_PRIORITY_GAME),
+    [sound_returnToBase_e] =
+        SOUND_EFFECT(gameOver48k, GAMEOVER48K, SOUND_PRIORITY_HIT),
+    [sound_oneSecondSilence_e] = {.adpcm = NULL,
+                                  .sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE,
+                                  .sampleRate = SOUND_DEFAULT_SAMPLE_RATE,
+                                  .loopStart = 0,
+                                  .loopEnd = SOUND_MIXER_NO_LOOP,
+                                  .gain = 0,
+                                  .priority = SOUND_PRIORITY_SILENCE,
+                                  .streamed = false,
+                                  .bankOffset = 0}};
+#define SOUND_EFFECT_COUNT (sizeof(sound_effects) / sizeof(sound_effects[0]))
+
+// The sound that sound_startSound() starts.
+static sound_sounds_t sound_selectedSound = sound_gunFire_e;
+
+// Set by sound_startSound(), cleared by sound_tick() when it gives the sound a
+// mixer voice. One flag per sound, so the tick never races a read-modify-write.
+static volatile bool sound_startRequested[SOUND_EFFECT_COUNT];
 
 // Keep track of the current volume setting.
 static sound_volume_t sound_currentVolume = sound_minimumVolume_e;
@@ -99,20 +189,42 @@ void sound_sendDataToBothChannels(uint32_t sampleValue) {
 }
 
 // Used to set the volume. Use one of the provided values.
-void sound_setVolume(sound_volume_t volume) { sound_currentVolume = volume; }
+void sound_setVolume(sound_volume_t volume) {
+  sound_currentVolume = volume;
+#ifdef SOUND_DMA
+  soundDma_setVolume(volume);
+#endif
+}
 
 // Must be called before using the sound state machine.
 sound_status_t sound_init() {
   // Setup the audio CODEC.
   AudioInitialize(SCU_TIMER_ID, AUDIO_IIC_ID, AUDIO_CTRL_BASEADDR);
+#ifdef SOUND_DMA
+  if (soundDma_init(AUDIO_CTRL_BASEADDR + I2S_TX_FIFO_REG) != SOUND_STATUS_OK)
+    return SOUND_STATUS_FAIL;
+#endif
+#ifdef SOUND_ASSETS_ON_SD
+  if (soundStream_init() != SOUND_STATUS_OK)
+    return SOUND_STATUS_FAIL;
+#endif
+  soundMixer_init();
+  sound_sampleRate = SOUND_DEFAULT_SAMPLE_RATE;
+  if (!soundMixer_setSampleRates(sound_sampleRate, sound_effects,
+                                 SOUND_EFFECT_COUNT))
+    return SOUND_STATUS_FAIL;
   sound_initFlag = true;
-  // Initialize the silence array.
-  for (uint32_t i = 0; i < ONE_SECOND_OF_SOUND_ARRAY_SIZE; i++)
-    soundOfSilence[i] = NO_SOUND;
   sound_setVolume(sound_minimumVolume_e); // Init the volume level.
   return SOUND_STATUS_OK;
 }
 
+// Reads ahead the sounds that are streamed from the SD card.
+void sound_service() {
+#ifdef SOUND_ASSETS_ON_SD
+  soundStream_service();
+#endif
+}
+
 // Standard tick function.
 static sound_st_t currentState = sound_init_st;
 
@@ -145,9 +257,18 @@ void debugStatePrint() {
   }
 }
 
+// Gives every requested sound a mixer voice.
+static void sound_startRequestedSounds() {
+  for (uint16_t i = 0; i < SOUND_EFFECT_COUNT; i++) {
+    if (!sound_startRequested[i])
+      continue;
+    sound_startRequested[i] = false;
+    soundMixer_play(&sound_effects[i]);
+  }
+}
+
 void sound_tick() {
   //  debugStatePrint();
-  static uint32_t arrayIndex = 0;
   // Action switch statement.
   switch (currentState) {
   case sound_init_st:
@@ -157,7 +278,8 @@ void sound_tick() {
     // Does nothing.
     break;
   case sound_play_st:
-    // Does nothing.
+    // Sounds started while others play are mixed in.
+    sound_startRequestedSounds();
     break;
   }
   // Transistion switch statement.
@@ -168,35 +290,44 @@ void sound_tick() {
     }
     break;
   case sound_wait_st:
-    if (sound_playSoundFlag) {
-      arrayIndex = 0;
+    // A voice may have been started after the last block was filled.
+    if (sound_playSoundFlag || soundMixer_isActive()) {
+      sound_startRequestedSounds();
+      sound_playSoundFlag = true;
       currentState = sound_play_st;
       sound_resetTxFifo();  // Reset the TX FIFO.
       sound_enableTxFifo(); // Enable the TX FIFO, disable mute.
+#ifdef SOUND_DMA
+      soundDma_start(soundMixer_mix, sound_currentVolume);
+#endif
     }
     break;
   case sound_play_st:
-    // Each time you enter this state, add as many samples as will fit in the
-    // FIFO.
-    if (sound_array == NULL) {
-      printf("ERROR, sound_tick: sound array has not been set.\n");
-      return;
+#ifdef SOUND_DMA
+    // The DMA fills the FIFO, this only keeps the ping-pong blocks going.
+    if (!soundDma_tick()) {
+      sound_playSoundFlag = false;  // All blocks are in the FIFO.
+      sound_disableTxFifo();        // Disable the TX FIFO.
+      currentState = sound_wait_st; // Go back to the wait state.
     }
-    // This while-loop continues to load sound-data into the FIFOs until it is
-    // full or the sound data are exhausted.
+#else
+    // This while-loop continues to load mixed samples into the FIFOs until it
+    // is full or every voice has ended.
     while (!(Xil_In32(AUDIO_CTRL_BASEADDR + I2S_FIFO_STS_REG) &
              0b0010)) { // while room in FIFO.
-      uint32_t sampleValue =
-          sound_array[arrayIndex] * sound_currentVolume; // Scale by volume.
-      sound_sendDataToBothChannels(
-          sampleValue); // Send the sound data to the left and right channels.
-      arrayIndex++;     // Go to next sample.
-      if (arrayIndex == sound_sampleCount) { // All done?
+      int16_t sample;
+      if (soundMixer_mix(&sample, 1) == 0) { // All done?
         sound_playSoundFlag = false;         // Yes.
         sound_disableTxFifo();               // Disable the TX FIFO.
         currentState = sound_wait_st;        // Go back to the wait state.
+        break;
       }
+      // Back to offset binary and scale by volume.
+      uint32_t sampleValue = (uint16_t)(sample ^ 0x8000) * sound_currentVolume;
+      sound_sendDataToBothChannels(
+          sampleValue); // Send the sound data to the left and right channels.
     }
+#endif
     break;
   }
 }
@@ -208,65 +339,33 @@ bool sound_isBusy() {
 
 // Stops the sound and resets the state-machine to the wait state.
 void sound_stopSound() {
+  for (uint16_t i = 0; i < SOUND_EFFECT_COUNT; i++)
+    sound_startRequested[i] = false;
+  soundMixer_stopAll(); // Silence every voice.
+#ifdef SOUND_DMA
+  soundDma_stop(); // Kill the block in flight.
+#endif
   sound_playSoundFlag = false; // disable the state-machine.
   currentState =
       sound_wait_st; // Force the state-machine back to the wait state.
 }
 
-// Use this to set the base address for the array containing sound data.
-// Allow sounds to be interrupted.
+// Selects the sound that sound_startSound() plays. Whatever is playing keeps
+// playing, the mixer plays both.
 void sound_setSound(sound_sounds_t sound) {
-  if (sound_isBusy()) { // You are currently playing some sound.
-    sound_stopSound(); // Stop the sound and reset the state-machine, FIFO, etc.
-  }
-  sound_array =
-      NULL; // Set the pointer to NULL so you can detect it never being set.
-  switch (sound) {
-  case sound_gameStart_e:
-    sound_array = gameBoyStartup_wav; // Set the array holding the data.
-    sound_sampleCount =
-        GAMEBOYSTARTUP_WAV_NUMBER_OF_SAMPLES; // Size of the array.
-    break;
-  case sound_gunFire_e:
-    sound_array = bcfire01_48k_wav; // Set the array holding the data.
-    sound_sampleCount =
-        BCFIRE01_48K_WAV_NUMBER_OF_SAMPLES; // Size of the array.
-    break;
-  case sound_hit_e:
-    sound_array = ouch48k_wav; // You get the idea...
-    sound_sampleCount = OUCH48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gunClick_e:
-    sound_array = gunEmpty48k_wav;
-    sound_sampleCount = GUNEMPTY48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gunReload_e:
-    sound_array = powerUp48k_wav;
-    sound_sampleCount = POWERUP48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_loseLife_e:
-    sound_array = screamAndDie48k_wav;
-    sound_sampleCount = SCREAMANDDIE48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_gameOver_e:
-    sound_array = pacmanDeath_wav;
-    sound_sampleCount = PACMANDEATH_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_returnToBase_e:
-    sound_array = gameOver48k_wav;
-    sound_sampleCount = GAMEOVER48K_WAV_NUMBER_OF_SAMPLES;
-    break;
-  case sound_oneSecondSilence_e:
-    sound_array = soundOfSilence;
-    sound_sampleCount = ONE_SECOND_OF_SOUND_ARRAY_SIZE;
-    break;
-  default:
+  if (sound >= SOUND_EFFECT_COUNT) {
     printf("sound_setSound(): bogus sound value(%d)\n", sound);
+    return;
   }
+  sound_selectedSound = sound;
 }
 
 // Tell the state machine to start playing the sound.
-void sound_startSound() { sound_playSoundFlag = true; }
+// sound_tick() gives it a mixer voice.
+void sound_startSound() {
+  sound_startRequested[sound_selectedSound] = true;
+  sound_playSoundFlag = true;
+}
 
 // Returns true if the sound has been played. State machine will have returned
 // to its initial state.
@@ -291,6 +390,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_service();
     if (!sound_isBusy())
       break;
   }
@@ -299,6 +399,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_service();
     if (!sound_isBusy())
       break;
   }
@@ -307,6 +408,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_service();
     if (!sound_isBusy())
       break;
   }
@@ -315,6 +417,7 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_service();
     if (!sound_isBusy())
       break;
   }
@@ -323,6 +426,17 @@ void sound_runTest() {
   sound_startSound();
   while (1) {
     sound_tick();
+    sound_service();
+    if (!sound_isBusy())
+      break;
+  }
+  // The mixer plays these together.
+  printf("playing hit_e over gunFire_e\n");
+  sound_playSound(sound_gunFire_e);
+  sound_playSound(sound_hit_e);
+  while (1) {
+    sound_tick();
+    sound_service();
     if (!sound_isBusy())
       break;
   }
@@ -391,7 +505,7 @@ int AudioRegSet(XIicPs *IIcPtr, u8 regAddr, u16 regData) {
   // while (XIicPs_BusIsBusy(IIcPtr)) {
   //   /* NOP */
   // }
-  // return XST_SUCCESS;
+  return XST_SUCCESS;
 }
 
 /***  AudioInitialize(u16 timerID,  u16 iicID, u32 i2sAddr)
@@ -514,15 +628,43 @@ int AudioInitialize(u16 timerID, u16 iicID, u32 i2sAddr) {
   // Not sure what the problem is, perhaps the DLL is not running at the correct
   // frequency? or, there is a bug in the IP that drives the CODEC. In any case,
   // the sampling rate is 48k.
-  i2sClkDiv = 3;
+  i2sClkDiv = sound_rates[0].bitClockDivider; // 48 kHz.
   // Set the LRCLK's to be BCLK / 64
-  i2sClkDiv = i2sClkDiv | (31 << 16);
+  i2sClkDiv = i2sClkDiv | (I2S_LRCLK_DIVIDER << 16);
   // Write clock div register
   Xil_Out32(i2sAddr + I2S_CLK_CTRL_REG, i2sClkDiv);
 
   return XST_SUCCESS;
 }
 
+// Set the sample rate. Should only do this when no sound is currently playing:
+// the mixer stops every voice while it redesigns its resampling filters. The
+// codec and the I2S clocks only change once the filters are ready.
+sound_status_t sound_setSampleRate(uint32_t sampleRate) {
+  const sound_rate_t *rate = NULL;
+  for (uint16_t i = 0; i < SOUND_RATE_COUNT; i++)
+    if (sound_rates[i].sampleRate == sampleRate)
+      rate = &sound_rates[i];
+  if (rate == NULL) {
+    printf("sound_setSampleRate(): %lu Hz is not supported.\n\r",
+           (unsigned long)sampleRate);
+    return SOUND_STATUS_FAIL;
+  }
+  if (!soundMixer_setSampleRates(sampleRate, sound_effects,
+                                 SOUND_EFFECT_COUNT)) {
+    soundMixer_setSampleRates(sound_sampleRate, sound_effects,
+                              SOUND_EFFECT_COUNT);
+    return SOUND_STATUS_FAIL;
+  }
+  if (AudioRegSet(&Iic, SSM2603_SAMPLING_CONTROL_REG, rate->samplingControl) !=
+      XST_SUCCESS)
+    return SOUND_STATUS_FAIL;
+  Xil_Out32(AUDIO_CTRL_BASEADDR + I2S_CLK_CTRL_REG,
+            rate->bitClockDivider | (I2S_LRCLK_DIVIDER << 16));
+  sound_sampleRate = sampleRate;
+  return SOUND_STATUS_OK;
+}
+
 /* ------------------------------------------------------------ */
 
 /***  I2SFifoWrite (u32 i2sBaseAddr, u32 audioData)
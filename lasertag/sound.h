@@ -65,13 +65,20 @@ sound_status_t sound_init();
 // Standard tick function.
 void sound_tick();
 
+// Reads ahead the sounds streamed from the SD card (SOUND_ASSETS_ON_SD, see
+// sounds/soundAssets.h); does nothing otherwise. Call from the main loop, the
+// reads are too slow for the tick.
+void sound_service();
+
 // Returns true if the sound state machine is not back in its initial state.
 bool sound_isBusy();
 
 // Use this to set the base address for the array containing sound data.
 void sound_setSound(sound_sounds_t sound);
 
-// Set the sample rate. Should only do this when no sound is currently playing.
+// Set the sample rate: 48000 (the default), 32000, 24000 or 16000 Hz. Every
+// sound is resampled to it. Should only do this when no sound is currently
+// playing.
 sound_status_t sound_setSampleRate(uint32_t sampleRate);
 
 // Used to set the volume. Use one of the provided values.
@@ -0,0 +1,212 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "soundDma.h"
+#include "xdmaps.h"
+#include "xil_cache.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BLOCK_COUNT 2 // Ping and pong.
+#define BLOCK_WORDS (2 * SOUND_DMA_BLOCK_FRAMES) // Left and right per frame.
+#define PROGRAM_SIZE 64 // Bytes, a block program is 33.
+#define CACHE_LINE_SIZE 32
+#define NO_BLOCK -1 // No block is being filled.
+#define OFFSET_BINARY_SIGN 0x8000 // XOR turns signed into offset binary.
+
+// PL330 instruction encodings (PL330 TRM, instruction set summary).
+#define DMAMOV 0xBC
+#define DMAMOV_SAR 0
+#define DMAMOV_CCR 1
+#define DMAMOV_DAR 2
+#define DMAFLUSHP 0x35
+#define DMALP0 0x20
+#define DMAWFP_SINGLE 0x30
+#define DMALD 0x04
+#define DMASTP_SINGLE 0x29
+#define DMALPEND0 0x38 // Counted loop on loop counter 0.
+#define DMAWMB 0x13
+#define DMASEV 0x34
+#define DMAEND 0x00
+#define DMALP_MAX_ITERATIONS 256
+
+#if BLOCK_WORDS > DMALP_MAX_ITERATIONS
+#error "A block must fit in a single DMALP loop."
+#endif
+
+// Channel control: single 4-byte transfers, incrementing source, fixed
+// destination (the FIFO register), no caching (the driver flushes the block).
+#define CCR_SRC_INC 0x1
+#define CCR_SRC_BURST_SIZE_4 (2 << 1)
+#define CCR_DST_BURST_SIZE_4 (2 << 15)
+#define BLOCK_CCR (CCR_SRC_INC | CCR_SRC_BURST_SIZE_4 | CCR_DST_BURST_SIZE_4)
+
+typedef struct {
+  uint32_t words[BLOCK_WORDS];
+  uint8_t program[PROGRAM_SIZE];
+  uint32_t frameCount; // Frames filled, 0 if the block holds nothing to play.
+  XDmaPs_Cmd command;
+} soundDma_block_t;
+
+static XDmaPs dma;
+static uint32_t fifoAddress;
+static soundDma_block_t blocks[BLOCK_COUNT]
+    __attribute__((aligned(CACHE_LINE_SIZE)));
+static soundDma_fillFunction_t fill; // Source of the samples.
+static uint32_t volume;
+static uint16_t playingBlock; // Block the DMA is writing.
+static int16_t fillingBlock;  // Block being filled a slice at a time.
+static bool fillEnded;        // fill has returned fewer samples than asked.
+static volatile bool active;  // A block is in flight.
+
+sound_status_t soundDma_init(uint32_t newFifoAddress) {
+  fifoAddress = newFifoAddress;
+  active = false;
+  XDmaPs_Config *config = XDmaPs_LookupConfig(SOUND_DMA_DEVICE_ID);
+  if (config == NULL ||
+      XDmaPs_CfgInitialize(&dma, config, config->BaseAddress) != XST_SUCCESS) {
+    printf("soundDma_init: cannot initialize the DMA controller.\n\r");
+    return SOUND_STATUS_FAIL;
+  }
+  return SOUND_STATUS_OK;
+}
+
+// Appends a DMAMOV of value into register.
+static uint16_t soundDma_emitMov(uint8_t *program, uint8_t reg,
+                                 uint32_t value) {
+  program[0] = DMAMOV;
+  program[1] = reg;
+  memcpy(&program[2], &value, sizeof(value)); // Little endian, unaligned.
+  return 2 + sizeof(value);
+}
+
+// Writes the program that copies the block to the FIFO one word per DMA
+// request, then signals the channel's event. Flushes it so the DMA sees it.
+static void soundDma_buildProgram(soundDma_block_t *block) {
+  uint8_t *program = block->program;
+  uint16_t length = 0;
+  length += soundDma_emitMov(&program[length], DMAMOV_SAR,
+                             (uint32_t)(uintptr_t)block->words);
+  length += soundDma_emitMov(&program[length], DMAMOV_DAR, fifoAddress);
+  length += soundDma_emitMov(&program[length], DMAMOV_CCR, BLOCK_CCR);
+  program[length++] = DMAFLUSHP;
+  program[length++] = SOUND_DMA_PERIPHERAL << 3;
+  program[length++] = DMALP0;
+  program[length++] = 2 * block->frameCount - 1; // Iterations - 1.
+  uint16_t loopStart = length;
+  program[length++] = DMAWFP_SINGLE;
+  program[length++] = SOUND_DMA_PERIPHERAL << 3;
+  program[length++] = DMALD;
+  program[length++] = DMASTP_SINGLE;
+  program[length++] = SOUND_DMA_PERIPHERAL << 3;
+  program[length] = DMALPEND0;
+  program[length + 1] = length - loopStart; // Backward jump to the loop body.
+  length += 2;
+  program[length++] = DMAWMB;
+  program[length++] = DMASEV;
+  program[length++] = SOUND_DMA_CHANNEL << 3;
+  program[length++] = DMAEND;
+  Xil_DCacheFlushRange((INTPTR)program, PROGRAM_SIZE);
+  memset(&block->command, 0, sizeof(block->command));
+  block->command.UserDmaProg = program;
+  block->command.UserDmaProgLength = length;
+  // XDmaPs_Start() flushes the source range when SrcInc is set.
+  block->command.ChanCtrl.SrcInc = 1;
+  block->command.BD.SrcAddr = (u32)(uintptr_t)block->words;
+  block->command.BD.Length = 2 * block->frameCount * sizeof(uint32_t);
+}
+
+// Scales and duplicates up to SOUND_DMA_SLICE_FRAMES more samples into block,
+// without going past frameLimit. The samples go back to offset binary, the
+// format sound_tick() has always written to the FIFO. Returns true once the
+// block is full or fill has run dry, and builds its program if it has
+// anything to play.
+static bool soundDma_fillSlice(soundDma_block_t *block, uint32_t frameLimit) {
+  int16_t samples[SOUND_DMA_SLICE_FRAMES];
+  uint32_t count = frameLimit - block->frameCount;
+  if (count > SOUND_DMA_SLICE_FRAMES)
+    count = SOUND_DMA_SLICE_FRAMES;
+  uint32_t frameCount = fillEnded ? 0 : fill(samples, count);
+  fillEnded |= frameCount < count;
+  uint32_t *words = &block->words[2 * block->frameCount];
+  for (uint32_t i = 0; i < frameCount; i++) {
+    uint32_t sampleValue =
+        (uint16_t)(samples[i] ^ OFFSET_BINARY_SIGN) * volume;
+    words[2 * i] = sampleValue;     // Left channel.
+    words[2 * i + 1] = sampleValue; // Right channel.
+  }
+  block->frameCount += frameCount;
+  if (!fillEnded && block->frameCount < frameLimit)
+    return false;
+  if (block->frameCount > 0)
+    soundDma_buildProgram(block);
+  return true;
+}
+
+// Hands block to the DMA channel. Returns false if it holds nothing.
+static bool soundDma_startBlock(uint16_t block) {
+  if (blocks[block].frameCount == 0)
+    return false;
+  playingBlock = block;
+  if (XDmaPs_Start(&dma, SOUND_DMA_CHANNEL, &blocks[block].command, 0) !=
+      XST_SUCCESS) {
+    printf("soundDma: cannot start the DMA channel.\n\r");
+    return false;
+  }
+  return true;
+}
+
+void soundDma_start(soundDma_fillFunction_t newFill, uint32_t newVolume) {
+  soundDma_stop();
+  fill = newFill;
+  volume = newVolume;
+  fillEnded = false;
+  for (uint16_t i = 0; i < BLOCK_COUNT; i++)
+    blocks[i].frameCount = 0;
+  // A short first block, so starting costs one slice.
+  soundDma_fillSlice(&blocks[0], SOUND_DMA_SLICE_FRAMES);
+  fillingBlock = 1;
+  active = soundDma_startBlock(0);
+}
+
+void soundDma_setVolume(uint32_t newVolume) { volume = newVolume; }
+
+// Fills a slice of the idle block, then checks for the event the channel
+// raises when the block program reaches DMASEV.
+bool soundDma_tick() {
+  if (!active)
+    return false;
+  if (fillingBlock != NO_BLOCK &&
+      soundDma_fillSlice(&blocks[fillingBlock], SOUND_DMA_BLOCK_FRAMES))
+    fillingBlock = NO_BLOCK;
+  if (!(XDmaPs_ReadReg(dma.Config.BaseAddress, XDMAPS_INTSTATUS_OFFSET) &
+        (1 << SOUND_DMA_CHANNEL)))
+    return true;
+  // Clears the event and releases the channel, as the done interrupt would.
+  XDmaPs_DoneISR_0(&dma);
+  uint16_t finishedBlock = playingBlock;
+  uint16_t nextBlock = (finishedBlock + 1) % BLOCK_COUNT;
+  // Not filled in time: play what it has rather than stall.
+  if (fillingBlock == nextBlock && blocks[nextBlock].frameCount > 0)
+    soundDma_buildProgram(&blocks[nextBlock]);
+  active = soundDma_startBlock(nextBlock);
+  blocks[finishedBlock].frameCount = 0;
+  fillingBlock = fillEnded ? NO_BLOCK : finishedBlock;
+  return active;
+}
+
+void soundDma_stop() {
+  fillingBlock = NO_BLOCK;
+  if (!active)
+    return;
+  active = false;
+  XDmaPs_ResetChannel(&dma, SOUND_DMA_CHANNEL);
+  // Drop the command and event of the killed block.
+  XDmaPs_DoneISR_0(&dma);
+}
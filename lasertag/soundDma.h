@@ -0,0 +1,66 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDDMA_H_
+#define SOUNDDMA_H_
+
+#include "sound.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Plays mono audio into the I2S TX FIFO with the PL330 DMA controller instead
+// of one Xil_Out32() per channel per sample.
+// - The audio comes from a fill function (soundMixer_mix()) and goes through
+//   two ping-pong blocks of SOUND_DMA_BLOCK_FRAMES stereo frames. Filling a
+//   block scales each sample by the volume and writes it twice (left and
+//   right), so the DMA only copies words.
+// - The mixer decodes ADPCM while it fills, which takes too long for a whole
+//   block in one 10 us tick. So each soundDma_tick() fills at most
+//   SOUND_DMA_SLICE_FRAMES samples of the idle block, and the first block
+//   after soundDma_start() is a single slice. Fill returning fewer samples
+//   than asked ends the sound: that block is the last one.
+// - Each block has its own small DMA program that waits for the I2S TX DMA
+//   request (PL330 peripheral SOUND_DMA_PERIPHERAL) before every word, so the
+//   DMA never overruns the FIFO. The hardware design must connect the I2S TX
+//   request to that PL330 peripheral request input.
+// - The GIC is set up by interrupts_initAll(), so completion is polled:
+//   soundDma_tick() checks the channel's event, starts the other block and
+//   refills the finished one. At 48 kHz that is one block every 2.7 ms.
+
+#define SOUND_DMA_DEVICE_ID XPAR_XDMAPS_1_DEVICE_ID // Secure PL330.
+#define SOUND_DMA_CHANNEL 0
+#define SOUND_DMA_PERIPHERAL 0 // PL330 peripheral request from the I2S core.
+#define SOUND_DMA_BLOCK_FRAMES 128 // Stereo frames per ping-pong block.
+#define SOUND_DMA_SLICE_FRAMES 32  // Frames filled per soundDma_tick().
+
+// Writes up to frameCount signed samples into samples and returns how many it
+// wrote, 0 when there is nothing left to play.
+typedef uint32_t (*soundDma_fillFunction_t)(int16_t samples[],
+                                            uint32_t frameCount);
+
+// Sets up the PL330 driver. fifoAddress is the I2S TX FIFO register.
+sound_status_t soundDma_init(uint32_t fifoAddress);
+
+// Starts playing what fill returns, each sample scaled by volume. Stops
+// whatever was playing.
+void soundDma_start(soundDma_fillFunction_t fill, uint32_t volume);
+
+// Changes the volume, starting with the next block that is filled.
+void soundDma_setVolume(uint32_t volume);
+
+// Keeps the DMA going. Call from sound_tick() at least
+// SOUND_DMA_BLOCK_FRAMES / SOUND_DMA_SLICE_FRAMES times per block, every
+// SOUND_DMA_SLICE_FRAMES samples or more often. Returns false once fill has run
+// dry and the last block has been written to the FIFO.
+bool soundDma_tick();
+
+// Stops the DMA channel.
+void soundDma_stop();
+
+#endif /* SOUNDDMA_H_ */
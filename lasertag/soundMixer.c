@@ -0,0 +1,524 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "soundMixer.h"
+#include "adpcm.h"
+#include "resampler.h"
+#include "soundStream.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#define NEON_LANE_COUNT 8 // int16 lanes in a NEON register.
+#define MAX_STREAM_WAIT                                                        \
+  (SOUND_MIXER_DEFAULT_SAMPLE_RATE / 10) // Output samples, about 100 ms.
+
+typedef struct {
+  soundMixer_sound_t sound;
+  adpcm_decoder_t decoder;  // Also counts the samples of a silent voice.
+  const resampler_filter_t *filter; // NULL if the sound is at the output rate.
+  resampler_t resampler;
+  soundStream_t *stream; // NULL if the sound is in memory.
+  int16_t input[SOUND_MIXER_DECODE_SIZE]; // Decoded, not yet resampled.
+  uint16_t inputPosition;
+  uint16_t inputCount;
+  uint32_t startOrder; // Lower started earlier.
+  uint32_t waitCount;  // Output samples waited for the first block.
+  bool waiting;        // Streamed, the first block is not read yet.
+  bool active;
+} soundMixer_voice_t;
+
+static soundMixer_voice_t voices[SOUND_MIXER_VOICE_COUNT];
+static uint32_t startCount; // Hands out startOrder.
+static uint32_t outputRate;
+static resampler_filter_t filters[SOUND_MIXER_FILTER_COUNT];
+static uint16_t filterCount;
+
+void soundMixer_init() {
+  soundMixer_stopAll();
+  memset(voices, 0, sizeof(voices));
+  startCount = 0;
+  outputRate = SOUND_MIXER_DEFAULT_SAMPLE_RATE;
+  filterCount = 0;
+}
+
+// A sound without data, neither in memory nor on the SD card.
+static bool soundMixer_isSilence(const soundMixer_sound_t *sound) {
+  return !sound->adpcm && !sound->streamed;
+}
+
+// Ends the sound on voice and gives back its stream.
+static void soundMixer_release(soundMixer_voice_t *voice) {
+  voice->active = false;
+  if (voice->stream)
+    soundStream_close(voice->stream);
+  voice->stream = NULL;
+}
+
+// Returns the filter from sampleRate to the output rate, NULL if there is
+// none.
+static const resampler_filter_t *soundMixer_findFilter(uint32_t sampleRate) {
+  for (uint16_t i = 0; i < filterCount; i++)
+    if (filters[i].inputRate == sampleRate)
+      return &filters[i];
+  return NULL;
+}
+
+bool soundMixer_setSampleRates(uint32_t newOutputRate,
+                               const soundMixer_sound_t sounds[],
+                               uint16_t soundCount) {
+  soundMixer_stopAll();
+  outputRate = newOutputRate;
+  filterCount = 0;
+  for (uint16_t i = 0; i < soundCount; i++) {
+    uint32_t sampleRate = sounds[i].sampleRate;
+    if (soundMixer_isSilence(&sounds[i]) || sampleRate == outputRate ||
+        soundMixer_findFilter(sampleRate))
+      continue;
+    if (filterCount == SOUND_MIXER_FILTER_COUNT ||
+        !resampler_initFilter(&filters[filterCount], sampleRate, outputRate)) {
+      printf("soundMixer_setSampleRates: cannot play %lu Hz at %lu Hz.\n\r",
+             (unsigned long)sampleRate, (unsigned long)outputRate);
+      return false;
+    }
+    filterCount++;
+  }
+  return true;
+}
+
+// A free voice, else the lowest priority and oldest voice.
+static int16_t soundMixer_findVoice(uint8_t priority) {
+  int16_t victim = SOUND_MIXER_NO_VOICE;
+  for (int16_t i = 0; i < SOUND_MIXER_VOICE_COUNT; i++) {
+    const soundMixer_voice_t *voice = &voices[i];
+    if (!voice->active)
+      return i;
+    if (voice->sound.priority > priority)
+      continue;
+    if (victim == SOUND_MIXER_NO_VOICE ||
+        voice->sound.priority < voices[victim].sound.priority ||
+        (voice->sound.priority == voices[victim].sound.priority &&
+         voice->startOrder < voices[victim].startOrder))
+      victim = i;
+  }
+  return victim;
+}
+
+// Silence is not resampled, its length is converted to the output rate.
+int16_t soundMixer_play(const soundMixer_sound_t *sound) {
+  const resampler_filter_t *filter = NULL;
+  uint32_t sampleCount = sound->sampleCount;
+  if (soundMixer_isSilence(sound))
+    sampleCount = (uint64_t)sampleCount * outputRate / sound->sampleRate;
+  else if (sound->sampleRate != outputRate &&
+           !(filter = soundMixer_findFilter(sound->sampleRate)))
+    return SOUND_MIXER_NO_VOICE;
+  if (sound->loopEnd != SOUND_MIXER_NO_LOOP &&
+      (sound->loopEnd <= sound->loopStart ||
+       sound->loopEnd > sound->sampleCount))
+    return SOUND_MIXER_NO_VOICE;
+  int16_t victim = soundMixer_findVoice(sound->priority);
+  if (victim == SOUND_MIXER_NO_VOICE || sampleCount == 0)
+    return SOUND_MIXER_NO_VOICE;
+  soundMixer_voice_t *voice = &voices[victim];
+  soundMixer_release(voice);
+  if (sound->streamed) {
+    voice->stream =
+        soundStream_open(sound->bankOffset, ADPCM_ENCODED_SIZE(sampleCount));
+    if (!voice->stream)
+      return SOUND_MIXER_NO_VOICE;
+    adpcm_initStreamDecoder(&voice->decoder, soundStream_getBlock,
+                            voice->stream, sampleCount);
+  } else {
+    adpcm_initDecoder(&voice->decoder, sound->adpcm, sampleCount);
+  }
+  voice->sound = *sound;
+  voice->filter = filter;
+  if (filter)
+    resampler_init(&voice->resampler, filter);
+  voice->inputPosition = 0;
+  voice->inputCount = 0;
+  voice->startOrder = startCount++;
+  voice->waitCount = 0;
+  voice->waiting = sound->streamed;
+  voice->active = true;
+  return victim;
+}
+
+void soundMixer_stop(int16_t voice) { soundMixer_release(&voices[voice]); }
+
+void soundMixer_stopAll() {
+  for (int16_t i = 0; i < SOUND_MIXER_VOICE_COUNT; i++)
+    soundMixer_release(&voices[i]);
+}
+
+bool soundMixer_isActive() {
+  for (int16_t i = 0; i < SOUND_MIXER_VOICE_COUNT; i++)
+    if (voices[i].active)
+      return true;
+  return false;
+}
+
+bool soundMixer_isVoiceActive(int16_t voice) { return voices[voice].active; }
+
+// output[i] += samples[i] * gain with int16 saturation. The gain product is
+// (x * gain) >> 15, which is what vqdmulh computes.
+static void soundMixer_mixSamples(int16_t output[], const int16_t samples[],
+                                  uint32_t count, int16_t gain) {
+  uint32_t i = 0;
+#if defined(__ARM_NEON)
+  for (; i + NEON_LANE_COUNT <= count; i += NEON_LANE_COUNT) {
+    int16x8_t x = vld1q_s16(&samples[i]);
+    int16x8_t sum = vqaddq_s16(vld1q_s16(&output[i]), vqdmulhq_n_s16(x, gain));
+    vst1q_s16(&output[i], sum);
+  }
+#endif
+  for (; i < count; i++) {
+    int32_t x = samples[i];
+    int32_t sum = output[i] + ((x * gain) >> 15);
+    if (sum > INT16_MAX)
+      sum = INT16_MAX;
+    else if (sum < INT16_MIN)
+      sum = INT16_MIN;
+    output[i] = sum;
+  }
+}
+
+// Decodes up to count samples of the sound at its own rate, going back to the
+// loop start at the loop end. Returns fewer than count only at the end.
+static uint32_t soundMixer_decode(soundMixer_voice_t *voice, int16_t samples[],
+                                  uint32_t count) {
+  adpcm_decoder_t *decoder = &voice->decoder;
+  const soundMixer_sound_t *sound = &voice->sound;
+  uint32_t decodedCount = 0;
+  while (decodedCount < count) {
+    uint32_t chunkSize = count - decodedCount;
+    if (sound->loopEnd != SOUND_MIXER_NO_LOOP) {
+      if (decoder->position == sound->loopEnd)
+        adpcm_seek(decoder, sound->loopStart);
+      if (chunkSize > sound->loopEnd - decoder->position)
+        chunkSize = sound->loopEnd - decoder->position;
+    }
+    uint32_t chunkCount =
+        adpcm_decode(decoder, &samples[decodedCount], chunkSize);
+    decodedCount += chunkCount;
+    if (chunkCount < chunkSize)
+      break;
+  }
+  return decodedCount;
+}
+
+// Converts decoded samples to the output rate, decoding more as the resampler
+// uses them up. Returns fewer than count only at the end.
+static uint32_t soundMixer_resample(soundMixer_voice_t *voice,
+                                    int16_t samples[], uint32_t count) {
+  uint32_t producedCount = 0;
+  while (producedCount < count) {
+    if (voice->inputPosition == voice->inputCount) {
+      voice->inputCount =
+          soundMixer_decode(voice, voice->input, SOUND_MIXER_DECODE_SIZE);
+      voice->inputPosition = 0;
+      if (voice->inputCount == 0)
+        break;
+    }
+    uint32_t consumedCount;
+    producedCount += resampler_process(
+        &voice->resampler, &voice->input[voice->inputPosition],
+        voice->inputCount - voice->inputPosition, &consumedCount,
+        &samples[producedCount], count - producedCount);
+    voice->inputPosition += consumedCount;
+  }
+  return producedCount;
+}
+
+// Adds the next count output samples of voice into output, a chunk at a time.
+// Returns how many there were.
+static uint32_t soundMixer_mixVoice(int16_t output[], soundMixer_voice_t *voice,
+                                    uint32_t count) {
+  adpcm_decoder_t *decoder = &voice->decoder;
+  // The first block of a streamed sound is read by the main loop, long after
+  // the voice starts. Until then the voice holds its place. If the card never
+  // delivers, it gives up and plays the missing block as silence.
+  if (voice->waiting) {
+    if (!adpcm_isReady(decoder) && voice->waitCount < MAX_STREAM_WAIT) {
+      voice->waitCount += count;
+      return count;
+    }
+    voice->waiting = false;
+  }
+  if (soundMixer_isSilence(&voice->sound)) {
+    uint32_t remaining = decoder->sampleCount - decoder->position;
+    count = count < remaining ? count : remaining;
+    decoder->position += count;
+    return count;
+  }
+  int16_t decoded[SOUND_MIXER_DECODE_SIZE];
+  uint32_t mixedCount = 0;
+  while (mixedCount < count) {
+    uint32_t chunkSize = count - mixedCount;
+    if (chunkSize > SOUND_MIXER_DECODE_SIZE)
+      chunkSize = SOUND_MIXER_DECODE_SIZE;
+    uint32_t decodedCount =
+        voice->filter ? soundMixer_resample(voice, decoded, chunkSize)
+                      : soundMixer_decode(voice, decoded, chunkSize);
+    soundMixer_mixSamples(&output[mixedCount], decoded, decodedCount,
+                          voice->sound.gain);
+    mixedCount += decodedCount;
+    if (decodedCount < chunkSize)
+      break;
+  }
+  return mixedCount;
+}
+
+// A voice that comes up short has ended. One that ends exactly at the end of
+// a block stays active for one more, empty, call.
+uint32_t soundMixer_mix(int16_t output[], uint32_t frameCount) {
+  memset(output, 0, frameCount * sizeof(output[0]));
+  uint32_t mixedCount = 0;
+  for (int16_t i = 0; i < SOUND_MIXER_VOICE_COUNT; i++) {
+    soundMixer_voice_t *voice = &voices[i];
+    if (!voice->active)
+      continue;
+    uint32_t count = soundMixer_mixVoice(output, voice, frameCount);
+    if (count < frameCount)
+      soundMixer_release(voice);
+    if (count > mixedCount)
+      mixedCount = count;
+  }
+  return mixedCount;
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_BLOCK_SIZE 37 // Not a multiple of the NEON width.
+#define TEST_SAMPLE_COUNT 300 // More than one ADPCM block.
+#define TEST_HALF_GAIN (SOUND_MIXER_UNITY_GAIN / 2 + 1) // 0.5 in Q15.
+#define TEST_LOOP_START ADPCM_BLOCK_SAMPLES // The seek is free.
+#define TEST_LOOP_COUNT 3 // Times the loop is checked.
+#define TEST_HALF_RATE (SOUND_MIXER_DEFAULT_SAMPLE_RATE / 2) // Resampled 2x.
+#define TEST_BAD_RATE 8000 // More than resampler.c can convert.
+#define TEST_PRIORITY_COUNT 4 // Priorities 0 to 3.
+#define TEST_STREAM_WAIT_BLOCKS 3 // Mixed before the first block arrives.
+
+static bool testBlocksReady; // soundMixer_testGetBlock() has the blocks.
+
+// Prints and returns false if actual != expected.
+static bool soundMixer_testEqual(const char *name, int32_t actual,
+                                 int32_t expected) {
+  if (actual == expected)
+    return true;
+  printf("soundMixer_runTest: %s is %ld, expected %ld.\n\r", name,
+         (long)actual, (long)expected);
+  return false;
+}
+
+// Encodes count samples into adpcm[] and decodes them back into decoded[],
+// which is what the mixer plays.
+static void soundMixer_testEncode(const int16_t samples[], uint32_t count,
+                                  uint8_t adpcm[], int16_t decoded[]) {
+  adpcm_decoder_t decoder;
+  adpcm_encode(samples, count, adpcm);
+  adpcm_initDecoder(&decoder, adpcm, count);
+  adpcm_decode(&decoder, decoded, count);
+}
+
+// Block source of a streamed test sound: the blocks of the array in context,
+// once testBlocksReady is set.
+static const uint8_t *soundMixer_testGetBlock(void *context, uint32_t block) {
+  if (!testBlocksReady)
+    return NULL;
+  return &((const uint8_t *)context)[block * ADPCM_BLOCK_SIZE];
+}
+
+// Mixes until every voice has ended and returns the number of samples.
+static uint32_t soundMixer_testMixAll() {
+  int16_t output[TEST_BLOCK_SIZE];
+  uint32_t count = 0, mixedCount;
+  while ((mixedCount = soundMixer_mix(output, TEST_BLOCK_SIZE)) > 0)
+    count += mixedCount;
+  return count;
+}
+
+// Mixes a ramp with a constant and a silent voice, a loud pair that
+// saturates, then fills the voices and steals them. Then plays a loop, a
+// streamed sound whose first block is late and resampled sounds.
+bool soundMixer_runTest() {
+  printf("******** soundMixer_runTest() **********\n\r");
+  static int16_t samples[TEST_SAMPLE_COUNT], ramp[TEST_SAMPLE_COUNT],
+      level[TEST_SAMPLE_COUNT / 2], loud[TEST_SAMPLE_COUNT];
+  static uint8_t rampAdpcm[ADPCM_ENCODED_SIZE(TEST_SAMPLE_COUNT)],
+      levelAdpcm[ADPCM_ENCODED_SIZE(TEST_SAMPLE_COUNT / 2)],
+      loudAdpcm[ADPCM_ENCODED_SIZE(TEST_SAMPLE_COUNT)];
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    samples[i] = 100 * i; // 0 to 29900.
+  soundMixer_testEncode(samples, TEST_SAMPLE_COUNT, rampAdpcm, ramp);
+  for (uint32_t i = 0; i < TEST_SAMPLE_COUNT; i++)
+    samples[i] = i < TEST_SAMPLE_COUNT / 2 ? -2000 : 30000;
+  soundMixer_testEncode(samples, TEST_SAMPLE_COUNT / 2, levelAdpcm, level);
+  soundMixer_testEncode(&samples[TEST_SAMPLE_COUNT / 2], TEST_SAMPLE_COUNT / 2,
+                        loudAdpcm, loud);
+  const uint32_t rate = SOUND_MIXER_DEFAULT_SAMPLE_RATE;
+  const soundMixer_sound_t rampSound = {.adpcm = rampAdpcm,
+                                         .sampleCount = TEST_SAMPLE_COUNT - 1,
+                                         .sampleRate = rate,
+                                         .loopStart = 0,
+                                         .loopEnd = SOUND_MIXER_NO_LOOP,
+                                         .gain = SOUND_MIXER_UNITY_GAIN,
+                                         .priority = 1,
+                                         .streamed = false,
+                                         .bankOffset = 0};
+  soundMixer_sound_t levelSound = rampSound;
+  levelSound.adpcm = levelAdpcm;
+  levelSound.sampleCount = TEST_SAMPLE_COUNT / 2;
+  levelSound.gain = TEST_HALF_GAIN;
+  soundMixer_sound_t silence = rampSound;
+  silence.adpcm = NULL;
+  silence.sampleCount = TEST_SAMPLE_COUNT;
+  silence.gain = 0;
+  soundMixer_sound_t loudSound = rampSound;
+  loudSound.adpcm = loudAdpcm;
+  loudSound.sampleCount = TEST_SAMPLE_COUNT / 2;
+  bool success = true;
+  int16_t output[TEST_BLOCK_SIZE];
+  soundMixer_init();
+  // The ramp at unity gain plus a shorter constant at half gain and a longer
+  // silence, which sets the length.
+  soundMixer_play(&rampSound);
+  soundMixer_play(&levelSound);
+  soundMixer_play(&silence);
+  uint32_t position = 0, blockCount = 0;
+  uint32_t mixedCount;
+  while ((mixedCount = soundMixer_mix(output, TEST_BLOCK_SIZE)) > 0) {
+    for (uint32_t i = 0; i < mixedCount; i++, position++) {
+      int32_t expected = 0;
+      if (position < TEST_SAMPLE_COUNT - 1)
+        expected += (ramp[position] * SOUND_MIXER_UNITY_GAIN) >> 15;
+      if (position < TEST_SAMPLE_COUNT / 2)
+        expected += (level[position] * TEST_HALF_GAIN) >> 15;
+      if (output[i] != expected) {
+        success &= soundMixer_testEqual("mixed sample", output[i], expected);
+        break;
+      }
+    }
+    blockCount++;
+  }
+  success &= soundMixer_testEqual("mixed samples", position, TEST_SAMPLE_COUNT);
+  success &= soundMixer_testEqual("blocks", blockCount,
+                                  (TEST_SAMPLE_COUNT + TEST_BLOCK_SIZE - 1) /
+                                      TEST_BLOCK_SIZE);
+  success &= soundMixer_testEqual("active after the end", soundMixer_isActive(),
+                                  false);
+  // Two loud voices clip instead of wrapping around.
+  soundMixer_play(&loudSound);
+  soundMixer_play(&loudSound);
+  soundMixer_mix(output, TEST_BLOCK_SIZE);
+  success &= soundMixer_testEqual("saturated sample", output[0], INT16_MAX);
+  soundMixer_stopAll();
+  // Fill every voice, then steal: lowest priority first, then the oldest.
+  soundMixer_sound_t prioritySounds[TEST_PRIORITY_COUNT];
+  for (uint16_t i = 0; i < TEST_PRIORITY_COUNT; i++) {
+    prioritySounds[i] = rampSound;
+    prioritySounds[i].priority = i;
+  }
+  uint8_t priorities[SOUND_MIXER_VOICE_COUNT] = {2, 1, 2, 3};
+  for (int16_t i = 0; i < SOUND_MIXER_VOICE_COUNT; i++)
+    success &= soundMixer_testEqual(
+        "free voice", soundMixer_play(&prioritySounds[priorities[i]]), i);
+  success &= soundMixer_testEqual("voice stolen from priority 1",
+                                  soundMixer_play(&prioritySounds[2]), 1);
+  success &= soundMixer_testEqual("oldest priority 2 voice stolen",
+                                  soundMixer_play(&prioritySounds[2]), 0);
+  success &= soundMixer_testEqual("low priority sound",
+                                  soundMixer_play(&prioritySounds[0]),
+                                  SOUND_MIXER_NO_VOICE);
+  soundMixer_stop(3);
+  success &= soundMixer_testEqual("stopped voice",
+                                  soundMixer_isVoiceActive(3), false);
+  soundMixer_stopAll();
+  // The loop goes back to a block boundary until the voice is stopped.
+  soundMixer_sound_t loopSound = rampSound;
+  loopSound.sampleCount = TEST_SAMPLE_COUNT;
+  loopSound.loopStart = TEST_LOOP_START;
+  loopSound.loopEnd = TEST_SAMPLE_COUNT;
+  soundMixer_play(&loopSound);
+  const uint32_t loopLength = TEST_SAMPLE_COUNT - TEST_LOOP_START;
+  bool looped = true;
+  for (position = 0;
+       looped && position < TEST_SAMPLE_COUNT + TEST_LOOP_COUNT * loopLength;) {
+    mixedCount = soundMixer_mix(output, TEST_BLOCK_SIZE);
+    looped = soundMixer_testEqual("looped block", mixedCount, TEST_BLOCK_SIZE);
+    for (uint32_t i = 0; looped && i < mixedCount; i++, position++) {
+      uint32_t sample = position < TEST_SAMPLE_COUNT
+                            ? position
+                            : TEST_LOOP_START +
+                                  (position - TEST_SAMPLE_COUNT) % loopLength;
+      int32_t expected = (ramp[sample] * SOUND_MIXER_UNITY_GAIN) >> 15;
+      looped = soundMixer_testEqual("looped sample", output[i], expected);
+    }
+  }
+  success &= looped;
+  soundMixer_stopAll();
+  // A streamed sound whose first block arrives late starts from its first
+  // sample. The voice is set up as soundMixer_play() does for a streamed
+  // sound, with a block source in place of the SD card.
+  int16_t streamVoice = soundMixer_play(&rampSound);
+  adpcm_initStreamDecoder(&voices[streamVoice].decoder, soundMixer_testGetBlock,
+                          rampAdpcm, rampSound.sampleCount);
+  voices[streamVoice].waiting = true;
+  testBlocksReady = false;
+  for (uint16_t i = 0; i < TEST_STREAM_WAIT_BLOCKS; i++) {
+    soundMixer_mix(output, TEST_BLOCK_SIZE);
+    for (uint32_t j = 0; j < TEST_BLOCK_SIZE; j++)
+      if (output[j] != 0) {
+        success &= soundMixer_testEqual("sample before the block", output[j],
+                                        0);
+        break;
+      }
+  }
+  testBlocksReady = true;
+  bool streamed = true;
+  for (position = 0;
+       streamed && (mixedCount = soundMixer_mix(output, TEST_BLOCK_SIZE)) > 0;)
+    for (uint32_t i = 0; streamed && i < mixedCount; i++, position++)
+      streamed = soundMixer_testEqual(
+          "streamed sample", output[i],
+          (ramp[position] * SOUND_MIXER_UNITY_GAIN) >> 15);
+  success &= streamed;
+  success &= soundMixer_testEqual("streamed samples", position,
+                                  rampSound.sampleCount);
+  soundMixer_stopAll();
+  // A half-rate sound plays twice as long, silence too. A rate without a
+  // filter does not play.
+  soundMixer_sound_t halfRateSounds[2] = {loopSound, silence};
+  halfRateSounds[0].loopEnd = SOUND_MIXER_NO_LOOP;
+  halfRateSounds[0].sampleRate = TEST_HALF_RATE;
+  halfRateSounds[1].sampleRate = TEST_HALF_RATE;
+  success &= soundMixer_setSampleRates(rate, halfRateSounds, 2);
+  soundMixer_play(&halfRateSounds[0]);
+  success &= soundMixer_testEqual("resampled samples", soundMixer_testMixAll(),
+                                  2 * TEST_SAMPLE_COUNT);
+  soundMixer_play(&halfRateSounds[1]);
+  success &= soundMixer_testEqual("half-rate silence", soundMixer_testMixAll(),
+                                  2 * TEST_SAMPLE_COUNT);
+  soundMixer_sound_t badRateSound = rampSound;
+  badRateSound.sampleRate = TEST_BAD_RATE;
+  success &= soundMixer_testEqual("sound without a filter",
+                                  soundMixer_play(&badRateSound),
+                                  SOUND_MIXER_NO_VOICE);
+  success &= !soundMixer_setSampleRates(rate, &badRateSound, 1);
+  soundMixer_init();
+  printf("soundMixer_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
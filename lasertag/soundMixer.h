@@ -0,0 +1,102 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDMIXER_H_
+#define SOUNDMIXER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Mixes up to SOUND_MIXER_VOICE_COUNT sounds at once, so a gunshot no longer
+// cuts off a hit sound.
+// - Each voice plays one sound descriptor: an IMA-ADPCM stream (see adpcm.h)
+//   with its sample rate, optional loop points, default Q15 gain and
+//   priority. soundMixer_mix() decodes every active voice
+//   SOUND_MIXER_DECODE_SIZE samples at a time and adds it into a block of
+//   signed 16-bit samples with saturation, so nothing is decoded ahead of the
+//   block being played.
+// - A sound recorded at another rate than the output goes through a polyphase
+//   resampler (resampler.h). soundMixer_setSampleRates() designs the filters
+//   for every rate in the sound table, outside the ISR.
+// - A sound without data plays silence: the voice only counts its samples.
+// - A streamed sound is read from the SD card (soundStream.h) instead of
+//   memory, through a stream the voice holds while it plays. The voice stays
+//   silent, without moving, until the first block has been read, so the
+//   attack of the sound is delayed instead of lost.
+// - A new sound takes a free voice. If there is none, it steals the voice with
+//   the lowest priority (the oldest one if several tie), but only if that
+//   priority is not above its own.
+// - The inner loop uses NEON on the board (__ARM_NEON, the Zybo build compiles
+//   this file with -mfpu=neon), 8 samples per instruction, and plain C
+//   elsewhere and for the last few samples of a voice.
+// soundMixer_play() and soundMixer_mix() must be called from the same context
+// (sound_tick()), the voices are not locked.
+
+#define SOUND_MIXER_VOICE_COUNT 4
+#define SOUND_MIXER_UNITY_GAIN INT16_MAX // Q15 gain, just under 1.0.
+#define SOUND_MIXER_NO_VOICE -1 // Returned when a sound cannot get a voice.
+#define SOUND_MIXER_DECODE_SIZE 64 // Samples decoded per voice at a time.
+#define SOUND_MIXER_DEFAULT_SAMPLE_RATE 48000 // Output rate after init.
+#define SOUND_MIXER_FILTER_COUNT 2 // Sound rates other than the output rate.
+#define SOUND_MIXER_NO_LOOP 0      // loopEnd of a sound that plays once.
+
+// A sound and how it plays.
+typedef struct {
+  const uint8_t *adpcm; // IMA-ADPCM stream, NULL for silence.
+  uint32_t sampleCount;
+  uint32_t sampleRate; // Hz.
+  uint32_t loopStart;  // Sample the loop goes back to.
+  uint32_t loopEnd;    // Sample after the loop, or SOUND_MIXER_NO_LOOP.
+  int16_t gain;        // Q15.
+  uint8_t priority;    // A sound can take the voice of a lower priority.
+  bool streamed;       // Read from the SD card, adpcm is NULL.
+  uint32_t bankOffset; // Of a streamed sound in the SD card bank.
+} soundMixer_sound_t;
+
+// Stops every voice and sets the output rate to
+// SOUND_MIXER_DEFAULT_SAMPLE_RATE.
+void soundMixer_init();
+
+// Stops every voice, sets the output rate and designs a resampling filter for
+// every other rate in sounds[]. Returns false if there are more than
+// SOUND_MIXER_FILTER_COUNT other rates or a rate is too far from the output
+// rate; those sounds will not play.
+bool soundMixer_setSampleRates(uint32_t outputRate,
+                               const soundMixer_sound_t sounds[],
+                               uint16_t soundCount);
+
+// Starts sound on a voice. A looping sound plays until it is stopped. Returns
+// the voice, or SOUND_MIXER_NO_VOICE if every voice plays something of higher
+// priority, the sound cannot play at the output rate or it is streamed and
+// every stream is open.
+int16_t soundMixer_play(const soundMixer_sound_t *sound);
+
+// Stops voice.
+void soundMixer_stop(int16_t voice);
+
+// Stops every voice.
+void soundMixer_stopAll();
+
+// Returns true if any voice is playing.
+bool soundMixer_isActive();
+
+// Returns true if voice is playing.
+bool soundMixer_isVoiceActive(int16_t voice);
+
+// Mixes the next frameCount samples of every active voice into output.
+// Returns the number of samples up to the end of the longest voice (0 if
+// nothing is playing); output is silent past the end of the shorter ones.
+uint32_t soundMixer_mix(int16_t output[], uint32_t frameCount);
+
+// Checks mixing of encoded sounds and silence, saturation, voice stealing,
+// voice endings, loops and resampled sounds. Returns true if everything
+// matches.
+bool soundMixer_runTest();
+
+#endif /* SOUNDMIXER_H_ */
@@ -0,0 +1,203 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "soundStream.h"
+#include "xil_cache.h"
+#include "xparameters.h"
+#include "xsdps.h"
+#include <stdio.h>
+#include <string.h>
+
+#define MBR_SIGNATURE_OFFSET 510 // 0x55, 0xAA.
+#define MBR_PARTITION_TABLE_OFFSET 446
+#define MBR_PARTITION_ENTRY_SIZE 16
+#define MBR_PARTITION_TYPE_OFFSET 4  // 0 for an unused entry.
+#define MBR_PARTITION_START_OFFSET 8 // First sector.
+#define MBR_PARTITION_SIZE_OFFSET 12 // Sectors.
+#define BANK_MAGIC_SIZE (sizeof(SOUND_STREAM_BANK_MAGIC) - 1)
+#define BANK_SIZE_OFFSET BANK_MAGIC_SIZE // In the header sector.
+
+static XSdPs sd;
+static soundStream_t streams[SOUND_STREAM_COUNT];
+static uint32_t readErrorCount; // Printed with the next successful read.
+static uint32_t bankSector;     // First sector of the sounds, on the card.
+static uint32_t bankSize;       // Bytes, 0 without a bank.
+static uint8_t sectorBuffer[SOUND_STREAM_SECTOR_SIZE]
+    __attribute__((aligned(32))); // The MBR and the bank header.
+
+// Little-endian, as the MBR and wav2adpcm store it.
+static uint32_t soundStream_read32(const uint8_t *data) {
+  return data[0] | data[1] << 8 | data[2] << 16 | (uint32_t)data[3] << 24;
+}
+
+// Reads count sectors from sector into buffer. Returns false if it fails.
+static bool soundStream_readSectors(uint32_t sector, uint32_t count,
+                                    uint8_t *buffer) {
+  // Standard capacity cards take a byte address.
+  if (XSdPs_ReadPolled(&sd, sd.HCS ? sector : sector * SOUND_STREAM_SECTOR_SIZE,
+                       count, buffer) != XST_SUCCESS)
+    return false;
+  Xil_DCacheInvalidateRange((INTPTR)buffer, count * SOUND_STREAM_SECTOR_SIZE);
+  return true;
+}
+
+// Finds SOUND_STREAM_PARTITION in the MBR and checks the bank header in its
+// first sector.
+static sound_status_t soundStream_findBank() {
+  if (!soundStream_readSectors(0, 1, sectorBuffer) ||
+      sectorBuffer[MBR_SIGNATURE_OFFSET] != 0x55 ||
+      sectorBuffer[MBR_SIGNATURE_OFFSET + 1] != 0xAA) {
+    printf("soundStream_init: the SD card has no MBR.\n\r");
+    return SOUND_STATUS_FAIL;
+  }
+  const uint8_t *entry =
+      &sectorBuffer[MBR_PARTITION_TABLE_OFFSET +
+                    (SOUND_STREAM_PARTITION - 1) * MBR_PARTITION_ENTRY_SIZE];
+  uint32_t partitionSector =
+      soundStream_read32(&entry[MBR_PARTITION_START_OFFSET]);
+  uint32_t partitionSectorCount =
+      soundStream_read32(&entry[MBR_PARTITION_SIZE_OFFSET]);
+  if (entry[MBR_PARTITION_TYPE_OFFSET] == 0 || partitionSectorCount == 0) {
+    printf("soundStream_init: the SD card has no partition %d for the sound "
+           "bank.\n\r",
+           SOUND_STREAM_PARTITION);
+    return SOUND_STATUS_FAIL;
+  }
+  if (!soundStream_readSectors(partitionSector, 1, sectorBuffer) ||
+      memcmp(sectorBuffer, SOUND_STREAM_BANK_MAGIC, BANK_MAGIC_SIZE) != 0) {
+    printf("soundStream_init: partition %d does not hold a sound bank.\n\r",
+           SOUND_STREAM_PARTITION);
+    return SOUND_STATUS_FAIL;
+  }
+  uint32_t size = soundStream_read32(&sectorBuffer[BANK_SIZE_OFFSET]);
+  if ((uint64_t)size >
+      (uint64_t)(partitionSectorCount - 1) * SOUND_STREAM_SECTOR_SIZE) {
+    printf("soundStream_init: the sound bank (%lu bytes) does not fit in "
+           "partition %d.\n\r",
+           (unsigned long)size, SOUND_STREAM_PARTITION);
+    return SOUND_STATUS_FAIL;
+  }
+  bankSector = partitionSector + 1;
+  bankSize = size;
+  return SOUND_STATUS_OK;
+}
+
+sound_status_t soundStream_init() {
+  memset(streams, 0, sizeof(streams));
+  readErrorCount = 0;
+  bankSize = 0;
+  XSdPs_Config *config = XSdPs_LookupConfig(SOUND_STREAM_SD_DEVICE_ID);
+  if (!config ||
+      XSdPs_CfgInitialize(&sd, config, config->BaseAddress) != XST_SUCCESS ||
+      XSdPs_CardInitialize(&sd) != XST_SUCCESS) {
+    printf("soundStream_init: cannot initialize the SD card.\n\r");
+    return SOUND_STATUS_FAIL;
+  }
+  return soundStream_findBank();
+}
+
+// Starts reading again at sector. The main loop sees the new generation and
+// drops what it had. Called from the ISR.
+static void soundStream_restart(soundStream_t *stream, uint32_t sector) {
+  stream->startSector = sector;
+  stream->releasedSectors = sector;
+  stream->generation++; // Last, the main loop checks it first.
+}
+
+soundStream_t *soundStream_open(uint32_t bankOffset, uint32_t size) {
+  if ((uint64_t)bankOffset + size > bankSize)
+    return NULL; // No bank, or a bank from other assets.
+  for (uint16_t i = 0; i < SOUND_STREAM_COUNT; i++) {
+    soundStream_t *stream = &streams[i];
+    if (stream->open)
+      continue;
+    stream->firstSector = bankSector + bankOffset / SOUND_STREAM_SECTOR_SIZE;
+    stream->sectorCount =
+        (size + SOUND_STREAM_SECTOR_SIZE - 1) / SOUND_STREAM_SECTOR_SIZE;
+    soundStream_restart(stream, 0);
+    stream->open = true;
+    return stream;
+  }
+  return NULL;
+}
+
+void soundStream_close(soundStream_t *stream) { stream->open = false; }
+
+// A block spans one or two sectors. Only a block whose sectors are at the end
+// and the start of the ring is copied.
+const uint8_t *soundStream_getBlock(void *context, uint32_t block) {
+  soundStream_t *stream = context;
+  uint32_t offset = block * ADPCM_BLOCK_SIZE;
+  uint32_t firstSector = offset / SOUND_STREAM_SECTOR_SIZE;
+  uint32_t lastSector =
+      (offset + ADPCM_BLOCK_SIZE - 1) / SOUND_STREAM_SECTOR_SIZE;
+  if (firstSector < stream->releasedSectors) {
+    soundStream_restart(stream, firstSector); // Looped back.
+    return NULL;
+  }
+  if (stream->readGeneration != stream->generation)
+    return NULL; // The main loop has not seen the restart yet.
+  if (stream->sectorCount > SOUND_STREAM_RING_SECTORS)
+    stream->releasedSectors = firstSector;
+  if (lastSector >= stream->readSectors)
+    return NULL;
+  uint32_t sectorOffset = offset % SOUND_STREAM_SECTOR_SIZE;
+  const uint8_t *data =
+      &stream->ring[firstSector % SOUND_STREAM_RING_SECTORS][sectorOffset];
+  if (lastSector % SOUND_STREAM_RING_SECTORS >=
+      firstSector % SOUND_STREAM_RING_SECTORS)
+    return data;
+  uint32_t headSize = SOUND_STREAM_SECTOR_SIZE - sectorOffset;
+  memcpy(stream->block, data, headSize);
+  memcpy(&stream->block[headSize], stream->ring[0],
+         ADPCM_BLOCK_SIZE - headSize);
+  return stream->block;
+}
+
+// Reads the free sectors up to the end of the ring in one command. Called
+// from the main loop.
+static void soundStream_read(soundStream_t *stream) {
+  uint32_t generation = stream->generation;
+  if (stream->readGeneration != generation) {
+    stream->readSectors = stream->startSector;
+    stream->readGeneration = generation; // Last, the ISR checks it first.
+  }
+  uint32_t readSectors = stream->readSectors;
+  uint32_t releasedSectors = stream->releasedSectors;
+  if (readSectors < releasedSectors)
+    readSectors = releasedSectors; // The ISR ran ahead, skip the gap.
+  // Full, done, or restarted since the generation was checked.
+  if (readSectors - releasedSectors >= SOUND_STREAM_RING_SECTORS ||
+      readSectors >= stream->sectorCount)
+    return;
+  uint32_t count = SOUND_STREAM_RING_SECTORS - (readSectors - releasedSectors);
+  uint32_t ringIndex = readSectors % SOUND_STREAM_RING_SECTORS;
+  if (count > SOUND_STREAM_RING_SECTORS - ringIndex)
+    count = SOUND_STREAM_RING_SECTORS - ringIndex;
+  if (count > stream->sectorCount - readSectors)
+    count = stream->sectorCount - readSectors;
+  if (!soundStream_readSectors(stream->firstSector + readSectors, count,
+                               stream->ring[ringIndex])) {
+    readErrorCount++;
+    return;
+  }
+  if (readErrorCount) {
+    printf("soundStream: %lu SD reads failed.\n\r",
+           (unsigned long)readErrorCount);
+    readErrorCount = 0;
+  }
+  if (stream->generation == generation)
+    stream->readSectors = readSectors + count;
+}
+
+void soundStream_service() {
+  for (uint16_t i = 0; i < SOUND_STREAM_COUNT; i++)
+    if (streams[i].open)
+      soundStream_read(&streams[i]);
+}
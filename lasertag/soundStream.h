@@ -0,0 +1,85 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDSTREAM_H_
+#define SOUNDSTREAM_H_
+
+#include "adpcm.h"
+#include "sound.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Streams the IMA-ADPCM sounds from the SD card when they are not linked into
+// the program (SOUND_ASSETS_ON_SD, see sounds/soundAssets.h).
+// - sounds/wav2adpcm -k writes every sound into one bank, each one padded to
+//   whole sectors, at the NAME_ADPCM_BANK_OFFSET of its header. The offsets
+//   count from the end of a header sector: SOUND_STREAM_BANK_MAGIC, then the
+//   size of the sounds in bytes (uint32, little-endian).
+// - The BSP has no FAT library, so the bank is written raw to a partition of
+//   its own, SOUND_STREAM_PARTITION in the MBR. Leave room after the FAT boot
+//   partition (shrink it if it fills the card), add a partition of type 0xDA
+//   (non-FS data) at least as large as the bank and write the bank to it:
+//   dd if=soundBank.bin of=/dev/sdX2. soundStream_init() finds the partition
+//   and checks the header, and every read stays inside the bank.
+// - Each open stream reads ahead into a ring of SOUND_STREAM_RING_SECTORS
+//   sectors. soundStream_service() does the reading with polled multi-sector
+//   reads, which are far too slow for the ISR, so call it from the main loop
+//   (sound_service() does). The decoder gets its blocks from
+//   soundStream_getBlock() in the ISR, which frees the sectors before them.
+// - The mixer waits for the first block of a sound (see soundMixer.h). Any
+//   other block that is not read yet plays as silence (see adpcm.h). A block
+//   before the ring, at a loop start, restarts the read ahead from there. A
+//   sound that fits in the ring is never freed, so its loops are seamless.
+// The ISR opens, restarts and frees, the main loop only reads; it drops a
+// read if the stream was restarted meanwhile, so nothing needs a lock.
+
+#define SOUND_STREAM_SD_DEVICE_ID XPAR_XSDPS_0_DEVICE_ID
+#define SOUND_STREAM_PARTITION 2 // MBR partition (1 to 4) with the bank.
+#define SOUND_STREAM_BANK_MAGIC "LTSB" // First bytes of the bank header.
+#define SOUND_STREAM_SECTOR_SIZE 512   // Bytes.
+#define SOUND_STREAM_RING_SECTORS 8 // 4 KB, about 170 ms of 48 kHz ADPCM.
+#define SOUND_STREAM_COUNT 4        // One per mixer voice.
+
+// A sound being read from the card. Sector numbers count from the start of
+// the sound.
+typedef struct {
+  uint8_t ring[SOUND_STREAM_RING_SECTORS][SOUND_STREAM_SECTOR_SIZE]
+      __attribute__((aligned(32))); // Cache lines, the SD DMA writes it.
+  uint8_t block[ADPCM_BLOCK_SIZE];  // A block that wraps around the ring.
+  uint32_t firstSector;             // On the card.
+  uint32_t sectorCount;
+  volatile uint32_t generation;      // ISR, counts opens and restarts.
+  volatile uint32_t startSector;     // ISR, where reading (re)starts.
+  volatile uint32_t releasedSectors; // ISR, the sectors before are free.
+  volatile uint32_t readGeneration;  // Main loop, generation being read.
+  volatile uint32_t readSectors;     // Main loop, the sectors before are in.
+  volatile bool open;                // ISR.
+} soundStream_t;
+
+// Sets up the SD controller and the card, finds the bank and closes every
+// stream. Fails (and prints why) if there is no SOUND_STREAM_PARTITION, its
+// header is not a bank header or the bank does not fit in the partition.
+sound_status_t soundStream_init();
+
+// Opens a stream of the size bytes at bankOffset in the bank. Returns NULL if
+// every stream is open, or the sound is not in the bank.
+soundStream_t *soundStream_open(uint32_t bankOffset, uint32_t size);
+
+// Closes stream.
+void soundStream_close(soundStream_t *stream);
+
+// Block source for adpcm_initStreamDecoder(), context is the stream. Returns
+// NULL if the block has not been read yet.
+const uint8_t *soundStream_getBlock(void *context, uint32_t block);
+
+// Reads ahead into every open stream, as far as its ring allows. Call from the
+// main loop.
+void soundStream_service();
+
+#endif /* SOUNDSTREAM_H_ */
@@ -0,0 +1,1738 @@
+// This file was generated by executing this statement: wav2adpcm -r 48000 -k soundBank.bin bcfire01_48k.wav.c gameBoyStartup.wav.c gameOver48k.wav.c gunEmpty48k.wav.c ouch48k.wav.c pacmanDeath.wav.c powerUp48k.wav.c screamAndDie48k.wav.c
+
+#include "soundAssets.h"
+#include <stdint.h>
+
+#ifndef SOUND_ASSETS_ON_SD
+// IMA-ADPCM, 53638 samples at 48000 Hz.
+SOUND_ASSET const uint8_t bcfire01_48k_adpcm[27659] = {
+    0xff, 0xff, 0x00, 0x00, 0x90, 0x40, 0x3e, 0x2b, 0x90, 0x18, 0x4a, 0x3b, 0x4e, 0x3c, 0x1a, 0xb1,
+    0xa2, 0xa3, 0x20, 0x5d, 0x3d, 0x2a, 0x09, 0x18, 0xb0, 0xf3, 0xa4, 0x91, 0x80, 0x81, 0x28, 0x1b,
+    0x18, 0xa2, 0x3b, 0x91, 0xf3, 0xb3, 0xd4, 0xb1, 0x03, 0xa3, 0x00, 0x4a, 0x3e, 0x70, 0x11, 0x99,
+    0x81, 0xa0, 0x8a, 0x89, 0x9e, 0x39, 0x19, 0x0c, 0xb9, 0x8d, 0x70, 0x31, 0x89, 0x08, 0xa0, 0x9a,
+    0x91, 0x0a, 0x4e, 0x39, 0x0d, 0x8d, 0x19, 0x18, 0x08, 0xa5, 0x05, 0x01, 0x29, 0x55, 0x20, 0x73,
+    0x67, 0x23, 0xf9, 0xff, 0x9a, 0x08, 0x50, 0x67, 0x81, 0xbe, 0x29, 0x34, 0xb9, 0x2b, 0x26, 0xd9,
+    0x8b, 0x32, 0x02, 0xba, 0x9a, 0x42, 0x92, 0xab, 0x42, 0xb8, 0x79, 0x16, 0xb9, 0x2a, 0xa3, 0xae,
+    0x41, 0xa2, 0xac, 0x42, 0x91, 0x9a, 0x32, 0x90, 0x8a, 0x11, 0xb9, 0x9c, 0x42, 0x83, 0x9a, 0x62,
+    0x92, 0xbc, 0x29, 0x03, 0x77, 0x06, 0x3a, 0x00, 0xbd, 0x48, 0x14, 0xc9, 0x9b, 0x08, 0x32, 0x15,
+    0x99, 0x40, 0x15, 0xda, 0xac, 0x20, 0x34, 0x81, 0xbc, 0x09, 0x22, 0xc9, 0xad, 0x52, 0x14, 0xa0,
+    0x9b, 0x18, 0x88, 0x8a, 0x52, 0x13, 0x88, 0x99, 0xcb, 0x9c, 0x18, 0x33, 0x23, 0x08, 0x21, 0xe8,
+    0xbe, 0x28, 0x13, 0x00, 0x21, 0x92, 0xbd, 0x29, 0x92, 0xbf, 0x29, 0x37, 0x01, 0x89, 0x88, 0xa8,
+    0x89, 0x00, 0xaa, 0x29, 0x26, 0xd9, 0x8b, 0x53, 0x82, 0xbc, 0x1a, 0x55, 0x13, 0xca, 0xab, 0x08,
+    0x80, 0x89, 0x31, 0x25, 0xa0, 0xcb, 0x20, 0x14, 0xb9, 0x9b, 0x98, 0x1a, 0x57, 0x92, 0xcb, 0x1a,
+    0x43, 0x82, 0xab, 0x72, 0x23, 0xa9, 0xca, 0xac, 0x28, 0x92, 0xbe, 0x38, 0x15, 0x80, 0x88, 0x00,
+    0x54, 0x82, 0xcd, 0x09, 0x33, 0xa0, 0xab, 0x9a, 0x89, 0x61, 0x35, 0x81, 0xbb, 0x29, 0x36, 0xb1,
+    0xbf, 0x1a, 0x21, 0x80, 0x88, 0x88, 0x21, 0x13, 0x7b, 0x00, 0x2a, 0x00, 0x08, 0x31, 0x82, 0xbc,
+    0x99, 0x98, 0x00, 0xfa, 0xae, 0x20, 0x01, 0x50, 0x37, 0x90, 0xac, 0x09, 0x10, 0x98, 0xbb, 0x39,
+    0x17, 0xc9, 0x8b, 0x52, 0x14, 0x91, 0xaa, 0x41, 0x04, 0xbc, 0x1b, 0x01, 0xbd, 0x39, 0x47, 0x12,
+    0xc9, 0xbb, 0x38, 0x27, 0xa0, 0xbc, 0x1a, 0x55, 0x02, 0xa9, 0xaa, 0x9a, 0x19, 0x12, 0x01, 0x31,
+    0x22, 0x21, 0x82, 0xef, 0x09, 0x33, 0xb1, 0xce, 0x8a, 0x51, 0x03, 0xeb, 0x8a, 0x53, 0x14, 0xb0,
+    0xac, 0x28, 0x24, 0x91, 0xbb, 0xaa, 0xb9, 0x19, 0x44, 0x01, 0x89, 0x30, 0x46, 0x13, 0xca, 0xac,
+    0x9a, 0x08, 0x12, 0x88, 0x00, 0x31, 0x57, 0x13, 0xda, 0xac, 0x0a, 0x21, 0x02, 0xa9, 0x71, 0x35,
+    0xa2, 0xcf, 0x9b, 0x30, 0x23, 0x88, 0x10, 0x13, 0xfc, 0x8b, 0x42, 0x02, 0x08, 0x90, 0xdb, 0x09,
+    0x01, 0x28, 0x26, 0xf9, 0x9a, 0x33, 0x82, 0xb9, 0xbb, 0x51, 0x04, 0xcb, 0x80, 0xec, 0x3e, 0x00,
+    0x1a, 0x44, 0x81, 0xbc, 0x29, 0x15, 0xda, 0x09, 0x24, 0xb8, 0x8a, 0x23, 0x88, 0x88, 0xca, 0x3a,
+    0x37, 0xd9, 0x1a, 0x33, 0xb8, 0x9a, 0xba, 0x50, 0x15, 0xb9, 0xaa, 0x0a, 0x56, 0x91, 0x8b, 0x34,
+    0xea, 0x0a, 0x43, 0xa0, 0x8a, 0x08, 0x00, 0x02, 0x98, 0x19, 0x80, 0x89, 0x98, 0x38, 0x04, 0xae,
+    0x75, 0xa2, 0xad, 0x40, 0xa0, 0x19, 0x13, 0xcb, 0x62, 0xb0, 0x0c, 0x14, 0xa9, 0x30, 0xd0, 0x0c,
+    0x25, 0xa9, 0x09, 0xb9, 0x58, 0x06, 0xcb, 0x48, 0x02, 0xac, 0x30, 0x82, 0xaa, 0x09, 0x00, 0x01,
+    0xa0, 0xbb, 0x73, 0xa3, 0xaf, 0x52, 0x92, 0x9b, 0x10, 0x99, 0x31, 0xc1, 0x0d, 0x33, 0xc9, 0x0a,
+    0x11, 0x31, 0xf1, 0x8d, 0x44, 0xb8, 0x0c, 0x24, 0xa9, 0x0a, 0x11, 0x00, 0xa1, 0x8d, 0x52, 0xb1,
+    0x9d, 0x51, 0x82, 0xeb, 0x39, 0x25, 0xd9, 0x8a, 0x23, 0x81, 0xa9, 0x9a, 0x63, 0xa1, 0x9d, 0x43,
+    0x68, 0xf7, 0x4a, 0x00, 0xa0, 0xab, 0x31, 0x13, 0xc9, 0x9c, 0x45, 0xa0, 0x9d, 0x42, 0x91, 0xab,
+    0x48, 0x13, 0xe9, 0x0a, 0x34, 0xa0, 0x9d, 0x31, 0x03, 0xcc, 0x29, 0x24, 0xc8, 0x0b, 0x42, 0x91,
+    0xac, 0x40, 0x03, 0xcb, 0x29, 0x24, 0xb9, 0x9b, 0x43, 0x83, 0xbd, 0x38, 0x16, 0xb9, 0x0a, 0x22,
+    0x91, 0x9a, 0x30, 0xd0, 0xac, 0x63, 0x91, 0xac, 0x30, 0x04, 0xca, 0x1a, 0x35, 0xc0, 0x9d, 0x41,
+    0x83, 0xda, 0x09, 0x43, 0xa0, 0xac, 0x31, 0x23, 0xd9, 0x9b, 0x51, 0x02, 0xba, 0x28, 0xa2, 0x9d,
+    0x73, 0xa1, 0xad, 0x41, 0x82, 0xba, 0x19, 0x34, 0xa1, 0xad, 0x48, 0x14, 0xba, 0x8b, 0x53, 0x91,
+    0xbb, 0x40, 0x03, 0xcb, 0x48, 0x04, 0xcb, 0x29, 0x24, 0xb9, 0x9b, 0x28, 0x32, 0x98, 0x1a, 0xa1,
+    0x9f, 0x74, 0x91, 0x9d, 0x20, 0x22, 0xa9, 0xad, 0x39, 0x25, 0x90, 0xab, 0x89, 0x43, 0x14, 0xa8,
+    0xcb, 0x0b, 0x63, 0x83, 0x34, 0x11, 0x48, 0x00, 0xcb, 0xaa, 0x31, 0x35, 0xb8, 0xbd, 0x28, 0x34,
+    0xa0, 0x99, 0x90, 0x8a, 0x73, 0x92, 0xac, 0x38, 0x02, 0xbb, 0x39, 0x37, 0xc8, 0x9b, 0x44, 0x90,
+    0x9a, 0x33, 0xa1, 0xae, 0x29, 0x33, 0x90, 0x9a, 0xa8, 0xac, 0x72, 0x16, 0xa8, 0xac, 0x19, 0x23,
+    0x01, 0x11, 0xf9, 0xab, 0x62, 0x13, 0xb9, 0x9a, 0x10, 0xa8, 0x28, 0x36, 0xb0, 0x9e, 0x20, 0x12,
+    0x99, 0x38, 0x34, 0xd9, 0xac, 0x09, 0x12, 0x42, 0x23, 0xe8, 0xcd, 0x28, 0x44, 0x01, 0xb9, 0xab,
+    0x9a, 0x41, 0x35, 0x92, 0xcc, 0x89, 0x11, 0x80, 0x21, 0x13, 0xda, 0x9c, 0x18, 0x11, 0x10, 0x52,
+    0x81, 0xdb, 0xab, 0x20, 0x44, 0x12, 0xa9, 0x9b, 0x31, 0x26, 0xc8, 0xae, 0x30, 0x35, 0x81, 0xfb,
+    0xbb, 0x09, 0x43, 0x43, 0x02, 0xdb, 0xbb, 0x09, 0x43, 0x33, 0x22, 0xc0, 0xce, 0x8a, 0x18, 0x21,
+    0x45, 0x02, 0xca, 0xab, 0x99, 0x08, 0x53, 0x43, 0x47, 0x15, 0x47, 0x00, 0x11, 0xb9, 0xdc, 0xab,
+    0x18, 0x34, 0x43, 0x23, 0xf9, 0xac, 0x89, 0x10, 0x43, 0x24, 0x90, 0xba, 0xbc, 0x9a, 0x20, 0x63,
+    0x24, 0x81, 0xba, 0xcc, 0x9a, 0x28, 0x22, 0x44, 0x13, 0xc9, 0xab, 0xbc, 0x8b, 0x31, 0x55, 0x43,
+    0x81, 0x9a, 0xb9, 0xae, 0x0a, 0x11, 0x42, 0x35, 0x82, 0xa9, 0xca, 0xbc, 0x0a, 0x40, 0x44, 0x23,
+    0xa8, 0xba, 0xcc, 0xab, 0x10, 0x53, 0x44, 0x02, 0x99, 0xba, 0xbe, 0x89, 0x22, 0x33, 0x36, 0x81,
+    0xa9, 0xea, 0xbb, 0x08, 0x12, 0x53, 0x34, 0x81, 0xa9, 0xcc, 0xbc, 0x88, 0x11, 0x52, 0x34, 0x80,
+    0x99, 0xa9, 0xbc, 0x28, 0x34, 0x80, 0xaa, 0x9a, 0x9a, 0x51, 0x47, 0x01, 0x99, 0x88, 0xd9, 0x9c,
+    0x08, 0x00, 0x41, 0x34, 0x33, 0xa0, 0xbd, 0xac, 0xbb, 0x8b, 0x41, 0x34, 0x34, 0x13, 0xa0, 0xdb,
+    0xbc, 0xbd, 0x89, 0x31, 0x32, 0x34, 0x34, 0x00, 0xba, 0x99, 0xa9, 0xcd, 0x4c, 0xe2, 0x41, 0x00,
+    0xac, 0x89, 0x40, 0x44, 0x23, 0x23, 0x01, 0xaa, 0xa9, 0xcc, 0xcc, 0xab, 0x38, 0x46, 0x23, 0x01,
+    0x00, 0x99, 0xdc, 0xcb, 0x89, 0x80, 0x10, 0x54, 0x33, 0x01, 0x88, 0xb9, 0xdd, 0xab, 0x89, 0x88,
+    0x31, 0x46, 0x22, 0x32, 0x02, 0xda, 0xcb, 0xbb, 0xac, 0x09, 0x63, 0x33, 0x11, 0x31, 0x02, 0xd9,
+    0xcc, 0xbb, 0x9c, 0x18, 0x32, 0x32, 0x34, 0x11, 0x31, 0xd1, 0xbf, 0x89, 0x98, 0x89, 0x20, 0x32,
+    0x15, 0x21, 0x35, 0xc1, 0x9c, 0x18, 0x80, 0x00, 0xb8, 0x9d, 0x90, 0xdc, 0xaa, 0x20, 0x64, 0x82,
+    0xab, 0x29, 0x13, 0xda, 0xbc, 0x89, 0x42, 0x43, 0x43, 0x12, 0x98, 0xcb, 0x99, 0x00, 0x10, 0x32,
+    0xa8, 0x38, 0x15, 0xea, 0x09, 0x34, 0xa8, 0x9d, 0x21, 0xe8, 0xad, 0x88, 0xb9, 0x58, 0x37, 0x12,
+    0x80, 0xc9, 0xae, 0x09, 0x80, 0x99, 0x00, 0x81, 0x88, 0x61, 0x36, 0x23, 0x00, 0x91, 0xeb, 0x9a,
+    0x6e, 0xf9, 0x43, 0x00, 0x18, 0x20, 0x02, 0xb9, 0x8b, 0xa9, 0x1b, 0x57, 0x23, 0x23, 0xb8, 0xbf,
+    0xcc, 0xaa, 0xaa, 0x08, 0x32, 0x24, 0x10, 0x55, 0x24, 0x12, 0x88, 0xaa, 0xaa, 0xda, 0xcd, 0xaa,
+    0x98, 0x18, 0x43, 0x32, 0x54, 0x13, 0x98, 0x19, 0x33, 0x02, 0xa8, 0xba, 0xeb, 0xcc, 0xbb, 0xbc,
+    0x9b, 0x51, 0x23, 0x00, 0x63, 0x14, 0xc9, 0xab, 0x19, 0x24, 0x81, 0x8a, 0x80, 0xdb, 0x9a, 0x99,
+    0x9a, 0x32, 0x55, 0x34, 0x91, 0xab, 0x32, 0x81, 0x50, 0x26, 0x01, 0x10, 0xa1, 0xbf, 0x9b, 0x99,
+    0xbb, 0x61, 0x24, 0x90, 0x08, 0x41, 0x23, 0x82, 0xeb, 0x9a, 0x99, 0xcf, 0x9c, 0x00, 0x00, 0x11,
+    0x11, 0x41, 0x33, 0x43, 0x33, 0x91, 0xaa, 0xcc, 0x9c, 0x18, 0x02, 0xa8, 0xce, 0x8a, 0x22, 0x11,
+    0x63, 0x25, 0x22, 0x00, 0x80, 0x90, 0xc9, 0xcd, 0xac, 0x9a, 0x51, 0x13, 0xc9, 0x9c, 0x88, 0xba,
+    0x8a, 0x11, 0x64, 0x24, 0x19, 0x03, 0x42, 0x00, 0x11, 0x42, 0x12, 0x11, 0x92, 0xdd, 0xbb, 0xbc,
+    0xba, 0xaa, 0x28, 0x33, 0x01, 0x72, 0x34, 0x12, 0x91, 0x99, 0x73, 0x17, 0x81, 0x89, 0xa9, 0xcc,
+    0xbc, 0x9b, 0x09, 0x08, 0x21, 0x22, 0x53, 0x33, 0x43, 0x22, 0x00, 0x90, 0xbc, 0x9c, 0x10, 0x42,
+    0x14, 0xec, 0xac, 0x88, 0x08, 0x10, 0x90, 0x8a, 0x32, 0xa2, 0xcd, 0x29, 0x47, 0x13, 0x01, 0x32,
+    0x24, 0xb8, 0xcd, 0xab, 0x18, 0x13, 0xb9, 0x0a, 0x02, 0xfd, 0xab, 0xaa, 0x99, 0x42, 0x36, 0x24,
+    0x11, 0x10, 0x90, 0xcb, 0x19, 0x23, 0x80, 0x48, 0x34, 0xb1, 0xce, 0xcb, 0xab, 0x9a, 0x28, 0x65,
+    0x22, 0x01, 0x11, 0xa0, 0xbc, 0xab, 0x89, 0xb9, 0xcc, 0x89, 0x32, 0x34, 0x81, 0x41, 0x36, 0x32,
+    0x53, 0x23, 0x10, 0x11, 0x90, 0x10, 0x12, 0xec, 0xcd, 0xab, 0xaa, 0xdb, 0xba, 0x99, 0x20, 0x45,
+    0x23, 0x32, 0x02, 0xba, 0xab, 0x18, 0x66, 0x34, 0xcc, 0x38, 0x41, 0x00, 0x23, 0x00, 0x99, 0xeb,
+    0xbc, 0xab, 0xa9, 0x9b, 0x10, 0x03, 0xd9, 0xbb, 0x08, 0xb8, 0x8e, 0x64, 0x22, 0x31, 0x47, 0x12,
+    0x00, 0x80, 0x89, 0x18, 0x22, 0xa8, 0xbd, 0xba, 0xdf, 0xab, 0x99, 0xa9, 0x28, 0x91, 0x8a, 0x46,
+    0x81, 0x8a, 0x11, 0x63, 0x35, 0x81, 0x18, 0x80, 0x99, 0xb8, 0xdc, 0x9a, 0xbb, 0x0b, 0x33, 0x11,
+    0x63, 0x22, 0x21, 0xc0, 0xbd, 0x20, 0x90, 0x8a, 0x64, 0x24, 0xb9, 0xbe, 0x8a, 0x09, 0x20, 0x11,
+    0x41, 0x03, 0xca, 0xab, 0x88, 0x40, 0x35, 0x12, 0x32, 0x13, 0xfa, 0xce, 0x9a, 0x11, 0x11, 0x64,
+    0x13, 0xb9, 0xac, 0xaa, 0xba, 0x09, 0x12, 0xa9, 0x58, 0x46, 0x82, 0xa9, 0x99, 0x40, 0x36, 0x02,
+    0x08, 0x32, 0xa0, 0xae, 0x8a, 0x62, 0x03, 0xcb, 0x9b, 0xa9, 0xbb, 0xca, 0xbd, 0x0a, 0x32, 0x02,
+    0x40, 0x34, 0x91, 0xac, 0x10, 0x91, 0xdc, 0x0a, 0x73, 0x25, 0x02, 0xa0, 0x76, 0x14, 0x40, 0x00,
+    0x99, 0x80, 0xcd, 0x8b, 0x42, 0x33, 0x23, 0xc9, 0x9b, 0x80, 0xcc, 0xbb, 0x39, 0x77, 0x01, 0xaa,
+    0x08, 0x11, 0x88, 0xa9, 0x28, 0x26, 0xa1, 0xbc, 0xac, 0x89, 0x00, 0x08, 0x42, 0x35, 0x12, 0x11,
+    0x81, 0xda, 0x9a, 0x08, 0x08, 0x53, 0x12, 0x22, 0xd8, 0xae, 0xab, 0x9b, 0x71, 0x33, 0xa8, 0xbe,
+    0xab, 0x10, 0x22, 0x80, 0x20, 0x53, 0x92, 0xbd, 0x3a, 0x37, 0x02, 0x88, 0x18, 0x12, 0xe9, 0x8b,
+    0x43, 0x13, 0xc9, 0xdd, 0xbb, 0x88, 0x10, 0x31, 0x42, 0x54, 0x13, 0xba, 0xad, 0x9b, 0x29, 0x34,
+    0x11, 0x63, 0x92, 0xcc, 0x89, 0x08, 0x08, 0x00, 0x28, 0x34, 0xb0, 0xbe, 0x9c, 0x51, 0x13, 0xaa,
+    0x18, 0xa1, 0x3a, 0x57, 0xb0, 0x9c, 0x62, 0x23, 0x80, 0x09, 0x01, 0x90, 0xda, 0xac, 0x8a, 0x32,
+    0x25, 0xa0, 0xbd, 0xaa, 0xbc, 0x8a, 0x22, 0x00, 0x62, 0x12, 0xa8, 0xaa, 0x10, 0x21, 0x65, 0x13,
+    0xe6, 0x12, 0x3d, 0x00, 0xba, 0x39, 0x27, 0xa8, 0xab, 0x9a, 0x8a, 0x62, 0x13, 0xc9, 0x28, 0x27,
+    0x80, 0x80, 0xa9, 0x30, 0x16, 0x98, 0x19, 0x11, 0x72, 0x13, 0xca, 0x09, 0x91, 0xac, 0x52, 0x82,
+    0xce, 0xab, 0x99, 0x00, 0x08, 0x01, 0x91, 0xb9, 0x9b, 0x52, 0xd2, 0xcf, 0x38, 0x35, 0x11, 0x88,
+    0x18, 0x11, 0xb0, 0xbb, 0xb9, 0xad, 0x42, 0x13, 0x20, 0xc1, 0xbf, 0x41, 0x04, 0xa9, 0x89, 0x28,
+    0x36, 0xc8, 0x8c, 0x21, 0x12, 0x01, 0x11, 0x02, 0xcb, 0x2a, 0x15, 0xfa, 0xcc, 0x0a, 0x53, 0x82,
+    0xba, 0x88, 0xa9, 0x38, 0x25, 0x00, 0xa8, 0x8b, 0x54, 0x12, 0x30, 0xc1, 0xdf, 0x19, 0x23, 0x80,
+    0x80, 0x99, 0x20, 0x21, 0x61, 0x24, 0xd9, 0x8c, 0x32, 0x12, 0x08, 0xb9, 0xcb, 0xeb, 0xac, 0x51,
+    0x14, 0x88, 0x88, 0x99, 0x8a, 0x32, 0x05, 0xda, 0x9c, 0x20, 0x03, 0xc9, 0xbb, 0x99, 0x8b, 0x73,
+    0x03, 0x09, 0x45, 0xb0, 0x3e, 0x16, 0x42, 0x00, 0xac, 0x80, 0x80, 0x32, 0x81, 0xab, 0x9a, 0x72,
+    0x15, 0xb9, 0x9b, 0x98, 0x09, 0x45, 0x91, 0xab, 0x38, 0x36, 0xd0, 0xae, 0x19, 0x12, 0x80, 0x18,
+    0x54, 0x23, 0xa8, 0xac, 0x89, 0x00, 0x28, 0x45, 0x12, 0x99, 0xdb, 0xac, 0x09, 0x01, 0x20, 0x33,
+    0xfc, 0x8e, 0x31, 0x83, 0xbc, 0x18, 0x92, 0x8a, 0x72, 0x13, 0x00, 0x98, 0xcc, 0x9a, 0x18, 0x32,
+    0x14, 0x01, 0xf9, 0xbd, 0x19, 0x23, 0x88, 0x11, 0x12, 0x53, 0xa1, 0xbd, 0x09, 0x42, 0x32, 0x80,
+    0x40, 0x83, 0xbf, 0x48, 0x03, 0xeb, 0x8a, 0x32, 0x92, 0xac, 0x72, 0x92, 0xcd, 0x19, 0x01, 0x88,
+    0x09, 0x33, 0xc0, 0x9d, 0x52, 0x92, 0xac, 0x41, 0x02, 0xba, 0x40, 0x04, 0xda, 0x19, 0x14, 0xe9,
+    0x8a, 0x43, 0x81, 0xbb, 0x20, 0x14, 0xbb, 0x2a, 0x16, 0xca, 0x1a, 0x25, 0xb0, 0x8b, 0x43, 0xa2,
+    0xbc, 0x41, 0x04, 0xaa, 0x38, 0x05, 0xfb, 0x0a, 0x32, 0xd4, 0x4d, 0x00, 0x33, 0xa1, 0x9b, 0x52,
+    0x82, 0xad, 0x29, 0x01, 0x89, 0x73, 0x13, 0xd9, 0x8a, 0x11, 0xa8, 0x0b, 0x34, 0xb0, 0x0b, 0x34,
+    0xc0, 0x9c, 0x53, 0x82, 0xdc, 0x0a, 0x22, 0xa0, 0x9b, 0x34, 0xd0, 0x9b, 0x73, 0x82, 0xcb, 0x28,
+    0x25, 0xa0, 0x8b, 0x32, 0xb0, 0xad, 0x40, 0x04, 0xb9, 0x19, 0x23, 0xfb, 0x0b, 0x73, 0x82, 0xcb,
+    0x19, 0x23, 0xb8, 0x0b, 0x34, 0x92, 0xbe, 0x29, 0x25, 0xa0, 0xac, 0x10, 0x13, 0xa8, 0xab, 0x74,
+    0x82, 0xfb, 0x89, 0x21, 0x01, 0x89, 0x31, 0xa2, 0xdd, 0x09, 0x33, 0x92, 0xcb, 0x29, 0x25, 0xa8,
+    0x8c, 0x22, 0xa0, 0xac, 0x28, 0x32, 0x22, 0xb0, 0xaf, 0x08, 0x91, 0xaa, 0x61, 0x14, 0xb8, 0xad,
+    0x28, 0x34, 0x02, 0xba, 0xac, 0x51, 0x23, 0x88, 0x51, 0x83, 0xdc, 0x9a, 0x00, 0x20, 0x45, 0x81,
+    0xac, 0x09, 0x11, 0x10, 0x21, 0xb8, 0xcf, 0x9b, 0x38, 0x35, 0x23, 0x98, 0xbd, 0x34, 0x42, 0x00,
+    0x99, 0xb8, 0xbd, 0x0a, 0x45, 0x81, 0x8b, 0x54, 0xa1, 0x9d, 0x21, 0xc0, 0x8c, 0x31, 0x13, 0x12,
+    0x80, 0xba, 0xdd, 0x0a, 0x33, 0x02, 0x11, 0xb8, 0x8d, 0x43, 0xa0, 0x38, 0x06, 0xec, 0x8b, 0x31,
+    0x83, 0xba, 0x60, 0x03, 0xba, 0xab, 0xbc, 0x39, 0x37, 0x90, 0xab, 0x99, 0x28, 0x83, 0xef, 0x19,
+    0x45, 0x81, 0xaa, 0x20, 0x02, 0xfb, 0x9a, 0x20, 0x44, 0x82, 0xb9, 0x89, 0xa8, 0xaa, 0xaa, 0x29,
+    0x77, 0x14, 0xb9, 0xad, 0x28, 0x12, 0x88, 0x28, 0x22, 0x22, 0xa0, 0xbd, 0x1a, 0x11, 0x31, 0x82,
+    0xbb, 0x29, 0xb1, 0x9e, 0x11, 0xa0, 0xa8, 0xdf, 0x0a, 0x45, 0x91, 0xaa, 0x31, 0x15, 0xa8, 0xfb,
+    0xbc, 0x29, 0x35, 0x13, 0xa8, 0xbe, 0x18, 0x33, 0xb8, 0x1b, 0x43, 0x81, 0xda, 0xcc, 0x09, 0x43,
+    0x33, 0x91, 0xdd, 0x9a, 0x22, 0x00, 0x00, 0x32, 0x24, 0xc8, 0x9b, 0x11, 0xb9, 0x29, 0xd1, 0x9f,
+    0xfd, 0xc4, 0x47, 0x00, 0x51, 0x12, 0x01, 0xb8, 0xbc, 0x08, 0x01, 0x88, 0xbb, 0x70, 0x15, 0xb8,
+    0x8a, 0x12, 0x80, 0x41, 0x83, 0xab, 0x72, 0x02, 0x89, 0x22, 0xd9, 0x9b, 0x98, 0xad, 0x61, 0x33,
+    0x11, 0x80, 0xb8, 0xae, 0x38, 0x84, 0xdf, 0x1a, 0x35, 0x82, 0xaa, 0x09, 0xa8, 0x38, 0x57, 0xa1,
+    0xaa, 0x21, 0x90, 0x8a, 0x81, 0xbb, 0x61, 0x03, 0xec, 0x9b, 0x30, 0x33, 0x21, 0x14, 0xfa, 0x9b,
+    0x21, 0x91, 0x89, 0x12, 0x00, 0x31, 0x83, 0xdd, 0x19, 0x36, 0x92, 0x9a, 0x88, 0x99, 0xb9, 0xcd,
+    0x8b, 0x21, 0x31, 0x44, 0x33, 0xf9, 0xae, 0x30, 0x14, 0xba, 0x19, 0xa0, 0x9c, 0x42, 0x91, 0x89,
+    0x21, 0x24, 0xda, 0x1a, 0x16, 0xda, 0x2a, 0x24, 0xeb, 0x9b, 0x21, 0x24, 0x81, 0x88, 0x99, 0xac,
+    0x31, 0x92, 0x9c, 0x44, 0x90, 0x19, 0x23, 0xb9, 0x1a, 0x43, 0x55, 0x91, 0xbf, 0x9b, 0x21, 0x12,
+    0x99, 0x41, 0x16, 0xb8, 0x8b, 0x16, 0x47, 0x00, 0x29, 0x14, 0xca, 0xab, 0x9a, 0x38, 0x57, 0x91,
+    0x89, 0x63, 0x82, 0x98, 0x89, 0xaa, 0x9a, 0x88, 0x88, 0x11, 0x33, 0xb1, 0x0e, 0x55, 0xa2, 0xae,
+    0x30, 0x13, 0xcb, 0x9b, 0x22, 0x13, 0xa9, 0x40, 0x83, 0xcb, 0x58, 0x03, 0xcc, 0x9a, 0xb0, 0x9b,
+    0x76, 0x82, 0xfb, 0x09, 0x33, 0xa2, 0xbb, 0x20, 0x92, 0x8a, 0xa8, 0xad, 0x50, 0x83, 0x8b, 0x65,
+    0x92, 0xdb, 0x89, 0x01, 0x80, 0x88, 0x89, 0x60, 0x14, 0xd9, 0x8b, 0x32, 0xa0, 0x9c, 0x30, 0x12,
+    0x10, 0xa0, 0xbd, 0x61, 0x03, 0x99, 0x20, 0xc0, 0xbc, 0x18, 0x12, 0x81, 0x89, 0xc9, 0xae, 0x72,
+    0x83, 0xbf, 0x28, 0x14, 0x99, 0x30, 0xa1, 0xac, 0x88, 0x80, 0x51, 0x35, 0x82, 0xda, 0xbb, 0x0a,
+    0x21, 0x43, 0x81, 0x9a, 0x9a, 0x21, 0x37, 0x03, 0xcb, 0x8b, 0x80, 0xcb, 0x1a, 0x32, 0x21, 0x13,
+    0x38, 0x77, 0x17, 0x98, 0x09, 0xa8, 0xbb, 0x18, 0xb0, 0xfc, 0x44, 0x00, 0x13, 0x98, 0x21, 0x92,
+    0x9e, 0x73, 0x17, 0xc9, 0x1a, 0x22, 0xb9, 0x1b, 0x13, 0xeb, 0x29, 0x24, 0x88, 0x50, 0x02, 0xcc,
+    0x0a, 0x21, 0xb8, 0xbb, 0x10, 0xa8, 0x29, 0x37, 0x81, 0xaa, 0xbb, 0x8b, 0x02, 0x28, 0x77, 0x92,
+    0xad, 0x19, 0x80, 0x28, 0x54, 0x02, 0xda, 0x8b, 0x52, 0x91, 0xad, 0x20, 0x82, 0x9a, 0x28, 0x01,
+    0x89, 0x20, 0x81, 0xfb, 0xaf, 0x41, 0x23, 0xca, 0x40, 0x14, 0xb9, 0x8b, 0x80, 0x08, 0x42, 0x23,
+    0xe8, 0xbd, 0x40, 0x14, 0x99, 0x10, 0x81, 0xbb, 0x08, 0xba, 0x48, 0x04, 0xba, 0x31, 0xa0, 0x79,
+    0x17, 0xb8, 0x3a, 0x14, 0xeb, 0x8a, 0x11, 0x99, 0x89, 0x32, 0xa1, 0xbf, 0x58, 0x14, 0xba, 0x39,
+    0x82, 0xac, 0x10, 0xea, 0x0b, 0x44, 0x02, 0x00, 0xba, 0x39, 0x17, 0xb8, 0x28, 0x83, 0xce, 0x8a,
+    0x18, 0x30, 0x43, 0x02, 0xea, 0x9c, 0x52, 0x13, 0xdb, 0x09, 0x23, 0xb8, 0xde, 0xf0, 0x4c, 0x00,
+    0x1b, 0x22, 0xc9, 0x8a, 0x43, 0x13, 0xb8, 0x3a, 0x77, 0x91, 0xab, 0x99, 0x99, 0x18, 0x32, 0x01,
+    0xdb, 0x0a, 0x36, 0xe0, 0x9c, 0x62, 0x03, 0xbb, 0x0a, 0x22, 0x90, 0x89, 0x00, 0x22, 0x02, 0x90,
+    0xec, 0x8b, 0x73, 0x82, 0x9a, 0x20, 0x82, 0xcb, 0xaa, 0x08, 0x45, 0x82, 0xcb, 0x28, 0x03, 0x09,
+    0x42, 0x22, 0x44, 0xc2, 0xcf, 0x29, 0x33, 0x01, 0x00, 0xa8, 0xce, 0x8a, 0x42, 0x13, 0x99, 0x08,
+    0xc0, 0xac, 0x10, 0x02, 0x09, 0x46, 0x92, 0xbf, 0x1a, 0x35, 0x81, 0xa9, 0x18, 0x91, 0xcc, 0x8a,
+    0x53, 0x23, 0x80, 0xa9, 0xbc, 0xab, 0x62, 0x14, 0x90, 0x18, 0x12, 0xfb, 0x9f, 0x21, 0x02, 0x89,
+    0x10, 0xa1, 0x9a, 0x32, 0x91, 0x0b, 0x54, 0x81, 0xcb, 0xbb, 0xac, 0x18, 0x52, 0x33, 0xb8, 0xab,
+    0x00, 0xca, 0x60, 0x84, 0xcc, 0x19, 0x02, 0xda, 0x8a, 0x53, 0x12, 0xa8, 0x08, 0x02, 0xda, 0x8a,
+    0x22, 0xe0, 0x44, 0x00, 0x22, 0x81, 0xdb, 0x8a, 0x28, 0x53, 0x13, 0x99, 0x80, 0xca, 0x58, 0x85,
+    0xef, 0x8a, 0x32, 0x02, 0x98, 0x20, 0x03, 0xdb, 0x8b, 0x42, 0x14, 0x80, 0x21, 0xa2, 0xef, 0x8a,
+    0x10, 0x10, 0x43, 0x82, 0xba, 0x9b, 0x42, 0x05, 0xea, 0x8b, 0x42, 0x92, 0xba, 0x28, 0x26, 0x82,
+    0x88, 0xaa, 0x0a, 0x22, 0xc8, 0x8c, 0x62, 0x82, 0xca, 0x18, 0x14, 0xa8, 0x0a, 0x81, 0xac, 0x20,
+    0xf9, 0x9e, 0x51, 0x24, 0xb0, 0x0a, 0x11, 0xa8, 0x8a, 0x00, 0x89, 0x01, 0x88, 0x72, 0x16, 0xa8,
+    0x09, 0x33, 0xa1, 0xef, 0x89, 0x01, 0x88, 0x40, 0x25, 0xb0, 0xbb, 0x10, 0xa0, 0xac, 0x73, 0x14,
+    0xa8, 0x8a, 0x31, 0x93, 0xbe, 0x0a, 0x00, 0x19, 0x64, 0x22, 0x08, 0xca, 0xbb, 0xaa, 0x9c, 0x73,
+    0x24, 0xb8, 0xab, 0x99, 0x9a, 0x29, 0x35, 0x11, 0x31, 0x26, 0xb0, 0xad, 0x09, 0x11, 0xa0, 0xac,
+    0x50, 0x12, 0x09, 0x34, 0x71, 0x46, 0x46, 0x00, 0xf8, 0xae, 0x19, 0x33, 0x11, 0x21, 0x02, 0xd8,
+    0xdc, 0x9b, 0x21, 0x11, 0x18, 0x33, 0x13, 0x80, 0xdb, 0x0a, 0x24, 0x02, 0x02, 0xfa, 0xbe, 0x99,
+    0x20, 0x34, 0x13, 0x88, 0x08, 0x13, 0xfc, 0x9e, 0x20, 0x12, 0x01, 0xa9, 0x9b, 0x98, 0x8a, 0x72,
+    0x01, 0x8a, 0x41, 0x34, 0x02, 0xcc, 0x0a, 0x81, 0xdc, 0x9b, 0x08, 0x00, 0x31, 0x47, 0x81, 0xcb,
+    0x09, 0x01, 0x88, 0x18, 0x53, 0x82, 0xcd, 0x19, 0x04, 0xaa, 0x38, 0x15, 0xa8, 0x8a, 0x63, 0x13,
+    0xca, 0x28, 0x13, 0xfb, 0x9c, 0x08, 0x02, 0x88, 0x41, 0x13, 0xab, 0x28, 0x02, 0xea, 0xcc, 0x0a,
+    0x23, 0xb8, 0x71, 0x26, 0x90, 0x99, 0xb9, 0xba, 0x09, 0x53, 0x83, 0xdc, 0x39, 0x37, 0xa1, 0xcc,
+    0x09, 0x00, 0x00, 0x00, 0x88, 0x21, 0x12, 0x98, 0x08, 0x32, 0x05, 0xfc, 0x9b, 0x21, 0x02, 0x18,
+    0x45, 0x03, 0xfb, 0x9a, 0x08, 0x08, 0x42, 0x82, 0x17, 0x08, 0x49, 0x00, 0xcb, 0x9a, 0x31, 0x12,
+    0x09, 0x56, 0x92, 0xac, 0x20, 0x13, 0x99, 0x8b, 0x64, 0x04, 0xca, 0x8a, 0x01, 0x08, 0x22, 0xc9,
+    0x0b, 0x44, 0x83, 0xcc, 0x1a, 0x45, 0x81, 0xba, 0x9b, 0x18, 0x10, 0x10, 0x24, 0xa0, 0x28, 0x47,
+    0x01, 0xba, 0x19, 0x14, 0xda, 0x9c, 0xa9, 0x9a, 0x53, 0x35, 0x12, 0xfb, 0x9b, 0x31, 0x02, 0x80,
+    0x80, 0x9a, 0xda, 0xac, 0x62, 0x13, 0xb9, 0x28, 0x13, 0xa8, 0xbb, 0x29, 0x35, 0x92, 0xde, 0xab,
+    0x18, 0x23, 0xb1, 0xce, 0x2a, 0x47, 0x01, 0xbb, 0x9a, 0x21, 0x01, 0xca, 0x8a, 0x98, 0x48, 0x47,
+    0x01, 0x99, 0x18, 0x20, 0xc8, 0xaf, 0x18, 0x12, 0x98, 0x00, 0xca, 0x8c, 0x52, 0x25, 0xb8, 0xac,
+    0x31, 0x02, 0xca, 0x0a, 0x34, 0xa2, 0xab, 0x52, 0xa1, 0xbc, 0x18, 0x12, 0x23, 0xb8, 0xad, 0x89,
+    0x08, 0x13, 0xfc, 0x9e, 0x30, 0x24, 0x80, 0x89, 0x01, 0xca, 0x1a, 0x46, 0x2b, 0x0d, 0x4c, 0x00,
+    0x82, 0xcd, 0x0b, 0x43, 0x12, 0x98, 0xaa, 0x0a, 0x44, 0x91, 0xbb, 0x08, 0x31, 0x24, 0xfa, 0x9b,
+    0x62, 0x23, 0xa0, 0xbc, 0x8a, 0x10, 0x21, 0x44, 0xa1, 0xad, 0x38, 0x13, 0x98, 0x99, 0x51, 0x25,
+    0xb9, 0xae, 0x8a, 0x89, 0x62, 0x03, 0xda, 0x0b, 0x44, 0x81, 0xaa, 0x31, 0x01, 0xda, 0xac, 0x08,
+    0x82, 0x18, 0x46, 0x02, 0x99, 0x10, 0x10, 0x88, 0x98, 0xdc, 0x9b, 0x30, 0x83, 0xce, 0x0a, 0x53,
+    0x12, 0x21, 0x15, 0xd9, 0xab, 0x18, 0x00, 0x00, 0x08, 0x90, 0xbe, 0x78, 0x27, 0x98, 0x9b, 0x31,
+    0x03, 0xc9, 0x8a, 0x11, 0x98, 0x18, 0xa2, 0xcf, 0x89, 0x42, 0x22, 0xa8, 0x19, 0x03, 0xbf, 0x2a,
+    0x15, 0x90, 0x8a, 0x11, 0xc9, 0x9c, 0x74, 0x12, 0xb9, 0x19, 0x22, 0xfa, 0x8c, 0x42, 0x02, 0xab,
+    0x00, 0xa8, 0x8c, 0x51, 0x12, 0xc9, 0x09, 0x34, 0xa1, 0xad, 0x29, 0x32, 0x80, 0xb9, 0xba, 0x8a,
+    0x7d, 0xfb, 0x41, 0x00, 0x72, 0x13, 0xca, 0x8a, 0x01, 0x98, 0x9a, 0x18, 0xa0, 0x9c, 0x54, 0xe0,
+    0xbd, 0x40, 0x03, 0xeb, 0x1a, 0x25, 0xa1, 0xaa, 0x20, 0x22, 0x98, 0x19, 0x14, 0xec, 0x2a, 0x44,
+    0xa0, 0xab, 0x89, 0x20, 0x13, 0xdc, 0x8b, 0x53, 0x02, 0xaa, 0x09, 0x21, 0x81, 0x09, 0x20, 0xfa,
+    0xbe, 0x28, 0x37, 0x81, 0x89, 0x21, 0x00, 0xca, 0xac, 0x18, 0xc8, 0x9c, 0x63, 0x92, 0x99, 0x28,
+    0x43, 0x13, 0xdb, 0x1a, 0x12, 0xdb, 0xcb, 0x8a, 0x61, 0x14, 0xa8, 0xaa, 0x20, 0x37, 0x81, 0x9b,
+    0x30, 0x14, 0xb8, 0xbe, 0x9a, 0x88, 0x09, 0x42, 0x82, 0x89, 0x74, 0x14, 0xc8, 0xbd, 0x30, 0x34,
+    0xb8, 0xad, 0x18, 0x33, 0x80, 0x89, 0x08, 0x18, 0x52, 0x12, 0xea, 0x9a, 0x32, 0xa1, 0xac, 0x88,
+    0xb9, 0x39, 0x25, 0x80, 0x73, 0x25, 0xa0, 0xbd, 0x1a, 0x32, 0xb0, 0xcb, 0x9a, 0x10, 0x12, 0x72,
+    0x37, 0xa1, 0xab, 0x41, 0x37, 0x4d, 0x4d, 0x00, 0x92, 0xeb, 0x9b, 0x18, 0x34, 0xa8, 0xac, 0x19,
+    0x31, 0x45, 0x83, 0xba, 0xab, 0x29, 0x44, 0xb1, 0xae, 0x20, 0x01, 0x80, 0x90, 0xbb, 0x68, 0x35,
+    0x91, 0xdb, 0x18, 0x43, 0xa0, 0xbd, 0x19, 0x43, 0x03, 0xc9, 0xbc, 0x9a, 0x30, 0x47, 0x92, 0xcb,
+    0x39, 0x14, 0x98, 0x89, 0xa9, 0x28, 0x25, 0xa8, 0x99, 0xaa, 0x48, 0x25, 0xa8, 0xab, 0x0a, 0x64,
+    0xa2, 0xac, 0x40, 0x23, 0x81, 0xdc, 0xac, 0x10, 0x12, 0x11, 0x90, 0x30, 0x84, 0xcc, 0x40, 0x82,
+    0xcb, 0x19, 0x53, 0x02, 0xca, 0x8b, 0x00, 0x41, 0x15, 0xb9, 0x0a, 0x82, 0xce, 0x19, 0x33, 0x91,
+    0xaa, 0x9a, 0x11, 0xd9, 0x9c, 0x51, 0x03, 0xaa, 0x09, 0x32, 0x44, 0xb1, 0xbd, 0x61, 0x83, 0xdd,
+    0x9a, 0x00, 0x20, 0x34, 0x22, 0xc9, 0xbe, 0x18, 0x14, 0xa0, 0xaa, 0x8a, 0x73, 0x81, 0x9a, 0x11,
+    0xa1, 0x8a, 0x18, 0x51, 0x13, 0xca, 0x68, 0x14, 0x5a, 0x26, 0x48, 0x00, 0x98, 0x19, 0x24, 0x90,
+    0xdb, 0xaa, 0x89, 0x33, 0xc2, 0xbe, 0x8a, 0x21, 0x44, 0x23, 0x12, 0xa8, 0xbe, 0x8a, 0x10, 0x90,
+    0xca, 0x2a, 0x47, 0x12, 0x80, 0xcc, 0x29, 0x14, 0xdc, 0x09, 0x33, 0x23, 0x92, 0xcf, 0x8a, 0x02,
+    0x89, 0x42, 0x83, 0x28, 0x34, 0xd9, 0xac, 0x89, 0x18, 0x33, 0xd8, 0xad, 0x08, 0x32, 0x44, 0x33,
+    0xa0, 0xbc, 0x1a, 0x23, 0xf9, 0x9c, 0x32, 0x03, 0xb9, 0xbb, 0x19, 0x33, 0xa0, 0x8b, 0x73, 0x15,
+    0xb8, 0x1a, 0x45, 0x02, 0x80, 0xd9, 0xbb, 0x31, 0xa2, 0xcd, 0x0a, 0x73, 0x23, 0xc9, 0x0b, 0x53,
+    0x11, 0x98, 0xbc, 0x09, 0x23, 0xb0, 0xbe, 0x8b, 0x63, 0x23, 0x01, 0xd8, 0xcc, 0x28, 0x24, 0x12,
+    0xa9, 0x9a, 0x22, 0xd8, 0xad, 0x20, 0x33, 0xa0, 0xac, 0x42, 0x92, 0x1a, 0x12, 0x9a, 0x42, 0xa1,
+    0x40, 0x94, 0xdf, 0x89, 0x10, 0x33, 0xa1, 0xbc, 0xb9, 0x8c, 0x73, 0x04, 0x5d, 0x44, 0x4c, 0x00,
+    0x08, 0x00, 0xb9, 0x19, 0x03, 0xcc, 0x0a, 0x01, 0x89, 0x62, 0x82, 0xbb, 0x49, 0x36, 0xb0, 0xce,
+    0x19, 0x22, 0xb8, 0x9c, 0x41, 0xa1, 0xae, 0x20, 0x83, 0x9a, 0x43, 0xa1, 0xbb, 0x19, 0x54, 0x14,
+    0xda, 0x9c, 0x30, 0x02, 0x98, 0x20, 0x13, 0xaa, 0x18, 0xfa, 0x8c, 0x33, 0x83, 0xa9, 0xba, 0x8a,
+    0xf0, 0xbe, 0x48, 0x24, 0x01, 0x31, 0xd8, 0xbd, 0x19, 0x45, 0x02, 0xba, 0x8b, 0x00, 0x31, 0x34,
+    0x23, 0xa9, 0xcd, 0x9a, 0x80, 0x88, 0x61, 0x34, 0xe8, 0xad, 0x19, 0x24, 0x01, 0x99, 0x08, 0x32,
+    0xc0, 0xbd, 0x0b, 0x73, 0x14, 0xa0, 0x9c, 0x10, 0x01, 0x90, 0xca, 0x8a, 0x20, 0x01, 0x10, 0x34,
+    0x44, 0x03, 0xfb, 0xac, 0x08, 0x01, 0x11, 0x01, 0x99, 0xaa, 0x20, 0x93, 0xdf, 0x30, 0x15, 0x98,
+    0x11, 0xa8, 0x9c, 0x80, 0x09, 0x44, 0x12, 0xa8, 0xdd, 0x8b, 0x41, 0x22, 0x82, 0xc9, 0x8a, 0x80,
+    0x64, 0xd6, 0x43, 0x00, 0x89, 0x56, 0x93, 0xce, 0x0a, 0x32, 0x32, 0x01, 0xdb, 0x9b, 0x20, 0x02,
+    0xa9, 0xbb, 0x29, 0x45, 0x12, 0xa8, 0xcc, 0x09, 0x25, 0x91, 0x29, 0x02, 0x99, 0x98, 0xff, 0x1a,
+    0x23, 0x12, 0x02, 0xfb, 0x0b, 0x33, 0xe8, 0x9b, 0x40, 0x23, 0xa0, 0xba, 0xaa, 0x38, 0x77, 0x01,
+    0xa9, 0x20, 0x01, 0xdb, 0x08, 0x01, 0x99, 0x88, 0xfb, 0xc7, 0x21, 0x80, 0x21, 0x82, 0xca, 0xab,
+    0x18, 0x53, 0xa1, 0xac, 0x29, 0x22, 0x13, 0x90, 0x10, 0x22, 0x08, 0xa8, 0xdf, 0x38, 0x16, 0x98,
+    0xab, 0x9a, 0x20, 0x25, 0x81, 0x08, 0x30, 0x46, 0xb2, 0xcf, 0x8a, 0x43, 0x01, 0xaa, 0x8a, 0x28,
+    0x64, 0x02, 0xa9, 0x09, 0x02, 0xba, 0x0a, 0x34, 0x81, 0x98, 0xcd, 0x9a, 0x88, 0x8a, 0x73, 0x33,
+    0x33, 0xc8, 0x9c, 0x11, 0xdc, 0x0a, 0x23, 0xb9, 0xac, 0x19, 0x66, 0x03, 0xca, 0x19, 0x33, 0xd9,
+    0xac, 0x20, 0x32, 0x12, 0x35, 0x58, 0x48, 0x00, 0xa0, 0xcd, 0x9b, 0x10, 0x11, 0xa9, 0x9b, 0x51,
+    0x54, 0x23, 0xb0, 0xac, 0x41, 0x03, 0xdb, 0xdc, 0x8a, 0x22, 0x12, 0x22, 0x12, 0xba, 0x28, 0x33,
+    0x81, 0xfb, 0xaf, 0x20, 0x24, 0xc9, 0xbc, 0x09, 0x62, 0x33, 0xa0, 0x9a, 0x09, 0x63, 0x83, 0xde,
+    0x0a, 0x33, 0x02, 0x88, 0xaa, 0xaa, 0x9a, 0x38, 0x35, 0x12, 0x00, 0x00, 0x88, 0x9a, 0x31, 0xa3,
+    0x9c, 0x65, 0x92, 0xcd, 0xaa, 0xdb, 0x1a, 0x55, 0x13, 0xa0, 0xcb, 0x8a, 0x43, 0xa0, 0x9d, 0x53,
+    0x82, 0xbb, 0x8a, 0x01, 0x80, 0x30, 0x47, 0x81, 0xab, 0x40, 0x13, 0xda, 0xad, 0x20, 0x25, 0xa0,
+    0xac, 0x99, 0x98, 0x41, 0x34, 0xa1, 0xbb, 0x58, 0x23, 0xfb, 0x8b, 0x44, 0x82, 0xaa, 0x29, 0x91,
+    0xbb, 0x0b, 0x42, 0x22, 0x11, 0x31, 0x34, 0xc8, 0xbf, 0x99, 0x08, 0x11, 0x90, 0xca, 0x0a, 0x53,
+    0x83, 0xcc, 0x58, 0x14, 0xdc, 0x9b, 0x73, 0x12, 0xa6, 0x77, 0x54, 0x00, 0xb9, 0x9a, 0x10, 0x11,
+    0x11, 0xa0, 0xbb, 0x9b, 0x10, 0x12, 0xca, 0x1a, 0x55, 0x12, 0x00, 0x00, 0xb9, 0xbd, 0x68, 0x24,
+    0xfa, 0x9c, 0x30, 0x13, 0xa9, 0x1a, 0x34, 0xa1, 0xbb, 0x08, 0xc0, 0xad, 0x62, 0x34, 0xa0, 0xbd,
+    0x89, 0x23, 0x02, 0x89, 0x98, 0xab, 0x19, 0x55, 0x23, 0xc8, 0x9b, 0xa9, 0xac, 0x73, 0x05, 0xca,
+    0x8a, 0x10, 0x12, 0x90, 0x09, 0x34, 0x02, 0x89, 0x62, 0x02, 0xec, 0x0b, 0x63, 0x02, 0xcb, 0x89,
+    0x00, 0x88, 0x10, 0xc0, 0xae, 0x48, 0x35, 0x91, 0xac, 0x29, 0x23, 0xc9, 0x9a, 0x21, 0x90, 0x09,
+    0x35, 0x13, 0xc9, 0xbc, 0x48, 0x36, 0x81, 0xaa, 0x88, 0xa9, 0x00, 0xc8, 0x9c, 0x88, 0xcb, 0x09,
+    0x64, 0x43, 0xa0, 0xbd, 0x18, 0x24, 0x81, 0xbb, 0x48, 0x25, 0xc8, 0xbb, 0x8a, 0x98, 0x28, 0x47,
+    0x13, 0xb9, 0x0b, 0x11, 0x90, 0xdb, 0x9b, 0x73, 0x04, 0xb9, 0xac, 0x00, 0xff, 0xaa, 0x4b, 0x00,
+    0x21, 0x12, 0x98, 0xbb, 0x59, 0x37, 0x91, 0xac, 0x10, 0x82, 0xcb, 0x30, 0x26, 0xc8, 0xbc, 0x20,
+    0x35, 0x80, 0xbb, 0xab, 0x38, 0x45, 0x12, 0x80, 0xca, 0x9b, 0x32, 0x23, 0xc9, 0xcd, 0x8a, 0x10,
+    0x73, 0x26, 0xb8, 0xac, 0x20, 0x13, 0x90, 0xac, 0x29, 0x23, 0x98, 0x88, 0xea, 0xab, 0x31, 0x45,
+    0x12, 0xb9, 0x8c, 0x73, 0x22, 0xb8, 0xbd, 0x8a, 0x41, 0x13, 0xc9, 0xac, 0x38, 0x14, 0x90, 0x0a,
+    0x21, 0xa1, 0xbd, 0x29, 0x26, 0xa0, 0x9c, 0x29, 0x54, 0xa2, 0xbd, 0x19, 0x22, 0x08, 0x21, 0xb1,
+    0x9d, 0x30, 0x33, 0x92, 0xbb, 0x29, 0xe8, 0x9d, 0x62, 0x82, 0xdc, 0x9b, 0x30, 0x24, 0x81, 0x89,
+    0x00, 0x10, 0x80, 0x10, 0x82, 0xac, 0x71, 0x25, 0xa8, 0xab, 0xb9, 0xab, 0x40, 0x36, 0x80, 0x99,
+    0x98, 0xbb, 0x70, 0x03, 0xdc, 0x19, 0x13, 0xca, 0x8a, 0x42, 0x92, 0xcc, 0x58, 0x35, 0x81, 0x9a,
+    0x0d, 0x2e, 0x4a, 0x00, 0x89, 0x00, 0xa0, 0x0a, 0x35, 0x82, 0xaa, 0xed, 0xab, 0x31, 0x14, 0x32,
+    0x12, 0x89, 0x02, 0xfe, 0x9d, 0x20, 0x12, 0x00, 0x88, 0x30, 0x34, 0xc9, 0x9c, 0x22, 0x90, 0xac,
+    0xaa, 0x0a, 0x33, 0x03, 0x51, 0x55, 0x12, 0xb0, 0xbd, 0x19, 0x23, 0xb0, 0xcd, 0xab, 0x08, 0x42,
+    0x33, 0xe8, 0x9c, 0x51, 0x14, 0x98, 0x88, 0xaa, 0x0a, 0x44, 0x82, 0xdb, 0xac, 0x1a, 0x53, 0x13,
+    0x90, 0xcb, 0x9b, 0x30, 0x33, 0x02, 0x89, 0x18, 0x12, 0xf9, 0x0c, 0x54, 0xb2, 0xdf, 0x08, 0x22,
+    0x00, 0x88, 0x11, 0x11, 0x90, 0xbb, 0x89, 0x52, 0x23, 0xc8, 0xcc, 0x9a, 0x20, 0x82, 0xb9, 0x48,
+    0x37, 0x82, 0x9a, 0x61, 0x14, 0x98, 0xa9, 0xce, 0x8a, 0x32, 0x02, 0x80, 0xca, 0x8b, 0x32, 0x22,
+    0x36, 0xf8, 0x9e, 0x41, 0x23, 0xc8, 0xac, 0x0a, 0x53, 0x03, 0xa8, 0x99, 0x89, 0x99, 0x19, 0x44,
+    0x24, 0xb8, 0xbe, 0x0a, 0x34, 0xac, 0x4e, 0x00, 0x43, 0x13, 0xa8, 0xac, 0x0a, 0x43, 0x02, 0xea,
+    0xaa, 0x18, 0x21, 0x11, 0x41, 0x23, 0xf9, 0xbd, 0x18, 0x32, 0x11, 0x88, 0x88, 0x31, 0x27, 0xb0,
+    0xaf, 0x08, 0x10, 0x31, 0x14, 0xc9, 0xcb, 0x9a, 0x32, 0x14, 0xa8, 0x9a, 0xba, 0x28, 0x35, 0x81,
+    0x9a, 0x30, 0x24, 0xea, 0x8b, 0x12, 0x90, 0xbb, 0x49, 0x57, 0x81, 0x88, 0x88, 0x09, 0x31, 0x02,
+    0xc8, 0xff, 0x8b, 0x31, 0x01, 0x28, 0x22, 0xb9, 0x88, 0xc9, 0x29, 0x47, 0x91, 0xaa, 0x09, 0x62,
+    0xa1, 0xce, 0x2a, 0x35, 0x03, 0xba, 0xbd, 0x39, 0x46, 0x01, 0xa9, 0xac, 0x19, 0x53, 0x81, 0xa9,
+    0x9a, 0x99, 0x10, 0x42, 0x43, 0x90, 0xdb, 0xac, 0x38, 0x27, 0x91, 0x8a, 0x00, 0x90, 0x09, 0x02,
+    0xa9, 0x9b, 0x80, 0x88, 0x10, 0x62, 0x57, 0x03, 0xd9, 0xbb, 0x18, 0x43, 0x83, 0x99, 0x9a, 0xcd,
+    0x9b, 0x10, 0x11, 0x20, 0x54, 0x12, 0xb9, 0xad, 0x74, 0xf2, 0x47, 0x00, 0x40, 0x35, 0x91, 0xdb,
+    0xbc, 0x0a, 0x45, 0x03, 0x90, 0xca, 0x9c, 0x31, 0x14, 0x11, 0x01, 0xcb, 0x8b, 0xa9, 0x19, 0x46,
+    0x81, 0xbc, 0x0a, 0x53, 0x81, 0xca, 0x09, 0x80, 0x98, 0x09, 0x32, 0x13, 0x81, 0x10, 0x00, 0x89,
+    0x48, 0x67, 0x82, 0xbc, 0x0a, 0x13, 0xb9, 0xbc, 0xcb, 0x38, 0x67, 0x92, 0xcc, 0x8a, 0x43, 0x03,
+    0x99, 0x88, 0xc9, 0xab, 0x60, 0x33, 0xb0, 0xbc, 0x9b, 0x8a, 0x64, 0x34, 0x90, 0x9b, 0x89, 0xca,
+    0x9b, 0x11, 0x42, 0x44, 0x83, 0x98, 0x81, 0xfa, 0x8a, 0x22, 0x22, 0x13, 0xf9, 0xab, 0x89, 0x00,
+    0x08, 0x98, 0x98, 0x9b, 0x70, 0x24, 0x01, 0x34, 0xb2, 0xff, 0x89, 0x31, 0x33, 0xa0, 0xcb, 0xaa,
+    0x19, 0x46, 0x12, 0xaa, 0xaa, 0xaa, 0x89, 0xa8, 0x49, 0x67, 0x81, 0xba, 0x0a, 0x32, 0x13, 0xeb,
+    0x8a, 0x12, 0xa8, 0x98, 0x80, 0x52, 0x03, 0xcd, 0x0a, 0x21, 0x42, 0x22, 0xd7, 0x07, 0x45, 0x00,
+    0x81, 0xba, 0x48, 0x26, 0xd8, 0xad, 0x89, 0x20, 0x33, 0x02, 0x88, 0x99, 0x30, 0x03, 0xda, 0xcd,
+    0x0c, 0x64, 0x03, 0x88, 0x90, 0xdc, 0x8a, 0x18, 0x41, 0x13, 0xeb, 0x1a, 0x43, 0x81, 0x00, 0x90,
+    0xca, 0x89, 0x53, 0x14, 0xa8, 0xaa, 0x99, 0xba, 0x9b, 0x52, 0x45, 0x82, 0xb9, 0xbc, 0xbb, 0x78,
+    0x26, 0x91, 0xaa, 0x88, 0x99, 0x19, 0x33, 0x02, 0xda, 0x9c, 0x32, 0x25, 0x23, 0xa1, 0xaf, 0x9a,
+    0x88, 0x21, 0x43, 0x82, 0xdd, 0xab, 0x28, 0x11, 0x32, 0x93, 0xde, 0x1a, 0x53, 0x02, 0x98, 0x99,
+    0x89, 0x52, 0x92, 0xcd, 0x19, 0x24, 0x90, 0xbb, 0xac, 0x10, 0x44, 0x43, 0xa1, 0xbf, 0x19, 0x33,
+    0x01, 0x80, 0x90, 0xba, 0x9b, 0x42, 0x03, 0xec, 0xbb, 0x8a, 0x32, 0x44, 0x24, 0xa1, 0xdd, 0x0a,
+    0x42, 0x81, 0xaa, 0x42, 0x13, 0xeb, 0x9a, 0x00, 0xa9, 0x38, 0x37, 0x02, 0xaa, 0xab, 0x89, 0x10,
+    0x98, 0xcd, 0x42, 0x00, 0x01, 0x42, 0xb1, 0xaf, 0x30, 0x45, 0x02, 0xc8, 0xbd, 0x8a, 0x21, 0x43,
+    0x03, 0xba, 0x38, 0x37, 0xa1, 0xbe, 0x19, 0x12, 0x99, 0x38, 0x36, 0x82, 0xd9, 0x9b, 0x18, 0x90,
+    0x88, 0x21, 0x11, 0x62, 0x12, 0xec, 0x9b, 0x21, 0x24, 0x81, 0xcb, 0x29, 0x25, 0xa8, 0x8b, 0xb0,
+    0xbe, 0x39, 0x27, 0x81, 0xac, 0x38, 0x26, 0x81, 0x9a, 0xbb, 0xbb, 0x68, 0x36, 0x92, 0xbd, 0x09,
+    0x21, 0x32, 0x91, 0xae, 0x8a, 0xa9, 0x09, 0x45, 0x13, 0x80, 0xb9, 0x19, 0x45, 0x12, 0xb9, 0xcd,
+    0xab, 0x20, 0x84, 0xcb, 0x48, 0x24, 0xc9, 0x9b, 0x20, 0x32, 0x43, 0x12, 0xe9, 0x9c, 0x20, 0x12,
+    0x99, 0x89, 0xa8, 0x8b, 0x31, 0x02, 0x52, 0xc1, 0xef, 0x19, 0x44, 0x22, 0x98, 0xab, 0x9a, 0x08,
+    0x54, 0x03, 0xcc, 0x9b, 0x88, 0x10, 0x24, 0x81, 0x01, 0xd9, 0xac, 0x41, 0x13, 0x98, 0x19, 0x81,
+    0xdd, 0x1a, 0x36, 0x82, 0x24, 0x44, 0x4c, 0x00, 0xab, 0x88, 0xc8, 0xab, 0x58, 0x35, 0x82, 0xba,
+    0x99, 0xba, 0x9c, 0x62, 0x24, 0xa0, 0xcb, 0x89, 0x42, 0x34, 0x02, 0xda, 0xac, 0x8a, 0x21, 0x12,
+    0x18, 0x54, 0x13, 0xfa, 0xcb, 0x19, 0x42, 0x03, 0xa9, 0x8a, 0x01, 0xa9, 0x8b, 0x31, 0xa0, 0x18,
+    0xa1, 0xdf, 0x18, 0x24, 0x81, 0x08, 0x62, 0x14, 0xc9, 0x8b, 0x11, 0x01, 0x81, 0xdb, 0x8a, 0x41,
+    0x53, 0x02, 0xcb, 0x9a, 0xec, 0x9a, 0x10, 0x10, 0x47, 0x91, 0xbb, 0x10, 0x12, 0x22, 0xd8, 0x9c,
+    0x00, 0xa9, 0x38, 0x13, 0x80, 0x80, 0x72, 0x36, 0xb0, 0x9c, 0x11, 0x10, 0x11, 0xe9, 0x8a, 0x01,
+    0x99, 0x10, 0xc8, 0xad, 0xaa, 0x1a, 0x55, 0x42, 0x43, 0xa1, 0xae, 0x28, 0x12, 0x10, 0x80, 0xba,
+    0xcd, 0xbc, 0x18, 0x36, 0x01, 0xa9, 0x99, 0x08, 0x11, 0x30, 0x57, 0x82, 0xca, 0xab, 0x29, 0x34,
+    0x02, 0x89, 0xb9, 0xbd, 0xa9, 0xca, 0x50, 0x27, 0xec, 0x27, 0x4f, 0x00, 0x81, 0xa9, 0x9a, 0x41,
+    0x13, 0x98, 0x00, 0x9a, 0x30, 0xb2, 0x8e, 0xb1, 0xdf, 0x29, 0x02, 0x8a, 0x44, 0x23, 0x98, 0xaa,
+    0x08, 0xd9, 0xac, 0x18, 0x32, 0x47, 0x92, 0xcd, 0x9b, 0x10, 0x53, 0x12, 0xa8, 0xbb, 0xac, 0x28,
+    0x45, 0x23, 0x90, 0xdb, 0xbc, 0x19, 0x53, 0x23, 0x81, 0xbb, 0xab, 0x88, 0x11, 0xa0, 0xaf, 0x31,
+    0x26, 0x01, 0xb8, 0xbe, 0x20, 0x15, 0x90, 0xaa, 0x9a, 0x30, 0x35, 0x12, 0xc8, 0xce, 0x8a, 0x21,
+    0x13, 0x88, 0x10, 0x81, 0x99, 0x18, 0x90, 0xcd, 0x9b, 0x50, 0x36, 0x82, 0xdb, 0x8a, 0x32, 0x02,
+    0xc9, 0xbb, 0x3a, 0x46, 0x02, 0x99, 0x8a, 0x41, 0x02, 0xba, 0x09, 0x11, 0x01, 0xe9, 0xbd, 0x9a,
+    0x41, 0x12, 0xea, 0x9a, 0x52, 0x23, 0x11, 0xa8, 0xdc, 0x9a, 0x20, 0x23, 0x45, 0x13, 0x98, 0xcb,
+    0x8a, 0x43, 0xd0, 0xae, 0x08, 0x80, 0x20, 0xb0, 0xaf, 0x50, 0x34, 0x01, 0xa8, 0x32, 0x4b, 0x00,
+    0x98, 0xcd, 0x0a, 0x53, 0x03, 0x99, 0x8a, 0xb9, 0xab, 0x30, 0xb8, 0x9d, 0x44, 0x23, 0x11, 0x90,
+    0x09, 0x42, 0xc8, 0xac, 0x98, 0x40, 0x35, 0xc0, 0x9b, 0x00, 0xa9, 0x8a, 0x89, 0x73, 0x14, 0xaa,
+    0xcb, 0x9b, 0x40, 0x33, 0x64, 0x03, 0xda, 0x8a, 0x21, 0x11, 0x13, 0xa9, 0x9c, 0x89, 0xea, 0x9b,
+    0x73, 0x14, 0x08, 0x01, 0xe9, 0xac, 0x88, 0x42, 0x35, 0x90, 0x8a, 0x01, 0xca, 0x9b, 0x08, 0x42,
+    0x03, 0xbc, 0x1a, 0x32, 0x46, 0x83, 0xcc, 0x0a, 0x98, 0x09, 0x45, 0x22, 0x22, 0xe8, 0xad, 0x19,
+    0x10, 0x32, 0x03, 0xdb, 0xaa, 0x18, 0x63, 0x82, 0xac, 0x8a, 0x80, 0x20, 0x36, 0x12, 0xa8, 0x99,
+    0xca, 0xce, 0x8b, 0x10, 0x32, 0x35, 0x82, 0xbb, 0x09, 0x12, 0x80, 0xba, 0x1a, 0x45, 0x12, 0x12,
+    0xc8, 0xad, 0x9a, 0xfb, 0xbb, 0x1a, 0x53, 0x12, 0x20, 0x82, 0xcc, 0x19, 0x24, 0xa1, 0xcc, 0x71,
+    0xec, 0x0d, 0x4b, 0x00, 0x24, 0xd9, 0xab, 0x09, 0x30, 0x34, 0xa1, 0xaa, 0x10, 0x80, 0x98, 0x62,
+    0x05, 0xfa, 0x8b, 0x21, 0x12, 0x11, 0x90, 0xb9, 0xce, 0x8a, 0x31, 0x23, 0x82, 0xdb, 0x19, 0x13,
+    0xa8, 0x09, 0x42, 0x35, 0xd1, 0xbe, 0x18, 0x42, 0x12, 0xb8, 0xbd, 0x09, 0x24, 0xb8, 0xac, 0x41,
+    0x45, 0x13, 0xc9, 0xad, 0x8a, 0x21, 0x23, 0x01, 0xaa, 0x9b, 0x11, 0x90, 0xaa, 0x99, 0x70, 0x35,
+    0x90, 0xba, 0x9a, 0x74, 0x14, 0xeb, 0xab, 0x08, 0x34, 0x23, 0x90, 0xb9, 0xab, 0x99, 0x8a, 0x72,
+    0x24, 0x81, 0xba, 0xac, 0x38, 0x02, 0x88, 0x80, 0xea, 0xbb, 0x19, 0x47, 0x03, 0x99, 0x21, 0x92,
+    0xce, 0xaa, 0x9a, 0x38, 0x47, 0xa0, 0x9b, 0x41, 0x83, 0xcb, 0xbb, 0x28, 0x57, 0x02, 0x80, 0xa8,
+    0xaa, 0x20, 0xa0, 0x9c, 0x11, 0x43, 0x24, 0xc8, 0x1a, 0x25, 0x92, 0xea, 0xbd, 0x09, 0x43, 0x33,
+    0x13, 0xba, 0xcb, 0xaa, 0x90, 0xd9, 0x45, 0x00, 0x50, 0x14, 0xca, 0x9a, 0x31, 0x24, 0xb8, 0xae,
+    0x8a, 0x63, 0x24, 0xb0, 0x9c, 0x31, 0x13, 0x80, 0x98, 0xab, 0x41, 0xe0, 0xad, 0x20, 0x80, 0x28,
+    0x33, 0x80, 0x33, 0xf8, 0xaf, 0x28, 0x22, 0x12, 0x88, 0x20, 0x93, 0xef, 0x0a, 0x21, 0x98, 0x89,
+    0x10, 0x01, 0x21, 0x32, 0x35, 0x81, 0xec, 0xab, 0x89, 0x08, 0x71, 0x26, 0xa8, 0xac, 0x88, 0x01,
+    0x01, 0x00, 0x80, 0x08, 0x44, 0x82, 0xbb, 0x29, 0x46, 0x91, 0xde, 0x9b, 0x40, 0x33, 0x02, 0xca,
+    0x9b, 0x21, 0x90, 0x9a, 0x20, 0x23, 0x33, 0x81, 0x89, 0xc9, 0xbf, 0x99, 0xb9, 0xab, 0x48, 0x67,
+    0x13, 0xc9, 0x0a, 0x90, 0x99, 0x32, 0xd8, 0x8c, 0x63, 0x43, 0x02, 0xc9, 0xbd, 0x9b, 0x21, 0x14,
+    0x90, 0x20, 0x14, 0xa8, 0xcc, 0x9b, 0x42, 0x13, 0x88, 0x88, 0xba, 0x40, 0x35, 0x23, 0xe8, 0xcd,
+    0x99, 0x08, 0x51, 0x43, 0x90, 0xbb, 0xaa, 0x8a, 0x43, 0xbf, 0x46, 0x00, 0x28, 0x22, 0x22, 0x13,
+    0xfb, 0x48, 0x17, 0xc9, 0x9d, 0x20, 0x32, 0x11, 0x98, 0x80, 0xa8, 0xab, 0xba, 0xbd, 0x29, 0x44,
+    0x42, 0x24, 0xa9, 0x9b, 0x98, 0xeb, 0xcb, 0x8a, 0x73, 0x25, 0x01, 0xba, 0xbd, 0xc7, 0x11, 0x01,
+    0x99, 0x0a, 0x11, 0x12, 0x88, 0xbb, 0x39, 0x05, 0xeb, 0x09, 0x34, 0x13, 0x90, 0xbb, 0x8a, 0xd9,
+    0xbc, 0x38, 0x46, 0x12, 0xb8, 0xbb, 0x8a, 0x88, 0x20, 0x12, 0x12, 0x81, 0x08, 0x43, 0x22, 0x57,
+    0xb1, 0xcf, 0x19, 0x13, 0x80, 0xa9, 0xac, 0x40, 0x83, 0xab, 0x62, 0x11, 0x21, 0x83, 0x99, 0x33,
+    0xfa, 0x8f, 0x80, 0x80, 0x81, 0xb9, 0x29, 0x24, 0x89, 0x08, 0xfb, 0x0a, 0x12, 0x90, 0x73, 0x24,
+    0x91, 0xdb, 0xac, 0x09, 0x33, 0x13, 0x80, 0x20, 0xa2, 0xcf, 0x28, 0x46, 0x91, 0xca, 0x8a, 0x31,
+    0x12, 0xdb, 0x9c, 0x52, 0x14, 0xb9, 0xab, 0x08, 0x20, 0x33, 0x82, 0x98, 0x93, 0xfb, 0x42, 0x00,
+    0x90, 0xeb, 0x9b, 0x52, 0x34, 0xa1, 0xdc, 0x19, 0x53, 0x91, 0xcb, 0x09, 0x42, 0x13, 0xc8, 0xab,
+    0x41, 0x13, 0xba, 0xac, 0x08, 0x02, 0xdc, 0x1a, 0x46, 0x02, 0x98, 0xaa, 0x8a, 0x80, 0x89, 0x51,
+    0x37, 0x03, 0xfb, 0xab, 0x30, 0x23, 0xb0, 0xbd, 0x28, 0x43, 0x90, 0xbc, 0x29, 0x46, 0x12, 0xa8,
+    0xab, 0x19, 0x91, 0x8a, 0x56, 0x04, 0xb8, 0xcb, 0xaa, 0x30, 0x34, 0xb1, 0xab, 0x21, 0xb8, 0xbd,
+    0x8b, 0x73, 0x17, 0xa9, 0x8a, 0x21, 0x11, 0x13, 0xc8, 0x9b, 0x00, 0xda, 0x9c, 0x40, 0x14, 0xc8,
+    0x8a, 0x53, 0x24, 0xb0, 0xbc, 0x19, 0x23, 0x82, 0xaa, 0x39, 0x25, 0x01, 0xc9, 0xcf, 0x29, 0x04,
+    0xd9, 0x89, 0x12, 0x12, 0x98, 0x18, 0x37, 0x02, 0xcc, 0xac, 0x19, 0x63, 0x02, 0xb8, 0x89, 0x88,
+    0x9a, 0x20, 0x33, 0x24, 0xd8, 0xad, 0x20, 0x01, 0x01, 0xf9, 0x9b, 0x44, 0x02, 0x99, 0x99, 0x18,
+    0x65, 0xfe, 0x47, 0x00, 0x42, 0x81, 0x80, 0xeb, 0xbc, 0x19, 0x54, 0x23, 0x90, 0xdb, 0xbc, 0x40,
+    0x13, 0xca, 0x89, 0x21, 0x34, 0x92, 0xac, 0x20, 0xc0, 0x8b, 0x22, 0x80, 0x63, 0x92, 0xcc, 0x8a,
+    0x51, 0x15, 0xb8, 0xaa, 0x88, 0x9a, 0x28, 0x44, 0x23, 0x90, 0x89, 0xfb, 0x9c, 0x41, 0x14, 0x80,
+    0x00, 0x00, 0xea, 0xbc, 0x18, 0x23, 0xa0, 0x0a, 0x43, 0x92, 0x9b, 0x11, 0xea, 0x39, 0x37, 0x98,
+    0x9a, 0x11, 0x32, 0xa1, 0xde, 0x9a, 0x00, 0x08, 0x21, 0xb8, 0x1b, 0x57, 0x11, 0x10, 0xa0, 0xce,
+    0xaa, 0x40, 0x44, 0x92, 0xbb, 0x09, 0xa1, 0xbc, 0x40, 0x36, 0x90, 0xac, 0x09, 0x81, 0x11, 0x44,
+    0x80, 0xaa, 0x18, 0x01, 0xa9, 0xcb, 0x39, 0x67, 0x01, 0xbb, 0xcb, 0xab, 0x52, 0x33, 0x11, 0x00,
+    0xdb, 0x9a, 0x88, 0x20, 0x04, 0xdc, 0x48, 0x24, 0xa8, 0x08, 0x00, 0x89, 0x00, 0xd9, 0x9b, 0x61,
+    0x35, 0xa1, 0xbf, 0x89, 0xe1, 0xbd, 0x4d, 0x00, 0x21, 0x23, 0x81, 0xcc, 0x8a, 0x21, 0x33, 0x92,
+    0xcb, 0x20, 0xa2, 0xbe, 0x40, 0x13, 0xea, 0x9b, 0x41, 0x83, 0xbc, 0x1a, 0x34, 0xa1, 0xaa, 0x30,
+    0x12, 0x52, 0x15, 0xdd, 0x8c, 0x31, 0x25, 0x81, 0xca, 0x8a, 0x21, 0x01, 0xb9, 0xab, 0x89, 0x10,
+    0x01, 0x90, 0x20, 0x45, 0x34, 0x91, 0xbd, 0xdb, 0xad, 0x60, 0x24, 0x98, 0x00, 0xc9, 0x9d, 0x20,
+    0x24, 0x22, 0x91, 0xcc, 0xaa, 0x88, 0x11, 0x11, 0x20, 0x01, 0xbb, 0x78, 0x35, 0x91, 0xcc, 0x8a,
+    0x11, 0x90, 0xbd, 0x0a, 0x33, 0xb0, 0x0d, 0x56, 0x02, 0xbb, 0x9a, 0x80, 0x89, 0x20, 0x45, 0x33,
+    0x11, 0xa0, 0xde, 0xab, 0x20, 0x24, 0x01, 0x08, 0x42, 0x23, 0xd9, 0xbe, 0x9a, 0x20, 0x36, 0x82,
+    0xca, 0x08, 0x10, 0x42, 0xa1, 0xcf, 0x18, 0x12, 0x80, 0x10, 0xb9, 0x0a, 0x34, 0xa8, 0xbd, 0x99,
+    0x21, 0x25, 0xb8, 0x9c, 0x72, 0x14, 0xa0, 0xaa, 0xbe, 0xf5, 0x49, 0x00, 0xcc, 0x8a, 0x62, 0x33,
+    0x02, 0xb9, 0xbc, 0x9b, 0x40, 0x34, 0x11, 0x98, 0xce, 0x8a, 0x21, 0x21, 0x01, 0xba, 0x4a, 0x26,
+    0xe9, 0xab, 0x20, 0x34, 0x03, 0x89, 0x22, 0xfb, 0x8b, 0x22, 0xa0, 0x89, 0xa8, 0x1a, 0x04, 0xab,
+    0x72, 0x26, 0x98, 0xca, 0x8a, 0x52, 0x22, 0x12, 0xa8, 0xbd, 0xaa, 0xa9, 0x89, 0x31, 0x34, 0x03,
+    0xcc, 0xab, 0x89, 0x72, 0x45, 0x82, 0xdb, 0x8b, 0x20, 0x12, 0x42, 0x04, 0xea, 0x8a, 0x90, 0x89,
+    0x31, 0x12, 0x99, 0x98, 0xaa, 0xdb, 0xac, 0x72, 0x24, 0x81, 0xa8, 0x09, 0x21, 0xea, 0x1b, 0x33,
+    0xb8, 0x09, 0xd0, 0xae, 0x09, 0x62, 0x43, 0x91, 0xac, 0x09, 0x11, 0x90, 0xbb, 0x29, 0x32, 0x81,
+    0x32, 0x25, 0xb8, 0xbe, 0x8a, 0x42, 0x11, 0x80, 0xdc, 0x1a, 0x47, 0x02, 0xcb, 0x8a, 0x21, 0x92,
+    0xbd, 0x19, 0x33, 0x31, 0x25, 0xd9, 0xad, 0x09, 0x32, 0x23, 0x80, 0x10, 0x55, 0x0d, 0x40, 0x00,
+    0x01, 0x98, 0xca, 0x09, 0x54, 0x12, 0x98, 0xdc, 0xac, 0x18, 0x53, 0x24, 0x02, 0xda, 0xbc, 0x8a,
+    0x41, 0x33, 0x02, 0x88, 0x81, 0xa9, 0xdb, 0xbf, 0x2a, 0x36, 0x02, 0xa8, 0xbd, 0x1a, 0x35, 0x03,
+    0x88, 0xaa, 0x19, 0x35, 0xb0, 0x9c, 0x80, 0xbb, 0x1a, 0x81, 0xaa, 0x08, 0x74, 0x26, 0x90, 0x99,
+    0xfc, 0xab, 0x63, 0x22, 0x00, 0x98, 0xbb, 0x20, 0x91, 0x9b, 0x62, 0x23, 0x90, 0x09, 0xc0, 0xef,
+    0x29, 0x32, 0xa8, 0x8a, 0x10, 0x12, 0x98, 0x0b, 0x32, 0x90, 0x38, 0x25, 0x91, 0xde, 0x9c, 0x18,
+    0x24, 0x02, 0xca, 0xbc, 0xcb, 0x09, 0x34, 0x23, 0x63, 0x13, 0xca, 0xbb, 0xcc, 0x8b, 0x30, 0x56,
+    0x23, 0xc8, 0xad, 0x08, 0x00, 0x10, 0x22, 0x22, 0xd8, 0xbb, 0x31, 0x82, 0x28, 0x05, 0xdd, 0x8b,
+    0xa8, 0x19, 0x35, 0x82, 0x10, 0xa1, 0xcf, 0x09, 0x42, 0x12, 0x88, 0x08, 0x82, 0xba, 0xaa, 0xfb,
+    0x94, 0xa6, 0x48, 0x00, 0x9b, 0x21, 0x23, 0x24, 0x02, 0xea, 0x8b, 0x73, 0x02, 0xba, 0x08, 0xb8,
+    0x1b, 0x57, 0x13, 0x98, 0xba, 0xba, 0xcc, 0x0a, 0x32, 0x11, 0x54, 0x81, 0xab, 0x32, 0x83, 0x38,
+    0x05, 0xee, 0x8a, 0x31, 0x43, 0x02, 0xd9, 0xab, 0x20, 0x23, 0x01, 0xda, 0xac, 0x89, 0x88, 0x42,
+    0x82, 0x19, 0x47, 0x81, 0xca, 0x8a, 0x10, 0x33, 0x43, 0x22, 0xa1, 0xef, 0x9b, 0x21, 0x33, 0x32,
+    0xb2, 0xdf, 0x09, 0x21, 0x01, 0x00, 0x80, 0x89, 0x00, 0x80, 0xdb, 0x8a, 0x44, 0x01, 0x99, 0x88,
+    0xcb, 0x1a, 0x33, 0x80, 0x71, 0x05, 0xa9, 0x28, 0xc0, 0xaf, 0x20, 0x02, 0x21, 0xd0, 0x9e, 0x30,
+    0x15, 0x00, 0xa0, 0xcb, 0x09, 0x80, 0x20, 0x11, 0x52, 0x24, 0xfa, 0xab, 0x41, 0x23, 0xa0, 0xbb,
+    0xac, 0x8a, 0x42, 0x25, 0xa0, 0x9b, 0x50, 0x23, 0xc9, 0x9c, 0x38, 0x35, 0x91, 0x9b, 0x31, 0x91,
+    0x9a, 0xfa, 0xbf, 0x19, 0x26, 0xc1, 0x4a, 0x00, 0x22, 0x12, 0x11, 0x80, 0x00, 0xb0, 0xbc, 0x28,
+    0x81, 0xbd, 0x78, 0x35, 0x82, 0xda, 0xab, 0x88, 0x98, 0xac, 0x08, 0x21, 0x64, 0x91, 0xbc, 0x61,
+    0x13, 0xa0, 0xca, 0xbb, 0x19, 0x34, 0x45, 0x23, 0xa0, 0xcc, 0xab, 0x9a, 0x18, 0x45, 0x14, 0x80,
+    0xba, 0xab, 0x89, 0x20, 0x12, 0xca, 0x48, 0x36, 0x02, 0xb8, 0xbd, 0x8a, 0x01, 0x80, 0x80, 0x30,
+    0x57, 0xa0, 0x9c, 0x00, 0x99, 0x20, 0xc1, 0x9c, 0x44, 0x82, 0x30, 0x25, 0xb9, 0xbc, 0x9a, 0x40,
+    0x25, 0xb0, 0x1a, 0x13, 0xfb, 0x9c, 0x00, 0x88, 0x10, 0x80, 0x28, 0x46, 0x23, 0xa0, 0xce, 0xab,
+    0x10, 0x12, 0x21, 0x32, 0x03, 0xeb, 0xbb, 0x8a, 0x50, 0x45, 0x82, 0xca, 0xbb, 0x89, 0x42, 0x43,
+    0x13, 0xd9, 0x9b, 0x32, 0x82, 0xa9, 0xaa, 0x74, 0x17, 0xa8, 0xab, 0xaa, 0x18, 0x32, 0x33, 0x83,
+    0xcb, 0x09, 0x91, 0xcb, 0xed, 0xab, 0x42, 0x23, 0x94, 0xe8, 0x46, 0x00, 0x21, 0xa1, 0xbc, 0x09,
+    0x20, 0x67, 0x92, 0xcc, 0x09, 0x11, 0x90, 0x08, 0x31, 0xa2, 0xbf, 0x09, 0x53, 0x24, 0xb2, 0xce,
+    0x09, 0x23, 0x02, 0x88, 0x98, 0xb9, 0x9d, 0x31, 0x02, 0x1a, 0x33, 0xfa, 0x9f, 0x10, 0x00, 0x11,
+    0x11, 0x32, 0x83, 0xea, 0xcb, 0x8a, 0x54, 0x13, 0x88, 0xba, 0xac, 0x19, 0x11, 0x44, 0x14, 0xfb,
+    0x9b, 0x10, 0x22, 0x43, 0x02, 0x99, 0x89, 0xda, 0xac, 0x28, 0x33, 0x21, 0x53, 0x92, 0xbd, 0x09,
+    0xa8, 0xac, 0x89, 0x11, 0x12, 0x21, 0x57, 0x24, 0x01, 0xca, 0xbd, 0x08, 0x12, 0x80, 0x22, 0x33,
+    0x34, 0xd1, 0xad, 0x30, 0x93, 0xbd, 0x9b, 0x18, 0x43, 0x03, 0x20, 0x36, 0x83, 0xcd, 0xac, 0x09,
+    0x08, 0x52, 0x25, 0x98, 0x9a, 0x22, 0x82, 0xdd, 0xac, 0x08, 0x11, 0x10, 0x32, 0x32, 0x42, 0x82,
+    0xca, 0xcd, 0xbb, 0x88, 0x52, 0x44, 0x01, 0x88, 0x80, 0xeb, 0x9a, 0x08, 0x6c, 0xee, 0x47, 0x00,
+    0x40, 0x25, 0xa0, 0xbc, 0x18, 0x13, 0xa8, 0xbc, 0x8a, 0x31, 0x23, 0xb9, 0x0c, 0x63, 0x53, 0x33,
+    0xa1, 0xbe, 0xbb, 0xac, 0x08, 0x13, 0x81, 0x11, 0x01, 0x62, 0x25, 0xc9, 0xab, 0x08, 0x80, 0x11,
+    0x88, 0x71, 0x27, 0xb0, 0xac, 0x8a, 0x88, 0x89, 0xaa, 0x0a, 0x21, 0x73, 0x14, 0xb8, 0x8b, 0x63,
+    0x33, 0x91, 0xee, 0xab, 0x40, 0x34, 0x03, 0xb8, 0xbc, 0x9b, 0x88, 0x20, 0x01, 0x98, 0x51, 0x24,
+    0x12, 0xa0, 0xcf, 0x8a, 0x52, 0x23, 0xb1, 0xbc, 0x08, 0x00, 0x20, 0x33, 0x11, 0x92, 0xef, 0x8a,
+    0x22, 0x24, 0x92, 0xec, 0x9a, 0x10, 0x11, 0x01, 0x08, 0x22, 0x22, 0x22, 0x92, 0xed, 0xbb, 0x18,
+    0x22, 0x10, 0x00, 0xeb, 0x29, 0x25, 0x10, 0x22, 0xfc, 0x9e, 0x32, 0x13, 0x01, 0xb0, 0xae, 0x28,
+    0x24, 0x12, 0x81, 0xeb, 0x8b, 0x31, 0x82, 0xab, 0x41, 0x92, 0xcd, 0x89, 0x21, 0x42, 0x22, 0x10,
+    0xd8, 0x2e, 0x3f, 0x00, 0x11, 0xca, 0x8a, 0x01, 0xcc, 0x9b, 0x11, 0x90, 0xaa, 0xeb, 0x9c, 0x51,
+    0x37, 0x82, 0xdc, 0xab, 0x09, 0x41, 0x34, 0x12, 0x98, 0xca, 0xcb, 0x9a, 0x41, 0x34, 0x90, 0x1a,
+    0x35, 0xb1, 0x9d, 0x31, 0x80, 0xaa, 0xbd, 0x4a, 0x37, 0xa0, 0xad, 0x88, 0x08, 0x62, 0x24, 0xc8,
+    0xbc, 0x09, 0x21, 0x12, 0x88, 0x99, 0x00, 0x00, 0x41, 0x24, 0xc8, 0xae, 0x09, 0x22, 0x80, 0x28,
+    0x15, 0xfb, 0x8a, 0x21, 0x11, 0x31, 0x12, 0xc9, 0xbe, 0x28, 0x36, 0x81, 0xaa, 0xba, 0xbe, 0x9a,
+    0x31, 0x45, 0x02, 0xa9, 0x88, 0x80, 0xaa, 0xbb, 0x9b, 0x54, 0x33, 0x12, 0xa8, 0xac, 0x20, 0x35,
+    0xb1, 0xbc, 0x89, 0xfb, 0xae, 0x20, 0x34, 0x02, 0x00, 0x88, 0xdd, 0x8b, 0x34, 0x82, 0x18, 0x24,
+    0xa8, 0x89, 0xc9, 0xae, 0x18, 0x80, 0x8a, 0x73, 0x23, 0x80, 0xa9, 0xcc, 0x19, 0x45, 0x91, 0xab,
+    0x99, 0x89, 0x52, 0x33, 0x2d, 0xff, 0x44, 0x00, 0x33, 0xb1, 0xbf, 0x8a, 0x08, 0x31, 0x15, 0xa9,
+    0x28, 0x22, 0x98, 0xec, 0x9b, 0x30, 0x23, 0x31, 0x91, 0xbd, 0x51, 0x83, 0xce, 0x0a, 0x31, 0x32,
+    0x23, 0xf9, 0xbc, 0x29, 0x33, 0xc9, 0x9b, 0x31, 0x82, 0x11, 0xa1, 0xbf, 0x49, 0x35, 0x82, 0xcb,
+    0x1a, 0x33, 0x81, 0x08, 0x22, 0x03, 0xfb, 0xae, 0x89, 0x31, 0x36, 0x81, 0x98, 0x98, 0x09, 0x55,
+    0xa1, 0xbe, 0x9a, 0x00, 0x53, 0x34, 0x81, 0xdb, 0xbb, 0x19, 0x43, 0x32, 0x13, 0xda, 0xad, 0x19,
+    0x53, 0x23, 0xd9, 0xbc, 0x0a, 0x31, 0x32, 0x81, 0x0a, 0x64, 0x82, 0xba, 0x9a, 0xa9, 0x60, 0x04,
+    0xaa, 0x41, 0xb2, 0x9f, 0x10, 0x88, 0x21, 0xa2, 0xbf, 0x19, 0x01, 0x40, 0x24, 0x21, 0x81, 0xde,
+    0x8b, 0x20, 0x33, 0x82, 0xaa, 0x09, 0x99, 0x8a, 0x31, 0x45, 0xb1, 0xef, 0x09, 0x21, 0x22, 0x23,
+    0xa8, 0x0a, 0x81, 0xdf, 0x8a, 0x53, 0x12, 0x21, 0x3c, 0x5a, 0x48, 0x00, 0x92, 0xdb, 0x89, 0x80,
+    0x88, 0x09, 0x43, 0x15, 0xc8, 0xbd, 0x8a, 0x10, 0x12, 0x22, 0x34, 0x82, 0xbb, 0x0a, 0xd0, 0xaf,
+    0x39, 0x35, 0x82, 0xcb, 0x0a, 0x43, 0x80, 0x99, 0xed, 0x9c, 0x12, 0xa1, 0x18, 0x12, 0x28, 0x47,
+    0xa0, 0xac, 0x9a, 0x18, 0x44, 0x33, 0x00, 0xba, 0xbc, 0xba, 0x8a, 0x73, 0x24, 0x91, 0xbd, 0xab,
+    0x00, 0x11, 0x52, 0x34, 0xa1, 0x9a, 0x41, 0xa1, 0xce, 0x9a, 0x30, 0x34, 0xa0, 0x19, 0x22, 0xda,
+    0xab, 0xa9, 0x09, 0x81, 0xca, 0x0b, 0x74, 0x35, 0x92, 0xba, 0xb9, 0xdc, 0x8b, 0x52, 0x32, 0x43,
+    0x03, 0xeb, 0x9b, 0x88, 0x30, 0x34, 0x91, 0xbb, 0xce, 0x0a, 0x43, 0x81, 0x21, 0xa1, 0x9d, 0x21,
+    0xa0, 0x8a, 0xec, 0x1b, 0x45, 0x81, 0x88, 0x22, 0x98, 0xbb, 0xbb, 0xaa, 0x18, 0x02, 0xbb, 0x40,
+    0x55, 0x45, 0x14, 0xb9, 0xbd, 0x9b, 0x20, 0x22, 0x73, 0x14, 0xa0, 0x9b, 0xbe, 0x07, 0x49, 0x00,
+    0x80, 0xbb, 0x89, 0x32, 0x32, 0xb1, 0xcf, 0x8a, 0x12, 0xb0, 0x48, 0x36, 0xb8, 0xac, 0x0a, 0x51,
+    0x23, 0x00, 0x11, 0xeb, 0x8a, 0x80, 0x8a, 0x02, 0xcd, 0x58, 0x23, 0x99, 0x18, 0x00, 0x44, 0xb1,
+    0xae, 0x99, 0xcd, 0x19, 0x46, 0x12, 0x98, 0x8a, 0x11, 0xb9, 0x29, 0x22, 0xa8, 0x18, 0x23, 0xd9,
+    0xbe, 0x9b, 0x99, 0xab, 0x41, 0x24, 0x22, 0x24, 0xd8, 0xad, 0x38, 0x33, 0x12, 0xb0, 0x9d, 0x62,
+    0x92, 0xbc, 0x52, 0xa3, 0xbf, 0x09, 0x81, 0x10, 0x34, 0x02, 0x10, 0xa8, 0xcd, 0x9a, 0x09, 0x41,
+    0x25, 0x22, 0xa8, 0x9c, 0x31, 0x92, 0xbc, 0x9a, 0x31, 0x36, 0xb0, 0xbf, 0x8a, 0x32, 0x03, 0xeb,
+    0x0a, 0x80, 0x98, 0x72, 0x27, 0x98, 0xaa, 0x11, 0x90, 0x08, 0x12, 0xea, 0x9b, 0x21, 0x22, 0xa0,
+    0xce, 0x19, 0x22, 0x81, 0x72, 0x23, 0xe9, 0xcb, 0x89, 0x21, 0x43, 0x12, 0x88, 0x9b, 0x50, 0x14,
+    0xba, 0x31, 0x47, 0x00, 0xc9, 0xbb, 0x08, 0x21, 0x80, 0xa9, 0x39, 0x47, 0x91, 0xcc, 0x8a, 0x11,
+    0x21, 0x01, 0x99, 0x62, 0x14, 0x09, 0x10, 0xd9, 0x8b, 0x00, 0x99, 0x31, 0x53, 0x35, 0xc1, 0xbe,
+    0xaa, 0x0a, 0x44, 0x14, 0x80, 0xd9, 0xbc, 0x30, 0x34, 0x00, 0x31, 0x03, 0xda, 0xab, 0x28, 0x14,
+    0x90, 0xbb, 0x18, 0x35, 0xa2, 0xdd, 0x0a, 0x12, 0x98, 0xa9, 0xaa, 0x72, 0x17, 0x90, 0x21, 0x82,
+    0x89, 0x12, 0xdc, 0x8a, 0x00, 0x18, 0x12, 0xb9, 0x72, 0x85, 0xfb, 0x9b, 0x29, 0x34, 0x04, 0x90,
+    0xba, 0x8a, 0x10, 0x10, 0x54, 0x82, 0xba, 0xba, 0xbd, 0x48, 0x35, 0x22, 0x91, 0xde, 0x8a, 0x00,
+    0x00, 0x11, 0x81, 0xa9, 0xab, 0x8a, 0x40, 0x34, 0xa2, 0xbd, 0x61, 0x15, 0xa0, 0xbb, 0x9a, 0x21,
+    0x23, 0x90, 0x98, 0xca, 0x29, 0x77, 0xa1, 0xcd, 0x0a, 0x32, 0x13, 0xa9, 0x18, 0x02, 0xa8, 0x08,
+    0xdb, 0x2a, 0x26, 0xa0, 0xef, 0x0b, 0x42, 0x00, 0x18, 0x03, 0xaa, 0x09, 0x90, 0xca, 0xdf, 0x9b,
+    0x42, 0xa2, 0xae, 0x19, 0x01, 0x10, 0x12, 0xa9, 0x71, 0x35, 0x00, 0x80, 0xcb, 0x9c, 0x09, 0x42,
+    0x23, 0xd8, 0xbc, 0xbb, 0x9a, 0x31, 0x36, 0x91, 0xce, 0x89, 0x45, 0x12, 0x88, 0x98, 0xda, 0x9a,
+    0x20, 0x32, 0x35, 0x91, 0xaa, 0x98, 0x99, 0x10, 0xa8, 0x8a, 0xf9, 0x9e, 0x52, 0x82, 0xca, 0x9a,
+    0x40, 0x24, 0xa0, 0x30, 0x05, 0xfb, 0x8a, 0x41, 0x12, 0x00, 0xb9, 0xcb, 0x19, 0x22, 0x90, 0x88,
+    0xd9, 0x9b, 0x51, 0x13, 0x98, 0xac, 0x71, 0x27, 0x98, 0x99, 0xba, 0x8b, 0x72, 0x12, 0x00, 0x10,
+    0x90, 0xdc, 0x9b, 0x30, 0x22, 0x20, 0x13, 0xd9, 0xac, 0x09, 0x11, 0xb0, 0x9e, 0x72, 0x13, 0x89,
+    0x20, 0xb1, 0xad, 0x18, 0x00, 0x52, 0x24, 0xa9, 0xbb, 0xac, 0x18, 0x81, 0xdb, 0x18, 0x02, 0x10,
+    0x35, 0x82, 0xbc, 0x38, 0x36, 0x01, 0x98, 0xca, 0xd1, 0x01, 0x40, 0x00, 0x9c, 0x41, 0x24, 0x11,
+    0x22, 0xb8, 0xcd, 0xeb, 0x9a, 0x20, 0x91, 0x8b, 0x44, 0x91, 0x9b, 0x41, 0x92, 0xbb, 0x72, 0x15,
+    0xa9, 0x29, 0x24, 0xd9, 0x0a, 0x33, 0x01, 0x20, 0xb1, 0xce, 0x09, 0x10, 0xa0, 0xbb, 0xab, 0xdb,
+    0x1a, 0x45, 0x43, 0x12, 0xca, 0x0a, 0x91, 0x8c, 0x66, 0x02, 0xbb, 0x99, 0x08, 0x31, 0x13, 0xda,
+    0xbc, 0x9a, 0x00, 0x00, 0x34, 0x91, 0x40, 0x36, 0x90, 0xba, 0xad, 0x20, 0x92, 0x0a, 0x47, 0x92,
+    0x88, 0x00, 0x09, 0x13, 0xb9, 0x40, 0xd1, 0xbe, 0x89, 0x10, 0x35, 0xb1, 0x9c, 0x32, 0xf9, 0x8c,
+    0x21, 0x91, 0x29, 0x45, 0x12, 0x88, 0xb9, 0xad, 0x89, 0x98, 0x61, 0x34, 0x81, 0xea, 0xac, 0x20,
+    0x14, 0xaa, 0x09, 0x98, 0x19, 0x24, 0xa8, 0xac, 0x09, 0x65, 0x13, 0xc9, 0xab, 0x09, 0x11, 0x11,
+    0x11, 0xd8, 0xab, 0x30, 0x02, 0x51, 0x24, 0xca, 0x09, 0x93, 0xdf, 0xac, 0x51, 0xa9, 0x48, 0x00,
+    0x09, 0x20, 0x53, 0x33, 0x81, 0x99, 0x18, 0x91, 0xdd, 0x28, 0x25, 0xc0, 0xbb, 0x29, 0x63, 0x33,
+    0x81, 0xcd, 0xab, 0x30, 0x23, 0x80, 0xca, 0xac, 0x09, 0x41, 0x25, 0xb0, 0x9d, 0x20, 0x02, 0x00,
+    0xa8, 0xbd, 0x99, 0x89, 0x41, 0x32, 0x54, 0x12, 0xa9, 0xaa, 0xba, 0x50, 0x15, 0xec, 0x09, 0x02,
+    0xa9, 0x40, 0x02, 0xbb, 0x51, 0x34, 0x82, 0xdb, 0x9c, 0x30, 0x34, 0x91, 0xab, 0x28, 0x33, 0x45,
+    0x93, 0xbf, 0x9a, 0x99, 0x38, 0x26, 0x01, 0x00, 0xfa, 0xac, 0x00, 0x11, 0x44, 0x12, 0x98, 0x99,
+    0x9a, 0x31, 0x92, 0xce, 0x89, 0x43, 0x23, 0x10, 0x13, 0xfb, 0x9c, 0x08, 0x01, 0x08, 0x10, 0x33,
+    0xfb, 0x8f, 0x32, 0x81, 0x9a, 0x32, 0x91, 0xac, 0x8a, 0x20, 0x43, 0x01, 0x18, 0x33, 0xf9, 0xae,
+    0x18, 0x21, 0x12, 0xc9, 0x0a, 0x02, 0xeb, 0x89, 0xea, 0x9b, 0x73, 0x12, 0x88, 0x20, 0x32, 0x01,
+    0x34, 0x3b, 0x40, 0x00, 0xdb, 0x9b, 0x31, 0x12, 0xea, 0xac, 0x18, 0x45, 0x14, 0xa8, 0xdb, 0x9b,
+    0x88, 0x00, 0x41, 0x12, 0xca, 0x9b, 0x10, 0x30, 0x33, 0xa0, 0x8a, 0x81, 0x2a, 0x77, 0x06, 0xaa,
+    0xab, 0x8a, 0x50, 0x35, 0x02, 0xc9, 0xcc, 0x0a, 0x42, 0x02, 0xaa, 0x9a, 0xca, 0x9c, 0x31, 0x02,
+    0x31, 0x25, 0x22, 0x44, 0x90, 0xbd, 0xaa, 0x0a, 0x51, 0x44, 0x03, 0xda, 0xac, 0x00, 0x08, 0x22,
+    0x80, 0x8a, 0xb9, 0xbf, 0x28, 0x01, 0x9b, 0x75, 0x33, 0x90, 0x99, 0xba, 0xbc, 0x09, 0x54, 0x34,
+    0x01, 0xa9, 0xbc, 0xbb, 0x18, 0x53, 0x24, 0x92, 0xbb, 0x09, 0x81, 0xeb, 0xbc, 0x9b, 0x28, 0x34,
+    0x52, 0x44, 0x01, 0xcb, 0x9b, 0x18, 0x10, 0x42, 0x33, 0x91, 0xde, 0x9b, 0x32, 0x02, 0x98, 0xa9,
+    0xac, 0x50, 0x15, 0xa0, 0xac, 0x8a, 0x20, 0x32, 0x32, 0x46, 0x82, 0xcd, 0x0b, 0x12, 0x12, 0x33,
+    0xb2, 0xbe, 0xab, 0x08, 0x09, 0xe5, 0x40, 0x00, 0x10, 0x80, 0xca, 0x0a, 0x35, 0xe8, 0xac, 0x31,
+    0x13, 0x20, 0x03, 0xea, 0xbc, 0xbd, 0x0a, 0x55, 0x24, 0xa1, 0xaa, 0x10, 0xb0, 0x9d, 0x41, 0x12,
+    0x99, 0x88, 0xaa, 0x50, 0x15, 0xb9, 0xab, 0x00, 0x72, 0x13, 0xda, 0x8a, 0x10, 0x98, 0x88, 0x31,
+    0x14, 0x00, 0x52, 0xa1, 0x9d, 0x72, 0x82, 0xba, 0xba, 0x8c, 0x54, 0x82, 0xba, 0x09, 0x10, 0x11,
+    0x01, 0x08, 0x52, 0x93, 0xdf, 0x9b, 0x22, 0x13, 0x99, 0x89, 0x31, 0x92, 0x9b, 0x57, 0xa2, 0xbc,
+    0x29, 0x23, 0xb8, 0x9b, 0x72, 0x34, 0x03, 0xc9, 0xac, 0x99, 0xbb, 0x60, 0x34, 0xa8, 0xbb, 0xaa,
+    0xbb, 0x50, 0x37, 0x90, 0x9b, 0x21, 0x01, 0x63, 0xa2, 0xbc, 0x08, 0xa8, 0x60, 0x25, 0xa8, 0x8b,
+    0x12, 0xb0, 0x9b, 0x31, 0x11, 0x32, 0xf0, 0xac, 0x28, 0x12, 0x90, 0xea, 0x2a, 0x26, 0xa8, 0x09,
+    0x80, 0x40, 0x14, 0xcb, 0x73, 0x13, 0xba, 0xac, 0xea, 0x0c, 0x42, 0x00, 0x1a, 0x43, 0xc9, 0x0b,
+    0x34, 0xb8, 0xcc, 0xbb, 0x0a, 0x22, 0x80, 0x20, 0x14, 0xc9, 0x0c, 0x47, 0x02, 0x99, 0x21, 0x83,
+    0xea, 0x9b, 0x89, 0xa9, 0x48, 0x35, 0x13, 0x12, 0xfb, 0x9c, 0x89, 0x08, 0x34, 0x82, 0xcc, 0x9b,
+    0x28, 0x02, 0xba, 0x72, 0x15, 0x00, 0x98, 0x9a, 0x51, 0x92, 0xbd, 0x19, 0x11, 0x32, 0x93, 0xcc,
+    0xab, 0x09, 0x74, 0x02, 0xca, 0x9a, 0x99, 0x18, 0x81, 0x89, 0x64, 0x13, 0x00, 0x01, 0xba, 0x68,
+    0x14, 0xa8, 0x28, 0x14, 0xb9, 0xad, 0xcb, 0x8b, 0x73, 0x12, 0xa8, 0x9a, 0x89, 0x00, 0x98, 0x19,
+    0x45, 0x23, 0x01, 0xfa, 0x0a, 0x23, 0xeb, 0x1a, 0x34, 0x22, 0x42, 0xb0, 0xad, 0x28, 0x11, 0x42,
+    0x82, 0xbc, 0xca, 0xcc, 0x2a, 0x36, 0x81, 0x89, 0xba, 0xbd, 0x50, 0x34, 0x01, 0xb9, 0xcc, 0x8a,
+    0x21, 0x23, 0x45, 0x82, 0xcc, 0x89, 0x11, 0x21, 0xa0, 0xbf, 0x8a, 0x31, 0x9d, 0xf7, 0x42, 0x00,
+    0x24, 0x90, 0x19, 0x91, 0x9c, 0x63, 0xb1, 0x9d, 0x21, 0x80, 0x19, 0x11, 0x99, 0xca, 0xbc, 0x48,
+    0x36, 0x83, 0xeb, 0xab, 0x09, 0x41, 0x35, 0x80, 0xaa, 0xbb, 0x18, 0x34, 0x90, 0x20, 0xe8, 0xae,
+    0x28, 0x12, 0x08, 0x22, 0xf9, 0xbc, 0x18, 0x13, 0x01, 0x98, 0x89, 0x21, 0xc0, 0xad, 0x40, 0x34,
+    0x24, 0x90, 0xab, 0xba, 0xbc, 0x58, 0x23, 0x88, 0x52, 0x82, 0xcb, 0xec, 0xbb, 0x28, 0x24, 0x31,
+    0x33, 0xe8, 0x9b, 0x18, 0x00, 0x44, 0x03, 0xab, 0x89, 0xaa, 0x71, 0x16, 0xb9, 0xaa, 0xba, 0xad,
+    0x18, 0x43, 0x45, 0x13, 0xd9, 0xab, 0x10, 0xc9, 0x9b, 0x63, 0x12, 0x21, 0x02, 0xda, 0x8b, 0x21,
+    0x11, 0x01, 0x99, 0x74, 0x26, 0x90, 0xac, 0xab, 0x8a, 0x32, 0x13, 0x00, 0x02, 0xd9, 0xac, 0x19,
+    0x13, 0xb8, 0x71, 0x24, 0x90, 0x80, 0xfb, 0x9d, 0x10, 0x81, 0x11, 0x33, 0x90, 0xbc, 0x28, 0xa1,
+    0x68, 0xf1, 0x3a, 0x00, 0x9e, 0x73, 0x02, 0x11, 0xa1, 0xab, 0x11, 0xfd, 0x1a, 0x14, 0x80, 0x42,
+    0x82, 0xdb, 0xba, 0x9c, 0x62, 0x13, 0x00, 0x80, 0xa8, 0x89, 0x10, 0x81, 0x98, 0x31, 0xb2, 0xff,
+    0x9b, 0x19, 0x43, 0x02, 0x08, 0x22, 0xcb, 0x29, 0x14, 0x90, 0xb9, 0x9e, 0x72, 0x13, 0xcb, 0x8a,
+    0x88, 0xba, 0x9b, 0x52, 0x14, 0x90, 0xbb, 0x89, 0xda, 0x0c, 0x56, 0x13, 0x00, 0x98, 0xbb, 0xbb,
+    0xbd, 0x39, 0x26, 0x90, 0x89, 0xb8, 0xad, 0x40, 0x24, 0x91, 0x8a, 0x42, 0x91, 0xca, 0xbb, 0x9b,
+    0x32, 0x91, 0x62, 0x13, 0xca, 0x28, 0x81, 0x99, 0x21, 0x43, 0x83, 0xbe, 0x71, 0x25, 0x98, 0xab,
+    0xbb, 0x29, 0x44, 0x01, 0xa0, 0xcd, 0x8a, 0xa0, 0x1b, 0x77, 0x23, 0x90, 0xb9, 0x9c, 0x00, 0x98,
+    0x28, 0x26, 0x88, 0x18, 0x80, 0xca, 0xba, 0x9b, 0x00, 0xa0, 0xbc, 0x68, 0x26, 0xb0, 0x8c, 0x43,
+    0x90, 0x1a, 0x23, 0xb8, 0x45, 0xf7, 0x3a, 0x00, 0xbc, 0x9a, 0x51, 0x24, 0x12, 0x12, 0xa9, 0xab,
+    0xbb, 0x71, 0x15, 0xca, 0x0a, 0x20, 0x12, 0xf8, 0xad, 0x38, 0x02, 0x88, 0x30, 0x36, 0x03, 0x99,
+    0x99, 0xed, 0x9b, 0x63, 0x13, 0x01, 0xca, 0xad, 0x8a, 0x88, 0x31, 0x14, 0x00, 0x10, 0x23, 0x12,
+    0xc8, 0xbe, 0x9b, 0x28, 0x44, 0x91, 0xcc, 0xba, 0x9c, 0x73, 0x25, 0x88, 0x99, 0x99, 0x00, 0x81,
+    0x30, 0x47, 0x91, 0x8a, 0x81, 0xbd, 0x8a, 0x80, 0x9a, 0x11, 0x00, 0x40, 0x34, 0xb8, 0xbf, 0x19,
+    0x53, 0x12, 0x10, 0x00, 0x10, 0xa8, 0xae, 0x38, 0x92, 0xcd, 0x09, 0x12, 0x43, 0x91, 0xac, 0x31,
+    0xa2, 0x2c, 0x57, 0xc9, 0x8c, 0x42, 0xa1, 0xab, 0x30, 0x14, 0x00, 0xa8, 0xae, 0x89, 0x80, 0x19,
+    0x75, 0x13, 0x98, 0x8a, 0xba, 0xbc, 0x18, 0x11, 0x31, 0x35, 0xc8, 0x9c, 0x10, 0x81, 0x18, 0x80,
+    0x8b, 0x66, 0x92, 0x9c, 0x18, 0x99, 0x39, 0x25, 0xa9, 0x18, 0x40, 0x00, 0xb9, 0xac, 0x18, 0x02,
+    0xea, 0x09, 0xb0, 0x8b, 0x56, 0x91, 0x18, 0x23, 0x81, 0x31, 0x13, 0xca, 0xcd, 0xac, 0x99, 0x20,
+    0x53, 0x22, 0xa0, 0xbe, 0x19, 0x13, 0xc8, 0xbc, 0x19, 0x14, 0x98, 0x40, 0x25, 0xb8, 0x9b, 0x41,
+    0x14, 0xeb, 0x8b, 0x53, 0x13, 0x80, 0xc9, 0xab, 0x09, 0x30, 0x44, 0x22, 0x01, 0xb8, 0xdf, 0x8a,
+    0x22, 0x81, 0x89, 0xb8, 0xcd, 0x28, 0x44, 0x22, 0x22, 0x01, 0xea, 0xad, 0x89, 0x00, 0x71, 0x34,
+    0x91, 0xaa, 0xda, 0xac, 0x09, 0x32, 0x02, 0x10, 0x33, 0xb0, 0xbc, 0xba, 0xbd, 0x39, 0x44, 0x12,
+    0x31, 0x34, 0xf8, 0xbd, 0x19, 0x12, 0x18, 0x62, 0x02, 0xda, 0xaa, 0x00, 0x01, 0x10, 0x12, 0x02,
+    0x98, 0x28, 0x04, 0xca, 0x89, 0x08, 0x73, 0x25, 0xb9, 0x8b, 0x02, 0xea, 0xab, 0x10, 0xa0, 0xac,
+    0x00, 0x80, 0x20, 0x52, 0x67, 0x02, 0xcc, 0x09, 0x02, 0xa9, 0x08, 0xa8, 0x4a, 0xdf, 0x3c, 0x00,
+    0x50, 0x46, 0x12, 0x90, 0xdb, 0xbb, 0x9a, 0x38, 0x36, 0x80, 0x20, 0x04, 0xa8, 0xba, 0xcd, 0x09,
+    0x44, 0x12, 0x88, 0x9a, 0x11, 0xd8, 0xac, 0x18, 0x31, 0x34, 0x22, 0x10, 0x33, 0x03, 0xfd, 0xbe,
+    0x8b, 0x41, 0x33, 0x01, 0x08, 0x90, 0xdd, 0x8a, 0x11, 0x00, 0x80, 0xaa, 0x28, 0x24, 0x02, 0xa9,
+    0xbd, 0x19, 0x45, 0x13, 0xa0, 0xeb, 0xcc, 0x0a, 0x54, 0x02, 0x98, 0xaa, 0x8b, 0x52, 0x13, 0xc9,
+    0xaa, 0x10, 0x00, 0x20, 0xd0, 0xaf, 0x41, 0x15, 0x00, 0x10, 0xc8, 0xbc, 0x9b, 0x28, 0x43, 0x32,
+    0x23, 0xa1, 0xac, 0x98, 0xdb, 0x19, 0x23, 0xca, 0x0a, 0x47, 0x14, 0xa8, 0xba, 0xba, 0x19, 0x43,
+    0x33, 0x34, 0xa1, 0xbd, 0x08, 0xb8, 0x9e, 0x31, 0x14, 0x42, 0x12, 0x99, 0xab, 0xcc, 0xab, 0x08,
+    0x11, 0x82, 0xcb, 0x39, 0x47, 0x82, 0xbd, 0x48, 0x25, 0x00, 0x89, 0xdb, 0x9c, 0x08, 0x21, 0x44,
+    0x7e, 0x12, 0x43, 0x00, 0x01, 0x99, 0xa9, 0x99, 0xe9, 0xbe, 0x19, 0x11, 0x21, 0x35, 0x22, 0x90,
+    0xde, 0x0a, 0x33, 0x12, 0x80, 0x99, 0x89, 0xba, 0x9d, 0x52, 0x34, 0x13, 0xa8, 0xbd, 0x9a, 0x88,
+    0x89, 0x10, 0x22, 0x65, 0x23, 0xb8, 0x9b, 0xba, 0x8c, 0x66, 0x24, 0xb8, 0xbe, 0x18, 0x82, 0xb9,
+    0x08, 0x01, 0x31, 0x27, 0x91, 0xbb, 0x0a, 0x33, 0xf8, 0x9b, 0x28, 0x53, 0x12, 0xaa, 0x30, 0xc2,
+    0xdf, 0x09, 0x22, 0x24, 0x82, 0xa9, 0x99, 0xca, 0x29, 0x44, 0x02, 0x00, 0x88, 0xca, 0xcc, 0x8a,
+    0x43, 0x91, 0xac, 0x20, 0x92, 0x8b, 0x53, 0xc0, 0x8a, 0x12, 0x88, 0x62, 0x14, 0xa8, 0xb9, 0xcb,
+    0x09, 0x74, 0x33, 0xa0, 0x9b, 0x08, 0xfb, 0xad, 0x00, 0x22, 0x13, 0x88, 0x11, 0xa1, 0x0b, 0x47,
+    0x90, 0x09, 0x91, 0xbe, 0x18, 0xa8, 0x8c, 0x52, 0x33, 0x90, 0xcb, 0x09, 0xb0, 0xbe, 0x8b, 0x31,
+    0x25, 0x01, 0x61, 0x23, 0xc4, 0x17, 0x3e, 0x00, 0xda, 0x0b, 0x43, 0x02, 0xba, 0xad, 0x28, 0x82,
+    0xce, 0x1a, 0x33, 0x80, 0x41, 0x05, 0xba, 0xaa, 0xea, 0x8a, 0x43, 0x02, 0x31, 0xb2, 0xbf, 0x18,
+    0x12, 0x44, 0x83, 0xaa, 0xaa, 0xbd, 0x19, 0x91, 0x9d, 0x64, 0x22, 0x10, 0xa8, 0xbd, 0x18, 0xa0,
+    0xad, 0x38, 0x43, 0x02, 0xba, 0x0a, 0x02, 0xbc, 0x75, 0x03, 0xbb, 0x20, 0xb0, 0x9f, 0x21, 0x02,
+    0x31, 0x03, 0xb9, 0xaa, 0xed, 0xab, 0x20, 0x12, 0x98, 0x1a, 0x35, 0xd0, 0xae, 0x40, 0x34, 0x01,
+    0x01, 0xca, 0xab, 0x88, 0x0a, 0x73, 0x02, 0x08, 0x12, 0xda, 0x8a, 0x11, 0xca, 0x8c, 0x52, 0x12,
+    0x98, 0x08, 0xa9, 0x29, 0x27, 0x98, 0x09, 0x13, 0xea, 0x9a, 0xda, 0x8c, 0x53, 0x82, 0x09, 0x12,
+    0xa8, 0x30, 0xc1, 0x9d, 0x33, 0xa8, 0x29, 0xe0, 0xad, 0x53, 0x03, 0x99, 0x99, 0x99, 0x00, 0xdb,
+    0x1a, 0x57, 0x23, 0xa1, 0xbd, 0x8a, 0x21, 0x21, 0xdc, 0x06, 0x3e, 0x00, 0x46, 0x82, 0xdb, 0x89,
+    0xa9, 0x0a, 0x12, 0x88, 0x73, 0x14, 0xb8, 0x9b, 0x08, 0xb9, 0x0b, 0x35, 0x91, 0x60, 0x05, 0xd9,
+    0x9a, 0x00, 0xa8, 0x9b, 0x72, 0x03, 0xc9, 0x08, 0x11, 0x88, 0xa8, 0x9c, 0x52, 0x12, 0xaa, 0x8b,
+    0x62, 0x25, 0x91, 0xdc, 0x9b, 0x10, 0x02, 0x10, 0x90, 0x0a, 0x56, 0xa1, 0x9c, 0x30, 0x81, 0xbb,
+    0x8a, 0x89, 0x89, 0x66, 0x14, 0x98, 0x18, 0x01, 0xaa, 0xba, 0xcf, 0x8a, 0x52, 0x43, 0x02, 0xa8,
+    0x09, 0x02, 0xd9, 0x8a, 0xb8, 0x9c, 0x65, 0x03, 0xba, 0x09, 0x80, 0x89, 0x11, 0x10, 0x81, 0xae,
+    0x51, 0x92, 0x8e, 0x62, 0x82, 0x89, 0x01, 0xda, 0x9a, 0x80, 0x01, 0x21, 0x42, 0x12, 0xe9, 0x9c,
+    0x99, 0xaa, 0x18, 0x43, 0x33, 0x35, 0x14, 0xd9, 0xac, 0x08, 0x90, 0x8a, 0x74, 0x12, 0x99, 0xa9,
+    0xba, 0x8a, 0x10, 0x63, 0x13, 0x88, 0x01, 0xfd, 0x9c, 0x21, 0x12, 0x20, 0xb4, 0x0c, 0x42, 0x00,
+    0x25, 0x91, 0xbb, 0xaa, 0x9a, 0x72, 0x13, 0xb9, 0x09, 0xa0, 0xbd, 0x08, 0x12, 0xa8, 0xbc, 0x70,
+    0x35, 0xb8, 0x9c, 0x11, 0xa8, 0x09, 0x73, 0x03, 0xa8, 0x29, 0x92, 0xcf, 0x0a, 0x22, 0x02, 0x12,
+    0x23, 0xc0, 0xff, 0x89, 0x12, 0x22, 0x21, 0xa0, 0x9a, 0x99, 0xdc, 0x8a, 0x31, 0x13, 0x82, 0xa8,
+    0x89, 0x01, 0xca, 0xab, 0xbc, 0x71, 0x37, 0xa9, 0x19, 0x84, 0xdc, 0x09, 0x22, 0x02, 0x80, 0x89,
+    0x88, 0xb9, 0xbd, 0x99, 0x09, 0x73, 0x25, 0x01, 0x10, 0xfa, 0x9c, 0x30, 0x03, 0x89, 0x20, 0x23,
+    0x91, 0xdd, 0xaa, 0x98, 0x99, 0x54, 0x14, 0x00, 0x10, 0xa0, 0xbd, 0x8a, 0x10, 0x32, 0x36, 0x01,
+    0x00, 0xdc, 0x9c, 0x10, 0x20, 0x24, 0xa1, 0x2a, 0x16, 0xea, 0x8a, 0x08, 0x08, 0x43, 0x03, 0xc9,
+    0xbd, 0x0b, 0x11, 0xb8, 0x0a, 0x65, 0x23, 0x00, 0x00, 0xfa, 0xab, 0x11, 0x02, 0x43, 0x02, 0x89,
+    0xec, 0x14, 0x3d, 0x00, 0x91, 0xdd, 0x29, 0x82, 0x9b, 0x64, 0x92, 0xbb, 0x38, 0xa1, 0x9d, 0x40,
+    0x13, 0x88, 0x00, 0xd9, 0xab, 0x01, 0xda, 0x29, 0x24, 0x00, 0x81, 0xdf, 0x0a, 0x34, 0x91, 0x08,
+    0x81, 0x30, 0x14, 0x88, 0x22, 0xfd, 0x9d, 0x32, 0x81, 0x18, 0x81, 0xb9, 0x9a, 0x10, 0x01, 0xdd,
+    0x2a, 0x34, 0xa8, 0x0b, 0x90, 0x8b, 0x56, 0x81, 0x30, 0x04, 0xfa, 0x9a, 0x11, 0x81, 0xcb, 0x39,
+    0x36, 0x81, 0x98, 0xa8, 0x9a, 0x10, 0x12, 0x12, 0xfa, 0x0d, 0x34, 0xe0, 0x9c, 0x31, 0x92, 0x8a,
+    0x53, 0x81, 0x99, 0xca, 0xbc, 0x09, 0x21, 0x67, 0x13, 0x90, 0xcb, 0x9a, 0x08, 0x98, 0x28, 0x36,
+    0x01, 0x81, 0xd9, 0xbb, 0x9b, 0x09, 0x45, 0x12, 0x9a, 0x28, 0x14, 0xc8, 0xac, 0xa9, 0x0b, 0x56,
+    0x82, 0x08, 0x12, 0xca, 0x0a, 0xd8, 0x0c, 0x44, 0x01, 0x18, 0xa1, 0xbe, 0x0a, 0x21, 0x43, 0x24,
+    0xa0, 0xbb, 0x89, 0x80, 0xff, 0x01, 0x3c, 0x00, 0xa9, 0xba, 0x9c, 0x74, 0x17, 0xa0, 0xa9, 0xba,
+    0x8a, 0x10, 0x10, 0x54, 0x13, 0x98, 0xca, 0x8c, 0x10, 0x12, 0x52, 0xa2, 0xad, 0x28, 0x01, 0x10,
+    0xd8, 0xad, 0x10, 0x11, 0x35, 0xb1, 0xaf, 0x10, 0x80, 0x40, 0x24, 0x10, 0x90, 0xbd, 0x38, 0x82,
+    0xbc, 0x0a, 0x10, 0x52, 0x35, 0x92, 0xbe, 0x0b, 0x90, 0xbb, 0x38, 0x33, 0x46, 0x82, 0xdb, 0x89,
+    0x01, 0x11, 0x03, 0x20, 0x14, 0xfd, 0x9b, 0x11, 0x98, 0x28, 0x25, 0x02, 0xb8, 0xbc, 0x1a, 0x23,
+    0xa9, 0x49, 0x15, 0x00, 0x42, 0xa1, 0xcd, 0x0a, 0x01, 0xba, 0x4a, 0x36, 0x80, 0x51, 0xa1, 0xbe,
+    0x09, 0x12, 0x51, 0x33, 0xa0, 0xca, 0xbb, 0x28, 0x33, 0xfa, 0x0a, 0x53, 0x82, 0xba, 0x9a, 0xba,
+    0x29, 0x36, 0x42, 0x23, 0xb9, 0x9b, 0x00, 0x90, 0xfc, 0xab, 0x42, 0x82, 0x09, 0x53, 0x02, 0x21,
+    0xe0, 0xbf, 0x8b, 0x11, 0x81, 0x88, 0x80, 0x89, 0xd5, 0xea, 0x38, 0x00, 0x54, 0x82, 0xb9, 0x9a,
+    0x48, 0x36, 0xb8, 0xaf, 0xaa, 0x09, 0x54, 0x33, 0x01, 0x88, 0xa8, 0xeb, 0xab, 0x98, 0x88, 0x73,
+    0x13, 0x88, 0x10, 0x91, 0xcb, 0x8c, 0x32, 0xfb, 0x0f, 0x34, 0x92, 0x8a, 0x00, 0xda, 0x19, 0x12,
+    0x11, 0x90, 0x28, 0x03, 0xed, 0x8a, 0x00, 0x20, 0x12, 0x21, 0x17, 0xc9, 0x0a, 0xa0, 0x8c, 0x44,
+    0xa0, 0x39, 0x27, 0xc8, 0xbb, 0x9b, 0x21, 0x80, 0x58, 0x34, 0xa8, 0x41, 0xa2, 0xbe, 0x28, 0x02,
+    0x9a, 0x30, 0x25, 0x81, 0xa9, 0xbb, 0x9b, 0xa9, 0x09, 0x44, 0x21, 0x45, 0xe8, 0x8c, 0x43, 0xb0,
+    0x8c, 0x32, 0x81, 0x89, 0xa9, 0x18, 0x93, 0xaf, 0x40, 0xc1, 0xad, 0x31, 0x03, 0x88, 0x80, 0x9a,
+    0x99, 0x99, 0x53, 0xb0, 0x1d, 0x27, 0xb8, 0x8b, 0x02, 0x19, 0x47, 0x91, 0x9b, 0x22, 0xc9, 0x9b,
+    0x10, 0x01, 0x90, 0x0a, 0x77, 0x94, 0xbc, 0x29, 0x91, 0x9d, 0x42, 0x13, 0x2b, 0x06, 0x43, 0x00,
+    0x00, 0x80, 0xcc, 0x8a, 0x31, 0x34, 0x12, 0x31, 0xe0, 0xad, 0x21, 0xc1, 0x8c, 0x20, 0x11, 0x23,
+    0xb0, 0x0a, 0xd8, 0x8c, 0x21, 0x99, 0x76, 0x13, 0x99, 0xb9, 0xae, 0x09, 0x80, 0x30, 0x15, 0xa9,
+    0x21, 0xa1, 0x0a, 0xb0, 0xaf, 0x28, 0x21, 0x44, 0x01, 0x18, 0xe0, 0xac, 0x20, 0xa8, 0x41, 0x84,
+    0x9a, 0x12, 0xdc, 0x29, 0x02, 0x19, 0x36, 0x98, 0x29, 0x14, 0x98, 0xab, 0x38, 0x05, 0xcc, 0x48,
+    0x23, 0x01, 0xf9, 0xac, 0x80, 0xb9, 0x60, 0x24, 0x88, 0x10, 0xb9, 0x9b, 0xa0, 0xbd, 0x39, 0x34,
+    0x33, 0x12, 0x98, 0xcc, 0xab, 0x89, 0x43, 0xa1, 0x0d, 0x37, 0xb1, 0x1b, 0x94, 0xbf, 0x38, 0x12,
+    0x20, 0x15, 0xab, 0x41, 0xb1, 0xaf, 0x08, 0x31, 0x24, 0xb8, 0x89, 0x88, 0x89, 0x82, 0xbf, 0x19,
+    0x82, 0x89, 0x18, 0x42, 0x84, 0xdf, 0x19, 0x21, 0x80, 0x01, 0x80, 0x31, 0xa1, 0xbd, 0xdb, 0x1a,
+    0x26, 0xe8, 0x3d, 0x00, 0x47, 0x91, 0x99, 0x11, 0x90, 0x99, 0x10, 0xb0, 0xbf, 0x29, 0x15, 0x80,
+    0x00, 0xa8, 0x1a, 0x12, 0x32, 0xd2, 0xbf, 0x62, 0x83, 0xbb, 0x88, 0xaa, 0x38, 0x02, 0x1a, 0x36,
+    0x02, 0x24, 0xc0, 0x9c, 0x88, 0x30, 0x05, 0xed, 0x0a, 0x22, 0x80, 0xba, 0xac, 0x40, 0x13, 0x20,
+    0x34, 0xb1, 0xce, 0x8a, 0x41, 0x02, 0x99, 0x10, 0x80, 0x88, 0x9a, 0x10, 0xe8, 0xad, 0x18, 0x88,
+    0x73, 0x17, 0xaa, 0x29, 0x13, 0xbb, 0x59, 0x26, 0xa1, 0xbd, 0x18, 0x81, 0xcb, 0x20, 0x93, 0xad,
+    0x51, 0x82, 0x88, 0x80, 0x9a, 0x51, 0x90, 0x3a, 0x27, 0xda, 0x1a, 0x23, 0xa9, 0x08, 0x88, 0x18,
+    0xa0, 0x2a, 0x17, 0xda, 0x28, 0x83, 0xbe, 0x40, 0x12, 0x20, 0x14, 0xec, 0x0a, 0x44, 0x91, 0xaa,
+    0x88, 0xa9, 0x19, 0x15, 0xa9, 0x89, 0xb0, 0x0c, 0x34, 0x90, 0x60, 0x03, 0xeb, 0xbb, 0x19, 0x36,
+    0xa1, 0x1a, 0x33, 0xc9, 0xae, 0xfc, 0x40, 0x00, 0x0a, 0x23, 0x80, 0xca, 0xad, 0x20, 0x34, 0x90,
+    0xab, 0x09, 0xc8, 0x4a, 0x26, 0xb9, 0x3a, 0x14, 0x99, 0x88, 0xaa, 0x19, 0x63, 0x36, 0xb1, 0x9f,
+    0x20, 0x91, 0x89, 0x12, 0xa0, 0xec, 0x8b, 0x54, 0xa1, 0x9b, 0x22, 0xd8, 0x9b, 0x41, 0x22, 0x98,
+    0x19, 0x02, 0xbd, 0x20, 0xf0, 0x9f, 0x42, 0x12, 0x09, 0x80, 0xa8, 0xa9, 0xbb, 0x39, 0x15, 0x98,
+    0x53, 0x14, 0xa8, 0xda, 0xab, 0x10, 0x23, 0x12, 0x64, 0x24, 0xc8, 0xbd, 0x19, 0x33, 0xa0, 0x2a,
+    0x47, 0x91, 0x9b, 0x21, 0xb8, 0xae, 0x00, 0x01, 0x90, 0x20, 0x35, 0xa8, 0xad, 0x9a, 0x19, 0x63,
+    0x12, 0xca, 0x0b, 0x53, 0x81, 0xbb, 0x08, 0x00, 0xa9, 0x2a, 0x26, 0xc9, 0x60, 0x05, 0xca, 0x19,
+    0x92, 0x9b, 0x31, 0xa1, 0x08, 0x01, 0x40, 0x26, 0x80, 0x43, 0xc0, 0xae, 0x00, 0xb0, 0x8d, 0x31,
+    0x13, 0x63, 0x03, 0xa8, 0x00, 0xa8, 0x19, 0xd0, 0x35, 0x15, 0x3a, 0x00, 0xaf, 0x41, 0xa2, 0x9c,
+    0x31, 0x11, 0x33, 0xe0, 0x9d, 0x00, 0x08, 0x41, 0x03, 0xba, 0xab, 0x19, 0x36, 0x02, 0x20, 0x01,
+    0xcc, 0xab, 0x29, 0x03, 0xed, 0x8b, 0x11, 0x13, 0xa1, 0x39, 0x37, 0xea, 0x09, 0xb0, 0xae, 0x41,
+    0x91, 0x28, 0x03, 0xba, 0x71, 0x82, 0x9a, 0x09, 0x01, 0xec, 0x8b, 0x23, 0x81, 0x41, 0xd0, 0x9c,
+    0x31, 0xb0, 0x1b, 0x44, 0x81, 0xdb, 0x0b, 0x43, 0x00, 0x74, 0x02, 0xcb, 0x18, 0xa0, 0x9b, 0x11,
+    0xa8, 0x58, 0x14, 0xb8, 0x1a, 0x23, 0xc8, 0x0b, 0x44, 0xc0, 0xab, 0x52, 0x03, 0xba, 0x58, 0x93,
+    0xce, 0x18, 0x91, 0x19, 0x27, 0xb8, 0xab, 0x21, 0x81, 0xa9, 0x8a, 0x35, 0xa2, 0x8c, 0x43, 0x81,
+    0x9a, 0x00, 0xa0, 0xbd, 0x09, 0xb0, 0xbe, 0x29, 0x54, 0x02, 0xaa, 0x60, 0x23, 0xa9, 0x99, 0x41,
+    0xa3, 0xff, 0x38, 0x04, 0xba, 0x39, 0x14, 0xa9, 0x9a, 0x51, 0x02, 0xbd, 0xce, 0xf7, 0x42, 0x00,
+    0x29, 0xa1, 0xac, 0x33, 0xc0, 0x0a, 0x23, 0x00, 0x11, 0x98, 0x08, 0xeb, 0x68, 0x13, 0xcc, 0x08,
+    0xc8, 0x9c, 0x51, 0x02, 0xa8, 0x40, 0x03, 0xbb, 0x50, 0x92, 0xad, 0x10, 0x81, 0x00, 0x10, 0x74,
+    0xb3, 0xbf, 0x41, 0x93, 0xbd, 0x41, 0x83, 0xba, 0x88, 0x90, 0x08, 0xa8, 0x9b, 0x63, 0x02, 0x21,
+    0x04, 0xbc, 0x1a, 0x25, 0x11, 0x98, 0xcc, 0x38, 0x15, 0xb9, 0x9b, 0xaa, 0x39, 0x04, 0xaa, 0x73,
+    0xb0, 0x2c, 0x17, 0xeb, 0x0b, 0x42, 0x01, 0x89, 0x20, 0x82, 0xda, 0x29, 0x84, 0xba, 0x61, 0x82,
+    0x9a, 0x20, 0xa9, 0x39, 0x16, 0xa8, 0x9b, 0x89, 0x88, 0x9b, 0x72, 0x07, 0x99, 0x18, 0x92, 0x9c,
+    0x00, 0xa8, 0x70, 0x25, 0xa8, 0x09, 0x01, 0x99, 0x9a, 0x09, 0x43, 0x92, 0xab, 0x31, 0xb0, 0x2b,
+    0x17, 0xfd, 0x0a, 0x33, 0x81, 0x19, 0x22, 0x12, 0xc0, 0xaf, 0x19, 0x01, 0x28, 0x24, 0xc8, 0x9b,
+    0xc6, 0x05, 0x38, 0x00, 0x20, 0x25, 0x92, 0xdd, 0x8a, 0x44, 0x03, 0xba, 0x9a, 0x10, 0x45, 0x02,
+    0x9a, 0xa8, 0xbe, 0x20, 0x03, 0x9a, 0x01, 0xeb, 0x8a, 0x01, 0x20, 0x56, 0x23, 0xb0, 0xad, 0x10,
+    0x08, 0x75, 0x13, 0xca, 0x9a, 0x89, 0x18, 0x81, 0xaa, 0xa9, 0x0b, 0x67, 0xa1, 0x9c, 0x20, 0x82,
+    0xa8, 0x9a, 0x54, 0x83, 0xaa, 0x01, 0xdc, 0x29, 0x15, 0x88, 0xa8, 0xab, 0x50, 0x92, 0xad, 0x18,
+    0x10, 0x00, 0xca, 0x0a, 0x45, 0x92, 0xdb, 0x3a, 0x35, 0xe8, 0x8b, 0x32, 0x01, 0x88, 0xa8, 0xad,
+    0x89, 0x52, 0x25, 0x80, 0xbb, 0x09, 0x11, 0xca, 0x2a, 0x27, 0xb9, 0x0c, 0x02, 0xcb, 0x28, 0x34,
+    0x92, 0xfc, 0x9a, 0x43, 0x12, 0xa9, 0x88, 0x90, 0x88, 0x00, 0x00, 0x51, 0x25, 0xa0, 0x8b, 0x22,
+    0xfb, 0x1b, 0x34, 0xa0, 0xcb, 0xaa, 0x18, 0x13, 0xca, 0x29, 0x03, 0xfb, 0x9b, 0x31, 0x02, 0x09,
+    0x21, 0x44, 0x82, 0xbe, 0x59, 0xe3, 0x38, 0x00, 0x39, 0x13, 0x89, 0x91, 0xbd, 0x72, 0x04, 0x08,
+    0x90, 0xbc, 0x70, 0x83, 0xba, 0x30, 0x93, 0xad, 0x31, 0x83, 0x1a, 0x45, 0xc0, 0x1a, 0x26, 0xd9,
+    0x1a, 0x23, 0x98, 0x89, 0xa8, 0x40, 0x82, 0x0b, 0x25, 0xff, 0x0b, 0x32, 0xa1, 0x09, 0x12, 0xbb,
+    0x48, 0xa2, 0xbe, 0x60, 0x14, 0xa0, 0x9a, 0x00, 0x91, 0xca, 0x0a, 0x35, 0x91, 0x38, 0x14, 0xcc,
+    0x28, 0x84, 0xbc, 0x50, 0x13, 0xb9, 0x08, 0x90, 0xac, 0x38, 0x25, 0x90, 0x29, 0x27, 0xa1, 0xad,
+    0x88, 0x99, 0x41, 0x33, 0x80, 0x42, 0xa1, 0xbc, 0xba, 0xac, 0x52, 0x33, 0x80, 0xcc, 0x1a, 0x26,
+    0xea, 0x9b, 0x22, 0x90, 0x09, 0x21, 0x42, 0x24, 0xfa, 0x9c, 0x30, 0x03, 0xbc, 0x39, 0x13, 0x10,
+    0x23, 0xea, 0x89, 0xa8, 0x19, 0x04, 0xdb, 0x58, 0x02, 0xaa, 0x88, 0x28, 0x36, 0xa1, 0x9d, 0x88,
+    0x88, 0x22, 0xa8, 0x8a, 0xe9, 0x1b, 0x57, 0x23, 0x15, 0x1c, 0x40, 0x00, 0xc0, 0xbc, 0x19, 0x22,
+    0x21, 0x14, 0xda, 0x9c, 0x30, 0x34, 0xb8, 0x9c, 0x18, 0x98, 0x9a, 0x89, 0x74, 0x25, 0x88, 0x99,
+    0x89, 0x30, 0x14, 0xb9, 0xbd, 0x8a, 0x53, 0x92, 0xbb, 0x62, 0x13, 0xeb, 0x8b, 0x53, 0x82, 0xbb,
+    0xaa, 0x29, 0x24, 0xa8, 0x59, 0x24, 0xba, 0x38, 0x03, 0xba, 0xcb, 0xab, 0x31, 0x82, 0x89, 0x41,
+    0x26, 0xd9, 0xac, 0x88, 0x20, 0x26, 0xb9, 0x49, 0xe1, 0xaf, 0x29, 0x22, 0x10, 0x01, 0x28, 0x14,
+    0xeb, 0x8b, 0x88, 0x28, 0x35, 0x91, 0x99, 0x9a, 0x60, 0x04, 0xba, 0x2a, 0x24, 0x90, 0xcc, 0xcb,
+    0x09, 0x53, 0x02, 0xcd, 0x29, 0x34, 0x01, 0x91, 0xba, 0x50, 0xa3, 0xaf, 0x30, 0x82, 0x89, 0x22,
+    0x01, 0x08, 0xb9, 0x9d, 0xa9, 0xba, 0x39, 0x57, 0x02, 0x99, 0x21, 0xb8, 0x0b, 0x14, 0x99, 0x64,
+    0xd0, 0x9d, 0x42, 0x91, 0xbd, 0x18, 0x83, 0x99, 0x28, 0x01, 0x20, 0xa1, 0x93, 0x00, 0x37, 0x00,
+    0x8c, 0x55, 0x91, 0x9c, 0x11, 0xca, 0x1b, 0x43, 0x12, 0xa8, 0xbc, 0x09, 0x31, 0x44, 0x91, 0x1a,
+    0x02, 0xab, 0x66, 0xc1, 0xbd, 0x30, 0x14, 0x98, 0x9a, 0x38, 0x25, 0xb8, 0x9b, 0x43, 0x02, 0xa8,
+    0x88, 0xb9, 0x19, 0x33, 0xca, 0x38, 0xf0, 0xdf, 0x31, 0x83, 0x9b, 0x20, 0xfc, 0x8c, 0x43, 0x02,
+    0x80, 0xb9, 0x8b, 0x23, 0xfb, 0x0a, 0x34, 0xa0, 0x88, 0xa0, 0xaa, 0x41, 0x24, 0xc8, 0xad, 0x50,
+    0x24, 0x91, 0x99, 0x10, 0x81, 0xb9, 0xbc, 0x2a, 0x57, 0x91, 0x9a, 0x10, 0x01, 0xa0, 0xbe, 0x19,
+    0x93, 0xaa, 0x44, 0xa1, 0x0b, 0xa1, 0x9d, 0x73, 0x03, 0xa8, 0x9b, 0x39, 0x35, 0x90, 0xaa, 0x8a,
+    0x21, 0x90, 0x78, 0x15, 0xdc, 0x29, 0x33, 0xda, 0x9b, 0x31, 0x22, 0x91, 0xdd, 0x0a, 0x43, 0x91,
+    0x9a, 0x32, 0x01, 0x00, 0xfb, 0x8c, 0x53, 0x90, 0x9b, 0x32, 0x01, 0x18, 0x00, 0x89, 0x20, 0xc0,
+    0x68, 0x08, 0x32, 0x00, 0xad, 0x10, 0x18, 0x55, 0xd0, 0xaf, 0x10, 0x02, 0x32, 0x04, 0xdb, 0x0a,
+    0x80, 0x18, 0x43, 0x91, 0x89, 0x81, 0xef, 0x0a, 0x44, 0xa1, 0x9a, 0x11, 0x02, 0x11, 0x81, 0x28,
+    0x84, 0xcd, 0x38, 0xa2, 0xaf, 0x30, 0x83, 0xca, 0x19, 0x32, 0xb0, 0xbd, 0x18, 0x14, 0x10, 0x23,
+    0xfc, 0x8c, 0x53, 0x90, 0x0a, 0x33, 0x81, 0xaa, 0xbc, 0x59, 0x26, 0xc8, 0x8b, 0x10, 0x10, 0x90,
+    0xbb, 0x29, 0x12, 0x01, 0xd8, 0x0b, 0x26, 0x98, 0x08, 0xfa, 0x0d, 0x33, 0x80, 0x20, 0xb0, 0x29,
+    0x84, 0xae, 0x51, 0x91, 0x19, 0x83, 0xbe, 0x38, 0x03, 0x89, 0x12, 0x20, 0x83, 0xff, 0x09, 0x23,
+    0xa8, 0x9a, 0x89, 0x98, 0xbb, 0x70, 0x17, 0x90, 0x9a, 0x08, 0x98, 0x18, 0x23, 0x98, 0x48, 0x84,
+    0xdc, 0x8a, 0xa9, 0x18, 0x13, 0x08, 0x45, 0x91, 0x40, 0x84, 0xde, 0x19, 0x23, 0x91, 0x0a, 0x31,
+    0x83, 0xdd, 0xab, 0x60, 0x4b, 0xf6, 0x42, 0x00, 0x34, 0xb8, 0x8c, 0x10, 0x00, 0x80, 0xb9, 0x0a,
+    0x81, 0x0b, 0x27, 0xe9, 0x29, 0x15, 0xa8, 0x9a, 0xba, 0x72, 0x13, 0xba, 0x19, 0x02, 0x11, 0xc0,
+    0xbd, 0x18, 0x02, 0x31, 0x04, 0xec, 0x09, 0x22, 0xb1, 0xac, 0x72, 0x15, 0xb9, 0x8c, 0x21, 0x81,
+    0x88, 0x90, 0x8a, 0x55, 0x92, 0xac, 0x19, 0x12, 0x21, 0x02, 0xd9, 0x1a, 0x35, 0xb0, 0xad, 0x10,
+    0x80, 0x20, 0xa2, 0xab, 0x41, 0xc1, 0xac, 0x88, 0x00, 0x91, 0xbf, 0x60, 0x25, 0xa0, 0xbb, 0x38,
+    0x35, 0xb8, 0xbd, 0x8a, 0x21, 0x25, 0xb8, 0xae, 0x09, 0x11, 0x02, 0x00, 0x54, 0x82, 0xcd, 0x0a,
+    0x22, 0x98, 0x72, 0x82, 0xcc, 0x28, 0x03, 0xb9, 0x8a, 0x01, 0x32, 0x82, 0xcb, 0x19, 0x43, 0xd8,
+    0x9d, 0x51, 0x13, 0x88, 0x20, 0xa1, 0xbc, 0x49, 0x15, 0xda, 0x49, 0x27, 0xc8, 0x9b, 0x20, 0x00,
+    0x00, 0x80, 0x08, 0x81, 0xab, 0x73, 0xb2, 0xae, 0xc5, 0xf0, 0x42, 0x00, 0x20, 0x13, 0x01, 0x80,
+    0x08, 0x03, 0xed, 0x8b, 0x21, 0x32, 0x91, 0x9c, 0x64, 0x82, 0xbd, 0x1a, 0x13, 0x08, 0x21, 0xf9,
+    0x0a, 0x33, 0xea, 0x2a, 0x13, 0xab, 0x72, 0x92, 0xba, 0x10, 0x00, 0x00, 0xd9, 0x8b, 0x43, 0xa2,
+    0xcb, 0x28, 0x35, 0x82, 0xbc, 0x48, 0x25, 0xa0, 0xab, 0x0a, 0x18, 0xa8, 0xbe, 0x72, 0x24, 0xb9,
+    0x0a, 0x00, 0x09, 0x11, 0xfa, 0x9b, 0x40, 0x24, 0x98, 0x0a, 0x43, 0x02, 0x88, 0xfc, 0x9c, 0x53,
+    0x81, 0xba, 0x89, 0x21, 0x03, 0xda, 0x0a, 0x34, 0xa2, 0x9b, 0x42, 0xb1, 0x9e, 0x22, 0xea, 0x8c,
+    0x53, 0x01, 0x8a, 0x20, 0x90, 0xbb, 0x51, 0x13, 0xc9, 0xab, 0x09, 0x42, 0x12, 0x10, 0x13, 0xba,
+    0x49, 0x24, 0xb9, 0x19, 0xa1, 0xad, 0x12, 0xff, 0x9e, 0x31, 0x13, 0x88, 0x12, 0xc8, 0x8b, 0x53,
+    0x82, 0xba, 0xab, 0x08, 0x20, 0x03, 0xdd, 0x58, 0x04, 0xa9, 0x30, 0xa3, 0x33, 0x0e, 0x37, 0x00,
+    0xbf, 0x30, 0x03, 0xdc, 0x8a, 0x10, 0x11, 0x23, 0xd8, 0x1b, 0x45, 0x91, 0xba, 0xbc, 0x39, 0x36,
+    0xc8, 0x9a, 0x89, 0x30, 0x15, 0xba, 0x39, 0x84, 0xba, 0x38, 0x46, 0x82, 0xeb, 0x8a, 0x90, 0x19,
+    0x45, 0x82, 0xab, 0x39, 0x36, 0xc8, 0xad, 0x08, 0x11, 0x01, 0x98, 0x18, 0x34, 0xa0, 0xcd, 0x8a,
+    0x53, 0x23, 0x11, 0x90, 0xbb, 0x40, 0xa1, 0x9d, 0x90, 0x49, 0x57, 0xa0, 0x8c, 0x21, 0x80, 0x9a,
+    0x80, 0x30, 0x25, 0xb0, 0x9c, 0x89, 0x21, 0x91, 0xac, 0x08, 0xb9, 0x79, 0x27, 0xb9, 0x9c, 0x11,
+    0xb0, 0xac, 0x72, 0x14, 0xa8, 0x0a, 0x11, 0xb8, 0x8b, 0x44, 0xb1, 0xae, 0x48, 0x02, 0xca, 0x0a,
+    0x42, 0x03, 0xcb, 0x1a, 0x34, 0x12, 0x80, 0xaa, 0x19, 0xb1, 0xcf, 0x30, 0x03, 0x9a, 0x54, 0xa2,
+    0xbd, 0x09, 0x33, 0x91, 0xbc, 0x58, 0x04, 0xdc, 0x09, 0x13, 0xba, 0x19, 0x25, 0x80, 0x01, 0xca,
+    0x7a, 0xff, 0x3d, 0x00, 0xac, 0x20, 0x00, 0x20, 0xb0, 0xad, 0x20, 0x24, 0x22, 0xc8, 0x0c, 0x32,
+    0xeb, 0x2a, 0x34, 0x01, 0xa8, 0xbe, 0x19, 0x90, 0x1a, 0x57, 0x81, 0x09, 0x98, 0x9a, 0x10, 0xb0,
+    0xad, 0x30, 0x27, 0xb0, 0xbf, 0x29, 0x25, 0xa8, 0x8b, 0x22, 0xc9, 0x29, 0x12, 0x99, 0x33, 0xd8,
+    0x0b, 0x13, 0xca, 0x40, 0x24, 0x21, 0x15, 0xd8, 0xac, 0x30, 0x03, 0xaa, 0x28, 0x43, 0x15, 0xfb,
+    0x8e, 0x31, 0x02, 0x08, 0xb8, 0xad, 0x10, 0x98, 0x09, 0x81, 0x1a, 0x47, 0x82, 0xbb, 0x09, 0x31,
+    0x04, 0xda, 0x0a, 0x44, 0x81, 0xac, 0x29, 0x33, 0xa0, 0x09, 0x03, 0xaa, 0x75, 0xb1, 0x9f, 0x20,
+    0x02, 0x89, 0xbb, 0x3b, 0x67, 0x91, 0x99, 0x88, 0x10, 0xa0, 0xae, 0x51, 0x03, 0xaa, 0x09, 0x98,
+    0x18, 0xa1, 0x8b, 0x36, 0xe9, 0x8a, 0x43, 0xa1, 0x89, 0x32, 0xb1, 0xad, 0x40, 0x23, 0x02, 0x90,
+    0x89, 0x33, 0xfb, 0x8f, 0xa2, 0xf8, 0x3f, 0x00, 0x11, 0x80, 0x52, 0x03, 0xbb, 0x8a, 0x20, 0x42,
+    0x12, 0xb9, 0x19, 0xa1, 0xef, 0x89, 0xa8, 0x8b, 0x56, 0x91, 0xbc, 0x20, 0x24, 0x82, 0xda, 0x8a,
+    0x43, 0x82, 0xdb, 0x19, 0x24, 0xa0, 0x09, 0xb8, 0x0d, 0x45, 0xa1, 0x8b, 0x10, 0x18, 0x35, 0xe8,
+    0x9b, 0x32, 0x90, 0x0a, 0x43, 0x22, 0x91, 0xcc, 0x2a, 0x33, 0xd9, 0x0a, 0x24, 0xc8, 0x8b, 0x32,
+    0xa1, 0xac, 0x62, 0x92, 0xdf, 0x09, 0x23, 0x81, 0x99, 0xdb, 0x0b, 0x64, 0x01, 0x99, 0x00, 0x90,
+    0x89, 0xba, 0x2a, 0x37, 0x92, 0xab, 0x18, 0x80, 0xba, 0xbd, 0x71, 0x14, 0xb8, 0x89, 0x90, 0x28,
+    0x03, 0xee, 0x29, 0x34, 0x00, 0x00, 0xca, 0x0b, 0x53, 0x91, 0x99, 0xb9, 0x0b, 0x37, 0xc8, 0xad,
+    0x31, 0x14, 0xa9, 0x8a, 0x31, 0x22, 0xa8, 0x0b, 0x63, 0xa1, 0x9a, 0xb0, 0xbf, 0x71, 0x04, 0xcb,
+    0x19, 0x23, 0xa8, 0xba, 0x28, 0x43, 0x91, 0xac, 0xb1, 0xfe, 0x39, 0x00, 0x89, 0x99, 0x61, 0x82,
+    0x8a, 0x55, 0xb1, 0x9b, 0x22, 0xd9, 0x09, 0xb8, 0x9c, 0x22, 0xba, 0x72, 0xb4, 0xbf, 0x40, 0x13,
+    0xba, 0x8a, 0x52, 0x82, 0xcb, 0x28, 0x23, 0xea, 0x8a, 0x31, 0x23, 0x90, 0xba, 0x18, 0x92, 0xdc,
+    0x49, 0x45, 0x80, 0xab, 0x99, 0x20, 0x42, 0x12, 0xea, 0xac, 0x20, 0x14, 0xaa, 0x40, 0x03, 0xcd,
+    0x09, 0x22, 0xb8, 0x0c, 0x53, 0x23, 0x81, 0x00, 0x80, 0xcc, 0xac, 0x31, 0x25, 0xa8, 0x9a, 0x21,
+    0xb1, 0x0c, 0x33, 0xfa, 0x1c, 0x26, 0xb8, 0x49, 0x24, 0xa8, 0xa9, 0xbc, 0x68, 0x14, 0xa9, 0x19,
+    0x81, 0x30, 0x84, 0xcf, 0x19, 0x23, 0x80, 0x08, 0x88, 0x21, 0xc1, 0xad, 0x28, 0x80, 0x30, 0x16,
+    0xcc, 0x29, 0x24, 0x98, 0xab, 0x89, 0x55, 0x13, 0xda, 0x8b, 0x30, 0x01, 0xcc, 0x09, 0x44, 0x11,
+    0x88, 0xbc, 0x0b, 0x32, 0x81, 0xaa, 0xab, 0x71, 0x14, 0xca, 0x8a, 0x42, 0x5d, 0x0b, 0x3d, 0x00,
+    0x03, 0xca, 0x19, 0x14, 0xca, 0x9c, 0x89, 0x30, 0x24, 0x88, 0x28, 0xb1, 0x9c, 0x13, 0xfc, 0x1b,
+    0x36, 0xb1, 0xad, 0x31, 0x13, 0xa8, 0xa9, 0x99, 0x20, 0x91, 0x0a, 0x23, 0xfb, 0x09, 0x34, 0x90,
+    0xac, 0x60, 0x04, 0xd9, 0x8a, 0x62, 0x12, 0xdc, 0x8b, 0x53, 0xa1, 0xab, 0x53, 0x01, 0xaa, 0x00,
+    0x98, 0x8a, 0x63, 0x13, 0xb9, 0x9d, 0x31, 0x83, 0xbc, 0x19, 0x12, 0x00, 0x32, 0x81, 0x62, 0x93,
+    0xcf, 0x19, 0x83, 0xca, 0x29, 0x25, 0xa0, 0x0a, 0x34, 0xf9, 0x8c, 0x43, 0xa1, 0x9c, 0x31, 0x13,
+    0xa0, 0xad, 0x29, 0xa1, 0x9d, 0x55, 0x91, 0x8b, 0x22, 0xe9, 0x0a, 0x02, 0x90, 0x21, 0xa1, 0xcc,
+    0x09, 0x22, 0x91, 0x09, 0x33, 0xda, 0x38, 0x05, 0xcb, 0x28, 0x02, 0xb9, 0xde, 0x09, 0x22, 0xb9,
+    0x49, 0x25, 0xa8, 0x9b, 0x62, 0x13, 0xca, 0x8a, 0x23, 0x11, 0x43, 0xc0, 0xad, 0x31, 0x25, 0xb0,
+    0x85, 0x09, 0x39, 0x00, 0xcd, 0x19, 0x12, 0x91, 0x98, 0x0a, 0x73, 0x83, 0x9b, 0x00, 0xc9, 0x48,
+    0x14, 0x9b, 0x42, 0xc1, 0x9b, 0x11, 0xa9, 0x9a, 0x38, 0x77, 0xb0, 0x9e, 0x11, 0xb8, 0x0a, 0x13,
+    0x08, 0x42, 0x81, 0x21, 0xa4, 0xbe, 0x9a, 0x99, 0x73, 0x14, 0x9a, 0x08, 0xaa, 0x29, 0xb3, 0xaf,
+    0x61, 0x23, 0x01, 0xc9, 0x0b, 0x33, 0xf9, 0x0b, 0x33, 0x92, 0x9b, 0x10, 0x02, 0x88, 0x08, 0x80,
+    0x72, 0x25, 0xa1, 0xdb, 0xab, 0x28, 0x23, 0xfa, 0x9d, 0x21, 0x14, 0xa8, 0x9c, 0x38, 0x13, 0xa8,
+    0x9a, 0xb9, 0x9d, 0x63, 0x02, 0xa9, 0x1a, 0x55, 0x82, 0xbd, 0x29, 0x33, 0x02, 0xb8, 0xad, 0x00,
+    0xea, 0x29, 0x37, 0x00, 0x18, 0xb8, 0x9f, 0x20, 0x80, 0x28, 0x82, 0xbb, 0x30, 0xd0, 0x0c, 0x33,
+    0xc8, 0x39, 0xe2, 0x9f, 0x41, 0x82, 0x8a, 0x23, 0xc9, 0x1a, 0x02, 0xca, 0x8b, 0x73, 0x16, 0xaa,
+    0x0a, 0x22, 0xa8, 0x09, 0x8c, 0xfe, 0x3b, 0x00, 0x00, 0x10, 0x42, 0x02, 0xcd, 0x1a, 0x01, 0xaa,
+    0x48, 0x13, 0xba, 0xcb, 0x8a, 0x80, 0x8b, 0x74, 0x83, 0x28, 0x25, 0xd9, 0x9c, 0x30, 0x15, 0xc8,
+    0x0a, 0x34, 0xa2, 0xab, 0x09, 0xa9, 0x20, 0x13, 0xeb, 0x58, 0x25, 0xda, 0x8b, 0x32, 0x90, 0x19,
+    0x12, 0xc8, 0x29, 0x14, 0xda, 0x9a, 0x90, 0x20, 0x16, 0xd9, 0x1a, 0x13, 0xca, 0x8b, 0x00, 0x41,
+    0x44, 0x82, 0xcc, 0x48, 0x15, 0xa9, 0x09, 0x22, 0x51, 0x83, 0xdf, 0x29, 0x33, 0x98, 0x9a, 0x89,
+    0x21, 0x91, 0xac, 0x41, 0x83, 0xca, 0x9b, 0xa8, 0xbc, 0x70, 0x24, 0xd9, 0x8a, 0x32, 0x13, 0xa0,
+    0xab, 0x98, 0xba, 0x60, 0x34, 0x11, 0x82, 0xcc, 0x18, 0xb8, 0x8f, 0x42, 0x02, 0x21, 0x91, 0xbe,
+    0x40, 0x93, 0xdc, 0x2a, 0x24, 0xa0, 0x8b, 0x32, 0x82, 0xdc, 0x9b, 0x52, 0xc1, 0xae, 0x40, 0x13,
+    0x90, 0xba, 0x1a, 0x24, 0xca, 0x1a, 0x13, 0x80, 0xc7, 0xfe, 0x38, 0x00, 0x11, 0x98, 0x31, 0xd0,
+    0x1b, 0x04, 0xcd, 0x38, 0x05, 0xab, 0x51, 0x12, 0xa8, 0x8a, 0x20, 0x14, 0xd9, 0x9c, 0x20, 0x26,
+    0x81, 0xbb, 0x9b, 0x10, 0x11, 0x53, 0xa1, 0xbf, 0x61, 0x03, 0xdb, 0x89, 0x01, 0x80, 0x98, 0x19,
+    0x44, 0xb8, 0x9d, 0x21, 0x02, 0x11, 0xfa, 0xac, 0x18, 0x81, 0x31, 0x37, 0xa0, 0xbb, 0x18, 0x80,
+    0xba, 0x2a, 0x57, 0x92, 0xaa, 0x99, 0xbc, 0x48, 0x25, 0xa9, 0x19, 0x00, 0x00, 0x12, 0x18, 0x55,
+    0xa1, 0xbe, 0x20, 0x03, 0xa9, 0x31, 0x91, 0x28, 0xb3, 0xff, 0x38, 0x82, 0x9b, 0x33, 0xa0, 0x28,
+    0xf1, 0x0c, 0x44, 0xe8, 0x1a, 0x34, 0xa0, 0x8a, 0x01, 0x88, 0x80, 0xbd, 0x38, 0x84, 0xab, 0x18,
+    0x90, 0x18, 0x03, 0x10, 0x13, 0xde, 0x48, 0x14, 0xda, 0x8a, 0x31, 0x01, 0xdc, 0x8c, 0x42, 0xa2,
+    0x9d, 0x30, 0x92, 0xac, 0x40, 0x24, 0xa9, 0x1a, 0x22, 0xc8, 0x9a, 0x08, 0x51, 0xf2, 0x34, 0x00,
+    0x11, 0xa2, 0xae, 0x72, 0x05, 0xca, 0x89, 0x00, 0x08, 0x42, 0x82, 0xcc, 0x0a, 0x33, 0x82, 0xaa,
+    0x48, 0x03, 0xaa, 0x51, 0x82, 0x9d, 0x62, 0x92, 0xaa, 0x10, 0xb9, 0x2a, 0x25, 0x18, 0x44, 0xd8,
+    0x9c, 0x31, 0x11, 0x98, 0xaa, 0x70, 0x24, 0xd9, 0x8b, 0x53, 0x91, 0xbb, 0x19, 0x12, 0x18, 0x01,
+    0xcb, 0x30, 0x94, 0xbe, 0x30, 0x35, 0x82, 0xba, 0x38, 0x93, 0xce, 0x28, 0x26, 0xa8, 0xad, 0x20,
+    0x13, 0xeb, 0x8a, 0x21, 0x81, 0xbb, 0x20, 0x23, 0x11, 0xb0, 0xbf, 0x50, 0x83, 0xbc, 0x19, 0x43,
+    0x02, 0xeb, 0x19, 0x03, 0xb9, 0x20, 0xd8, 0x4a, 0x47, 0xc8, 0x9b, 0x43, 0x82, 0xbc, 0x0a, 0x11,
+    0x81, 0x08, 0x31, 0x25, 0xd9, 0x1a, 0x24, 0xe9, 0x9b, 0x00, 0x20, 0x24, 0xa0, 0x29, 0x15, 0xc9,
+    0xaa, 0x88, 0x20, 0x37, 0x03, 0xb9, 0x1a, 0x44, 0x90, 0xbc, 0x8a, 0x98, 0x29, 0x64, 0x13, 0xb8,
+    0x9c, 0x0b, 0x34, 0x00, 0xae, 0x20, 0x03, 0xbb, 0x58, 0x13, 0xaa, 0x08, 0x10, 0x43, 0xf9, 0x8d,
+    0x42, 0x81, 0x89, 0x31, 0x13, 0xfb, 0x9c, 0x10, 0x80, 0x28, 0x81, 0x28, 0x14, 0xdb, 0x58, 0xa2,
+    0xad, 0x31, 0xc8, 0x0a, 0x91, 0x8c, 0x43, 0xd8, 0x1a, 0x04, 0xbd, 0x1a, 0x44, 0x13, 0xb9, 0x9d,
+    0x00, 0xcb, 0x38, 0x15, 0xa8, 0x18, 0x02, 0x11, 0xb8, 0x0d, 0x25, 0xfa, 0x0b, 0x33, 0xc8, 0x29,
+    0x25, 0xb8, 0xac, 0x18, 0x32, 0x11, 0x20, 0x00, 0x51, 0x03, 0xcf, 0x09, 0x03, 0xcb, 0x18, 0x13,
+    0x98, 0x9a, 0x62, 0x14, 0xb9, 0x30, 0x06, 0xba, 0x48, 0x13, 0xfb, 0x0a, 0x43, 0xb1, 0xae, 0x29,
+    0x12, 0x00, 0x20, 0x42, 0xb1, 0xdf, 0x19, 0x12, 0xa9, 0x28, 0x13, 0x90, 0xcd, 0x0a, 0x35, 0xb0,
+    0x2a, 0x25, 0xb9, 0x0a, 0x81, 0x0b, 0x12, 0xdb, 0x19, 0x91, 0x1b, 0x44, 0x31, 0x25, 0xfa, 0x0a,
+    0x34, 0x91, 0xaa, 0x08, 0x0f, 0x02, 0x33, 0x00, 0x62, 0x33, 0xa1, 0xde, 0xab, 0x42, 0x83, 0xbb,
+    0x50, 0x24, 0xa0, 0xba, 0x8a, 0x20, 0x90, 0x9a, 0x40, 0x33, 0x92, 0xed, 0xbb, 0x89, 0x31, 0x34,
+    0xb0, 0xbe, 0x09, 0x33, 0x92, 0xce, 0x0a, 0x62, 0x33, 0x90, 0x8a, 0x22, 0xfa, 0x0a, 0x33, 0xa0,
+    0x8a, 0x00, 0x11, 0xc1, 0x9e, 0x51, 0x02, 0xab, 0x09, 0x22, 0x24, 0xda, 0x8b, 0x34, 0x03, 0x88,
+    0xa9, 0xbe, 0x9c, 0x09, 0x28, 0x11, 0xda, 0xbd, 0x9b, 0x18, 0x44, 0x35, 0x13, 0xea, 0x8b, 0x53,
+    0x22, 0x01, 0xba, 0x29, 0x26, 0xa9, 0xbb, 0xab, 0x73, 0x05, 0xcb, 0x8a, 0x11, 0x10, 0x33, 0x91,
+    0xdb, 0x99, 0x98, 0x29, 0x57, 0x02, 0xb9, 0xab, 0x89, 0x00, 0x63, 0x25, 0xe9, 0xab, 0x52, 0x01,
+    0x99, 0x80, 0x90, 0x00, 0x42, 0x43, 0x81, 0xbc, 0x09, 0x01, 0xb9, 0xad, 0x48, 0x24, 0xc9, 0x9b,
+    0x31, 0xa1, 0xbe, 0x29, 0x47, 0x02, 0xaa, 0x08, 0x50, 0x08, 0x36, 0x00, 0x81, 0xcb, 0x39, 0x24,
+    0xa9, 0x29, 0x01, 0x48, 0x47, 0x91, 0xca, 0xbc, 0x09, 0x32, 0x12, 0x00, 0xb9, 0x0a, 0x24, 0xc8,
+    0xdc, 0xac, 0x58, 0x24, 0xa0, 0x99, 0x08, 0x00, 0x01, 0x88, 0x02, 0xca, 0x68, 0x26, 0x80, 0x18,
+    0xa1, 0xbe, 0x89, 0x00, 0x52, 0x03, 0xec, 0x09, 0x22, 0xb8, 0xac, 0x31, 0x13, 0xa9, 0x28, 0x34,
+    0xc8, 0xbb, 0x98, 0xcd, 0x29, 0x37, 0x13, 0x80, 0x90, 0x08, 0x13, 0xfc, 0x9e, 0x32, 0x23, 0x88,
+    0x98, 0xac, 0x09, 0x81, 0x9a, 0x80, 0xeb, 0x28, 0x26, 0xa9, 0x0a, 0x01, 0xfd, 0x8a, 0x41, 0x22,
+    0x01, 0x89, 0x20, 0x04, 0xaa, 0x28, 0xd0, 0x9f, 0x28, 0x31, 0x24, 0xd8, 0x9b, 0x10, 0xba, 0x48,
+    0x14, 0x88, 0x08, 0x28, 0x24, 0xfb, 0xaf, 0x28, 0x01, 0x81, 0xa8, 0x8a, 0x10, 0x80, 0x08, 0x08,
+    0x08, 0x43, 0x83, 0xff, 0x8c, 0x41, 0x23, 0x91, 0xba, 0xab, 0x41, 0x13, 0x19, 0xfd, 0x32, 0x00,
+    0x01, 0xb1, 0xbf, 0x38, 0x16, 0xb9, 0x8b, 0x42, 0x13, 0xa8, 0x0a, 0xa0, 0xbe, 0x19, 0x80, 0x62,
+    0x04, 0xdd, 0x8a, 0x80, 0x89, 0x52, 0x03, 0x08, 0x98, 0xbb, 0x40, 0xc1, 0x9e, 0x40, 0x23, 0x98,
+    0xda, 0x9b, 0x62, 0x22, 0x99, 0x19, 0x01, 0xa8, 0x1a, 0x42, 0x01, 0x08, 0x34, 0xb1, 0xcf, 0x9a,
+    0x10, 0x22, 0x43, 0x35, 0x80, 0xaa, 0x08, 0x23, 0x91, 0xee, 0x9b, 0x52, 0x33, 0xb8, 0xbd, 0x18,
+    0x34, 0xb0, 0xce, 0x09, 0x11, 0x12, 0x90, 0xaa, 0x08, 0xa0, 0x38, 0x23, 0xab, 0x72, 0x92, 0xad,
+    0x19, 0x47, 0x82, 0xbb, 0x28, 0xa0, 0xaf, 0x18, 0x24, 0x13, 0x00, 0xa0, 0xef, 0x89, 0x12, 0x80,
+    0x20, 0x33, 0x23, 0xd8, 0xae, 0x28, 0x53, 0x13, 0xb0, 0xad, 0x10, 0x43, 0x01, 0xca, 0x8a, 0x21,
+    0x01, 0x98, 0xbc, 0x29, 0x45, 0x43, 0x02, 0xcc, 0x19, 0x33, 0xa8, 0x8b, 0x53, 0x91, 0xcd, 0x0a,
+    0x1e, 0x04, 0x33, 0x00, 0x33, 0x81, 0xba, 0x19, 0x35, 0xa0, 0x89, 0x12, 0xda, 0x0a, 0x74, 0x23,
+    0x92, 0xfb, 0xad, 0x19, 0x23, 0x00, 0xb9, 0xbc, 0x2a, 0x13, 0xdb, 0x18, 0x02, 0x20, 0x82, 0xbb,
+    0x53, 0xb0, 0x59, 0x27, 0xb9, 0xbd, 0x9a, 0x10, 0x33, 0x11, 0xc8, 0x8c, 0x62, 0x82, 0xbb, 0x9c,
+    0x72, 0x34, 0xb8, 0xac, 0x88, 0x08, 0x31, 0x91, 0x09, 0x80, 0xdb, 0xac, 0x8a, 0x54, 0x34, 0x02,
+    0xeb, 0x0a, 0x24, 0xa0, 0x8a, 0x80, 0x8a, 0x32, 0x01, 0x88, 0xfb, 0x2a, 0x45, 0x91, 0xca, 0x19,
+    0x47, 0x83, 0xbb, 0x18, 0x01, 0xa9, 0x9a, 0x63, 0x23, 0xca, 0x9a, 0x08, 0x20, 0x35, 0x24, 0x82,
+    0xed, 0x0a, 0x22, 0x90, 0x08, 0xa0, 0x9d, 0x64, 0x12, 0x98, 0xcb, 0x9b, 0x52, 0x83, 0xa9, 0x89,
+    0x99, 0x19, 0x81, 0xcc, 0x38, 0x67, 0x12, 0x98, 0x9a, 0x98, 0x89, 0x42, 0x13, 0x88, 0x00, 0xfb,
+    0x8e, 0x21, 0x82, 0xca, 0x90, 0x0a, 0x34, 0x00, 0x89, 0x98, 0x8a, 0x88, 0x38, 0x47, 0xc8, 0x9d,
+    0x88, 0x80, 0x41, 0x03, 0x8a, 0x31, 0xe0, 0xad, 0x18, 0x13, 0x91, 0xa9, 0x09, 0x99, 0x19, 0x03,
+    0xcc, 0x71, 0x07, 0xc9, 0x1a, 0x32, 0x90, 0xab, 0x09, 0x34, 0x92, 0xcf, 0x0a, 0x30, 0x43, 0x02,
+    0xaa, 0x19, 0x81, 0xbd, 0x89, 0x81, 0x41, 0x02, 0xbc, 0x70, 0x13, 0x99, 0x88, 0x99, 0x71, 0x13,
+    0xb9, 0x8b, 0x01, 0xa9, 0xab, 0x31, 0x37, 0x11, 0x31, 0x56, 0x23, 0xb1, 0xcf, 0x0a, 0x21, 0x81,
+    0xb9, 0xad, 0x19, 0x23, 0xa9, 0x29, 0x25, 0x90, 0x09, 0x11, 0x10, 0x22, 0xda, 0x3a, 0xa3, 0xff,
+    0x2a, 0x15, 0xc9, 0x9b, 0x20, 0x34, 0xa0, 0xbd, 0xac, 0xaa, 0x41, 0x14, 0x89, 0x10, 0xb8, 0x9c,
+    0x08, 0xc9, 0x39, 0x67, 0x02, 0x9a, 0x18, 0x91, 0xca, 0xaa, 0x89, 0xda, 0xbc, 0x38, 0x25, 0x00,
+    0x18, 0x12, 0x91, 0xcb, 0x70, 0x26, 0xa0, 0x8a, 0xcb, 0xf7, 0x35, 0x00, 0x22, 0xa0, 0xae, 0x19,
+    0x43, 0xa0, 0x8b, 0x54, 0x82, 0xcc, 0x19, 0x24, 0x91, 0x9a, 0x28, 0x13, 0xa8, 0x0b, 0x43, 0xb0,
+    0xad, 0x28, 0x02, 0x98, 0xc9, 0xae, 0x48, 0x25, 0x90, 0xba, 0x89, 0x21, 0xf9, 0x9e, 0x41, 0x92,
+    0xab, 0x48, 0x14, 0x98, 0x9a, 0x89, 0x80, 0xba, 0x39, 0x93, 0x9c, 0x73, 0x92, 0x8b, 0x43, 0xa0,
+    0x1b, 0x65, 0x23, 0x81, 0xb9, 0x8a, 0x01, 0x32, 0x83, 0xdc, 0x9b, 0x63, 0x35, 0xa1, 0xbc, 0x9b,
+    0x62, 0x25, 0xc8, 0x9d, 0x20, 0x12, 0x08, 0x00, 0xc9, 0xbc, 0x29, 0x24, 0x80, 0x8a, 0x08, 0x80,
+    0xc8, 0x9c, 0x54, 0xc1, 0xbd, 0x40, 0x14, 0x98, 0x8a, 0x30, 0x24, 0x80, 0x9a, 0x30, 0x16, 0xe9,
+    0x8a, 0x54, 0x81, 0x9a, 0x18, 0x02, 0xda, 0x8a, 0x32, 0x12, 0xa0, 0xbb, 0x61, 0x83, 0xaa, 0xaa,
+    0x9b, 0x75, 0x83, 0xcc, 0x0a, 0x20, 0x23, 0xd9, 0x9c, 0x22, 0x81, 0x0a, 0xfd, 0xff, 0x2f, 0x00,
+    0x32, 0x35, 0x92, 0xdd, 0x19, 0x34, 0x81, 0x08, 0x02, 0xba, 0x60, 0xa2, 0xad, 0x42, 0x83, 0xa9,
+    0xcd, 0x8c, 0x32, 0x91, 0x0a, 0x12, 0xba, 0x20, 0x35, 0x82, 0xfe, 0x1a, 0x34, 0xa0, 0x9a, 0x80,
+    0x88, 0x11, 0xc9, 0x38, 0x25, 0x99, 0x89, 0x80, 0x09, 0x02, 0x00, 0x53, 0x34, 0x13, 0xd8, 0xbe,
+    0x39, 0x15, 0xca, 0x0b, 0x90, 0xab, 0x53, 0xe8, 0x9c, 0x11, 0xb9, 0x0b, 0x12, 0x18, 0x53, 0x21,
+    0x32, 0xa2, 0xbd, 0x1a, 0x65, 0x23, 0xb8, 0xab, 0x89, 0x20, 0x24, 0xfc, 0x9c, 0x51, 0x12, 0x98,
+    0x98, 0xdb, 0x2a, 0x25, 0xda, 0x9a, 0x00, 0x30, 0x24, 0xfa, 0x8a, 0x01, 0x98, 0x28, 0x80, 0x30,
+    0x24, 0x99, 0x88, 0xea, 0x8a, 0x64, 0x13, 0xa8, 0x9b, 0x32, 0xa3, 0xcd, 0x28, 0x35, 0xa1, 0xad,
+    0x30, 0x25, 0x81, 0xcb, 0x9b, 0x31, 0x02, 0xda, 0x9a, 0x52, 0x83, 0xdc, 0x8b, 0x22, 0x83, 0xcb,
+    0xa5, 0xf7, 0x31, 0x00, 0x9b, 0x53, 0x13, 0xb8, 0x0b, 0x64, 0x91, 0xbc, 0x18, 0x43, 0x12, 0xd8,
+    0xad, 0x28, 0x14, 0xa0, 0x8a, 0x31, 0x35, 0xb1, 0x9e, 0x50, 0x13, 0x80, 0x99, 0x89, 0x21, 0x81,
+    0xac, 0x88, 0x21, 0x82, 0xbb, 0x71, 0x14, 0xba, 0x09, 0x82, 0xbb, 0x70, 0x04, 0xba, 0x58, 0x82,
+    0xae, 0x10, 0xb1, 0xbc, 0xa9, 0x19, 0x57, 0xa1, 0xad, 0x10, 0x11, 0x90, 0xba, 0x09, 0x52, 0x23,
+    0xb8, 0xbd, 0x09, 0xa8, 0xac, 0x62, 0x82, 0xad, 0x62, 0x13, 0xba, 0x09, 0x98, 0x9a, 0x72, 0x13,
+    0xba, 0x0c, 0x35, 0xa2, 0xbc, 0x18, 0x23, 0x32, 0x22, 0xfb, 0x9c, 0x41, 0x13, 0xb8, 0xaa, 0x41,
+    0x23, 0xba, 0x1a, 0x82, 0xac, 0x72, 0x83, 0x9a, 0x22, 0xf9, 0xbc, 0x19, 0x32, 0xa0, 0x9b, 0x20,
+    0x55, 0x34, 0xb8, 0x9e, 0x30, 0x13, 0xc9, 0xac, 0x28, 0x13, 0xa9, 0xdb, 0xdb, 0x19, 0x33, 0xc1,
+    0xbd, 0x30, 0x05, 0xcc, 0xf7, 0xf4, 0x36, 0x00, 0x19, 0x34, 0x91, 0x9b, 0x21, 0x81, 0xcb, 0x28,
+    0x22, 0x11, 0x12, 0xfa, 0xcc, 0x9a, 0x52, 0x23, 0x02, 0xa0, 0xbe, 0x18, 0x91, 0xac, 0x63, 0x23,
+    0x99, 0xcb, 0x8a, 0x20, 0x11, 0x44, 0xb1, 0xbf, 0x30, 0x24, 0xa0, 0x9b, 0x31, 0x25, 0x12, 0x02,
+    0xea, 0x8a, 0x32, 0xa1, 0x9a, 0x40, 0x35, 0x24, 0x80, 0xda, 0xac, 0x10, 0xa8, 0x68, 0x26, 0xc9,
+    0xac, 0x11, 0x02, 0xa8, 0x28, 0x25, 0xc8, 0x1a, 0x44, 0xa0, 0x9a, 0x88, 0x99, 0x52, 0x02, 0xdb,
+    0x89, 0x22, 0x91, 0xac, 0x19, 0x53, 0x03, 0xec, 0x9b, 0x21, 0x43, 0x02, 0xda, 0x1a, 0x34, 0xc0,
+    0xae, 0x18, 0x03, 0x88, 0x61, 0x02, 0xeb, 0x9a, 0x20, 0x21, 0x80, 0xaa, 0x8a, 0x08, 0x21, 0xb0,
+    0xac, 0x99, 0x88, 0x11, 0xa0, 0xce, 0x8a, 0x54, 0x04, 0xc9, 0xbc, 0x9b, 0x61, 0x23, 0xa8, 0x18,
+    0x25, 0x92, 0xfb, 0xab, 0x18, 0x21, 0x53, 0x03, 0x90, 0xfe, 0x2e, 0x00, 0xeb, 0x8a, 0x32, 0x22,
+    0xa8, 0xad, 0x29, 0x22, 0x00, 0x73, 0x82, 0xbd, 0x0b, 0x22, 0x91, 0x9a, 0x38, 0x37, 0x90, 0x9c,
+    0x11, 0x82, 0xca, 0xbd, 0x19, 0x01, 0x20, 0x26, 0xb0, 0x9c, 0x21, 0x25, 0x83, 0xcc, 0x8a, 0x01,
+    0x22, 0x02, 0x89, 0x01, 0xee, 0x8b, 0x13, 0xb9, 0x50, 0x13, 0x09, 0x74, 0x16, 0xb0, 0xbc, 0x28,
+    0x33, 0x12, 0x00, 0x00, 0x90, 0xcb, 0x19, 0x23, 0xf9, 0xbd, 0x28, 0x37, 0x91, 0xac, 0x18, 0x22,
+    0xc8, 0xbc, 0x40, 0x24, 0x80, 0x20, 0x24, 0xa1, 0xbe, 0x0a, 0x01, 0xbb, 0x40, 0x24, 0x90, 0x88,
+    0xa8, 0x99, 0xcc, 0x49, 0x34, 0x90, 0xaa, 0x89, 0x73, 0x02, 0x89, 0x23, 0xfb, 0x0d, 0x22, 0x98,
+    0x08, 0xa8, 0x09, 0x03, 0xdc, 0x8a, 0x98, 0x48, 0x35, 0x82, 0x00, 0xa8, 0x0b, 0x22, 0xfb, 0xbc,
+    0xcb, 0x0a, 0x52, 0x82, 0xaa, 0xaa, 0xac, 0x28, 0x12, 0x63, 0x14, 0x98, 0xe0, 0xfe, 0x27, 0x00,
+    0x00, 0xfd, 0x9e, 0x41, 0x23, 0x99, 0x89, 0x80, 0x00, 0x21, 0x81, 0xda, 0x8b, 0x74, 0x12, 0xc9,
+    0xac, 0x29, 0x43, 0xb0, 0xac, 0x21, 0x02, 0x89, 0x20, 0x33, 0xa2, 0xbe, 0x1b, 0x55, 0x02, 0xaa,
+    0x39, 0x34, 0x01, 0x99, 0x99, 0x42, 0x92, 0x1a, 0x45, 0x02, 0x18, 0x42, 0x23, 0xfd, 0xad, 0x18,
+    0x01, 0x30, 0x25, 0xa0, 0xab, 0x29, 0x37, 0x82, 0xcb, 0x89, 0x10, 0x12, 0xb0, 0xbb, 0xdc, 0xac,
+    0x30, 0x13, 0xbb, 0x59, 0x36, 0x23, 0xc8, 0xbc, 0x19, 0x23, 0xea, 0xaa, 0x00, 0x88, 0xba, 0xbf,
+    0x9b, 0x30, 0x54, 0x82, 0xdb, 0x09, 0x00, 0x22, 0x81, 0xdb, 0x18, 0x01, 0x9a, 0xdb, 0x8c, 0x52,
+    0x91, 0x09, 0x54, 0x82, 0xba, 0x8b, 0x73, 0x13, 0x98, 0x9a, 0x8a, 0x64, 0x93, 0xce, 0x29, 0x33,
+    0x91, 0xaa, 0xab, 0x72, 0x23, 0xb9, 0x1a, 0x34, 0xb0, 0x9d, 0x20, 0x91, 0xad, 0x20, 0x34, 0x00,
+    0x6a, 0x05, 0x2c, 0x00, 0xca, 0xab, 0x30, 0x34, 0x12, 0x88, 0x99, 0xa8, 0xef, 0xab, 0x09, 0x00,
+    0x88, 0x19, 0x21, 0xd8, 0x2a, 0x27, 0xa1, 0xad, 0xbb, 0x09, 0x42, 0x92, 0xba, 0x71, 0x25, 0xb9,
+    0xad, 0x21, 0x82, 0x89, 0x20, 0x44, 0x23, 0xb1, 0xce, 0x8a, 0x62, 0x12, 0x9a, 0x19, 0x33, 0x02,
+    0xd9, 0xbd, 0x28, 0x02, 0xcd, 0x8a, 0x11, 0x31, 0x15, 0xc9, 0x9c, 0x10, 0x80, 0x88, 0x08, 0x41,
+    0x02, 0xfc, 0x9a, 0x30, 0x13, 0xa9, 0x2a, 0x57, 0x81, 0xcb, 0x18, 0x23, 0x02, 0x00, 0xa0, 0xeb,
+    0x9b, 0x99, 0x88, 0x31, 0x44, 0x02, 0xd9, 0xbb, 0xca, 0x8a, 0x11, 0x11, 0x64, 0x02, 0xb9, 0xc9,
+    0xbc, 0x71, 0x03, 0xaa, 0x10, 0x01, 0x31, 0xe1, 0x9d, 0x61, 0x02, 0x88, 0x88, 0x89, 0x20, 0x23,
+    0x01, 0xb8, 0x0b, 0x47, 0xb0, 0xcf, 0x89, 0x31, 0x24, 0x90, 0x89, 0x28, 0x24, 0xc8, 0xad, 0x89,
+    0x11, 0x43, 0x81, 0x9a, 0x06, 0xfc, 0x29, 0x00, 0x53, 0x23, 0x81, 0xcc, 0x2a, 0x26, 0x90, 0x38,
+    0x27, 0x81, 0xaa, 0x89, 0x90, 0xaa, 0x50, 0x04, 0x99, 0x09, 0xb9, 0x0a, 0x14, 0xf9, 0xad, 0x20,
+    0x23, 0xc9, 0x0b, 0x54, 0x82, 0xcb, 0x29, 0x24, 0xb9, 0x8c, 0x54, 0x33, 0x11, 0x80, 0xca, 0xcb,
+    0x89, 0x41, 0x24, 0x80, 0x9a, 0x08, 0xc9, 0xcc, 0x8a, 0x12, 0xba, 0x4a, 0x25, 0xb8, 0xab, 0x99,
+    0x08, 0xfb, 0x8b, 0x34, 0x90, 0x40, 0x25, 0xd9, 0x9a, 0x41, 0x15, 0xda, 0x0b, 0x44, 0x02, 0x99,
+    0x99, 0x18, 0x02, 0xb9, 0x0a, 0x10, 0x32, 0x35, 0x82, 0xda, 0xbd, 0x0a, 0x91, 0xdb, 0x89, 0x21,
+    0x12, 0xd9, 0x9b, 0x21, 0xb8, 0x9c, 0xa9, 0xcd, 0xac, 0x30, 0x37, 0x90, 0x10, 0xa1, 0xbd, 0x48,
+    0x36, 0x13, 0xa9, 0x8b, 0x00, 0xda, 0xbb, 0x29, 0x65, 0x23, 0xa8, 0x0a, 0x22, 0xb0, 0xac, 0x62,
+    0x23, 0x99, 0x28, 0x01, 0x0a, 0x98, 0xbd, 0x20, 0x6d, 0x05, 0x21, 0x00, 0x90, 0x8b, 0x25, 0xb8,
+    0xee, 0xcc, 0x18, 0x03, 0xca, 0x9a, 0xb9, 0x49, 0x27, 0xa8, 0x0a, 0x00, 0x20, 0x83, 0xdf, 0x19,
+    0x23, 0x81, 0x88, 0x80, 0xfb, 0x9c, 0x40, 0x24, 0x88, 0x10, 0x22, 0x80, 0x11, 0xc9, 0x9c, 0x63,
+    0x13, 0xda, 0x8b, 0x21, 0x02, 0x99, 0x98, 0x31, 0x33, 0x98, 0x28, 0x36, 0x23, 0x11, 0x10, 0xf8,
+    0xff, 0x89, 0x42, 0x02, 0xaa, 0x09, 0x82, 0xc9, 0xaa, 0x10, 0x90, 0xbe, 0x9b, 0x80, 0x99, 0x38,
+    0x47, 0xa0, 0xad, 0x09, 0x80, 0xaa, 0x19, 0x42, 0x24, 0xb0, 0xae, 0x19, 0x12, 0x08, 0x10, 0x92,
+    0xdb, 0x3a, 0x25, 0xfa, 0x8c, 0x32, 0x13, 0x98, 0xa9, 0x30, 0x04, 0xbb, 0x50, 0xb1, 0x8d, 0x54,
+    0x11, 0x62, 0x02, 0xb9, 0x09, 0x22, 0x32, 0xa1, 0xad, 0x72, 0x25, 0x80, 0xcb, 0x8b, 0x31, 0x83,
+    0xcb, 0x28, 0x23, 0x20, 0x34, 0xf9, 0xad, 0x31, 0x23, 0xc9, 0xac, 0x51, 0x38, 0x04, 0x2f, 0x00,
+    0x04, 0xa9, 0x38, 0x83, 0xbe, 0x18, 0x82, 0xba, 0x08, 0x31, 0x47, 0x91, 0xbc, 0x09, 0x98, 0xab,
+    0x80, 0xa8, 0x99, 0xda, 0x29, 0x15, 0xea, 0x0a, 0x23, 0xb9, 0x0b, 0x33, 0x11, 0x10, 0x62, 0x24,
+    0xfb, 0xaf, 0x08, 0x90, 0x20, 0x25, 0xa0, 0xaa, 0x08, 0x10, 0xc8, 0x8c, 0x63, 0x02, 0x89, 0x90,
+    0xbc, 0x89, 0x89, 0x51, 0xd0, 0x9c, 0x52, 0x81, 0x00, 0xa0, 0x8a, 0x14, 0xfb, 0x1a, 0x32, 0x02,
+    0xa8, 0x9b, 0x55, 0x82, 0x8b, 0x53, 0xa1, 0x9b, 0x71, 0x12, 0xa8, 0x8a, 0x31, 0xa1, 0xbf, 0x38,
+    0x16, 0xa8, 0x1a, 0x36, 0x81, 0x09, 0x88, 0xbc, 0x9b, 0x89, 0x51, 0x35, 0x81, 0x08, 0xd9, 0xab,
+    0x32, 0xb1, 0x9b, 0x42, 0x02, 0x91, 0xba, 0x38, 0x03, 0x1a, 0x77, 0x92, 0xcc, 0x8a, 0x42, 0x03,
+    0x08, 0x33, 0xe1, 0xac, 0x88, 0x21, 0x55, 0x01, 0x9a, 0x10, 0xc9, 0x9b, 0x01, 0x99, 0x61, 0x13,
+    0x1e, 0x03, 0x25, 0x00, 0xfb, 0xad, 0x1a, 0x42, 0x02, 0xba, 0xac, 0x9a, 0x11, 0x01, 0x18, 0x65,
+    0x12, 0xa9, 0xac, 0x8a, 0x22, 0xb2, 0x8c, 0x76, 0x12, 0xba, 0xab, 0x08, 0x00, 0x01, 0x10, 0x01,
+    0xba, 0x48, 0x15, 0xeb, 0x8a, 0x32, 0x13, 0xb9, 0xae, 0x41, 0x26, 0xa9, 0x8a, 0x43, 0xb0, 0xad,
+    0x00, 0x42, 0x24, 0x81, 0x9a, 0xba, 0x1b, 0x27, 0xd8, 0x8b, 0x43, 0x12, 0x08, 0x99, 0x41, 0x14,
+    0xb9, 0x39, 0x82, 0xbb, 0x40, 0x22, 0x54, 0x03, 0xfb, 0x8a, 0x10, 0xca, 0x0a, 0x35, 0x33, 0x23,
+    0xd0, 0xac, 0xb9, 0x9c, 0x41, 0xb1, 0x8e, 0x42, 0x81, 0xab, 0x99, 0x10, 0x33, 0x33, 0xc1, 0xce,
+    0x38, 0x26, 0xa8, 0xab, 0x28, 0x80, 0xbc, 0x8a, 0xba, 0x73, 0x06, 0xba, 0x0a, 0x03, 0xdb, 0xbb,
+    0x19, 0x53, 0xb8, 0xac, 0xa9, 0xce, 0x28, 0x44, 0x91, 0x99, 0x10, 0x00, 0x98, 0x88, 0x31, 0x14,
+    0xeb, 0x9a, 0xba, 0xae, 0xc8, 0xf3, 0x29, 0x00, 0x51, 0x24, 0x12, 0x01, 0xca, 0x9b, 0x11, 0x01,
+    0x01, 0xda, 0x9b, 0x32, 0xb0, 0xad, 0x51, 0x46, 0x03, 0xa9, 0x89, 0x11, 0x10, 0x43, 0x34, 0x82,
+    0xa9, 0x89, 0x88, 0x71, 0x36, 0x22, 0x23, 0x12, 0x12, 0xe9, 0x9c, 0x31, 0x24, 0x43, 0xc8, 0xad,
+    0x30, 0x81, 0x9a, 0x20, 0x91, 0xdc, 0x9b, 0x51, 0x43, 0x22, 0x33, 0x23, 0x91, 0xcc, 0x9b, 0x10,
+    0x00, 0x20, 0x04, 0xfe, 0xac, 0x09, 0x98, 0xa9, 0x28, 0x02, 0xaa, 0x2a, 0x23, 0x98, 0x9a, 0xaa,
+    0x88, 0xd1, 0xef, 0xab, 0x31, 0x82, 0xac, 0x18, 0xfb, 0x9d, 0x11, 0x00, 0x32, 0x35, 0x33, 0x03,
+    0xee, 0x9b, 0x21, 0x90, 0x9c, 0x31, 0x93, 0x9b, 0x73, 0x24, 0x88, 0x09, 0x31, 0x12, 0x99, 0xaa,
+    0x52, 0x26, 0xa1, 0xce, 0x8a, 0x31, 0x82, 0x08, 0x35, 0x82, 0x20, 0x83, 0xce, 0x19, 0x12, 0xdb,
+    0x8b, 0x90, 0xfb, 0xac, 0x10, 0x32, 0x90, 0x9a, 0x45, 0x00, 0x25, 0x00, 0x00, 0xb9, 0x8a, 0x31,
+    0x25, 0xf8, 0xac, 0x10, 0xfb, 0x9e, 0x30, 0x12, 0x10, 0x90, 0x89, 0x42, 0x91, 0xab, 0x50, 0x32,
+    0x00, 0xdb, 0x9d, 0x10, 0x23, 0x43, 0x03, 0xbc, 0x71, 0x04, 0xba, 0x40, 0x14, 0xba, 0x9b, 0x18,
+    0x90, 0xca, 0x39, 0x47, 0x02, 0xaa, 0x19, 0x22, 0xe9, 0xac, 0x18, 0xa0, 0xab, 0x10, 0xe9, 0x8a,
+    0x32, 0xa0, 0x99, 0xea, 0x9b, 0x00, 0xba, 0x3a, 0x57, 0x12, 0xa0, 0xcb, 0x18, 0x33, 0x20, 0x66,
+    0x02, 0xb9, 0x10, 0x82, 0xcb, 0x18, 0x24, 0x91, 0xdc, 0x8b, 0x11, 0x02, 0x21, 0x21, 0x00, 0xa8,
+    0xcc, 0xca, 0xae, 0x72, 0x14, 0xd9, 0x9a, 0x80, 0xa8, 0x9a, 0x41, 0x33, 0x80, 0xba, 0xbf, 0x2a,
+    0x14, 0xea, 0x8a, 0x01, 0x20, 0x13, 0xcc, 0x2a, 0x34, 0x12, 0x90, 0xaa, 0x62, 0x12, 0x20, 0x24,
+    0xa9, 0x20, 0xa3, 0xce, 0x8a, 0x50, 0x36, 0x91, 0xab, 0x51, 0x82, 0xab, 0xe1, 0xfe, 0x29, 0x00,
+    0x20, 0x92, 0xbf, 0x09, 0x90, 0xaa, 0x88, 0xcd, 0x1a, 0x24, 0xa8, 0x19, 0x88, 0x0a, 0xb2, 0xdf,
+    0x50, 0x03, 0xba, 0x20, 0xc0, 0x0b, 0x36, 0x01, 0x20, 0x23, 0xb9, 0x8c, 0x32, 0x03, 0xc9, 0x9a,
+    0x80, 0x98, 0x80, 0x70, 0x77, 0x82, 0xa9, 0x10, 0x81, 0x09, 0x43, 0x11, 0x43, 0xd0, 0x9c, 0x31,
+    0xc8, 0xac, 0x41, 0x14, 0xb9, 0x9b, 0x01, 0xba, 0x9c, 0x08, 0x80, 0xec, 0x8a, 0x33, 0x91, 0x38,
+    0x27, 0xb8, 0xbd, 0x0a, 0x21, 0xa9, 0x39, 0x27, 0x80, 0xa8, 0xbd, 0x0b, 0x12, 0x89, 0x66, 0x13,
+    0x99, 0x20, 0x82, 0x9b, 0x62, 0x02, 0x08, 0xd9, 0x9d, 0x53, 0x83, 0x89, 0x32, 0x91, 0x09, 0xd8,
+    0x9c, 0x64, 0x02, 0x98, 0x00, 0x21, 0x00, 0xcb, 0x0a, 0x42, 0x22, 0x23, 0x02, 0xb9, 0xdd, 0x9a,
+    0x80, 0xfb, 0x9d, 0x31, 0xa1, 0x9b, 0x52, 0x81, 0x9b, 0x9a, 0x8b, 0x43, 0xd1, 0x9c, 0x10, 0x90,
+    0x72, 0x00, 0x22, 0x00, 0xaa, 0xba, 0x9b, 0x11, 0x31, 0x36, 0xc0, 0x48, 0x16, 0xfb, 0x8b, 0x33,
+    0xa1, 0x9d, 0x41, 0x82, 0xab, 0x41, 0x83, 0x9b, 0x52, 0x92, 0x18, 0x04, 0xec, 0x19, 0x23, 0x80,
+    0x64, 0x82, 0xab, 0x30, 0x82, 0x0a, 0x36, 0x91, 0x09, 0x33, 0x12, 0x33, 0xd8, 0xbf, 0x28, 0x91,
+    0xcc, 0x19, 0x33, 0x43, 0x43, 0x03, 0xc9, 0xbe, 0x8b, 0x20, 0x22, 0x46, 0x02, 0xb9, 0x99, 0xa9,
+    0xbb, 0xac, 0x73, 0x07, 0xa8, 0x28, 0x12, 0xcb, 0x89, 0x98, 0x9a, 0xea, 0x8a, 0x31, 0x80, 0x00,
+    0x80, 0x99, 0xef, 0xac, 0x20, 0x01, 0x9a, 0x10, 0xa9, 0x8a, 0xc9, 0xad, 0x71, 0x14, 0xb9, 0x29,
+    0x04, 0xa8, 0x09, 0xc9, 0x9c, 0x81, 0xa9, 0x18, 0x98, 0x71, 0x15, 0xa9, 0x09, 0xe9, 0xac, 0x20,
+    0x13, 0x00, 0x80, 0xa8, 0xa9, 0x8c, 0x52, 0x82, 0x50, 0x03, 0xcd, 0x40, 0x83, 0xaf, 0x18, 0x93,
+    0xdb, 0x08, 0x80, 0x20, 0xcc, 0xf6, 0x28, 0x00, 0x23, 0x00, 0x52, 0x90, 0x0c, 0x32, 0xe9, 0x1b,
+    0x36, 0x81, 0x0a, 0x52, 0x82, 0xca, 0x0a, 0x53, 0x82, 0x9b, 0x73, 0x02, 0x99, 0x20, 0xa1, 0xac,
+    0x89, 0x10, 0x11, 0xea, 0x2a, 0x37, 0xa1, 0xbc, 0x20, 0x23, 0xd8, 0x0b, 0x54, 0x81, 0x8a, 0x10,
+    0x98, 0x98, 0xaa, 0x60, 0x24, 0x98, 0x41, 0x83, 0xbb, 0x18, 0x32, 0x15, 0xfa, 0x8c, 0x11, 0xa8,
+    0x1b, 0x33, 0x12, 0x01, 0xfc, 0xad, 0x31, 0x25, 0x81, 0x90, 0x88, 0x80, 0xdd, 0x0a, 0x02, 0x09,
+    0x34, 0xf8, 0x9c, 0x10, 0xa8, 0x9b, 0xaa, 0x9a, 0x22, 0x90, 0x0b, 0x52, 0x12, 0x90, 0xc9, 0xab,
+    0x62, 0x93, 0xce, 0x9a, 0xab, 0x19, 0x24, 0xc9, 0x0b, 0x65, 0x83, 0xcb, 0x39, 0x25, 0xc9, 0x8a,
+    0x22, 0x91, 0xa9, 0x9b, 0x08, 0x88, 0x30, 0x05, 0xde, 0x1a, 0x53, 0x90, 0x9b, 0x52, 0x91, 0xbd,
+    0x28, 0x14, 0x01, 0x01, 0xea, 0x0a, 0x23, 0xc8, 0x99, 0xf7, 0x27, 0x00, 0x8c, 0x31, 0x12, 0x08,
+    0x42, 0xb0, 0xaf, 0x72, 0x83, 0xca, 0x28, 0x12, 0xa9, 0x09, 0x64, 0x13, 0xb8, 0x0a, 0x11, 0xba,
+    0x29, 0x27, 0x02, 0x18, 0x42, 0x02, 0x98, 0xbb, 0x48, 0x15, 0xca, 0x50, 0x24, 0x81, 0x98, 0xac,
+    0x20, 0xb1, 0xaf, 0x31, 0x92, 0x0b, 0x36, 0x92, 0xbb, 0x18, 0x98, 0xab, 0x71, 0x36, 0x82, 0xaa,
+    0x18, 0x80, 0x89, 0xb8, 0x9d, 0x73, 0x83, 0x9c, 0x41, 0x92, 0xbc, 0xab, 0x08, 0x22, 0xcb, 0x49,
+    0x06, 0xa9, 0x51, 0x93, 0xdd, 0x09, 0x80, 0x99, 0x00, 0x80, 0x8a, 0x32, 0xf9, 0xac, 0x18, 0xa9,
+    0x0a, 0x33, 0xa0, 0xbc, 0x8a, 0x20, 0xd9, 0xbe, 0x89, 0x10, 0x43, 0x23, 0x62, 0x13, 0xfb, 0x9b,
+    0x80, 0xb9, 0x8b, 0x21, 0x42, 0x44, 0xd8, 0x9c, 0x20, 0x81, 0x30, 0x24, 0x80, 0x43, 0xc0, 0xac,
+    0x18, 0x10, 0x81, 0xbf, 0x58, 0x25, 0x98, 0x38, 0x24, 0xa8, 0x38, 0x25, 0xf7, 0x01, 0x27, 0x00,
+    0x88, 0x28, 0x03, 0xbb, 0x51, 0x93, 0x8b, 0x10, 0xda, 0xaa, 0x40, 0x77, 0x12, 0x89, 0x10, 0x98,
+    0x19, 0x14, 0xda, 0xbb, 0x99, 0x20, 0x80, 0x51, 0x27, 0xa0, 0x9c, 0x88, 0xba, 0x0b, 0x73, 0x12,
+    0x98, 0xaa, 0xba, 0xfb, 0xab, 0x19, 0x80, 0x8b, 0x44, 0x92, 0x88, 0xd8, 0xad, 0x21, 0xc1, 0xad,
+    0x08, 0x43, 0x14, 0xba, 0x48, 0x84, 0xcc, 0x0a, 0x80, 0x9a, 0x32, 0x22, 0x00, 0x89, 0x41, 0x82,
+    0xbc, 0x70, 0x35, 0x83, 0x99, 0x31, 0xb2, 0xdf, 0x19, 0x11, 0x01, 0x23, 0x90, 0x09, 0x64, 0x13,
+    0x80, 0x20, 0xa8, 0xbe, 0x10, 0xc1, 0x9d, 0x41, 0x03, 0xca, 0x9a, 0x20, 0x93, 0xcc, 0x39, 0x14,
+    0x00, 0x22, 0xf9, 0x8b, 0x31, 0xa0, 0xbd, 0x9c, 0x08, 0xea, 0xac, 0x20, 0x14, 0x90, 0x9a, 0xaa,
+    0x8b, 0x62, 0x13, 0x21, 0x37, 0x83, 0xac, 0x09, 0x11, 0x80, 0x20, 0x43, 0x03, 0x11, 0x22, 0xb1,
+    0x1f, 0x01, 0x19, 0x00, 0xef, 0x29, 0x24, 0xdb, 0x49, 0x15, 0xa9, 0x31, 0x03, 0xab, 0x88, 0xbb,
+    0x48, 0xb1, 0xae, 0x21, 0x90, 0x88, 0xb8, 0xbc, 0xa8, 0xec, 0xab, 0x18, 0x45, 0x01, 0xaa, 0x9a,
+    0xa9, 0xaa, 0x28, 0x80, 0x61, 0x26, 0xda, 0x39, 0x57, 0x91, 0x9a, 0x88, 0xa8, 0x9a, 0x30, 0x54,
+    0x13, 0x21, 0x23, 0xe8, 0xac, 0x51, 0x03, 0x99, 0x31, 0xb1, 0x9e, 0x21, 0xa0, 0xaa, 0xa0, 0xce,
+    0x89, 0x00, 0x31, 0x33, 0xc8, 0xad, 0xa9, 0xca, 0x9a, 0x21, 0x26, 0x32, 0x12, 0xba, 0x29, 0x15,
+    0x09, 0x56, 0x03, 0x08, 0x32, 0xc8, 0x9a, 0x32, 0x23, 0xb8, 0xad, 0x32, 0x24, 0x31, 0xa1, 0xad,
+    0x09, 0xeb, 0x09, 0x90, 0x8d, 0x00, 0xdd, 0x2a, 0x13, 0xdd, 0x8a, 0x98, 0x9c, 0x40, 0x13, 0x99,
+    0x50, 0x23, 0xa8, 0x99, 0x80, 0x43, 0xe1, 0xae, 0x21, 0x82, 0x29, 0x47, 0x81, 0x88, 0x98, 0x8a,
+    0x31, 0x11, 0x65, 0x83, 0x8d, 0x07, 0x28, 0x00, 0xda, 0x09, 0xa8, 0x89, 0x81, 0x9a, 0x63, 0xa2,
+    0x9d, 0x10, 0xc0, 0xad, 0x89, 0x88, 0x08, 0x31, 0x43, 0xb0, 0xae, 0x18, 0x91, 0x9d, 0x21, 0x01,
+    0x61, 0x25, 0x88, 0x18, 0xa9, 0x68, 0x25, 0xa8, 0x0a, 0x13, 0x18, 0x54, 0xa1, 0xad, 0x88, 0xca,
+    0x8a, 0x23, 0x81, 0xa9, 0xab, 0x51, 0xc2, 0xaf, 0x19, 0xa0, 0x0b, 0x33, 0xa8, 0x3a, 0x13, 0xfb,
+    0xab, 0x8a, 0x31, 0xb1, 0x8c, 0x64, 0x81, 0xaa, 0x89, 0xa8, 0xca, 0xdd, 0x1a, 0x56, 0x13, 0x90,
+    0x88, 0x00, 0x90, 0xbc, 0x39, 0x36, 0x81, 0x8a, 0x10, 0x98, 0x28, 0x24, 0xa9, 0x60, 0x04, 0xca,
+    0x0a, 0x22, 0xa1, 0xcd, 0xbc, 0xcb, 0xba, 0x0a, 0x63, 0x82, 0xcb, 0x99, 0xd9, 0xbb, 0x21, 0x24,
+    0x02, 0xb0, 0xcc, 0x89, 0x98, 0xca, 0x9b, 0x31, 0xb0, 0x8d, 0x54, 0x81, 0x18, 0xb0, 0xae, 0x19,
+    0x11, 0x73, 0x33, 0x21, 0x23, 0xfb, 0x0a, 0x35, 0x71, 0xfb, 0x26, 0x00, 0x82, 0xaa, 0x8a, 0x43,
+    0x24, 0x11, 0x80, 0x08, 0x89, 0x48, 0x36, 0x12, 0x72, 0x34, 0x11, 0xb8, 0xbe, 0x19, 0x14, 0xa8,
+    0x8b, 0x11, 0x80, 0x50, 0x25, 0xb0, 0xbc, 0xba, 0xbc, 0x50, 0x24, 0x98, 0x21, 0xa2, 0xbe, 0xaa,
+    0xba, 0x28, 0x25, 0x12, 0x92, 0xdf, 0x8a, 0x00, 0xba, 0x8a, 0xc8, 0x9c, 0x53, 0x02, 0x18, 0x33,
+    0xd9, 0xcc, 0x9b, 0x20, 0x33, 0x11, 0x41, 0x25, 0xb0, 0xbe, 0x19, 0x11, 0x00, 0x80, 0xdb, 0x50,
+    0x37, 0xa8, 0x8b, 0x52, 0x91, 0xac, 0x08, 0x53, 0x34, 0x80, 0x09, 0x22, 0x91, 0xbb, 0xab, 0x50,
+    0x26, 0xa0, 0x9a, 0x98, 0xcb, 0x48, 0x26, 0x91, 0x38, 0x35, 0xa1, 0x9c, 0x19, 0x21, 0x90, 0xae,
+    0x29, 0x02, 0x0a, 0x73, 0x81, 0x9a, 0x00, 0xea, 0xbb, 0x41, 0x24, 0x80, 0x10, 0xa8, 0x0b, 0x36,
+    0xa1, 0x8c, 0x53, 0x03, 0xa8, 0x9b, 0x20, 0xe9, 0xcd, 0xa9, 0xa9, 0x89, 0x74, 0x00, 0x22, 0x00,
+    0x01, 0x11, 0x90, 0xde, 0xac, 0x9a, 0x11, 0x12, 0x01, 0x90, 0x0a, 0x24, 0xea, 0x1a, 0x83, 0xbc,
+    0x51, 0xe1, 0xac, 0x40, 0x12, 0xa9, 0xbc, 0xab, 0xa9, 0x09, 0x52, 0x33, 0x81, 0xdb, 0x8a, 0x98,
+    0xab, 0x62, 0x13, 0x21, 0xc0, 0xbf, 0x50, 0x14, 0x98, 0x99, 0xa8, 0x9a, 0x51, 0x34, 0xb0, 0xbd,
+    0x09, 0xb9, 0xbd, 0x38, 0x27, 0x01, 0x88, 0x10, 0x81, 0x18, 0x44, 0xb0, 0xae, 0x28, 0x23, 0x22,
+    0x35, 0x01, 0x20, 0x13, 0xfb, 0x0c, 0x54, 0x13, 0x81, 0x80, 0x98, 0x80, 0x01, 0x11, 0x80, 0x99,
+    0x43, 0x22, 0x72, 0x36, 0x02, 0xcb, 0xbb, 0xab, 0x0a, 0x71, 0x44, 0x02, 0x99, 0xaa, 0x99, 0x19,
+    0x63, 0x23, 0x01, 0x08, 0xc9, 0x9b, 0x30, 0x90, 0xbb, 0xca, 0xdc, 0x8a, 0x66, 0x34, 0x90, 0x9a,
+    0x88, 0xb9, 0xa9, 0xba, 0x69, 0x26, 0x81, 0x00, 0xa8, 0x9d, 0x30, 0x12, 0x31, 0x13, 0x08, 0x44,
+    0x9e, 0x08, 0x1d, 0x00, 0x81, 0x8a, 0xda, 0xbc, 0xeb, 0xad, 0x38, 0x34, 0x80, 0x08, 0xa9, 0xec,
+    0xbc, 0x19, 0x33, 0x80, 0x00, 0xb8, 0x8c, 0x22, 0xf9, 0xac, 0x8a, 0x88, 0x80, 0xaa, 0x9b, 0x20,
+    0xb1, 0xff, 0x9d, 0x88, 0x11, 0x31, 0x02, 0xa8, 0xa9, 0xcc, 0x8a, 0x00, 0x18, 0x75, 0x82, 0xca,
+    0x09, 0x02, 0xa8, 0x9a, 0x20, 0x90, 0xac, 0x42, 0x02, 0x9c, 0x19, 0xca, 0xcd, 0x8a, 0x21, 0x55,
+    0x43, 0x91, 0xba, 0x89, 0x09, 0x98, 0xbe, 0x50, 0x15, 0xcb, 0x0a, 0x12, 0xaa, 0x49, 0x81, 0x8a,
+    0x62, 0x43, 0x01, 0xaa, 0x49, 0xb1, 0xcf, 0x89, 0x90, 0x40, 0x27, 0x81, 0x98, 0x08, 0x89, 0x00,
+    0x10, 0x34, 0x25, 0x91, 0xa9, 0x09, 0x33, 0x03, 0x80, 0x53, 0x15, 0xa8, 0x40, 0x37, 0xa0, 0xce,
+    0x09, 0x22, 0xa0, 0x0a, 0x54, 0x91, 0x9a, 0x88, 0xaa, 0x19, 0x34, 0x22, 0x11, 0x88, 0xa8, 0x1b,
+    0x74, 0x90, 0x8b, 0x44, 0x25, 0x04, 0x20, 0x00, 0x91, 0xdb, 0x8a, 0x31, 0xb1, 0xaf, 0x20, 0x23,
+    0x42, 0x13, 0x99, 0xa8, 0xb9, 0x90, 0xfd, 0x8a, 0x13, 0xd8, 0x0a, 0x21, 0x98, 0xa9, 0x19, 0xcb,
+    0xdf, 0x9a, 0x09, 0x32, 0xa1, 0xcf, 0x89, 0x98, 0x9a, 0x08, 0x10, 0xb8, 0xcf, 0x9a, 0x10, 0x42,
+    0x12, 0xca, 0xcc, 0xbb, 0x0a, 0x44, 0x31, 0x22, 0xeb, 0xac, 0x00, 0x00, 0x54, 0x13, 0xa8, 0x28,
+    0x12, 0xca, 0xbc, 0x89, 0x01, 0xca, 0x0a, 0x22, 0xa8, 0x72, 0x47, 0xa8, 0x8a, 0x42, 0x24, 0x12,
+    0x11, 0x33, 0x81, 0xbc, 0x9b, 0x08, 0x99, 0x89, 0x57, 0x12, 0x00, 0x42, 0x11, 0x99, 0xcb, 0x19,
+    0x36, 0x01, 0x11, 0x82, 0xbc, 0xbb, 0x09, 0x01, 0xbb, 0x72, 0x86, 0x09, 0x73, 0x91, 0x9b, 0x88,
+    0x99, 0x8a, 0xca, 0x39, 0x37, 0xa1, 0xdd, 0xaa, 0x08, 0xa8, 0xab, 0x09, 0x09, 0x21, 0xca, 0x8b,
+    0xd9, 0xaf, 0x30, 0x82, 0x99, 0xb8, 0x0a, 0x37, 0x6d, 0xfd, 0x1f, 0x00, 0xc0, 0x9a, 0xa0, 0xad,
+    0x10, 0x01, 0x31, 0xa1, 0x0c, 0x47, 0x81, 0x9a, 0x10, 0x44, 0x33, 0x98, 0x30, 0x47, 0x82, 0x00,
+    0x34, 0xb1, 0xad, 0x09, 0x00, 0x10, 0x00, 0x54, 0x34, 0x90, 0x18, 0x00, 0x9a, 0x09, 0x10, 0x63,
+    0x13, 0xdb, 0x08, 0xe1, 0xae, 0x09, 0xa0, 0x9c, 0x40, 0x01, 0x00, 0x81, 0xdc, 0xab, 0xeb, 0xab,
+    0x28, 0x13, 0x80, 0x90, 0xfd, 0xbb, 0x0a, 0x21, 0x22, 0x00, 0x00, 0xc8, 0xbb, 0x08, 0x22, 0xb1,
+    0xbe, 0x0b, 0x29, 0x74, 0x27, 0x90, 0xaa, 0xaa, 0x9b, 0x72, 0x34, 0x21, 0x52, 0x13, 0x90, 0x99,
+    0x88, 0x32, 0xc1, 0xae, 0x28, 0x12, 0x32, 0x03, 0xcc, 0x89, 0xc8, 0xbc, 0x98, 0x98, 0x11, 0xb0,
+    0xbf, 0xba, 0xdd, 0x9a, 0x00, 0x00, 0x73, 0x13, 0xa8, 0xbb, 0xcc, 0x99, 0x98, 0xab, 0x71, 0x23,
+    0x01, 0x12, 0xda, 0x1a, 0x33, 0xa1, 0x60, 0x37, 0x12, 0x00, 0x81, 0xca, 0xa9, 0xfe, 0x21, 0x00,
+    0xad, 0x8a, 0x11, 0x31, 0x63, 0x34, 0x22, 0x82, 0x88, 0x41, 0x03, 0xed, 0x9a, 0x08, 0x88, 0x01,
+    0xc9, 0xbb, 0xcd, 0x9b, 0x43, 0x91, 0x9d, 0x21, 0x02, 0x91, 0xca, 0xbc, 0xad, 0x8a, 0x51, 0x23,
+    0x33, 0x03, 0xe9, 0xbb, 0x89, 0x22, 0x13, 0x63, 0x35, 0x03, 0x98, 0x00, 0x01, 0x80, 0x90, 0xdd,
+    0x0b, 0x76, 0x22, 0x88, 0x10, 0xb0, 0xaf, 0x19, 0x01, 0x18, 0x44, 0x02, 0x88, 0x89, 0xba, 0xcb,
+    0xbb, 0x9b, 0x98, 0xba, 0x38, 0x24, 0x99, 0xba, 0xdf, 0xab, 0x31, 0x34, 0x02, 0xcd, 0x8b, 0x88,
+    0xec, 0xaa, 0x20, 0x54, 0x23, 0x88, 0x31, 0x14, 0xb9, 0x0b, 0x00, 0x10, 0x55, 0x13, 0x22, 0xb0,
+    0xac, 0x42, 0x01, 0x0b, 0x43, 0x11, 0x73, 0x17, 0x80, 0xaa, 0xab, 0x99, 0xa9, 0x1a, 0x65, 0x13,
+    0x81, 0x98, 0x08, 0x31, 0xfa, 0xae, 0x09, 0x11, 0x99, 0xbb, 0xaa, 0xca, 0xac, 0xaa, 0xa9, 0x38,
+    0xbd, 0xfc, 0x19, 0x00, 0x57, 0x13, 0x98, 0xbb, 0x8b, 0xc9, 0xcd, 0x09, 0x33, 0x34, 0x35, 0x13,
+    0x10, 0x90, 0xbe, 0x2a, 0x35, 0x12, 0x12, 0x98, 0x19, 0x33, 0xd9, 0xcb, 0xab, 0x41, 0x37, 0x12,
+    0x21, 0x23, 0xc8, 0xbc, 0x9a, 0x99, 0x52, 0x27, 0x03, 0x90, 0x9a, 0x32, 0x93, 0xdd, 0x89, 0x08,
+    0x08, 0x98, 0x89, 0x31, 0xfa, 0xbe, 0x9a, 0x08, 0x00, 0x99, 0x28, 0x92, 0xce, 0xaa, 0xa8, 0xba,
+    0x8a, 0x1a, 0x43, 0x53, 0x32, 0xe9, 0xad, 0x09, 0xca, 0xad, 0x00, 0x21, 0x31, 0x81, 0xdc, 0xbc,
+    0xaa, 0x19, 0x33, 0x34, 0x35, 0x24, 0x01, 0x01, 0xda, 0xcd, 0x99, 0x30, 0x45, 0x33, 0x24, 0x11,
+    0x08, 0x98, 0xdb, 0x8a, 0x10, 0x32, 0x24, 0x98, 0x9a, 0xb9, 0x8c, 0x89, 0xbd, 0x30, 0x67, 0x43,
+    0x23, 0x80, 0xb9, 0xbd, 0x8a, 0xa9, 0x29, 0x47, 0x02, 0xa9, 0x99, 0x10, 0x98, 0xbb, 0x30, 0x23,
+    0x62, 0x44, 0x21, 0x81, 0x08, 0x06, 0x1d, 0x00, 0xec, 0xac, 0x09, 0x21, 0x12, 0x99, 0xbb, 0xdc,
+    0xcc, 0x9a, 0x89, 0xab, 0x8b, 0x18, 0x00, 0x51, 0x35, 0x33, 0x91, 0xcf, 0xab, 0x18, 0x01, 0x08,
+    0x10, 0x92, 0xce, 0x8b, 0x00, 0xd9, 0xbb, 0x0a, 0x18, 0x42, 0x25, 0x02, 0x88, 0xd9, 0xaa, 0x08,
+    0x80, 0x00, 0x63, 0x63, 0x00, 0xad, 0x9b, 0x20, 0x80, 0xa9, 0x8a, 0xba, 0x9c, 0x40, 0x13, 0x32,
+    0x88, 0xbf, 0x38, 0x47, 0x34, 0x12, 0x89, 0x9a, 0xab, 0x48, 0x47, 0x23, 0x22, 0x33, 0x82, 0xcb,
+    0xa9, 0xca, 0x8a, 0x10, 0x10, 0x56, 0x34, 0x00, 0x89, 0x00, 0xb9, 0x8c, 0x73, 0x24, 0x02, 0x90,
+    0xbc, 0xab, 0xca, 0x8a, 0x41, 0x03, 0x10, 0x35, 0x92, 0x40, 0x34, 0x81, 0x10, 0x82, 0xdc, 0xac,
+    0x18, 0x22, 0xe9, 0xab, 0x08, 0x32, 0x36, 0x44, 0x24, 0xb1, 0xdd, 0x89, 0x00, 0x01, 0x90, 0x08,
+    0x21, 0x22, 0x21, 0x23, 0x13, 0xd9, 0xba, 0xb9, 0x23, 0x03, 0x13, 0x00, 0x1a, 0x65, 0x92, 0xbc,
+    0x9a, 0xea, 0xab, 0x28, 0x53, 0x21, 0xba, 0xbe, 0xbd, 0xbb, 0xad, 0x19, 0x34, 0x92, 0x8a, 0x00,
+    0xa9, 0x8a, 0xca, 0x89, 0xf9, 0xbe, 0x09, 0x00, 0x08, 0x08, 0xea, 0xeb, 0x89, 0x42, 0x22, 0x22,
+    0xa0, 0xad, 0xaa, 0xaa, 0x09, 0x33, 0x13, 0x90, 0x70, 0x34, 0x90, 0x89, 0xa8, 0x0a, 0xb2, 0xff,
+    0x29, 0x01, 0x99, 0x98, 0xcb, 0x89, 0xda, 0x3a, 0x37, 0x81, 0x08, 0x81, 0xda, 0xcc, 0xac, 0x09,
+    0x22, 0x42, 0x53, 0x12, 0x90, 0xc9, 0xba, 0xcb, 0x8a, 0x32, 0x84, 0xa9, 0x31, 0xa4, 0xbe, 0x3a,
+    0x34, 0x11, 0x48, 0x53, 0x22, 0xb9, 0xbd, 0xbc, 0x99, 0x10, 0x12, 0x32, 0x43, 0x54, 0x53, 0x02,
+    0x80, 0x30, 0x63, 0x90, 0x50, 0x46, 0x91, 0x9a, 0x18, 0x01, 0x00, 0x88, 0x08, 0x32, 0x46, 0x32,
+    0x90, 0xdc, 0xab, 0x08, 0x01, 0x73, 0x33, 0x02, 0x11, 0xa9, 0xbd, 0x09, 0x57, 0x01, 0x1c, 0x00,
+    0x43, 0x04, 0xb8, 0x30, 0x35, 0x81, 0xcc, 0xbd, 0x89, 0x10, 0x31, 0x36, 0x34, 0x02, 0xb8, 0xbc,
+    0xbc, 0x8a, 0x61, 0x33, 0x22, 0x31, 0x80, 0x89, 0x00, 0x99, 0xac, 0xac, 0x61, 0x25, 0x90, 0x88,
+    0x92, 0xed, 0xab, 0x0a, 0x61, 0x34, 0x13, 0x88, 0x88, 0xa8, 0xac, 0x9a, 0xcb, 0x8c, 0x21, 0x24,
+    0x24, 0x02, 0x00, 0xc0, 0xbf, 0x9b, 0x08, 0x20, 0x80, 0xbe, 0x9b, 0x80, 0x90, 0xdb, 0xac, 0x9a,
+    0xbc, 0x3a, 0x67, 0x81, 0xca, 0xba, 0xaa, 0x9a, 0x10, 0x44, 0x24, 0x81, 0xc9, 0xbb, 0x89, 0x18,
+    0x00, 0x32, 0x82, 0xb9, 0xda, 0xeb, 0x9a, 0x08, 0x98, 0x88, 0x72, 0x46, 0x23, 0xa0, 0xcc, 0xab,
+    0x0a, 0x88, 0x18, 0x45, 0x03, 0xd9, 0x9b, 0x10, 0x98, 0x09, 0x22, 0x90, 0x18, 0x01, 0xae, 0x39,
+    0x27, 0xa1, 0xbd, 0x39, 0x37, 0x24, 0x11, 0x88, 0xaa, 0x89, 0x80, 0xa9, 0x40, 0x47, 0x24, 0x23,
+    0x79, 0x02, 0x22, 0x00, 0x12, 0x88, 0x89, 0x98, 0xac, 0x09, 0x43, 0x22, 0x02, 0xd9, 0xac, 0x09,
+    0x10, 0x32, 0x37, 0x33, 0x33, 0x34, 0x04, 0xec, 0x9b, 0x00, 0xb9, 0x19, 0x44, 0x33, 0x44, 0x13,
+    0x98, 0xbc, 0xbc, 0x08, 0x80, 0x00, 0x24, 0x83, 0xed, 0xbd, 0x9a, 0x88, 0x99, 0xba, 0xac, 0x30,
+    0x34, 0x91, 0xec, 0xcc, 0xba, 0xa9, 0x88, 0x31, 0x24, 0x81, 0xb9, 0xcc, 0xaa, 0xb9, 0x9b, 0x31,
+    0x26, 0x34, 0x81, 0xcb, 0x9b, 0x99, 0xcb, 0x9d, 0x28, 0x54, 0x23, 0x83, 0xea, 0xcb, 0xcb, 0x9b,
+    0x18, 0x34, 0x36, 0x33, 0x23, 0x12, 0x00, 0x09, 0x2a, 0x74, 0x11, 0x08, 0x31, 0x13, 0xda, 0xbc,
+    0x8a, 0x81, 0xab, 0x73, 0x47, 0x00, 0x00, 0x98, 0xbb, 0x8a, 0x42, 0x35, 0x22, 0x20, 0x32, 0x90,
+    0xdb, 0xcc, 0x9a, 0x89, 0xa9, 0x08, 0x01, 0xb0, 0xbb, 0xdf, 0xbc, 0x18, 0x44, 0x01, 0x08, 0x80,
+    0xdb, 0x9b, 0xab, 0xab, 0x87, 0xfd, 0x1a, 0x00, 0xcc, 0xab, 0x52, 0x24, 0x90, 0xaa, 0xab, 0xa8,
+    0xcb, 0x9c, 0x18, 0x44, 0x44, 0x22, 0xb8, 0xad, 0x00, 0xa0, 0x09, 0x45, 0x45, 0x24, 0x00, 0x98,
+    0xca, 0xaa, 0x08, 0x30, 0x64, 0x32, 0x11, 0x80, 0x99, 0x08, 0x10, 0x23, 0xb2, 0xbd, 0x39, 0x36,
+    0x03, 0xdb, 0xbc, 0xbb, 0x8b, 0x73, 0x24, 0x00, 0xb9, 0xdd, 0xbc, 0x9a, 0x18, 0x22, 0x22, 0x01,
+    0x00, 0x08, 0xba, 0xcd, 0xbc, 0x8a, 0x01, 0xa8, 0xac, 0x89, 0x08, 0xd8, 0xdd, 0x29, 0x56, 0x33,
+    0x01, 0xa9, 0x99, 0x01, 0x91, 0x01, 0x22, 0x09, 0x42, 0x15, 0x21, 0x74, 0x33, 0x91, 0xca, 0x0a,
+    0x23, 0x03, 0xa9, 0xac, 0x63, 0xa1, 0xbe, 0x09, 0x90, 0x28, 0x92, 0x9f, 0x40, 0x80, 0x8a, 0x02,
+    0xfd, 0xbb, 0x99, 0x22, 0x24, 0x90, 0xb9, 0xdd, 0xab, 0x18, 0x21, 0x11, 0x10, 0x20, 0xa8, 0xac,
+    0x38, 0x44, 0x23, 0x82, 0x30, 0x77, 0x24, 0x02, 0x18, 0x01, 0x22, 0x00, 0x98, 0xbc, 0xbc, 0x09,
+    0x44, 0x22, 0x12, 0x11, 0x98, 0x9a, 0x31, 0x23, 0x53, 0x43, 0x22, 0x13, 0xca, 0xbd, 0xbc, 0xbd,
+    0xac, 0x29, 0x53, 0x02, 0xa9, 0xbc, 0xac, 0xac, 0x9a, 0x9a, 0x89, 0x32, 0x92, 0xcb, 0x9c, 0x58,
+    0x35, 0xc8, 0xac, 0x89, 0x89, 0x21, 0x92, 0xcb, 0x98, 0xaa, 0x28, 0x27, 0x82, 0x21, 0x13, 0x34,
+    0x77, 0x12, 0x88, 0x99, 0x08, 0x20, 0x24, 0x33, 0x41, 0x21, 0x90, 0xda, 0x0a, 0x65, 0x22, 0x80,
+    0x99, 0x98, 0x98, 0x89, 0x43, 0x03, 0xdd, 0x8a, 0x88, 0x89, 0x32, 0xd2, 0xdf, 0xab, 0x89, 0x10,
+    0x00, 0x10, 0x91, 0xdb, 0x9c, 0x99, 0x99, 0x08, 0xc8, 0xdc, 0x99, 0xa8, 0x1a, 0x00, 0xcd, 0xac,
+    0x9a, 0x28, 0x45, 0x32, 0x02, 0x88, 0x28, 0x11, 0x98, 0xb0, 0xa8, 0x46, 0x44, 0x73, 0x03, 0x98,
+    0x41, 0x02, 0x9a, 0x48, 0x54, 0x24, 0x81, 0x9a, 0x38, 0x33, 0x03, 0x08, 0xa3, 0x01, 0x15, 0x00,
+    0x02, 0xd0, 0xad, 0x18, 0x23, 0x33, 0x43, 0xea, 0xaf, 0x9a, 0x88, 0x10, 0x02, 0x90, 0xcc, 0xbd,
+    0x9a, 0x11, 0x02, 0x98, 0x09, 0xfb, 0xbc, 0xa8, 0xc8, 0xdc, 0xba, 0x99, 0x10, 0x33, 0x32, 0x44,
+    0x34, 0x81, 0xeb, 0xab, 0x09, 0x11, 0x20, 0x43, 0x91, 0x0b, 0x44, 0x91, 0x40, 0x47, 0x12, 0x42,
+    0x12, 0x08, 0x18, 0x19, 0x48, 0x53, 0x33, 0x24, 0x82, 0xba, 0x19, 0xa0, 0xaf, 0x8a, 0x9a, 0x59,
+    0x45, 0x01, 0x18, 0x88, 0x98, 0xba, 0xaf, 0x18, 0x04, 0x02, 0x01, 0x08, 0x34, 0xd2, 0xce, 0xab,
+    0x98, 0xb9, 0xab, 0x31, 0x13, 0xb8, 0xff, 0xbd, 0x9a, 0x89, 0x10, 0x43, 0x33, 0x83, 0xeb, 0xab,
+    0x18, 0x42, 0x22, 0x08, 0x99, 0x89, 0xb8, 0xcf, 0xab, 0xb9, 0xac, 0x20, 0x13, 0x43, 0x23, 0xfb,
+    0x9c, 0x88, 0x11, 0x54, 0x44, 0x21, 0x80, 0x10, 0x21, 0x01, 0x08, 0x52, 0x33, 0x10, 0x31, 0x63,
+    0x4a, 0x01, 0x1a, 0x00, 0x45, 0x02, 0xb9, 0x0a, 0x23, 0x27, 0x15, 0x80, 0xaa, 0x8a, 0x99, 0xab,
+    0x89, 0x45, 0x25, 0x12, 0x12, 0x02, 0x90, 0xc9, 0x9a, 0x29, 0x63, 0x34, 0x24, 0x90, 0x99, 0x88,
+    0xa9, 0x19, 0xc8, 0xaf, 0x61, 0x14, 0x80, 0x00, 0xb9, 0xac, 0x9a, 0xdb, 0x8a, 0x00, 0x20, 0x90,
+    0xbe, 0x9b, 0xca, 0xbc, 0xab, 0x8a, 0x41, 0x90, 0xcc, 0xcb, 0xbc, 0xaa, 0xbb, 0x9c, 0xbb, 0xad,
+    0x38, 0x36, 0xa0, 0xac, 0x38, 0xa1, 0xaf, 0x89, 0x99, 0x28, 0x24, 0x88, 0x10, 0xb8, 0xad, 0x88,
+    0x00, 0x81, 0xa8, 0x93, 0xb8, 0x78, 0x07, 0xda, 0xab, 0xab, 0x8b, 0x28, 0x30, 0x03, 0xec, 0xbc,
+    0xbc, 0x89, 0x02, 0x12, 0x67, 0x24, 0x02, 0x80, 0x11, 0x81, 0xdb, 0x0a, 0x44, 0x33, 0x12, 0x80,
+    0x18, 0x89, 0xad, 0x1b, 0x31, 0x72, 0x45, 0x13, 0x90, 0x80, 0xb8, 0xab, 0x10, 0x64, 0x45, 0x02,
+    0x00, 0x80, 0xba, 0x99, 0xa8, 0x02, 0x17, 0x00, 0xa9, 0x8b, 0x54, 0x33, 0x12, 0xd9, 0xbb, 0xaa,
+    0xaa, 0xbc, 0xac, 0x59, 0x54, 0x33, 0x23, 0x01, 0xfb, 0xab, 0x89, 0x01, 0x34, 0x44, 0x11, 0x98,
+    0x99, 0xab, 0x0b, 0x63, 0x81, 0xab, 0x89, 0x62, 0x73, 0x81, 0xba, 0x9a, 0x8a, 0x88, 0x99, 0x48,
+    0x91, 0xdf, 0xcb, 0xbb, 0xac, 0xab, 0x89, 0x10, 0x02, 0x91, 0xfa, 0xab, 0x98, 0xb8, 0x89, 0xb9,
+    0xaf, 0xab, 0xcd, 0xac, 0x9a, 0xa9, 0xda, 0x9b, 0x18, 0x81, 0xda, 0xcc, 0xaa, 0x08, 0x80, 0x08,
+    0x73, 0x32, 0x88, 0x9b, 0x39, 0x22, 0xba, 0xbc, 0x9a, 0x42, 0x92, 0xce, 0xbd, 0x9a, 0x10, 0x18,
+    0x09, 0x38, 0x01, 0xcf, 0x0b, 0x56, 0x82, 0xea, 0xaa, 0x98, 0x99, 0x10, 0x36, 0x14, 0x80, 0x89,
+    0xb9, 0xad, 0x1a, 0x33, 0x25, 0x03, 0x98, 0x80, 0x10, 0x08, 0x22, 0x41, 0x72, 0x42, 0x54, 0x54,
+    0x22, 0x01, 0x90, 0xba, 0x9c, 0x20, 0x35, 0x35, 0x6e, 0xfe, 0x21, 0x00, 0x22, 0x01, 0x08, 0x99,
+    0xcb, 0x08, 0x93, 0xa0, 0x22, 0x24, 0x42, 0x43, 0x89, 0x9b, 0x3a, 0x67, 0x02, 0x10, 0x02, 0xfa,
+    0xaa, 0x88, 0x80, 0x11, 0x32, 0x56, 0x13, 0xb9, 0xcb, 0x88, 0x20, 0xa9, 0x9c, 0x64, 0x33, 0x01,
+    0x12, 0x90, 0xae, 0xbb, 0xaa, 0xa9, 0x08, 0x11, 0x42, 0x92, 0xfd, 0xcc, 0xab, 0xa9, 0xa0, 0xa0,
+    0xa0, 0xa8, 0xb9, 0xc9, 0xcc, 0x8a, 0x73, 0x34, 0x22, 0xa8, 0xab, 0x99, 0xea, 0xad, 0x9b, 0x09,
+    0x08, 0x89, 0x50, 0x01, 0xcc, 0x9c, 0x19, 0x21, 0x52, 0x53, 0x43, 0x12, 0x99, 0x9b, 0x09, 0x98,
+    0xab, 0x3b, 0x74, 0x01, 0x9b, 0x58, 0x22, 0xca, 0x8c, 0x61, 0x45, 0x13, 0x11, 0x10, 0x10, 0x09,
+    0x89, 0x10, 0x36, 0x24, 0x02, 0x90, 0x38, 0x55, 0x03, 0x90, 0x09, 0x51, 0x33, 0x11, 0x52, 0x14,
+    0x90, 0xca, 0x8a, 0x80, 0xda, 0x8b, 0x53, 0x34, 0x23, 0xc8, 0xad, 0xaa, 0x15, 0x04, 0x1b, 0x00,
+    0xaa, 0x8b, 0x38, 0x73, 0x01, 0xb9, 0xbb, 0x99, 0xc9, 0xda, 0x89, 0x80, 0x9a, 0x99, 0xb9, 0xed,
+    0xcd, 0xbb, 0x8a, 0x28, 0x35, 0x23, 0x00, 0xfb, 0xbc, 0xab, 0xbb, 0x28, 0x36, 0x12, 0x08, 0x01,
+    0x81, 0x18, 0x43, 0x25, 0x23, 0x82, 0x81, 0x46, 0x34, 0x02, 0xca, 0x9b, 0x18, 0x32, 0x46, 0x13,
+    0x00, 0x80, 0x08, 0x30, 0x55, 0x52, 0x33, 0x02, 0x89, 0x9a, 0x99, 0x83, 0x04, 0x34, 0x23, 0xa0,
+    0xd9, 0x9b, 0x58, 0x32, 0x89, 0x0c, 0x72, 0x26, 0xb0, 0xcd, 0xaa, 0x88, 0x81, 0xca, 0x9b, 0x88,
+    0xba, 0x9a, 0xda, 0xbc, 0x9b, 0xbc, 0xbe, 0xaa, 0x98, 0x08, 0x41, 0x90, 0xcd, 0xaa, 0xb8, 0xd9,
+    0x99, 0x10, 0x22, 0x21, 0x63, 0x13, 0xb8, 0xac, 0xbc, 0xab, 0x61, 0x26, 0x04, 0x98, 0x9a, 0x18,
+    0x53, 0x33, 0x23, 0x21, 0x88, 0x13, 0x17, 0x11, 0x00, 0x12, 0x33, 0x32, 0x72, 0x22, 0x00, 0x91,
+    0x44, 0x03, 0x0e, 0x00, 0xdd, 0x8a, 0x73, 0x24, 0x12, 0xa8, 0xcb, 0xab, 0xbc, 0xbd, 0xbc, 0xcb,
+    0xa9, 0x00, 0x01, 0x99, 0x0a, 0x9a, 0xad, 0x19, 0x13, 0xa1, 0xfd, 0xbd, 0xac, 0x99, 0xa9, 0x99,
+    0x9a, 0xcb, 0xae, 0x8a, 0x10, 0x12, 0x82, 0x81, 0x53, 0x36, 0x15, 0x03, 0x33, 0x14, 0xb8, 0xbd,
+    0x9a, 0x18, 0x32, 0x21, 0x71, 0x36, 0x13, 0x98, 0xa9, 0x98, 0x20, 0x12, 0x09, 0x63, 0x03, 0xd8,
+    0xcb, 0x19, 0x35, 0x82, 0xcb, 0xac, 0x89, 0xca, 0xbc, 0x99, 0xa8, 0xa8, 0xcb, 0xbb, 0xbc, 0xad,
+    0x8a, 0xb0, 0xfb, 0x99, 0xaa, 0xab, 0xa0, 0xfb, 0xbd, 0x99, 0x30, 0x44, 0x13, 0x42, 0x53, 0x33,
+    0x24, 0x81, 0x10, 0x42, 0x33, 0x81, 0x89, 0x89, 0x29, 0x21, 0x00, 0x47, 0x36, 0x12, 0x90, 0x91,
+    0x92, 0xa9, 0x8f, 0x28, 0x02, 0x99, 0x71, 0x21, 0x99, 0x98, 0xea, 0xcb, 0xa9, 0xcb, 0xac, 0x9c,
+    0x8b, 0x9a, 0x98, 0x98, 0x4a, 0xfc, 0x11, 0x00, 0x09, 0x09, 0xcc, 0x9f, 0x0a, 0x22, 0x01, 0x19,
+    0x89, 0x9f, 0x30, 0x27, 0x01, 0x31, 0x33, 0x04, 0x22, 0x73, 0x63, 0x22, 0x11, 0x01, 0x10, 0x02,
+    0xa1, 0x13, 0x83, 0x1b, 0x67, 0x12, 0x18, 0x32, 0x03, 0x10, 0x51, 0x11, 0xca, 0xbb, 0x00, 0xd1,
+    0xca, 0x09, 0x88, 0xeb, 0xbc, 0x9b, 0x19, 0x0a, 0x9c, 0x9b, 0xcc, 0xcc, 0xba, 0xbc, 0xad, 0xab,
+    0x08, 0x99, 0x2a, 0x25, 0xc8, 0x8c, 0x31, 0x30, 0x18, 0x91, 0x21, 0x13, 0xdf, 0x1b, 0x73, 0x04,
+    0x80, 0x32, 0x24, 0x91, 0x89, 0x72, 0x22, 0x80, 0x00, 0x03, 0x24, 0x13, 0x80, 0x12, 0xb0, 0x4b,
+    0x67, 0x12, 0x12, 0x11, 0x10, 0x10, 0x08, 0x10, 0x50, 0x51, 0x00, 0x11, 0x06, 0xb1, 0xdd, 0xdb,
+    0xaa, 0xb9, 0x99, 0x99, 0x08, 0x43, 0x84, 0xc8, 0xca, 0xba, 0xaa, 0x9a, 0xeb, 0xdc, 0xa9, 0xa9,
+    0xba, 0xac, 0x28, 0x02, 0x9a, 0x30, 0x25, 0x12, 0x0e, 0xfe, 0x10, 0x00, 0xc0, 0xbe, 0x09, 0x88,
+    0x9a, 0x10, 0xb8, 0xff, 0x9b, 0x10, 0x33, 0x14, 0x22, 0x10, 0x19, 0x41, 0x44, 0x24, 0x43, 0x24,
+    0x02, 0xa8, 0x11, 0x26, 0x24, 0x02, 0xa0, 0xda, 0x09, 0x61, 0x11, 0x01, 0x23, 0x01, 0x18, 0x25,
+    0x12, 0x53, 0x13, 0xbe, 0x9c, 0x88, 0x10, 0x35, 0x14, 0x80, 0x89, 0x08, 0xa1, 0x00, 0x54, 0x81,
+    0xa9, 0x21, 0x11, 0x09, 0xd9, 0xcf, 0x9a, 0x08, 0x00, 0x90, 0xdd, 0xaf, 0x9b, 0x8a, 0xaa, 0x99,
+    0xa8, 0xbc, 0xbc, 0xba, 0x88, 0x03, 0x01, 0x9a, 0xaf, 0xbc, 0xbe, 0xa9, 0xa0, 0xa0, 0xb0, 0xea,
+    0x09, 0x31, 0x21, 0xdb, 0x9d, 0x00, 0xb8, 0xaa, 0xc9, 0xab, 0x28, 0x82, 0x91, 0xdb, 0x2a, 0xa1,
+    0xff, 0x1a, 0x11, 0x11, 0xa1, 0xda, 0x98, 0xb0, 0xad, 0x28, 0x37, 0x14, 0x21, 0x33, 0x81, 0xba,
+    0xca, 0x8a, 0x73, 0x27, 0x02, 0x08, 0x10, 0x81, 0x99, 0x01, 0x22, 0x24, 0xcc, 0xfc, 0x11, 0x00,
+    0x43, 0x43, 0x44, 0x24, 0x24, 0x23, 0x11, 0xb8, 0x98, 0x10, 0xaa, 0x8a, 0x75, 0x12, 0x99, 0x21,
+    0x04, 0x89, 0x51, 0x43, 0x21, 0x00, 0x0a, 0x7a, 0x30, 0x39, 0x62, 0x13, 0x13, 0xb8, 0x9f, 0x28,
+    0x81, 0x20, 0x34, 0x91, 0xba, 0xad, 0x18, 0x13, 0x13, 0x16, 0x43, 0x64, 0x53, 0x33, 0x02, 0x88,
+    0x29, 0x11, 0xa8, 0xad, 0x0b, 0x1a, 0x20, 0x03, 0xa8, 0xaf, 0xaf, 0x9b, 0x20, 0x44, 0x12, 0xb8,
+    0xca, 0xaa, 0x89, 0xac, 0xbd, 0xbd, 0x9b, 0x9a, 0xca, 0xba, 0xbb, 0xbd, 0xbc, 0x8d, 0x48, 0x21,
+    0x98, 0xbc, 0xbb, 0x10, 0x13, 0x32, 0x27, 0x13, 0x9b, 0xbf, 0x9c, 0x28, 0x21, 0xa0, 0xa9, 0x10,
+    0x30, 0x3a, 0xba, 0xfb, 0xab, 0xdc, 0xcc, 0x99, 0x91, 0x11, 0x16, 0xc8, 0xac, 0x32, 0x16, 0x11,
+    0x32, 0x92, 0xc9, 0xaa, 0xdb, 0xba, 0x91, 0x21, 0x62, 0x80, 0xa9, 0x08, 0xe8, 0xeb, 0x88, 0x23,
+    0xc4, 0xfd, 0x16, 0x00, 0x03, 0x43, 0x83, 0xda, 0x98, 0xa0, 0x0b, 0x72, 0x10, 0x8a, 0x08, 0xc9,
+    0xac, 0xba, 0xcb, 0x0a, 0x10, 0x0c, 0x49, 0x04, 0x90, 0x18, 0x37, 0x26, 0x13, 0x13, 0x91, 0xac,
+    0x09, 0x53, 0x36, 0x14, 0x22, 0x22, 0x88, 0x89, 0x08, 0x19, 0x42, 0x83, 0x92, 0x34, 0x67, 0x43,
+    0x12, 0x11, 0x80, 0xa9, 0x8a, 0x38, 0x44, 0x83, 0x80, 0x92, 0xda, 0x89, 0x01, 0x0c, 0x60, 0x91,
+    0xbb, 0x71, 0x24, 0x82, 0x99, 0x9b, 0x18, 0x31, 0xcb, 0x1b, 0x56, 0x82, 0xa0, 0x90, 0x24, 0x34,
+    0x53, 0x35, 0xa1, 0xcb, 0x9a, 0x89, 0x88, 0x80, 0x08, 0x01, 0xf8, 0xec, 0xba, 0x19, 0x30, 0x73,
+    0x32, 0x11, 0x80, 0xa8, 0x0a, 0x30, 0x12, 0x21, 0x16, 0xc1, 0x90, 0x02, 0xdb, 0xcf, 0x8a, 0x20,
+    0x82, 0xa9, 0x98, 0x98, 0xac, 0xac, 0x08, 0x62, 0x32, 0x22, 0xaa, 0xcf, 0xab, 0x09, 0xa9, 0xdb,
+    0xcb, 0xcc, 0xcb, 0xab, 0xad, 0x00, 0x18, 0x00, 0xa9, 0xa0, 0xb1, 0xb8, 0xba, 0xaf, 0x9a, 0xbc,
+    0xcb, 0xc9, 0xda, 0x8a, 0x10, 0x10, 0xba, 0xbf, 0xbc, 0xbc, 0x9c, 0x89, 0x10, 0x21, 0x81, 0xfb,
+    0xbb, 0x88, 0x98, 0x9a, 0x81, 0xa9, 0xab, 0xae, 0x5a, 0x43, 0x80, 0x89, 0xbd, 0xab, 0x12, 0x03,
+    0xfb, 0xcd, 0x8a, 0x8a, 0x9a, 0x8a, 0x60, 0x11, 0xbb, 0x0b, 0x22, 0x82, 0xb9, 0xae, 0x51, 0x22,
+    0x9a, 0x8a, 0x99, 0x28, 0x74, 0x21, 0x1a, 0x1a, 0x02, 0xa3, 0xed, 0xdb, 0xaa, 0x9a, 0x30, 0x37,
+    0x35, 0x24, 0x23, 0x11, 0x32, 0x36, 0x15, 0x00, 0x88, 0x01, 0x02, 0x01, 0x10, 0x82, 0x88, 0x3a,
+    0x78, 0x62, 0x33, 0x91, 0xb9, 0xba, 0x2b, 0x66, 0x34, 0x34, 0x13, 0x12, 0x21, 0x99, 0x1c, 0x10,
+    0x80, 0x98, 0x89, 0x64, 0x22, 0x9a, 0x00, 0x92, 0x10, 0x57, 0x25, 0x12, 0x80, 0x10, 0x08, 0x1a,
+    0x44, 0x03, 0x19, 0x31, 0xcc, 0xbc, 0xb9, 0xa8, 0x92, 0x01, 0x0f, 0x00, 0x80, 0x32, 0x85, 0xc9,
+    0x29, 0xb8, 0xff, 0xba, 0xca, 0x9a, 0x11, 0x81, 0xa0, 0xd9, 0xad, 0x99, 0x80, 0x9a, 0x89, 0x28,
+    0x72, 0x11, 0xba, 0xbd, 0xbc, 0xbd, 0xab, 0x08, 0x21, 0x00, 0x0c, 0x39, 0x10, 0xbf, 0x9b, 0x00,
+    0x21, 0x40, 0x60, 0x45, 0x22, 0x99, 0xbc, 0x9c, 0x00, 0x23, 0x25, 0x01, 0x88, 0x01, 0x11, 0x74,
+    0x42, 0x21, 0x02, 0x80, 0x18, 0x11, 0x22, 0x23, 0x33, 0x67, 0x34, 0x34, 0x12, 0x88, 0x99, 0x18,
+    0x63, 0x34, 0x14, 0x80, 0x90, 0x90, 0xa0, 0xe9, 0xaa, 0x00, 0x02, 0x14, 0x17, 0x22, 0x24, 0x83,
+    0xcb, 0x9c, 0x11, 0x13, 0x32, 0x81, 0xac, 0x9d, 0xae, 0x9c, 0x99, 0xbd, 0x9d, 0x8a, 0x09, 0x08,
+    0xb9, 0xac, 0xaa, 0x18, 0x33, 0xb1, 0xcc, 0xaa, 0xce, 0xcb, 0x99, 0x08, 0x80, 0xa8, 0x08, 0x44,
+    0x81, 0xea, 0xba, 0x9a, 0x19, 0x52, 0x33, 0x24, 0x00, 0x99, 0x00, 0x55, 0x0e, 0xff, 0x14, 0x00,
+    0x45, 0x34, 0x22, 0x32, 0x42, 0x23, 0x10, 0x20, 0x00, 0xab, 0x39, 0x57, 0x14, 0xa0, 0x8b, 0x10,
+    0x10, 0x68, 0x53, 0x12, 0x98, 0xab, 0x08, 0x32, 0x61, 0x30, 0x18, 0x30, 0x33, 0xc9, 0xcf, 0xac,
+    0xa9, 0xbd, 0x9d, 0x80, 0x88, 0x99, 0xbb, 0xad, 0xc9, 0xca, 0x98, 0x98, 0x8a, 0xa0, 0xdc, 0xac,
+    0x9a, 0x09, 0x22, 0x33, 0x01, 0x29, 0x58, 0x29, 0x19, 0x22, 0x42, 0x32, 0x11, 0x13, 0x73, 0x66,
+    0x23, 0x11, 0x53, 0x23, 0x43, 0x43, 0x12, 0x21, 0x32, 0x11, 0x0b, 0x59, 0x15, 0x91, 0xcb, 0xcc,
+    0x88, 0x11, 0x21, 0x80, 0xf9, 0xb9, 0x9a, 0x08, 0x00, 0xaa, 0xfa, 0xb9, 0x0a, 0x98, 0xfb, 0xbd,
+    0xdc, 0xbb, 0x8a, 0x08, 0x08, 0xa9, 0xcb, 0xba, 0xaa, 0x50, 0x26, 0x03, 0xba, 0x89, 0xa0, 0x19,
+    0x52, 0x9a, 0x78, 0x12, 0xb9, 0x19, 0x08, 0x0a, 0xcc, 0x4b, 0x75, 0x33, 0x22, 0x12, 0x11, 0x91,
+    0x91, 0x00, 0x11, 0x00, 0x80, 0x43, 0x23, 0x03, 0xfa, 0xae, 0x89, 0x80, 0xa9, 0x19, 0x01, 0xa1,
+    0x81, 0x12, 0xa2, 0xfb, 0x29, 0xc1, 0xde, 0xba, 0xcc, 0xaa, 0xba, 0xbe, 0x9b, 0x8a, 0x0a, 0xba,
+    0xbf, 0x9a, 0x09, 0x89, 0x19, 0x25, 0x27, 0x02, 0x00, 0x11, 0x08, 0x0c, 0x0a, 0x20, 0x47, 0x82,
+    0x89, 0x51, 0x32, 0x09, 0x28, 0x10, 0x2b, 0x68, 0x43, 0x33, 0x33, 0x15, 0xb0, 0x10, 0x26, 0x80,
+    0x19, 0x11, 0x98, 0x99, 0x48, 0x34, 0x13, 0x12, 0xda, 0xcc, 0xfc, 0xac, 0xaa, 0xb9, 0xab, 0x9a,
+    0x0b, 0x40, 0x24, 0x93, 0xfa, 0xaf, 0x99, 0x98, 0x99, 0x00, 0x01, 0xa9, 0xcd, 0xab, 0x99, 0x88,
+    0x09, 0x0c, 0x59, 0x22, 0x22, 0x34, 0x25, 0x22, 0x81, 0x09, 0x32, 0x72, 0x31, 0x01, 0x32, 0x77,
+    0x13, 0x81, 0x11, 0x11, 0x11, 0x12, 0x33, 0x25, 0x90, 0x10, 0x12, 0x63, 0x22, 0x09, 0x0a, 0x00,
+    0x12, 0x32, 0x17, 0x17, 0x5b, 0x00, 0x13, 0x00, 0x34, 0x42, 0x11, 0x90, 0xc8, 0xfa, 0xba, 0x11,
+    0x22, 0x30, 0x53, 0xc9, 0x9e, 0x8b, 0x8a, 0x88, 0xb9, 0xac, 0xac, 0xbc, 0x9b, 0x10, 0x98, 0xcc,
+    0xbc, 0x9a, 0x02, 0x84, 0x90, 0xdb, 0x8e, 0x1a, 0x89, 0x9b, 0x49, 0x21, 0xca, 0xbc, 0x38, 0x45,
+    0x10, 0x8a, 0x09, 0x11, 0x35, 0x22, 0x10, 0x43, 0x16, 0x04, 0x13, 0x12, 0x92, 0x00, 0x55, 0x34,
+    0x22, 0x00, 0x10, 0x31, 0x73, 0x37, 0x33, 0x23, 0x91, 0x99, 0x51, 0x43, 0x12, 0x12, 0x22, 0x10,
+    0x30, 0x10, 0xbd, 0x9d, 0x18, 0x89, 0x4a, 0x55, 0x11, 0x98, 0xb0, 0xcb, 0x98, 0x45, 0x44, 0x13,
+    0x12, 0x13, 0xab, 0x8d, 0x01, 0x93, 0xa9, 0x88, 0x0c, 0x0f, 0x9b, 0xbd, 0x9c, 0x9a, 0x9c, 0x2a,
+    0x10, 0xdc, 0xbc, 0x99, 0x98, 0xa9, 0xa9, 0xa0, 0xb8, 0xcf, 0xad, 0x89, 0x80, 0x9b, 0x9b, 0x9a,
+    0x9c, 0xa8, 0xf0, 0x88, 0x14, 0x91, 0x9c, 0x0a, 0x87, 0xfe, 0x11, 0x00, 0x19, 0x0b, 0xdb, 0xc9,
+    0xd1, 0xe9, 0xaa, 0x98, 0xa8, 0x99, 0x11, 0x02, 0x90, 0x0a, 0x4a, 0x53, 0x43, 0x12, 0x90, 0xca,
+    0xfa, 0xba, 0xb9, 0xf8, 0xa9, 0x19, 0x38, 0x42, 0x17, 0x81, 0x9a, 0x88, 0x31, 0x65, 0x33, 0x33,
+    0x21, 0x39, 0x31, 0x10, 0x42, 0x37, 0x15, 0x12, 0x22, 0x14, 0x02, 0x03, 0xb1, 0xab, 0x24, 0x37,
+    0x13, 0x88, 0x29, 0x01, 0xaa, 0x00, 0xb2, 0x94, 0x87, 0x02, 0x14, 0xa0, 0x32, 0x37, 0x90, 0x41,
+    0x16, 0x80, 0x19, 0x18, 0xab, 0x0d, 0x19, 0x80, 0x9b, 0x12, 0x47, 0x04, 0x88, 0xab, 0xbb, 0x99,
+    0x33, 0x27, 0x02, 0x22, 0x02, 0xdb, 0x9b, 0x38, 0x89, 0xbd, 0xda, 0x88, 0x13, 0x91, 0x99, 0xd2,
+    0xfa, 0x0a, 0x42, 0x26, 0x12, 0x38, 0x10, 0x90, 0x88, 0xaa, 0x0f, 0x9b, 0xbe, 0xdb, 0xb9, 0xb9,
+    0xcc, 0xcb, 0xab, 0xba, 0x9b, 0xba, 0xcf, 0xab, 0xcb, 0xcb, 0xb9, 0x99, 0x17, 0xfe, 0x13, 0x00,
+    0x08, 0x10, 0xc9, 0xfa, 0xa9, 0xca, 0xac, 0x18, 0x11, 0x98, 0x99, 0x11, 0xe2, 0xde, 0x09, 0x11,
+    0x90, 0x19, 0x91, 0xc8, 0xb8, 0xcc, 0x8b, 0x9a, 0xae, 0x0a, 0x10, 0x32, 0x01, 0xda, 0x9a, 0x2b,
+    0x49, 0x12, 0x05, 0x92, 0xa8, 0xbb, 0x2a, 0x77, 0x82, 0x9a, 0xa9, 0x88, 0x81, 0xeb, 0x8a, 0x0a,
+    0x4c, 0x41, 0x10, 0x39, 0x00, 0xeb, 0xaa, 0xac, 0x9b, 0x0a, 0x28, 0x62, 0x36, 0x33, 0x11, 0x14,
+    0xb8, 0x09, 0x02, 0x9c, 0x29, 0x0a, 0x2f, 0x10, 0x80, 0x08, 0x39, 0x73, 0x43, 0x40, 0x40, 0x20,
+    0x41, 0x32, 0x60, 0x41, 0x31, 0x43, 0x23, 0x43, 0x43, 0x33, 0x24, 0x25, 0x25, 0x23, 0x02, 0x81,
+    0x20, 0x45, 0x21, 0x31, 0x32, 0x21, 0x02, 0x89, 0x50, 0x94, 0xaa, 0x50, 0x90, 0x9b, 0x3b, 0x71,
+    0x13, 0x89, 0x53, 0x02, 0x80, 0x16, 0x15, 0x22, 0x80, 0x01, 0x53, 0x19, 0x1b, 0x50, 0x22, 0x29,
+    0x92, 0x03, 0x0c, 0x00, 0x70, 0x01, 0xab, 0x21, 0x21, 0x39, 0x04, 0xfb, 0x1a, 0x31, 0x8e, 0x2b,
+    0x22, 0xb0, 0x18, 0x16, 0x20, 0x68, 0x01, 0x21, 0x34, 0x31, 0x42, 0x21, 0x39, 0x99, 0xed, 0xb9,
+    0xa8, 0x23, 0xb1, 0x9b, 0x27, 0xb1, 0x3a, 0x41, 0x0b, 0x10, 0x86, 0x88, 0x99, 0xbc, 0xba, 0xf0,
+    0xb0, 0xb0, 0x81, 0x81, 0xad, 0x9d, 0xca, 0xaf, 0x9c, 0x9c, 0x9a, 0xba, 0xbb, 0xaa, 0xae, 0x9c,
+    0x89, 0xba, 0xad, 0x8a, 0x99, 0xa9, 0xad, 0x8b, 0xaa, 0xce, 0x0a, 0x09, 0xaa, 0x99, 0x00, 0x89,
+    0x01, 0x23, 0x91, 0x0d, 0x63, 0xf3, 0xea, 0x80, 0xa8, 0xbd, 0x89, 0x98, 0xaa, 0x89, 0x89, 0x21,
+    0x22, 0x31, 0x36, 0x23, 0x16, 0xc9, 0xae, 0xba, 0xa9, 0x0a, 0xca, 0xac, 0x89, 0x10, 0x90, 0x9f,
+    0x50, 0x23, 0x88, 0x30, 0x44, 0x11, 0x01, 0x22, 0x43, 0x20, 0x51, 0x62, 0x30, 0x32, 0x44, 0x24,
+    0x13, 0x31, 0x58, 0x20, 0xe9, 0xff, 0x11, 0x00, 0x32, 0x14, 0x12, 0x43, 0x24, 0x33, 0x26, 0x03,
+    0x91, 0x80, 0xb1, 0xa3, 0x23, 0x33, 0x34, 0x73, 0x42, 0x04, 0x12, 0x40, 0x01, 0x05, 0x15, 0x21,
+    0x09, 0x2b, 0x61, 0x80, 0xbb, 0xb9, 0xb0, 0x02, 0xc1, 0xa2, 0xc3, 0x9b, 0x55, 0x13, 0x11, 0xb8,
+    0xbb, 0xf0, 0xf9, 0x9a, 0x89, 0x9d, 0x8b, 0x8b, 0x8d, 0x9e, 0x8b, 0x89, 0xa8, 0xb8, 0xca, 0xbd,
+    0xea, 0xa9, 0xb9, 0xcb, 0xab, 0xac, 0x9c, 0xab, 0x9c, 0x0a, 0x9a, 0x88, 0x92, 0x82, 0x0b, 0x9e,
+    0xbd, 0xcd, 0xab, 0x90, 0x99, 0x89, 0x09, 0x28, 0x81, 0xc4, 0x03, 0x58, 0x28, 0xb0, 0xb9, 0x00,
+    0x8d, 0x1b, 0x05, 0x84, 0x16, 0x14, 0x13, 0x32, 0x64, 0x41, 0x42, 0x30, 0x40, 0x21, 0x21, 0x20,
+    0x01, 0x11, 0x34, 0x07, 0x03, 0x05, 0x01, 0x28, 0x41, 0x21, 0x80, 0xa9, 0x30, 0x99, 0xbf, 0xaa,
+    0x00, 0xa0, 0x0f, 0x39, 0x20, 0x09, 0x32, 0x17, 0xc7, 0xff, 0x0d, 0x00, 0x81, 0xba, 0xb0, 0xfb,
+    0xac, 0xac, 0xac, 0xa9, 0xda, 0xaa, 0xab, 0xae, 0xbc, 0xbb, 0xab, 0xae, 0xac, 0x99, 0xa9, 0xb0,
+    0xa9, 0x20, 0x89, 0x0e, 0x08, 0xbb, 0x1f, 0x20, 0xb8, 0xb0, 0xb5, 0x81, 0x13, 0xb8, 0x80, 0x95,
+    0x21, 0x65, 0x30, 0x42, 0x23, 0x41, 0x73, 0x42, 0x32, 0x31, 0x42, 0x13, 0x91, 0x21, 0x53, 0x43,
+    0x21, 0x21, 0x53, 0x23, 0x13, 0x33, 0x24, 0x01, 0x09, 0x88, 0x0c, 0x41, 0x83, 0xb1, 0xa4, 0x93,
+    0x71, 0x24, 0xcb, 0xbb, 0xec, 0xcb, 0x99, 0xa9, 0xab, 0xba, 0x9c, 0x0c, 0x28, 0x21, 0x19, 0x3c,
+    0x31, 0xd9, 0x9b, 0x3b, 0x8d, 0xbf, 0x9d, 0x19, 0x90, 0xa9, 0x33, 0x63, 0x43, 0x24, 0x35, 0x13,
+    0x81, 0x24, 0x15, 0x12, 0x02, 0x32, 0x26, 0x91, 0x01, 0x04, 0x81, 0x94, 0x92, 0x42, 0x32, 0x21,
+    0x32, 0x61, 0x24, 0x22, 0x40, 0x08, 0x0a, 0x90, 0xdd, 0xbb, 0xac, 0xa9, 0xe4, 0x01, 0x0d, 0x00,
+    0xb0, 0x9f, 0x9c, 0x9d, 0x8b, 0x9a, 0xab, 0xbb, 0xbd, 0xbb, 0xbc, 0xbc, 0xa9, 0xa9, 0x09, 0x32,
+    0x45, 0x23, 0x22, 0x44, 0xa1, 0xae, 0x88, 0xb1, 0xb1, 0x05, 0x03, 0x25, 0x12, 0x33, 0x34, 0x38,
+    0x70, 0x43, 0x32, 0x32, 0x31, 0x45, 0x22, 0x33, 0x25, 0x88, 0x89, 0x01, 0xa8, 0xc8, 0xb0, 0xa1,
+    0xf3, 0xc8, 0x90, 0xb9, 0x8e, 0x19, 0xab, 0xae, 0xbb, 0xcb, 0xa9, 0xca, 0xaa, 0x8a, 0x2b, 0x8d,
+    0x9f, 0x99, 0xf8, 0xa9, 0x98, 0xaa, 0x8b, 0x08, 0x2a, 0x40, 0x89, 0x20, 0x13, 0x2a, 0x51, 0x93,
+    0x27, 0x36, 0x12, 0x12, 0x42, 0x51, 0x53, 0x42, 0x21, 0x21, 0x32, 0x31, 0x52, 0x25, 0x82, 0x20,
+    0x20, 0x08, 0x31, 0xb0, 0x9d, 0x3a, 0x89, 0xaf, 0x2b, 0x91, 0xa9, 0x50, 0x01, 0xb0, 0xf8, 0xc9,
+    0x92, 0xd0, 0xcb, 0xba, 0xc9, 0xb8, 0xeb, 0xab, 0x8a, 0x88, 0xa9, 0xaa, 0xac, 0xbd, 0xea, 0xb9,
+    0x89, 0xff, 0x10, 0x00, 0xba, 0xea, 0xb9, 0x82, 0xb0, 0x9b, 0x12, 0x97, 0x22, 0x24, 0x83, 0x15,
+    0x04, 0x08, 0x42, 0x25, 0x33, 0x12, 0x0a, 0x60, 0x10, 0x01, 0x04, 0x22, 0x31, 0x01, 0x24, 0x25,
+    0x53, 0x14, 0x04, 0x33, 0x43, 0x31, 0x44, 0x33, 0x90, 0xbc, 0x8b, 0x18, 0xab, 0x0d, 0xb0, 0xdc,
+    0x89, 0x99, 0x9c, 0xac, 0xba, 0x91, 0xbc, 0x9d, 0x9b, 0xbd, 0xbb, 0xcb, 0xba, 0xfa, 0xa9, 0xab,
+    0x9e, 0x9b, 0xaa, 0xb9, 0xcb, 0x8a, 0xc8, 0xdb, 0xa0, 0xe9, 0xab, 0x98, 0xb9, 0x0a, 0x30, 0x0c,
+    0x9e, 0x8b, 0x19, 0x10, 0x09, 0x32, 0x92, 0xdc, 0xb8, 0xd2, 0x91, 0x16, 0x83, 0x11, 0x14, 0x23,
+    0x47, 0x12, 0x09, 0x21, 0xa3, 0xb2, 0x21, 0x2c, 0x5b, 0x73, 0x12, 0x10, 0x52, 0x24, 0x13, 0x44,
+    0x33, 0x43, 0x13, 0xb1, 0x99, 0x11, 0xa1, 0xf0, 0x90, 0xb0, 0x99, 0x22, 0xd1, 0xab, 0x32, 0x17,
+    0xc2, 0x01, 0x36, 0x81, 0xda, 0x00, 0x11, 0x00, 0x18, 0x32, 0x48, 0x70, 0x10, 0x1a, 0x28, 0xa1,
+    0xc9, 0xb9, 0xbc, 0xab, 0xfb, 0xad, 0x9b, 0x9c, 0x8a, 0x99, 0xba, 0xbd, 0x9a, 0x88, 0xd0, 0xca,
+    0xbb, 0x9a, 0x8b, 0x29, 0xa2, 0xbc, 0x08, 0xea, 0xbd, 0xab, 0x8c, 0x80, 0xd0, 0xbd, 0x0b, 0x08,
+    0xab, 0x9b, 0xe8, 0xb8, 0xa8, 0xad, 0xc9, 0xf0, 0xb1, 0x80, 0x1a, 0x1a, 0x08, 0x92, 0xd9, 0x80,
+    0xc0, 0x99, 0x16, 0x82, 0x08, 0x99, 0x20, 0x31, 0x1a, 0x47, 0x15, 0x11, 0x32, 0x36, 0x34, 0x12,
+    0x20, 0x53, 0x53, 0x41, 0x28, 0x31, 0x14, 0x11, 0x34, 0x12, 0x42, 0x23, 0x40, 0x73, 0x01, 0x12,
+    0x34, 0x31, 0x51, 0x21, 0x31, 0x13, 0x03, 0x52, 0x30, 0x33, 0x07, 0x02, 0x00, 0x21, 0x29, 0x00,
+    0xa4, 0x22, 0x2d, 0x9f, 0x00, 0x11, 0x89, 0xc9, 0xa2, 0xb4, 0x03, 0x46, 0x11, 0x22, 0x13, 0x89,
+    0x02, 0x97, 0x13, 0x15, 0x00, 0x21, 0x21, 0x0b, 0xb7, 0x02, 0x06, 0x00, 0x1d, 0x58, 0x63, 0x00,
+    0x19, 0x19, 0x9a, 0xa9, 0xad, 0x38, 0x84, 0xca, 0x48, 0x22, 0xb9, 0x38, 0x74, 0x22, 0x90, 0x1a,
+    0x39, 0xa2, 0x83, 0x11, 0xaf, 0xce, 0xbd, 0xaa, 0xb9, 0xcb, 0xb9, 0xbc, 0x9d, 0x9b, 0x9d, 0xbb,
+    0xb9, 0xb9, 0xbe, 0x8c, 0xa9, 0xc9, 0xa8, 0xd8, 0x98, 0x11, 0x98, 0x9b, 0x88, 0xdb, 0x9d, 0x1b,
+    0x8c, 0xab, 0xb9, 0x99, 0xa1, 0xd1, 0xb0, 0xb9, 0x1c, 0x9f, 0x9c, 0x89, 0x8b, 0x9c, 0xb9, 0x9a,
+    0x1a, 0x3c, 0x49, 0x98, 0xbb, 0x0e, 0x1d, 0x41, 0x43, 0x38, 0x19, 0xa0, 0xb5, 0xa5, 0xb0, 0x99,
+    0x80, 0xae, 0x0b, 0x01, 0xb3, 0xc9, 0x1f, 0x49, 0x00, 0x98, 0x9a, 0x9b, 0xcd, 0xae, 0xa9, 0xb8,
+    0x8a, 0x00, 0x18, 0x54, 0x33, 0x12, 0x82, 0x91, 0x10, 0x51, 0x62, 0x31, 0xa0, 0xbe, 0x0b, 0x80,
+    0xac, 0x2c, 0x9a, 0xab, 0x17, 0x11, 0x40, 0x31, 0x35, 0x35, 0x24, 0x13, 0xc6, 0xfd, 0x10, 0x00,
+    0x01, 0x20, 0x32, 0x08, 0x08, 0x16, 0x14, 0x80, 0x15, 0x85, 0x22, 0x35, 0x02, 0x41, 0x43, 0x23,
+    0x25, 0x83, 0x02, 0x35, 0x42, 0x22, 0x00, 0x88, 0x91, 0x22, 0x26, 0x82, 0x48, 0x22, 0xa0, 0x02,
+    0x92, 0x30, 0x86, 0xa3, 0x84, 0x98, 0x24, 0x95, 0x02, 0x97, 0xc3, 0x84, 0x13, 0x32, 0x17, 0x02,
+    0x24, 0x04, 0x82, 0xc1, 0xb8, 0xa1, 0xb9, 0x99, 0x80, 0xb1, 0xa5, 0xa2, 0x8c, 0x1f, 0x28, 0x21,
+    0x20, 0x51, 0x00, 0xcb, 0x89, 0xba, 0xaf, 0x1b, 0xb9, 0x2a, 0x3c, 0x4a, 0x63, 0x31, 0x10, 0x11,
+    0x23, 0x27, 0x11, 0x28, 0x29, 0x08, 0x1a, 0x4b, 0x32, 0x21, 0x73, 0x12, 0x1b, 0x1f, 0x2a, 0x88,
+    0xf9, 0xda, 0xa8, 0xa9, 0x9b, 0x9f, 0x9c, 0x9b, 0xa9, 0xeb, 0xaa, 0x09, 0x99, 0xab, 0xb0, 0xe1,
+    0xba, 0x8c, 0x9b, 0xa9, 0xb8, 0xec, 0x9d, 0x8c, 0x8b, 0x8b, 0x8e, 0x8a, 0xaa, 0xb9, 0xa9, 0x9a,
+    0x13, 0xfe, 0x0b, 0x00, 0x9d, 0x8d, 0x09, 0x88, 0x8b, 0x38, 0x00, 0xa9, 0x9c, 0x1e, 0x0b, 0x2b,
+    0x63, 0x90, 0xa2, 0xd4, 0xa0, 0x82, 0xdb, 0x1a, 0xb0, 0x9c, 0x0a, 0x1b, 0x32, 0xf3, 0xa0, 0x14,
+    0x92, 0x40, 0x73, 0x34, 0x9a, 0x9f, 0x19, 0x90, 0xbb, 0x0b, 0x28, 0x8a, 0xab, 0x00, 0x17, 0x86,
+    0x03, 0x42, 0x33, 0x04, 0x32, 0x53, 0x49, 0x28, 0x01, 0x21, 0x43, 0x31, 0x50, 0x54, 0x22, 0x20,
+    0x52, 0x13, 0x32, 0x65, 0x21, 0x10, 0x20, 0x48, 0x40, 0x11, 0x02, 0x92, 0x92, 0x24, 0x13, 0x82,
+    0x80, 0x3c, 0x1a, 0xaa, 0x81, 0x1b, 0x3e, 0x81, 0x97, 0x13, 0x42, 0x45, 0x24, 0x43, 0x24, 0x12,
+    0x8a, 0x0c, 0x39, 0x30, 0x10, 0x09, 0x50, 0x82, 0xf9, 0xc9, 0xc9, 0x9c, 0x9c, 0xa9, 0xa8, 0x99,
+    0x89, 0x92, 0xa1, 0x11, 0x9b, 0xdf, 0xac, 0xab, 0xcd, 0xbb, 0xa8, 0xca, 0xab, 0x9b, 0xac, 0xbc,
+    0xad, 0x8b, 0xba, 0x9d, 0xca, 0xfe, 0x12, 0x00, 0x8b, 0xa0, 0xa0, 0x80, 0x32, 0x92, 0x9e, 0x39,
+    0x1c, 0x0f, 0x0a, 0x8a, 0xaa, 0xfb, 0x98, 0x00, 0x3b, 0x3b, 0xaa, 0xe0, 0xa9, 0x2c, 0x39, 0x30,
+    0x62, 0x41, 0x31, 0x32, 0x47, 0x13, 0x21, 0x60, 0x20, 0x10, 0x82, 0xa0, 0x82, 0x84, 0x05, 0x06,
+    0x03, 0x31, 0x53, 0x22, 0x20, 0x20, 0x82, 0x11, 0x25, 0x01, 0x09, 0x11, 0x21, 0x11, 0x81, 0xa7,
+    0xb2, 0x11, 0x90, 0xba, 0x3e, 0x20, 0xf9, 0xae, 0x09, 0x89, 0x9c, 0xab, 0xbb, 0xdd, 0xb9, 0xa0,
+    0xc0, 0xc8, 0xca, 0x9c, 0x0b, 0xb9, 0xf9, 0xbb, 0x9d, 0x9b, 0x8a, 0xaa, 0x8c, 0x8b, 0x8c, 0x1a,
+    0x0b, 0x1b, 0x12, 0x16, 0x53, 0x30, 0x42, 0x15, 0x22, 0x33, 0x23, 0x11, 0x01, 0x58, 0x72, 0x22,
+    0x13, 0x06, 0x33, 0x54, 0x10, 0x20, 0x21, 0x13, 0x24, 0x34, 0x32, 0x88, 0x9c, 0x9c, 0xaa, 0xda,
+    0xca, 0xa8, 0xc8, 0xba, 0xe8, 0xc8, 0xa0, 0xbb, 0x91, 0xff, 0x0e, 0x00, 0x9b, 0x80, 0xdb, 0xeb,
+    0xc9, 0xa0, 0x81, 0x00, 0x11, 0x90, 0xca, 0x89, 0x38, 0xa8, 0xf9, 0xcd, 0x11, 0x15, 0x01, 0x30,
+    0x31, 0x92, 0xc2, 0x21, 0x62, 0x11, 0x21, 0x33, 0x93, 0x24, 0x57, 0x23, 0x22, 0x80, 0x0b, 0x59,
+    0x99, 0x99, 0xa1, 0xd8, 0x91, 0xc2, 0xeb, 0x89, 0x98, 0x8b, 0x09, 0xfb, 0xba, 0x80, 0x03, 0x19,
+    0xdf, 0x9e, 0x99, 0xa9, 0x8b, 0x9a, 0x9a, 0x09, 0xaa, 0x0a, 0x7a, 0x48, 0x00, 0x11, 0x27, 0x12,
+    0x31, 0x34, 0x33, 0x43, 0x34, 0x24, 0x14, 0x91, 0x98, 0x11, 0x14, 0xab, 0x0d, 0x80, 0xea, 0xc9,
+    0xc9, 0x80, 0x00, 0x90, 0xa1, 0xab, 0x59, 0xa2, 0xda, 0x98, 0xbd, 0x9e, 0xba, 0xc9, 0x98, 0x19,
+    0x18, 0x11, 0x34, 0x33, 0x13, 0xa3, 0x73, 0x41, 0x0a, 0x61, 0x04, 0x01, 0x12, 0x02, 0x14, 0x02,
+    0x1a, 0x3b, 0x1d, 0x2b, 0x46, 0x26, 0x12, 0x51, 0x22, 0x88, 0x9a, 0x83, 0x7d, 0x00, 0x0c, 0x00,
+    0x93, 0x11, 0xa9, 0xdf, 0x0e, 0x0a, 0xb9, 0xcb, 0x89, 0xaa, 0xad, 0x90, 0xb0, 0x90, 0x92, 0x99,
+    0x98, 0xeb, 0x8a, 0x00, 0x38, 0x35, 0xa0, 0x0d, 0x34, 0x15, 0x20, 0x68, 0x22, 0x91, 0x12, 0x47,
+    0x12, 0x52, 0x53, 0x01, 0x80, 0x08, 0x92, 0x93, 0x02, 0xb2, 0x91, 0x30, 0x3a, 0xdd, 0xba, 0xa9,
+    0x8f, 0x1a, 0x99, 0x1b, 0x1b, 0xbf, 0x99, 0xc9, 0xab, 0xa9, 0xcb, 0xa8, 0xa9, 0x41, 0x34, 0x10,
+    0x33, 0x99, 0x1f, 0x89, 0x8f, 0x1a, 0x80, 0xa8, 0x9a, 0x8a, 0x09, 0x10, 0x71, 0x46, 0x10, 0x10,
+    0x34, 0x26, 0x13, 0x33, 0x32, 0x80, 0xb8, 0x03, 0x13, 0x71, 0x73, 0x33, 0x22, 0x43, 0x24, 0x12,
+    0x20, 0x28, 0xc9, 0xca, 0xa8, 0xe0, 0xb0, 0xe9, 0xb9, 0xb8, 0xdb, 0x9b, 0x9a, 0xbb, 0xab, 0x8b,
+    0x4a, 0x0b, 0xbf, 0xb9, 0xdc, 0x9a, 0x00, 0x02, 0x14, 0x91, 0xc9, 0xfa, 0x99, 0x90, 0x9a, 0xba,
+    0x3d, 0xff, 0x0a, 0x00, 0x9b, 0x3a, 0x21, 0x81, 0x49, 0x73, 0x27, 0x00, 0x30, 0x44, 0x10, 0x41,
+    0x73, 0x31, 0x31, 0x11, 0x23, 0x02, 0xcb, 0x2a, 0x53, 0x22, 0x23, 0x89, 0x0a, 0x26, 0x31, 0x29,
+    0x2b, 0x49, 0x11, 0x16, 0x34, 0x52, 0x28, 0x2a, 0x98, 0xdb, 0x9a, 0x1a, 0x29, 0xd0, 0xde, 0xaa,
+    0xc9, 0xaa, 0xab, 0xbc, 0xba, 0xc9, 0xba, 0xb0, 0xc9, 0xcb, 0xd9, 0xd9, 0xc8, 0xc0, 0xa1, 0xa0,
+    0x80, 0xa0, 0xbd, 0xbb, 0xdb, 0x8a, 0x31, 0x01, 0xb8, 0xf9, 0xc8, 0xb9, 0xa8, 0xa9, 0xa1, 0x82,
+    0x78, 0x42, 0x21, 0x40, 0x35, 0x04, 0x11, 0x54, 0x23, 0x22, 0x31, 0x15, 0x93, 0xa2, 0x05, 0x12,
+    0x88, 0x21, 0x25, 0x53, 0x43, 0x00, 0x9b, 0x00, 0x83, 0x02, 0x14, 0x27, 0x16, 0x12, 0x43, 0x21,
+    0x9a, 0x9b, 0x0b, 0x0d, 0x1a, 0x41, 0x13, 0xc8, 0x9f, 0x28, 0x01, 0x80, 0x43, 0x12, 0x98, 0xc3,
+    0xd1, 0xb1, 0xd0, 0xc1, 0x2a, 0x02, 0x10, 0x00, 0xd9, 0xaa, 0xaa, 0xca, 0xeb, 0x9b, 0xa0, 0xcd,
+    0x9b, 0xa8, 0xad, 0x00, 0xb0, 0x9a, 0xa1, 0xdc, 0x09, 0x81, 0x88, 0xb1, 0xf9, 0xb9, 0xdb, 0xb9,
+    0x80, 0x88, 0x89, 0x1b, 0x8a, 0xbf, 0xac, 0xba, 0x9b, 0x89, 0xca, 0x9a, 0xaa, 0xbf, 0x0c, 0x8a,
+    0x8b, 0x99, 0x29, 0x41, 0xe9, 0xa9, 0x26, 0x23, 0x21, 0x31, 0x82, 0xaa, 0x9b, 0xbf, 0x29, 0x13,
+    0xa0, 0x25, 0x83, 0x43, 0x67, 0x11, 0x31, 0x33, 0x11, 0x16, 0x25, 0x33, 0x05, 0x81, 0x88, 0x98,
+    0x39, 0x72, 0x10, 0x28, 0x32, 0x33, 0x52, 0x30, 0x29, 0x3b, 0x2d, 0x09, 0x13, 0x14, 0x80, 0x34,
+    0x03, 0x48, 0x91, 0xdc, 0x28, 0x52, 0x28, 0x73, 0x33, 0x10, 0x19, 0x88, 0x99, 0x08, 0x70, 0x51,
+    0x10, 0x21, 0x24, 0x11, 0x13, 0xb0, 0x5a, 0x2c, 0x0f, 0x10, 0x00, 0x39, 0x28, 0x1c, 0x1a, 0xcb,
+    0xbc, 0x98, 0xd3, 0xf1, 0xa0, 0xa1, 0x82, 0x80, 0x0d, 0x01, 0x0b, 0x00, 0x9b, 0x9b, 0xef, 0xaa,
+    0xa8, 0x99, 0x98, 0xb9, 0xbb, 0xae, 0x8c, 0x0a, 0x09, 0xb9, 0xcf, 0xaa, 0xa9, 0x0c, 0x0a, 0xcb,
+    0x8a, 0xaa, 0x9f, 0x0a, 0x99, 0xb9, 0xb0, 0xc9, 0xba, 0xa0, 0x84, 0x22, 0x08, 0xdc, 0xba, 0xb1,
+    0xe8, 0x9a, 0x2b, 0x8f, 0x8d, 0x8b, 0x8c, 0x09, 0xa0, 0x98, 0x82, 0xa1, 0x1a, 0x20, 0xa8, 0x39,
+    0x57, 0x17, 0x03, 0x11, 0x0a, 0xaa, 0xa9, 0x31, 0x0a, 0x9d, 0x98, 0x09, 0x90, 0xfa, 0xc9, 0xc8,
+    0x81, 0x81, 0x11, 0x27, 0x23, 0x35, 0x04, 0x29, 0x68, 0x20, 0x02, 0x23, 0x34, 0x54, 0x52, 0x21,
+    0x10, 0x32, 0x22, 0x34, 0x35, 0x02, 0x80, 0x43, 0x15, 0x18, 0x41, 0x81, 0x02, 0x07, 0x12, 0x33,
+    0x23, 0x2a, 0x40, 0x93, 0xb0, 0x74, 0x34, 0x18, 0x35, 0x12, 0x00, 0x91, 0xb9, 0x22, 0x02, 0x51,
+    0x17, 0x00, 0x41, 0x10, 0x2a, 0x23, 0x09, 0x30, 0x00, 0x7c, 0x11, 0x98, 0x18, 0x03, 0x0b, 0x00,
+    0x13, 0xa3, 0xb9, 0x32, 0x37, 0x17, 0x02, 0x84, 0xb2, 0x82, 0x82, 0xab, 0x81, 0xd1, 0x19, 0x83,
+    0xd9, 0x19, 0x21, 0xcb, 0x21, 0x37, 0x08, 0x19, 0x28, 0x79, 0x28, 0x0a, 0x24, 0xd1, 0xfb, 0xd9,
+    0xba, 0x99, 0x98, 0xbb, 0xa9, 0xfb, 0xad, 0x8a, 0xbb, 0xcc, 0xa9, 0x9a, 0x9d, 0x89, 0x08, 0x9c,
+    0x09, 0x1a, 0x5c, 0x00, 0xda, 0xa9, 0x98, 0x9a, 0xac, 0x9e, 0x8c, 0x8b, 0x8a, 0x09, 0xb8, 0xab,
+    0x0b, 0xaf, 0x0b, 0xaa, 0x9c, 0x80, 0xc0, 0x03, 0xc3, 0xbb, 0x1d, 0x1c, 0x18, 0x9c, 0x2c, 0x10,
+    0x8a, 0x3a, 0xa9, 0xe3, 0xd0, 0x08, 0xa1, 0xa9, 0xb8, 0xfa, 0x80, 0xd9, 0x99, 0x13, 0x93, 0x67,
+    0x13, 0x11, 0x32, 0x01, 0x33, 0x37, 0x81, 0x38, 0x35, 0x02, 0x31, 0x14, 0x01, 0x35, 0x02, 0x9a,
+    0x31, 0xa1, 0x1a, 0x74, 0x24, 0x80, 0x11, 0x83, 0x12, 0x47, 0x24, 0x32, 0x04, 0x82, 0x23, 0x13,
+    0x83, 0x01, 0x0c, 0x00, 0x22, 0x01, 0x9c, 0x0a, 0xaa, 0x38, 0x51, 0x08, 0x21, 0xbc, 0x8d, 0x73,
+    0x25, 0x22, 0x22, 0x33, 0x53, 0x14, 0xa1, 0x30, 0xb9, 0xcf, 0x98, 0xab, 0x0b, 0x9c, 0x8d, 0xaa,
+    0xbd, 0xca, 0xca, 0x9a, 0xc9, 0x9b, 0x98, 0xeb, 0x08, 0x91, 0x8a, 0x99, 0xc9, 0xb0, 0xc8, 0xbb,
+    0xfa, 0xda, 0xaa, 0x9a, 0xb9, 0xc9, 0xa8, 0xab, 0x6b, 0x29, 0x9d, 0x28, 0xaa, 0x9f, 0x00, 0xb8,
+    0x89, 0x32, 0x09, 0x2a, 0x09, 0x3a, 0x37, 0x53, 0x41, 0x22, 0x32, 0x53, 0x13, 0x03, 0x33, 0x23,
+    0xb3, 0x86, 0x14, 0x51, 0x31, 0x5a, 0x61, 0x01, 0x10, 0x28, 0x18, 0x19, 0x59, 0x41, 0x00, 0x61,
+    0x21, 0x0b, 0x51, 0x12, 0x61, 0x12, 0xb9, 0x33, 0x95, 0xbb, 0x9a, 0xaa, 0xab, 0xcb, 0xaa, 0x21,
+    0x2a, 0x1a, 0xad, 0x9f, 0xcd, 0xcb, 0xaa, 0xbc, 0xbb, 0xb8, 0xd0, 0x88, 0x02, 0xa1, 0x22, 0x07,
+    0x80, 0x31, 0xf0, 0xda, 0x7b, 0xfe, 0x14, 0x00, 0xa0, 0xb8, 0x9a, 0xa8, 0xaa, 0x08, 0xb0, 0x81,
+    0x07, 0x01, 0x54, 0x32, 0x32, 0x34, 0x03, 0x63, 0x12, 0xa0, 0x33, 0x04, 0x13, 0x37, 0x31, 0x52,
+    0x11, 0x21, 0x15, 0x92, 0x03, 0x15, 0x32, 0x33, 0x44, 0x52, 0x41, 0x31, 0x12, 0x82, 0x33, 0x12,
+    0x03, 0x87, 0xc9, 0x9c, 0x0a, 0x9b, 0xac, 0xbb, 0xae, 0x0b, 0xab, 0x9e, 0x98, 0xb0, 0x89, 0xc8,
+    0xab, 0x21, 0xf9, 0xa1, 0xa4, 0x0a, 0x19, 0xbf, 0x8b, 0x01, 0xb0, 0x80, 0x33, 0x51, 0x40, 0x53,
+    0x03, 0x11, 0x44, 0x32, 0x51, 0x42, 0x11, 0x20, 0x43, 0x51, 0x41, 0x33, 0x42, 0x72, 0x22, 0x88,
+    0x88, 0x91, 0xdb, 0x09, 0x1a, 0x0e, 0x1a, 0x19, 0x09, 0xaa, 0x9a, 0x9c, 0x9c, 0x9f, 0x9d, 0x98,
+    0xb9, 0x9a, 0x08, 0x19, 0xab, 0x9e, 0x00, 0xc1, 0xb9, 0x04, 0xa4, 0xc9, 0xac, 0x81, 0xb4, 0x91,
+    0x04, 0x89, 0x6b, 0x31, 0x09, 0x18, 0x84, 0x84, 0x9a, 0x00, 0x0b, 0x00, 0x34, 0x34, 0x12, 0x26,
+    0x83, 0x81, 0x04, 0x92, 0xa0, 0xc9, 0x08, 0x89, 0x9f, 0x29, 0x8b, 0x9c, 0xfa, 0xba, 0x89, 0xca,
+    0xab, 0xca, 0xbc, 0x90, 0xc9, 0x0c, 0x08, 0xcc, 0x89, 0xa9, 0x9f, 0x19, 0x99, 0x99, 0x04, 0x81,
+    0x24, 0x05, 0x21, 0x31, 0x22, 0x33, 0x85, 0x01, 0x23, 0x19, 0x19, 0x99, 0x00, 0x72, 0x4a, 0x20,
+    0x14, 0x24, 0x08, 0x10, 0x07, 0x91, 0x29, 0x02, 0xcb, 0x8d, 0x9d, 0x8c, 0x88, 0x9d, 0x19, 0x91,
+    0xbc, 0x88, 0xb0, 0xae, 0xcb, 0xdb, 0xaa, 0xcb, 0xaa, 0x1a, 0x0d, 0x0b, 0xba, 0xbb, 0x9c, 0x1c,
+    0x30, 0x88, 0x5b, 0x13, 0xd8, 0x23, 0x22, 0x4a, 0x22, 0x89, 0x64, 0x02, 0x28, 0x70, 0x20, 0x29,
+    0x02, 0x92, 0x13, 0x31, 0x7a, 0x79, 0x40, 0x21, 0x12, 0x22, 0x20, 0x38, 0x34, 0x91, 0x98, 0x54,
+    0x98, 0xcf, 0xa9, 0x9a, 0x0b, 0x00, 0xb8, 0xc9, 0x1b, 0x79, 0x12, 0x89, 0x3a, 0xff, 0x0b, 0x00,
+    0xa1, 0xdc, 0xab, 0xbb, 0xcc, 0xa9, 0xbb, 0x9e, 0x99, 0xca, 0xca, 0x18, 0xb9, 0xad, 0x09, 0x9a,
+    0x18, 0x05, 0x38, 0x72, 0x25, 0x32, 0x32, 0x41, 0x11, 0x89, 0x00, 0xa3, 0xaa, 0x34, 0x16, 0x33,
+    0x17, 0x02, 0x24, 0x33, 0x21, 0x13, 0x80, 0x0a, 0x11, 0x02, 0xa7, 0x96, 0x12, 0x11, 0x11, 0x02,
+    0x09, 0x8b, 0xad, 0xb8, 0xe9, 0x00, 0xc3, 0xa8, 0x91, 0xce, 0xa9, 0xf8, 0xb9, 0xb9, 0xbd, 0x8b,
+    0x9b, 0x9d, 0x89, 0x0a, 0x8d, 0xbb, 0xa9, 0x00, 0x0e, 0x0c, 0x08, 0xc9, 0xbb, 0xbc, 0xc9, 0xd3,
+    0xb9, 0x39, 0x33, 0xa8, 0x30, 0x32, 0x20, 0x17, 0xb2, 0xb2, 0x27, 0x34, 0x63, 0x21, 0x30, 0x68,
+    0x11, 0x98, 0x38, 0x53, 0x80, 0x02, 0x16, 0x13, 0x31, 0x41, 0x21, 0x2a, 0x4b, 0x9a, 0x08, 0x17,
+    0x30, 0x61, 0x30, 0x63, 0x22, 0x11, 0x26, 0x90, 0x09, 0x08, 0x2b, 0x32, 0xe2, 0x00, 0x04, 0xa0,
+    0x4f, 0x01, 0x0d, 0x00, 0x13, 0xa4, 0x99, 0x90, 0xbe, 0x8d, 0x9b, 0xad, 0x9b, 0x8a, 0xba, 0x9a,
+    0x83, 0xb2, 0x17, 0x94, 0xb9, 0xea, 0xba, 0x20, 0x21, 0x89, 0xf8, 0xa9, 0x98, 0xbe, 0x89, 0xb2,
+    0xbb, 0x8d, 0x8b, 0x9b, 0x9d, 0x99, 0xa8, 0xa0, 0x85, 0x93, 0x43, 0x31, 0x10, 0x17, 0x92, 0x08,
+    0x32, 0x20, 0x1d, 0x19, 0x3b, 0x0f, 0x1a, 0x14, 0x92, 0x09, 0x20, 0x42, 0x1a, 0x7b, 0x54, 0x38,
+    0x53, 0x14, 0x24, 0x25, 0x22, 0x24, 0x13, 0x10, 0x3a, 0x72, 0x02, 0x80, 0x28, 0x29, 0x29, 0x12,
+    0x70, 0x28, 0x0b, 0x02, 0xc1, 0x41, 0x51, 0x4a, 0x31, 0x12, 0x61, 0x32, 0x13, 0x04, 0x94, 0xb2,
+    0xc9, 0x80, 0xb2, 0xa2, 0x90, 0x09, 0x83, 0xf9, 0xdb, 0x91, 0x15, 0x00, 0x09, 0x94, 0xb3, 0x30,
+    0x77, 0x11, 0x0a, 0xba, 0x9d, 0x09, 0x91, 0xb8, 0xb2, 0xf0, 0xca, 0xa9, 0x9a, 0x99, 0xcb, 0xae,
+    0x99, 0x99, 0x99, 0xda, 0x3d, 0x01, 0x0f, 0x00, 0xcb, 0xaa, 0xbc, 0xac, 0xaa, 0x8b, 0x9d, 0x8d,
+    0x19, 0x19, 0x30, 0x04, 0xc8, 0xa8, 0xbb, 0x9c, 0xc9, 0xbc, 0xab, 0xaa, 0x9d, 0x09, 0x99, 0xaa,
+    0x90, 0x1d, 0x0d, 0xcb, 0x9a, 0xaa, 0xeb, 0x90, 0xb1, 0x91, 0x23, 0x8f, 0x0d, 0x9b, 0x0c, 0x30,
+    0x33, 0x43, 0x88, 0x9a, 0x80, 0x91, 0xca, 0xbf, 0x89, 0xa0, 0x09, 0xd1, 0xda, 0x80, 0xb9, 0xba,
+    0xd3, 0xaa, 0x3a, 0x1c, 0x8b, 0x97, 0xb4, 0x14, 0x07, 0x12, 0x50, 0x31, 0x31, 0x32, 0x31, 0x41,
+    0x02, 0x83, 0x07, 0x03, 0x43, 0x15, 0x33, 0x22, 0x08, 0x19, 0xa2, 0xc2, 0x03, 0x34, 0x71, 0x32,
+    0x43, 0x43, 0x11, 0x33, 0x07, 0x83, 0x05, 0xa2, 0xa8, 0xa9, 0x38, 0x73, 0x02, 0x00, 0x90, 0xad,
+    0x09, 0x9b, 0x0f, 0x89, 0x89, 0x01, 0x00, 0x63, 0x24, 0x42, 0x12, 0x11, 0x04, 0xb2, 0xa9, 0xcb,
+    0x9e, 0x0b, 0x1a, 0x38, 0x98, 0xab, 0xbb, 0x9d, 0x44, 0x01, 0x06, 0x00, 0x21, 0xa1, 0xb2, 0xf3,
+    0x01, 0x96, 0xc1, 0x33, 0x33, 0x99, 0x33, 0x69, 0x2d, 0x09, 0x10, 0x13, 0x80, 0x59, 0x3a, 0x99,
+    0x27, 0x44, 0x12, 0x99, 0x9d, 0x8c, 0x1a, 0x99, 0xab, 0x5a, 0x28, 0x0a, 0x29, 0x00, 0xcd, 0xb9,
+    0xb0, 0xcf, 0xbc, 0xa9, 0xcb, 0x9e, 0x19, 0x99, 0xca, 0xa9, 0xa9, 0xc8, 0xba, 0x8c, 0x9f, 0x8a,
+    0x0a, 0x9c, 0x0a, 0x90, 0x99, 0x88, 0xca, 0x90, 0xc0, 0xaa, 0xc9, 0xcd, 0x0a, 0xbb, 0xbd, 0xc0,
+    0xe0, 0xa0, 0x81, 0x09, 0x88, 0x9a, 0x0e, 0x99, 0xac, 0x1b, 0x19, 0x01, 0x15, 0x00, 0x9c, 0x8b,
+    0x6a, 0x68, 0x10, 0x80, 0x91, 0xba, 0x0d, 0x2a, 0x09, 0xdb, 0xbb, 0xa0, 0xb0, 0xad, 0x9d, 0xba,
+    0xa3, 0xa3, 0x03, 0x15, 0x20, 0x49, 0x52, 0x43, 0x33, 0x10, 0xbf, 0x9d, 0x19, 0x31, 0x49, 0x14,
+    0x94, 0x21, 0x21, 0xb9, 0xa1, 0xd1, 0xa9, 0x99, 0x0b, 0x11, 0xb4, 0x97, 0xda, 0xfc, 0x09, 0x00,
+    0x13, 0x61, 0x52, 0x22, 0x20, 0x61, 0x31, 0x51, 0x34, 0x25, 0x22, 0x11, 0x00, 0x10, 0x22, 0x22,
+    0x33, 0x16, 0x14, 0x22, 0x12, 0x82, 0x05, 0x22, 0x42, 0x53, 0x42, 0x51, 0x32, 0x25, 0x04, 0x81,
+    0x82, 0x81, 0x18, 0x31, 0x30, 0x32, 0x99, 0x71, 0x27, 0x80, 0x22, 0x13, 0x90, 0x24, 0x85, 0x93,
+    0xa2, 0x91, 0x81, 0x17, 0x07, 0x03, 0x11, 0x90, 0xb9, 0x04, 0x93, 0xba, 0x20, 0x49, 0x28, 0xd0,
+    0x09, 0xa2, 0xfa, 0x02, 0xa4, 0x91, 0x19, 0x0c, 0x11, 0x07, 0x13, 0xa3, 0xa3, 0xb1, 0xc9, 0xb0,
+    0xac, 0x3a, 0xcf, 0xad, 0xc9, 0xba, 0x9b, 0xad, 0xba, 0xc8, 0xdb, 0xa9, 0xd8, 0xc0, 0xa0, 0x99,
+    0x0b, 0x0a, 0xc9, 0xbc, 0xab, 0xea, 0xba, 0x8c, 0x8b, 0xbb, 0xba, 0xbb, 0xba, 0xe1, 0x9a, 0x1b,
+    0x1c, 0x0d, 0x8d, 0x0c, 0x1a, 0x99, 0xb2, 0xf9, 0xba, 0x9a, 0x00, 0x06, 0x92, 0xba, 0x89, 0x8b,
+    0x61, 0xfe, 0x05, 0x00, 0xaf, 0xbc, 0xba, 0x9c, 0x9a, 0x81, 0x31, 0x22, 0x09, 0x73, 0x17, 0x22,
+    0x42, 0x30, 0x41, 0x20, 0x50, 0x12, 0x80, 0x52, 0x21, 0x01, 0x05, 0x02, 0x21, 0x94, 0xa3, 0x06,
+    0x93, 0x24, 0x04, 0x22, 0x72, 0x48, 0x10, 0x22, 0x22, 0x03, 0x31, 0x43, 0x98, 0xb2, 0xa5, 0x15,
+    0x04, 0x21, 0x73, 0x21, 0x38, 0x21, 0x91, 0x83, 0x11, 0x15, 0x96, 0x83, 0x12, 0x99, 0xac, 0x9b,
+    0x9d, 0xd9, 0xe8, 0x99, 0x9b, 0x9c, 0x89, 0x99, 0x90, 0x98, 0xbb, 0xaf, 0xac, 0xab, 0xdb, 0xcb,
+    0xb9, 0xb9, 0xa9, 0xb8, 0xe8, 0x91, 0x80, 0x9a, 0xcb, 0xbd, 0x9d, 0x8b, 0xbc, 0xeb, 0xb9, 0xb9,
+    0xaa, 0x9d, 0x0b, 0x9d, 0x8c, 0x1a, 0x9a, 0x09, 0x18, 0x20, 0x26, 0x32, 0x52, 0x23, 0x90, 0x38,
+    0x08, 0x0a, 0x74, 0x52, 0x50, 0x21, 0x10, 0x30, 0x30, 0x23, 0xc3, 0x15, 0x15, 0x10, 0x33, 0x02,
+    0x03, 0xb3, 0x8e, 0x2a, 0xc2, 0xff, 0x08, 0x00, 0x28, 0x73, 0x11, 0x80, 0xa3, 0xa0, 0x22, 0xb0,
+    0x92, 0x63, 0x79, 0x51, 0x38, 0x20, 0x08, 0x38, 0x08, 0x9f, 0x99, 0xd8, 0xc9, 0xb9, 0xa9, 0xb0,
+    0xbb, 0xbc, 0xac, 0x2b, 0x18, 0xba, 0x28, 0x8f, 0x9e, 0x99, 0xb9, 0xd0, 0xa1, 0x83, 0xb1, 0xa1,
+    0xd0, 0xcb, 0x98, 0x25, 0x17, 0x03, 0x21, 0x18, 0x08, 0x32, 0x15, 0x08, 0x38, 0x38, 0x71, 0x82,
+    0xa4, 0xa5, 0x03, 0x42, 0x30, 0x90, 0x86, 0x13, 0x34, 0x35, 0x33, 0x43, 0x33, 0x35, 0x24, 0x13,
+    0xb0, 0xb8, 0xc1, 0xa9, 0x09, 0xae, 0x8c, 0x09, 0x8b, 0x2a, 0x0d, 0x1c, 0x99, 0xa9, 0x01, 0xc1,
+    0xdc, 0xcb, 0x8b, 0xdb, 0xfa, 0xa8, 0x89, 0x1a, 0x8a, 0xc8, 0xb0, 0x91, 0x03, 0x09, 0x2b, 0x1b,
+    0x1e, 0x59, 0x30, 0x51, 0x22, 0x13, 0x26, 0x53, 0x13, 0x82, 0x00, 0x19, 0x38, 0x05, 0xb3, 0x08,
+    0x31, 0x90, 0x50, 0x68, 0x0a, 0x09, 0x1d, 0x1e, 0x69, 0x00, 0x0d, 0x00, 0x3a, 0x2c, 0x4b, 0x21,
+    0x10, 0x44, 0x22, 0x32, 0x09, 0xcd, 0xdb, 0xab, 0xa9, 0xcc, 0x9b, 0x9a, 0x9f, 0x0a, 0xa9, 0xaa,
+    0xb9, 0x9d, 0x18, 0xa0, 0x2a, 0x71, 0x31, 0x31, 0x33, 0x34, 0x20, 0x1c, 0x0b, 0x29, 0x79, 0x30,
+    0x88, 0x28, 0x75, 0x31, 0x28, 0x22, 0x43, 0x71, 0x20, 0x10, 0x03, 0x85, 0x93, 0xb1, 0xb8, 0xa9,
+    0x1c, 0x2c, 0x8c, 0x08, 0x83, 0xa1, 0x9b, 0x1c, 0x99, 0xbc, 0xbc, 0xf1, 0xb8, 0xa8, 0xf1, 0xb0,
+    0xb8, 0xc0, 0xa2, 0x11, 0x8c, 0x9d, 0xb9, 0xbc, 0x2b, 0x10, 0xbb, 0x04, 0xb3, 0xbb, 0x3c, 0x1b,
+    0x2a, 0x17, 0x08, 0x78, 0x41, 0x31, 0x05, 0x12, 0x32, 0x30, 0x52, 0x05, 0x93, 0x04, 0x03, 0x12,
+    0x00, 0xaa, 0xd2, 0x89, 0x4d, 0x18, 0x99, 0x71, 0x31, 0x08, 0x12, 0xb1, 0x8a, 0x99, 0xf9, 0xca,
+    0xbc, 0x8f, 0x9b, 0x9c, 0x8a, 0x0a, 0x8a, 0x09, 0x09, 0x3a, 0x3f, 0x3c, 0x9e, 0xff, 0x0e, 0x00,
+    0x0c, 0x99, 0x98, 0xa0, 0xa8, 0xcc, 0xda, 0x00, 0x01, 0xbb, 0x0c, 0x00, 0x8b, 0x42, 0x33, 0x21,
+    0xdb, 0xb9, 0xa7, 0xa5, 0x92, 0x31, 0x37, 0x24, 0x23, 0x03, 0x91, 0x05, 0x14, 0x21, 0x20, 0x1a,
+    0x19, 0x29, 0x98, 0xfa, 0xd9, 0xb2, 0x85, 0x03, 0x03, 0x07, 0x82, 0x11, 0x34, 0x26, 0x01, 0x89,
+    0xb9, 0xc9, 0xa8, 0x9d, 0x8b, 0x9a, 0xbc, 0xaa, 0xbb, 0xf0, 0xc1, 0xc9, 0xa8, 0xa8, 0x80, 0x12,
+    0xa0, 0x24, 0x83, 0xbb, 0xb1, 0xfa, 0xaf, 0xcb, 0xba, 0x80, 0xab, 0x9c, 0x99, 0x09, 0x08, 0x2a,
+    0x70, 0x9a, 0x9e, 0x88, 0x2b, 0x4b, 0x1b, 0x50, 0x24, 0x12, 0x31, 0x01, 0xc0, 0xd8, 0x8b, 0x5a,
+    0x19, 0x2c, 0x79, 0x29, 0x39, 0x31, 0x06, 0x83, 0x11, 0x40, 0x48, 0x41, 0x35, 0x32, 0x00, 0xa0,
+    0xa1, 0x11, 0x1a, 0x9f, 0x0a, 0x89, 0x99, 0x21, 0x8e, 0x1c, 0x01, 0x01, 0x41, 0x22, 0x37, 0x11,
+    0x7b, 0x00, 0x0c, 0x00, 0x20, 0x15, 0x80, 0x82, 0xd2, 0x92, 0x93, 0x0a, 0x18, 0x29, 0x73, 0x21,
+    0x2e, 0x8e, 0x8b, 0x0c, 0x9b, 0xba, 0xe9, 0x98, 0xa9, 0xbb, 0xba, 0xbc, 0xaa, 0xe0, 0xa8, 0xa1,
+    0xab, 0x29, 0x98, 0xa9, 0x96, 0xb1, 0x8a, 0x1d, 0x9f, 0x8c, 0x8a, 0xbb, 0xa8, 0xb1, 0xf9, 0xc2,
+    0x91, 0x08, 0xcb, 0xb8, 0xe1, 0xaa, 0x0b, 0x8c, 0xac, 0x98, 0x90, 0x90, 0xc3, 0x11, 0x53, 0x88,
+    0x10, 0x04, 0xb3, 0xe1, 0x29, 0x10, 0xdc, 0x02, 0x06, 0x04, 0x05, 0x80, 0x10, 0x21, 0x80, 0x92,
+    0x14, 0x13, 0x71, 0x71, 0x10, 0x10, 0x83, 0x83, 0x33, 0x35, 0x34, 0x63, 0x30, 0x39, 0x59, 0x10,
+    0x02, 0x14, 0x22, 0x41, 0x11, 0x2a, 0x6b, 0x41, 0x34, 0x21, 0x31, 0x33, 0x18, 0x1c, 0x8c, 0x1b,
+    0x4a, 0x0c, 0xa1, 0xf2, 0xa0, 0xa2, 0xc0, 0x81, 0x11, 0x11, 0x46, 0x53, 0x23, 0x03, 0xa1, 0x00,
+    0x22, 0x05, 0x91, 0x9d, 0xdd, 0x01, 0x0b, 0x00, 0x9c, 0x88, 0xa3, 0x98, 0x09, 0x3a, 0x5a, 0x18,
+    0xb8, 0xa0, 0x35, 0x81, 0x70, 0x34, 0x59, 0x4a, 0x29, 0x0a, 0xb9, 0xcb, 0x8c, 0x8b, 0xac, 0x8a,
+    0xb8, 0xd9, 0x01, 0x93, 0x13, 0x1a, 0x9b, 0x00, 0xff, 0xab, 0xaa, 0x8d, 0x9a, 0xab, 0xb8, 0xcb,
+    0x8b, 0xca, 0xfa, 0xb8, 0xa9, 0x18, 0x19, 0x0d, 0x98, 0xc1, 0xa0, 0x90, 0xe1, 0x91, 0x91, 0xaf,
+    0x2b, 0x41, 0x01, 0xa9, 0xea, 0xd9, 0xa8, 0x08, 0x28, 0x1a, 0x38, 0x28, 0xa0, 0xb4, 0xd8, 0xfb,
+    0x9a, 0x18, 0x99, 0x2a, 0x4b, 0x8e, 0x19, 0x01, 0x04, 0x05, 0x11, 0x42, 0x12, 0xe8, 0xc9, 0xa0,
+    0x98, 0x8a, 0xbd, 0x0d, 0x19, 0x9a, 0x08, 0xa8, 0x9f, 0x90, 0xb1, 0x19, 0x9b, 0x9b, 0x13, 0x0c,
+    0x7b, 0x31, 0x30, 0x34, 0x14, 0x23, 0x83, 0x91, 0x59, 0x0d, 0x9d, 0x80, 0xa3, 0xb1, 0x15, 0x85,
+    0xa4, 0x94, 0x03, 0x03, 0x04, 0x04, 0x21, 0x13, 0x41, 0xff, 0x07, 0x00, 0xb2, 0x30, 0x72, 0x21,
+    0x92, 0x1a, 0x78, 0x33, 0x16, 0x13, 0x31, 0x53, 0x39, 0x72, 0x12, 0x01, 0x23, 0x11, 0x80, 0xb0,
+    0xa8, 0x16, 0x94, 0x00, 0x30, 0x85, 0x94, 0x05, 0x91, 0xa9, 0xa9, 0x10, 0x02, 0xb2, 0x53, 0x41,
+    0x3a, 0x73, 0x15, 0x80, 0x09, 0x11, 0x11, 0x19, 0x55, 0x31, 0x00, 0xb1, 0x13, 0x13, 0xdf, 0x0c,
+    0x88, 0xaa, 0x9d, 0x0a, 0x19, 0x3d, 0x7a, 0x38, 0x20, 0x18, 0x39, 0x73, 0x12, 0x01, 0xb8, 0xa0,
+    0x82, 0xf9, 0xca, 0x98, 0x02, 0xa0, 0x0b, 0x0a, 0x9f, 0x2b, 0x0a, 0xab, 0x91, 0x00, 0x32, 0x47,
+    0x40, 0x1d, 0x29, 0x43, 0x41, 0x11, 0xb9, 0x1a, 0x51, 0x29, 0xb0, 0xf8, 0xa9, 0xa1, 0xb2, 0xc9,
+    0xa9, 0xa8, 0xd1, 0xda, 0xa8, 0xb9, 0x9f, 0x09, 0xb8, 0x9d, 0x18, 0x91, 0xb1, 0xea, 0xda, 0x90,
+    0x80, 0xba, 0x0c, 0xb9, 0xf0, 0xa0, 0xa8, 0xaa, 0xcc, 0xca, 0xb1, 0xc0, 0x29, 0xff, 0x0e, 0x00,
+    0xa9, 0x09, 0x8a, 0x1c, 0x0b, 0x0e, 0x89, 0xa0, 0x4b, 0x6b, 0x30, 0x02, 0xd0, 0xc0, 0xd0, 0xb8,
+    0xa0, 0x98, 0x12, 0x2a, 0x2d, 0x2b, 0x30, 0x84, 0xa2, 0x07, 0x92, 0xa1, 0xb1, 0xaa, 0x00, 0xfc,
+    0xcd, 0x89, 0x10, 0x89, 0xab, 0xa8, 0x90, 0x9a, 0xae, 0x0a, 0x17, 0x04, 0x88, 0x0c, 0x09, 0x11,
+    0x91, 0x00, 0x42, 0x3c, 0x6b, 0x99, 0xb9, 0xd1, 0xc8, 0x00, 0x11, 0x08, 0xaa, 0x9b, 0x40, 0x40,
+    0x61, 0x16, 0x84, 0x02, 0x11, 0x21, 0x32, 0x12, 0xb2, 0xa6, 0x93, 0x31, 0x71, 0x11, 0x01, 0x34,
+    0x37, 0x92, 0x82, 0x23, 0x39, 0x80, 0x33, 0x57, 0x00, 0x09, 0x23, 0x43, 0x62, 0x20, 0x11, 0x03,
+    0xc8, 0x28, 0x30, 0x1c, 0x0e, 0x0a, 0x90, 0x04, 0x22, 0x43, 0x25, 0x33, 0x15, 0x94, 0x02, 0x20,
+    0x0c, 0x0a, 0x80, 0x11, 0xb4, 0xf2, 0xa1, 0xb1, 0x91, 0x12, 0xab, 0xbc, 0xd9, 0x8c, 0xae, 0xaa,
+    0x78, 0x00, 0x0b, 0x00, 0xa2, 0x88, 0x28, 0xc1, 0xd2, 0xc0, 0xa8, 0x33, 0x8a, 0xcf, 0xca, 0xb0,
+    0xa1, 0xb9, 0xae, 0x9a, 0xb9, 0xc9, 0xb8, 0x9e, 0x8c, 0x09, 0x19, 0x9b, 0x08, 0x45, 0x23, 0x11,
+    0x00, 0xac, 0x0b, 0x33, 0x13, 0xcf, 0xba, 0x10, 0x11, 0xb1, 0xf1, 0xb8, 0x29, 0x79, 0x29, 0x3a,
+    0x38, 0x15, 0x06, 0x03, 0x10, 0x11, 0x33, 0x37, 0x13, 0x13, 0x33, 0x08, 0x2c, 0x09, 0x24, 0x37,
+    0x91, 0x08, 0x01, 0x28, 0x32, 0x91, 0x01, 0xa5, 0x21, 0x38, 0x0e, 0x21, 0xb4, 0x0c, 0x4b, 0x0f,
+    0x1e, 0x19, 0x98, 0x81, 0x02, 0x38, 0x3c, 0x9b, 0x9d, 0x2b, 0x0a, 0xa0, 0xa2, 0xb4, 0xd9, 0xad,
+    0xac, 0x99, 0x0c, 0x9e, 0xbb, 0x8c, 0x0d, 0x9a, 0x9a, 0x0b, 0xba, 0xf1, 0xa2, 0x88, 0x30, 0x09,
+    0x99, 0x94, 0x22, 0x71, 0x43, 0x40, 0x08, 0xaa, 0x68, 0x71, 0x10, 0x99, 0x88, 0x03, 0x13, 0x81,
+    0x02, 0x17, 0x12, 0x59, 0x1a, 0x00, 0x0f, 0x00, 0x42, 0x00, 0x00, 0x10, 0x32, 0x33, 0x31, 0x43,
+    0x03, 0xf0, 0xb9, 0x91, 0x93, 0xa0, 0x93, 0xca, 0x7b, 0x81, 0xb9, 0x3a, 0xad, 0xad, 0xb9, 0xb8,
+    0x89, 0x9f, 0xba, 0xba, 0xaa, 0xa8, 0x1f, 0x1b, 0xdb, 0xc1, 0xc2, 0xbb, 0x9b, 0x1a, 0x1a, 0xa9,
+    0x3e, 0x2f, 0x3b, 0x38, 0x2b, 0x5b, 0x04, 0x92, 0x13, 0x04, 0x13, 0x41, 0x34, 0x25, 0x30, 0x38,
+    0x38, 0x71, 0x40, 0x18, 0x29, 0x43, 0xa2, 0xb0, 0x91, 0xba, 0xab, 0xfc, 0x9d, 0x29, 0x9b, 0x9b,
+    0x08, 0x39, 0x4a, 0x1a, 0xa4, 0xf9, 0xcb, 0xa8, 0x2a, 0x3a, 0x9e, 0x1b, 0x11, 0x8c, 0x2a, 0xb8,
+    0xc0, 0xd8, 0x1a, 0x50, 0x08, 0x32, 0x17, 0x03, 0x32, 0x3a, 0x59, 0x02, 0xb2, 0xa1, 0x86, 0x24,
+    0x31, 0x38, 0x31, 0x44, 0x30, 0x70, 0x28, 0x2b, 0x4a, 0x09, 0xc9, 0xf3, 0xc8, 0x09, 0x10, 0x81,
+    0x02, 0x92, 0xd1, 0x83, 0x89, 0x0d, 0x09, 0xe8, 0x3c, 0x00, 0x0b, 0x00, 0xda, 0x09, 0x1a, 0x9c,
+    0x99, 0x90, 0x99, 0x1b, 0xc9, 0xc1, 0xb2, 0x1b, 0x6c, 0x80, 0x28, 0x73, 0x12, 0x32, 0x34, 0x26,
+    0x22, 0x18, 0x10, 0x11, 0x39, 0x3b, 0x3b, 0x71, 0x5a, 0x2a, 0x9a, 0x0a, 0xb0, 0xe9, 0xb0, 0x89,
+    0x8e, 0x0c, 0x1a, 0xac, 0xa8, 0xc9, 0xbb, 0xbb, 0xcc, 0xc8, 0xe8, 0xa0, 0x90, 0x2b, 0x68, 0x18,
+    0x31, 0x43, 0x30, 0x31, 0x02, 0xd9, 0xc1, 0x14, 0x86, 0x93, 0x82, 0x98, 0xa0, 0x07, 0xb2, 0xb1,
+    0xa5, 0xc3, 0x83, 0x02, 0x3a, 0x09, 0x09, 0x30, 0x1a, 0x71, 0x52, 0x3b, 0x08, 0x91, 0x82, 0xc3,
+    0x97, 0xb4, 0xdb, 0x9b, 0x89, 0xaa, 0xd0, 0xc8, 0xa0, 0xb8, 0xac, 0x09, 0xa1, 0x9a, 0x29, 0x38,
+    0x0f, 0x3d, 0x29, 0x28, 0x34, 0x26, 0x31, 0x09, 0xb0, 0xb2, 0x12, 0x17, 0xb5, 0x83, 0x15, 0x11,
+    0x30, 0x03, 0x84, 0x95, 0xa0, 0x08, 0xa3, 0xd1, 0xb3, 0xd3, 0x09, 0x2c, 0x70, 0x00, 0x08, 0x00,
+    0x0f, 0x9a, 0xc8, 0xba, 0x8a, 0xc9, 0xb9, 0x81, 0xa8, 0x33, 0x16, 0x11, 0xb1, 0xfa, 0xab, 0x1c,
+    0x0f, 0x0c, 0x08, 0x91, 0x89, 0x9a, 0xa8, 0x91, 0xe3, 0xb2, 0x01, 0x48, 0x51, 0x33, 0x43, 0x12,
+    0x10, 0x04, 0xb3, 0x63, 0x31, 0x2b, 0x5a, 0x01, 0x83, 0xb4, 0x93, 0xb5, 0xe1, 0xa1, 0xb1, 0xd8,
+    0xb0, 0xb8, 0xc9, 0xd8, 0x90, 0xa1, 0xb3, 0x20, 0x68, 0x11, 0xa2, 0xb5, 0xd0, 0xc9, 0xda, 0x99,
+    0x8a, 0xbd, 0xb9, 0xc9, 0x8b, 0x8c, 0x9c, 0x99, 0xb8, 0x89, 0x2a, 0x58, 0x33, 0x5a, 0x7a, 0x08,
+    0x01, 0x03, 0x2a, 0x79, 0x11, 0x08, 0x10, 0x1d, 0x30, 0x82, 0x52, 0x88, 0x4a, 0x35, 0x88, 0x40,
+    0x33, 0x00, 0x26, 0x33, 0x63, 0x21, 0x30, 0x32, 0x20, 0xa1, 0xb5, 0x82, 0x09, 0x8b, 0x43, 0x00,
+    0x3b, 0x07, 0xc2, 0xb3, 0x95, 0x94, 0x91, 0x19, 0x19, 0xa3, 0x87, 0x81, 0x0b, 0x0a, 0xdd, 0xbb,
+    0x27, 0x00, 0x09, 0x00, 0x89, 0x18, 0x9d, 0x8c, 0xab, 0xb9, 0xc8, 0x9c, 0x0b, 0xd9, 0xb9, 0x99,
+    0x19, 0x08, 0xa6, 0xa5, 0xd1, 0xa8, 0x03, 0x28, 0x0c, 0xbd, 0xfa, 0x90, 0x28, 0x19, 0x49, 0x39,
+    0x2b, 0x31, 0x31, 0x73, 0x35, 0x33, 0x14, 0xa2, 0x05, 0x13, 0x33, 0x34, 0x41, 0x30, 0x10, 0xa2,
+    0xb5, 0x32, 0x50, 0x11, 0xa1, 0x12, 0x25, 0x04, 0x21, 0x30, 0x41, 0x25, 0x11, 0x03, 0x05, 0x23,
+    0x37, 0x22, 0x00, 0x11, 0x0d, 0x20, 0x93, 0x99, 0x87, 0xb2, 0x13, 0x07, 0x81, 0x80, 0xd0, 0xb1,
+    0xda, 0x8a, 0x90, 0xc0, 0x8b, 0x2a, 0xb0, 0xdd, 0x98, 0xc2, 0xa1, 0xa2, 0xb8, 0x0b, 0x9b, 0xfa,
+    0xb9, 0xcb, 0x9f, 0x2b, 0x1a, 0x50, 0x20, 0xaa, 0x01, 0xa2, 0xeb, 0xab, 0x8c, 0x9d, 0xbc, 0xa8,
+    0xb8, 0x0d, 0x8b, 0x99, 0x19, 0x0f, 0x1b, 0x2b, 0x3a, 0x09, 0x13, 0x07, 0x29, 0x5a, 0x9b, 0x9d,
+    0xa0, 0xcb, 0xaa, 0xa9, 0x67, 0xff, 0x07, 0x00, 0x9b, 0x1d, 0x48, 0x10, 0x69, 0x48, 0x28, 0x13,
+    0xc3, 0x00, 0x51, 0x3a, 0x20, 0x11, 0x14, 0x97, 0xa2, 0x11, 0x3b, 0x1b, 0x8a, 0x29, 0x19, 0x7b,
+    0x69, 0x10, 0x02, 0x32, 0x25, 0xa2, 0x03, 0x22, 0x29, 0x28, 0x8f, 0x38, 0xa1, 0xbb, 0x14, 0xb3,
+    0x27, 0x87, 0x91, 0x98, 0xb0, 0xb9, 0xba, 0xeb, 0x0b, 0x09, 0x30, 0x35, 0x91, 0x3a, 0x22, 0x9f,
+    0x01, 0x11, 0x71, 0x21, 0x08, 0x93, 0xa6, 0xa2, 0xb2, 0x93, 0xba, 0x8f, 0x39, 0x8d, 0x3a, 0x1c,
+    0x8f, 0x09, 0xba, 0xa9, 0xda, 0xab, 0x9a, 0xae, 0x99, 0xa9, 0x0f, 0x0a, 0x98, 0x98, 0xb9, 0xa9,
+    0x89, 0x2f, 0x5a, 0x00, 0x99, 0xba, 0xda, 0xba, 0xba, 0xa0, 0xf1, 0xab, 0x4b, 0x3a, 0x2b, 0x8e,
+    0x9c, 0xa9, 0xb0, 0xa0, 0x98, 0x88, 0xc2, 0xbb, 0x2c, 0x2d, 0x2c, 0x19, 0x20, 0x30, 0x5b, 0x21,
+    0x39, 0x0f, 0xad, 0x0a, 0x1a, 0xab, 0x91, 0x14, 0xc9, 0xfd, 0x03, 0x00, 0x51, 0x23, 0xa1, 0xb3,
+    0xa4, 0x90, 0x2b, 0x23, 0x92, 0x2d, 0x0b, 0xf0, 0xc2, 0xb1, 0x0a, 0xaa, 0xf9, 0xa0, 0x91, 0x0b,
+    0x4b, 0x2a, 0x69, 0x78, 0x40, 0x12, 0x05, 0x03, 0x13, 0x20, 0x30, 0x19, 0xb0, 0xb5, 0x94, 0x82,
+    0x13, 0x15, 0x31, 0x22, 0x07, 0x32, 0x22, 0x03, 0x07, 0x03, 0x34, 0x33, 0x73, 0x31, 0x28, 0x49,
+    0x19, 0x1a, 0x3a, 0x5a, 0x08, 0x99, 0x20, 0x8a, 0x30, 0x36, 0x3a, 0x15, 0x97, 0xa2, 0x83, 0x26,
+    0x25, 0x23, 0x12, 0x90, 0x0a, 0x08, 0xca, 0xb9, 0x9b, 0xc9, 0xb1, 0x30, 0x7a, 0x59, 0x39, 0x18,
+    0x2a, 0x5a, 0x40, 0x41, 0x50, 0x30, 0x19, 0x28, 0x41, 0x52, 0x81, 0x98, 0x12, 0x87, 0x92, 0xb2,
+    0xf9, 0xc9, 0x09, 0x19, 0xaa, 0x2b, 0x42, 0x81, 0x10, 0x96, 0x94, 0x31, 0x0c, 0xab, 0x21, 0x03,
+    0xd9, 0x91, 0xb2, 0xdb, 0x8c, 0x39, 0xb0, 0xae, 0x4b, 0x0b, 0x8d, 0x8b, 0xea, 0x00, 0x08, 0x00,
+    0xac, 0xb9, 0xc9, 0x1a, 0x1a, 0x1e, 0x9a, 0xb0, 0xd1, 0xe8, 0xa0, 0x99, 0x0d, 0x1a, 0x8c, 0x09,
+    0xa8, 0x28, 0x6b, 0x3d, 0x3b, 0x99, 0xa0, 0xa9, 0xb0, 0xe8, 0x19, 0x82, 0x11, 0x17, 0xb3, 0x12,
+    0x32, 0x99, 0x99, 0xba, 0x9d, 0x0f, 0x8c, 0xc9, 0xa0, 0xd9, 0xc9, 0x08, 0x09, 0x09, 0x09, 0x3c,
+    0x0b, 0xc0, 0x07, 0x93, 0x92, 0x13, 0x63, 0x43, 0x10, 0x2a, 0x2a, 0x08, 0x24, 0x35, 0x11, 0x18,
+    0x91, 0x83, 0x3a, 0x8f, 0x2a, 0xb0, 0x2b, 0x6b, 0x82, 0x86, 0x01, 0x42, 0x53, 0x33, 0x33, 0x73,
+    0x23, 0xa1, 0x91, 0xb3, 0xb8, 0x94, 0x90, 0x7b, 0x42, 0x09, 0x38, 0x24, 0x18, 0x3b, 0x0d, 0x89,
+    0x9a, 0x2a, 0x29, 0x31, 0x06, 0xb3, 0x07, 0x87, 0x02, 0x20, 0x1a, 0x8b, 0x88, 0x90, 0x1c, 0xaa,
+    0xfb, 0xa9, 0x98, 0x18, 0x41, 0x1a, 0x8f, 0x2a, 0x1a, 0x1b, 0x38, 0x05, 0xa2, 0xbc, 0xbd, 0xab,
+    0xc6, 0x00, 0x06, 0x00, 0x9c, 0x8d, 0x8d, 0x9b, 0x2b, 0x0a, 0xab, 0x0e, 0x0c, 0x98, 0xb9, 0xb3,
+    0xa5, 0x19, 0x29, 0xbb, 0xaf, 0x8d, 0x99, 0x98, 0x9b, 0x8d, 0xbc, 0xe9, 0xa1, 0xb0, 0xa0, 0xa8,
+    0x90, 0x22, 0x22, 0x44, 0x24, 0x12, 0x23, 0x93, 0x34, 0x30, 0x0f, 0x3c, 0x2a, 0x59, 0x11, 0x99,
+    0x29, 0x0b, 0xab, 0x10, 0x9d, 0xa9, 0x94, 0x40, 0x74, 0x03, 0x21, 0x45, 0x32, 0x30, 0x00, 0x3c,
+    0x3b, 0xbb, 0xd2, 0xb8, 0x08, 0xa0, 0xe0, 0xa4, 0xb2, 0x91, 0x10, 0x2f, 0x1c, 0x1b, 0x2a, 0x49,
+    0x39, 0x59, 0x20, 0xaa, 0x01, 0x14, 0x5b, 0x19, 0x0e, 0x0b, 0xfa, 0xc9, 0x89, 0x9c, 0xaa, 0xb0,
+    0xba, 0xd9, 0xc9, 0x90, 0xc1, 0xa1, 0x11, 0x8c, 0x0b, 0x89, 0x2b, 0x30, 0x7a, 0x41, 0x18, 0x19,
+    0x92, 0x93, 0xa7, 0x92, 0x43, 0x91, 0x13, 0x02, 0x1f, 0x49, 0x2a, 0x4d, 0x3a, 0x09, 0x18, 0x60,
+    0x29, 0x09, 0x22, 0x13, 0x55, 0xff, 0x04, 0x00, 0x71, 0x62, 0x00, 0x00, 0x02, 0x81, 0x41, 0x21,
+    0x00, 0x3b, 0x1d, 0x2a, 0x95, 0xe8, 0x0a, 0x1b, 0x0d, 0x9a, 0xa9, 0x00, 0x98, 0x0c, 0x61, 0x39,
+    0x1d, 0x18, 0x01, 0x09, 0x9b, 0xaf, 0x0d, 0x8b, 0x9b, 0xb1, 0xba, 0xac, 0xa9, 0x09, 0x40, 0x79,
+    0x48, 0x80, 0x92, 0x73, 0x31, 0x01, 0x85, 0x86, 0x82, 0x11, 0x20, 0xa1, 0x94, 0x14, 0x82, 0x82,
+    0x82, 0x99, 0x3c, 0x2e, 0x3c, 0x1a, 0x9b, 0x48, 0x32, 0x3b, 0x3c, 0x2e, 0x8a, 0xf1, 0xb0, 0x90,
+    0x08, 0xc0, 0xa8, 0x34, 0x06, 0x02, 0xa0, 0xb8, 0xd3, 0xb8, 0x08, 0xd2, 0xa9, 0x5a, 0x3b, 0x19,
+    0x91, 0x93, 0xf0, 0x81, 0x03, 0xa8, 0x09, 0x7a, 0x00, 0xa4, 0x86, 0x23, 0x43, 0x42, 0x61, 0x40,
+    0x30, 0x19, 0x19, 0x98, 0xb9, 0xc9, 0xba, 0xb2, 0xf3, 0xb8, 0x01, 0x5a, 0x4a, 0x0a, 0x2a, 0x91,
+    0xa5, 0x86, 0x91, 0x92, 0x93, 0x08, 0x31, 0x19, 0x7c, 0x00, 0x02, 0x00, 0x0f, 0xad, 0xba, 0xb3,
+    0xa8, 0x2c, 0x8c, 0x1b, 0x31, 0x90, 0x09, 0x06, 0xa2, 0x91, 0x49, 0x70, 0x58, 0x38, 0x12, 0x40,
+    0x42, 0xaa, 0x3a, 0x34, 0x40, 0x24, 0xa3, 0xb8, 0x8c, 0x1f, 0x09, 0xa8, 0x0c, 0x1d, 0xaa, 0xb0,
+    0x90, 0xba, 0xeb, 0x99, 0xa9, 0xcc, 0x0b, 0x20, 0x99, 0x21, 0x23, 0x2b, 0x2c, 0x62, 0x17, 0x22,
+    0x31, 0xa2, 0x87, 0x82, 0x28, 0x41, 0x29, 0x2e, 0x2a, 0x80, 0x92, 0xd2, 0xa1, 0x28, 0x8a, 0xbc,
+    0x0a, 0x19, 0xd9, 0x80, 0x99, 0xba, 0x9b, 0xf9, 0xf0, 0xb1, 0xa0, 0x90, 0xb8, 0x9a, 0xa9, 0xae,
+    0x88, 0x19, 0x5a, 0x03, 0x02, 0x33, 0xb4, 0x96, 0x14, 0x40, 0x59, 0x39, 0x38, 0x59, 0x40, 0x11,
+    0x94, 0x93, 0x02, 0xc1, 0xe1, 0x90, 0x91, 0x80, 0x2b, 0x9e, 0x99, 0x80, 0xdb, 0x8a, 0xa8, 0xac,
+    0x3b, 0x1d, 0x2c, 0x40, 0x00, 0x10, 0x98, 0x8a, 0x27, 0x91, 0x99, 0xf9, 0x02, 0x00, 0x0b, 0x00,
+    0xbb, 0x98, 0xb2, 0x14, 0xaa, 0x0f, 0x01, 0xa8, 0x3b, 0x1b, 0x9c, 0xb3, 0xc7, 0x92, 0x01, 0x80,
+    0x10, 0x86, 0xa4, 0x12, 0x7a, 0x3a, 0x0a, 0x19, 0x90, 0xa9, 0x32, 0x39, 0x3c, 0x61, 0x88, 0xb2,
+    0x94, 0x02, 0xb3, 0x87, 0x02, 0x19, 0x9b, 0x1c, 0x1b, 0xbf, 0xe9, 0xc9, 0x89, 0x8a, 0xcb, 0xb1,
+    0xa0, 0x80, 0x93, 0x53, 0x5b, 0x2a, 0x98, 0xd9, 0xc3, 0xc0, 0x90, 0x81, 0x3a, 0x62, 0x48, 0x21,
+    0x14, 0x07, 0x02, 0x38, 0x23, 0x22, 0x73, 0x88, 0x88, 0xb2, 0x9a, 0x39, 0x08, 0xe8, 0xc9, 0x19,
+    0x2c, 0x1d, 0xb9, 0xc8, 0x08, 0x1c, 0x4a, 0x58, 0x40, 0x10, 0x91, 0xb5, 0xb1, 0x9a, 0x91, 0xa2,
+    0x0c, 0x1e, 0x0c, 0x9c, 0x89, 0x19, 0x2b, 0x9b, 0xc8, 0xd5, 0xb1, 0x22, 0x89, 0x1b, 0x29, 0x98,
+    0x99, 0x11, 0x87, 0xa1, 0x18, 0x82, 0xf3, 0x10, 0x28, 0x9a, 0x97, 0x91, 0x20, 0x10, 0x01, 0x05,
+    0xa8, 0xff, 0x04, 0x00, 0x03, 0x34, 0x20, 0x52, 0x17, 0x21, 0x40, 0x22, 0x42, 0x11, 0x00, 0x92,
+    0x03, 0x25, 0x24, 0x15, 0x18, 0x1d, 0x9c, 0x90, 0xa2, 0xac, 0x8a, 0xeb, 0x0b, 0x1b, 0x8e, 0xa9,
+    0xd2, 0xc3, 0xa0, 0xa2, 0xe3, 0xa2, 0x94, 0xa0, 0x02, 0xb1, 0x11, 0x15, 0x0a, 0x9a, 0x9c, 0x3d,
+    0x50, 0x02, 0xb0, 0xd9, 0x99, 0x0c, 0x98, 0xb9, 0xac, 0xcc, 0xa9, 0x09, 0x2b, 0x39, 0x3c, 0x5b,
+    0x8b, 0x4b, 0x11, 0x83, 0x27, 0x05, 0x31, 0x60, 0x30, 0x43, 0x13, 0x10, 0x10, 0x80, 0x93, 0xa6,
+    0x83, 0x00, 0x1a, 0x4c, 0x4d, 0x19, 0xa0, 0x10, 0x38, 0x2d, 0x5a, 0x28, 0x28, 0x21, 0x1a, 0x21,
+    0x17, 0x1a, 0x0c, 0x98, 0x28, 0x74, 0x22, 0x41, 0x10, 0x9b, 0x30, 0x13, 0x8c, 0x18, 0xba, 0xaf,
+    0xb9, 0x9c, 0xa9, 0x90, 0x1f, 0x0d, 0x9a, 0xa9, 0xc0, 0x99, 0x21, 0xca, 0xbb, 0xe1, 0xb0, 0x90,
+    0x2b, 0x79, 0x01, 0xb0, 0xfb, 0xff, 0x06, 0x00, 0xd9, 0x9a, 0xba, 0x9b, 0x23, 0xf3, 0xbc, 0x9a,
+    0x1a, 0x82, 0xf9, 0xaa, 0x10, 0x0b, 0x0e, 0x1c, 0x19, 0xab, 0xab, 0xb8, 0x0d, 0x8f, 0x0a, 0x02,
+    0xd2, 0x93, 0x85, 0x02, 0x20, 0x8b, 0x8c, 0x89, 0x8d, 0x8a, 0x0a, 0x2c, 0x89, 0x20, 0x7b, 0x89,
+    0x85, 0x04, 0x21, 0x82, 0xa2, 0x87, 0x92, 0x33, 0x25, 0x01, 0x22, 0x35, 0x20, 0x8c, 0x9b, 0x11,
+    0x33, 0x29, 0x0f, 0x30, 0x30, 0x3b, 0x43, 0x24, 0x42, 0x31, 0x20, 0x15, 0x82, 0xb8, 0x97, 0x94,
+    0x93, 0x80, 0x32, 0x43, 0x69, 0x51, 0x12, 0x11, 0x01, 0x1b, 0x4b, 0x1b, 0x30, 0x99, 0xad, 0xc1,
+    0xe0, 0x01, 0xb2, 0xe2, 0x95, 0x93, 0x01, 0x20, 0x33, 0x72, 0x59, 0x19, 0x08, 0x20, 0x4a, 0x48,
+    0x80, 0x90, 0xa2, 0x08, 0x63, 0x89, 0x8b, 0x9a, 0xda, 0xb0, 0xba, 0x9d, 0x0c, 0x2d, 0x2b, 0x19,
+    0x8b, 0x4a, 0x85, 0x22, 0x62, 0x00, 0x12, 0xa2, 0xd2, 0x00, 0x03, 0x00, 0x21, 0x73, 0x2a, 0x9a,
+    0xce, 0xcb, 0xa9, 0xa9, 0xbb, 0xad, 0x99, 0xa8, 0x80, 0xc0, 0xa8, 0x10, 0xc1, 0xa6, 0xa3, 0xcb,
+    0xae, 0x99, 0x1a, 0x0a, 0xf2, 0x82, 0x23, 0x10, 0x87, 0xb3, 0xa3, 0xa2, 0x90, 0x05, 0x00, 0x99,
+    0xaf, 0x0d, 0x98, 0xc8, 0xa2, 0xd8, 0xa8, 0xa2, 0x00, 0x09, 0x99, 0x93, 0xa1, 0x45, 0x25, 0x83,
+    0x14, 0x18, 0x01, 0x87, 0x88, 0x0f, 0x0a, 0x90, 0x91, 0x90, 0x11, 0x18, 0xcb, 0xb2, 0xf2, 0xc2,
+    0xb1, 0xb1, 0xb2, 0x0a, 0x3a, 0x08, 0x2d, 0x6a, 0x18, 0x41, 0x40, 0x00, 0x9b, 0x0a, 0x08, 0x3b,
+    0x0c, 0x1f, 0x3a, 0x3b, 0x7b, 0x32, 0x03, 0x05, 0x11, 0x20, 0x0e, 0x0a, 0xc9, 0x08, 0x21, 0x0a,
+    0x11, 0x23, 0x74, 0x63, 0x40, 0x28, 0x8a, 0x89, 0x90, 0x11, 0xaa, 0x0e, 0xa9, 0xdb, 0x3b, 0x4b,
+    0x38, 0xa3, 0xb9, 0x30, 0x92, 0xd1, 0x97, 0x92, 0x08, 0x09, 0x78, 0x38, 0x0d, 0x00, 0x0a, 0x00,
+    0x0b, 0x39, 0x59, 0x4b, 0x10, 0xb0, 0xd2, 0xb8, 0xc8, 0xd3, 0xa0, 0x3a, 0x30, 0x38, 0x3b, 0x60,
+    0x08, 0xb0, 0xc3, 0x31, 0x79, 0x33, 0x94, 0xa3, 0x33, 0x20, 0x1d, 0x19, 0x8d, 0x9c, 0xf8, 0xb0,
+    0x08, 0x19, 0x1a, 0x58, 0x31, 0x08, 0x91, 0xb1, 0x14, 0x70, 0x20, 0x91, 0xfa, 0xa8, 0x90, 0x02,
+    0xc4, 0xb2, 0x90, 0xab, 0x9c, 0xbc, 0xca, 0xd1, 0xa9, 0x1a, 0x99, 0x0b, 0xfb, 0xda, 0x92, 0xc9,
+    0xa9, 0x2a, 0x9c, 0xe8, 0x10, 0x48, 0x0a, 0x02, 0x96, 0xa2, 0xb4, 0x82, 0x03, 0xa1, 0x50, 0x2a,
+    0xbd, 0xc0, 0xd1, 0x88, 0xb1, 0xe1, 0xa2, 0x90, 0x89, 0x90, 0xba, 0x1b, 0x53, 0x02, 0x51, 0x41,
+    0x09, 0x80, 0x24, 0x23, 0x03, 0x53, 0x71, 0x38, 0x9d, 0x99, 0xd0, 0xa0, 0x80, 0x9a, 0x00, 0x10,
+    0x79, 0x70, 0x29, 0x09, 0x18, 0x58, 0x4a, 0x3a, 0x30, 0x48, 0x52, 0x20, 0x49, 0x30, 0x40, 0x30,
+    0x2e, 0x00, 0x0b, 0x00, 0x20, 0x00, 0x9d, 0x4b, 0x38, 0x0a, 0x90, 0xc2, 0x96, 0x03, 0x14, 0x02,
+    0x39, 0x28, 0x90, 0x05, 0x13, 0x83, 0x97, 0xb3, 0x05, 0x14, 0x02, 0xd2, 0xd1, 0x81, 0x00, 0x32,
+    0x33, 0x22, 0x98, 0xce, 0x89, 0x00, 0x88, 0xa0, 0x8f, 0x3d, 0x09, 0x10, 0x11, 0xb0, 0x15, 0x33,
+    0x3b, 0x79, 0x29, 0x8d, 0x9a, 0xab, 0x9c, 0x1a, 0xcb, 0xba, 0x18, 0x2a, 0x3d, 0x6c, 0x39, 0x88,
+    0x99, 0x21, 0x30, 0x3b, 0x9c, 0xb8, 0xbb, 0xcf, 0xb8, 0xe0, 0xb8, 0x99, 0xa8, 0xaa, 0x90, 0xb1,
+    0xb0, 0xf3, 0xb9, 0x03, 0xb0, 0x69, 0x19, 0x9a, 0x93, 0xf0, 0x89, 0x0b, 0x3c, 0x99, 0x1d, 0x39,
+    0xa1, 0x97, 0xa3, 0x32, 0x04, 0x83, 0x34, 0x42, 0x40, 0xcb, 0xa9, 0xc2, 0xc9, 0x84, 0x11, 0x5b,
+    0x2a, 0x2b, 0x3b, 0x0d, 0x3a, 0x99, 0xa3, 0xa7, 0xb5, 0x94, 0xa1, 0x81, 0x14, 0x93, 0x05, 0x03,
+    0x51, 0x01, 0xc8, 0xc9, 0x4e, 0x00, 0x0b, 0x00, 0x18, 0x3a, 0x1d, 0x0a, 0xa0, 0xb0, 0xaa, 0xdb,
+    0xf9, 0xb1, 0xb3, 0xe8, 0x98, 0xa8, 0x89, 0x10, 0x19, 0x33, 0x72, 0x39, 0xa8, 0xb1, 0x3b, 0xbf,
+    0x0c, 0xb9, 0x09, 0x30, 0x0b, 0x79, 0x5a, 0x0d, 0x0a, 0x18, 0xa9, 0x99, 0xd1, 0xc0, 0x00, 0x90,
+    0xe3, 0x94, 0x93, 0x91, 0x12, 0x84, 0x33, 0x17, 0x83, 0x02, 0xd1, 0xc9, 0x19, 0x28, 0x90, 0xb1,
+    0x92, 0x53, 0x51, 0x81, 0x11, 0x3a, 0x2d, 0x08, 0x9b, 0x6b, 0x00, 0xa3, 0x87, 0x81, 0x38, 0x11,
+    0x03, 0x07, 0x02, 0x84, 0x91, 0x12, 0xb4, 0xa1, 0x84, 0xca, 0x3b, 0x23, 0x9c, 0x3a, 0x2e, 0x2c,
+    0x0d, 0x0a, 0xb2, 0xb2, 0x3a, 0x1d, 0x12, 0x93, 0x31, 0x73, 0x20, 0x91, 0x98, 0x1b, 0xbf, 0xba,
+    0xb9, 0x0b, 0x8e, 0x0c, 0x3a, 0x0d, 0x2b, 0x20, 0x90, 0x17, 0x85, 0x82, 0x86, 0x82, 0xa1, 0xb1,
+    0xb0, 0xa2, 0xa8, 0x8b, 0x21, 0x2e, 0x3d, 0x1a, 0xfc, 0xff, 0x06, 0x00, 0x80, 0x12, 0x98, 0xa7,
+    0x96, 0x11, 0x02, 0x04, 0x11, 0x24, 0x17, 0x01, 0x10, 0x19, 0x99, 0x90, 0x8a, 0x0d, 0x0a, 0x2c,
+    0x1c, 0x8c, 0xa9, 0xb9, 0x1b, 0x1a, 0xda, 0xc1, 0xe4, 0xa1, 0x28, 0x3a, 0x10, 0x91, 0x0c, 0x1b,
+    0x9f, 0xab, 0x09, 0x3a, 0x3d, 0x19, 0x1b, 0x78, 0x81, 0xa0, 0x02, 0xc2, 0x81, 0xd2, 0x99, 0x2a,
+    0xbf, 0xa9, 0x98, 0x2b, 0x3b, 0x8f, 0x29, 0x49, 0x21, 0x94, 0x07, 0x04, 0x81, 0x01, 0x98, 0xa0,
+    0x80, 0x4b, 0x4d, 0x3b, 0x3b, 0x1a, 0x29, 0x5a, 0x0d, 0x2b, 0x2d, 0x1b, 0x3a, 0x30, 0x89, 0x00,
+    0x11, 0x9f, 0x08, 0xe0, 0x8b, 0x18, 0xbc, 0xda, 0xc1, 0x00, 0x19, 0x89, 0x19, 0x18, 0x23, 0x1e,
+    0x4b, 0x08, 0x0b, 0x51, 0x2a, 0x4b, 0x1a, 0xab, 0xb0, 0x3a, 0x2f, 0x0e, 0x89, 0x99, 0x88, 0x09,
+    0x09, 0xb4, 0xb5, 0x11, 0x31, 0x20, 0x5b, 0x3f, 0x4a, 0x11, 0x22, 0x40, 0xa9, 0xff, 0x09, 0x00,
+    0x21, 0xa0, 0xb3, 0xb9, 0x8f, 0xc8, 0xf2, 0xb1, 0x00, 0x19, 0x9a, 0x21, 0x15, 0xb1, 0x83, 0x03,
+    0x41, 0x59, 0x5b, 0x5a, 0x39, 0x3b, 0x40, 0x29, 0x2a, 0x1c, 0x0f, 0x89, 0xb1, 0xc1, 0xa2, 0x83,
+    0xa2, 0x01, 0x87, 0xa1, 0x9a, 0xc9, 0xc8, 0xc0, 0xb0, 0xb1, 0xb1, 0x92, 0x49, 0x7a, 0x29, 0x1a,
+    0x93, 0x97, 0x83, 0x41, 0x49, 0x3a, 0x01, 0xa3, 0x12, 0x95, 0xf1, 0x00, 0x10, 0xa9, 0x81, 0x2a,
+    0x0a, 0xb3, 0x17, 0x12, 0x23, 0x26, 0x32, 0x62, 0x68, 0x38, 0x18, 0x89, 0x81, 0xbb, 0x0a, 0xf1,
+    0xc0, 0x82, 0x08, 0x82, 0xb5, 0x11, 0x61, 0x80, 0x93, 0x86, 0x23, 0x31, 0x18, 0x2c, 0x3b, 0xb9,
+    0xd9, 0x0a, 0x3c, 0x2e, 0x1c, 0x88, 0x98, 0x98, 0x89, 0x0b, 0x4d, 0x3c, 0x0b, 0x98, 0x21, 0x29,
+    0x2f, 0x4b, 0x0c, 0x2b, 0x8a, 0x0f, 0x88, 0xd8, 0x88, 0x00, 0xa1, 0x92, 0x91, 0x04, 0x81, 0x59,
+    0x13, 0x00, 0x06, 0x00, 0x41, 0x41, 0x11, 0xa1, 0x95, 0x01, 0x3a, 0x39, 0xd0, 0xa2, 0x92, 0x30,
+    0x8f, 0x1a, 0x00, 0x3c, 0x70, 0x00, 0x90, 0x94, 0xc1, 0xa4, 0x83, 0x50, 0x58, 0x19, 0x8a, 0x0b,
+    0x28, 0x1b, 0x2b, 0xdb, 0xb2, 0xe3, 0xb1, 0xa4, 0xc3, 0x80, 0x10, 0x0a, 0x2b, 0x59, 0x10, 0xd0,
+    0xc5, 0xc4, 0xb2, 0x91, 0x21, 0x00, 0x18, 0x00, 0x01, 0x6a, 0x4b, 0x00, 0xb2, 0x99, 0xa8, 0x0e,
+    0x89, 0xbb, 0x1d, 0x2d, 0x8b, 0xac, 0x99, 0xb0, 0xcb, 0x91, 0xd2, 0xa1, 0xc4, 0x93, 0x08, 0xab,
+    0x90, 0x00, 0x1c, 0x39, 0xb0, 0xfb, 0x99, 0xb2, 0xc5, 0x93, 0xb2, 0x19, 0x2c, 0x8d, 0x03, 0x95,
+    0xa1, 0xa3, 0xb2, 0x91, 0x1b, 0x20, 0xcb, 0x1c, 0x19, 0xad, 0x1a, 0x5c, 0x8b, 0xb0, 0xa3, 0x0b,
+    0x9f, 0x9b, 0x1b, 0x39, 0x1b, 0x43, 0x25, 0x33, 0x03, 0xf2, 0xa0, 0x02, 0xbb, 0x9d, 0xc2, 0xb3,
+    0x09, 0x1d, 0x31, 0x94, 0x80, 0xff, 0x04, 0x00, 0x1b, 0x72, 0x10, 0x19, 0x00, 0x53, 0x42, 0x80,
+    0x18, 0x9c, 0x8c, 0x09, 0x0a, 0x38, 0x2f, 0x1d, 0x00, 0x98, 0x28, 0x33, 0x19, 0x44, 0x07, 0x82,
+    0x93, 0x81, 0x03, 0x95, 0x02, 0x12, 0x81, 0xb3, 0xfd, 0x90, 0x21, 0x3c, 0x2b, 0x9b, 0x1c, 0x39,
+    0xa0, 0xe2, 0xa2, 0xb3, 0xe3, 0xa2, 0x13, 0x13, 0x4e, 0x39, 0x18, 0x1a, 0x11, 0x85, 0x03, 0x21,
+    0x9a, 0xbb, 0x03, 0x51, 0x10, 0xf3, 0xd2, 0x90, 0x89, 0x91, 0x50, 0x20, 0xaa, 0x89, 0xbb, 0x1c,
+    0x1a, 0xbf, 0x9c, 0xaa, 0x09, 0x3b, 0x1f, 0x3b, 0x1e, 0x29, 0x18, 0x49, 0x10, 0x10, 0x33, 0x25,
+    0x13, 0x03, 0xb9, 0xcf, 0x88, 0x19, 0x6c, 0x19, 0x9a, 0x18, 0x9a, 0x8c, 0x89, 0x00, 0xa5, 0xb6,
+    0xa3, 0xb8, 0xb0, 0xc1, 0x8b, 0x1d, 0x9b, 0x93, 0xa1, 0x1a, 0x27, 0x85, 0x01, 0x11, 0x20, 0x4b,
+    0x3a, 0xa9, 0x90, 0x45, 0x10, 0x10, 0x30, 0x3d, 0xce, 0xff, 0x03, 0x00, 0x3d, 0x19, 0x91, 0x4a,
+    0x3c, 0x0a, 0xc2, 0x91, 0x79, 0x39, 0x8c, 0xb4, 0xb3, 0x4a, 0x5b, 0x09, 0x91, 0x92, 0x18, 0x78,
+    0x21, 0xa2, 0x95, 0x06, 0x22, 0x10, 0x91, 0xb2, 0x11, 0x2b, 0x1c, 0xb9, 0xc0, 0x23, 0x5b, 0x2f,
+    0x5b, 0x18, 0x89, 0x90, 0x93, 0x83, 0x13, 0x70, 0x28, 0x99, 0xa0, 0xd1, 0x98, 0x98, 0x9c, 0x89,
+    0xf1, 0x90, 0x28, 0x1f, 0x29, 0x00, 0x81, 0xc1, 0x02, 0x33, 0x5c, 0x29, 0x93, 0x15, 0x17, 0x90,
+    0x88, 0x98, 0x9a, 0x9b, 0xcb, 0x1a, 0x1b, 0x1f, 0x3b, 0x9c, 0x91, 0x91, 0x1e, 0x19, 0xba, 0x92,
+    0x85, 0x59, 0x29, 0x0b, 0x3b, 0x0e, 0x1e, 0x89, 0xa2, 0x83, 0xb0, 0xb3, 0xb5, 0x18, 0x40, 0x1f,
+    0x3a, 0x1a, 0x39, 0x31, 0x1f, 0x4b, 0x8c, 0x9b, 0x91, 0xc0, 0xb0, 0xa9, 0x29, 0x0d, 0x8c, 0xb2,
+    0xc9, 0x82, 0x93, 0x33, 0x17, 0x05, 0x14, 0x19, 0x8b, 0xc9, 0x11, 0x6a, 0xcf, 0xff, 0x0b, 0x00,
+    0x2c, 0x1a, 0x08, 0x3a, 0x3c, 0x1c, 0x9a, 0x91, 0xb4, 0xf2, 0xa1, 0x92, 0x92, 0xb1, 0x01, 0x24,
+    0xb3, 0xb3, 0x07, 0xa5, 0x03, 0x13, 0x82, 0x00, 0x0d, 0xc9, 0xd1, 0xa2, 0xe2, 0x90, 0x10, 0x29,
+    0x4b, 0x21, 0x10, 0x31, 0xb3, 0xb4, 0xb2, 0x01, 0x24, 0x30, 0x30, 0x09, 0xc3, 0xc3, 0x95, 0x82,
+    0x22, 0x07, 0x81, 0x21, 0xb9, 0x29, 0x73, 0x4a, 0x39, 0xa0, 0x90, 0xa1, 0x19, 0x73, 0x01, 0x81,
+    0x04, 0xb2, 0xb9, 0xcd, 0xb0, 0x97, 0x91, 0x01, 0xb1, 0x09, 0x51, 0x0d, 0x3b, 0x89, 0x89, 0x00,
+    0x50, 0x7a, 0x29, 0x00, 0x83, 0x03, 0x98, 0x89, 0x13, 0x41, 0x20, 0x11, 0xb2, 0xc9, 0x3c, 0x5a,
+    0x48, 0x32, 0xc2, 0xb9, 0xd8, 0xb3, 0xb2, 0x0d, 0x0d, 0xbb, 0x9b, 0x90, 0xbb, 0x6a, 0x1a, 0x19,
+    0x04, 0x91, 0xa1, 0x95, 0x03, 0x14, 0x60, 0x5a, 0xab, 0xab, 0xa9, 0xeb, 0x88, 0x80, 0xb1, 0xb4,
+    0x06, 0x00, 0x04, 0x00, 0x0c, 0x59, 0x28, 0x19, 0x98, 0xb5, 0xb7, 0xc3, 0x81, 0x10, 0x18, 0x81,
+    0xb4, 0x87, 0x92, 0x90, 0x11, 0x39, 0x2c, 0xaa, 0xe3, 0xc2, 0x09, 0x3a, 0x39, 0x3a, 0x3f, 0x2b,
+    0xa0, 0xb0, 0xa3, 0xe1, 0x90, 0xa9, 0x0d, 0x19, 0xa1, 0xfa, 0xb3, 0x87, 0x81, 0x40, 0x20, 0x39,
+    0x33, 0x93, 0x61, 0x3a, 0x0b, 0xd8, 0xc9, 0x80, 0xb0, 0x90, 0xa2, 0x99, 0xcb, 0xc1, 0xb4, 0xd1,
+    0xb1, 0xe2, 0x91, 0xc2, 0xc2, 0xa3, 0xa1, 0x92, 0x00, 0x1f, 0x19, 0x00, 0xaa, 0x8b, 0x3d, 0x8d,
+    0x80, 0x90, 0x0d, 0x21, 0xb9, 0x1c, 0x99, 0xba, 0x97, 0xd9, 0xa3, 0xa4, 0x10, 0x31, 0x81, 0xb3,
+    0xd7, 0xb3, 0x94, 0x08, 0x1c, 0x0a, 0x00, 0x81, 0x1a, 0x0d, 0x1d, 0x0b, 0x0a, 0xb1, 0xd3, 0x95,
+    0xa2, 0xa0, 0xf3, 0xb1, 0x00, 0x9b, 0x1c, 0x08, 0x1d, 0x2c, 0x8d, 0x89, 0x91, 0x92, 0x23, 0xb1,
+    0xa9, 0x2a, 0xb3, 0xe5, 0x2d, 0xff, 0x0a, 0x00, 0x92, 0x00, 0xa8, 0xe3, 0x92, 0x18, 0x3e, 0x5a,
+    0x19, 0x08, 0x91, 0x20, 0x78, 0x39, 0x09, 0x1b, 0x2a, 0x0b, 0x1f, 0x3b, 0x90, 0xa9, 0x1b, 0x30,
+    0x2b, 0x1f, 0x2d, 0x0a, 0x80, 0x1a, 0x39, 0x4a, 0x6b, 0x3a, 0x59, 0x00, 0xb3, 0x06, 0x31, 0x3a,
+    0x41, 0x32, 0xc3, 0xa5, 0x08, 0x1b, 0xa0, 0xb9, 0xb4, 0x04, 0x49, 0x19, 0x32, 0x53, 0x2b, 0x4a,
+    0x08, 0x1b, 0x31, 0x39, 0x1d, 0x01, 0xd0, 0x21, 0x95, 0xb9, 0x77};
+#endif
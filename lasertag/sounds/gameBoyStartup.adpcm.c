@@ -0,0 +1,3409 @@
+// This file was generated by executing this statement: wav2adpcm -r 48000 -k soundBank.bin bcfire01_48k.wav.c gameBoyStartup.wav.c gameOver48k.wav.c gunEmpty48k.wav.c ouch48k.wav.c pacmanDeath.wav.c powerUp48k.wav.c screamAndDie48k.wav.c
+
+#include "soundAssets.h"
+#include <stdint.h>
+
+#ifndef SOUND_ASSETS_ON_SD
+// IMA-ADPCM, 105488 samples at 48000 Hz.
+SOUND_ASSET const uint8_t gameBoyStartup_adpcm[54396] = {
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0xb2, 0x92, 0x91,
+    0x19, 0x19, 0x90, 0x91, 0x01, 0x19, 0x19, 0x90, 0xb3, 0xb3, 0xa2, 0x91, 0xa2, 0x11, 0x3a, 0x1a,
+    0x00, 0x00, 0x00, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x1a, 0x00, 0x10, 0x3a, 0x0a, 0xd3, 0xb4, 0xa2,
+    0x01, 0x3a, 0x3b, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0x90, 0x01, 0x29, 0x3b, 0x99, 0xb1, 0xa3, 0x92,
+    0x90, 0xb2, 0xa3, 0x10, 0x00, 0x00, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa3, 0x01, 0x10,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x00, 0x29, 0x3b, 0x1b, 0xb2, 0xb3, 0xa3, 0x91, 0x11,
+    0x19, 0x09, 0xb1, 0xb3, 0x93, 0x10, 0x3a, 0x3b, 0x4b, 0x3c, 0x3a, 0x3b, 0x19, 0x09, 0x90, 0x01,
+    0x00, 0x90, 0xb2, 0xb3, 0xa3, 0x10, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x19, 0x29, 0x2b,
+    0x19, 0x3a, 0x2b, 0x99, 0xfe, 0xff, 0x00, 0x00, 0xc3, 0xc4, 0xa3, 0x92, 0x90, 0xb3, 0x12, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0xa9, 0xb3, 0xb3, 0x92, 0x90, 0x01, 0x29, 0x2b, 0x09, 0x00, 0x00,
+    0x00, 0x10, 0x09, 0x29, 0x1a, 0x09, 0xb3, 0xb3, 0x11, 0x19, 0x09, 0x10, 0x19, 0x09, 0x10, 0x19,
+    0x99, 0xa2, 0x11, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0x10, 0x09, 0x00, 0x91, 0x00,
+    0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x39, 0x3c, 0x3b, 0x19, 0x4a, 0x2b, 0x1a, 0x10, 0x3a, 0x1a, 0x00,
+    0x00, 0x00, 0x90, 0xb2, 0xc3, 0xb4, 0xc3, 0xa3, 0xb3, 0xa3, 0x92, 0x19, 0x19, 0x19, 0x00, 0x19,
+    0x39, 0x3c, 0x4b, 0x3b, 0x2b, 0x1a, 0x19, 0x91, 0x91, 0x91, 0xa1, 0x92, 0x10, 0x09, 0xa1, 0xb3,
+    0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x3a, 0x99, 0x91, 0x10, 0x19,
+    0x3b, 0x3b, 0x2a, 0x99, 0x01, 0x19, 0x90, 0xb2, 0xfd, 0xff, 0x00, 0x00, 0x92, 0x00, 0x90, 0xc3,
+    0xc4, 0xa3, 0x92, 0x90, 0x92, 0x10, 0x19, 0x99, 0xb3, 0x92, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x99,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0xb3, 0xb3, 0xa2, 0x91, 0x01, 0x91, 0x00, 0x39, 0x3c, 0x4b, 0x2a,
+    0x1b, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x99, 0xb1,
+    0xb3, 0x93, 0x91, 0xa1, 0xa3, 0x91, 0x01, 0x91, 0x91, 0x10, 0x99, 0xb2, 0xa3, 0x20, 0x3b, 0x3b,
+    0x3b, 0x2b, 0x19, 0x3b, 0x3b, 0x99, 0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x20, 0x2b,
+    0xa0, 0x92, 0x19, 0x00, 0x19, 0x19, 0x00, 0x39, 0x3d, 0x3b, 0x19, 0x19, 0xa1, 0xb3, 0xb3, 0xa3,
+    0x91, 0x91, 0xb3, 0xc3, 0xb3, 0x93, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x99, 0x00, 0x10, 0x99, 0xa2, 0x11, 0x3a, 0x1a, 0x29, 0x4b, 0x3c, 0x2a, 0x01, 0x00, 0x01, 0x00,
+    0x29, 0x3b, 0x2b, 0x09, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x39, 0x4d, 0x1b, 0x08, 0x29, 0x3c,
+    0xa9, 0xb4, 0x11, 0x4b, 0x3b, 0x1b, 0x99, 0x01, 0x19, 0x19, 0x90, 0x11, 0x19, 0x09, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4b, 0x3b, 0x9b, 0xb3, 0xc3, 0xb3, 0xa4, 0x20, 0x3b,
+    0x1a, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0x93, 0x19, 0x3b, 0x09, 0x29, 0x3b, 0x0a, 0xb2, 0xa3,
+    0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x3a, 0x1b, 0xb2, 0xb3, 0x92, 0x00, 0xa1, 0xb3, 0xa3, 0x01,
+    0x00, 0x10, 0x4b, 0x2b, 0xa9, 0xa3, 0x01, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xa3, 0x01, 0xa1,
+    0xa3, 0x01, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0xb2, 0x92, 0x00, 0xb1, 0xa3, 0x92, 0x29, 0x3b, 0x3b,
+    0x1a, 0x90, 0x11, 0x3a, 0x4c, 0x2b, 0x1a, 0x3a, 0x3b, 0x2b, 0xb1, 0xb3, 0x12, 0x4c, 0x2b, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x3b,
+    0x4b, 0x3c, 0x99, 0xc3, 0x92, 0x11, 0x3a, 0x0a, 0xa2, 0x01, 0x90, 0xa2, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xb2, 0x92, 0x19, 0x90, 0x91, 0x91, 0x91, 0x01, 0x39, 0x3b, 0x1b, 0x90, 0x91,
+    0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x19, 0x19, 0x90, 0xb2, 0xb3, 0x11, 0x19, 0x90, 0xb3,
+    0x92, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0xb1, 0xb4, 0xb3, 0x39, 0x3c, 0x1a, 0xb2, 0xb3, 0x92, 0x29,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x4c, 0x1b, 0xb1,
+    0xa4, 0x11, 0x2b, 0x19, 0x19, 0x2a, 0x99, 0xc3, 0xa3, 0x02, 0x3b, 0x2a, 0x99, 0x91, 0x91, 0xa2,
+    0x01, 0x00, 0x10, 0x3a, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x09, 0x91,
+    0x91, 0x10, 0x09, 0xb1, 0xfc, 0xff, 0x00, 0x00, 0x93, 0x10, 0x09, 0x91, 0x00, 0x10, 0x09, 0x00,
+    0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x2b, 0x19, 0x3b, 0x3b, 0x2a, 0x19, 0x19, 0x3b, 0x3b, 0x19, 0x09, 0x00, 0xa1, 0xb3,
+    0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x1a, 0x19, 0x91, 0x91, 0x91, 0x91, 0x10,
+    0x3b, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0xa9, 0xb3, 0x21, 0x3b, 0x2b, 0x19, 0x19, 0x99, 0x01, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92,
+    0x29, 0x2b, 0x19, 0x19, 0x99, 0xb2, 0x02, 0x3a, 0x3b, 0x1a, 0x29, 0x2b, 0xa0, 0x02, 0x3b, 0x2a,
+    0xa0, 0x92, 0xa1, 0xb3, 0x02, 0x5b, 0x4c, 0x3b, 0x1a, 0x08, 0x08, 0x09, 0x00, 0x00, 0x91, 0x00,
+    0x10, 0x3a, 0x4b, 0x3c, 0x09, 0x18, 0x3a, 0x1a, 0xff, 0xff, 0x00, 0x00, 0xa1, 0xa3, 0x01, 0x19,
+    0xb1, 0xa3, 0x92, 0x91, 0x91, 0x39, 0x4d, 0x2c, 0x09, 0x80, 0x90, 0xb2, 0x01, 0x19, 0x90, 0xb2,
+    0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x3b, 0x1a, 0x00, 0x10, 0x09, 0xa1,
+    0xb3, 0x93, 0x3a, 0x3b, 0x1a, 0x91, 0x19, 0x00, 0x91, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0x10,
+    0x5b, 0x4d, 0x2b, 0x19, 0x88, 0x80, 0x90, 0xb3, 0xb3, 0xb3, 0x92, 0x90, 0x01, 0x00, 0x19, 0x00,
+    0x29, 0x3b, 0x3b, 0x3b, 0x1b, 0x91, 0xb2, 0xa3, 0x01, 0x39, 0x4c, 0x1b, 0x98, 0xb3, 0xa3, 0x92,
+    0x91, 0xb1, 0x93, 0x91, 0xa1, 0x02, 0x3a, 0x1a, 0x00, 0x39, 0x3c, 0x4b, 0x0a, 0xb2, 0x92, 0xa1,
+    0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0xc3, 0xa3, 0x21, 0x3b, 0x3b, 0x2b, 0x09, 0xa1,
+    0xb3, 0xb3, 0xa3, 0x01, 0x90, 0xa2, 0x20, 0x2b, 0xa0, 0xa3, 0x30, 0x2b, 0x01, 0x00, 0x00, 0x00,
+    0xb9, 0xb4, 0x92, 0x09, 0xa1, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x1b, 0x91, 0xb3,
+    0xb2, 0xa3, 0x91, 0xc3, 0xc4, 0xa3, 0x92, 0x00, 0x3b, 0x1a, 0x19, 0x00, 0x91, 0x10, 0x3a, 0x1a,
+    0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x19, 0x29, 0x2b, 0x19, 0x09,
+    0x29, 0x3b, 0x3b, 0x0a, 0xb2, 0xa3, 0x20, 0x3b, 0xa9, 0xa3, 0x11, 0x09, 0x91, 0xa1, 0xa3, 0x01,
+    0x39, 0x3b, 0x1b, 0x91, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x29, 0x1a, 0xa1, 0xa3, 0x01, 0x91,
+    0x10, 0x19, 0x99, 0xb3, 0x01, 0x19, 0xa1, 0xb3, 0x93, 0x09, 0x19, 0xa1, 0x21, 0x3b, 0x1b, 0x01,
+    0x39, 0x2b, 0x1a, 0x39, 0x2b, 0x1a, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0xa9, 0xa3, 0x01, 0x19, 0x10,
+    0x3b, 0x3b, 0x09, 0xa1, 0xb3, 0x02, 0x3a, 0x0a, 0xb2, 0x02, 0x3a, 0x2b, 0x90, 0xa1, 0xb3, 0xb3,
+    0xfd, 0xff, 0x00, 0x00, 0xa3, 0xb2, 0xa3, 0x11, 0x3b, 0x3b, 0x2a, 0x19, 0x19, 0x19, 0x99, 0x91,
+    0x11, 0x3b, 0x3b, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x19, 0x90, 0x91, 0x11, 0x19,
+    0x09, 0x00, 0x91, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x2b,
+    0xa0, 0xa3, 0x20, 0x2b, 0xb0, 0xc4, 0xb4, 0x92, 0x18, 0x3a, 0x3b, 0x1a, 0x91, 0xb2, 0xb3, 0xb3,
+    0x93, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x3b, 0x19, 0x99, 0x91, 0x11, 0x3a, 0x3b, 0x3b, 0x1a,
+    0x19, 0x19, 0x90, 0xb3, 0xb3, 0x92, 0x19, 0x3b, 0x2a, 0x09, 0x90, 0xb2, 0xb3, 0xa3, 0x11, 0x3a,
+    0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0xb1,
+    0x93, 0x19, 0x90, 0xb3, 0xb3, 0x91, 0x11, 0x19, 0x3a, 0x1a, 0xa1, 0x93, 0x19, 0x3b, 0x3a, 0x0a,
+    0x01, 0x10, 0x3b, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x99, 0xc3, 0xa3, 0x31, 0x1b, 0xa1, 0xa3,
+    0x01, 0x90, 0xb2, 0xa3, 0x39, 0x3b, 0x2b, 0x09, 0xa1, 0xb3, 0xa3, 0x01, 0xa1, 0xa3, 0x30, 0x3c,
+    0x3b, 0x39, 0x2b, 0xa9, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0xb3, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x1a,
+    0x00, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x30, 0x3c, 0x4b, 0x1a, 0xb0,
+    0x93, 0x10, 0x2a, 0x19, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xb3,
+    0x02, 0x99, 0xc3, 0xa3, 0x31, 0x3b, 0x3b, 0x2b, 0xa9, 0xb3, 0xa3, 0x91, 0xc3, 0xc4, 0xb3, 0x93,
+    0x10, 0x3b, 0x1b, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x90, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0xa1, 0x92,
+    0x90, 0xd3, 0xb3, 0x93, 0x20, 0x3b, 0x1b, 0xb2, 0xb3, 0x92, 0x91, 0x10, 0x3b, 0x3b, 0x3a, 0x3b,
+    0x99, 0xb1, 0xa3, 0xb3, 0xb3, 0x92, 0x39, 0x3c, 0x02, 0x00, 0x01, 0x00, 0x5b, 0x2b, 0x98, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0x11, 0x29, 0x1a, 0x00, 0x00, 0x00, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x19,
+    0x09, 0x90, 0x01, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x19, 0x19, 0x19, 0x09, 0xa1, 0xb3,
+    0xa3, 0x01, 0x00, 0x91, 0x00, 0x39, 0x3b, 0x1b, 0xa1, 0xa3, 0x20, 0x3b, 0x2b, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0xd4, 0xb4, 0xa3,
+    0x91, 0x91, 0x91, 0xc2, 0xb3, 0xa4, 0x01, 0x3a, 0x1a, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x19,
+    0x91, 0x91, 0x00, 0x91, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x3b, 0x2a, 0xb0, 0xa3, 0x02, 0x1a,
+    0xb2, 0xb3, 0x92, 0x90, 0xc3, 0xb3, 0xa4, 0xb2, 0x91, 0x01, 0x19, 0x90, 0xb3, 0x21, 0x4d, 0x1b,
+    0x19, 0x19, 0xa0, 0xa3, 0x11, 0x2a, 0x19, 0x3a, 0x3b, 0x0a, 0xc3, 0xb3, 0xfb, 0xff, 0x00, 0x00,
+    0x93, 0x11, 0x19, 0x3a, 0x3b, 0x4c, 0x1b, 0x80, 0x29, 0x3b, 0x99, 0x29, 0x3b, 0x2b, 0x19, 0x19,
+    0x1a, 0x91, 0xb2, 0x11, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x90, 0xa2, 0x01, 0x90, 0xb2, 0x92, 0x90,
+    0xb2, 0x02, 0x2a, 0x99, 0xb2, 0x92, 0x91, 0x19, 0x90, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x29, 0x2b,
+    0x09, 0x29, 0x2b, 0xa0, 0xa3, 0x30, 0x3c, 0x3b, 0x29, 0x3b, 0x1a, 0xa1, 0xa3, 0x11, 0x09, 0xa1,
+    0xa3, 0x91, 0x01, 0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x29,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x10, 0x3a, 0x3b, 0x3b, 0x0a, 0xb3, 0xa2, 0x91, 0x91, 0xa2,
+    0x11, 0x2a, 0x09, 0x00, 0x90, 0xb2, 0x92, 0x19, 0x90, 0x91, 0x01, 0x19, 0x29, 0x2b, 0x09, 0x91,
+    0x91, 0x10, 0x3a, 0x1a, 0x91, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xa3,
+    0xfe, 0xff, 0x00, 0x00, 0x11, 0x2a, 0x09, 0x00, 0x00, 0x29, 0x1a, 0xa1, 0xa3, 0x91, 0xb3, 0xa2,
+    0x91, 0xb3, 0xa2, 0x11, 0x09, 0x91, 0x91, 0x00, 0x91, 0xa1, 0xb3, 0xb3, 0x92, 0x00, 0x19, 0x29,
+    0x3b, 0x1b, 0x91, 0x01, 0x19, 0x90, 0x91, 0x01, 0x90, 0xb3, 0xb3, 0x91, 0xb2, 0xa3, 0x01, 0x00,
+    0x10, 0x3a, 0x2b, 0xb0, 0xb4, 0xa2, 0x01, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0xb1, 0xb4, 0x92, 0x2a,
+    0x09, 0x91, 0x90, 0xb2, 0xa3, 0x01, 0x00, 0x10, 0x3a, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0x2a, 0x3a,
+    0x2a, 0x99, 0xb2, 0x92, 0x19, 0x29, 0x2b, 0x99, 0x01, 0x00, 0x90, 0x01, 0x29, 0x3b, 0x3b, 0x3b,
+    0x1a, 0x00, 0x19, 0x19, 0x19, 0x19, 0x10, 0x3a, 0x3b, 0x0a, 0xa2, 0x20, 0x2b, 0x09, 0x00, 0x00,
+    0xa1, 0xb3, 0xa3, 0x01, 0x90, 0x01, 0x00, 0x19, 0x91, 0x19, 0x19, 0x19, 0x19, 0x90, 0x01, 0x29,
+    0x3b, 0x3b, 0x3b, 0x1a, 0xff, 0xff, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x00, 0xa1,
+    0xb3, 0xb3, 0xd4, 0xa4, 0x01, 0x19, 0xa0, 0x92, 0x09, 0xb1, 0xb4, 0xa2, 0x11, 0x3a, 0x3b, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x0a, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x1b, 0xb2, 0xc4, 0xa3,
+    0x01, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x19, 0x19, 0x09, 0xa1, 0xa3, 0x01, 0xa1,
+    0xb3, 0x02, 0x09, 0x90, 0xb2, 0xb3, 0x02, 0x4b, 0x3b, 0x9b, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x99,
+    0x01, 0x00, 0x90, 0x01, 0x00, 0x90, 0xb2, 0x02, 0x4b, 0x3b, 0x1b, 0x2a, 0x09, 0x10, 0x3b, 0x09,
+    0xa1, 0x92, 0x10, 0x09, 0x00, 0x91, 0x00, 0x10, 0x99, 0xb2, 0xb3, 0xb3, 0xd4, 0xa3, 0xa3, 0x81,
+    0x29, 0x3b, 0x3b, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x2b, 0xb0, 0xb4, 0xc3, 0xa2, 0x93, 0x91, 0x10,
+    0x19, 0x99, 0xb3, 0x11, 0x19, 0x09, 0x10, 0x19, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x1a, 0x39, 0x4c,
+    0x3c, 0x3a, 0x3c, 0x2b, 0x09, 0xb1, 0xb5, 0xc3, 0x93, 0x18, 0x99, 0xa1, 0x92, 0x00, 0x29, 0x3b,
+    0x2b, 0x99, 0x01, 0x39, 0x3d, 0x1a, 0xd1, 0xb3, 0xa3, 0x93, 0x19, 0x90, 0xa2, 0x39, 0x3b, 0xb9,
+    0xa3, 0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x91, 0x10, 0x09, 0x10, 0x19, 0x3a, 0x1a, 0x19, 0x91,
+    0x10, 0x3a, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0xb1, 0x93, 0x10, 0x3b, 0x1a, 0xb2, 0xb3,
+    0xb3, 0xb3, 0xa3, 0x91, 0x91, 0x01, 0x19, 0x19, 0x90, 0x91, 0x01, 0x19, 0x19, 0x00, 0x39, 0x3d,
+    0x3b, 0x09, 0x01, 0x19, 0x19, 0x90, 0x91, 0xb3, 0x91, 0x11, 0x19, 0x09, 0x91, 0x00, 0x91, 0xa1,
+    0xa3, 0xb2, 0xb3, 0xc4, 0xa3, 0x01, 0x09, 0x19, 0x19, 0x00, 0x90, 0x91, 0x01, 0x39, 0x1b, 0x91,
+    0x10, 0x09, 0xb1, 0xb3, 0xa3, 0x92, 0xa1, 0x92, 0x39, 0x3c, 0x2a, 0x99, 0xfe, 0xff, 0x00, 0x00,
+    0xb2, 0xb3, 0x92, 0x19, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x4b, 0x2b, 0xa9, 0xb3, 0xb3,
+    0x11, 0x39, 0x2b, 0x1a, 0xb1, 0xc5, 0x93, 0x00, 0x29, 0x2b, 0x3b, 0x1a, 0x90, 0xc3, 0xb3, 0x13,
+    0x3a, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x90, 0xc3, 0xb3, 0x93, 0x01, 0x00,
+    0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x19, 0x3a, 0x99, 0xb1, 0x93, 0x19, 0x19, 0x10, 0x5b, 0x1b,
+    0x90, 0x92, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xb1, 0xb3, 0x93, 0x19, 0xa1, 0xb3,
+    0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x19, 0x19, 0x19, 0x00, 0x19, 0x29, 0x2b, 0x19, 0x99, 0xb2, 0x92,
+    0x10, 0x3a, 0x3b, 0x1a, 0x10, 0x4b, 0x3b, 0x9b, 0xb2, 0x92, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x29,
+    0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x93, 0x19, 0x3b, 0x99, 0x01, 0x39, 0x3d, 0x3b, 0xb8, 0xb4, 0xb3,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x91, 0xa1, 0xa3, 0x91, 0x11, 0x09, 0x00, 0x10, 0x3a, 0x3b, 0x2b,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x11, 0x4b, 0x2b, 0xb9, 0x93, 0x39, 0x3b, 0x1b,
+    0x19, 0x19, 0x00, 0x00, 0x29, 0x3b, 0x1a, 0x00, 0x39, 0x1b, 0x00, 0x00, 0x90, 0xb2, 0x92, 0x00,
+    0x90, 0xb2, 0xa3, 0x11, 0x09, 0x91, 0xb1, 0xb3, 0xb4, 0x92, 0x19, 0x3a, 0x3b, 0x2b, 0x99, 0xb2,
+    0x92, 0x91, 0xb1, 0x93, 0x29, 0x1b, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x39, 0x1b, 0x90, 0x01,
+    0x29, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x19, 0x19, 0x39, 0x3b, 0x3c, 0x3b, 0x90, 0xb3, 0xb3,
+    0xa2, 0x91, 0x11, 0x3a, 0x3b, 0x3b, 0xa9, 0xb3, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xa3,
+    0x20, 0x3b, 0xb9, 0xb3, 0x93, 0x39, 0x3d, 0x1a, 0xb1, 0x91, 0x01, 0x00, 0x19, 0x00, 0x90, 0xb2,
+    0x92, 0x29, 0x2b, 0x99, 0xfe, 0xff, 0x00, 0x00, 0x91, 0x01, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x99,
+    0xb2, 0xb3, 0xc3, 0xb4, 0xc3, 0xa3, 0x92, 0x39, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x29, 0x3b, 0x2b,
+    0x09, 0x00, 0x29, 0x3b, 0x3b, 0x1a, 0x00, 0x10, 0x19, 0x09, 0x91, 0x91, 0x39, 0x2b, 0x1a, 0x39,
+    0x3c, 0x1a, 0x91, 0xb2, 0xb3, 0xa3, 0x11, 0x99, 0xb3, 0x92, 0x19, 0x19, 0x19, 0x09, 0x91, 0xa1,
+    0xb3, 0xa3, 0x01, 0x29, 0x1a, 0x90, 0xa2, 0x01, 0x90, 0xc3, 0xb3, 0xb5, 0x92, 0x20, 0x2b, 0x3b,
+    0x3b, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x3c, 0x19, 0xa1, 0xb3, 0xb3, 0x92, 0x39,
+    0x3c, 0x1a, 0xb2, 0xa3, 0x10, 0x90, 0xc3, 0xb3, 0xa4, 0x30, 0x3c, 0x09, 0x00, 0x19, 0x29, 0x2b,
+    0x19, 0x09, 0x90, 0xa2, 0x20, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x10, 0x19, 0x09, 0x91, 0x91,
+    0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x39, 0x1b, 0xff, 0xff, 0x00, 0x00, 0x91, 0x10, 0x5b, 0x3b,
+    0x3c, 0x1a, 0x90, 0x10, 0x3a, 0x3b, 0x2b, 0x90, 0x00, 0x00, 0x91, 0x10, 0x3a, 0x1a, 0xa1, 0xa3,
+    0x11, 0x3a, 0x1a, 0x91, 0x00, 0x10, 0x09, 0x00, 0x91, 0xa1, 0xb3, 0x93, 0x3a, 0x3b, 0x1a, 0x10,
+    0x3a, 0x3b, 0x3b, 0xa9, 0xb3, 0x93, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x00, 0xa1, 0xb3, 0xa3, 0x11,
+    0x4b, 0x2b, 0x1a, 0x39, 0x3c, 0x4b, 0x2b, 0x09, 0xa1, 0x92, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb4,
+    0xd3, 0xb3, 0xb3, 0x03, 0xa1, 0xb3, 0xa3, 0x91, 0xa2, 0x11, 0x2a, 0x99, 0xc3, 0xb3, 0xb5, 0xa2,
+    0xa2, 0x11, 0x4b, 0x3b, 0x0b, 0xa1, 0xa3, 0x11, 0x4b, 0x2b, 0xa9, 0xa3, 0x20, 0x3b, 0x3b, 0x3b,
+    0x1a, 0xa1, 0xa3, 0x11, 0x99, 0xc3, 0xb3, 0xb5, 0xa2, 0xb2, 0xb3, 0xa3, 0x11, 0x09, 0x10, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x0a, 0xc3, 0xa3, 0x11, 0xb1, 0xb4, 0xfc, 0xff, 0x01, 0x00,
+    0xb2, 0x92, 0x00, 0x19, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x00, 0x90, 0xa2, 0x20, 0x3b,
+    0x1a, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x91, 0x11, 0x19,
+    0x19, 0x19, 0x09, 0x91, 0x91, 0x00, 0xa1, 0xb3, 0x02, 0x3a, 0x1a, 0x10, 0x3a, 0x1a, 0xa1, 0xa3,
+    0x11, 0x09, 0x10, 0x3a, 0x4c, 0x1b, 0xb1, 0xa4, 0x91, 0x19, 0x00, 0x29, 0x2b, 0xa0, 0xa3, 0x11,
+    0x99, 0xb3, 0xb3, 0x11, 0x3b, 0x3b, 0x99, 0x91, 0x01, 0x39, 0x3b, 0x1b, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0xb1, 0xa3, 0x02, 0x3a, 0x0a, 0xc3, 0xb3, 0x13, 0x3a, 0x3b, 0x3b,
+    0x1a, 0xa1, 0xa3, 0x11, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0xa1,
+    0xb3, 0xa3, 0x11, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0xa3, 0x20, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0xa1, 0x92,
+    0x10, 0x1a, 0x91, 0xb3, 0x11, 0x3a, 0x3b, 0x3b, 0x0a, 0xa2, 0x01, 0x90, 0xb2, 0x92, 0x00, 0x90,
+    0x01, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x91, 0x19,
+    0x29, 0x99, 0x19, 0x00, 0x91, 0x91, 0x91, 0x10, 0x19, 0x99, 0x01, 0x10, 0x19, 0x3a, 0x3b, 0x1a,
+    0xa1, 0xb3, 0x02, 0x3a, 0x2b, 0x09, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0x02, 0x3a, 0x3b, 0x3b,
+    0x1a, 0x91, 0xa1, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x4c, 0x1b, 0x80, 0x39, 0x2b, 0x99,
+    0x91, 0x10, 0x2a, 0x99, 0xb3, 0xb3, 0xb3, 0xa2, 0x11, 0x09, 0x10, 0x09, 0x00, 0x91, 0x39, 0x3c,
+    0x3b, 0x91, 0x39, 0x3c, 0x02, 0x00, 0x01, 0x00, 0x3b, 0x39, 0x2b, 0xa9, 0xb3, 0x93, 0x3a, 0x3b,
+    0x1a, 0x91, 0x91, 0x19, 0x90, 0xb2, 0x92, 0x19, 0x29, 0x4b, 0x3c, 0x1a, 0x90, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x10, 0x3b, 0x1a, 0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x10,
+    0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x91, 0x01, 0x91, 0xb1, 0xb3, 0xa3, 0x92, 0x39,
+    0x1b, 0x19, 0x39, 0x1b, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00,
+    0x00, 0x00, 0x29, 0x2b, 0x19, 0x09, 0x90, 0xd3, 0xc4, 0x92, 0x80, 0xa1, 0xa3, 0x92, 0x91, 0x00,
+    0x19, 0x29, 0x3b, 0x1b, 0xb2, 0xb3, 0x92, 0x19, 0x00, 0x19, 0x29, 0x2b, 0x19, 0x09, 0x00, 0x29,
+    0x2b, 0x99, 0x01, 0x39, 0x1b, 0xb1, 0xc5, 0xa3, 0xa3, 0xa2, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0xb3,
+    0x21, 0x3b, 0x0a, 0x91, 0x91, 0xb2, 0x21, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x09, 0x19, 0x00,
+    0x90, 0xb2, 0xb3, 0x02, 0x3a, 0x3b, 0x1a, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x90,
+    0x01, 0x00, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0xb1, 0xb4, 0xa2,
+    0x30, 0x1b, 0x00, 0x10, 0x3a, 0x1a, 0x91, 0x91, 0x39, 0x3b, 0x2b, 0x1a, 0x19, 0x39, 0x3b, 0x1b,
+    0x90, 0xd3, 0xb3, 0xa3, 0xb3, 0xb5, 0xb2, 0xb3, 0x11, 0x3b, 0x3b, 0x19, 0x99, 0x91, 0x91, 0x01,
+    0x19, 0x19, 0xb1, 0xa3, 0x92, 0xa1, 0x92, 0x29, 0x0a, 0xb2, 0xb3, 0x92, 0x19, 0x91, 0xb1, 0xb3,
+    0xa3, 0x92, 0x19, 0x19, 0x90, 0xb3, 0x92, 0x3a, 0x2b, 0x19, 0x19, 0x2a, 0x19, 0x99, 0xb2, 0x11,
+    0x19, 0x90, 0xb3, 0x11, 0x09, 0xb1, 0xb5, 0xb3, 0x01, 0x3a, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x2b, 0x19, 0x3b, 0x1a, 0xb2, 0xb3, 0x92, 0x91, 0x10, 0x3a, 0x3b, 0x01, 0x00, 0x00, 0x00,
+    0x3b, 0x0a, 0xb2, 0x92, 0x00, 0xa1, 0x02, 0x3a, 0x2b, 0xa0, 0xa3, 0x11, 0x09, 0x91, 0x91, 0xa1,
+    0xb3, 0xa3, 0x01, 0x91, 0x10, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0x0a, 0xb3, 0xa2, 0x01, 0x10, 0x3a,
+    0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x30, 0x2b, 0x1a, 0x91, 0x00, 0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0x3a,
+    0x1b, 0xb2, 0xb3, 0x92, 0xb1, 0xa3, 0x92, 0x91, 0x91, 0x91, 0x90, 0x11, 0x4b, 0x2b, 0x99, 0x91,
+    0x29, 0x3b, 0x2b, 0x09, 0x29, 0x2b, 0x19, 0x99, 0x91, 0xa2, 0x11, 0x3a, 0x3b, 0x1a, 0x91, 0x39,
+    0x2b, 0xa9, 0xb3, 0x92, 0x19, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x90, 0x91, 0x01, 0x29,
+    0x3b, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x91, 0xb1, 0x93, 0x10, 0x19,
+    0x3a, 0x3b, 0x2b, 0x19, 0x3a, 0x2b, 0xa0, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x19, 0x00, 0x90, 0xb2, 0xd4, 0xb4, 0xa3, 0x91, 0xb2, 0xa2, 0x11,
+    0x19, 0x19, 0x99, 0x91, 0xb2, 0xc3, 0xa4, 0x28, 0x3b, 0x90, 0xb3, 0xa2, 0x11, 0x3a, 0x3b, 0x0a,
+    0x01, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x01,
+    0x00, 0x00, 0x29, 0x3b, 0x5c, 0x3c, 0x1b, 0x90, 0x91, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x1a,
+    0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x93, 0x19, 0x3b, 0x09, 0xa1, 0xa3, 0x01,
+    0x00, 0x91, 0x00, 0x00, 0x91, 0x00, 0x00, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x99, 0x91, 0x91,
+    0x91, 0x91, 0xa1, 0x92, 0x91, 0x19, 0x19, 0x19, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x10,
+    0x3a, 0x3b, 0x0a, 0xc3, 0xb3, 0xa4, 0x91, 0xb1, 0xc5, 0xb4, 0xa3, 0x91, 0x81, 0x90, 0x00, 0x00,
+    0x90, 0x01, 0x29, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x90, 0xc3,
+    0xb3, 0xa4, 0x20, 0x2b, 0x99, 0x01, 0x19, 0x90, 0xc3, 0xa3, 0x92, 0xa1, 0x21, 0x2b, 0x99, 0x11,
+    0x3b, 0x2a, 0xa0, 0x92, 0x00, 0x00, 0x00, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x0a, 0xb2, 0xb3, 0x92, 0x90,
+    0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xc3, 0xa3, 0x21, 0x3b, 0x1a, 0x90, 0xa2,
+    0x20, 0x3b, 0x2b, 0x19, 0x19, 0x19, 0x09, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0xb1, 0xa3, 0x21, 0x3b, 0x2b, 0x99, 0xc3, 0xa3, 0x92, 0x91, 0xb1, 0xc4, 0xb4, 0x92,
+    0x90, 0xb2, 0x01, 0xa1, 0xa3, 0x30, 0x3c, 0x1a, 0x91, 0x01, 0x91, 0x91, 0x10, 0x19, 0x3a, 0x1a,
+    0x90, 0xa2, 0x91, 0x91, 0xb3, 0x92, 0x3a, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x99, 0x91, 0x29, 0x2b,
+    0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x4b, 0x4d, 0x3b, 0x0a, 0x91, 0xa2, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x91, 0xb3, 0x92, 0x3a, 0x4c, 0x1b, 0x90, 0x11, 0x19, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x5c, 0x2c, 0x89, 0xc2, 0xb4, 0xa3, 0x91, 0xb2, 0xb3, 0x10,
+    0x3b, 0x3b, 0x2a, 0x19, 0x19, 0x19, 0x09, 0x10, 0x19, 0x09, 0xa1, 0x92, 0x10, 0x99, 0x91, 0xc3,
+    0xc4, 0xa3, 0xa2, 0x92, 0x91, 0xb2, 0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b,
+    0x1a, 0x91, 0x91, 0x10, 0x09, 0x19, 0x00, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x19, 0x09, 0x19,
+    0x00, 0xb1, 0xb4, 0x92, 0x19, 0x3b, 0x1a, 0x91, 0x01, 0x19, 0x19, 0x90, 0xb3, 0xb3, 0xb2, 0xa3,
+    0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x19, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x29, 0x2b, 0xb0, 0xa3, 0xa3, 0x01, 0x00, 0x91, 0x91, 0x19,
+    0x91, 0xb1, 0xb3, 0xb5, 0x92, 0x18, 0x90, 0x91, 0x01, 0x19, 0x19, 0x91, 0x91, 0x19, 0x19, 0x00,
+    0x00, 0x19, 0xa1, 0x92, 0x19, 0x90, 0xb2, 0x92, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x99, 0xb1, 0xb3, 0xa3, 0x92, 0x91, 0x19, 0x19, 0x90, 0x91, 0xb2, 0x92, 0x00,
+    0x00, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0xa1, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x00, 0x29, 0x3b, 0x3b,
+    0x0a, 0xd3, 0xb4, 0xb2, 0xa2, 0xa2, 0x91, 0x91, 0xa2, 0x11, 0x3a, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x91, 0x91, 0x91, 0xb1, 0xb4, 0x92, 0x19, 0x09, 0x19, 0x19, 0x90, 0x11, 0x19,
+    0x3b, 0x19, 0x99, 0x91, 0x01, 0x19, 0x90, 0xb3, 0x92, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x3a, 0x1a,
+    0xff, 0xff, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x00, 0xa1, 0x92, 0x10, 0x3a, 0x3b,
+    0x1a, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0xb1, 0x93, 0x10, 0x09, 0xa1, 0xb3,
+    0xb3, 0xb3, 0xa3, 0x11, 0x09, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0xa9, 0xb3, 0xa3, 0x01,
+    0xa1, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x2b, 0x09, 0x00, 0x90, 0x01, 0x39, 0x3d, 0x3b, 0x19, 0x19,
+    0x19, 0xb1, 0xb3, 0xb3, 0x93, 0x91, 0x19, 0x19, 0x00, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0x91, 0x90,
+    0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0x01, 0x10, 0x3b, 0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0x92,
+    0x91, 0x90, 0x01, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x5c, 0x3c, 0x2b, 0x19, 0x09, 0xb1,
+    0xa2, 0x20, 0x3b, 0x0a, 0x91, 0x01, 0x19, 0x39, 0x2b, 0x1a, 0x10, 0x3a, 0x2b, 0x09, 0x00, 0x29,
+    0x3b, 0x0a, 0xb2, 0xa3, 0xfe, 0xff, 0x00, 0x00, 0x20, 0x4b, 0x3c, 0x4b, 0x2b, 0x3b, 0x1b, 0xb1,
+    0x93, 0x39, 0x2b, 0x2b, 0xa0, 0xb3, 0xa3, 0x01, 0x19, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0xa1,
+    0xb3, 0xb3, 0xa3, 0x91, 0x20, 0x1a, 0xb1, 0xb4, 0xa2, 0x01, 0xa1, 0xa3, 0x11, 0x09, 0x10, 0x3a,
+    0x1b, 0xb2, 0xb3, 0xb3, 0xb3, 0x02, 0x4b, 0x3b, 0x1b, 0x19, 0x99, 0xb2, 0x92, 0x00, 0xa1, 0x02,
+    0x3a, 0x2b, 0x09, 0x19, 0x00, 0x90, 0x01, 0x10, 0x3b, 0x09, 0xa1, 0x92, 0x00, 0x00, 0x29, 0x3b,
+    0x3b, 0x1a, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0x93, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xa3, 0x01,
+    0x00, 0xa1, 0x02, 0x3a, 0x1b, 0xb2, 0x92, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xb1, 0xa3, 0x21,
+    0x3b, 0x2b, 0x99, 0x91, 0xb2, 0xb3, 0xa3, 0x01, 0x90, 0xa2, 0x20, 0x3b, 0x3b, 0x3b, 0x3b, 0x0a,
+    0xb2, 0xa3, 0x01, 0x90, 0xb2, 0xb3, 0xb3, 0xa3, 0xfe, 0xff, 0x00, 0x00, 0x11, 0x3a, 0x1a, 0xa1,
+    0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x39, 0x4c, 0x3c, 0x1a, 0x90, 0x01, 0x09, 0xa1, 0xb3, 0xd4, 0xb4,
+    0xa3, 0x91, 0x81, 0xa0, 0xb3, 0x93, 0x3a, 0x1a, 0x91, 0x39, 0x3d, 0x4b, 0x1b, 0x08, 0xa1, 0xb3,
+    0xa3, 0x30, 0x3b, 0x3c, 0x1a, 0x91, 0xb2, 0xb3, 0xa3, 0x11, 0x19, 0x3a, 0x1a, 0x90, 0xb3, 0xa2,
+    0x01, 0x29, 0x4b, 0x3c, 0x99, 0xc3, 0x92, 0x11, 0x3a, 0x1a, 0x29, 0x3b, 0x1a, 0x00, 0xa1, 0xb3,
+    0xb3, 0xb3, 0xc3, 0xc5, 0xb3, 0x92, 0x10, 0x3b, 0x3b, 0x3b, 0x2b, 0xa9, 0xb3, 0xa3, 0x91, 0x91,
+    0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3,
+    0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x21, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x91, 0x91, 0x10, 0x99, 0x91, 0xa2, 0x91, 0xb2, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xc3, 0xb4, 0x01, 0x19, 0x91, 0x11, 0x5b, 0x3b, 0x3c, 0x3a,
+    0x3b, 0x09, 0x91, 0x10, 0x09, 0x91, 0x10, 0x3a, 0x1a, 0x29, 0x3b, 0x1a, 0x90, 0xb2, 0xb3, 0x31,
+    0x3c, 0x1a, 0xc3, 0xa3, 0x21, 0x3b, 0x1b, 0x91, 0x01, 0x19, 0x90, 0xb2, 0x92, 0x19, 0x90, 0xb3,
+    0xa2, 0x91, 0xb3, 0xa2, 0x01, 0x91, 0x00, 0x10, 0x19, 0x3a, 0x99, 0x91, 0x10, 0x19, 0x09, 0x00,
+    0x91, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x00, 0xa1, 0xa3, 0x30, 0x3c, 0x3b,
+    0x19, 0xa1, 0xa3, 0x01, 0x00, 0x10, 0x2a, 0x99, 0xb2, 0x92, 0x39, 0x3b, 0x1b, 0x29, 0x3b, 0x3b,
+    0x3b, 0x2b, 0x09, 0x10, 0x4b, 0x3b, 0x3d, 0x3b, 0x1a, 0x91, 0xb3, 0xb3, 0x92, 0x19, 0x3b, 0x3b,
+    0x1a, 0x91, 0x11, 0x09, 0x91, 0x10, 0x09, 0xb1, 0xa3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x91,
+    0xff, 0xff, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x10, 0x3b, 0x3b, 0x99, 0x91, 0x01,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x1a, 0x90, 0xa2, 0x20, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x2b, 0xb1, 0xa3, 0x11, 0x1a, 0x91, 0xb3, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x3a,
+    0xa9, 0xc3, 0xb4, 0x01, 0x98, 0xb2, 0xb3, 0xc3, 0xb5, 0x81, 0x90, 0xb2, 0x01, 0x00, 0x00, 0x39,
+    0x3c, 0x3b, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x0a, 0xb2, 0x21, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0x02,
+    0x4b, 0x3b, 0x2c, 0x19, 0x10, 0x3b, 0x3a, 0x0a, 0x01, 0x10, 0x2a, 0x09, 0x91, 0x00, 0x00, 0xa1,
+    0xb3, 0x02, 0x4b, 0x2b, 0xb9, 0xb4, 0xa2, 0x01, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x00, 0x91, 0x00, 0x10, 0x09, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3,
+    0x92, 0x19, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x29, 0x3b, 0x1a, 0x00, 0x10, 0x09, 0x00, 0x91,
+    0x00, 0x00, 0xa1, 0xa3, 0x01, 0x10, 0x3a, 0x2b, 0x09, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x3a, 0x3b,
+    0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0x90, 0xb2, 0x92, 0x90, 0xb2, 0xa3, 0x01, 0x10, 0x19, 0x2a, 0x19,
+    0x09, 0x19, 0x00, 0x00, 0x29, 0x3b, 0x2b, 0x90, 0x00, 0x39, 0x2b, 0x1a, 0x00, 0x10, 0x09, 0x91,
+    0x91, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x4b, 0x3b, 0x9b, 0x91, 0x11, 0x2a, 0x99, 0xa2,
+    0x01, 0xb1, 0xb5, 0xc3, 0xb3, 0xb4, 0xa2, 0x01, 0x09, 0x00, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x00,
+    0xa1, 0x02, 0x3a, 0x0a, 0xb3, 0xa2, 0x01, 0x00, 0x90, 0xb2, 0xb3, 0x02, 0x3a, 0x3b, 0x2b, 0x09,
+    0x29, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x19, 0x19, 0x90, 0x91, 0x92, 0x3a, 0x3b, 0x1a, 0x4a,
+    0x2b, 0x0a, 0xa2, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x2b, 0xb0, 0xa3, 0x21, 0x3b, 0x3b, 0x1a, 0x90, 0xb3, 0xa2, 0x11, 0x3a, 0x2b, 0x09, 0x00, 0x90,
+    0x01, 0x00, 0x90, 0x01, 0x90, 0x01, 0x00, 0x90, 0x01, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x90,
+    0x91, 0xb2, 0xc3, 0xb4, 0xb2, 0xc4, 0xb3, 0x92, 0xa1, 0x91, 0x11, 0x19, 0x99, 0xb3, 0xb3, 0x91,
+    0x91, 0x01, 0x19, 0x90, 0x91, 0x01, 0x19, 0x39, 0x3b, 0x3b, 0x3b, 0x4c, 0x2b, 0x2b, 0x3b, 0x2b,
+    0x19, 0x19, 0x2a, 0x19, 0x99, 0xb2, 0xa3, 0x10, 0x90, 0xb2, 0x92, 0x39, 0x3c, 0x4b, 0x2a, 0x2b,
+    0x2b, 0x09, 0x00, 0x00, 0x10, 0x3a, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b,
+    0x3b, 0x0a, 0xb2, 0x92, 0x00, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x90, 0xb2, 0x92, 0x90, 0xb2, 0x92,
+    0x19, 0x19, 0x19, 0x19, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x09, 0x91, 0x91, 0x10, 0x3a, 0x1a, 0x00, 0x00, 0x00, 0x39, 0x2b, 0x1a, 0x91, 0x19, 0x91,
+    0x91, 0x10, 0x09, 0x00, 0x10, 0x3a, 0x1a, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x90, 0x01,
+    0x00, 0x90, 0xb3, 0x91, 0x11, 0x19, 0x09, 0xb1, 0xa3, 0x92, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x90,
+    0xb2, 0xb3, 0x92, 0x91, 0xb1, 0xb3, 0x93, 0x29, 0x2b, 0xa0, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0xa1,
+    0xb3, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0xb2, 0xa3, 0x01, 0x00, 0x10, 0x09, 0xa1, 0xa3,
+    0x11, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x3b, 0x99, 0xc3, 0x93, 0x29, 0x3b, 0x4b, 0x3c, 0x1a, 0x90,
+    0x91, 0x19, 0x19, 0x90, 0x91, 0x01, 0x29, 0x3b, 0x1b, 0xd3, 0xa3, 0x92, 0x91, 0xc3, 0xa3, 0x11,
+    0x00, 0x10, 0x2a, 0x09, 0x00, 0x19, 0xb1, 0xa3, 0x92, 0x19, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91,
+    0xfe, 0xff, 0x00, 0x00, 0x91, 0xc3, 0xa3, 0x11, 0x19, 0xb1, 0xa3, 0x92, 0x90, 0xb2, 0xb3, 0x21,
+    0x3b, 0x3b, 0x2a, 0x3b, 0x3b, 0x2b, 0x19, 0x3b, 0x3b, 0x2a, 0x3a, 0x3b, 0x5d, 0x3b, 0x2b, 0xa0,
+    0xb3, 0x93, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x39, 0x3b, 0x3b, 0x3c,
+    0x3b, 0x19, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x11, 0x3a, 0x3b, 0x1a, 0x19, 0xa1, 0xc3, 0xb4, 0xb3, 0xa2, 0x29, 0x3b, 0x99, 0x00, 0x10, 0x09,
+    0x29, 0x3b, 0x4c, 0x2b, 0x2a, 0x3b, 0x1b, 0xb1, 0xa3, 0x11, 0x19, 0x90, 0x91, 0x01, 0x19, 0x90,
+    0x01, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0x02, 0x4b, 0x2b, 0xb9, 0x93, 0x29, 0x2b,
+    0x99, 0x01, 0x29, 0x3b, 0x2b, 0x19, 0x99, 0xd3, 0xc4, 0xb3, 0x92, 0x00, 0xa0, 0xb4, 0xb2, 0xb3,
+    0xb3, 0x92, 0x00, 0x90, 0xfe, 0xff, 0x00, 0x00, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0x00, 0x10, 0x2a,
+    0x09, 0xa1, 0x92, 0x10, 0x3a, 0x1a, 0x10, 0x3a, 0x0a, 0xc3, 0xa3, 0x11, 0x90, 0xa2, 0x01, 0xb1,
+    0xb5, 0xb3, 0x91, 0x91, 0x91, 0xb1, 0xa3, 0x21, 0x3b, 0x1b, 0x91, 0x91, 0x11, 0x19, 0x19, 0x19,
+    0x19, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x00, 0xa1, 0xb3,
+    0x02, 0x3a, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x1a, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x1a,
+    0x00, 0x91, 0xa1, 0xb3, 0xa3, 0x01, 0x90, 0x91, 0xb2, 0x92, 0x00, 0x90, 0xa2, 0x11, 0x4b, 0x2b,
+    0x1a, 0x91, 0x00, 0x91, 0xa1, 0xa3, 0x91, 0xa2, 0x11, 0x5b, 0x3b, 0x3c, 0x3b, 0x09, 0x91, 0x91,
+    0x91, 0x91, 0xd3, 0xc4, 0x92, 0x80, 0xa1, 0xa3, 0x21, 0x1b, 0x91, 0xb3, 0x01, 0x91, 0xb1, 0x93,
+    0x91, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0xa3, 0xfe, 0xff, 0x00, 0x00, 0x11, 0x09, 0x00, 0x10,
+    0x3a, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x2b, 0xa0, 0xb3, 0x92, 0x10, 0x09, 0x00, 0xa1, 0xb3, 0x02,
+    0x2a, 0x99, 0xb2, 0x92, 0xa1, 0xb3, 0xb3, 0x92, 0x00, 0x00, 0x29, 0x0a, 0xb2, 0x92, 0x90, 0xb2,
+    0xb3, 0x92, 0x91, 0x91, 0x10, 0x19, 0x09, 0x91, 0x19, 0x19, 0xb1, 0x93, 0x39, 0x2b, 0x99, 0x91,
+    0xb1, 0xa3, 0x92, 0x19, 0x00, 0x90, 0x01, 0x29, 0x1b, 0x01, 0x39, 0x3d, 0x99, 0xc3, 0xb3, 0x93,
+    0x91, 0xb1, 0xa3, 0xb3, 0x92, 0x10, 0x2a, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x19,
+    0x3a, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0xb1, 0xc4, 0x93, 0x80, 0xb1, 0xc5, 0xb4,
+    0xa3, 0x91, 0x91, 0xb2, 0x20, 0x2b, 0x99, 0x01, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x1a,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0xb1, 0xb3, 0xa3, 0x92, 0x10, 0x19, 0x3a, 0x01, 0x00, 0x00, 0x00,
+    0x3b, 0xb9, 0xb4, 0xd3, 0xb3, 0xa3, 0x92, 0x91, 0x19, 0x19, 0x19, 0x19, 0x90, 0x91, 0x01, 0x19,
+    0x19, 0x19, 0x19, 0x91, 0x10, 0x3b, 0x3a, 0x99, 0xa1, 0x93, 0x3a, 0x3b, 0xa9, 0xb3, 0x93, 0x3a,
+    0x3b, 0x1a, 0x19, 0x29, 0x1a, 0x19, 0x19, 0x29, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0x11,
+    0x19, 0x09, 0x91, 0x91, 0x00, 0x91, 0x91, 0x5a, 0x2b, 0x1a, 0x19, 0x3b, 0x3b, 0x09, 0xb1, 0xa3,
+    0x92, 0x19, 0x90, 0xb2, 0xb3, 0x21, 0x3b, 0x2b, 0x99, 0xd3, 0xc4, 0x92, 0x00, 0x19, 0x29, 0x1b,
+    0xb1, 0x93, 0x39, 0x3d, 0x3b, 0x3a, 0x19, 0x2a, 0x99, 0xb2, 0x92, 0x29, 0x3b, 0x1b, 0x91, 0x91,
+    0x91, 0xb3, 0xb3, 0xa2, 0x91, 0x91, 0xa2, 0x91, 0x91, 0x11, 0x19, 0x99, 0x91, 0x01, 0x19, 0x90,
+    0xd3, 0xb3, 0x93, 0x20, 0x3b, 0x2b, 0x19, 0x3a, 0x2b, 0x09, 0x00, 0xa1, 0xa3, 0x11, 0x3a, 0x1a,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb4, 0xb3, 0x91, 0x19, 0x19, 0x90, 0x01, 0x29, 0x3b,
+    0x0a, 0x01, 0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x3a,
+    0x3b, 0x3b, 0x1a, 0x10, 0x09, 0x90, 0xa2, 0x01, 0x00, 0x29, 0x3b, 0x0a, 0xb2, 0x02, 0x4b, 0x2b,
+    0x99, 0x01, 0x3a, 0x3b, 0x4b, 0x3d, 0x3a, 0x2a, 0x2a, 0x99, 0xb2, 0x02, 0x4b, 0x3b, 0x1b, 0x19,
+    0x99, 0xb2, 0x93, 0x19, 0x19, 0x19, 0x19, 0x19, 0x99, 0xb3, 0x92, 0x09, 0xa1, 0xa3, 0x91, 0x11,
+    0x3a, 0x3b, 0x2b, 0x99, 0x01, 0x39, 0x1b, 0x00, 0x10, 0x2a, 0xa0, 0xb3, 0x92, 0xa1, 0xa3, 0x30,
+    0x4c, 0x3c, 0x1a, 0x90, 0xb2, 0xb2, 0xb3, 0xa3, 0x01, 0x10, 0x19, 0x3a, 0x3b, 0x1b, 0x91, 0x01,
+    0x19, 0x90, 0x01, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x91, 0x91, 0x91, 0x19, 0x19, 0x19,
+    0x90, 0x91, 0x91, 0x91, 0xfe, 0xff, 0x00, 0x00, 0x91, 0x11, 0x19, 0x3a, 0x1a, 0x19, 0x10, 0x19,
+    0x3a, 0x1a, 0x19, 0x19, 0x91, 0x19, 0x19, 0xb1, 0x93, 0x91, 0xa1, 0xa3, 0x01, 0xa1, 0xb3, 0xb3,
+    0xb3, 0x92, 0x91, 0x90, 0x01, 0x10, 0x3b, 0x3a, 0x3b, 0x2b, 0x09, 0x10, 0x2a, 0xb0, 0xb5, 0xa2,
+    0x91, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0xa9, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x09,
+    0x91, 0x10, 0x3b, 0x3b, 0x19, 0x99, 0x91, 0x91, 0xb2, 0xb3, 0x93, 0x19, 0x09, 0xa1, 0xa3, 0x11,
+    0x3a, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x29, 0x3b, 0x1a, 0xb1, 0x93, 0x91, 0x10, 0x19, 0x09, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0x19, 0x90, 0x91, 0x01, 0x90, 0xd3, 0xb3,
+    0x83, 0x3b, 0x1a, 0xd3, 0xc4, 0xb3, 0xa2, 0x92, 0x00, 0xa0, 0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xb3,
+    0xb3, 0xa3, 0xa1, 0x93, 0x10, 0x3a, 0x1a, 0x91, 0xff, 0xff, 0x00, 0x00, 0x91, 0x10, 0x3b, 0x3b,
+    0x2a, 0x19, 0x09, 0x90, 0x01, 0x00, 0x90, 0xb2, 0x02, 0x4b, 0x3b, 0x9b, 0xb2, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xa3, 0x01, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x4b, 0x1b, 0xb1,
+    0x93, 0x19, 0x19, 0x00, 0x90, 0x01, 0x39, 0x4d, 0x3c, 0x2b, 0x3a, 0x3b, 0x2a, 0x3a, 0x3b, 0x1b,
+    0xb2, 0xc4, 0x93, 0x18, 0xa9, 0xb3, 0xc3, 0xb4, 0xc3, 0xa3, 0xa2, 0x93, 0x00, 0x00, 0x00, 0xa1,
+    0xa3, 0x20, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0xa1, 0xa3, 0x11, 0x09, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x39,
+    0x4d, 0x1b, 0x98, 0x92, 0x11, 0x3a, 0x1a, 0x00, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x00, 0x00, 0x29,
+    0x2b, 0x09, 0x19, 0x19, 0x90, 0x91, 0x91, 0xb2, 0xb3, 0x92, 0x00, 0xa1, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0x92, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x19, 0x99, 0x91, 0x11, 0x2a, 0x99, 0xc3, 0xa3, 0x21,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xc3, 0xa3, 0x92, 0x00, 0x90, 0xb2, 0xb3,
+    0x92, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xb2,
+    0xb3, 0xb3, 0xb3, 0x02, 0x3b, 0x2a, 0xb0, 0xa3, 0x02, 0x4b, 0x3b, 0x1b, 0x09, 0x90, 0x91, 0xb2,
+    0x92, 0x91, 0xb1, 0xa3, 0x92, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x1a, 0x39, 0x3c, 0x3b, 0xa1, 0xa3,
+    0x91, 0x91, 0x91, 0x01, 0x19, 0x19, 0x19, 0x91, 0xa1, 0xa3, 0x91, 0x11, 0x09, 0x91, 0x91, 0x10,
+    0x19, 0x4b, 0x3b, 0x1b, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0xa1, 0xa3, 0x11,
+    0x09, 0x10, 0x19, 0x3b, 0x19, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x4c, 0x3b, 0x1b, 0x09, 0x91,
+    0xff, 0xff, 0x00, 0x00, 0xb1, 0x93, 0x10, 0x3b, 0x3b, 0x99, 0x91, 0x11, 0x19, 0x3a, 0x3b, 0x99,
+    0x91, 0x29, 0x2b, 0x09, 0x00, 0x29, 0x2b, 0x09, 0x29, 0x3b, 0x2b, 0x19, 0x09, 0xb1, 0xb3, 0xb4,
+    0xb3, 0x10, 0x09, 0xb1, 0x93, 0x10, 0x2a, 0x09, 0xa1, 0x92, 0x10, 0x09, 0x00, 0x91, 0xa1, 0xb3,
+    0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x20, 0x2b, 0xa0, 0xa3, 0x01, 0xa1,
+    0xb3, 0xa3, 0x91, 0x01, 0x10, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x39,
+    0x3b, 0x1b, 0xb1, 0xb5, 0xc3, 0xa3, 0xb3, 0xa3, 0x92, 0x91, 0x91, 0x39, 0x3b, 0x2b, 0x3b, 0x3b,
+    0x3b, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x29, 0x5b, 0x3d, 0x0a,
+    0x80, 0x91, 0x00, 0xb1, 0xc4, 0x93, 0x10, 0x2b, 0x99, 0x19, 0x19, 0x90, 0x11, 0x19, 0x99, 0xb2,
+    0x93, 0x3a, 0x3b, 0x1a, 0xff, 0xff, 0x00, 0x00, 0x19, 0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0xa1,
+    0xa3, 0x01, 0x00, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x01, 0x00, 0xb1, 0xb4, 0xb3, 0x29, 0x3b,
+    0x3b, 0x0a, 0x01, 0x10, 0x2a, 0x19, 0xa0, 0x92, 0x91, 0x90, 0x91, 0xb2, 0xb3, 0x92, 0x29, 0x3b,
+    0x3b, 0x1a, 0x90, 0xa2, 0x01, 0x90, 0xb2, 0x02, 0x2a, 0x19, 0x09, 0x19, 0x91, 0x91, 0x00, 0x10,
+    0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0x93, 0x09, 0xa1, 0xb3, 0x92, 0x91,
+    0x91, 0x29, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x91, 0x00, 0x10, 0x3a, 0x3b,
+    0x1a, 0x10, 0x3b, 0x99, 0xb2, 0x92, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x19,
+    0x1a, 0x91, 0xb2, 0xa2, 0xb3, 0x92, 0x19, 0x29, 0x3b, 0x4c, 0x2b, 0x3b, 0x3b, 0x1b, 0x29, 0x3b,
+    0x2b, 0x99, 0x91, 0x91, 0x91, 0x01, 0x19, 0x90, 0xfe, 0xff, 0x00, 0x00, 0xb2, 0x92, 0x00, 0x00,
+    0x90, 0xa2, 0x91, 0xb2, 0x93, 0x4b, 0x3b, 0x9b, 0x01, 0x39, 0x3d, 0x2a, 0x19, 0x10, 0x3a, 0x3b,
+    0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0xb1, 0xb5, 0x11, 0x5c, 0x2b, 0x89, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa1, 0xa3, 0x91, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x2b, 0xb0, 0xb5, 0xb3, 0xb2, 0x11, 0x19, 0x09, 0x91, 0x91, 0x19, 0x19, 0x90, 0x91, 0x91, 0x91,
+    0x91, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x99, 0x91, 0x01, 0x90,
+    0x01, 0x19, 0x19, 0x90, 0x91, 0x91, 0x01, 0x19, 0x19, 0xb1, 0xa3, 0x21, 0x3b, 0x2b, 0x99, 0x01,
+    0x19, 0x19, 0x19, 0x19, 0x91, 0x91, 0x39, 0x2b, 0x2b, 0x19, 0x2a, 0x09, 0x90, 0x91, 0xc3, 0xa3,
+    0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x20, 0x01, 0x00, 0x00, 0x00,
+    0x3b, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x91, 0x10, 0x19, 0x19, 0x3a, 0x3b, 0xa9,
+    0xc3, 0xb4, 0xa2, 0xb2, 0x91, 0x91, 0xb2, 0xb3, 0x92, 0x90, 0xa2, 0x20, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x19, 0x3b, 0x1a, 0x91, 0x91, 0xb3, 0x92, 0x3a, 0x3b, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0x02, 0x4b,
+    0x2b, 0x2b, 0x09, 0xa1, 0x92, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x1a, 0x29, 0x3b, 0xa9, 0xb3, 0xa3, 0x91, 0xa2, 0x91, 0x91, 0x91, 0xb3, 0x92, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x1b, 0x91, 0x01, 0x39, 0x1b, 0x90, 0xb3, 0xb3, 0x92, 0x3a, 0x2b, 0x90, 0x91, 0x00, 0x10,
+    0x19, 0x09, 0x91, 0x91, 0x39, 0x2b, 0xa9, 0xb3, 0xa3, 0x11, 0x99, 0x91, 0x01, 0x00, 0x29, 0x3b,
+    0x3b, 0x1b, 0xb2, 0xb3, 0x11, 0x90, 0x01, 0x29, 0x3b, 0x2b, 0x99, 0xb3, 0xa2, 0x91, 0xc3, 0xb3,
+    0xfb, 0xff, 0x00, 0x00, 0xb4, 0xb3, 0x11, 0x19, 0x19, 0x3a, 0x2b, 0x09, 0x91, 0x91, 0x91, 0x91,
+    0x10, 0x99, 0xb2, 0x93, 0x19, 0x99, 0x01, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x3c, 0x1a, 0xd3, 0xb4,
+    0xb2, 0x92, 0x10, 0x19, 0x3a, 0x4b, 0x3c, 0x09, 0x98, 0xb2, 0xb3, 0x92, 0x90, 0x01, 0x29, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x99, 0x91, 0x11, 0x2a, 0x99,
+    0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0xa2, 0x11, 0x09, 0x91, 0x00, 0xa1, 0xb3, 0xb3, 0xb3,
+    0x93, 0x3a, 0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x1a, 0x10, 0x19, 0x3a, 0x2a, 0x3b, 0x1a, 0x19, 0x29,
+    0x1a, 0x19, 0x00, 0x10, 0x4b, 0x2b, 0xa9, 0x92, 0x00, 0x00, 0x00, 0x90, 0xa2, 0x91, 0xb2, 0x93,
+    0x3a, 0x3b, 0x3b, 0x1a, 0xb1, 0x93, 0x39, 0x2b, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb4,
+    0xb2, 0xb3, 0xb3, 0x11, 0xff, 0xff, 0x00, 0x00, 0x91, 0x91, 0x10, 0x19, 0x19, 0x99, 0x91, 0xa2,
+    0x10, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x99, 0xb1, 0xa3, 0x92, 0x91, 0x90, 0xb2, 0xc5, 0xa3,
+    0x81, 0x91, 0x91, 0x91, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x91, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x90, 0x11, 0x3a, 0x3b, 0x0a, 0xc3, 0xb3, 0x93, 0xb2, 0xa3, 0x11, 0x3a, 0x1a, 0xa1, 0xa3, 0x01,
+    0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x19, 0x29, 0x3b, 0x3b,
+    0x1a, 0xa1, 0x02, 0x3a, 0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x1a, 0x90,
+    0xa2, 0x01, 0x29, 0x0a, 0x91, 0xb2, 0x92, 0x91, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xb2,
+    0xc3, 0xb4, 0xb2, 0xb3, 0x91, 0x91, 0x01, 0x91, 0x91, 0x10, 0x09, 0x91, 0x91, 0x91, 0xb1, 0xc4,
+    0xb4, 0xa2, 0x81, 0xa1, 0xb2, 0xb3, 0xb3, 0x92, 0xff, 0xff, 0x00, 0x00, 0x29, 0xb9, 0xb4, 0xb3,
+    0x29, 0x0a, 0x91, 0x01, 0x90, 0x01, 0x19, 0x19, 0x90, 0x91, 0xb3, 0xb3, 0x11, 0x19, 0x19, 0x3b,
+    0x3b, 0x19, 0x19, 0x19, 0x19, 0x99, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0xb0, 0xb4, 0xb3, 0x19, 0x90,
+    0xd3, 0xb3, 0x93, 0x30, 0x3c, 0x3b, 0x19, 0x10, 0x19, 0x3a, 0x1a, 0x19, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0xb1, 0xa3, 0x92, 0x29, 0x3b, 0x3b, 0x9a, 0xc3, 0xb4, 0x01, 0x19, 0x91, 0xa2, 0x91, 0xb2,
+    0xb3, 0xb3, 0xc3, 0xb4, 0x01, 0x19, 0x91, 0xb2, 0xb3, 0xa3, 0x91, 0x01, 0xa1, 0xb3, 0xb3, 0x11,
+    0xa1, 0xc3, 0xb4, 0x01, 0x29, 0x19, 0x99, 0x01, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0x93, 0x19, 0x09, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x1a,
+    0x91, 0x00, 0xa1, 0xb3, 0xa3, 0x91, 0xa2, 0x11, 0x19, 0x99, 0x91, 0xb2, 0xfd, 0xff, 0x00, 0x00,
+    0x92, 0x29, 0x3b, 0x3b, 0x1b, 0x91, 0xb2, 0xb3, 0xb3, 0x11, 0x19, 0x19, 0x29, 0x1a, 0x91, 0x00,
+    0xa1, 0xa3, 0x11, 0x99, 0xb2, 0xb3, 0xa3, 0x01, 0x39, 0x2b, 0x1a, 0x91, 0x10, 0x19, 0x09, 0x91,
+    0x91, 0x10, 0x19, 0x99, 0xb3, 0xb3, 0x91, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x91, 0x19, 0x19, 0x19,
+    0x39, 0x1b, 0xa1, 0xb3, 0xb3, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xb3, 0xa3, 0x20, 0x3b, 0x2b, 0x19,
+    0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0xc3, 0xa3, 0x02, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x10, 0x19, 0x3a,
+    0x3b, 0x2b, 0x19, 0x19, 0x99, 0x01, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x00,
+    0x90, 0x91, 0xb2, 0x92, 0x91, 0x90, 0x11, 0x19, 0x99, 0xa2, 0x11, 0x09, 0x00, 0xa1, 0xb3, 0x93,
+    0x3a, 0x0a, 0xc3, 0xb3, 0x03, 0x00, 0xb1, 0xb4, 0xc3, 0x92, 0x01, 0x00, 0x29, 0x3b, 0x3b, 0x3b,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x2b, 0x19,
+    0x3a, 0x2b, 0x09, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x29, 0x3b, 0x3b, 0x4b, 0x4d, 0x3b, 0x99,
+    0xc3, 0xb4, 0xb3, 0xb3, 0x93, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0xb0, 0xc4,
+    0xb4, 0xa2, 0xb2, 0xb3, 0xb3, 0xa2, 0x91, 0x91, 0x91, 0xb3, 0x01, 0x29, 0x1a, 0x19, 0x39, 0x3b,
+    0x3b, 0x3b, 0x3d, 0x3b, 0x09, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x11, 0x3a, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x4b, 0x3c, 0x89, 0xb1, 0xb3, 0xb3, 0xb3, 0x92, 0x39, 0x3d, 0x4b, 0x2b, 0x1a, 0x19, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb3, 0xb2, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x09,
+    0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x19, 0x19, 0x90, 0xb3, 0x92, 0x09, 0x91, 0xb1,
+    0xb3, 0xa3, 0x92, 0x90, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x29, 0x2b, 0x09, 0x29, 0x0a, 0xb2, 0x02,
+    0x3a, 0x3b, 0x3b, 0x1a, 0x00, 0x91, 0x00, 0x10, 0x4b, 0x2b, 0xa9, 0x02, 0x3b, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x2b, 0x99, 0x91, 0xb2, 0x92, 0x19, 0x90, 0x01, 0x19, 0x19, 0x91, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x90, 0xb3, 0x01, 0x19, 0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0xa1, 0xb3,
+    0x92, 0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x29, 0x2b, 0x19, 0x09, 0x90, 0xb2, 0xb3, 0xb3,
+    0xb3, 0x92, 0x19, 0xa1, 0x92, 0x29, 0x3b, 0x1a, 0x00, 0x10, 0x09, 0xa1, 0xa3, 0x91, 0x91, 0xc3,
+    0xc4, 0x93, 0x80, 0xa0, 0xa4, 0x30, 0x3c, 0x4b, 0x2a, 0x1b, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x1a, 0x91, 0x10, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x91, 0x10, 0x3a,
+    0x1a, 0x00, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xb3, 0xa3, 0x11,
+    0x3b, 0x19, 0x19, 0x3b, 0x3b, 0x2a, 0x99, 0xb2, 0x92, 0x00, 0xa1, 0xa3, 0x11, 0x09, 0x91, 0x91,
+    0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x3a, 0x3b, 0x1a, 0xa1, 0xa3, 0x01, 0x00, 0xa1, 0xa3, 0x11,
+    0x3a, 0x3b, 0x1a, 0x29, 0x1a, 0xb1, 0xb4, 0xa2, 0x01, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x99, 0x01,
+    0x00, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xc3,
+    0xb4, 0xa2, 0x91, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x91, 0x91, 0x10, 0x19,
+    0x99, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xa3, 0x39, 0x4b, 0x3c, 0x2a, 0x19, 0x29,
+    0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x2a, 0xb0, 0xc5, 0x93, 0x10, 0x1a, 0x19, 0x09,
+    0x90, 0x11, 0x19, 0x2a, 0x19, 0x19, 0x3b, 0x2a, 0x99, 0xb2, 0xb3, 0xa3, 0xfe, 0xff, 0x00, 0x00,
+    0x11, 0x3a, 0x3b, 0x1a, 0xb1, 0xb3, 0xb3, 0xa3, 0x21, 0x3b, 0x2b, 0x09, 0x00, 0x10, 0x09, 0xa1,
+    0x93, 0x3a, 0x3b, 0x99, 0x91, 0xb1, 0xb4, 0xb3, 0x29, 0x2b, 0xa0, 0xb3, 0x92, 0x00, 0x29, 0x3b,
+    0x2b, 0x99, 0x11, 0x99, 0xb2, 0xc4, 0x93, 0x18, 0x1b, 0x91, 0xb2, 0xa3, 0x11, 0x3a, 0x3b, 0x3b,
+    0x2b, 0xa0, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x2b, 0xa0, 0xa3,
+    0x01, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x90, 0x91, 0xb2,
+    0x92, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x1a, 0x19, 0x10, 0x09, 0x00, 0xa1, 0xa3, 0x20, 0x3b,
+    0x2b, 0x99, 0xb2, 0xb3, 0x02, 0x4b, 0x3b, 0x1b, 0x4b, 0x3b, 0x2c, 0x19, 0x19, 0x19, 0x90, 0xb2,
+    0xb3, 0xb3, 0x92, 0x39, 0x1b, 0x19, 0x19, 0x19, 0x39, 0x1b, 0xb1, 0xb4, 0xa2, 0x11, 0x3a, 0x1a,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xb1, 0x93, 0x00, 0x90, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3,
+    0x93, 0x3a, 0x3b, 0x3b, 0x1b, 0x91, 0x91, 0x91, 0xa2, 0x91, 0xb2, 0x93, 0x09, 0x00, 0x91, 0xa1,
+    0xa3, 0x20, 0x3b, 0x2b, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xb3, 0xb3, 0x92, 0x91, 0x91,
+    0x39, 0x2b, 0x1a, 0x19, 0x19, 0x91, 0x91, 0x91, 0x10, 0x19, 0x3a, 0x3b, 0x2b, 0xa0, 0x92, 0x00,
+    0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x00, 0x19, 0x29, 0x3b,
+    0x3b, 0x2b, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x99, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x11,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0xa1, 0xb3, 0x92, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x90,
+    0xb2, 0x02, 0x3a, 0x2b, 0xa0, 0xc3, 0xb5, 0xb2, 0xb3, 0xb3, 0x91, 0x19, 0x91, 0x91, 0x91, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0xc4, 0xa3, 0x01, 0x3a, 0x3b, 0x3b, 0x2b, 0xa0,
+    0xa3, 0x01, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0x11, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0xa1, 0xb3, 0x92, 0x00, 0x00, 0x29, 0x2b, 0x09, 0x19, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x2b, 0x19, 0x5b, 0x3c, 0x1a, 0x91, 0x10, 0x3a, 0x1a, 0x00, 0xa1, 0xb3, 0xb3, 0xa3,
+    0x01, 0x90, 0xa2, 0x30, 0x3c, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x19,
+    0x19, 0x90, 0x91, 0x91, 0xb2, 0xb3, 0x93, 0x99, 0xb2, 0xb3, 0x92, 0x10, 0x3b, 0x3b, 0x4b, 0x3b,
+    0x1b, 0x99, 0xb2, 0x92, 0x91, 0xb1, 0xc4, 0xb4, 0x92, 0x18, 0x3a, 0x2a, 0x09, 0x39, 0x4d, 0x3c,
+    0x2b, 0x19, 0x09, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x19, 0x90, 0xb2, 0xb3, 0x02, 0x3a, 0x1a,
+    0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x10, 0x19, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x3c, 0x1a,
+    0xc3, 0xb3, 0x93, 0x01, 0x00, 0x10, 0x3a, 0x2b, 0x90, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x00,
+    0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x00, 0x10, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x3a,
+    0x1a, 0x00, 0x10, 0x09, 0xa1, 0xa3, 0x01, 0xb1, 0xb5, 0xa2, 0x01, 0x09, 0x91, 0x91, 0x91, 0x91,
+    0x10, 0x19, 0x09, 0x91, 0xa1, 0xb3, 0x92, 0x10, 0x19, 0x19, 0x09, 0x00, 0xa1, 0xb3, 0xb3, 0x02,
+    0x3a, 0x0a, 0xc3, 0xb3, 0xb5, 0xb3, 0xb2, 0xb3, 0xc3, 0xb5, 0xa2, 0x10, 0x19, 0x00, 0x29, 0x1a,
+    0x00, 0x00, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0xb1, 0xb4, 0xc3, 0x92, 0x10, 0x00,
+    0x90, 0x11, 0x19, 0x99, 0x11, 0x19, 0x99, 0x11, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3,
+    0xb3, 0xa3, 0x01, 0x39, 0x4c, 0x3c, 0x89, 0xb1, 0xa4, 0x81, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x39, 0x2b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x19, 0x99,
+    0xb2, 0xb3, 0x92, 0x00, 0x90, 0x91, 0xb2, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x00, 0x91, 0x00,
+    0x00, 0xb1, 0xb4, 0xd3, 0xb3, 0xa3, 0x11, 0x29, 0x1a, 0x19, 0x29, 0x1b, 0xb2, 0xb3, 0x92, 0xa1,
+    0x92, 0x19, 0x90, 0xd3, 0xa3, 0x11, 0x4c, 0x3c, 0x1a, 0x90, 0x01, 0x09, 0x91, 0x10, 0x5b, 0x2b,
+    0x1a, 0x19, 0x3a, 0x1a, 0xb1, 0xb4, 0xa2, 0x01, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x10, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x99, 0x91, 0x01, 0x90, 0xb2, 0xa3, 0x01, 0x90, 0xa2, 0x01, 0xa1, 0xb3,
+    0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x3b, 0x1a, 0xa1, 0xa3, 0x01, 0x00, 0x00, 0x10, 0x09, 0xa1, 0xb3,
+    0x31, 0x3d, 0x1a, 0x90, 0x19, 0x19, 0x90, 0x11, 0x19, 0x09, 0x91, 0x10, 0x19, 0x09, 0xa1, 0xb3,
+    0xfd, 0xff, 0x00, 0x00, 0xd4, 0xb4, 0xb3, 0xb4, 0xb3, 0x82, 0x4a, 0x2b, 0xa8, 0xa3, 0x20, 0x3b,
+    0x2b, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xc3, 0xb4, 0xb3, 0x91, 0xa1, 0x93, 0x19, 0x3a,
+    0x2a, 0x3b, 0x3b, 0x1b, 0x01, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x90, 0xb2, 0xc3, 0xb4, 0xd3,
+    0xa3, 0xa3, 0xa2, 0xb3, 0xa3, 0x30, 0x4d, 0x3c, 0x3c, 0x2a, 0x89, 0x91, 0xa1, 0xa3, 0xb3, 0x02,
+    0x3a, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x3b, 0x2b, 0x99,
+    0x11, 0x99, 0xb2, 0x93, 0x19, 0x19, 0x19, 0x3b, 0x2a, 0x19, 0x3b, 0x1a, 0xb2, 0x92, 0x91, 0x29,
+    0x3b, 0x9a, 0xc3, 0xb4, 0x11, 0x3b, 0x39, 0x2b, 0x1a, 0x10, 0x3a, 0x4b, 0x4d, 0x3b, 0x2a, 0x2b,
+    0x89, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0x02, 0x3a, 0x2b, 0x09, 0xa1, 0xb3, 0xa3, 0x91, 0xb2, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0x93, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x19, 0x99, 0xb2, 0xb3, 0x92, 0xa1, 0x92, 0x19, 0x00, 0x00, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x19,
+    0x19, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0xa2, 0x91, 0xb3, 0xa2, 0x20, 0x2b, 0x09,
+    0x19, 0x19, 0x19, 0x19, 0x90, 0x11, 0x3a, 0x4c, 0x1b, 0x90, 0xa3, 0x20, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x19, 0x2a, 0x99, 0xb3, 0xb3, 0xa2, 0x01, 0x00, 0xa1, 0xb3, 0x02, 0x3a, 0x2b, 0x99, 0xb2, 0x92,
+    0x91, 0x29, 0x4b, 0x3c, 0x2a, 0x19, 0x19, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0xa1, 0xa3,
+    0x11, 0x09, 0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x10,
+    0x3a, 0x3b, 0x1a, 0xb1, 0x93, 0x91, 0x90, 0xa2, 0x01, 0x39, 0x3c, 0x4b, 0x0a, 0xc3, 0xb3, 0xa4,
+    0xb2, 0xb2, 0xa3, 0x11, 0x3a, 0x1a, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x3b, 0x1b, 0x91,
+    0x11, 0x4b, 0x3c, 0x09, 0xc1, 0xa3, 0x11, 0x29, 0x1a, 0x19, 0x91, 0x91, 0x10, 0x19, 0x3b, 0x09,
+    0xb1, 0x93, 0x39, 0x2b, 0xa9, 0xb3, 0x21, 0x4b, 0x3c, 0x1a, 0xb1, 0x01, 0x29, 0x3b, 0x3b, 0x3b,
+    0x0a, 0xa2, 0x30, 0x3c, 0x3a, 0x1a, 0x19, 0x00, 0x19, 0x29, 0x2b, 0x09, 0x10, 0x3a, 0x1a, 0x19,
+    0x19, 0x19, 0x39, 0x2b, 0x1a, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0x02, 0x3a, 0x4c, 0x2b, 0x99,
+    0x93, 0x91, 0x00, 0x10, 0x09, 0x00, 0x10, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0xa1, 0xa3,
+    0x91, 0x91, 0xa2, 0x11, 0x4b, 0x2b, 0x1a, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0x31, 0x4d, 0x2b, 0x1a,
+    0xa0, 0x93, 0x10, 0x3a, 0x3b, 0x3b, 0x99, 0xb1, 0xa3, 0x92, 0x90, 0xb2, 0xb3, 0x92, 0x19, 0x00,
+    0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0x01, 0x19,
+    0x19, 0x90, 0xb3, 0xb3, 0x01, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x99, 0x90, 0x91, 0xb2, 0x92, 0x29,
+    0x2b, 0xb0, 0xa3, 0x02, 0x3b, 0x19, 0x19, 0x3a, 0x1a, 0x19, 0x39, 0x3c, 0x4b, 0x2a, 0x2b, 0x1a,
+    0x90, 0x91, 0x11, 0x09, 0x19, 0x29, 0x0a, 0xb2, 0x92, 0x00, 0x00, 0x39, 0x3c, 0x1a, 0x91, 0x11,
+    0x3a, 0x0a, 0xc3, 0xb3, 0x13, 0x19, 0x09, 0x10, 0x19, 0x09, 0x00, 0x91, 0x00, 0x10, 0x19, 0x3a,
+    0x1a, 0x19, 0x29, 0x1a, 0xa1, 0xa3, 0x01, 0x00, 0xb1, 0xb3, 0xb5, 0xc3, 0xa3, 0xb3, 0x93, 0x10,
+    0x09, 0x91, 0x91, 0x00, 0xa1, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0x01, 0x29, 0x3b, 0x3b, 0x1b, 0x91,
+    0x11, 0x09, 0xa1, 0x02, 0x3a, 0x3b, 0x2b, 0xb0, 0x93, 0x29, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0x10, 0x3a, 0x1a, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0x93,
+    0x09, 0x91, 0x10, 0x09, 0xb1, 0xb4, 0xa2, 0x01, 0x10, 0x3a, 0x0a, 0xc3, 0xb3, 0x93, 0xa2, 0x11,
+    0x4b, 0x2b, 0x0a, 0xa2, 0x11, 0x2a, 0xb0, 0xb4, 0x92, 0x19, 0x09, 0x91, 0x91, 0x00, 0xa1, 0xb3,
+    0xa3, 0x20, 0x4b, 0x4d, 0x3b, 0x1a, 0x90, 0x91, 0x01, 0xa1, 0x92, 0xb1, 0xb4, 0xb3, 0x29, 0x3b,
+    0x3b, 0x3b, 0x2b, 0xa0, 0x92, 0x00, 0x90, 0x11, 0x3a, 0x2b, 0x09, 0x00, 0x90, 0x01, 0x29, 0x3b,
+    0x1b, 0xd3, 0xc4, 0x92, 0x00, 0x88, 0x91, 0x20, 0x2b, 0xb0, 0xb4, 0xb3, 0xa1, 0xc3, 0xb4, 0xa2,
+    0x10, 0x29, 0x2b, 0x09, 0xa1, 0x11, 0x39, 0x2b, 0x1a, 0xa1, 0xa3, 0x91, 0x01, 0x00, 0x10, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x0a, 0x01, 0x10, 0x4b, 0x3b, 0x9b, 0xb2, 0x92, 0x91, 0x19, 0x19, 0x90, 0x01,
+    0x90, 0x01, 0x00, 0x19, 0xff, 0xff, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x90, 0x01, 0x00, 0x90,
+    0x01, 0x10, 0x3a, 0x3b, 0x1a, 0xb1, 0xb3, 0xb4, 0xa2, 0x91, 0xb3, 0x11, 0x3b, 0x99, 0xb2, 0x92,
+    0x29, 0x3b, 0x2b, 0x09, 0xa1, 0x92, 0xa1, 0xb3, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xb3, 0x92, 0x00,
+    0x90, 0xb2, 0xa3, 0x20, 0x2b, 0x99, 0x01, 0x90, 0x91, 0xb3, 0x91, 0x91, 0xb2, 0x92, 0x29, 0x3b,
+    0x3b, 0x3b, 0x09, 0x3a, 0x2b, 0xa0, 0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09,
+    0x00, 0x90, 0xa2, 0x01, 0x19, 0x29, 0x2b, 0x09, 0xb1, 0xb3, 0x93, 0x91, 0x91, 0x10, 0x19, 0x3b,
+    0x3b, 0x2a, 0x09, 0x91, 0x91, 0x10, 0x19, 0x19, 0x19, 0x99, 0xb2, 0x92, 0x91, 0x29, 0x3b, 0x0a,
+    0x91, 0x01, 0x19, 0x19, 0x19, 0x19, 0x29, 0x1a, 0xa1, 0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x3a,
+    0x3b, 0x3b, 0x1a, 0xb1, 0xb3, 0x93, 0x19, 0x90, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x19, 0x90, 0x01,
+    0x90, 0xb2, 0xa3, 0x20, 0x1b, 0xc3, 0xb3, 0x03, 0xa1, 0xb3, 0x02, 0x3a, 0x1a, 0x10, 0x3a, 0x2b,
+    0xa0, 0x93, 0x4b, 0x2b, 0xa9, 0xb3, 0xb3, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xa3, 0x10, 0x19, 0x00,
+    0x19, 0x19, 0x90, 0xb2, 0xb3, 0xa3, 0x01, 0x10, 0x19, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x91,
+    0x91, 0x39, 0x3d, 0x2a, 0x29, 0x4b, 0x3c, 0x89, 0xa1, 0x91, 0x91, 0x91, 0x01, 0x39, 0x3d, 0x3b,
+    0x29, 0x3b, 0x4c, 0x1b, 0x90, 0x92, 0x00, 0x10, 0x09, 0x00, 0xa1, 0xb3, 0xb3, 0x02, 0x3a, 0x2b,
+    0x09, 0x00, 0x19, 0x00, 0xa1, 0x02, 0x3a, 0x3b, 0x1a, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0xa1,
+    0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a,
+    0x19, 0x91, 0x91, 0xa1, 0x11, 0x39, 0x3d, 0x5b, 0x1b, 0x88, 0x91, 0xb2, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0x92, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x93, 0x5b, 0x4c, 0x1a, 0x08, 0x90, 0xa1, 0xa3, 0x92,
+    0x90, 0xb2, 0x92, 0x39, 0x3c, 0x5b, 0x2b, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x1b, 0xb2,
+    0xb3, 0xa2, 0xb3, 0xb3, 0x11, 0x19, 0x19, 0x39, 0x3b, 0x2b, 0x1a, 0xa1, 0xa3, 0x91, 0xa2, 0x01,
+    0x90, 0xc3, 0xa3, 0x92, 0xa1, 0x92, 0x19, 0x90, 0x01, 0x19, 0x91, 0x91, 0x00, 0x91, 0xa1, 0xa3,
+    0x01, 0x29, 0xa9, 0xb3, 0xc4, 0xa3, 0xc3, 0xb3, 0xb4, 0x92, 0x20, 0x2b, 0x99, 0x01, 0x19, 0x19,
+    0x00, 0x19, 0xa1, 0xb3, 0x21, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0xa0, 0xb3, 0x21, 0x3b,
+    0x4c, 0x3b, 0x3c, 0x3b, 0x2a, 0xb1, 0xc4, 0xb4, 0x92, 0x18, 0x09, 0x91, 0x91, 0x91, 0x01, 0x00,
+    0x00, 0x90, 0xb2, 0x02, 0x3b, 0x2a, 0x99, 0x11, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0x92, 0x91, 0x90,
+    0xfe, 0xff, 0x00, 0x00, 0x91, 0x01, 0x19, 0x90, 0x01, 0x39, 0x3c, 0x3a, 0x3b, 0x2b, 0x09, 0x00,
+    0x00, 0x00, 0x10, 0x19, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xb3, 0x92,
+    0xa1, 0x92, 0x91, 0x19, 0x90, 0xb2, 0x93, 0x3a, 0x3b, 0x3b, 0x1a, 0x00, 0x91, 0x00, 0x00, 0x00,
+    0x29, 0x3b, 0x3b, 0x3b, 0x0a, 0x01, 0x00, 0x90, 0xb2, 0x92, 0x91, 0x19, 0x39, 0x1b, 0x91, 0x91,
+    0x19, 0x91, 0xb1, 0x93, 0x10, 0x3b, 0x19, 0x09, 0x91, 0x91, 0x10, 0x19, 0x19, 0x19, 0x19, 0x99,
+    0x91, 0xb2, 0xc3, 0xb4, 0xa2, 0xb2, 0x01, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0xa1, 0xb3,
+    0x92, 0x00, 0x00, 0xa1, 0x02, 0x5b, 0x3c, 0x2a, 0x19, 0x19, 0xb1, 0xb4, 0xc3, 0x92, 0x01, 0xa1,
+    0xb3, 0xa3, 0x91, 0xa2, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0xb2, 0xb3, 0x92,
+    0x19, 0x29, 0x3b, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x99, 0xa1, 0x92, 0x29, 0x3b, 0x3b, 0x1b, 0xb2,
+    0xb3, 0x92, 0x90, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b,
+    0x19, 0x19, 0x3b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x3a, 0x99, 0x91, 0x39,
+    0x2b, 0xa9, 0xa3, 0x11, 0x19, 0x19, 0x3a, 0x1a, 0x19, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x20, 0x3b,
+    0x0a, 0xb2, 0x02, 0x4b, 0x3b, 0x0b, 0x00, 0xb1, 0xb4, 0xa2, 0x01, 0x10, 0x09, 0xa1, 0xb3, 0xb3,
+    0xa3, 0x01, 0x19, 0x19, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0x92, 0x90, 0x01,
+    0x19, 0x19, 0x90, 0x91, 0x01, 0x19, 0x19, 0x90, 0x91, 0xb2, 0x92, 0x10, 0x3a, 0x3b, 0x2b, 0x09,
+    0x10, 0x3b, 0x3a, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x10, 0x19, 0x09, 0x10, 0x09, 0xa1, 0xa3,
+    0x11, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c, 0x3a, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x09, 0x91, 0x10, 0x19,
+    0x19, 0x19, 0x3b, 0x3b, 0x99, 0x01, 0x00, 0x19, 0x19, 0x90, 0xb3, 0x11, 0x3a, 0x1a, 0x19, 0x91,
+    0xa1, 0x92, 0x00, 0xa1, 0xa3, 0x01, 0x10, 0x19, 0x3a, 0x99, 0x91, 0x19, 0x19, 0x00, 0x90, 0x01,
+    0x00, 0xb1, 0xb4, 0xb3, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x3a, 0x3b, 0xa9, 0xb3, 0x11, 0x90, 0xb2,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x11, 0x3a, 0x3b, 0x1b, 0xc3, 0xa3, 0x11, 0x10,
+    0x19, 0x3a, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xb2,
+    0xa3, 0x91, 0xa2, 0x91, 0xa2, 0x11, 0x3a, 0x1b, 0x91, 0x01, 0x19, 0x19, 0x19, 0x90, 0xd3, 0xb3,
+    0xa3, 0x93, 0x29, 0x3b, 0x2b, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x99, 0xb3, 0x92, 0x09, 0xa1,
+    0xb3, 0x93, 0x19, 0x09, 0xb1, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x39, 0x2b, 0x01, 0x00, 0x00, 0x00,
+    0x1a, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x10, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x09, 0x29, 0x3b, 0x3b, 0x1b, 0xd3, 0xb3, 0xa3, 0xb3, 0x03, 0x4b, 0x2b, 0x99, 0x29, 0x3b, 0x2b,
+    0x99, 0xb2, 0x92, 0x91, 0x90, 0x91, 0x11, 0x3a, 0x3b, 0x3b, 0x1a, 0x90, 0xd3, 0xb4, 0xa2, 0x81,
+    0x90, 0x10, 0x2a, 0x09, 0x29, 0x3b, 0x0a, 0xb2, 0xa3, 0x30, 0x3c, 0x2a, 0x09, 0x00, 0x29, 0x3b,
+    0x0a, 0xa2, 0x30, 0x3c, 0x1a, 0x01, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x1b, 0x91, 0x01, 0x19, 0x00,
+    0x29, 0x3b, 0x2b, 0x19, 0x3b, 0x3b, 0x2a, 0x99, 0xc3, 0xa3, 0x92, 0x29, 0x3b, 0x3b, 0x1b, 0x01,
+    0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0xa9, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x3a, 0x2b, 0x09, 0xb1, 0xa3, 0xb3, 0x92, 0x91, 0x19,
+    0xff, 0xff, 0x00, 0x00, 0x90, 0x91, 0x91, 0xb2, 0xc4, 0xb3, 0x93, 0x01, 0x19, 0x19, 0x90, 0x91,
+    0x91, 0xb2, 0xb3, 0x11, 0x19, 0x90, 0xb3, 0xa2, 0x11, 0x99, 0xb3, 0x92, 0x3a, 0x3b, 0x1a, 0x91,
+    0x10, 0x19, 0x99, 0x91, 0x01, 0x19, 0x19, 0x19, 0x39, 0x3d, 0x4b, 0x2b, 0x1a, 0xa0, 0xb3, 0xa2,
+    0xb3, 0xb3, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x90, 0x91, 0x01, 0x19, 0x29, 0x2b, 0x19,
+    0x19, 0x3b, 0x2a, 0x99, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x91, 0xa1, 0xa3, 0x91, 0xb2, 0xb3, 0xb3,
+    0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x91, 0xb3, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x3a,
+    0x3b, 0x1a, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x09, 0xa1, 0xb3,
+    0xb3, 0xa3, 0x11, 0x3b, 0x1a, 0xb2, 0xb3, 0x11, 0x19, 0x90, 0x01, 0x00, 0x29, 0x2b, 0x09, 0x90,
+    0xb2, 0x02, 0x4b, 0x3b, 0x03, 0x00, 0x00, 0x00, 0x1b, 0x3b, 0x3a, 0x2b, 0x99, 0xb2, 0xb3, 0xb3,
+    0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x00, 0x39, 0x3c, 0x3b, 0x91, 0x10, 0x09, 0x91,
+    0x10, 0x99, 0xb3, 0x11, 0x5b, 0x3b, 0x1b, 0xa0, 0xb3, 0xa3, 0x91, 0x01, 0x91, 0xb1, 0x93, 0x10,
+    0x19, 0x3a, 0x3b, 0x3b, 0x2b, 0x90, 0x10, 0x4b, 0x3b, 0x3d, 0x1a, 0xb0, 0xd5, 0xb3, 0xa3, 0x81,
+    0x18, 0x1a, 0x90, 0x91, 0x11, 0x19, 0x19, 0x3a, 0x3b, 0xa9, 0xa3, 0x01, 0xa1, 0xb3, 0xb3, 0xb3,
+    0x92, 0x19, 0x19, 0x19, 0x19, 0x91, 0x10, 0x09, 0x91, 0x10, 0x3b, 0x99, 0x91, 0x11, 0x19, 0x09,
+    0x10, 0x19, 0x09, 0x10, 0x09, 0xa1, 0x93, 0x3a, 0x3b, 0x3b, 0x3b, 0x1b, 0x01, 0x91, 0xb1, 0xb5,
+    0xc3, 0xa3, 0xb3, 0x93, 0x00, 0x10, 0x3a, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x90, 0x01,
+    0x00, 0x19, 0x00, 0x00, 0x00, 0x91, 0x00, 0x39, 0x02, 0x00, 0x00, 0x00, 0x3c, 0x3b, 0xb1, 0xb4,
+    0x92, 0x09, 0x91, 0x00, 0x00, 0x91, 0x10, 0x5b, 0x4c, 0x3b, 0x09, 0x08, 0x29, 0x2b, 0x0a, 0xb2,
+    0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x21, 0x2b, 0x99, 0xb2, 0xb3, 0xa3, 0x20,
+    0x3b, 0x99, 0xb1, 0xa3, 0x92, 0x29, 0x2b, 0x09, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x01, 0xa1, 0xb3, 0xa3, 0x01, 0x91, 0x10, 0x3b, 0x3b, 0x19, 0x1a, 0x91, 0x91, 0x91, 0xb2, 0x92,
+    0x91, 0x90, 0x01, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x00, 0x91, 0x00, 0x00, 0x10, 0x3a,
+    0x3b, 0x1a, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x19, 0x19, 0x90, 0x01, 0x29, 0x3b,
+    0x2b, 0xa0, 0x92, 0x29, 0x1a, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x19, 0x09, 0x91, 0x91, 0x00, 0x10,
+    0x3a, 0x1a, 0x91, 0x10, 0x19, 0x19, 0x19, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x00, 0x00, 0x39, 0x3c, 0x3b, 0x09, 0xa2, 0x01, 0x19, 0x00, 0x19,
+    0x00, 0x90, 0x01, 0x00, 0x00, 0x29, 0x3b, 0x1a, 0x29, 0x3b, 0x1b, 0xb2, 0xb3, 0x92, 0x00, 0x19,
+    0x00, 0x00, 0x90, 0x01, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x09, 0x10, 0x4b, 0x2b, 0x1a,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x00, 0x19, 0x90, 0xb2, 0x11,
+    0x90, 0xd3, 0xa3, 0x92, 0x10, 0x91, 0xa1, 0x92, 0x19, 0x00, 0x00, 0x00, 0xa1, 0x92, 0x10, 0x09,
+    0x29, 0x3b, 0x2b, 0x09, 0x29, 0x3b, 0x2b, 0x09, 0x19, 0x90, 0x91, 0x01, 0x19, 0x29, 0x3b, 0x3b,
+    0x3b, 0x4b, 0x3d, 0x2a, 0x09, 0x18, 0x19, 0x90, 0x91, 0xb3, 0x92, 0x19, 0x09, 0x91, 0xb1, 0xa3,
+    0x21, 0x3b, 0x1b, 0xb2, 0x92, 0x39, 0x3c, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x19, 0x29, 0x3b, 0x4c,
+    0x04, 0x00, 0x04, 0x00, 0x2b, 0x1a, 0x99, 0xb2, 0x92, 0x19, 0x90, 0xb2, 0x21, 0x4b, 0x3c, 0x2a,
+    0x19, 0x19, 0x39, 0x3b, 0x2b, 0x1a, 0x19, 0x29, 0x1a, 0x19, 0xa1, 0xb3, 0x93, 0x3a, 0x3b, 0xa9,
+    0xb3, 0xa3, 0x11, 0x3a, 0x2b, 0x09, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x90, 0xb2, 0xb3,
+    0xc3, 0xc5, 0xb3, 0xb3, 0x92, 0x00, 0x99, 0xc3, 0xa3, 0x11, 0x90, 0x91, 0x11, 0x4b, 0x4c, 0x2b,
+    0x1a, 0x90, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x19, 0x19, 0x90, 0x91, 0xa2, 0x01, 0x29, 0x1a,
+    0xa1, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xa3, 0x91, 0x11, 0x3a, 0x3b, 0x1b, 0x91, 0xa2, 0x01, 0x00,
+    0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1b, 0x91, 0x11, 0x19, 0x09, 0x91,
+    0x10, 0x99, 0xb2, 0x93, 0x3b, 0x2a, 0xb0, 0xa3, 0x92, 0x90, 0xb2, 0x92, 0x00, 0x00, 0x39, 0x3c,
+    0x4b, 0x1a, 0x09, 0x00, 0xff, 0xff, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x90, 0xa2, 0x01, 0x19, 0xb1, 0xb4, 0xb3, 0xa1, 0xb3, 0xa3,
+    0x01, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0xc3, 0x93, 0x3a, 0x2a, 0x09,
+    0x29, 0x3b, 0x4c, 0x1b, 0x90, 0x92, 0x00, 0x19, 0x19, 0x90, 0x91, 0x11, 0x3b, 0x3b, 0x09, 0x91,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x2b, 0xb1, 0x92, 0x10, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x3b, 0x1a, 0x91, 0xb3, 0xb3, 0xa2, 0x91, 0x91, 0x91, 0x91,
+    0xa2, 0x01, 0x00, 0xa1, 0x02, 0x09, 0x00, 0x91, 0x00, 0x10, 0x3a, 0x1a, 0x00, 0x10, 0x09, 0x10,
+    0x19, 0x09, 0x91, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x19, 0x19, 0x90, 0x91, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x19, 0x19, 0x19,
+    0x90, 0xd3, 0xb3, 0xb4, 0x11, 0x5b, 0x1a, 0x90, 0x30, 0x4c, 0x3c, 0x3a, 0x2b, 0x19, 0x10, 0x09,
+    0xa1, 0xb3, 0x31, 0x3b, 0x0b, 0xb3, 0xb3, 0xa2, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x3b,
+    0x1a, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0xa9, 0xb3, 0xb3, 0x92, 0x29, 0x0a, 0xb2, 0xb3,
+    0x92, 0x29, 0x2b, 0x19, 0x19, 0x99, 0xb3, 0xb3, 0x01, 0x00, 0x19, 0x00, 0x00, 0x19, 0x29, 0x3b,
+    0x3b, 0x0a, 0xb2, 0xb3, 0xa3, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x09,
+    0x91, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x19, 0x19, 0x29, 0x3b, 0x3b, 0x99, 0x90, 0x91, 0xb2, 0x92,
+    0x91, 0x91, 0x91, 0x91, 0x10, 0x19, 0x09, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3,
+    0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x90, 0x11, 0x19, 0x09, 0x91, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x19, 0x3a, 0x2a, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xa2, 0x01, 0x29, 0x1a, 0xa1, 0x02, 0x3a, 0x1a,
+    0x39, 0x2b, 0x1a, 0x10, 0x4b, 0x1b, 0xc2, 0xb3, 0x93, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00, 0xa1,
+    0xb3, 0xa3, 0x91, 0xc3, 0xa3, 0x11, 0x09, 0xc3, 0xa3, 0x11, 0x29, 0x3b, 0x1a, 0x91, 0xa1, 0xb3,
+    0xb3, 0x11, 0x19, 0x90, 0x91, 0x01, 0x90, 0xb2, 0xb3, 0x92, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x3a, 0x3b, 0x4c, 0x2b, 0x1a, 0x09, 0x00, 0x00, 0x90, 0xc3, 0xb3,
+    0xa4, 0xc2, 0xa3, 0x92, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0xb1, 0xb4, 0xb3, 0x19,
+    0x00, 0x29, 0x3b, 0x2b, 0xb0, 0xb4, 0xb3, 0x90, 0x91, 0x91, 0x11, 0x09, 0x90, 0xa2, 0x11, 0x4b,
+    0x2b, 0x0a, 0xb2, 0xb3, 0xb3, 0x93, 0x3a, 0x0a, 0xb2, 0x92, 0x00, 0x00, 0x90, 0xb2, 0x92, 0x39,
+    0x02, 0x00, 0x00, 0x00, 0x3c, 0x3b, 0x90, 0xb2, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3,
+    0x92, 0x00, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0x92,
+    0x29, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x19, 0x3a, 0x3b, 0x1b, 0xa2, 0x11,
+    0x3a, 0x99, 0x10, 0x19, 0x99, 0xa2, 0x11, 0x09, 0xa1, 0xa3, 0x91, 0x91, 0xa2, 0x11, 0x3a, 0x1a,
+    0xb1, 0xb4, 0xc3, 0x92, 0x91, 0xb2, 0xa3, 0x01, 0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0xb2,
+    0xb3, 0xa3, 0x20, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0xa0, 0xb3, 0x92, 0x90, 0xb2, 0xa3, 0x20,
+    0x3b, 0xa9, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0xb1,
+    0xb3, 0xb5, 0x92, 0x39, 0x3b, 0x19, 0x19, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x1a,
+    0x19, 0x19, 0x19, 0x19, 0xff, 0xff, 0x00, 0x00, 0x19, 0x19, 0x19, 0xb1, 0xb3, 0xb3, 0xa3, 0x92,
+    0x91, 0x91, 0x19, 0x19, 0x19, 0x90, 0x91, 0x92, 0x09, 0x00, 0x10, 0x4b, 0x2b, 0x99, 0xa1, 0xb3,
+    0xb3, 0x02, 0x3b, 0x3b, 0x2a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x99, 0x01, 0x91, 0x91, 0x10, 0x09,
+    0xb1, 0x93, 0x19, 0x19, 0x39, 0x4c, 0x3c, 0x2a, 0x09, 0x29, 0x3a, 0x3b, 0x2b, 0x99, 0xb2, 0x92,
+    0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0x02, 0x3b, 0x2a, 0x09, 0x29, 0x2b, 0xb0, 0xb4,
+    0xb3, 0x19, 0x19, 0x29, 0x3b, 0x1a, 0xb1, 0xb4, 0xa2, 0x01, 0xa1, 0xa3, 0x91, 0x11, 0x19, 0x3a,
+    0x1a, 0x09, 0xb2, 0xb3, 0x92, 0x00, 0xb1, 0xa3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x11, 0x19, 0x09,
+    0x91, 0x91, 0x10, 0x09, 0x91, 0x10, 0x3a, 0x1a, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x90, 0xc3,
+    0xb3, 0x93, 0xa2, 0x11, 0x3b, 0x09, 0x91, 0xa1, 0xfd, 0xff, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x11, 0x99, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0xb2, 0xb3,
+    0xa3, 0x11, 0x09, 0x91, 0xa1, 0xa3, 0x91, 0x11, 0x19, 0x99, 0xb2, 0x92, 0x90, 0xb2, 0xa3, 0x10,
+    0x00, 0x90, 0x01, 0x19, 0x39, 0x1b, 0x19, 0x29, 0x3b, 0x1b, 0xb2, 0xa3, 0x11, 0x09, 0x00, 0x91,
+    0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x29, 0x1a, 0x19, 0x91, 0xa1, 0x92, 0xa1, 0xb3, 0x21, 0x1a, 0x19,
+    0x29, 0x0a, 0x01, 0x29, 0x1b, 0xb2, 0x92, 0x91, 0x90, 0x91, 0xb2, 0xc3, 0xb4, 0xa2, 0x20, 0x1a,
+    0x91, 0x91, 0x91, 0xa1, 0x92, 0x29, 0x2b, 0x09, 0x00, 0x90, 0xa2, 0x11, 0x2a, 0xa0, 0xb3, 0xb3,
+    0x92, 0x19, 0x29, 0x3b, 0x3b, 0xb9, 0xc4, 0x93, 0x91, 0x10, 0x19, 0x90, 0x01, 0x90, 0xb2, 0xb3,
+    0xb3, 0x02, 0x5b, 0x3b, 0x3c, 0x2a, 0x19, 0x19, 0x19, 0x39, 0x3b, 0x2b, 0x01, 0x00, 0x00, 0x00,
+    0x1a, 0x19, 0x39, 0x4c, 0x3c, 0x2a, 0x09, 0x39, 0x3b, 0xa9, 0xb3, 0xb3, 0x11, 0x19, 0x90, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x11, 0x3b, 0x2a, 0x19, 0x2a, 0xb0, 0xb4, 0xd3, 0xb3, 0xa3, 0x01, 0xc3,
+    0xc4, 0x93, 0x00, 0x09, 0xa1, 0x12, 0x4b, 0x3c, 0x2a, 0x19, 0x19, 0x39, 0x1b, 0xa1, 0xb3, 0xb3,
+    0xa3, 0x11, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x91, 0x91, 0x10, 0x19, 0x19, 0x3a,
+    0x3b, 0x1a, 0x00, 0x10, 0x09, 0xa1, 0xc3, 0xb4, 0xa2, 0xa1, 0xb3, 0xc4, 0xb3, 0x93, 0x39, 0x3b,
+    0x1a, 0x91, 0x00, 0x10, 0x09, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x10, 0x99, 0xb3, 0xa2, 0x01,
+    0xa1, 0xb3, 0xa3, 0x91, 0xc3, 0xc4, 0xa3, 0x92, 0x18, 0x3b, 0x3b, 0x3b, 0x2b, 0xb0, 0xa3, 0x02,
+    0x4b, 0x4c, 0x1b, 0x90, 0xa2, 0x11, 0x00, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x90, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x30, 0x3c, 0x99, 0xb2, 0x02, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x90, 0xa1, 0xa3, 0x11, 0x3a, 0x3b,
+    0x4b, 0x3d, 0x2a, 0x89, 0x01, 0x3a, 0x2b, 0x90, 0x91, 0x10, 0x3b, 0x1a, 0x91, 0x01, 0x19, 0x39,
+    0x3b, 0x1b, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x91, 0x19, 0x19, 0x90, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0x91, 0x01, 0x90,
+    0xb2, 0xc3, 0xb4, 0x92, 0x39, 0x09, 0x91, 0x10, 0x3a, 0x1a, 0x29, 0x3b, 0x1a, 0x39, 0x3c, 0x3b,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x29,
+    0x3b, 0x1a, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x10, 0x09, 0x91, 0x91, 0x19, 0x29, 0x3b,
+    0x1b, 0xb2, 0x92, 0x91, 0xa1, 0x92, 0x00, 0x00, 0x10, 0x09, 0x00, 0x10, 0x2a, 0x09, 0xa1, 0xb3,
+    0xb3, 0xa3, 0x20, 0x1a, 0x91, 0x39, 0x3b, 0x1b, 0xa1, 0x92, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x2a,
+    0x09, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x92, 0xb1, 0xb4, 0xb3, 0x19, 0x19, 0x90, 0xb2, 0xd5, 0xb3, 0x82, 0x19, 0xa0, 0xc5,
+    0xa3, 0x92, 0x49, 0x3b, 0x3b, 0xa0, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1b, 0x91, 0xa2,
+    0x11, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x19, 0x19, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x2b,
+    0x09, 0x39, 0x4d, 0x3c, 0x3b, 0x3b, 0x3b, 0x4b, 0x1a, 0x90, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3,
+    0xd4, 0xa4, 0x81, 0x90, 0x91, 0x91, 0x19, 0x19, 0xff, 0xff, 0x00, 0x00, 0xa1, 0x92, 0x10, 0x99,
+    0x91, 0x11, 0x3b, 0x1a, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0xb2, 0x92, 0x90,
+    0x01, 0x00, 0x90, 0xb2, 0xa3, 0x01, 0x00, 0xa1, 0x92, 0x00, 0x29, 0x3b, 0x3b, 0xb9, 0xb4, 0xb3,
+    0x91, 0x29, 0x3b, 0x99, 0xb1, 0xb3, 0xa3, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x21, 0x3b,
+    0xa9, 0xb3, 0x93, 0x3a, 0x3b, 0xa9, 0xa3, 0x91, 0x01, 0x91, 0xa1, 0xb3, 0x92, 0x91, 0x19, 0x90,
+    0xd3, 0xc4, 0xb3, 0x01, 0x19, 0x98, 0xb3, 0x93, 0x19, 0xb1, 0x93, 0x39, 0x1b, 0xa1, 0xb3, 0xb3,
+    0xa3, 0x91, 0x91, 0x11, 0x3b, 0x1a, 0x01, 0x39, 0x3d, 0x3b, 0x29, 0x3b, 0x2b, 0xa0, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x5c, 0x3c, 0x2b, 0x09, 0x90, 0x01, 0x3a, 0x2b, 0x09, 0x90, 0x91,
+    0xa2, 0x91, 0x01, 0x10, 0x3b, 0x2a, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x00, 0x00, 0x00, 0x00,
+    0x99, 0xc3, 0xa3, 0x11, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0xa1, 0x92, 0x29, 0x2b, 0x99, 0x01,
+    0x29, 0x2b, 0x09, 0x00, 0x19, 0x10, 0x2a, 0x09, 0x29, 0x3b, 0x2b, 0x09, 0x91, 0x10, 0x3a, 0x2b,
+    0xa0, 0xb3, 0xb3, 0xa3, 0x11, 0x2a, 0xa0, 0x92, 0x90, 0xd3, 0xb3, 0xa3, 0x93, 0x19, 0x19, 0x90,
+    0x91, 0x01, 0x29, 0x3b, 0x2b, 0x99, 0x01, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xb2, 0xb3,
+    0x92, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x9a, 0xb3, 0xb3, 0x21, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x09, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x4b, 0x3b, 0x2c, 0xa8, 0xa3, 0x11, 0x09, 0x91, 0x10, 0x19,
+    0x19, 0x3a, 0x2b, 0x99, 0xb2, 0x02, 0x3a, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x19, 0x19, 0x91, 0x10,
+    0x3a, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x91, 0xa1, 0xb3, 0xa3, 0x11, 0x09, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0x93, 0x19, 0x3a, 0x3b, 0x1b, 0x01,
+    0x10, 0x4b, 0x4c, 0x1b, 0x80, 0x80, 0x00, 0x91, 0xa1, 0xb3, 0xb3, 0x02, 0x3a, 0x3b, 0x3b, 0x1a,
+    0x00, 0x10, 0x99, 0xb2, 0xb3, 0x92, 0x91, 0xa1, 0x92, 0x19, 0x29, 0x2b, 0x19, 0x09, 0x29, 0x3b,
+    0x3b, 0x0a, 0xc3, 0xb3, 0x93, 0x01, 0x91, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00,
+    0x00, 0x29, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x1a,
+    0xa1, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xd4, 0xa4, 0x81, 0x90, 0xd3, 0xa3, 0x92, 0x18, 0x3b, 0x2b,
+    0x19, 0x3b, 0x2a, 0x99, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x4b,
+    0x3c, 0x09, 0xa0, 0x11, 0x3a, 0x3b, 0x1a, 0xb1, 0xb5, 0xc3, 0xa3, 0xb3, 0x93, 0x29, 0x2b, 0x19,
+    0x09, 0x29, 0x3b, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x4c, 0x2b, 0x0a, 0xb2, 0xb3, 0xb3, 0xd4,
+    0xb4, 0xb4, 0xa2, 0xa2, 0xb3, 0xb3, 0xb5, 0x92, 0x10, 0x09, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0x01,
+    0x19, 0x19, 0x90, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x90, 0x91, 0x01, 0x19, 0x39, 0x3b,
+    0x3c, 0x3b, 0x90, 0xa2, 0x11, 0x19, 0x3a, 0x1a, 0xa1, 0xa3, 0x91, 0xc3, 0xa3, 0x11, 0x91, 0x91,
+    0x10, 0x99, 0xb3, 0x91, 0x11, 0x19, 0x19, 0x19, 0x19, 0x09, 0xa1, 0x11, 0x39, 0x1b, 0x39, 0x3b,
+    0x1b, 0x29, 0x3b, 0x3b, 0x2b, 0x99, 0x01, 0x19, 0x90, 0xb2, 0x92, 0x00, 0x10, 0x3a, 0x1a, 0x10,
+    0x3a, 0x3b, 0x1a, 0x00, 0x91, 0x00, 0x91, 0x91, 0x10, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xa3, 0x91, 0x01, 0x10, 0x19, 0x3a, 0x1a, 0x19, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0xb1, 0xb3, 0xb4, 0xd3, 0xa3, 0x81, 0x00, 0xa1, 0xfd, 0xff, 0x00, 0x00, 0x92, 0xc2, 0xc4, 0xa3,
+    0x92, 0x80, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x19, 0x19, 0xa1, 0xb3,
+    0x02, 0x3a, 0x0a, 0xa2, 0x01, 0xa1, 0xb3, 0xb3, 0x11, 0x19, 0x91, 0x10, 0x3a, 0x1a, 0x00, 0x10,
+    0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0x10, 0x3a, 0x0a, 0xb2, 0x02, 0x3a, 0x3b, 0x3b, 0x2b,
+    0xa0, 0xa3, 0x11, 0x19, 0x19, 0x19, 0x3a, 0x2b, 0x09, 0x10, 0x99, 0x91, 0x11, 0x99, 0x91, 0x11,
+    0x3b, 0x2a, 0x99, 0xb2, 0xb3, 0xa3, 0x20, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x39, 0x4c,
+    0x3c, 0x2a, 0x09, 0xb0, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x19, 0x19, 0x3b, 0x3b, 0x99, 0xb3,
+    0x01, 0x19, 0xd2, 0xb3, 0x83, 0x2a, 0x09, 0x00, 0x00, 0xb1, 0xb4, 0xc3, 0x92, 0x01, 0x00, 0xb1,
+    0xb4, 0xc3, 0x92, 0x11, 0x3a, 0x3b, 0x1b, 0x91, 0x91, 0x91, 0x91, 0x01, 0xff, 0xff, 0x00, 0x00,
+    0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x10, 0x19, 0x3a,
+    0x1a, 0x19, 0x19, 0x91, 0x10, 0x3a, 0x1b, 0x91, 0xb3, 0x91, 0x01, 0x00, 0x29, 0x3b, 0x2b, 0x19,
+    0x2a, 0x19, 0x19, 0x3b, 0x99, 0x01, 0x39, 0x3d, 0x3b, 0x3a, 0x19, 0x4b, 0x4c, 0x2b, 0x1a, 0x90,
+    0x92, 0x39, 0x3b, 0x3b, 0x3b, 0x3d, 0x3b, 0xb8, 0x93, 0x39, 0x3c, 0x1a, 0xb2, 0xb3, 0x92, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0xa1, 0xb3, 0x92, 0x00, 0x90, 0xa2, 0x20, 0x4b, 0x3c, 0x09, 0x18, 0x19,
+    0x3a, 0x1a, 0x00, 0x10, 0x09, 0x10, 0x3a, 0x3b, 0x1a, 0x39, 0x2b, 0xa9, 0xb3, 0xa3, 0x11, 0x3b,
+    0x09, 0x91, 0x91, 0x00, 0x91, 0x19, 0x10, 0x19, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xc4, 0xb3, 0xb4,
+    0xc3, 0x93, 0x90, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0x00, 0x10, 0x3b, 0xb0, 0xb4, 0x92,
+    0x00, 0x00, 0x00, 0x00, 0x19, 0x3a, 0x3b, 0x0a, 0xb2, 0x92, 0x19, 0x00, 0x00, 0x00, 0x10, 0x09,
+    0x10, 0x19, 0x3a, 0x1a, 0x19, 0x19, 0x91, 0x91, 0x91, 0x91, 0x91, 0xb1, 0xb3, 0xc4, 0xb4, 0x92,
+    0x18, 0x3a, 0x3b, 0x2a, 0x19, 0x2a, 0x09, 0x00, 0x29, 0x2b, 0x19, 0x19, 0x19, 0x19, 0x3a, 0x3b,
+    0x1b, 0x91, 0x11, 0x19, 0x99, 0x91, 0xb2, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xd3,
+    0xb4, 0xb2, 0x92, 0xa1, 0x11, 0x19, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x3a, 0x3b, 0x1a,
+    0x19, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x4b, 0x3b, 0x9b, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x21, 0x3b, 0x1b, 0xb2, 0x92, 0xb1, 0xc5, 0xa3, 0xa3, 0x81, 0x90, 0xb2, 0xa3, 0x11,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x30, 0x1b, 0x19, 0xa1, 0xb3, 0x21, 0x3b, 0x1a,
+    0x29, 0x3b, 0x3b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x19, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x99, 0xb2, 0xb3, 0xa3, 0x30, 0x3c, 0x3a, 0x1a, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x39, 0x3c,
+    0x1a, 0xb2, 0x92, 0x00, 0x19, 0xa1, 0x92, 0x91, 0x90, 0x01, 0x19, 0x19, 0x90, 0x91, 0x11, 0x5b,
+    0x3b, 0x2b, 0x1b, 0xa1, 0xa3, 0x91, 0x91, 0xb3, 0xb3, 0xa2, 0x11, 0x09, 0xa1, 0xb3, 0xa3, 0x11,
+    0x3a, 0x4b, 0x4d, 0x3b, 0x0a, 0x91, 0xa2, 0x92, 0x19, 0x19, 0x19, 0x19, 0xb1, 0xa3, 0x92, 0x90,
+    0xb2, 0xb3, 0x21, 0x3b, 0x3b, 0x2a, 0x3b, 0x3b, 0x99, 0x91, 0x19, 0x19, 0x90, 0x01, 0x29, 0x3b,
+    0x3b, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x90, 0x01, 0x90, 0x91, 0x11, 0x19, 0x09, 0x91,
+    0x91, 0x91, 0x91, 0x10, 0x19, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x01, 0x00, 0x91, 0x39, 0x3d, 0x0a,
+    0xd3, 0x92, 0x18, 0x99, 0x10, 0x99, 0x91, 0xb3, 0xfe, 0xff, 0x00, 0x00, 0x91, 0x91, 0x91, 0x91,
+    0xb2, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x19, 0x39, 0x1b, 0x90, 0x01,
+    0x29, 0x3b, 0x2b, 0x99, 0xb3, 0x01, 0x29, 0x1a, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x91, 0x00, 0x10,
+    0x3b, 0x4b, 0x1b, 0xb1, 0xb5, 0xb3, 0x91, 0x91, 0x91, 0x91, 0xb1, 0x93, 0x10, 0x19, 0x3a, 0x3b,
+    0x0a, 0xb2, 0xb3, 0x92, 0x00, 0x19, 0x29, 0x2b, 0x19, 0x09, 0x19, 0x00, 0x00, 0x29, 0x2b, 0xa0,
+    0x02, 0x4b, 0x3b, 0x1b, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c, 0x1a, 0xf2, 0xb3, 0x92, 0x18, 0x09, 0xb1,
+    0xa3, 0x92, 0x29, 0x2b, 0x09, 0x19, 0x19, 0xb1, 0x93, 0x39, 0x3d, 0x2a, 0x19, 0x29, 0x3b, 0x1a,
+    0x10, 0x3a, 0x1a, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x4b, 0x3c, 0x2a, 0xa8, 0xb3, 0xb3, 0xb3, 0x21,
+    0x3b, 0x1a, 0x00, 0xa1, 0x92, 0x39, 0x3c, 0x3b, 0x00, 0x10, 0x3b, 0x2a, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x92, 0x91, 0x90, 0x01, 0x00, 0x90, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x91, 0x10, 0x3a, 0x2b, 0x19, 0x19, 0x09, 0xb1, 0xb5, 0xb3, 0xb2, 0x91, 0x11, 0x19, 0x19,
+    0x19, 0x3b, 0x2a, 0x99, 0x91, 0x91, 0x91, 0x01, 0x10, 0x09, 0x00, 0x91, 0x00, 0x10, 0x09, 0x10,
+    0x4b, 0x3b, 0x2c, 0x29, 0x3b, 0x2b, 0xa0, 0x02, 0x3a, 0x1a, 0x91, 0x10, 0x19, 0x99, 0x91, 0x91,
+    0xb2, 0xb3, 0xa3, 0x91, 0x91, 0xb2, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xc4, 0xa3, 0x92, 0x91, 0x01,
+    0x39, 0x1b, 0x19, 0x10, 0x99, 0x91, 0x01, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x0a, 0xc3, 0xa3, 0x21,
+    0x1b, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x19, 0x91, 0xb1, 0x93, 0x91, 0xa1, 0xa3, 0x11, 0x3a, 0x3b,
+    0x0a, 0xc3, 0xb3, 0x13, 0x09, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0x93,
+    0x00, 0x00, 0x00, 0x00, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x91, 0x10, 0x19, 0x09, 0xa1,
+    0xc3, 0xb4, 0xb3, 0xb2, 0x91, 0x11, 0x99, 0x91, 0x91, 0x91, 0x01, 0x19, 0xb1, 0xa3, 0x21, 0x3b,
+    0x3b, 0x99, 0xa1, 0xa3, 0x91, 0x01, 0xa1, 0xb3, 0xa3, 0x91, 0x01, 0x39, 0x3d, 0x2a, 0x09, 0x01,
+    0x00, 0x19, 0x19, 0x90, 0xb3, 0x92, 0x3a, 0x1b, 0x91, 0x01, 0x90, 0xb2, 0x92, 0x00, 0x90, 0x01,
+    0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0x91, 0x11, 0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x91,
+    0x19, 0x19, 0x90, 0x91, 0xc3, 0xa3, 0x21, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x19, 0x90, 0xb2, 0xb3,
+    0x92, 0x00, 0x90, 0xc3, 0xb3, 0xa4, 0x91, 0x19, 0x00, 0x00, 0x19, 0x00, 0x19, 0x29, 0x3b, 0x3b,
+    0x99, 0xb1, 0x93, 0x91, 0xb1, 0x93, 0x10, 0x99, 0xb3, 0xa2, 0x11, 0x09, 0x00, 0x91, 0xa1, 0xa3,
+    0x91, 0x11, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x19, 0x3b, 0x1a, 0xb2, 0x93, 0x3a, 0x3b, 0x3b,
+    0x1a, 0x00, 0x29, 0x2b, 0x99, 0x91, 0x91, 0x11, 0x09, 0xa1, 0xa3, 0x91, 0x01, 0x91, 0x91, 0x00,
+    0x91, 0x91, 0x10, 0x19, 0x99, 0xb3, 0x01, 0x39, 0x3b, 0x3b, 0x2b, 0x1a, 0x91, 0x00, 0x91, 0x10,
+    0x3a, 0x3b, 0x1a, 0x19, 0x39, 0x3d, 0x3b, 0x09, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x2b,
+    0x99, 0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0x92, 0x00, 0x90, 0x11, 0x3a, 0x2b, 0xa0, 0x92, 0x00, 0x90,
+    0x01, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x09,
+    0xa1, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0x02, 0x4b, 0x3c, 0x19, 0x19, 0x39, 0x3c, 0x3b, 0x00, 0xa1,
+    0xb3, 0xa3, 0x91, 0x91, 0xc3, 0xc3, 0xa4, 0x91, 0x81, 0x91, 0x00, 0x91, 0xa1, 0x02, 0x3a, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x2b, 0xa0, 0x92, 0x29, 0x0a, 0xfe, 0xff, 0x00, 0x00, 0xb2, 0xb3, 0x92, 0x19,
+    0x00, 0x29, 0x3b, 0x99, 0xa1, 0x92, 0x19, 0x19, 0x00, 0x19, 0x19, 0x90, 0xb2, 0x92, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x09, 0x91, 0x00, 0x19, 0x29,
+    0x3b, 0x1b, 0xb2, 0xc3, 0xb4, 0xa2, 0x11, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0x4b, 0x3b, 0x9b,
+    0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x3b,
+    0x1a, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x01, 0xa1, 0xb3, 0x31, 0x2b, 0x1a, 0x29, 0x1a,
+    0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x20, 0x3b, 0x1a, 0x10, 0x3a, 0x1a, 0x90, 0x91, 0xb3, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0x91, 0xa1, 0xa3, 0x11, 0x2a, 0xa0, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0x92, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00,
+    0x90, 0x01, 0x00, 0x19, 0x29, 0x3b, 0x2b, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0x19, 0x90, 0x91, 0x91,
+    0x91, 0xb3, 0xa2, 0x11, 0x3a, 0x1a, 0x29, 0x1a, 0x19, 0x39, 0x2b, 0x1a, 0xa1, 0xb3, 0xa3, 0x01,
+    0x10, 0x3a, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x29, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0xc3, 0x92, 0xb2, 0xb3, 0x31, 0x4d, 0x3c, 0x1b, 0x80, 0x00,
+    0x19, 0x00, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x10, 0x09, 0x00, 0x91, 0x00, 0x91, 0xa1, 0x93,
+    0x19, 0x09, 0xb1, 0xb3, 0xa3, 0x92, 0x19, 0x19, 0x90, 0xb2, 0x93, 0x3a, 0x4c, 0x1b, 0x18, 0x1a,
+    0x90, 0xb3, 0xb3, 0xc3, 0xb3, 0x93, 0x91, 0xc3, 0xb3, 0xa4, 0xb2, 0x01, 0x29, 0x1a, 0x90, 0x11,
+    0x00, 0x00, 0x00, 0x00, 0x4b, 0x2b, 0x99, 0xa1, 0x92, 0x91, 0x90, 0x91, 0xb2, 0xb3, 0x92, 0x19,
+    0x00, 0x00, 0x29, 0x3b, 0x2b, 0xa0, 0xb3, 0x92, 0x29, 0x2b, 0x19, 0x19, 0x3b, 0x1a, 0xb2, 0xb3,
+    0x21, 0x3b, 0x1a, 0x19, 0x19, 0xa1, 0xb3, 0xb3, 0xc4, 0x93, 0x39, 0x3d, 0x1a, 0x08, 0x00, 0x19,
+    0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0xd3, 0xa3, 0x81, 0x90, 0xc3, 0xa3, 0x92, 0x00, 0x29,
+    0x2b, 0xa0, 0x92, 0x90, 0xb2, 0x92, 0x00, 0x00, 0x10, 0x19, 0x3a, 0x2b, 0x09, 0x10, 0x09, 0x00,
+    0x00, 0x00, 0xa1, 0x92, 0x10, 0x2a, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x91, 0x91,
+    0x91, 0x91, 0x10, 0x3b, 0x3b, 0x19, 0x99, 0xb3, 0xa2, 0x11, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0xa3,
+    0x11, 0x3b, 0x09, 0x91, 0x39, 0x4c, 0x1b, 0x98, 0xa3, 0x21, 0x4b, 0x3c, 0x1a, 0x90, 0x10, 0x99,
+    0x91, 0x91, 0xb2, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0x11, 0x00, 0x19, 0x19, 0x90, 0x01, 0x19, 0x19,
+    0x29, 0x3b, 0x4c, 0x2b, 0x1a, 0x09, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x00, 0x29, 0x2b, 0xb0, 0x93,
+    0x29, 0x2b, 0xa0, 0xb3, 0xb3, 0xa3, 0x91, 0x01, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x2b,
+    0x19, 0x09, 0x19, 0x39, 0x3c, 0x1a, 0x01, 0x39, 0x2b, 0xa9, 0xb3, 0x21, 0x3b, 0x3b, 0x3b, 0x4b,
+    0x3c, 0x2a, 0x19, 0x39, 0x3c, 0x4b, 0x3b, 0x2b, 0xa9, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x10,
+    0x09, 0xb1, 0xb4, 0xb3, 0x19, 0x19, 0x19, 0x29, 0x3b, 0x3b, 0x1a, 0x90, 0x01, 0xa1, 0x92, 0xa1,
+    0x92, 0x91, 0x19, 0x90, 0x91, 0x01, 0x19, 0x00, 0x19, 0x19, 0x90, 0x01, 0x39, 0x2b, 0x99, 0x91,
+    0x10, 0x99, 0x91, 0xb3, 0x01, 0x39, 0x1b, 0x90, 0x91, 0x91, 0xb3, 0xb3, 0x11, 0x19, 0x09, 0xb1,
+    0xb3, 0xa3, 0x92, 0x19, 0x90, 0xc3, 0xa3, 0x92, 0xff, 0xff, 0x00, 0x00, 0x91, 0xb1, 0xb3, 0x93,
+    0x19, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x99, 0x91, 0x91, 0x19, 0x19, 0xb1, 0xc4, 0xb4, 0x01, 0x29,
+    0x5b, 0x4b, 0x3c, 0x1a, 0x09, 0x39, 0x3c, 0x3c, 0x1a, 0x90, 0x19, 0x90, 0x01, 0x00, 0x90, 0xb2,
+    0xb3, 0x92, 0x19, 0x90, 0x91, 0x11, 0x19, 0x3a, 0x1a, 0x91, 0x10, 0x19, 0x99, 0x01, 0x29, 0x3b,
+    0x2b, 0x09, 0x10, 0x4b, 0x3b, 0x0b, 0x90, 0xb2, 0xb3, 0x92, 0x90, 0x91, 0x01, 0x39, 0x2b, 0x1a,
+    0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0x92, 0x91,
+    0x90, 0xd3, 0xa3, 0x01, 0x09, 0x91, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa3, 0x30, 0x4c, 0x3c, 0x2a,
+    0x2a, 0x3a, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x29, 0x2b, 0x09, 0x00, 0x29, 0x1a, 0x90, 0xa2, 0x20,
+    0x3b, 0x0a, 0xb3, 0xb3, 0x11, 0x19, 0x09, 0x91, 0x10, 0x3a, 0x2b, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0xa0, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3,
+    0x92, 0x19, 0xb1, 0xb4, 0xd3, 0xb3, 0x02, 0x3b, 0x1a, 0x00, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0x91,
+    0x29, 0x3b, 0x1a, 0x00, 0x00, 0xa1, 0xb3, 0x93, 0x3a, 0x2b, 0x90, 0x91, 0x10, 0x19, 0x09, 0x91,
+    0x10, 0x19, 0x09, 0x91, 0xa1, 0xb3, 0x92, 0x39, 0x4d, 0x3c, 0x2b, 0x19, 0x19, 0x09, 0x91, 0x01,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xb1, 0xb5, 0xc3, 0xa3, 0x01, 0x09, 0xb1, 0x93, 0x91, 0x10,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x1a, 0x00, 0x39, 0x3c, 0x3b, 0xa1, 0xa3,
+    0x01, 0x10, 0x3a, 0x3b, 0x1a, 0x29, 0x1a, 0x29, 0x1a, 0x19, 0x5a, 0x2b, 0x99, 0xa3, 0x92, 0x91,
+    0x91, 0x91, 0x91, 0xa1, 0xb3, 0xc4, 0xa3, 0xa2, 0xb3, 0xb5, 0xb3, 0xb2, 0x91, 0x91, 0xb2, 0x92,
+    0xff, 0xff, 0x00, 0x00, 0x91, 0xb1, 0xb3, 0x93, 0x39, 0x2b, 0xa9, 0xb3, 0x93, 0x3a, 0x3b, 0x1a,
+    0x10, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x0a, 0xb3, 0xa2, 0x91, 0xb3, 0xa2, 0x91, 0xa2, 0x11, 0x3a,
+    0x1a, 0x91, 0x91, 0x91, 0x91, 0x39, 0x2b, 0x1a, 0x29, 0x3b, 0x1a, 0x29, 0x1a, 0x19, 0x29, 0x99,
+    0xb1, 0x03, 0x19, 0x99, 0xb3, 0xb3, 0xb3, 0xb3, 0x11, 0x3b, 0x3b, 0x3a, 0x3b, 0x3b, 0x4c, 0x3b,
+    0x3c, 0x89, 0x91, 0x19, 0x19, 0x3b, 0x1a, 0xb2, 0xb3, 0x93, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x39, 0x2b, 0x1a, 0x19, 0x29, 0x99, 0x91, 0x10, 0x19, 0x19,
+    0x3a, 0x1a, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x91, 0x91, 0x91, 0x91, 0xb1,
+    0xb3, 0x93, 0x19, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0xa3,
+    0x91, 0x11, 0x3a, 0xa9, 0xfd, 0xff, 0x00, 0x00, 0xc3, 0xb4, 0x01, 0x29, 0x09, 0x10, 0x3a, 0x3b,
+    0x3b, 0x1a, 0x09, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0x02, 0x4b, 0x2b, 0x99, 0x10, 0x2a, 0x09,
+    0x00, 0x19, 0x90, 0x91, 0x01, 0x90, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x4c, 0x1b, 0x90, 0x11,
+    0x39, 0x3b, 0x2b, 0x1a, 0x19, 0x19, 0x19, 0x91, 0x91, 0x19, 0x19, 0x00, 0x19, 0xb1, 0xc5, 0x93,
+    0x10, 0x2a, 0x1b, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x10,
+    0x2a, 0xb0, 0xc5, 0xa3, 0x92, 0x91, 0x11, 0x19, 0x19, 0x19, 0x09, 0x91, 0xa1, 0xa3, 0x91, 0x11,
+    0x19, 0x99, 0x01, 0x39, 0x3d, 0x4b, 0x1b, 0xb1, 0x93, 0x01, 0x10, 0x19, 0x3a, 0x1a, 0xa1, 0xa3,
+    0x91, 0xa2, 0x01, 0x29, 0x1a, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x00, 0x29,
+    0x3b, 0x2b, 0x09, 0x29, 0x3b, 0x2b, 0xa0, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0xa3, 0x01, 0x90, 0xb2,
+    0xb3, 0xb3, 0x11, 0x19, 0x19, 0x39, 0x2b, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x39, 0x2b, 0x0a,
+    0xc3, 0xb3, 0x13, 0x3a, 0x1a, 0x00, 0x10, 0x09, 0x00, 0x91, 0xa1, 0xa3, 0x91, 0xb3, 0xa2, 0x11,
+    0x09, 0x00, 0xa1, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x21, 0x3b, 0x2b, 0x3a, 0x3b, 0x3b, 0x99, 0x19, 0x19, 0x19, 0x90,
+    0x91, 0x01, 0x39, 0x1b, 0x90, 0xb3, 0x01, 0x29, 0x2b, 0x09, 0x00, 0x29, 0x2b, 0x09, 0x19, 0x00,
+    0x90, 0x01, 0x00, 0x19, 0x00, 0x90, 0x91, 0x01, 0x19, 0x19, 0xb1, 0x93, 0x91, 0xa1, 0xb3, 0xb3,
+    0x21, 0x3b, 0x4c, 0x2b, 0x1a, 0x19, 0x3b, 0x2a, 0x19, 0x99, 0x91, 0xa2, 0x91, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x02, 0x3a, 0x2b, 0x09, 0x29, 0x2b, 0x99, 0x01, 0x19, 0x90, 0xfe, 0xff, 0x00, 0x00,
+    0xb2, 0x92, 0xa1, 0xa3, 0x01, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0xc4, 0x93, 0x00, 0xa9, 0xb3,
+    0x93, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x3b, 0x19,
+    0x99, 0x11, 0x19, 0x1a, 0x91, 0xb2, 0xa2, 0xb3, 0xb3, 0xa3, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x19,
+    0x90, 0x91, 0x91, 0x91, 0x11, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x1b, 0x01, 0x29, 0x3b,
+    0x3b, 0x2b, 0x3a, 0x3b, 0x4c, 0x2b, 0x1a, 0x19, 0x3b, 0x2a, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x00,
+    0x29, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x19, 0x10, 0x99, 0x91, 0x91,
+    0x91, 0x91, 0x11, 0x09, 0xa1, 0xa3, 0x91, 0xc3, 0xa3, 0x11, 0x29, 0x1a, 0x29, 0x3b, 0x1a, 0x10,
+    0x3a, 0x3b, 0xa9, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x3b,
+    0x01, 0x00, 0x00, 0x00, 0x99, 0x91, 0x39, 0x3c, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xb2, 0x92, 0x29, 0x3b, 0x4c, 0x2b, 0x89, 0xb2, 0xb3, 0xb3, 0xb3, 0x21, 0x3b, 0x5c, 0x3c, 0x2b,
+    0xa8, 0xb3, 0xc3, 0xb3, 0xc4, 0xb4, 0xb3, 0x01, 0x3a, 0x99, 0xd3, 0xb3, 0x93, 0x10, 0x91, 0xa1,
+    0x11, 0x29, 0x2b, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x90, 0xb2, 0xb3, 0x21, 0x2b, 0x19, 0x09,
+    0x19, 0x19, 0x19, 0x91, 0x10, 0x3a, 0x1a, 0x91, 0x39, 0x3c, 0x3b, 0xa1, 0x02, 0x3a, 0x0a, 0xc3,
+    0xc4, 0xa3, 0x01, 0x19, 0x90, 0x10, 0x09, 0x91, 0x91, 0x91, 0x10, 0x19, 0x09, 0x10, 0x3a, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x2b, 0xb0, 0xa3, 0x02, 0x3b, 0x2a, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0x92, 0x29, 0x1b, 0x91, 0xb2, 0x92, 0x91, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x99, 0x91, 0x01, 0x19,
+    0x19, 0x91, 0x91, 0x91, 0xff, 0xff, 0x00, 0x00, 0x10, 0x19, 0x3b, 0x19, 0x99, 0x91, 0x01, 0x90,
+    0xb2, 0xb3, 0xb3, 0x92, 0x01, 0x3b, 0x2a, 0xb0, 0xb4, 0xb3, 0x29, 0x9a, 0xb3, 0xa3, 0x10, 0x90,
+    0xb2, 0x92, 0x19, 0x19, 0x29, 0x3b, 0x3b, 0x99, 0x91, 0x39, 0x2b, 0x1a, 0x19, 0x19, 0x91, 0x19,
+    0x19, 0x19, 0x19, 0x19, 0x91, 0x91, 0x10, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x29, 0x3b, 0x3b, 0x2b,
+    0x99, 0xb2, 0x92, 0x29, 0x0a, 0x91, 0xa2, 0x91, 0x01, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10, 0x19,
+    0x09, 0x91, 0x39, 0x3b, 0x2b, 0x2a, 0x3b, 0x3b, 0x2b, 0x19, 0x3b, 0x2a, 0x99, 0x91, 0xb2, 0x93,
+    0x3a, 0x3b, 0x1a, 0x10, 0x19, 0x3a, 0x1a, 0x19, 0xa1, 0xb3, 0xa3, 0x91, 0x01, 0xa1, 0xb3, 0x02,
+    0x09, 0xa1, 0x93, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x29, 0x1a, 0x90, 0x11, 0x99, 0xb2, 0x92, 0x19,
+    0x00, 0x90, 0xb3, 0xb3, 0x91, 0xb2, 0xc4, 0xa3, 0xfc, 0xff, 0x02, 0x00, 0x01, 0xa0, 0xb3, 0x02,
+    0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x09, 0x91, 0x91, 0x91, 0x91, 0x91, 0xb1, 0xb3, 0xb3,
+    0xb3, 0xa3, 0x92, 0x10, 0x19, 0x3a, 0x3b, 0x2b, 0xa0, 0x02, 0x3a, 0x0a, 0xb3, 0xb2, 0xb3, 0x93,
+    0x3b, 0x2a, 0xa0, 0x92, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xc4, 0xa3, 0x11, 0x3c, 0x3b, 0x90,
+    0xb2, 0x02, 0x3a, 0x2b, 0xb0, 0xb4, 0xd3, 0xb3, 0xb3, 0x03, 0x29, 0x1a, 0x00, 0x29, 0x3b, 0x2b,
+    0x19, 0x3b, 0x3b, 0x99, 0x01, 0x91, 0x91, 0x10, 0x19, 0x99, 0x91, 0x01, 0x19, 0x90, 0xb2, 0xb3,
+    0x92, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0xc3, 0xb3, 0xa4, 0x20, 0x1a, 0x00, 0x29,
+    0x2b, 0x99, 0x91, 0x91, 0xb2, 0xc4, 0xa3, 0x92, 0x91, 0x91, 0xb2, 0x92, 0xa1, 0xc3, 0xb4, 0x92,
+    0x18, 0x39, 0x2b, 0x1a, 0x39, 0x3c, 0x5b, 0x2b, 0x09, 0x91, 0xa1, 0xc3, 0xfa, 0xff, 0x02, 0x00,
+    0xb4, 0x01, 0x39, 0x1a, 0xa1, 0xb3, 0xd4, 0xb4, 0xb4, 0xa2, 0x92, 0x91, 0xa1, 0xa3, 0xa3, 0x11,
+    0x2a, 0x09, 0x91, 0x90, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x10, 0x19,
+    0x3a, 0x1a, 0x90, 0xb2, 0xb3, 0xb3, 0x02, 0x5b, 0x3c, 0x2a, 0x98, 0xb2, 0xa2, 0x11, 0x3a, 0x3b,
+    0x3b, 0x2b, 0xb0, 0xa3, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0x01, 0x29, 0x3b, 0x2b, 0x19, 0x4b,
+    0x3c, 0x19, 0x29, 0x4b, 0x3c, 0x4b, 0x3b, 0x3c, 0x09, 0xa0, 0x91, 0xa2, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x91, 0x11, 0x19, 0x3a, 0x2a, 0x3b, 0x1a, 0x90, 0x91, 0x01, 0x19, 0x19, 0xb1, 0xa3, 0x92,
+    0x19, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x11, 0x3a, 0x2b, 0x90, 0x91, 0x00, 0xa1, 0xb3,
+    0xb3, 0x02, 0x3a, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x00, 0x19, 0x39, 0x1b, 0xb1, 0xb5, 0x92,
+    0xff, 0xff, 0x01, 0x00, 0x18, 0x19, 0x10, 0x3a, 0x1a, 0x00, 0x29, 0x1a, 0x39, 0x3c, 0x3b, 0xb2,
+    0x01, 0x29, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xc4, 0xa3, 0x01, 0x09, 0xb1, 0xb3,
+    0xa3, 0x92, 0x19, 0x90, 0x01, 0x39, 0x2b, 0x1a, 0x19, 0x10, 0x3a, 0x4c, 0x2b, 0x1a, 0x09, 0xa1,
+    0xb3, 0x02, 0x3a, 0x2b, 0xa0, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x00, 0x10, 0x09, 0x10, 0x09, 0xb1,
+    0xb4, 0xb2, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x00, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0x02, 0x3a, 0x2b,
+    0xa0, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x00, 0x91, 0x10, 0x5b, 0x2b, 0x1a, 0x19, 0x3a, 0x1a, 0x29,
+    0x3b, 0x1a, 0x39, 0x4c, 0x3c, 0x2a, 0x09, 0x19, 0x91, 0x11, 0x19, 0x99, 0x01, 0x00, 0x90, 0xb2,
+    0xb3, 0x92, 0x29, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x29, 0x0a, 0x91, 0xa2, 0x20, 0x4b, 0x4d, 0x3b,
+    0x1a, 0x90, 0xc2, 0xb3, 0xfb, 0xff, 0x01, 0x00, 0xb3, 0x20, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29,
+    0x3b, 0x2b, 0x09, 0x91, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0xb3, 0xc3, 0xb3,
+    0x03, 0x29, 0x1a, 0x91, 0x10, 0x3a, 0x1a, 0xa1, 0x92, 0xa1, 0xb3, 0xa3, 0x01, 0x00, 0x10, 0x09,
+    0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xa3,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x4d, 0x3c, 0x1b, 0x80, 0x80, 0x90, 0xb1, 0xa3, 0x92,
+    0x00, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x0a, 0xa2, 0x20, 0x3b, 0x2b, 0x09, 0x90, 0x01, 0x29,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3, 0x02, 0x2a, 0x19, 0x19, 0x3b, 0x2a,
+    0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x1a, 0x39, 0x3c, 0x3b, 0x90, 0xb2, 0xa3, 0x91,
+    0xb2, 0x92, 0x29, 0x2b, 0x19, 0x3a, 0x3b, 0x1a, 0xff, 0xff, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xa3,
+    0x91, 0x91, 0x91, 0xb3, 0xb3, 0x91, 0xb2, 0xa3, 0x30, 0x3c, 0x1a, 0xc3, 0xb3, 0xb5, 0x92, 0x10,
+    0x09, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x99, 0xb1, 0xb4, 0xb3, 0x91, 0x10, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x09, 0xb1, 0xb3, 0xa3, 0x92, 0x39, 0x3c, 0x5b, 0x3b, 0x2b, 0x99, 0x90, 0x01, 0x19, 0x19,
+    0x29, 0x3b, 0x1a, 0x29, 0x3b, 0x1a, 0x00, 0x19, 0x29, 0x1b, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x90,
+    0x01, 0x00, 0x19, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x11, 0x3a,
+    0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x20,
+    0x3b, 0x0a, 0xb2, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x2b, 0x09, 0x10, 0x4b, 0x3b, 0x3d, 0x3b, 0x3a,
+    0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0xd3, 0xb3, 0xa3, 0x21, 0x3b, 0x2b, 0x99, 0xfe, 0xff, 0x00, 0x00,
+    0xb2, 0xb3, 0x21, 0x3b, 0x3b, 0x1a, 0x90, 0xb2, 0xb3, 0x92, 0x90, 0x91, 0xb2, 0xb3, 0x93, 0x19,
+    0x19, 0x19, 0x19, 0x09, 0x91, 0x10, 0x19, 0x99, 0xb3, 0x01, 0x29, 0x3b, 0x3b, 0x5c, 0x3c, 0x3b,
+    0x2b, 0x09, 0xb1, 0x01, 0x29, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x4c, 0x1b,
+    0x90, 0x11, 0x19, 0x91, 0x91, 0x39, 0x3b, 0x1b, 0x19, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x3b,
+    0x1b, 0x91, 0x01, 0x19, 0x19, 0x90, 0xb2, 0xb3, 0x21, 0x3b, 0x1b, 0x01, 0x29, 0x3b, 0x2b, 0x99,
+    0x01, 0x29, 0x3b, 0x1b, 0xb2, 0x92, 0x19, 0x19, 0x19, 0x19, 0x29, 0x3b, 0x1a, 0x00, 0x29, 0x3b,
+    0x3b, 0x2b, 0x19, 0x19, 0x99, 0xb3, 0xa2, 0x91, 0x11, 0x3a, 0x1b, 0x01, 0x91, 0x91, 0x10, 0x3b,
+    0x3b, 0x3a, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0x91, 0x10, 0x09, 0xa1, 0xb3,
+    0xfd, 0xff, 0x00, 0x00, 0xb3, 0x93, 0x3a, 0x3b, 0x3b, 0x3b, 0x1b, 0x91, 0x91, 0x01, 0x10, 0x2a,
+    0x99, 0xa2, 0x10, 0x90, 0xc3, 0xa3, 0x92, 0x19, 0x19, 0x19, 0x39, 0x3b, 0x1b, 0xb1, 0xa3, 0x92,
+    0x19, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x90, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0x93, 0x3a, 0x3b, 0x1a,
+    0x39, 0x3b, 0x2b, 0x1a, 0x90, 0x91, 0x01, 0x19, 0x91, 0x29, 0x3b, 0x1b, 0xb2, 0x93, 0x3a, 0x3b,
+    0x1a, 0x00, 0x91, 0x00, 0x39, 0x3b, 0x2b, 0x1a, 0x91, 0x91, 0x10, 0x3a, 0x4c, 0x3b, 0x2b, 0x1b,
+    0x19, 0x19, 0x90, 0x01, 0x19, 0x90, 0xb2, 0x92, 0xb1, 0xc4, 0xb4, 0xa2, 0x11, 0x2a, 0x09, 0x00,
+    0x00, 0x91, 0x00, 0x10, 0x09, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0xa9, 0xb3, 0x02, 0x5b,
+    0x3c, 0x3a, 0x3b, 0x4b, 0x3b, 0x2b, 0x99, 0x91, 0x91, 0x91, 0x39, 0x2b, 0xa9, 0xb3, 0xb3, 0xb3,
+    0x92, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x90, 0xd3, 0xc4, 0xb3, 0x92, 0x00, 0x08,
+    0x09, 0xa1, 0xb3, 0x11, 0x29, 0x1a, 0x00, 0x10, 0x3a, 0x2b, 0xa0, 0xa3, 0x01, 0x00, 0x91, 0xa1,
+    0xb3, 0xa3, 0x91, 0x01, 0x10, 0x09, 0x91, 0x91, 0x39, 0x1b, 0x19, 0x19, 0x19, 0x91, 0x90, 0xb2,
+    0xb3, 0x92, 0x19, 0x19, 0x19, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b,
+    0x3b, 0x1a, 0x10, 0x19, 0x3a, 0x2b, 0x09, 0x91, 0x91, 0xa1, 0xb3, 0xb3, 0x11, 0x19, 0x90, 0xb2,
+    0xb3, 0x92, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x99, 0x91, 0x01, 0x19, 0x90, 0x91, 0x01,
+    0x19, 0x19, 0x90, 0xb3, 0x01, 0x19, 0x29, 0x3b, 0x4c, 0x1b, 0x80, 0x39, 0x3b, 0x1b, 0x19, 0x19,
+    0x00, 0x19, 0x00, 0xb1, 0xa3, 0xb3, 0x92, 0x29, 0x3b, 0x2b, 0x09, 0x91, 0x19, 0x39, 0x1b, 0x19,
+    0x19, 0x19, 0x39, 0x3c, 0x3b, 0x19, 0x00, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x0a, 0xb2, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x10, 0x4b, 0x3b,
+    0x9b, 0x91, 0x01, 0x29, 0x3b, 0x2b, 0xa0, 0xb3, 0x92, 0x39, 0x3c, 0x2a, 0x09, 0x00, 0xa1, 0xa3,
+    0x01, 0xa1, 0xa3, 0x01, 0x00, 0x91, 0x00, 0x91, 0xa1, 0xb3, 0xb3, 0x93, 0x19, 0x99, 0xb2, 0x92,
+    0x00, 0x90, 0x11, 0x3b, 0x3b, 0x2a, 0x19, 0x09, 0x39, 0x4d, 0x2c, 0x19, 0x3a, 0x3b, 0x3a, 0x1a,
+    0x19, 0x10, 0x3a, 0x3b, 0x1a, 0x10, 0x09, 0x91, 0x10, 0x3a, 0x1b, 0x91, 0x91, 0xd3, 0xc4, 0xb3,
+    0x01, 0x29, 0x2b, 0x2a, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x19, 0xb1, 0xa3, 0x92, 0x19, 0xb1,
+    0xb4, 0xb3, 0x29, 0x3b, 0x0a, 0xc3, 0xb3, 0x93, 0x01, 0x00, 0xa1, 0x92, 0x10, 0x2a, 0x99, 0xc3,
+    0xb3, 0xa4, 0xb2, 0xb2, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xd4, 0xf8, 0xff, 0x06, 0x00,
+    0xb4, 0x02, 0x3a, 0x2a, 0x19, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x10, 0x09, 0xa1, 0xb3, 0x93, 0x19,
+    0x3b, 0x2a, 0x09, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x2b, 0xa0, 0xb3, 0xa3, 0x91, 0xb3, 0xa2, 0x30, 0x2b, 0x1a, 0x00, 0x91, 0x91, 0x10, 0x19,
+    0x99, 0x91, 0x01, 0x19, 0x19, 0x29, 0x3b, 0x1b, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0x02,
+    0x3b, 0x3b, 0x3a, 0x3b, 0x99, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x99, 0xb3, 0x01, 0x29,
+    0x3b, 0x3b, 0x9a, 0xb3, 0xc4, 0x93, 0x00, 0x1a, 0x90, 0xa2, 0x01, 0x19, 0x91, 0x91, 0x91, 0xa1,
+    0x92, 0x29, 0x2b, 0xa0, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0xb3, 0xa3, 0x20, 0x3b, 0x0a, 0x91, 0x01,
+    0x19, 0x90, 0x91, 0xd3, 0xb3, 0x93, 0x10, 0x19, 0x91, 0x91, 0x39, 0x2b, 0x1a, 0x29, 0x3b, 0x3b,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x5c, 0x3c, 0x3b, 0x3b, 0x3b, 0x2a, 0x19, 0x19, 0x19, 0x99, 0xb2,
+    0x92, 0x29, 0x2b, 0x09, 0x29, 0x3b, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x19,
+    0x2a, 0x19, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x09,
+    0x91, 0x10, 0x3a, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xa3, 0x01, 0x39, 0x3c,
+    0x2a, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0x21, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x90, 0xd3, 0xc4, 0x92, 0x80, 0xa1, 0xa3, 0x21, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x00,
+    0x00, 0x90, 0x01, 0x29, 0x3b, 0x1b, 0xb2, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0x11, 0x3b, 0x3b, 0x3b, 0x1a, 0xb2, 0xb3, 0x92, 0x19, 0x00, 0x00, 0x29,
+    0x1a, 0x10, 0x3a, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x4b, 0x3c, 0x2a, 0x4a, 0x3c, 0x09, 0xb1,
+    0x11, 0x3a, 0xa9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x91, 0x01, 0x91,
+    0x91, 0x10, 0x19, 0x09, 0x91, 0x91, 0x10, 0x19, 0x19, 0x09, 0xb1, 0xa3, 0x21, 0x3b, 0x3b, 0x3b,
+    0x1b, 0x91, 0xb3, 0x91, 0xc3, 0xc4, 0xa3, 0xa2, 0xa2, 0xb3, 0xb4, 0xb3, 0x29, 0x0a, 0xb2, 0xa3,
+    0x01, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x00, 0x29, 0x3b,
+    0x3b, 0x99, 0x91, 0x10, 0x3b, 0x2a, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x19, 0x99, 0xb2,
+    0xb3, 0x11, 0x90, 0x91, 0x91, 0x11, 0x19, 0x3b, 0x90, 0x91, 0x39, 0x2b, 0x1a, 0x19, 0x29, 0x1a,
+    0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x19, 0x39, 0x3b, 0x2b, 0x1a, 0x19, 0x10, 0x3a, 0x3b,
+    0x3b, 0x2b, 0x90, 0xa1, 0xa3, 0x11, 0x19, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x91, 0x29, 0x3b,
+    0x2b, 0x09, 0x90, 0x11, 0x2a, 0x99, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x19, 0x00, 0x90,
+    0x91, 0xb2, 0x92, 0x19, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x11, 0x19, 0x09, 0x00,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x91, 0x39,
+    0x3b, 0x1b, 0x10, 0x2a, 0x99, 0xc3, 0xb3, 0xa4, 0xb2, 0xa2, 0x91, 0x91, 0xa2, 0x11, 0x09, 0x10,
+    0x3a, 0x3b, 0x3b, 0x2b, 0x19, 0x09, 0x90, 0x11, 0x3a, 0x3b, 0x1a, 0x00, 0xa1, 0xb3, 0xa3, 0x01,
+    0x00, 0x00, 0x90, 0xd3, 0xc4, 0xb3, 0x01, 0x19, 0x08, 0x19, 0x3a, 0x3b, 0x4b, 0x4d, 0x1a, 0x88,
+    0x91, 0x91, 0x91, 0xb3, 0xb3, 0x92, 0x19, 0x99, 0xb3, 0xb3, 0x91, 0x11, 0x19, 0x3b, 0x5b, 0x2b,
+    0x1a, 0x90, 0x10, 0x19, 0x09, 0xb1, 0xa3, 0x92, 0x90, 0xb2, 0xb3, 0x92, 0xff, 0xff, 0x00, 0x00,
+    0x19, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x19, 0x29, 0x2b, 0x19, 0x19,
+    0x99, 0x91, 0x11, 0x19, 0x19, 0x19, 0x99, 0xb2, 0xa3, 0x20, 0x3b, 0x3b, 0x3b, 0x2b, 0xa0, 0x92,
+    0x29, 0x2b, 0xa0, 0x92, 0x00, 0x90, 0x01, 0x90, 0x91, 0x01, 0x90, 0x91, 0x01, 0x19, 0x19, 0x19,
+    0xb1, 0xa3, 0x11, 0x19, 0xb1, 0xb3, 0xa3, 0x21, 0x3b, 0x1b, 0xb2, 0xa3, 0x01, 0x00, 0x10, 0x3a,
+    0x1a, 0x00, 0x39, 0x3c, 0x4b, 0x0a, 0xb2, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x21, 0x2b,
+    0x09, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x39, 0x1b, 0xb1, 0xb5, 0xa2, 0x91, 0x91, 0x10, 0x09, 0xa1,
+    0xb3, 0x92, 0x91, 0x90, 0x91, 0xb2, 0x92, 0x91, 0x91, 0x39, 0x2b, 0x99, 0x10, 0x3a, 0x3b, 0x3b,
+    0x1a, 0x19, 0x10, 0x09, 0xa1, 0xa3, 0x11, 0x09, 0x00, 0xa1, 0xb3, 0x02, 0x09, 0x91, 0x10, 0x3a,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x29, 0x3b, 0x2b,
+    0x99, 0x91, 0x01, 0x39, 0x3b, 0x1b, 0x91, 0x29, 0x1b, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x19, 0x19,
+    0x90, 0x91, 0x11, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c, 0x99, 0x92, 0x09, 0xa1, 0xb3, 0xa3,
+    0x11, 0x3a, 0x3b, 0x1a, 0x90, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x99, 0x91, 0x91, 0x90, 0xb2, 0xb3,
+    0x02, 0x5b, 0x4c, 0x3b, 0x09, 0x88, 0xc2, 0xc5, 0xb3, 0xa3, 0x91, 0x81, 0x28, 0x3b, 0x3b, 0x2b,
+    0x09, 0x90, 0x91, 0x91, 0x11, 0x09, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0x01, 0x29, 0x3b, 0x3b, 0x3b,
+    0x4c, 0x1b, 0xb1, 0xb5, 0xc3, 0xb4, 0x01, 0x19, 0x98, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x11,
+    0x3a, 0x3b, 0x3b, 0x1a, 0xa1, 0x92, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x10, 0x3a, 0x1a,
+    0xa1, 0xa3, 0x91, 0xb2, 0xfd, 0xff, 0x00, 0x00, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+    0x3b, 0x3b, 0x2b, 0x99, 0xb3, 0x91, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x10, 0x09, 0x29, 0x2a, 0x2b,
+    0x3a, 0x3b, 0x1b, 0xb2, 0x92, 0x19, 0x90, 0x01, 0x00, 0x19, 0x00, 0x00, 0x00, 0x10, 0x09, 0xa1,
+    0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x4b, 0x3c, 0x3b, 0x09, 0xb2, 0x92, 0x91, 0x29, 0x3b, 0x3b, 0x4c,
+    0x2b, 0x1a, 0x19, 0x99, 0xc3, 0xa3, 0x92, 0x90, 0x11, 0x19, 0x09, 0x91, 0x91, 0x91, 0x29, 0x3b,
+    0x1b, 0xd3, 0xc4, 0x92, 0x00, 0x19, 0x19, 0xb1, 0xc4, 0xa3, 0x92, 0xb2, 0xb3, 0x92, 0x19, 0x19,
+    0x90, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0xa1, 0xa3, 0x11, 0x4b, 0x2b, 0xa9, 0xb3, 0xb3, 0xa3, 0x91,
+    0x11, 0x3a, 0x3b, 0x2b, 0x19, 0x19, 0x2a, 0x19, 0x09, 0x90, 0xb2, 0x02, 0x4b, 0x3b, 0x9b, 0xb2,
+    0xb3, 0x92, 0x19, 0x00, 0x00, 0x00, 0x10, 0x09, 0xff, 0xff, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x11,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x91, 0x01, 0x39, 0x4d, 0x3c, 0x2b, 0x19, 0x19, 0x09,
+    0xb2, 0x92, 0x19, 0x19, 0x90, 0x91, 0xb3, 0xb3, 0x11, 0x19, 0x99, 0x91, 0x01, 0x39, 0x3b, 0x1b,
+    0x10, 0x19, 0x3a, 0x4b, 0x3c, 0x1a, 0xb1, 0xa2, 0x11, 0x09, 0x10, 0x09, 0xb1, 0xb5, 0xb3, 0xb2,
+    0xb2, 0xa3, 0x10, 0x90, 0xd3, 0xa3, 0x92, 0x10, 0x29, 0x2b, 0x99, 0x01, 0x00, 0x29, 0x3b, 0x0a,
+    0xa2, 0x91, 0x01, 0x91, 0xa1, 0xa3, 0x11, 0x19, 0x3a, 0x4b, 0x3c, 0x2a, 0xa8, 0xb3, 0xa3, 0x11,
+    0x2a, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x2b, 0xb0, 0xb4, 0x92, 0x09,
+    0x10, 0x3a, 0x1a, 0xa1, 0xa3, 0x91, 0x01, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x09,
+    0x00, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0xa9, 0xb3, 0xb3, 0x92, 0x91, 0x90, 0xfe, 0xff, 0x00, 0x00,
+    0xb2, 0xb3, 0x31, 0x4d, 0x2b, 0x0a, 0xa1, 0xa3, 0xb3, 0x92, 0x90, 0xb2, 0xa3, 0x20, 0x1a, 0xa1,
+    0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x91, 0x01, 0x10, 0x19, 0x09,
+    0xa1, 0xb3, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x2b, 0xa0, 0xa3, 0x01, 0x00, 0x91, 0x10, 0x3a, 0x3b,
+    0x99, 0xa1, 0x93, 0x19, 0x19, 0x09, 0x91, 0x91, 0x39, 0x3c, 0x3b, 0x19, 0x00, 0x91, 0x00, 0x00,
+    0xa1, 0xb3, 0xa3, 0x91, 0x11, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x09, 0x91, 0x29, 0x3b, 0x3b, 0x0a,
+    0xa2, 0x11, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0xb3, 0x91, 0xb2, 0xc5, 0x93, 0x18,
+    0x2a, 0xa9, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x1a, 0x00, 0x10, 0x09, 0xa1, 0xa3, 0x91, 0xb2,
+    0xa3, 0x20, 0x2b, 0xa0, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a,
+    0xff, 0xff, 0x00, 0x00, 0x91, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0xa2, 0x10, 0x29,
+    0x2b, 0x99, 0x01, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x09,
+    0x91, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x19, 0x19, 0x29,
+    0x4b, 0x3c, 0x99, 0xc3, 0x92, 0x39, 0x4c, 0x2b, 0x3b, 0x1b, 0xa1, 0xb3, 0x11, 0x29, 0x3b, 0x4c,
+    0x1b, 0x80, 0x39, 0x3c, 0x2a, 0x09, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x2b, 0xa0, 0xb3, 0x92,
+    0x00, 0x90, 0x01, 0x19, 0x19, 0x90, 0xb2, 0xc4, 0x93, 0x39, 0x0b, 0xb1, 0xa3, 0x92, 0x91, 0x91,
+    0x91, 0x29, 0x2b, 0x19, 0x19, 0x1a, 0x91, 0x01, 0x19, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0x39,
+    0x1b, 0x90, 0x91, 0x91, 0x01, 0x19, 0x19, 0x91, 0x91, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0x90, 0xa2,
+    0x01, 0x29, 0x99, 0x91, 0xff, 0xff, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0x92, 0xa1, 0x92, 0x10, 0x99,
+    0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0xa1, 0xb3, 0x92, 0x39, 0x2b, 0x1a, 0xa1, 0xb3, 0xb3,
+    0x02, 0x4b, 0x2b, 0x1a, 0x91, 0xa1, 0xa3, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x90, 0xc3, 0xb3,
+    0xb4, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x1a, 0x00, 0x19, 0x90, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x0a, 0x11, 0x2a, 0x99, 0x01, 0x00, 0x29, 0x5b, 0x3c, 0x1a, 0x18,
+    0x3a, 0x09, 0x10, 0x3a, 0x2b, 0x19, 0x19, 0x09, 0xb1, 0xb4, 0xa2, 0x10, 0x91, 0x00, 0x10, 0x19,
+    0x4b, 0x4c, 0x2b, 0x89, 0x91, 0x01, 0x00, 0x91, 0x19, 0x29, 0x1a, 0xb1, 0xa3, 0x91, 0xb3, 0x93,
+    0x3a, 0x1b, 0xb2, 0xb3, 0x21, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xa3, 0x10, 0x00, 0x90, 0x11, 0x19,
+    0x19, 0x99, 0xb2, 0xa3, 0x11, 0x4b, 0x3b, 0x2c, 0x01, 0x00, 0x01, 0x00, 0x19, 0x91, 0x39, 0x3c,
+    0x3b, 0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0xa1, 0x92, 0x39, 0x3c, 0x4b, 0x4b, 0x3b, 0x3b,
+    0x3a, 0x0a, 0xc3, 0xb3, 0xa4, 0xb2, 0xb3, 0xb3, 0x91, 0x91, 0xb2, 0x92, 0x19, 0x90, 0x91, 0x11,
+    0x4b, 0x4b, 0x3c, 0x3b, 0x1b, 0x19, 0x3a, 0x1b, 0x91, 0xa2, 0x91, 0x01, 0x10, 0x19, 0x2a, 0x99,
+    0xb3, 0xb2, 0x11, 0x00, 0x90, 0x01, 0x19, 0xa1, 0xb3, 0x02, 0x3b, 0x3b, 0x3b, 0x3b, 0x4b, 0x2b,
+    0xa9, 0x02, 0x5b, 0x3c, 0x2a, 0x19, 0x3a, 0x19, 0x19, 0x19, 0x3a, 0x3b, 0x1a, 0xa1, 0xb3, 0x11,
+    0x19, 0x00, 0x39, 0x3c, 0x1b, 0xb4, 0xc3, 0xb3, 0xb4, 0x92, 0x3a, 0x3b, 0x0a, 0xb2, 0x11, 0x29,
+    0x0a, 0x91, 0x11, 0x4b, 0x2b, 0x1a, 0x19, 0x90, 0xd3, 0xc4, 0x92, 0x00, 0x19, 0x08, 0x09, 0x29,
+    0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x0a, 0x91, 0xb3, 0x11, 0x19, 0xff, 0xff, 0x00, 0x00,
+    0x90, 0x11, 0x3a, 0x3b, 0x1b, 0xb1, 0xb5, 0x92, 0x10, 0x19, 0x09, 0x19, 0x29, 0x2b, 0x09, 0x00,
+    0x19, 0xb1, 0xb3, 0xb4, 0x11, 0x2b, 0x3a, 0x19, 0x09, 0xb1, 0x93, 0x19, 0x19, 0x99, 0x11, 0xa1,
+    0xa2, 0xb3, 0xb3, 0x92, 0x11, 0x99, 0xa1, 0xb3, 0x92, 0x10, 0x5b, 0x2c, 0x88, 0xb2, 0x11, 0x99,
+    0xb2, 0xb3, 0xa3, 0x91, 0x01, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0x91, 0x11,
+    0x99, 0x09, 0x91, 0xd3, 0xb5, 0xa3, 0x91, 0x28, 0x5b, 0x2b, 0x19, 0x99, 0x00, 0x19, 0x19, 0x00,
+    0x19, 0x39, 0x3b, 0x1b, 0xb1, 0xb4, 0x92, 0x3a, 0x4b, 0x3c, 0x2a, 0x19, 0x19, 0x39, 0x2b, 0x3b,
+    0x3b, 0x2b, 0x19, 0x2a, 0x99, 0xb2, 0xb2, 0xb3, 0xa3, 0xc3, 0x02, 0x19, 0xa0, 0xb3, 0xb3, 0x92,
+    0x00, 0xb1, 0xb4, 0xe3, 0xa3, 0x01, 0x29, 0x2b, 0x1a, 0x19, 0x19, 0x19, 0x00, 0x10, 0x3a, 0x2b,
+    0x00, 0x00, 0x00, 0x00, 0x3a, 0x2b, 0x09, 0x19, 0x91, 0x39, 0x4c, 0x3c, 0x1a, 0x90, 0xa1, 0xc3,
+    0xb4, 0xa2, 0x91, 0x29, 0x1a, 0x19, 0x19, 0x90, 0x01, 0x29, 0x2b, 0x9a, 0xa2, 0xb3, 0x93, 0x00,
+    0x39, 0x1b, 0x19, 0x10, 0x09, 0x19, 0x19, 0x90, 0xc3, 0xb3, 0xa4, 0x11, 0x3b, 0x3b, 0x2a, 0x3b,
+    0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x19, 0x29, 0x0a, 0x91, 0x11, 0x3b, 0x3b, 0x19, 0x3a, 0x2b, 0x99,
+    0xb3, 0xb3, 0xb3, 0xb1, 0xb4, 0xb3, 0x01, 0x90, 0x01, 0x90, 0xb3, 0xa2, 0x20, 0x3b, 0x3b, 0x4c,
+    0x3b, 0x1b, 0x19, 0x3b, 0x5c, 0x2b, 0x2a, 0x2a, 0x1b, 0x19, 0x91, 0x10, 0x09, 0x00, 0x19, 0x09,
+    0x91, 0x91, 0x91, 0x01, 0x39, 0x2b, 0x1a, 0x00, 0x10, 0x3a, 0x2b, 0xb0, 0xb4, 0x92, 0x19, 0x1b,
+    0x30, 0x1a, 0x19, 0x19, 0x29, 0x3b, 0x3b, 0xb9, 0xb3, 0x93, 0x4a, 0x3b, 0x3d, 0x4b, 0x2c, 0x19,
+    0x90, 0xb2, 0x91, 0x01, 0xff, 0xff, 0x00, 0x00, 0x10, 0x09, 0x00, 0x10, 0x09, 0xa1, 0xb3, 0x93,
+    0x09, 0x00, 0x91, 0x90, 0xc3, 0xa3, 0x11, 0x39, 0x2b, 0x9a, 0x91, 0x21, 0x3b, 0x3b, 0x99, 0x91,
+    0xa1, 0xa3, 0x01, 0x19, 0x39, 0x3c, 0x1a, 0x91, 0xa1, 0xb3, 0xa3, 0x11, 0x10, 0x99, 0xb2, 0x02,
+    0x3b, 0x19, 0x99, 0x11, 0x2b, 0x29, 0x1a, 0x19, 0x19, 0x91, 0x39, 0x3d, 0x3b, 0x2a, 0xa1, 0xb3,
+    0xa3, 0x91, 0xb2, 0xb3, 0xa3, 0x01, 0x29, 0x9b, 0x11, 0x01, 0x19, 0x90, 0xb2, 0xb3, 0xc3, 0xb4,
+    0xa2, 0x91, 0x20, 0x1b, 0xb1, 0xa3, 0x92, 0x29, 0x3b, 0x2b, 0x19, 0x29, 0x3b, 0x3c, 0x3b, 0x3a,
+    0x09, 0xa1, 0xa3, 0x11, 0x09, 0x19, 0x39, 0x2c, 0x98, 0x01, 0x19, 0x19, 0x10, 0x99, 0xc3, 0x02,
+    0x3a, 0x1b, 0x00, 0xa1, 0x92, 0x10, 0x3b, 0x1a, 0x10, 0x91, 0x3a, 0x5b, 0x2b, 0x1a, 0x19, 0x19,
+    0x99, 0x90, 0x31, 0x3c, 0x3b, 0x19, 0x19, 0x39, 0x02, 0x00, 0x00, 0x00, 0x4c, 0x3c, 0x09, 0xa0,
+    0xb2, 0x20, 0x2a, 0x09, 0x90, 0x10, 0x29, 0x3b, 0x2b, 0x09, 0x39, 0x3b, 0x2b, 0x1a, 0x19, 0x91,
+    0x91, 0x29, 0x2b, 0x99, 0xb3, 0xb3, 0x01, 0x19, 0x10, 0x3a, 0x1a, 0x09, 0x91, 0x01, 0x29, 0x3b,
+    0x3b, 0x1b, 0x11, 0x09, 0x10, 0x09, 0x09, 0xb2, 0xb3, 0xd3, 0xb3, 0xb5, 0x10, 0x29, 0x3a, 0x09,
+    0x00, 0x29, 0x3b, 0x3b, 0x1a, 0x90, 0x01, 0x90, 0xb2, 0x92, 0xb1, 0x01, 0x01, 0x20, 0x3b, 0x2b,
+    0x09, 0x00, 0x29, 0x1a, 0x19, 0x00, 0x19, 0x39, 0x2b, 0x1a, 0x29, 0x3b, 0x1a, 0x91, 0x91, 0x29,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2a, 0x3b, 0x3b, 0x2a, 0x0b, 0x30, 0x3b, 0x3b, 0x1a, 0x90, 0x01,
+    0x90, 0x91, 0xc3, 0xd3, 0xa3, 0x92, 0x91, 0x99, 0x01, 0x29, 0x2b, 0x2a, 0x09, 0x10, 0x90, 0x19,
+    0x99, 0x91, 0x92, 0x90, 0x01, 0x01, 0x19, 0x3b, 0x1a, 0x91, 0x01, 0x39, 0x02, 0x00, 0x00, 0x00,
+    0x3b, 0x0b, 0xa2, 0x91, 0x90, 0x30, 0x1b, 0x19, 0xb2, 0xb3, 0xa2, 0xb3, 0xb3, 0x92, 0x29, 0x1a,
+    0x91, 0x91, 0x29, 0x1b, 0x91, 0x11, 0x19, 0x1a, 0x01, 0x00, 0x09, 0xa2, 0x11, 0x3a, 0x3b, 0x3b,
+    0x4c, 0x3b, 0x3c, 0x2a, 0x2a, 0x90, 0x90, 0xb3, 0x02, 0x3b, 0x09, 0xb1, 0xb4, 0x11, 0x2a, 0x99,
+    0x09, 0x92, 0xb1, 0xa3, 0x92, 0xb1, 0xb4, 0x92, 0x19, 0x09, 0x19, 0x19, 0x19, 0x00, 0x00, 0x91,
+    0x91, 0x00, 0xa1, 0xb1, 0x03, 0x20, 0x3b, 0x2b, 0x3a, 0x09, 0x2a, 0x19, 0x99, 0x11, 0x19, 0x3a,
+    0x1a, 0x90, 0xa1, 0xb4, 0xa2, 0x11, 0xa9, 0x11, 0x01, 0x10, 0x09, 0x29, 0x1b, 0x4a, 0x3b, 0x3b,
+    0x2b, 0xa9, 0xd4, 0xa3, 0xa3, 0xc2, 0xa3, 0xa2, 0x01, 0x90, 0x91, 0x91, 0x10, 0x19, 0xb1, 0xb3,
+    0xa3, 0xb3, 0xb3, 0x92, 0x10, 0x3a, 0x1b, 0x91, 0x01, 0x3b, 0x3a, 0x99, 0xb2, 0xb3, 0xb2, 0x13,
+    0x01, 0x00, 0x00, 0x00, 0x2a, 0x2a, 0x4b, 0x3c, 0x1a, 0x19, 0x11, 0x10, 0x3a, 0x3b, 0x3b, 0x1a,
+    0xa9, 0x12, 0x01, 0x3b, 0x3b, 0xa0, 0x93, 0x90, 0x10, 0x19, 0x99, 0x00, 0xb2, 0xb3, 0x92, 0x29,
+    0x3b, 0x3b, 0x3b, 0x1b, 0xb2, 0xb3, 0x39, 0x3a, 0x1b, 0xb1, 0x93, 0x91, 0xb2, 0xb3, 0x92, 0xa1,
+    0x92, 0x39, 0x2b, 0x1a, 0x19, 0x90, 0x91, 0x91, 0xa2, 0x91, 0xa1, 0xa3, 0x92, 0x90, 0x91, 0x01,
+    0x29, 0x2b, 0x99, 0xb3, 0x11, 0x19, 0x09, 0x29, 0x2a, 0x1b, 0x3a, 0x00, 0x10, 0x3a, 0x2b, 0x19,
+    0x90, 0x91, 0x91, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0xb1, 0x13, 0x3b, 0x3b, 0xa9, 0x92, 0x39, 0x1b,
+    0xb2, 0xb2, 0xb3, 0xb3, 0x91, 0x92, 0x00, 0xb0, 0xa3, 0xb3, 0xa3, 0x92, 0x01, 0x3a, 0x3b, 0x1a,
+    0x29, 0x2a, 0x0a, 0x11, 0x19, 0x3a, 0x3b, 0x1a, 0xa1, 0x91, 0x11, 0x90, 0xb2, 0x02, 0x19, 0x3b,
+    0x09, 0x90, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x09, 0x90, 0xb3, 0xd3, 0xa3, 0x81, 0xb1, 0xb4,
+    0xb4, 0x01, 0x90, 0x39, 0x1b, 0x90, 0x91, 0xb2, 0xc4, 0x93, 0x00, 0x99, 0x29, 0x3b, 0x3b, 0x3b,
+    0x2b, 0x19, 0x99, 0xd2, 0xa3, 0xa3, 0x01, 0xb1, 0xa4, 0x01, 0x2a, 0x09, 0x91, 0xb2, 0x01, 0x19,
+    0x29, 0x2b, 0x99, 0x11, 0x3b, 0x3a, 0x9a, 0xc3, 0xa3, 0xa3, 0xb3, 0xb4, 0x91, 0x00, 0x2b, 0x39,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0xb1, 0x93, 0x00, 0x29, 0x2b, 0x19, 0x99, 0x91, 0x01, 0xb1, 0xb5,
+    0xb2, 0xb3, 0xb2, 0x93, 0x3b, 0x3b, 0x99, 0xb3, 0x91, 0x91, 0xb3, 0xb2, 0x92, 0x90, 0xa2, 0x91,
+    0x91, 0x91, 0xa2, 0x91, 0x39, 0x3b, 0x3b, 0x2b, 0x4c, 0x1a, 0x90, 0x11, 0x3a, 0x9a, 0xb3, 0x93,
+    0x09, 0x00, 0x90, 0x91, 0xa2, 0xb2, 0x01, 0x01, 0xb3, 0xd3, 0x01, 0xa1, 0x09, 0x11, 0x29, 0x99,
+    0x91, 0x91, 0x11, 0x09, 0x90, 0xd3, 0xb4, 0x81, 0xff, 0xff, 0x03, 0x00, 0x90, 0xc2, 0x82, 0x19,
+    0x3b, 0x29, 0xa9, 0xb3, 0xa3, 0xb2, 0xc4, 0x93, 0x29, 0x1a, 0x91, 0xa1, 0x92, 0x39, 0x1b, 0x09,
+    0x11, 0x19, 0x09, 0x00, 0x91, 0x29, 0x2b, 0x3b, 0x3a, 0x3b, 0x3b, 0xa9, 0xa2, 0x01, 0xb2, 0xb3,
+    0x31, 0x9a, 0xb1, 0xa5, 0x91, 0x91, 0x29, 0x3b, 0x1b, 0x00, 0x3a, 0x19, 0x90, 0xb3, 0xb2, 0x13,
+    0x99, 0x19, 0x09, 0xa1, 0x92, 0x10, 0x4b, 0x1b, 0x1b, 0xa3, 0xb3, 0xb3, 0xa3, 0x01, 0x2a, 0x19,
+    0x10, 0x3a, 0x0a, 0xb2, 0xb3, 0x92, 0x91, 0x09, 0x01, 0x90, 0x91, 0x91, 0x11, 0x19, 0x3a, 0x0a,
+    0xb2, 0xb3, 0xb3, 0x92, 0xb9, 0xa3, 0xa5, 0xa1, 0xb3, 0x11, 0x1a, 0xb3, 0xc4, 0xa3, 0xb2, 0xb3,
+    0xb3, 0x93, 0xb2, 0xb3, 0x01, 0x91, 0x91, 0x11, 0x1a, 0x00, 0x91, 0x30, 0x1b, 0x29, 0x9a, 0xb3,
+    0xb3, 0xb2, 0xa3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x3b, 0x2a, 0x99, 0xa2, 0xfe, 0xff, 0x00, 0x00,
+    0x01, 0x90, 0xb2, 0x92, 0x91, 0x29, 0x1a, 0x91, 0x00, 0xa1, 0x11, 0x39, 0x0b, 0xc3, 0xc3, 0x92,
+    0x30, 0x91, 0x2a, 0x1a, 0x91, 0x01, 0x3b, 0x4b, 0x3d, 0x08, 0x2a, 0x39, 0x1a, 0x90, 0x91, 0xa1,
+    0x11, 0x91, 0x91, 0xb3, 0xb2, 0x11, 0x09, 0x91, 0x01, 0x39, 0x0b, 0xa0, 0x93, 0x09, 0x31, 0x1b,
+    0x00, 0xa1, 0xb3, 0xa3, 0x93, 0x9a, 0x02, 0x91, 0x19, 0x99, 0x90, 0xb3, 0xa3, 0x11, 0x09, 0x99,
+    0x11, 0x90, 0x92, 0x19, 0x3a, 0x2a, 0x1b, 0x19, 0x01, 0x01, 0x99, 0xa2, 0x99, 0x30, 0x3b, 0x3a,
+    0x0a, 0x11, 0x99, 0xb2, 0xc4, 0xa3, 0xb3, 0xb3, 0x93, 0xa9, 0x02, 0x91, 0x92, 0x19, 0x3b, 0x3b,
+    0x99, 0x91, 0x10, 0x39, 0x9a, 0x91, 0xa1, 0x21, 0x1a, 0x19, 0x91, 0xb2, 0xc4, 0x93, 0x29, 0x1b,
+    0x01, 0x19, 0x11, 0x09, 0x3a, 0x3d, 0x4b, 0x2b, 0x2a, 0x19, 0xa9, 0xb3, 0xb1, 0x22, 0xa9, 0x11,
+    0xfe, 0xff, 0x00, 0x00, 0x91, 0xb2, 0x10, 0x93, 0xa9, 0xa3, 0x01, 0x19, 0xa1, 0xb2, 0x13, 0x19,
+    0x99, 0xb0, 0xa1, 0xa4, 0x10, 0x30, 0x2b, 0x19, 0xa0, 0xb2, 0xb3, 0x21, 0x3a, 0x3b, 0x2b, 0x99,
+    0x3b, 0x01, 0xb1, 0xb3, 0xb3, 0xb5, 0xc3, 0xb3, 0x92, 0xb3, 0xb5, 0x91, 0x20, 0x09, 0xb2, 0x91,
+    0xb2, 0xa3, 0x01, 0x3a, 0x3a, 0x1a, 0x91, 0x39, 0x3b, 0x1b, 0x29, 0x91, 0xa9, 0xb2, 0x11, 0xb2,
+    0x93, 0x99, 0x11, 0x99, 0xb3, 0x11, 0x19, 0x2a, 0x19, 0x19, 0x1a, 0x21, 0x2b, 0x3c, 0x5a, 0x1b,
+    0x80, 0xb3, 0xa1, 0x92, 0x1b, 0x93, 0x01, 0x19, 0x3b, 0x10, 0x99, 0x2a, 0x29, 0x0b, 0x3b, 0x30,
+    0x9a, 0x92, 0x99, 0x00, 0x11, 0x11, 0x2b, 0xb0, 0x93, 0x90, 0x91, 0x11, 0x99, 0xc2, 0xa3, 0xb3,
+    0x92, 0x10, 0x19, 0x20, 0x0b, 0xb3, 0xb2, 0x02, 0x3a, 0x1a, 0xb1, 0xa3, 0x92, 0x90, 0xa3, 0x91,
+    0x19, 0x19, 0x91, 0x91, 0xff, 0xff, 0x00, 0x00, 0x3a, 0x5c, 0x3c, 0x0a, 0x10, 0xb1, 0xc2, 0x91,
+    0x11, 0x10, 0x01, 0x90, 0xb2, 0xb3, 0x91, 0x92, 0x90, 0x29, 0x19, 0x3b, 0x1b, 0xd3, 0xb3, 0x11,
+    0x3d, 0x91, 0x98, 0x91, 0xb3, 0xb3, 0x11, 0x09, 0x19, 0x19, 0xa1, 0x13, 0x0a, 0x11, 0x1a, 0x00,
+    0x91, 0x1b, 0x11, 0x99, 0x01, 0x30, 0x3b, 0x3b, 0x3b, 0x1b, 0x01, 0xa0, 0x21, 0x3b, 0x19, 0xa9,
+    0x93, 0x91, 0x19, 0x00, 0x29, 0xc2, 0x90, 0x30, 0x19, 0xb1, 0x92, 0x19, 0x01, 0x99, 0x39, 0x3b,
+    0x1b, 0xb3, 0x3b, 0x7a, 0x1a, 0x88, 0x91, 0x92, 0x91, 0x3a, 0x19, 0x3b, 0x3a, 0x1b, 0x39, 0xa1,
+    0x10, 0x1a, 0x90, 0x11, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0xb0, 0x13, 0x3b, 0x3b, 0x1b, 0x92, 0xb3,
+    0x9b, 0x40, 0x3a, 0x2b, 0x1b, 0x2a, 0x29, 0x3d, 0x3b, 0x3b, 0x3a, 0x91, 0x91, 0x39, 0xab, 0x2a,
+    0x12, 0x19, 0xa1, 0xd2, 0x92, 0x5b, 0x39, 0x2b, 0x00, 0x00, 0x01, 0x00, 0x3c, 0x39, 0x8d, 0x11,
+    0xf2, 0xa2, 0xb2, 0x12, 0x2a, 0x0b, 0x19, 0xb3, 0xb3, 0x11, 0x39, 0x2e, 0x09, 0x08, 0xa1, 0xa2,
+    0x30, 0x29, 0x10, 0xbb, 0x31, 0x0a, 0x91, 0x99, 0x02, 0x09, 0x19, 0x13, 0xbb, 0x6b, 0x10, 0x99,
+    0x4a, 0x3a, 0x1e, 0x11, 0xb9, 0x12, 0xb1, 0x13, 0xd0, 0x00, 0x92, 0x19, 0x30, 0x1f, 0x30, 0x1b,
+    0x1a, 0x00, 0x11, 0x19, 0x92, 0x9b, 0x29, 0x09, 0x1d, 0x31, 0x1b, 0x4d, 0x09, 0x09, 0xb3, 0x20,
+    0x3b, 0x3b, 0x99, 0x91, 0xb1, 0x03, 0x9b, 0x33, 0x03, 0xb0, 0x1b, 0x19, 0xb1, 0x11, 0x90, 0x5a,
+    0xb0, 0x82, 0xb2, 0xd3, 0xa1, 0x83, 0xd1, 0x59, 0x01, 0x0c, 0x81, 0xb2, 0xa3, 0xb1, 0x01, 0x03,
+    0x92, 0x1b, 0x19, 0x39, 0x3b, 0x3b, 0x2a, 0xd9, 0x83, 0x99, 0x33, 0x1b, 0x41, 0xaa, 0x5c, 0x2a,
+    0x5b, 0x99, 0x90, 0x91, 0x91, 0xa2, 0x11, 0x00, 0x3c, 0x18, 0x19, 0xa3, 0x01, 0x00, 0x00, 0x00,
+    0x0b, 0x59, 0x3a, 0x0b, 0x1b, 0x31, 0x3b, 0x1f, 0x28, 0x18, 0xab, 0x04, 0x2a, 0x29, 0xd2, 0x90,
+    0xa3, 0x29, 0xb1, 0xb2, 0xb2, 0x12, 0xb9, 0x50, 0x29, 0x2c, 0x00, 0x1c, 0x31, 0x8f, 0x01, 0xb0,
+    0x03, 0xd3, 0x09, 0x28, 0x3d, 0xb9, 0x12, 0x2b, 0x51, 0x9b, 0x10, 0x3a, 0x09, 0x00, 0x0c, 0x19,
+    0x07, 0x90, 0x39, 0x2c, 0x09, 0x88, 0x5b, 0x29, 0x1f, 0x00, 0x19, 0x90, 0x4a, 0x99, 0x2a, 0xa3,
+    0x91, 0x31, 0x19, 0xc0, 0x90, 0xc3, 0x83, 0x13, 0x03, 0x3b, 0x3b, 0x0f, 0x20, 0xb8, 0x71, 0xaa,
+    0x29, 0x80, 0x91, 0x02, 0xb0, 0x21, 0xba, 0x13, 0x12, 0xab, 0x53, 0xb0, 0x19, 0xc4, 0xc1, 0x82,
+    0x95, 0x99, 0x8a, 0x23, 0xd3, 0x0b, 0x59, 0x92, 0x10, 0x0e, 0x23, 0x89, 0xf1, 0x80, 0x09, 0x82,
+    0x20, 0xb9, 0x0b, 0x95, 0x93, 0x1c, 0x11, 0x92, 0xd1, 0x93, 0xa0, 0x95, 0x08, 0x19, 0x13, 0x19,
+    0x07, 0x00, 0x00, 0x00, 0x3b, 0x0d, 0x2a, 0x2d, 0x01, 0xca, 0x85, 0xa2, 0x81, 0x20, 0xab, 0x13,
+    0x9a, 0x30, 0xa9, 0x19, 0x19, 0x3c, 0x31, 0xc0, 0xcb, 0x15, 0x20, 0x18, 0x1b, 0x2d, 0x29, 0xba,
+    0x20, 0x21, 0x1f, 0x81, 0xb8, 0xb1, 0x06, 0xa0, 0x09, 0x5a, 0x18, 0x2b, 0x39, 0x9a, 0x16, 0xf9,
+    0x02, 0xa0, 0x18, 0x91, 0x59, 0x81, 0x1b, 0xa9, 0x05, 0xcb, 0x34, 0xe8, 0x10, 0xa0, 0x83, 0xb9,
+    0x50, 0x09, 0x02, 0x0d, 0x38, 0x00, 0xa1, 0xb1, 0xb1, 0x0b, 0x24, 0xaf, 0x32, 0x1b, 0x44, 0x0a,
+    0x0b, 0x15, 0xdd, 0x00, 0x90, 0x4a, 0x43, 0x09, 0x90, 0xbd, 0x08, 0x86, 0xab, 0x40, 0x18, 0x1b,
+    0x23, 0xbd, 0x00, 0x51, 0x62, 0x81, 0x9e, 0x22, 0x80, 0x9a, 0x98, 0x9a, 0x8d, 0x48, 0x90, 0xcb,
+    0x50, 0x25, 0x00, 0xb9, 0x1a, 0x83, 0x8d, 0x54, 0xc1, 0x8b, 0x33, 0xf0, 0x8b, 0x90, 0x59, 0x13,
+    0x08, 0x32, 0xfb, 0x0d, 0xab, 0xff, 0x1b, 0x00, 0x13, 0xca, 0x38, 0x03, 0x11, 0x91, 0xbc, 0x9a,
+    0xb8, 0x72, 0x17, 0xa9, 0x28, 0x98, 0x9c, 0x0a, 0x88, 0x30, 0x43, 0x22, 0xd1, 0x9b, 0x81, 0x3a,
+    0x94, 0x52, 0xa3, 0x9b, 0x12, 0xfa, 0xbf, 0x43, 0x91, 0x18, 0x89, 0x11, 0xa0, 0xaa, 0x09, 0xa4,
+    0x9f, 0x37, 0xba, 0x38, 0x88, 0x02, 0xba, 0x45, 0x99, 0x10, 0x2b, 0x84, 0xbf, 0x31, 0xb1, 0xbb,
+    0x29, 0x57, 0xb9, 0x0a, 0x32, 0xa1, 0x8b, 0x60, 0x14, 0xca, 0x29, 0x01, 0x98, 0xab, 0x37, 0xe9,
+    0x29, 0x01, 0x01, 0xdc, 0x19, 0x02, 0x41, 0xa8, 0x2a, 0x91, 0x59, 0x95, 0x9c, 0x10, 0x21, 0x88,
+    0x21, 0xec, 0x9b, 0x11, 0x29, 0x17, 0xca, 0x30, 0xb3, 0x0c, 0x83, 0x9a, 0x91, 0x18, 0x25, 0x32,
+    0xfb, 0x0f, 0x82, 0x89, 0x23, 0xb9, 0x63, 0xb8, 0x09, 0x09, 0xa8, 0x51, 0x81, 0xe9, 0x38, 0xc8,
+    0x43, 0xba, 0x91, 0x79, 0x92, 0x39, 0xa2, 0x9a, 0x22, 0x00, 0x19, 0x00, 0x22, 0xbc, 0x14, 0x0c,
+    0xb2, 0x0c, 0xc8, 0x20, 0x28, 0xd3, 0x29, 0xa0, 0xc8, 0x69, 0x82, 0x21, 0x10, 0xf0, 0x58, 0xa0,
+    0x00, 0x2b, 0xa5, 0x2d, 0x95, 0x0c, 0x13, 0xba, 0x80, 0x9b, 0x35, 0x01, 0xb9, 0x8d, 0x13, 0xaa,
+    0x44, 0x90, 0x19, 0xd1, 0x0d, 0x07, 0x89, 0x91, 0x09, 0x98, 0x13, 0x9c, 0x04, 0x1a, 0xa8, 0x52,
+    0x08, 0xa3, 0x0e, 0xda, 0x51, 0xa0, 0x10, 0x80, 0xa0, 0x28, 0xfb, 0x38, 0x91, 0x22, 0xbc, 0x33,
+    0x9d, 0x25, 0xea, 0x18, 0x81, 0x19, 0x23, 0xba, 0x21, 0x81, 0xdb, 0x51, 0xd9, 0x28, 0x02, 0xba,
+    0x41, 0xa0, 0x28, 0x14, 0xcc, 0x11, 0xcb, 0x21, 0xa0, 0x9a, 0x23, 0x50, 0xb1, 0x65, 0xda, 0x22,
+    0xbc, 0x10, 0x11, 0x10, 0x92, 0x9a, 0x89, 0x17, 0x9c, 0xa3, 0x1c, 0x00, 0x24, 0x8a, 0x93, 0x99,
+    0xdf, 0x25, 0x99, 0x32, 0xb8, 0x48, 0xe0, 0x19, 0x92, 0x89, 0x18, 0x30, 0x5a, 0x00, 0x19, 0x00,
+    0xc5, 0x2c, 0xb5, 0x1c, 0x82, 0x00, 0x3a, 0xc6, 0x1c, 0x91, 0x09, 0x13, 0xb8, 0x30, 0x28, 0xb4,
+    0x7b, 0xd2, 0x09, 0x89, 0x32, 0x54, 0xb9, 0xaa, 0x09, 0xe9, 0x18, 0x28, 0x87, 0x2a, 0xe8, 0x30,
+    0xbb, 0x23, 0x59, 0xb2, 0x5a, 0xb2, 0x20, 0xdb, 0x40, 0xa0, 0x40, 0xb9, 0x51, 0xb9, 0x10, 0xac,
+    0x91, 0x48, 0x92, 0xa9, 0x70, 0xa1, 0x2b, 0xb0, 0x71, 0xa2, 0x18, 0xba, 0xa0, 0x2b, 0x85, 0x30,
+    0xca, 0x47, 0xb9, 0x88, 0x9b, 0x42, 0x12, 0x32, 0xda, 0x28, 0xba, 0x26, 0xbd, 0x80, 0x99, 0x52,
+    0x83, 0x28, 0xf8, 0x1c, 0x02, 0x09, 0x02, 0xac, 0x21, 0x09, 0x93, 0x0d, 0x95, 0x0a, 0xa3, 0x0c,
+    0x26, 0xa8, 0x08, 0xb9, 0x30, 0x88, 0x17, 0x9b, 0x83, 0xbf, 0x42, 0x91, 0x8a, 0x34, 0x99, 0x82,
+    0x8e, 0x91, 0x51, 0xe8, 0x39, 0xa1, 0x2a, 0x91, 0x52, 0xda, 0x51, 0xa0, 0x18, 0xba, 0x19, 0x52,
+    0x3b, 0x01, 0x2a, 0x00, 0xb0, 0x3a, 0xa1, 0x58, 0x92, 0xac, 0x48, 0x82, 0x30, 0xf0, 0x8c, 0x21,
+    0x84, 0x89, 0xa0, 0x8c, 0xa0, 0x29, 0x81, 0x35, 0xa9, 0x22, 0x57, 0xc9, 0x31, 0xfb, 0x19, 0x28,
+    0x04, 0x8b, 0x91, 0x1a, 0x14, 0xdb, 0x38, 0xc1, 0x40, 0xa0, 0x0a, 0xa9, 0x1a, 0x06, 0x4a, 0x94,
+    0x2b, 0xf1, 0x2b, 0xe8, 0x51, 0x80, 0x21, 0x8a, 0x84, 0x9c, 0x41, 0xc0, 0x0b, 0x02, 0x41, 0xc9,
+    0xb8, 0x1e, 0x95, 0xbb, 0xff, 0x0e, 0x18, 0x57, 0x80, 0x00, 0x98, 0x01, 0x08, 0x88, 0x88, 0x00,
+    0xa8, 0x10, 0xff, 0x8d, 0x80, 0x08, 0x80, 0x00, 0x08, 0x80, 0x10, 0x88, 0x02, 0x79, 0x57, 0x80,
+    0x00, 0x88, 0x08, 0x88, 0x08, 0x90, 0x08, 0x98, 0x80, 0xff, 0x8d, 0x80, 0x00, 0x88, 0x00, 0x00,
+    0x80, 0x00, 0x88, 0x83, 0x78, 0x57, 0x80, 0x80, 0x80, 0x90, 0x80, 0x88, 0x08, 0x08, 0xa8, 0x91,
+    0xff, 0x8d, 0x80, 0x00, 0x0e, 0x94, 0x51, 0x00, 0x08, 0x00, 0x08, 0x80, 0x80, 0x18, 0x90, 0x75,
+    0x17, 0x08, 0x08, 0x08, 0x88, 0x08, 0x88, 0x88, 0x00, 0x88, 0xf0, 0xcf, 0x08, 0x88, 0x00, 0x08,
+    0x80, 0x00, 0x08, 0x01, 0x09, 0x81, 0x77, 0x06, 0x08, 0x08, 0x08, 0x88, 0x80, 0x88, 0x88, 0x00,
+    0x09, 0xf8, 0xcf, 0x08, 0x08, 0x80, 0x08, 0x80, 0x01, 0x09, 0x81, 0x28, 0x08, 0x77, 0x06, 0x08,
+    0x88, 0x80, 0x80, 0x80, 0x88, 0x80, 0x80, 0x09, 0xfa, 0xcf, 0x80, 0x80, 0x80, 0x00, 0x08, 0x80,
+    0x08, 0x80, 0x21, 0x38, 0x77, 0x86, 0x80, 0x80, 0x80, 0x08, 0x88, 0x00, 0x88, 0x88, 0x09, 0xfb,
+    0xcf, 0x80, 0x80, 0x80, 0x00, 0x08, 0x80, 0x00, 0x88, 0x22, 0x59, 0x77, 0x81, 0x00, 0x88, 0x80,
+    0x00, 0x89, 0x00, 0x08, 0xa8, 0x18, 0xff, 0x8d, 0x80, 0x08, 0x80, 0x80, 0x00, 0x80, 0x00, 0x09,
+    0x82, 0x78, 0x57, 0x80, 0x80, 0x08, 0x80, 0x80, 0x62, 0x66, 0x4c, 0x00, 0x88, 0x00, 0x09, 0x90,
+    0x00, 0xff, 0x0e, 0x08, 0x08, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x81, 0x70, 0x47, 0x88, 0x80,
+    0x80, 0x80, 0x80, 0x08, 0x88, 0x00, 0x98, 0xa1, 0xff, 0x0d, 0x88, 0x00, 0x08, 0x08, 0x00, 0x88,
+    0x81, 0x08, 0x90, 0x74, 0x27, 0x08, 0x80, 0x80, 0x08, 0x88, 0x18, 0x98, 0x08, 0x09, 0xf1, 0xef,
+    0x08, 0x88, 0x00, 0x08, 0x80, 0x80, 0x18, 0x00, 0x18, 0x90, 0x77, 0x04, 0x08, 0x80, 0x08, 0x88,
+    0x08, 0x80, 0x98, 0x88, 0x19, 0xf0, 0xef, 0x08, 0x08, 0x08, 0x08, 0x00, 0x88, 0x00, 0x91, 0x11,
+    0x08, 0x77, 0x04, 0x08, 0x88, 0x80, 0x88, 0x80, 0x80, 0x88, 0x81, 0x0a, 0xfb, 0xef, 0x80, 0x08,
+    0x80, 0x00, 0x80, 0x80, 0x00, 0x90, 0x01, 0x38, 0x77, 0x84, 0x00, 0x88, 0x80, 0x88, 0x88, 0x00,
+    0x88, 0x88, 0x19, 0xfd, 0xaf, 0x00, 0x88, 0x00, 0x08, 0x00, 0x80, 0x18, 0xc9, 0xa4, 0x47, 0x00,
+    0x80, 0x81, 0x78, 0x57, 0x80, 0x00, 0x88, 0x80, 0x88, 0x80, 0x80, 0x88, 0x98, 0x00, 0xff, 0x8d,
+    0x80, 0x08, 0x00, 0x08, 0x80, 0x80, 0x10, 0x08, 0x80, 0x70, 0x57, 0x80, 0x80, 0x80, 0x08, 0x88,
+    0x80, 0x80, 0x08, 0x98, 0x98, 0xff, 0x0d, 0x88, 0x00, 0x08, 0x80, 0x00, 0x88, 0x00, 0x00, 0x82,
+    0x71, 0x57, 0x08, 0x08, 0x08, 0x88, 0x08, 0x08, 0x90, 0x80, 0x98, 0xc0, 0xff, 0x0a, 0x08, 0x08,
+    0x08, 0x00, 0x08, 0x80, 0x00, 0x28, 0x90, 0x76, 0x17, 0x88, 0x80, 0x80, 0x80, 0x08, 0x88, 0x90,
+    0x00, 0x89, 0xf0, 0xcf, 0x08, 0x08, 0x80, 0x08, 0x00, 0x08, 0x18, 0x90, 0x10, 0x81, 0x77, 0x86,
+    0x80, 0x80, 0x00, 0x88, 0x80, 0x80, 0x88, 0x00, 0x8a, 0xf0, 0xcf, 0x80, 0x08, 0x80, 0x08, 0x80,
+    0x80, 0x00, 0x80, 0x20, 0x18, 0x77, 0x86, 0x80, 0x80, 0x00, 0x88, 0x08, 0x08, 0x08, 0x90, 0x19,
+    0xb8, 0x5d, 0x44, 0x00, 0xfa, 0xcf, 0x80, 0x08, 0x80, 0x18, 0x08, 0x08, 0x08, 0x08, 0x01, 0x49,
+    0x77, 0x83, 0x00, 0x88, 0x80, 0x88, 0x00, 0x08, 0x09, 0xa0, 0x18, 0xff, 0x8f, 0x80, 0x08, 0x80,
+    0x00, 0x08, 0x08, 0x80, 0x08, 0x01, 0x69, 0x57, 0x80, 0x00, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08,
+    0x98, 0x18, 0xff, 0x8d, 0x80, 0x08, 0x80, 0x00, 0x08, 0x08, 0x10, 0x09, 0x82, 0x78, 0x57, 0x80,
+    0x80, 0x80, 0x80, 0x08, 0x08, 0x88, 0x09, 0x98, 0x91, 0xff, 0x8d, 0x80, 0x00, 0x88, 0x00, 0x08,
+    0x08, 0x01, 0x08, 0x91, 0x72, 0x57, 0x08, 0x80, 0x08, 0x88, 0x00, 0x80, 0x88, 0x08, 0x98, 0xc1,
+    0xff, 0x8a, 0x80, 0x00, 0x08, 0x08, 0x88, 0x08, 0x01, 0x19, 0x90, 0x77, 0x06, 0x08, 0x80, 0x08,
+    0x80, 0x08, 0x00, 0x98, 0x10, 0x89, 0xf0, 0xcf, 0x08, 0x88, 0x00, 0x08, 0x88, 0x00, 0x09, 0x81,
+    0x19, 0x00, 0x77, 0x06, 0x1d, 0x6e, 0x56, 0x00, 0x88, 0x80, 0x00, 0x08, 0x08, 0x08, 0x88, 0x00,
+    0x08, 0xf9, 0xcf, 0x80, 0x80, 0x80, 0x08, 0x80, 0x80, 0x00, 0x88, 0x00, 0x28, 0x77, 0x86, 0x08,
+    0x80, 0x80, 0x08, 0x08, 0x08, 0x88, 0x80, 0x18, 0xfa, 0xcf, 0x00, 0x08, 0x88, 0x00, 0x80, 0x80,
+    0x00, 0x88, 0x01, 0x5a, 0x77, 0x81, 0x80, 0x80, 0x80, 0x08, 0x88, 0x00, 0x88, 0x90, 0x28, 0xfe,
+    0x8e, 0x80, 0x08, 0x80, 0x80, 0x00, 0x90, 0x00, 0x88, 0x81, 0x78, 0x47, 0x80, 0x00, 0x88, 0x80,
+    0x80, 0x88, 0x81, 0x08, 0x90, 0x80, 0xff, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x08,
+    0x80, 0x70, 0x37, 0x80, 0x08, 0x08, 0x88, 0x08, 0x88, 0x81, 0x08, 0x88, 0x90, 0xff, 0x8f, 0x80,
+    0x80, 0x80, 0x00, 0x08, 0x80, 0x08, 0x08, 0x91, 0x72, 0x47, 0x88, 0x80, 0x80, 0x80, 0x08, 0x09,
+    0x00, 0x09, 0x88, 0xd1, 0xff, 0x09, 0x08, 0x08, 0xd0, 0x9c, 0x50, 0x00, 0x80, 0x80, 0x00, 0x90,
+    0x00, 0x10, 0x98, 0x77, 0x04, 0x08, 0x80, 0x08, 0x08, 0x88, 0x08, 0x80, 0x88, 0x19, 0xf0, 0xff,
+    0x08, 0x80, 0x80, 0x00, 0x08, 0x08, 0x80, 0x80, 0x00, 0x88, 0x77, 0x03, 0x88, 0x80, 0x80, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x18, 0xf8, 0xff, 0x08, 0x88, 0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00,
+    0x09, 0x77, 0x84, 0x08, 0x80, 0x08, 0x88, 0x90, 0x00, 0x88, 0x81, 0x18, 0xfb, 0xdf, 0x80, 0x08,
+    0x80, 0x00, 0x80, 0x00, 0x08, 0x88, 0x00, 0x6a, 0x67, 0x80, 0x00, 0x88, 0x80, 0x08, 0x88, 0x00,
+    0x09, 0x91, 0x18, 0xff, 0x8c, 0x80, 0x08, 0x80, 0x81, 0x00, 0x88, 0x18, 0x88, 0x81, 0x79, 0x77,
+    0x80, 0x08, 0x08, 0x88, 0x80, 0x08, 0x80, 0x08, 0x90, 0x80, 0xff, 0x0b, 0x80, 0x80, 0x80, 0x00,
+    0x18, 0x88, 0x18, 0x08, 0x80, 0x70, 0x77, 0x80, 0x80, 0x08, 0x08, 0x08, 0x56, 0x5b, 0x4d, 0x00,
+    0x88, 0x00, 0x09, 0x80, 0x90, 0xff, 0x0c, 0x80, 0x00, 0x08, 0x80, 0x08, 0x88, 0x01, 0x08, 0x98,
+    0x74, 0x27, 0x08, 0x08, 0x08, 0x88, 0x80, 0x18, 0x90, 0x08, 0x09, 0xf2, 0xef, 0x08, 0x08, 0x08,
+    0x08, 0x80, 0x80, 0x88, 0x01, 0x08, 0x90, 0x77, 0x04, 0x08, 0x08, 0x08, 0x88, 0x80, 0x08, 0x98,
+    0x08, 0x19, 0xf1, 0xef, 0x08, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x88, 0x77, 0x04,
+    0x88, 0x80, 0x80, 0x08, 0x08, 0x18, 0x98, 0x80, 0x29, 0xf9, 0xef, 0x80, 0x08, 0x80, 0x00, 0x08,
+    0x08, 0x08, 0x80, 0x00, 0x29, 0x77, 0x84, 0x80, 0x80, 0x80, 0x88, 0x80, 0x00, 0x88, 0x88, 0x18,
+    0xfc, 0xbf, 0x00, 0x08, 0x08, 0x00, 0x08, 0x80, 0x08, 0x80, 0x01, 0x7a, 0x77, 0x80, 0x08, 0x80,
+    0x80, 0x88, 0x80, 0x00, 0x88, 0x98, 0x10, 0xfe, 0x8d, 0x00, 0x08, 0x08, 0x00, 0x08, 0x88, 0x00,
+    0x12, 0xaf, 0x46, 0x00, 0x08, 0x81, 0x78, 0x57, 0x80, 0x08, 0x08, 0x88, 0x08, 0x08, 0x00, 0x09,
+    0x98, 0x00, 0xff, 0x0d, 0x08, 0x08, 0x08, 0x80, 0x00, 0x88, 0x18, 0x08, 0x91, 0x71, 0x57, 0x88,
+    0x00, 0x88, 0x80, 0x08, 0x08, 0x80, 0x08, 0x98, 0xb2, 0xff, 0x0d, 0x80, 0x80, 0x80, 0x00, 0x08,
+    0x90, 0x00, 0x18, 0xa0, 0x74, 0x27, 0x88, 0x80, 0x80, 0x80, 0x08, 0x08, 0x80, 0x08, 0x89, 0xf2,
+    0xef, 0x08, 0x80, 0x80, 0x80, 0x00, 0x08, 0x88, 0x00, 0x18, 0x88, 0x77, 0x04, 0x88, 0x80, 0x80,
+    0x08, 0x88, 0x18, 0x88, 0x80, 0x09, 0xf0, 0xef, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x80,
+    0x10, 0x09, 0x77, 0x84, 0x80, 0x80, 0x80, 0x08, 0x88, 0x00, 0x88, 0x90, 0x18, 0xfa, 0xef, 0x80,
+    0x80, 0x80, 0x00, 0x80, 0x80, 0x08, 0x80, 0x01, 0x29, 0x77, 0x84, 0x08, 0x80, 0x08, 0x88, 0x80,
+    0x00, 0x09, 0x88, 0x29, 0xf6, 0x51, 0x41, 0x00, 0xfd, 0x9f, 0x80, 0x08, 0x80, 0x00, 0x08, 0x80,
+    0x08, 0x80, 0x01, 0x69, 0x77, 0x80, 0x80, 0x08, 0x80, 0x88, 0x80, 0x80, 0x08, 0x90, 0x00, 0xff,
+    0x8b, 0x80, 0x00, 0x88, 0x00, 0x80, 0x80, 0x10, 0x88, 0x92, 0x78, 0x77, 0x81, 0x08, 0x88, 0x80,
+    0x08, 0x08, 0x80, 0x09, 0x90, 0x00, 0xff, 0x0d, 0x80, 0x80, 0x80, 0x00, 0x08, 0x80, 0x00, 0x08,
+    0x91, 0x71, 0x47, 0x80, 0x08, 0x88, 0x80, 0x88, 0x80, 0x80, 0x08, 0x89, 0xb1, 0xff, 0x0e, 0x08,
+    0x80, 0x80, 0x00, 0x08, 0x08, 0x00, 0x08, 0x90, 0x74, 0x27, 0x88, 0x80, 0x88, 0x88, 0x00, 0x08,
+    0x88, 0x08, 0x88, 0xf1, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x80, 0x08, 0x08, 0x00, 0x18, 0x98, 0x77,
+    0x05, 0x08, 0x88, 0x80, 0x88, 0x00, 0x08, 0x88, 0x80, 0x08, 0xf0, 0xef, 0x00, 0x88, 0x00, 0x08,
+    0x80, 0x80, 0x80, 0x80, 0x10, 0x09, 0x77, 0x84, 0xf5, 0x64, 0x54, 0x00, 0x08, 0x88, 0x00, 0x09,
+    0x80, 0x80, 0x88, 0x80, 0x29, 0xfa, 0xdf, 0x80, 0x80, 0x80, 0x00, 0x80, 0x80, 0x00, 0x88, 0x01,
+    0x39, 0x77, 0x85, 0x08, 0x08, 0x80, 0x88, 0x80, 0x80, 0x08, 0x88, 0x18, 0xfd, 0x9f, 0x00, 0x08,
+    0x08, 0x00, 0x08, 0x08, 0x08, 0x80, 0x81, 0x79, 0x47, 0x80, 0x80, 0x80, 0x80, 0x88, 0x08, 0x08,
+    0x08, 0x98, 0x10, 0xff, 0x0f, 0x08, 0x08, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x91, 0x78, 0x37,
+    0x08, 0x08, 0x88, 0x80, 0x88, 0x08, 0x08, 0x08, 0x99, 0x82, 0xff, 0x8f, 0x80, 0x00, 0x08, 0x08,
+    0x80, 0x80, 0x00, 0x18, 0xa0, 0x71, 0x47, 0x88, 0x80, 0x08, 0x90, 0x80, 0x08, 0x88, 0x00, 0x89,
+    0xb2, 0xff, 0x0d, 0x08, 0x08, 0x80, 0x00, 0x80, 0x80, 0x81, 0x18, 0xa0, 0x75, 0x17, 0x88, 0x80,
+    0x80, 0x88, 0x80, 0x08, 0x88, 0x80, 0x09, 0xf2, 0xcf, 0x08, 0x08, 0x08, 0x7f, 0xa0, 0x4e, 0x00,
+    0x08, 0x81, 0x00, 0x08, 0x80, 0x28, 0x99, 0x77, 0x87, 0x80, 0x80, 0x80, 0x88, 0x80, 0x08, 0x88,
+    0x00, 0x19, 0xf0, 0xbf, 0x00, 0x88, 0x00, 0x00, 0x80, 0x80, 0x00, 0x90, 0x10, 0x1a, 0x77, 0x07,
+    0x08, 0x88, 0x80, 0x88, 0x80, 0x80, 0x08, 0x80, 0x18, 0xf9, 0xcf, 0x00, 0x08, 0x80, 0x00, 0x08,
+    0x80, 0x00, 0x88, 0x81, 0x49, 0x77, 0x82, 0x00, 0x88, 0x08, 0x09, 0x88, 0x80, 0x08, 0x80, 0x28,
+    0xff, 0x8e, 0x80, 0x08, 0x80, 0x00, 0x00, 0x08, 0x08, 0x80, 0x00, 0x79, 0x47, 0x80, 0x80, 0x08,
+    0x08, 0x09, 0x88, 0x80, 0x18, 0x98, 0x10, 0xff, 0x8e, 0x80, 0x00, 0x08, 0x08, 0x00, 0x08, 0x08,
+    0x08, 0x91, 0x70, 0x47, 0x80, 0x80, 0x08, 0x88, 0x08, 0x88, 0x80, 0x08, 0x98, 0x92, 0xff, 0x8e,
+    0x80, 0x00, 0x08, 0x00, 0x08, 0x08, 0x80, 0x18, 0xa0, 0x73, 0x47, 0x08, 0x08, 0x08, 0x88, 0x88,
+    0x8b, 0x50, 0x4a, 0x00, 0x80, 0x80, 0x08, 0x89, 0xd2, 0xff, 0x09, 0x88, 0x00, 0x08, 0x00, 0x08,
+    0x80, 0x90, 0x10, 0x98, 0x77, 0x05, 0x08, 0x80, 0x08, 0x98, 0x80, 0x08, 0x08, 0x00, 0x09, 0xf1,
+    0xdf, 0x08, 0x08, 0x08, 0x08, 0x00, 0x80, 0x08, 0x90, 0x28, 0x88, 0x77, 0x86, 0x08, 0x80, 0x08,
+    0x88, 0x80, 0x08, 0x80, 0x81, 0x09, 0xf8, 0xbf, 0x08, 0x08, 0x80, 0x00, 0x08, 0x80, 0x18, 0x98,
+    0x11, 0x3a, 0x77, 0x07, 0x08, 0x80, 0x80, 0x88, 0x80, 0x08, 0x80, 0x90, 0x18, 0xfb, 0xcf, 0x00,
+    0x08, 0x88, 0x00, 0x00, 0x80, 0x88, 0x80, 0x11, 0x5a, 0x77, 0x81, 0x00, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x80, 0x90, 0x18, 0xff, 0x8d, 0x00, 0x08, 0x88, 0x10, 0x08, 0x08, 0x08, 0x88, 0x01, 0x79,
+    0x57, 0x80, 0x80, 0x08, 0x80, 0x88, 0x08, 0x08, 0x08, 0x98, 0x00, 0xff, 0x8d, 0x80, 0x00, 0x08,
+    0x00, 0x08, 0x08, 0x08, 0x5b, 0xaf, 0x46, 0x00, 0x08, 0x91, 0x71, 0x57, 0x80, 0x08, 0x08, 0x88,
+    0x08, 0x88, 0x80, 0x80, 0x98, 0x91, 0xff, 0x0d, 0x80, 0x08, 0x80, 0x00, 0x08, 0x80, 0x80, 0x18,
+    0xa1, 0x73, 0x57, 0x88, 0x80, 0x80, 0x80, 0x88, 0x00, 0x88, 0x80, 0x89, 0xd2, 0xff, 0x19, 0x88,
+    0x00, 0x08, 0x08, 0x00, 0x88, 0x80, 0x18, 0x91, 0x76, 0x05, 0x08, 0x80, 0x08, 0x08, 0x88, 0x08,
+    0x80, 0x80, 0x09, 0xf0, 0xef, 0x08, 0x80, 0x80, 0x08, 0x00, 0x80, 0x80, 0x80, 0x10, 0x08, 0x77,
+    0x84, 0x08, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x1a, 0xf8, 0xef, 0x00, 0x08, 0x88, 0x00,
+    0x08, 0x00, 0x08, 0x88, 0x10, 0x29, 0x77, 0x84, 0x08, 0x08, 0x08, 0x88, 0x90, 0x00, 0x88, 0x80,
+    0x19, 0xfb, 0xdf, 0x80, 0x08, 0x08, 0x00, 0x08, 0x80, 0x00, 0x80, 0x81, 0x69, 0x77, 0x80, 0x08,
+    0x80, 0x08, 0x88, 0x80, 0x80, 0x88, 0x88, 0x10, 0x0b, 0x4f, 0x43, 0x00, 0xff, 0x8b, 0x80, 0x00,
+    0x08, 0x18, 0x08, 0x00, 0x08, 0x88, 0x91, 0x79, 0x77, 0x91, 0x00, 0x08, 0x88, 0x80, 0x08, 0x80,
+    0x88, 0x90, 0x00, 0xff, 0x0c, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x81, 0x18, 0xa1, 0x70, 0x67,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0x09, 0x98, 0xa1, 0xff, 0x0b, 0x08, 0x08, 0x88, 0x81,
+    0x08, 0x08, 0x01, 0x28, 0xa1, 0x76, 0x27, 0x88, 0x80, 0x80, 0x08, 0x80, 0x88, 0x80, 0x09, 0x89,
+    0xf0, 0xef, 0x08, 0x80, 0x80, 0x80, 0x00, 0x80, 0x00, 0x00, 0x08, 0x80, 0x77, 0x04, 0x09, 0x80,
+    0x80, 0x88, 0x80, 0x10, 0x98, 0x88, 0x09, 0xf0, 0xef, 0x08, 0x80, 0x00, 0x08, 0x88, 0x80, 0x00,
+    0x80, 0x10, 0x88, 0x77, 0x04, 0x09, 0x80, 0x80, 0x88, 0x00, 0x00, 0x89, 0x90, 0x29, 0xf9, 0xef,
+    0x80, 0x08, 0x80, 0x00, 0x80, 0x80, 0x18, 0x80, 0x81, 0x1a, 0x77, 0x84, 0x8a, 0x58, 0x53, 0x00,
+    0x00, 0x98, 0x00, 0x88, 0x00, 0x80, 0x88, 0xa8, 0x28, 0xfd, 0x9f, 0x80, 0x08, 0x81, 0x08, 0x80,
+    0x08, 0x18, 0x00, 0x81, 0x78, 0x47, 0x81, 0x08, 0x88, 0x90, 0x18, 0x80, 0x08, 0x89, 0x98, 0x01,
+    0xff, 0x8f, 0x80, 0x00, 0x08, 0x80, 0x08, 0x08, 0x00, 0x08, 0x81, 0x71, 0x37, 0x88, 0x00, 0x88,
+    0x80, 0x88, 0x00, 0x81, 0xaa, 0x98, 0x91, 0xff, 0x8f, 0x80, 0x00, 0x08, 0x08, 0x08, 0x88, 0x01,
+    0x10, 0x90, 0x73, 0x37, 0x80, 0x88, 0x08, 0x08, 0x08, 0x90, 0x98, 0x98, 0x28, 0xd3, 0xff, 0x0c,
+    0x80, 0x00, 0x88, 0x00, 0x80, 0x08, 0x11, 0x88, 0x80, 0x75, 0x17, 0x88, 0x80, 0x80, 0x88, 0x80,
+    0x80, 0x88, 0x00, 0x19, 0xf2, 0xdf, 0x08, 0x88, 0x00, 0x80, 0x00, 0x80, 0x88, 0x12, 0x89, 0x89,
+    0x77, 0x05, 0x08, 0x88, 0x00, 0x98, 0x08, 0x80, 0x09, 0x92, 0x29, 0xf0, 0xdf, 0x18, 0x88, 0x08,
+    0xfb, 0xa4, 0x4f, 0x00, 0x08, 0x00, 0x08, 0x08, 0x02, 0x89, 0x10, 0x77, 0x84, 0x80, 0x08, 0x00,
+    0x09, 0x80, 0x88, 0x18, 0x00, 0x89, 0xfc, 0xaf, 0x00, 0x99, 0x80, 0x18, 0x80, 0x81, 0x70, 0x37,
+    0x88, 0x88, 0x00, 0x80, 0xfa, 0x8d, 0x00, 0x08, 0x80, 0x08, 0x64, 0x01, 0x00, 0x88, 0x80, 0x98,
+    0xcf, 0x09, 0x08, 0x80, 0x80, 0x51, 0x25, 0x88, 0x80, 0x00, 0x88, 0xf9, 0x8d, 0x80, 0x80, 0x08,
+    0x80, 0x74, 0x01, 0x08, 0x88, 0x80, 0x90, 0xbf, 0x09, 0x80, 0x80, 0x00, 0x50, 0x26, 0x08, 0x80,
+    0x08, 0x09, 0xfa, 0x9b, 0x08, 0x08, 0x08, 0x08, 0x76, 0x01, 0x08, 0x08, 0x08, 0x98, 0xbf, 0x88,
+    0x00, 0x80, 0x08, 0x58, 0x26, 0x80, 0x80, 0x88, 0x08, 0xf8, 0x9c, 0x08, 0x08, 0x00, 0x80, 0x74,
+    0x82, 0x80, 0x80, 0x00, 0xa8, 0xce, 0x09, 0x08, 0x90, 0x00, 0x40, 0x27, 0x00, 0x88, 0x88, 0x08,
+    0xf8, 0x9c, 0x80, 0x18, 0x05, 0x9e, 0x50, 0x00, 0x80, 0x80, 0x73, 0x04, 0x08, 0x08, 0x80, 0x88,
+    0xcf, 0x09, 0x08, 0x80, 0x00, 0x38, 0x47, 0x88, 0x80, 0x08, 0x08, 0xd8, 0x9d, 0x08, 0x08, 0x80,
+    0x00, 0x72, 0x04, 0x00, 0x88, 0x80, 0x89, 0xbf, 0x0a, 0x08, 0x81, 0x00, 0x38, 0x67, 0x80, 0x80,
+    0x08, 0x88, 0xd0, 0x9d, 0x80, 0x80, 0x08, 0x80, 0x72, 0x04, 0x08, 0x08, 0x80, 0x09, 0xdd, 0x89,
+    0x80, 0x80, 0x00, 0x30, 0x47, 0x90, 0x00, 0x08, 0x80, 0xe8, 0x9d, 0x80, 0x08, 0x88, 0x81, 0x72,
+    0x04, 0x08, 0x08, 0x80, 0x88, 0xfc, 0x89, 0x80, 0x80, 0x80, 0x20, 0x37, 0x80, 0x80, 0x00, 0x88,
+    0xd8, 0xae, 0x80, 0x08, 0x80, 0x80, 0x71, 0x05, 0x08, 0x80, 0x80, 0x88, 0xfb, 0x0b, 0x80, 0x80,
+    0x00, 0x28, 0x47, 0x81, 0x08, 0x08, 0x88, 0xd0, 0x9e, 0x08, 0x08, 0x08, 0x80, 0x70, 0x04, 0x80,
+    0x80, 0x08, 0x08, 0xfc, 0x89, 0x08, 0x80, 0x00, 0xdb, 0xa1, 0x4f, 0x00, 0x28, 0x46, 0x00, 0x08,
+    0x08, 0x88, 0xc0, 0xaf, 0x08, 0x08, 0x08, 0x90, 0x71, 0x04, 0x00, 0x88, 0x80, 0x08, 0xfb, 0x8b,
+    0x08, 0x80, 0x10, 0x08, 0x57, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xbf, 0x88, 0x80, 0x80, 0x81, 0x70,
+    0x15, 0x08, 0x80, 0x80, 0x88, 0xfa, 0x8b, 0x88, 0x00, 0x08, 0x00, 0x57, 0x81, 0x80, 0x08, 0x90,
+    0xa0, 0xcf, 0x08, 0x80, 0x80, 0x00, 0x60, 0x14, 0x08, 0x80, 0x80, 0x09, 0xfa, 0x8c, 0x88, 0x00,
+    0x08, 0x00, 0x46, 0x82, 0x80, 0x00, 0x98, 0xb0, 0xdf, 0x08, 0x08, 0x88, 0x00, 0x50, 0x25, 0x08,
+    0x08, 0x08, 0x88, 0xfb, 0x8c, 0x08, 0x08, 0x08, 0x00, 0x65, 0x82, 0x08, 0x08, 0x90, 0xa0, 0xcf,
+    0x08, 0x08, 0x88, 0x00, 0x50, 0x25, 0x08, 0x88, 0x00, 0x88, 0xf9, 0x8d, 0x80, 0x08, 0x08, 0x00,
+    0x64, 0x82, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x48, 0x42, 0xd2, 0x4f, 0x00,
+    0x17, 0x80, 0x80, 0x80, 0x88, 0xe9, 0x8c, 0x08, 0x08, 0x08, 0x81, 0x65, 0x01, 0x08, 0x08, 0x88,
+    0x88, 0xcf, 0x88, 0x80, 0x80, 0x00, 0x30, 0x47, 0x08, 0x88, 0x80, 0x08, 0xe9, 0x9c, 0x00, 0x08,
+    0x08, 0x00, 0x73, 0x04, 0x08, 0x88, 0x90, 0x80, 0xcf, 0x88, 0x80, 0x80, 0x00, 0x38, 0x47, 0x80,
+    0x80, 0x08, 0x88, 0xe8, 0x9c, 0x80, 0x08, 0x08, 0x00, 0x73, 0x04, 0x08, 0x08, 0x88, 0x90, 0xde,
+    0x09, 0x08, 0x80, 0x00, 0x38, 0x37, 0x00, 0x80, 0x08, 0x09, 0xf8, 0x9d, 0x80, 0x08, 0x08, 0x80,
+    0x73, 0x84, 0x00, 0x88, 0x80, 0x90, 0xdd, 0x89, 0x80, 0x80, 0x00, 0x20, 0x47, 0x80, 0x00, 0x08,
+    0x09, 0xe8, 0x9d, 0x80, 0x80, 0x80, 0x00, 0x72, 0x13, 0x08, 0x08, 0x88, 0x88, 0xee, 0x89, 0x80,
+    0x80, 0x00, 0x38, 0x37, 0x00, 0x80, 0x08, 0x88, 0xe8, 0x9e, 0x08, 0x08, 0x08, 0x80, 0x72, 0x04,
+    0xd4, 0x72, 0x55, 0x00, 0x08, 0x88, 0x80, 0x80, 0xdd, 0x0a, 0x08, 0x80, 0x08, 0x20, 0x47, 0x00,
+    0x80, 0x08, 0x88, 0xd0, 0x9e, 0x08, 0x88, 0x80, 0x00, 0x71, 0x04, 0x08, 0x08, 0x80, 0x88, 0xec,
+    0x0a, 0x88, 0x00, 0x08, 0x28, 0x47, 0x81, 0x80, 0x80, 0x08, 0xd8, 0x9e, 0x08, 0x88, 0x80, 0x00,
+    0x71, 0x04, 0x80, 0x80, 0x80, 0x88, 0xec, 0x8a, 0x80, 0x00, 0x08, 0x28, 0x47, 0x81, 0x80, 0x08,
+    0x08, 0xc8, 0xaf, 0x08, 0x08, 0x80, 0x00, 0x61, 0x05, 0x80, 0x80, 0x80, 0x88, 0xfb, 0x8b, 0x80,
+    0x80, 0x00, 0x28, 0x57, 0x00, 0x80, 0x08, 0x88, 0xb0, 0xbf, 0x88, 0x08, 0x80, 0x81, 0x71, 0x15,
+    0x08, 0x08, 0x88, 0x08, 0xec, 0x8a, 0x80, 0x80, 0x00, 0x00, 0x47, 0x81, 0x00, 0x88, 0x90, 0xb0,
+    0xcf, 0x08, 0x08, 0x08, 0x00, 0x60, 0x15, 0x08, 0x88, 0x80, 0x88, 0xfa, 0x0c, 0x88, 0x00, 0x00,
+    0x08, 0x46, 0x81, 0x00, 0x9f, 0x75, 0x51, 0x00, 0x88, 0x90, 0xb0, 0xcf, 0x08, 0x08, 0x08, 0x00,
+    0x68, 0x15, 0x08, 0x08, 0x08, 0x09, 0xfa, 0x9b, 0x80, 0x00, 0x18, 0x08, 0x57, 0x81, 0x00, 0x88,
+    0x88, 0xa0, 0xbf, 0x09, 0x08, 0x80, 0x00, 0x60, 0x16, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x80,
+    0x00, 0x08, 0x80, 0x74, 0x01, 0x08, 0x08, 0x88, 0xa0, 0xbf, 0x08, 0x88, 0x00, 0x80, 0x50, 0x17,
+    0x08, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x75, 0x01, 0x08, 0x08, 0x88, 0x90,
+    0xbf, 0x88, 0x08, 0x80, 0x00, 0x40, 0x37, 0x88, 0x00, 0x08, 0x09, 0xf9, 0x8d, 0x80, 0x08, 0x80,
+    0x00, 0x73, 0x83, 0x08, 0x80, 0x88, 0x90, 0xcf, 0x09, 0x88, 0x00, 0x00, 0x48, 0x27, 0x08, 0x80,
+    0x08, 0x88, 0xf8, 0x8c, 0x08, 0x08, 0x08, 0x80, 0x73, 0x84, 0x00, 0x88, 0x90, 0x80, 0xce, 0x09,
+    0x88, 0x00, 0x08, 0x30, 0x47, 0x80, 0x80, 0x80, 0x01, 0x66, 0x4f, 0x00, 0x08, 0xe9, 0x9d, 0x00,
+    0x08, 0x08, 0x80, 0x73, 0x03, 0x80, 0x80, 0x88, 0x90, 0xdf, 0x09, 0x08, 0x80, 0x00, 0x38, 0x37,
+    0x80, 0x00, 0x08, 0x09, 0xf8, 0x9d, 0x80, 0x08, 0x80, 0x00, 0x72, 0x84, 0x00, 0x88, 0x80, 0x88,
+    0xdd, 0x89, 0x80, 0x80, 0x00, 0x38, 0x47, 0x80, 0x00, 0x08, 0x09, 0xe8, 0x9d, 0x80, 0x00, 0x08,
+    0x80, 0x72, 0x13, 0x08, 0x88, 0x80, 0x88, 0xdf, 0x09, 0x08, 0x08, 0x08, 0x10, 0x47, 0x80, 0x80,
+    0x80, 0x08, 0xd8, 0xad, 0x00, 0x08, 0x08, 0x80, 0x72, 0x04, 0x80, 0x80, 0x80, 0x88, 0xfc, 0x0a,
+    0x08, 0x80, 0x00, 0x18, 0x47, 0x80, 0x80, 0x80, 0x08, 0xc8, 0x9f, 0x08, 0x08, 0x80, 0x00, 0x71,
+    0x03, 0x08, 0x08, 0x88, 0x80, 0xfd, 0x89, 0x80, 0x00, 0x08, 0x10, 0x46, 0x00, 0x08, 0x08, 0x09,
+    0xc8, 0xaf, 0x80, 0x80, 0x00, 0x80, 0x71, 0x04, 0x08, 0x08, 0x88, 0x80, 0xab, 0x5c, 0x4d, 0x00,
+    0xfb, 0x8b, 0x80, 0x80, 0x00, 0x18, 0x67, 0x80, 0x80, 0x80, 0x80, 0xa8, 0xaf, 0x08, 0x08, 0x80,
+    0x00, 0x70, 0x04, 0x80, 0x80, 0x08, 0x88, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x00, 0x57, 0x81, 0x80,
+    0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x71, 0x15, 0x08, 0x88, 0x80, 0x08, 0xfb, 0x8b,
+    0x80, 0x80, 0x00, 0x08, 0x57, 0x81, 0x80, 0x80, 0x08, 0xa8, 0xcf, 0x80, 0x80, 0x80, 0x00, 0x50,
+    0x16, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x80, 0x00, 0x08, 0x47, 0x01, 0x08, 0x08, 0x88,
+    0xb0, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x60, 0x15, 0x08, 0x08, 0x88, 0x08, 0xfa, 0x8c, 0x00, 0x08,
+    0x08, 0x80, 0x65, 0x81, 0x80, 0x80, 0x88, 0x90, 0xbf, 0x88, 0x80, 0x00, 0x80, 0x60, 0x25, 0x88,
+    0x80, 0x80, 0x08, 0xfa, 0x8d, 0x00, 0x08, 0x08, 0x80, 0x64, 0x82, 0x08, 0x08, 0x88, 0xa0, 0xcf,
+    0x01, 0x99, 0x56, 0x00, 0x08, 0x08, 0x80, 0x00, 0x58, 0x25, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x8d,
+    0x80, 0x80, 0x00, 0x80, 0x64, 0x01, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x48,
+    0x17, 0x80, 0x80, 0x80, 0x88, 0xf8, 0x9b, 0x00, 0x08, 0x08, 0x80, 0x75, 0x01, 0x08, 0x08, 0x88,
+    0x90, 0xce, 0x09, 0x80, 0x80, 0x00, 0x48, 0x27, 0x80, 0x08, 0x08, 0x88, 0xf8, 0x8c, 0x08, 0x08,
+    0x08, 0x80, 0x64, 0x02, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x09, 0x08, 0x08, 0x00, 0x38, 0x47, 0x80,
+    0x80, 0x80, 0x08, 0xe9, 0x9d, 0x00, 0x08, 0x08, 0x80, 0x73, 0x03, 0x08, 0x08, 0x90, 0x80, 0xdf,
+    0x09, 0x08, 0x08, 0x08, 0x20, 0x47, 0x80, 0x08, 0x08, 0x88, 0xd8, 0x9d, 0x08, 0x08, 0x08, 0x80,
+    0x73, 0x04, 0x08, 0x08, 0x80, 0x88, 0xde, 0x09, 0x08, 0x80, 0x80, 0x20, 0x37, 0x80, 0x80, 0x80,
+    0x08, 0xf8, 0x9d, 0x00, 0x7d, 0x9f, 0x53, 0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x80, 0x08, 0x90,
+    0x80, 0xee, 0x09, 0x08, 0x08, 0x80, 0x10, 0x47, 0x80, 0x08, 0x08, 0x88, 0xc8, 0xae, 0x00, 0x08,
+    0x80, 0x80, 0x72, 0x04, 0x08, 0x08, 0x88, 0x80, 0xfc, 0x89, 0x80, 0x00, 0x08, 0x28, 0x37, 0x80,
+    0x80, 0x00, 0x09, 0xd8, 0x9f, 0x08, 0x08, 0x80, 0x80, 0x71, 0x13, 0x08, 0x88, 0x80, 0x08, 0xfd,
+    0x0a, 0x80, 0x80, 0x00, 0x18, 0x37, 0x81, 0x80, 0x08, 0x88, 0xd0, 0x9f, 0x08, 0x08, 0x08, 0x80,
+    0x61, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x8a, 0x80, 0x00, 0x08, 0x18, 0x47, 0x00, 0x08, 0x08,
+    0x88, 0xc0, 0x9f, 0x08, 0x08, 0x88, 0x81, 0x70, 0x13, 0x08, 0x80, 0x88, 0x80, 0xfc, 0x0b, 0x08,
+    0x08, 0x18, 0x08, 0x57, 0x00, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x80, 0x08, 0x80, 0x00, 0x70, 0x05,
+    0x80, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0xee, 0xa3, 0x4e, 0x00, 0x08, 0x00, 0x47, 0x81,
+    0x00, 0x08, 0x88, 0xb0, 0xdf, 0x80, 0x08, 0x80, 0x00, 0x68, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfa,
+    0x8c, 0x80, 0x00, 0x08, 0x08, 0x46, 0x82, 0x08, 0x08, 0x88, 0xa0, 0xdf, 0x08, 0x08, 0x80, 0x80,
+    0x50, 0x15, 0x08, 0x80, 0x08, 0x09, 0xf9, 0x8c, 0x80, 0x08, 0x00, 0x08, 0x55, 0x82, 0x08, 0x08,
+    0x88, 0xa0, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x48, 0x17, 0x08, 0x08, 0x88, 0x08, 0xe9, 0x8c, 0x80,
+    0x00, 0x08, 0x80, 0x74, 0x01, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x09, 0x08, 0x80, 0x00, 0x58, 0x27,
+    0x88, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x75, 0x82, 0x08, 0x08, 0x88, 0x90,
+    0xce, 0x09, 0x08, 0x80, 0x00, 0x48, 0x27, 0x80, 0x80, 0x08, 0x08, 0xf9, 0x8c, 0x08, 0x08, 0x08,
+    0x80, 0x74, 0x82, 0x08, 0x08, 0x88, 0x80, 0xbf, 0x09, 0x88, 0x81, 0x80, 0xcd, 0xa4, 0x4b, 0x00,
+    0x30, 0x57, 0x80, 0x80, 0x08, 0x08, 0xf8, 0x9b, 0x80, 0x08, 0x80, 0x00, 0x73, 0x05, 0x08, 0x88,
+    0x80, 0x80, 0xde, 0x88, 0x80, 0x00, 0x08, 0x38, 0x37, 0x80, 0x80, 0x08, 0x09, 0xf8, 0x9c, 0x08,
+    0x08, 0x80, 0x80, 0x73, 0x85, 0x00, 0x88, 0x80, 0x88, 0xec, 0x09, 0x88, 0x00, 0x08, 0x38, 0x47,
+    0x08, 0x80, 0x08, 0x88, 0xd8, 0x9d, 0x08, 0x08, 0x08, 0x80, 0x72, 0x05, 0x08, 0x88, 0x80, 0x80,
+    0xdd, 0x09, 0x88, 0x00, 0x08, 0x10, 0x47, 0x80, 0x80, 0x80, 0x80, 0xd8, 0xad, 0x00, 0x08, 0x08,
+    0x80, 0x72, 0x14, 0x88, 0x80, 0x80, 0x08, 0xde, 0x89, 0x80, 0x00, 0x08, 0x28, 0x47, 0x80, 0x80,
+    0x80, 0x08, 0xc8, 0x9f, 0x08, 0x08, 0x80, 0x80, 0x71, 0x13, 0x08, 0x88, 0x80, 0x08, 0xfd, 0x89,
+    0x80, 0x80, 0x80, 0x10, 0x37, 0x81, 0x08, 0x08, 0x88, 0xd0, 0xaf, 0x00, 0x08, 0x08, 0x80, 0x61,
+    0x37, 0xf9, 0x52, 0x00, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x8a, 0x80, 0x00, 0x08, 0x18, 0x47,
+    0x81, 0x08, 0x08, 0x88, 0xc0, 0xaf, 0x00, 0x08, 0x88, 0x81, 0x70, 0x13, 0x08, 0x08, 0x08, 0x88,
+    0xfc, 0x0b, 0x08, 0x80, 0x08, 0x00, 0x57, 0x00, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x80,
+    0x00, 0x70, 0x05, 0x80, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x00, 0x47, 0x01, 0x08,
+    0x08, 0x88, 0xb0, 0xdf, 0x80, 0x08, 0x80, 0x00, 0x40, 0x16, 0x80, 0x80, 0x08, 0x08, 0xfb, 0x8c,
+    0x80, 0x00, 0x08, 0x00, 0x55, 0x01, 0x80, 0x08, 0x88, 0xa0, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x50,
+    0x15, 0x08, 0x80, 0x08, 0x88, 0xf9, 0x8c, 0x80, 0x08, 0x08, 0x00, 0x55, 0x82, 0x80, 0x08, 0x90,
+    0xa0, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x40, 0x26, 0x08, 0x88, 0x00, 0x09, 0xfa, 0x8c, 0x80, 0x80,
+    0x80, 0x00, 0x74, 0x01, 0x75, 0x64, 0x54, 0x00, 0x08, 0x08, 0x90, 0x90, 0xbf, 0x09, 0x08, 0x80,
+    0x00, 0x68, 0x25, 0x08, 0x80, 0x08, 0x88, 0xf9, 0x8d, 0x80, 0x80, 0x08, 0x00, 0x73, 0x83, 0x80,
+    0x80, 0x90, 0x90, 0xdf, 0x08, 0x88, 0x80, 0x00, 0x30, 0x37, 0x08, 0x88, 0x00, 0x88, 0xf9, 0x9c,
+    0x80, 0x08, 0x80, 0x00, 0x74, 0x82, 0x00, 0x08, 0x88, 0x88, 0xcf, 0x88, 0x80, 0x80, 0x00, 0x38,
+    0x47, 0x08, 0x80, 0x08, 0x88, 0xe8, 0x9c, 0x80, 0x08, 0x08, 0x00, 0x73, 0x04, 0x08, 0x08, 0x90,
+    0x90, 0xde, 0x09, 0x08, 0x80, 0x00, 0x38, 0x37, 0x00, 0x80, 0x08, 0x88, 0xf9, 0x9d, 0x80, 0x80,
+    0x80, 0x81, 0x72, 0x04, 0x08, 0x08, 0x88, 0x90, 0xdd, 0x89, 0x80, 0x80, 0x00, 0x38, 0x47, 0x00,
+    0x08, 0x08, 0x88, 0xe8, 0x9d, 0x80, 0x08, 0x80, 0x00, 0x72, 0x13, 0x08, 0x88, 0x80, 0x88, 0xdf,
+    0x09, 0x08, 0x08, 0x08, 0x20, 0x37, 0x81, 0x80, 0xe7, 0x60, 0x4e, 0x00, 0x08, 0x88, 0xe8, 0x9e,
+    0x08, 0x08, 0x08, 0x80, 0x72, 0x04, 0x08, 0x08, 0x88, 0x80, 0xdd, 0x0a, 0x08, 0x80, 0x18, 0x28,
+    0x47, 0x00, 0x80, 0x08, 0x88, 0xd0, 0x9e, 0x88, 0x00, 0x88, 0x81, 0x71, 0x04, 0x08, 0x08, 0x80,
+    0x88, 0xec, 0x0a, 0x88, 0x80, 0x00, 0x28, 0x47, 0x81, 0x80, 0x08, 0x08, 0xc8, 0xaf, 0x80, 0x08,
+    0x80, 0x80, 0x71, 0x04, 0x08, 0x80, 0x80, 0x08, 0xec, 0x8a, 0x80, 0x80, 0x00, 0x18, 0x47, 0x81,
+    0x80, 0x80, 0x80, 0xd0, 0x9e, 0x88, 0x80, 0x80, 0x80, 0x71, 0x04, 0x08, 0x80, 0x80, 0x80, 0xfb,
+    0x8b, 0x80, 0x80, 0x08, 0x00, 0x57, 0x81, 0x80, 0x00, 0x88, 0xc0, 0xae, 0x08, 0x88, 0x80, 0x00,
+    0x70, 0x14, 0x08, 0x80, 0x80, 0x08, 0xfb, 0x8c, 0x80, 0x08, 0x08, 0x00, 0x56, 0x81, 0x80, 0x08,
+    0x80, 0xb0, 0xbf, 0x88, 0x08, 0x08, 0x80, 0x70, 0x15, 0x08, 0x80, 0x80, 0x4e, 0x5e, 0x4e, 0x00,
+    0x08, 0xfa, 0x0c, 0x88, 0x80, 0x08, 0x00, 0x65, 0x00, 0x80, 0x80, 0x80, 0xa0, 0xbf, 0x08, 0x88,
+    0x80, 0x80, 0x70, 0x14, 0x80, 0x80, 0x00, 0x08, 0xfb, 0x8c, 0x80, 0x08, 0x08, 0x08, 0x56, 0x81,
+    0x00, 0x88, 0x80, 0xa0, 0xcf, 0x08, 0x08, 0x08, 0x08, 0x40, 0x17, 0x08, 0x80, 0x80, 0x08, 0xf9,
+    0x8b, 0x80, 0x08, 0x08, 0x08, 0x75, 0x81, 0x00, 0x08, 0x88, 0x90, 0xbf, 0x08, 0x88, 0x80, 0x00,
+    0x58, 0x17, 0x08, 0x80, 0x00, 0x09, 0xf9, 0x8b, 0x80, 0x08, 0x08, 0x80, 0x75, 0x81, 0x00, 0x08,
+    0x90, 0x90, 0xce, 0x08, 0x09, 0x80, 0x80, 0x40, 0x27, 0x08, 0x08, 0x08, 0x08, 0xf9, 0x8c, 0x80,
+    0x08, 0x08, 0x80, 0x64, 0x82, 0x00, 0x08, 0x90, 0x80, 0xdf, 0x08, 0x88, 0x80, 0x00, 0x38, 0x27,
+    0x80, 0x00, 0x08, 0x08, 0xf9, 0x9c, 0x80, 0x08, 0x08, 0x80, 0x74, 0x82, 0x00, 0x08, 0x88, 0x80,
+    0x0a, 0x55, 0x4b, 0x00, 0xcf, 0x88, 0x80, 0x80, 0x80, 0x30, 0x37, 0x80, 0x80, 0x00, 0x88, 0xf8,
+    0x9d, 0x80, 0x08, 0x80, 0x80, 0x73, 0x03, 0x00, 0x88, 0x80, 0x90, 0xdf, 0x09, 0x08, 0x80, 0x08,
+    0x20, 0x37, 0x00, 0x80, 0x08, 0x88, 0xf8, 0x9d, 0x80, 0x00, 0x88, 0x00, 0x72, 0x03, 0x00, 0x88,
+    0x80, 0x88, 0xdf, 0x09, 0x08, 0x80, 0x08, 0x20, 0x37, 0x00, 0x80, 0x08, 0x88, 0xe8, 0x9e, 0x80,
+    0x08, 0x80, 0x80, 0x72, 0x03, 0x00, 0x88, 0x80, 0x80, 0xee, 0x09, 0x88, 0x80, 0x00, 0x18, 0x47,
+    0x80, 0x80, 0x80, 0x08, 0xc8, 0xae, 0x80, 0x00, 0x88, 0x00, 0x71, 0x04, 0x80, 0x80, 0x80, 0x08,
+    0xed, 0x09, 0x88, 0x80, 0x00, 0x18, 0x37, 0x81, 0x80, 0x00, 0x88, 0xe0, 0x9e, 0x08, 0x08, 0x88,
+    0x81, 0x70, 0x04, 0x08, 0x80, 0x80, 0x08, 0xec, 0x0a, 0x88, 0x80, 0x00, 0x18, 0x47, 0x00, 0x80,
+    0x08, 0x80, 0xb8, 0xcf, 0x66, 0xa4, 0x54, 0x00, 0x80, 0x08, 0x80, 0x80, 0x71, 0x13, 0x08, 0x08,
+    0x80, 0x08, 0xfc, 0x8b, 0x80, 0x80, 0x18, 0x08, 0x57, 0x81, 0x08, 0x08, 0x08, 0xc0, 0xae, 0x08,
+    0x08, 0x08, 0x80, 0x70, 0x14, 0x08, 0x08, 0x08, 0x08, 0xfb, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x37,
+    0x01, 0x08, 0x08, 0x88, 0xb0, 0xef, 0x80, 0x80, 0x80, 0x80, 0x50, 0x14, 0x08, 0x80, 0x80, 0x08,
+    0xfb, 0x8c, 0x80, 0x80, 0x08, 0x00, 0x56, 0x81, 0x80, 0x80, 0x90, 0xb1, 0xcf, 0x08, 0x80, 0x80,
+    0x80, 0x60, 0x14, 0x08, 0x80, 0x80, 0x08, 0xfa, 0x0d, 0x88, 0x00, 0x08, 0x08, 0x64, 0x01, 0x08,
+    0x08, 0x08, 0xa0, 0xcf, 0x08, 0x80, 0x80, 0x80, 0x58, 0x16, 0x88, 0x80, 0x00, 0x08, 0xfa, 0x8b,
+    0x80, 0x80, 0x00, 0x08, 0x75, 0x81, 0x80, 0x80, 0x80, 0xa0, 0xbf, 0x08, 0x08, 0x80, 0x80, 0x50,
+    0x17, 0x08, 0x08, 0x08, 0x08, 0xf9, 0x8b, 0x80, 0x51, 0xb3, 0x4f, 0x00, 0x08, 0x08, 0x80, 0x75,
+    0x81, 0x80, 0x80, 0x80, 0x90, 0xbf, 0x08, 0x08, 0x88, 0x81, 0x58, 0x17, 0x08, 0x80, 0x08, 0x08,
+    0xe9, 0x8c, 0x80, 0x08, 0x08, 0x80, 0x74, 0x82, 0x08, 0x08, 0x80, 0x88, 0xcf, 0x08, 0x08, 0x08,
+    0x08, 0x48, 0x26, 0x08, 0x08, 0x80, 0x08, 0xf9, 0x9c, 0x00, 0x08, 0x08, 0x80, 0x73, 0x84, 0x80,
+    0x80, 0x80, 0x90, 0xde, 0x08, 0x88, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8d,
+    0x08, 0x08, 0x08, 0x80, 0x73, 0x03, 0x08, 0x88, 0x80, 0x90, 0xdf, 0x88, 0x80, 0x80, 0x00, 0x28,
+    0x47, 0x88, 0x00, 0x08, 0x88, 0xd8, 0x9d, 0x80, 0x80, 0x00, 0x88, 0x73, 0x04, 0x08, 0x08, 0x88,
+    0x80, 0xde, 0x09, 0x80, 0x80, 0x00, 0x28, 0x37, 0x80, 0x00, 0x08, 0x09, 0xf8, 0x9d, 0x00, 0x08,
+    0x08, 0x80, 0x72, 0x03, 0x08, 0x80, 0x90, 0x80, 0xdf, 0x09, 0x80, 0x80, 0x66, 0xad, 0x4e, 0x00,
+    0x00, 0x28, 0x37, 0x80, 0x00, 0x88, 0x08, 0xe8, 0x9e, 0x80, 0x80, 0x80, 0x91, 0x72, 0x04, 0x88,
+    0x80, 0x80, 0x08, 0xdd, 0x0a, 0x80, 0x00, 0x08, 0x28, 0x47, 0x80, 0x80, 0x80, 0x08, 0xd0, 0x9e,
+    0x08, 0x08, 0x80, 0x80, 0x71, 0x04, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x09, 0x08, 0x08, 0x00, 0x08,
+    0x37, 0x80, 0x00, 0x88, 0x08, 0xd0, 0x9f, 0x80, 0x08, 0x80, 0x00, 0x70, 0x03, 0x08, 0x80, 0x88,
+    0x00, 0xfd, 0x09, 0x88, 0x00, 0x08, 0x18, 0x37, 0x80, 0x00, 0x88, 0x88, 0xd1, 0xae, 0x80, 0x80,
+    0x80, 0x81, 0x70, 0x14, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x0c, 0x88, 0x00, 0x18, 0x08, 0x47, 0x80,
+    0x80, 0x08, 0x88, 0xb1, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x71, 0x05, 0x08, 0x80, 0x80, 0x08, 0xfb,
+    0x8b, 0x80, 0x00, 0x18, 0x08, 0x57, 0x80, 0x00, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x80, 0x81,
+    0x69, 0xb7, 0x49, 0x00, 0x70, 0x15, 0x09, 0x80, 0x80, 0x08, 0xfa, 0x0c, 0x80, 0x08, 0x08, 0x00,
+    0x55, 0x81, 0x80, 0x80, 0x88, 0xa0, 0xcf, 0x08, 0x08, 0x08, 0x00, 0x68, 0x15, 0x88, 0x80, 0x80,
+    0x08, 0xfa, 0x8b, 0x80, 0x08, 0x18, 0x08, 0x57, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xbf, 0x08, 0x88,
+    0x80, 0x81, 0x60, 0x16, 0x08, 0x08, 0x08, 0x08, 0xfa, 0x8c, 0x81, 0x08, 0x08, 0x80, 0x55, 0x81,
+    0x00, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x58, 0x16, 0x80, 0x80, 0x80, 0x08, 0xf9,
+    0x8c, 0x80, 0x80, 0x00, 0x08, 0x74, 0x81, 0x80, 0x80, 0x80, 0x90, 0xbf, 0x08, 0x88, 0x80, 0x00,
+    0x58, 0x17, 0x08, 0x80, 0x08, 0x08, 0xf9, 0x8b, 0x80, 0x08, 0x00, 0x88, 0x75, 0x81, 0x00, 0x88,
+    0x80, 0x90, 0xce, 0x08, 0x88, 0x80, 0x00, 0x48, 0x27, 0x88, 0x00, 0x88, 0x08, 0xf8, 0x8c, 0x80,
+    0x08, 0x00, 0x88, 0x64, 0xc5, 0x1e, 0x53, 0x00, 0x02, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x09, 0x08,
+    0x80, 0x00, 0x38, 0x47, 0x08, 0x80, 0x08, 0x08, 0xe9, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x03,
+    0x08, 0x80, 0x88, 0x80, 0xdf, 0x09, 0x08, 0x08, 0x00, 0x39, 0x47, 0x08, 0x08, 0x08, 0x09, 0xd8,
+    0x9d, 0x80, 0x08, 0x08, 0x91, 0x73, 0x04, 0x08, 0x80, 0x88, 0x80, 0xde, 0x09, 0x08, 0x08, 0x00,
+    0x28, 0x47, 0x08, 0x80, 0x08, 0x09, 0xd0, 0x9e, 0x80, 0x80, 0x00, 0x80, 0x71, 0x03, 0x08, 0x80,
+    0x90, 0x80, 0xde, 0x0a, 0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x00, 0x08, 0x88, 0xd0, 0x9e, 0x08,
+    0x08, 0x08, 0x80, 0x71, 0x04, 0x08, 0x08, 0x88, 0x80, 0xfc, 0x09, 0x88, 0x00, 0x08, 0x18, 0x37,
+    0x00, 0x80, 0x08, 0x88, 0xd0, 0x9f, 0x80, 0x08, 0x08, 0x80, 0x71, 0x03, 0x08, 0x80, 0x80, 0x08,
+    0xfd, 0x89, 0x80, 0x80, 0x00, 0x18, 0x37, 0x80, 0x60, 0x48, 0x50, 0x00, 0x00, 0x08, 0x88, 0xc0,
+    0xbf, 0x00, 0x88, 0x00, 0x80, 0x70, 0x05, 0x08, 0x80, 0x08, 0x08, 0xfb, 0x0b, 0x80, 0x08, 0x08,
+    0x00, 0x47, 0x81, 0x80, 0x80, 0x08, 0xc0, 0xaf, 0x80, 0x08, 0x80, 0x80, 0x61, 0x05, 0x08, 0x80,
+    0x80, 0x08, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x08, 0x57, 0x81, 0x80, 0x80, 0x08, 0xb0, 0xbf, 0x08,
+    0x88, 0x80, 0x00, 0x70, 0x15, 0x88, 0x80, 0x80, 0x80, 0xfa, 0x8b, 0x80, 0x08, 0x08, 0x00, 0x57,
+    0x81, 0x08, 0x08, 0x08, 0xa8, 0xbf, 0x08, 0x88, 0x80, 0x00, 0x70, 0x15, 0x88, 0x80, 0x00, 0x09,
+    0xf9, 0x8c, 0x80, 0x00, 0x08, 0x08, 0x55, 0x01, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x88, 0x80,
+    0x00, 0x50, 0x16, 0x08, 0x80, 0x08, 0x08, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x74, 0x81, 0x00,
+    0x08, 0x88, 0x90, 0xbf, 0x08, 0x88, 0x80, 0x00, 0x58, 0x17, 0x08, 0x80, 0x19, 0x53, 0x50, 0x00,
+    0x80, 0x08, 0xf9, 0x8b, 0x80, 0x08, 0x08, 0x80, 0x75, 0x81, 0x00, 0x08, 0x88, 0x90, 0xbf, 0x08,
+    0x88, 0x80, 0x00, 0x58, 0x17, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8b, 0x80, 0x08, 0x08, 0x80, 0x74,
+    0x83, 0x08, 0x08, 0x90, 0x90, 0xcf, 0x09, 0x80, 0x80, 0x00, 0x48, 0x27, 0x08, 0x08, 0x08, 0x09,
+    0xf8, 0x8c, 0x80, 0x08, 0x08, 0x80, 0x64, 0x02, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x09, 0x08, 0x80,
+    0x00, 0x38, 0x47, 0x08, 0x80, 0x08, 0x08, 0xe9, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x03, 0x08,
+    0x08, 0x90, 0x80, 0xdf, 0x09, 0x08, 0x80, 0x00, 0x28, 0x37, 0x80, 0x80, 0x00, 0x09, 0xf8, 0x9d,
+    0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x08, 0x80, 0x88, 0xdf, 0x09, 0x80, 0x80, 0x00, 0x28,
+    0x37, 0x80, 0x80, 0x00, 0x88, 0xf8, 0x9d, 0x00, 0x08, 0x88, 0x81, 0x71, 0x04, 0x08, 0x88, 0x80,
+    0xb0, 0x4c, 0x4d, 0x00, 0x80, 0xdd, 0x89, 0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x00, 0x08, 0x88,
+    0xd8, 0x9e, 0x80, 0x80, 0x80, 0x80, 0x72, 0x13, 0x08, 0x88, 0x80, 0x08, 0xee, 0x89, 0x80, 0x80,
+    0x00, 0x18, 0x47, 0x80, 0x80, 0x80, 0x80, 0xc8, 0x9f, 0x80, 0x08, 0x80, 0x80, 0x72, 0x03, 0x08,
+    0x88, 0x81, 0x88, 0xfd, 0x09, 0x88, 0x00, 0x08, 0x18, 0x37, 0x00, 0x08, 0x08, 0x88, 0xd0, 0x9f,
+    0x08, 0x08, 0x80, 0x80, 0x71, 0x03, 0x80, 0x80, 0x80, 0x08, 0xfd, 0x89, 0x80, 0x00, 0x08, 0x18,
+    0x46, 0x00, 0x08, 0x08, 0x88, 0xc0, 0xaf, 0x80, 0x18, 0x88, 0x00, 0x70, 0x04, 0x08, 0x80, 0x08,
+    0x08, 0xec, 0x8a, 0x80, 0x00, 0x08, 0x18, 0x47, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xcf, 0x08, 0x08,
+    0x80, 0x80, 0x61, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x80, 0x18, 0x08, 0x57, 0x81,
+    0x80, 0x08, 0x80, 0xa8, 0x16, 0x36, 0x4a, 0x00, 0xcf, 0x80, 0x00, 0x88, 0x00, 0x68, 0x05, 0x80,
+    0x80, 0x08, 0x08, 0xfa, 0x8b, 0x80, 0x00, 0x08, 0x08, 0x47, 0x01, 0x08, 0x09, 0x80, 0xa0, 0xdf,
+    0x08, 0x08, 0x80, 0x00, 0x58, 0x15, 0x08, 0x88, 0x00, 0x88, 0xf9, 0x8c, 0x80, 0x00, 0x08, 0x08,
+    0x65, 0x81, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x08, 0x08, 0x88, 0x00, 0x50, 0x17, 0x08, 0x90, 0x00,
+    0x08, 0xfa, 0x8b, 0x80, 0x00, 0x08, 0x08, 0x75, 0x01, 0x08, 0x09, 0x80, 0xa0, 0xbf, 0x08, 0x08,
+    0x80, 0x08, 0x50, 0x17, 0x80, 0x90, 0x00, 0x08, 0xf9, 0x8c, 0x00, 0x08, 0x08, 0x80, 0x64, 0x82,
+    0x08, 0x88, 0x80, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x08, 0x30, 0x47, 0x88, 0x80, 0x08, 0x08, 0xf9,
+    0x9b, 0x81, 0x18, 0x88, 0x80, 0x75, 0x82, 0x08, 0x88, 0x80, 0x90, 0xbf, 0x09, 0x80, 0x81, 0x08,
+    0x58, 0x17, 0x80, 0x80, 0x08, 0x08, 0xe9, 0x9c, 0x86, 0x9d, 0x52, 0x00, 0x00, 0x08, 0x80, 0x80,
+    0x74, 0x02, 0x88, 0x08, 0x80, 0x88, 0xcf, 0x88, 0x80, 0x81, 0x08, 0x38, 0x47, 0x08, 0x88, 0x00,
+    0x88, 0xe8, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x73, 0x04, 0x08, 0x88, 0x80, 0x88, 0xde, 0x09, 0x80,
+    0x00, 0x08, 0x38, 0x37, 0x80, 0x80, 0x08, 0x08, 0xf8, 0x9d, 0x80, 0x00, 0x08, 0x80, 0x72, 0x84,
+    0x80, 0x08, 0x80, 0x88, 0xdd, 0x09, 0x88, 0x00, 0x08, 0x28, 0x47, 0x80, 0x80, 0x08, 0x08, 0xd8,
+    0x9e, 0x80, 0x00, 0x08, 0x80, 0x72, 0x03, 0x08, 0x88, 0x80, 0x80, 0xdf, 0x09, 0x80, 0x00, 0x08,
+    0x28, 0x37, 0x80, 0x80, 0x08, 0x08, 0xe8, 0x9e, 0x80, 0x00, 0x08, 0x80, 0x71, 0x13, 0x88, 0x08,
+    0x80, 0x88, 0xde, 0x0a, 0x80, 0x80, 0x00, 0x28, 0x57, 0x80, 0x80, 0x08, 0x88, 0xc0, 0xae, 0x00,
+    0x08, 0x08, 0x80, 0x71, 0x04, 0x08, 0x80, 0x08, 0x88, 0xfc, 0x89, 0x80, 0xec, 0xa7, 0x50, 0x00,
+    0x00, 0x08, 0x18, 0x47, 0x80, 0x80, 0x08, 0x88, 0xc0, 0xae, 0x00, 0x08, 0x08, 0x80, 0x71, 0x04,
+    0x08, 0x80, 0x08, 0x88, 0xfb, 0x0c, 0x80, 0x80, 0x00, 0x18, 0x46, 0x81, 0x08, 0x08, 0x88, 0xc0,
+    0xaf, 0x08, 0x08, 0x80, 0x00, 0x70, 0x14, 0x88, 0x80, 0x08, 0x88, 0xfb, 0x8b, 0x80, 0x00, 0x08,
+    0x00, 0x67, 0x80, 0x80, 0x80, 0x80, 0xa8, 0xaf, 0x08, 0x08, 0x80, 0x00, 0x70, 0x04, 0x08, 0x80,
+    0x08, 0x08, 0xfb, 0x0c, 0x08, 0x08, 0x08, 0x00, 0x46, 0x81, 0x00, 0x09, 0x80, 0xa8, 0xdf, 0x80,
+    0x08, 0x80, 0x00, 0x50, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x46,
+    0x01, 0x08, 0x88, 0x80, 0xa0, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x50, 0x15, 0x08, 0x90, 0x00, 0x88,
+    0xf9, 0x8c, 0x80, 0x80, 0x80, 0x00, 0x65, 0x81, 0x80, 0x08, 0x90, 0x90, 0xbf, 0x09, 0x80, 0x80,
+    0xe9, 0xac, 0x4b, 0x00, 0x00, 0x50, 0x17, 0x80, 0x80, 0x08, 0x08, 0xfa, 0x8b, 0x80, 0x08, 0x80,
+    0x00, 0x75, 0x01, 0x08, 0x88, 0x80, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x48, 0x17, 0x08, 0x80,
+    0x08, 0x88, 0xe9, 0x8c, 0x80, 0x00, 0x88, 0x00, 0x74, 0x82, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x09,
+    0x08, 0x80, 0x00, 0x58, 0x27, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x75,
+    0x82, 0x08, 0x08, 0x88, 0x90, 0xce, 0x09, 0x08, 0x80, 0x00, 0x48, 0x27, 0x80, 0x80, 0x08, 0x88,
+    0xf8, 0x9c, 0x00, 0x08, 0x08, 0x80, 0x74, 0x82, 0x80, 0x08, 0x88, 0x80, 0xbf, 0x09, 0x88, 0x00,
+    0x08, 0x30, 0x67, 0x08, 0x08, 0x08, 0x88, 0xd8, 0x9c, 0x80, 0x18, 0x08, 0x80, 0x73, 0x04, 0x08,
+    0x08, 0x88, 0x80, 0xcf, 0x09, 0x08, 0x80, 0x00, 0x28, 0x47, 0x80, 0x80, 0x08, 0x08, 0xe8, 0xac,
+    0x00, 0x08, 0x08, 0x80, 0x84, 0xb1, 0x49, 0x00, 0x73, 0x05, 0x08, 0x88, 0x80, 0x88, 0xec, 0x89,
+    0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x00, 0x88, 0x08, 0xd8, 0x9e, 0x80, 0x80, 0x00, 0x08, 0x71,
+    0x13, 0x08, 0x88, 0x80, 0x88, 0xde, 0x0a, 0x88, 0x00, 0x00, 0x28, 0x57, 0x80, 0x80, 0x80, 0x08,
+    0xc8, 0x9f, 0x80, 0x08, 0x80, 0x00, 0x71, 0x03, 0x08, 0x88, 0x80, 0x08, 0xed, 0x0a, 0x08, 0x08,
+    0x00, 0x18, 0x47, 0x00, 0x80, 0x88, 0x80, 0xc8, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x71, 0x13, 0x08,
+    0x88, 0x80, 0x08, 0xfd, 0x0a, 0x80, 0x80, 0x00, 0x18, 0x37, 0x81, 0x80, 0x08, 0x88, 0xd0, 0xaf,
+    0x00, 0x08, 0x08, 0x80, 0x61, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x8a, 0x80, 0x00, 0x08, 0x18,
+    0x47, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x60, 0x14, 0x08, 0x80, 0x08,
+    0x08, 0xfc, 0x8a, 0x80, 0x80, 0x00, 0x08, 0x47, 0x5f, 0x3c, 0x53, 0x00, 0x81, 0x80, 0x08, 0x88,
+    0xa0, 0xcf, 0x08, 0x08, 0x08, 0x80, 0x60, 0x05, 0x00, 0x88, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x08,
+    0x18, 0x08, 0x47, 0x82, 0x08, 0x08, 0x88, 0xa0, 0xdf, 0x08, 0x08, 0x08, 0x80, 0x50, 0x15, 0x08,
+    0x80, 0x08, 0x08, 0xfa, 0x8c, 0x80, 0x08, 0x08, 0x00, 0x65, 0x81, 0x80, 0x80, 0x80, 0xa0, 0xcf,
+    0x08, 0x08, 0x80, 0x00, 0x58, 0x15, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x80, 0x08, 0x00, 0x08,
+    0x55, 0x82, 0x80, 0x08, 0x88, 0xa1, 0xdf, 0x08, 0x88, 0x00, 0x08, 0x58, 0x15, 0x80, 0x80, 0x80,
+    0x08, 0xf9, 0x8c, 0x08, 0x08, 0x08, 0x80, 0x65, 0x01, 0x08, 0x88, 0x80, 0x90, 0xcf, 0x08, 0x08,
+    0x80, 0x80, 0x30, 0x37, 0x08, 0x08, 0x08, 0x09, 0xf9, 0x8d, 0x80, 0x08, 0x80, 0x80, 0x64, 0x82,
+    0x00, 0x88, 0x80, 0x90, 0xcf, 0x09, 0x08, 0x80, 0x00, 0x48, 0x27, 0x08, 0x73, 0x5b, 0x51, 0x00,
+    0x88, 0x80, 0x08, 0xf8, 0x8c, 0x80, 0x08, 0x80, 0x00, 0x73, 0x83, 0x00, 0x88, 0x90, 0x90, 0xdf,
+    0x88, 0x80, 0x00, 0x08, 0x38, 0x37, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8d, 0x08, 0x08, 0x08, 0x80,
+    0x73, 0x03, 0x08, 0x88, 0x80, 0x90, 0xdf, 0x09, 0x80, 0x00, 0x08, 0x38, 0x37, 0x80, 0x80, 0x08,
+    0x08, 0xf9, 0x9d, 0x00, 0x08, 0x80, 0x80, 0x73, 0x03, 0x08, 0x88, 0x80, 0x90, 0xdf, 0x09, 0x80,
+    0x00, 0x08, 0x28, 0x47, 0x08, 0x08, 0x08, 0x88, 0xd8, 0x9d, 0x80, 0x00, 0x08, 0x88, 0x73, 0x04,
+    0x08, 0x88, 0x80, 0x80, 0xce, 0x0a, 0x08, 0x00, 0x08, 0x28, 0x57, 0x80, 0x80, 0x08, 0x08, 0xc8,
+    0x9f, 0x80, 0x00, 0x08, 0x80, 0x71, 0x03, 0x08, 0x88, 0x80, 0x08, 0xde, 0x0a, 0x80, 0x00, 0x08,
+    0x28, 0x47, 0x00, 0x88, 0x08, 0x08, 0xd0, 0x9e, 0x08, 0x08, 0x80, 0x80, 0x71, 0x04, 0x08, 0x88,
+    0xdf, 0x48, 0x4f, 0x00, 0x80, 0x80, 0xec, 0x0a, 0x08, 0x80, 0x00, 0x18, 0x47, 0x00, 0x08, 0x88,
+    0x80, 0xc0, 0xaf, 0x80, 0x00, 0x08, 0x08, 0x70, 0x04, 0x08, 0x08, 0x88, 0x00, 0xec, 0x8a, 0x80,
+    0x00, 0x08, 0x18, 0x47, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x70, 0x04,
+    0x08, 0x80, 0x08, 0x08, 0xfb, 0x0c, 0x08, 0x80, 0x00, 0x08, 0x46, 0x81, 0x80, 0x08, 0x88, 0xb0,
+    0xcf, 0x08, 0x08, 0x80, 0x80, 0x61, 0x15, 0x88, 0x80, 0x08, 0x08, 0xfb, 0x8b, 0x08, 0x80, 0x00,
+    0x08, 0x57, 0x81, 0x80, 0x08, 0x08, 0xa8, 0xbf, 0x88, 0x08, 0x00, 0x80, 0x70, 0x15, 0x08, 0x88,
+    0x80, 0x08, 0xfa, 0x8b, 0x88, 0x00, 0x00, 0x08, 0x57, 0x81, 0x80, 0x08, 0x08, 0xa8, 0xbf, 0x88,
+    0x08, 0x00, 0x80, 0x70, 0x15, 0x08, 0x88, 0x80, 0x80, 0xfa, 0x8b, 0x88, 0x00, 0x00, 0x08, 0x66,
+    0x01, 0x08, 0x88, 0x80, 0x35, 0x4f, 0x4c, 0x00, 0x98, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x58, 0x25,
+    0x88, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x08, 0x08, 0x80, 0x00, 0x74, 0x82, 0x80, 0x08, 0x88, 0x90,
+    0xcf, 0x08, 0x08, 0x80, 0x08, 0x40, 0x17, 0x80, 0x80, 0x08, 0x88, 0xe9, 0x8c, 0x08, 0x08, 0x80,
+    0x00, 0x74, 0x82, 0x80, 0x08, 0x80, 0x98, 0xcf, 0x08, 0x08, 0x08, 0x08, 0x40, 0x26, 0x80, 0x80,
+    0x08, 0x88, 0xf9, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x74, 0x02, 0x08, 0x88, 0x80, 0x98, 0xbf, 0x89,
+    0x80, 0x00, 0x08, 0x40, 0x47, 0x08, 0x88, 0x80, 0x08, 0xf8, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x74,
+    0x83, 0x80, 0x08, 0x88, 0x90, 0xcf, 0x09, 0x08, 0x80, 0x00, 0x38, 0x47, 0x80, 0x80, 0x08, 0x08,
+    0xe9, 0x9d, 0x00, 0x08, 0x08, 0x80, 0x73, 0x03, 0x80, 0x80, 0x88, 0x80, 0xdf, 0x09, 0x08, 0x08,
+    0x18, 0x28, 0x47, 0x08, 0x80, 0x08, 0x88, 0xd8, 0xfa, 0x15, 0x4f, 0x00, 0x9d, 0x08, 0x08, 0x08,
+    0x80, 0x73, 0x04, 0x08, 0x08, 0x90, 0x80, 0xde, 0x09, 0x08, 0x80, 0x00, 0x28, 0x37, 0x81, 0x80,
+    0x08, 0x88, 0xe8, 0x9e, 0x08, 0x08, 0x08, 0x80, 0x72, 0x04, 0x08, 0x88, 0x80, 0x80, 0xdd, 0x0a,
+    0x08, 0x80, 0x00, 0x28, 0x47, 0x00, 0x80, 0x08, 0x88, 0xe0, 0x9d, 0x08, 0x08, 0x80, 0x80, 0x72,
+    0x04, 0x08, 0x08, 0x88, 0x80, 0xfc, 0x89, 0x80, 0x80, 0x00, 0x18, 0x37, 0x81, 0x80, 0x08, 0x88,
+    0xd0, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x71, 0x03, 0x00, 0x88, 0x80, 0x08, 0xfd, 0x89, 0x08, 0x80,
+    0x00, 0x18, 0x46, 0x81, 0x80, 0x08, 0x88, 0xc0, 0xaf, 0x08, 0x08, 0x80, 0x00, 0x70, 0x04, 0x00,
+    0x88, 0x80, 0x88, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x00, 0x57, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xbf,
+    0x88, 0x00, 0x08, 0x80, 0x71, 0x15, 0x08, 0x88, 0x80, 0x08, 0xfb, 0x8b, 0xa3, 0xa8, 0x50, 0x00,
+    0x08, 0x80, 0x00, 0x18, 0x57, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xbf, 0x88, 0x00, 0x08, 0x80, 0x71,
+    0x15, 0x08, 0x88, 0x80, 0x08, 0xfa, 0x0c, 0x88, 0x00, 0x08, 0x80, 0x46, 0x81, 0x00, 0x08, 0x88,
+    0xa0, 0xcf, 0x08, 0x08, 0x08, 0x80, 0x50, 0x16, 0x08, 0x88, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x80,
+    0x00, 0x08, 0x47, 0x82, 0x80, 0x08, 0x88, 0xb0, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x58, 0x15, 0x80,
+    0x80, 0x08, 0x08, 0xfa, 0x8c, 0x80, 0x08, 0x00, 0x08, 0x55, 0x82, 0x80, 0x08, 0x88, 0xa0, 0xdf,
+    0x08, 0x08, 0x80, 0x80, 0x40, 0x26, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x8c, 0x08, 0x08, 0x80, 0x80,
+    0x65, 0x81, 0x00, 0x88, 0x80, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x80, 0x40, 0x26, 0x88, 0x80, 0x80,
+    0x08, 0xf9, 0x8c, 0x80, 0x08, 0x80, 0x80, 0x74, 0x82, 0x08, 0x08, 0x88, 0x80, 0xbf, 0x09, 0x08,
+    0xf3, 0xb3, 0x4d, 0x00, 0x80, 0x80, 0x58, 0x27, 0x08, 0x88, 0x80, 0x08, 0xf8, 0x9b, 0x80, 0x08,
+    0x00, 0x88, 0x75, 0x82, 0x80, 0x08, 0x88, 0x80, 0xbf, 0x09, 0x08, 0x08, 0x80, 0x48, 0x37, 0x80,
+    0x80, 0x08, 0x08, 0xf9, 0x8d, 0x08, 0x08, 0x80, 0x80, 0x73, 0x03, 0x08, 0x88, 0x80, 0x88, 0xdf,
+    0x88, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x08, 0x88, 0xf8, 0x9c, 0x08, 0x08, 0x08, 0x80,
+    0x73, 0x05, 0x08, 0x88, 0x80, 0x08, 0xce, 0x09, 0x08, 0x80, 0x00, 0x28, 0x47, 0x80, 0x80, 0x08,
+    0x88, 0xe0, 0x9c, 0x08, 0x08, 0x08, 0x80, 0x72, 0x05, 0x08, 0x88, 0x80, 0x08, 0xdd, 0x09, 0x08,
+    0x08, 0x18, 0x18, 0x47, 0x80, 0x80, 0x80, 0x08, 0xc8, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x72, 0x03,
+    0x08, 0x08, 0x90, 0x80, 0xfd, 0x09, 0x88, 0x80, 0x00, 0x18, 0x37, 0x81, 0x08, 0x08, 0x88, 0xd0,
+    0x9f, 0x08, 0x08, 0x08, 0x6c, 0xb3, 0x4d, 0x00, 0x80, 0x71, 0x13, 0x88, 0x80, 0x80, 0x08, 0xfd,
+    0x89, 0x80, 0x80, 0x00, 0x18, 0x46, 0x81, 0x08, 0x08, 0x88, 0xc0, 0xaf, 0x80, 0x08, 0x80, 0x80,
+    0x71, 0x04, 0x80, 0x80, 0x80, 0x08, 0xec, 0x8a, 0x80, 0x80, 0x00, 0x18, 0x47, 0x81, 0x80, 0x08,
+    0x08, 0xb8, 0xcf, 0x08, 0x08, 0x08, 0x80, 0x61, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80,
+    0x80, 0x18, 0x08, 0x57, 0x81, 0x80, 0x80, 0x08, 0xa8, 0xcf, 0x80, 0x80, 0x80, 0x00, 0x50, 0x15,
+    0x80, 0x80, 0x08, 0x08, 0xfb, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x56, 0x81, 0x08, 0x08, 0x88, 0xa0,
+    0xbf, 0x88, 0x08, 0x80, 0x81, 0x70, 0x15, 0x08, 0x88, 0x80, 0x08, 0xfa, 0x8b, 0x08, 0x08, 0x18,
+    0x08, 0x66, 0x81, 0x00, 0x88, 0x80, 0xa0, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x58, 0x15, 0x80, 0x80,
+    0x80, 0x08, 0xfa, 0x8c, 0x80, 0x08, 0x00, 0x08, 0xf2, 0xbd, 0x49, 0x00, 0x74, 0x01, 0x08, 0x08,
+    0x88, 0x90, 0xbf, 0x09, 0x08, 0x80, 0x00, 0x68, 0x16, 0x80, 0x80, 0x08, 0x08, 0xfa, 0x9b, 0x80,
+    0x00, 0x08, 0x80, 0x66, 0x01, 0x08, 0x88, 0x80, 0x90, 0xbf, 0x09, 0x08, 0x80, 0x80, 0x50, 0x17,
+    0x80, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x75, 0x82, 0x08, 0x08, 0x88, 0x80,
+    0xcf, 0x08, 0x08, 0x08, 0x80, 0x48, 0x26, 0x80, 0x80, 0x08, 0x08, 0xf9, 0x9c, 0x80, 0x00, 0x08,
+    0x80, 0x73, 0x84, 0x00, 0x88, 0x80, 0x90, 0xbf, 0x09, 0x88, 0x00, 0x08, 0x48, 0x37, 0x80, 0x80,
+    0x08, 0x08, 0xf8, 0x9d, 0x80, 0x00, 0x08, 0x80, 0x73, 0x03, 0x08, 0x88, 0x80, 0x88, 0xdf, 0x88,
+    0x80, 0x80, 0x00, 0x28, 0x37, 0x00, 0x88, 0x80, 0x08, 0xf8, 0x9d, 0x00, 0x08, 0x08, 0x80, 0x72,
+    0x03, 0x80, 0x08, 0x88, 0x80, 0xcf, 0x0a, 0x80, 0x00, 0x08, 0x38, 0x57, 0x41, 0x4c, 0x53, 0x00,
+    0x80, 0x08, 0x08, 0x88, 0xd0, 0x9d, 0x08, 0x08, 0x80, 0x80, 0x72, 0x04, 0x08, 0x08, 0x88, 0x80,
+    0xed, 0x09, 0x08, 0x80, 0x80, 0x10, 0x37, 0x81, 0x08, 0x08, 0x88, 0xf0, 0xac, 0x80, 0x00, 0x08,
+    0x08, 0x71, 0x05, 0x08, 0x08, 0x08, 0x88, 0xec, 0x89, 0x80, 0x80, 0x00, 0x18, 0x47, 0x00, 0x08,
+    0x88, 0x80, 0xd0, 0x9e, 0x80, 0x08, 0x80, 0x80, 0x72, 0x03, 0x80, 0x80, 0x08, 0x08, 0xde, 0x8a,
+    0x80, 0x00, 0x08, 0x28, 0x57, 0x80, 0x80, 0x80, 0x08, 0xb8, 0xbf, 0x00, 0x08, 0x08, 0x80, 0x71,
+    0x05, 0x08, 0x08, 0x88, 0x00, 0xec, 0x0a, 0x08, 0x80, 0x08, 0x00, 0x47, 0x81, 0x08, 0x08, 0x88,
+    0xc0, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x70, 0x13, 0x08, 0x88, 0x80, 0x80, 0xfc, 0x0b, 0x80, 0x80,
+    0x80, 0x00, 0x57, 0x00, 0x08, 0x88, 0x80, 0xb0, 0xbf, 0x08, 0x80, 0x80, 0x81, 0x70, 0x05, 0x08,
+    0x0f, 0x46, 0x50, 0x00, 0x80, 0x08, 0x08, 0xfb, 0x0b, 0x08, 0x08, 0x18, 0x08, 0x47, 0x81, 0x80,
+    0x80, 0x80, 0xb0, 0xdf, 0x80, 0x80, 0x80, 0x00, 0x50, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x8c,
+    0x80, 0x00, 0x08, 0x80, 0x46, 0x01, 0x08, 0x88, 0x80, 0xb0, 0xcf, 0x08, 0x08, 0x08, 0x80, 0x60,
+    0x15, 0x08, 0x88, 0x80, 0x08, 0xfa, 0x8c, 0x00, 0x08, 0x08, 0x80, 0x46, 0x01, 0x08, 0x88, 0x80,
+    0xa0, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x58, 0x15, 0x08, 0x88, 0x80, 0x18, 0xfa, 0x8c, 0x80, 0x00,
+    0x08, 0x08, 0x55, 0x82, 0x08, 0x08, 0x88, 0xa0, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x58, 0x15, 0x08,
+    0x80, 0x88, 0x08, 0xf9, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x74, 0x01, 0x08, 0x88, 0x90, 0x80, 0xbf,
+    0x09, 0x08, 0x00, 0x80, 0x50, 0x17, 0x80, 0x80, 0x88, 0x08, 0xf9, 0x8b, 0x08, 0x80, 0x00, 0x80,
+    0x75, 0x01, 0x08, 0x88, 0x9d, 0x41, 0x4d, 0x00, 0x90, 0x80, 0xbf, 0x09, 0x08, 0x00, 0x00, 0x48,
+    0x37, 0x88, 0x80, 0x08, 0x09, 0xf8, 0x8d, 0x80, 0x00, 0x08, 0x80, 0x73, 0x83, 0x08, 0x88, 0x90,
+    0x80, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x28, 0x37, 0x80, 0x88, 0x80, 0x88, 0xf8, 0x9c, 0x80, 0x00,
+    0x80, 0x91, 0x74, 0x02, 0x88, 0x08, 0x88, 0x80, 0xcf, 0x09, 0x00, 0x80, 0x00, 0x28, 0x47, 0x08,
+    0x88, 0x08, 0x88, 0xe0, 0x9c, 0x80, 0x00, 0x80, 0x80, 0x73, 0x04, 0x08, 0x88, 0x90, 0x80, 0xde,
+    0x09, 0x80, 0x81, 0x00, 0x28, 0x37, 0x80, 0x80, 0x08, 0x09, 0xf8, 0x9d, 0x00, 0x08, 0x80, 0x81,
+    0x71, 0x04, 0x88, 0x08, 0x88, 0x80, 0xdd, 0x89, 0x00, 0x80, 0x00, 0x28, 0x47, 0x80, 0x80, 0x08,
+    0x88, 0xe0, 0x9d, 0x00, 0x08, 0x80, 0x00, 0x71, 0x04, 0x88, 0x88, 0x80, 0x80, 0xfc, 0x09, 0x08,
+    0x00, 0x08, 0x18, 0x37, 0x80, 0x80, 0x88, 0x08, 0xd8, 0x3a, 0x48, 0x00, 0xd8, 0x9f, 0x80, 0x00,
+    0x80, 0x80, 0x71, 0x03, 0x08, 0x88, 0x80, 0x08, 0xde, 0x0a, 0x00, 0x80, 0x00, 0x18, 0x47, 0x80,
+    0x80, 0x08, 0x88, 0xc0, 0xaf, 0x00, 0x08, 0x80, 0x81, 0x70, 0x04, 0x08, 0x88, 0x08, 0x08, 0xfc,
+    0x89, 0x00, 0x80, 0x00, 0x18, 0x46, 0x80, 0x80, 0x08, 0x88, 0xc0, 0xaf, 0x00, 0x08, 0x80, 0x80,
+    0x71, 0x04, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x00, 0x80, 0x00, 0x08, 0x57, 0x81, 0x88, 0x80,
+    0x80, 0xb0, 0xbf, 0x08, 0x00, 0x88, 0x81, 0x70, 0x15, 0x88, 0x88, 0x00, 0x08, 0xfb, 0x8b, 0x00,
+    0x08, 0x18, 0x08, 0x57, 0x81, 0x88, 0x08, 0x80, 0xb0, 0xbf, 0x08, 0x18, 0x88, 0x00, 0x70, 0x15,
+    0x88, 0x08, 0x08, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0x18, 0x88, 0x57, 0x81, 0x08, 0x08, 0x88, 0xa0,
+    0xbf, 0x08, 0x08, 0x80, 0x80, 0x70, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x2d, 0xf8, 0x50, 0x00,
+    0x0c, 0x08, 0x80, 0x00, 0x88, 0x65, 0x81, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x08, 0x08, 0x80, 0x00,
+    0x58, 0x17, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x8b, 0x00, 0x08, 0x08, 0x80, 0x75, 0x81, 0x80, 0x80,
+    0x80, 0x90, 0xbf, 0x08, 0x08, 0x88, 0x81, 0x58, 0x17, 0x08, 0x08, 0x08, 0x08, 0xf9, 0x8b, 0x80,
+    0x80, 0x00, 0x88, 0x75, 0x81, 0x80, 0x80, 0x80, 0x90, 0xce, 0x88, 0x00, 0x88, 0x00, 0x48, 0x27,
+    0x08, 0x88, 0x00, 0x09, 0xf8, 0x8c, 0x80, 0x80, 0x00, 0x88, 0x64, 0x02, 0x88, 0x80, 0x80, 0x90,
+    0xcf, 0x09, 0x80, 0x80, 0x00, 0x38, 0x47, 0x08, 0x80, 0x08, 0x88, 0xe8, 0x8d, 0x08, 0x08, 0x08,
+    0x80, 0x73, 0x03, 0x08, 0x08, 0x88, 0x80, 0xdf, 0x09, 0x08, 0x80, 0x00, 0x39, 0x37, 0x80, 0x80,
+    0x00, 0x09, 0xf8, 0x9d, 0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x80, 0x80, 0x88, 0xdf, 0x09,
+    0xb9, 0xba, 0x50, 0x00, 0x08, 0x80, 0x08, 0x38, 0x37, 0x80, 0x80, 0x80, 0x08, 0xf8, 0xac, 0x00,
+    0x08, 0x08, 0x80, 0x72, 0x05, 0x08, 0x88, 0x80, 0x80, 0xdd, 0x09, 0x08, 0x80, 0x08, 0x38, 0x47,
+    0x80, 0x80, 0x08, 0x08, 0xd8, 0x9e, 0x80, 0x00, 0x88, 0x80, 0x72, 0x03, 0x80, 0x80, 0x80, 0x08,
+    0xcf, 0x0a, 0x08, 0x80, 0x00, 0x28, 0x47, 0x00, 0x08, 0x08, 0x88, 0xd0, 0xae, 0x00, 0x08, 0x88,
+    0x81, 0x71, 0x04, 0x08, 0x80, 0x80, 0x08, 0xed, 0x09, 0x88, 0x00, 0x08, 0x18, 0x37, 0x81, 0x80,
+    0x08, 0x08, 0xd8, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x71, 0x13, 0x88, 0x80, 0x80, 0x08, 0xfd, 0x89,
+    0x80, 0x80, 0x08, 0x10, 0x46, 0x81, 0x80, 0x08, 0x08, 0xc8, 0xaf, 0x80, 0x08, 0x08, 0x80, 0x71,
+    0x04, 0x80, 0x80, 0x80, 0x80, 0xfb, 0x0c, 0x88, 0x00, 0x08, 0x18, 0x46, 0x81, 0x00, 0x08, 0x88,
+    0xc0, 0xaf, 0x08, 0x08, 0x04, 0xc2, 0x4c, 0x00, 0x88, 0x00, 0x70, 0x14, 0x08, 0x08, 0x08, 0x88,
+    0xfb, 0x0c, 0x88, 0x00, 0x08, 0x18, 0x46, 0x81, 0x00, 0x08, 0x88, 0xb0, 0xdf, 0x80, 0x08, 0x08,
+    0x80, 0x60, 0x14, 0x08, 0x08, 0x08, 0x08, 0xfb, 0x8c, 0x80, 0x80, 0x08, 0x00, 0x46, 0x82, 0x08,
+    0x08, 0x80, 0xb8, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x50, 0x15, 0x80, 0x80, 0x00, 0x09, 0xfa, 0x8c,
+    0x80, 0x08, 0x08, 0x00, 0x65, 0x81, 0x00, 0x88, 0x80, 0xa0, 0xcf, 0x08, 0x08, 0x80, 0x80, 0x50,
+    0x15, 0x80, 0x80, 0x00, 0x09, 0xfa, 0x8c, 0x80, 0x08, 0x08, 0x80, 0x46, 0x82, 0x00, 0x88, 0x80,
+    0xa0, 0xdf, 0x88, 0x80, 0x80, 0x00, 0x58, 0x25, 0x08, 0x88, 0x00, 0x09, 0xf9, 0x9c, 0x80, 0x00,
+    0x08, 0x80, 0x65, 0x01, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08, 0x08, 0x08, 0x30, 0x37, 0x80,
+    0x80, 0x08, 0x88, 0xf9, 0x8d, 0x08, 0x08, 0x08, 0x79, 0xbb, 0x4b, 0x00, 0x80, 0x74, 0x01, 0x08,
+    0x08, 0x88, 0x90, 0xce, 0x09, 0x80, 0x80, 0x00, 0x48, 0x27, 0x08, 0x80, 0x08, 0x88, 0xf8, 0x8c,
+    0x80, 0x08, 0x08, 0x80, 0x64, 0x02, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x09, 0x08, 0x80, 0x80, 0x30,
+    0x47, 0x80, 0x80, 0x08, 0x08, 0xe9, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x03, 0x08, 0x08, 0x88,
+    0x80, 0xdf, 0x09, 0x08, 0x80, 0x08, 0x20, 0x37, 0x00, 0x88, 0x00, 0x88, 0xf8, 0x9d, 0x80, 0x00,
+    0x88, 0x00, 0x72, 0x03, 0x80, 0x80, 0x80, 0x88, 0xdf, 0x09, 0x08, 0x80, 0x08, 0x20, 0x37, 0x81,
+    0x08, 0x08, 0x88, 0xe8, 0x9e, 0x80, 0x08, 0x80, 0x80, 0x72, 0x04, 0x08, 0x88, 0x80, 0x80, 0xdd,
+    0x0a, 0x80, 0x80, 0x18, 0x28, 0x47, 0x00, 0x08, 0x08, 0x88, 0xd8, 0x9e, 0x80, 0x08, 0x80, 0x80,
+    0x72, 0x13, 0x08, 0x88, 0x00, 0x88, 0xee, 0x89, 0x80, 0x80, 0x00, 0x18, 0x02, 0xc9, 0x48, 0x00,
+    0x47, 0x80, 0x80, 0x80, 0x80, 0xc8, 0xae, 0x80, 0x80, 0x80, 0x80, 0x72, 0x14, 0x88, 0x80, 0x80,
+    0x80, 0xfc, 0x0a, 0x08, 0x08, 0x08, 0x18, 0x47, 0x80, 0x00, 0x08, 0x88, 0xc0, 0x9f, 0x08, 0x08,
+    0x08, 0x08, 0x61, 0x14, 0x88, 0x80, 0x80, 0x08, 0xfc, 0x0a, 0x08, 0x08, 0x08, 0x18, 0x47, 0x80,
+    0x00, 0x08, 0x88, 0xc0, 0xae, 0x08, 0x08, 0x08, 0x80, 0x71, 0x14, 0x08, 0x88, 0x80, 0x80, 0xfb,
+    0x8c, 0x80, 0x00, 0x08, 0x18, 0x56, 0x00, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x08, 0x08,
+    0x70, 0x15, 0x08, 0x08, 0x08, 0x88, 0xfa, 0x8b, 0x08, 0x08, 0x08, 0x00, 0x57, 0x81, 0x80, 0x08,
+    0x08, 0xa8, 0xbf, 0x88, 0x80, 0x80, 0x00, 0x70, 0x15, 0x08, 0x88, 0x80, 0x80, 0xfa, 0x8b, 0x08,
+    0x08, 0x08, 0x00, 0x66, 0x81, 0x00, 0x88, 0x80, 0xa0, 0xbf, 0x09, 0x08, 0x80, 0x80, 0x70, 0x15,
+    0x9f, 0x48, 0x51, 0x00, 0x08, 0x08, 0x08, 0x08, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x08, 0x55, 0x01,
+    0x08, 0x08, 0x08, 0xa8, 0xcf, 0x08, 0x88, 0x80, 0x00, 0x58, 0x16, 0x80, 0x80, 0x80, 0x08, 0xf9,
+    0x9b, 0x80, 0x80, 0x00, 0x88, 0x66, 0x01, 0x08, 0x08, 0x08, 0xa0, 0xbf, 0x09, 0x08, 0x08, 0x08,
+    0x68, 0x16, 0x80, 0x80, 0x80, 0x00, 0xfa, 0x9b, 0x80, 0x00, 0x88, 0x80, 0x56, 0x02, 0x08, 0x08,
+    0x80, 0xa0, 0xdf, 0x88, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8d, 0x08,
+    0x08, 0x08, 0x08, 0x73, 0x03, 0x08, 0x88, 0x80, 0x80, 0xdf, 0x09, 0x08, 0x80, 0x80, 0x38, 0x37,
+    0x80, 0x80, 0x00, 0x08, 0xf9, 0x8d, 0x08, 0x08, 0x08, 0x88, 0x73, 0x03, 0x08, 0x08, 0x80, 0x90,
+    0xdf, 0x09, 0x80, 0x80, 0x80, 0x38, 0x37, 0x80, 0x80, 0x00, 0x08, 0xf8, 0x9d, 0x80, 0x00, 0x88,
+    0x80, 0x72, 0x03, 0x80, 0x9a, 0x3e, 0x4c, 0x00, 0x80, 0x80, 0x80, 0xdf, 0x09, 0x80, 0x80, 0x08,
+    0x28, 0x37, 0x00, 0x80, 0x08, 0x08, 0xf8, 0x9d, 0x00, 0x08, 0x88, 0x80, 0x72, 0x03, 0x00, 0x88,
+    0x80, 0x80, 0xee, 0x09, 0x88, 0x00, 0x08, 0x18, 0x47, 0x80, 0x80, 0x08, 0x08, 0xd0, 0xad, 0x00,
+    0x08, 0x08, 0x88, 0x72, 0x04, 0x08, 0x80, 0x80, 0x80, 0xed, 0x09, 0x08, 0x08, 0x08, 0x18, 0x37,
+    0x81, 0x80, 0x08, 0x08, 0xe0, 0x9e, 0x08, 0x08, 0x08, 0x90, 0x72, 0x13, 0x08, 0x88, 0x80, 0x00,
+    0xee, 0x89, 0x80, 0x80, 0x00, 0x19, 0x47, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xae, 0x80, 0x00, 0x88,
+    0x80, 0x71, 0x04, 0x80, 0x80, 0x80, 0x00, 0xfc, 0x0a, 0x08, 0x80, 0x08, 0x08, 0x47, 0x80, 0x80,
+    0x00, 0x88, 0xc1, 0xae, 0x08, 0x08, 0x80, 0x90, 0x71, 0x14, 0x88, 0x80, 0x80, 0x00, 0xfb, 0x8c,
+    0x00, 0x08, 0x08, 0x08, 0x37, 0x81, 0x00, 0x08, 0xe8, 0x43, 0x49, 0x00, 0x88, 0xc1, 0xbf, 0x08,
+    0x08, 0x08, 0x88, 0x70, 0x15, 0x08, 0x88, 0x80, 0x00, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x08, 0x57,
+    0x00, 0x08, 0x08, 0x08, 0xb0, 0xbf, 0x08, 0x08, 0x80, 0x90, 0x70, 0x15, 0x88, 0x80, 0x80, 0x00,
+    0xfa, 0x8b, 0x80, 0x80, 0x08, 0x08, 0x57, 0x81, 0x08, 0x08, 0x08, 0xa0, 0xbf, 0x88, 0x00, 0x88,
+    0x80, 0x78, 0x15, 0x08, 0x88, 0x00, 0x08, 0xf9, 0x8c, 0x00, 0x08, 0x08, 0x88, 0x55, 0x01, 0x08,
+    0x88, 0x80, 0xa1, 0xcf, 0x08, 0x08, 0x08, 0x08, 0x58, 0x16, 0x08, 0x88, 0x00, 0x08, 0xf9, 0x9b,
+    0x00, 0x08, 0x08, 0x88, 0x66, 0x81, 0x00, 0x88, 0x80, 0xa1, 0xbf, 0x88, 0x80, 0x80, 0x80, 0x68,
+    0x16, 0x08, 0x80, 0x08, 0x08, 0xf8, 0x8c, 0x80, 0x00, 0x08, 0x88, 0x64, 0x82, 0x80, 0x08, 0x08,
+    0x90, 0xcf, 0x88, 0x80, 0x00, 0x08, 0x49, 0x27, 0x08, 0x88, 0x80, 0x00, 0x4c, 0x42, 0x49, 0x00,
+    0xf9, 0x9b, 0x80, 0x00, 0x08, 0x88, 0x75, 0x01, 0x08, 0x08, 0x08, 0x90, 0xce, 0x09, 0x08, 0x80,
+    0x80, 0x48, 0x27, 0x80, 0x80, 0x08, 0x08, 0xf8, 0x8c, 0x08, 0x08, 0x08, 0x88, 0x74, 0x01, 0x80,
+    0x08, 0x08, 0x80, 0xbf, 0x09, 0x08, 0x80, 0x08, 0x49, 0x37, 0x08, 0x90, 0x00, 0x08, 0xf8, 0x8d,
+    0x80, 0x08, 0x80, 0x90, 0x73, 0x03, 0x08, 0x09, 0x80, 0x80, 0xdf, 0x08, 0x88, 0x00, 0x08, 0x39,
+    0x37, 0x80, 0x08, 0x08, 0x08, 0xf8, 0x9c, 0x80, 0x00, 0x88, 0x90, 0x73, 0x04, 0x08, 0x08, 0x08,
+    0x80, 0xde, 0x09, 0x08, 0x80, 0x80, 0x28, 0x47, 0x80, 0x88, 0x00, 0x08, 0xd8, 0x9d, 0x08, 0x18,
+    0x88, 0x90, 0x72, 0x05, 0x88, 0x80, 0x80, 0x00, 0xdd, 0x09, 0x08, 0x80, 0x08, 0x18, 0x47, 0x80,
+    0x80, 0x08, 0x08, 0xd0, 0x9e, 0x00, 0x08, 0x08, 0x88, 0x71, 0x03, 0x08, 0x08, 0x08, 0x00, 0xee,
+    0xed, 0xd8, 0x52, 0x00, 0x09, 0x08, 0x80, 0x80, 0x18, 0x37, 0x80, 0x80, 0x08, 0x00, 0xe0, 0xad,
+    0x80, 0x00, 0x08, 0x88, 0x71, 0x05, 0x08, 0x88, 0x80, 0x00, 0xec, 0x0a, 0x80, 0x00, 0x08, 0x08,
+    0x47, 0x80, 0x80, 0x08, 0x80, 0xb0, 0xbf, 0x08, 0x18, 0x88, 0x80, 0x71, 0x05, 0x80, 0x80, 0x08,
+    0x08, 0xfb, 0x8b, 0x80, 0x81, 0x08, 0x08, 0x67, 0x80, 0x80, 0x08, 0x80, 0xa0, 0xaf, 0x08, 0x08,
+    0x80, 0x80, 0x70, 0x04, 0x08, 0x08, 0x08, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x08, 0x57, 0x81,
+    0x80, 0x08, 0x88, 0xb1, 0xbf, 0x08, 0x08, 0x80, 0x80, 0x70, 0x15, 0x88, 0x80, 0x08, 0x08, 0xfa,
+    0x8b, 0x80, 0x00, 0x08, 0x09, 0x57, 0x81, 0x80, 0x08, 0x08, 0xa0, 0xbf, 0x08, 0x08, 0x80, 0x80,
+    0x78, 0x15, 0x88, 0x80, 0x08, 0x08, 0xf9, 0x0c, 0x80, 0x80, 0x00, 0x88, 0x55, 0x81, 0x08, 0x88,
+    0x80, 0xa1, 0xcf, 0x08, 0xa5, 0xc9, 0x4e, 0x00, 0x80, 0x00, 0x88, 0x50, 0x25, 0x88, 0x88, 0x80,
+    0x00, 0xfa, 0x8d, 0x00, 0x80, 0x00, 0x88, 0x64, 0x01, 0x88, 0x08, 0x08, 0x90, 0xcf, 0x08, 0x08,
+    0x80, 0x80, 0x58, 0x16, 0x08, 0x88, 0x08, 0x18, 0xf9, 0x8b, 0x80, 0x00, 0x08, 0x98, 0x66, 0x81,
+    0x80, 0x08, 0x88, 0x91, 0xbf, 0x88, 0x00, 0x80, 0x80, 0x69, 0x25, 0x08, 0x88, 0x08, 0x18, 0xf9,
+    0x8d, 0x80, 0x00, 0x08, 0x88, 0x64, 0x82, 0x08, 0x88, 0x80, 0x80, 0xcf, 0x08, 0x08, 0x80, 0x80,
+    0x49, 0x27, 0x88, 0x80, 0x08, 0x08, 0xf8, 0x9b, 0x00, 0x18, 0x08, 0x98, 0x74, 0x83, 0x80, 0x88,
+    0x80, 0x81, 0xdf, 0x08, 0x08, 0x08, 0x80, 0x28, 0x37, 0x08, 0x88, 0x80, 0x18, 0xf8, 0x8d, 0x80,
+    0x00, 0x08, 0x88, 0x72, 0x83, 0x80, 0x08, 0x88, 0x81, 0xdf, 0x08, 0x08, 0x08, 0x80, 0x28, 0x37,
+    0x08, 0x88, 0x80, 0x18, 0xf8, 0x8d, 0x80, 0x80, 0x97, 0xc8, 0x4c, 0x00, 0x00, 0x88, 0x72, 0x03,
+    0x88, 0x08, 0x88, 0x00, 0xcf, 0x09, 0x08, 0x80, 0x80, 0x28, 0x57, 0x08, 0x88, 0x80, 0x80, 0xd0,
+    0x9d, 0x00, 0x08, 0x80, 0x90, 0x72, 0x04, 0x08, 0x88, 0x08, 0x08, 0xdd, 0x0a, 0x80, 0x81, 0x80,
+    0x28, 0x57, 0x08, 0x08, 0x88, 0x08, 0xc0, 0x9e, 0x08, 0x18, 0x08, 0x88, 0x71, 0x04, 0x08, 0x88,
+    0x80, 0x00, 0xed, 0x09, 0x08, 0x80, 0x00, 0x19, 0x37, 0x81, 0x08, 0x09, 0x08, 0xd0, 0x9f, 0x08,
+    0x18, 0x08, 0x88, 0x71, 0x03, 0x80, 0x08, 0x88, 0x00, 0xfd, 0x89, 0x80, 0x00, 0x80, 0x18, 0x37,
+    0x00, 0x08, 0x09, 0x08, 0xd0, 0x9f, 0x08, 0x08, 0x00, 0x88, 0x71, 0x03, 0x80, 0x90, 0x80, 0x00,
+    0xfc, 0x0b, 0x80, 0x00, 0x08, 0x08, 0x57, 0x80, 0x80, 0x08, 0x08, 0xb0, 0xbf, 0x00, 0x08, 0x08,
+    0x80, 0x70, 0x05, 0x08, 0x88, 0x80, 0x00, 0xfb, 0x0b, 0x80, 0x80, 0x00, 0x14, 0xcf, 0x47, 0x00,
+    0x08, 0x57, 0x80, 0x80, 0x08, 0x08, 0xb0, 0xbf, 0x00, 0x08, 0x08, 0x80, 0x70, 0x14, 0x08, 0x88,
+    0x80, 0x18, 0xfb, 0x8c, 0x80, 0x00, 0x08, 0x08, 0x56, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x80,
+    0x80, 0x00, 0x90, 0x60, 0x14, 0x08, 0x90, 0x80, 0x00, 0xfb, 0x8c, 0x80, 0x00, 0x08, 0x08, 0x56,
+    0x81, 0x08, 0x08, 0x88, 0xb1, 0xcf, 0x80, 0x80, 0x00, 0x80, 0x58, 0x16, 0x88, 0x80, 0x80, 0x08,
+    0xf9, 0x8b, 0x80, 0x00, 0x08, 0x88, 0x47, 0x82, 0x08, 0x88, 0x80, 0xa0, 0xdf, 0x80, 0x80, 0x80,
+    0x00, 0x48, 0x16, 0x80, 0x80, 0x08, 0x08, 0xfa, 0x8c, 0x00, 0x08, 0x08, 0x80, 0x55, 0x82, 0x08,
+    0x08, 0x88, 0x90, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x40, 0x16, 0x08, 0x80, 0x08, 0x08, 0xf9, 0x8c,
+    0x80, 0x80, 0x00, 0x88, 0x55, 0x82, 0x80, 0x08, 0x88, 0x90, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x38,
+    0x8c, 0xe3, 0x47, 0x00, 0x37, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x8d, 0x80, 0x00, 0x08, 0x88, 0x64,
+    0x82, 0x08, 0x08, 0x88, 0x80, 0xcf, 0x08, 0x88, 0x00, 0x08, 0x48, 0x17, 0x80, 0x80, 0x08, 0x08,
+    0xf8, 0x9b, 0x80, 0x00, 0x08, 0x90, 0x75, 0x01, 0x08, 0x08, 0x88, 0x80, 0xbf, 0x09, 0x08, 0x80,
+    0x00, 0x38, 0x57, 0x80, 0x80, 0x08, 0x08, 0xf8, 0x9b, 0x80, 0x80, 0x00, 0x90, 0x74, 0x83, 0x80,
+    0x80, 0x90, 0x80, 0xcf, 0x09, 0x08, 0x08, 0x00, 0x39, 0x47, 0x80, 0x80, 0x80, 0x08, 0xe8, 0x9d,
+    0x00, 0x08, 0x08, 0x80, 0x72, 0x84, 0x80, 0x80, 0x80, 0x08, 0xce, 0x09, 0x88, 0x80, 0x00, 0x38,
+    0x47, 0x80, 0x80, 0x80, 0x08, 0xe8, 0x9d, 0x00, 0x08, 0x08, 0x90, 0x72, 0x04, 0x08, 0x88, 0x80,
+    0x80, 0xdd, 0x89, 0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x00, 0x08, 0x88, 0xe0, 0x9d, 0x80, 0x80,
+    0x80, 0x80, 0x72, 0x04, 0x71, 0x3f, 0x4f, 0x00, 0x08, 0x88, 0x80, 0x80, 0xfc, 0x09, 0x88, 0x00,
+    0x08, 0x18, 0x37, 0x80, 0x00, 0x08, 0x88, 0xd0, 0x9f, 0x08, 0x08, 0x80, 0x80, 0x71, 0x03, 0x08,
+    0x80, 0x80, 0x08, 0xfd, 0x89, 0x80, 0x80, 0x00, 0x18, 0x37, 0x80, 0x00, 0x08, 0x88, 0xd0, 0xae,
+    0x80, 0x08, 0x80, 0x80, 0x71, 0x05, 0x08, 0x08, 0x08, 0x08, 0xec, 0x0a, 0x80, 0x80, 0x18, 0x08,
+    0x47, 0x80, 0x00, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x88, 0x81, 0x70, 0x06, 0x08, 0x08, 0x80,
+    0x08, 0xfb, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x47, 0x00, 0x08, 0x08, 0x88, 0xb1, 0xcf, 0x80, 0x80,
+    0x80, 0x80, 0x60, 0x14, 0x08, 0x08, 0x80, 0x08, 0xfb, 0x8c, 0x80, 0x80, 0x00, 0x88, 0x47, 0x81,
+    0x08, 0x08, 0x80, 0xb0, 0xcf, 0x80, 0x80, 0x80, 0x80, 0x60, 0x14, 0x08, 0x80, 0x80, 0x08, 0xfa,
+    0x0d, 0x08, 0x08, 0x08, 0x08, 0x74, 0x81, 0x08, 0x18, 0x3c, 0x4e, 0x00, 0x08, 0x08, 0xa0, 0xbf,
+    0x80, 0x80, 0x80, 0x80, 0x60, 0x15, 0x08, 0x08, 0x08, 0x08, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x88,
+    0x65, 0x81, 0x80, 0x80, 0x80, 0x90, 0xbf, 0x88, 0x80, 0x80, 0x80, 0x50, 0x17, 0x80, 0x80, 0x80,
+    0x08, 0xf9, 0x8b, 0x08, 0x08, 0x08, 0x80, 0x75, 0x01, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x08, 0x88,
+    0x80, 0x00, 0x58, 0x17, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8b, 0x08, 0x08, 0x08, 0x80, 0x74, 0x83,
+    0x08, 0x08, 0x80, 0x90, 0xdf, 0x08, 0x08, 0x88, 0x00, 0x38, 0x37, 0x88, 0x80, 0x00, 0x08, 0xf9,
+    0x8d, 0x80, 0x80, 0x08, 0x80, 0x73, 0x83, 0x08, 0x80, 0x80, 0x90, 0xdf, 0x08, 0x08, 0x88, 0x00,
+    0x38, 0x37, 0x88, 0x00, 0x08, 0x08, 0xf9, 0x8d, 0x80, 0x80, 0x08, 0x80, 0x73, 0x83, 0x08, 0x80,
+    0x80, 0x80, 0xdf, 0x09, 0x80, 0x80, 0x00, 0x28, 0x37, 0x80, 0x80, 0x18, 0x92, 0x40, 0x48, 0x00,
+    0x09, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x08, 0x88, 0x80, 0xdf, 0x88, 0x80,
+    0x80, 0x80, 0x20, 0x37, 0x80, 0x80, 0x00, 0x09, 0xf8, 0xac, 0x00, 0x08, 0x08, 0x80, 0x72, 0x05,
+    0x08, 0x88, 0x80, 0x80, 0xfc, 0x09, 0x80, 0x80, 0x08, 0x28, 0x37, 0x08, 0x80, 0x08, 0x08, 0xe8,
+    0x9d, 0x80, 0x08, 0x08, 0x80, 0x72, 0x04, 0x08, 0x08, 0x80, 0x88, 0xfc, 0x89, 0x80, 0x80, 0x00,
+    0x18, 0x37, 0x00, 0x80, 0x08, 0x08, 0xe8, 0x9e, 0x80, 0x08, 0x80, 0x80, 0x71, 0x04, 0x08, 0x88,
+    0x80, 0x80, 0xec, 0x89, 0x80, 0x80, 0x08, 0x10, 0x47, 0x80, 0x00, 0x08, 0x88, 0xc0, 0xaf, 0x00,
+    0x88, 0x80, 0x00, 0x71, 0x13, 0x88, 0x80, 0x80, 0x08, 0xfd, 0x89, 0x80, 0x80, 0x08, 0x10, 0x46,
+    0x81, 0x80, 0x80, 0x08, 0xc8, 0xaf, 0x08, 0x08, 0x08, 0x80, 0x71, 0x14, 0x88, 0x80, 0x80, 0x08,
+    0x78, 0x3a, 0x47, 0x00, 0xfc, 0x0a, 0x80, 0x08, 0x08, 0x00, 0x47, 0x80, 0x00, 0x08, 0x88, 0xb8,
+    0xbf, 0x80, 0x08, 0x80, 0x00, 0x70, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0x08,
+    0x00, 0x57, 0x81, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x80, 0x00, 0x70, 0x15, 0x88, 0x80,
+    0x80, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x08, 0x57, 0x81, 0x80, 0x08, 0x88, 0xa0, 0xbf, 0x08,
+    0x08, 0x88, 0x00, 0x70, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x80, 0x08, 0x00, 0x57,
+    0x81, 0x08, 0x08, 0x88, 0xa0, 0xbf, 0x08, 0x08, 0x88, 0x00, 0x60, 0x16, 0x08, 0x08, 0x08, 0x88,
+    0xf9, 0x9b, 0x00, 0x08, 0x08, 0x00, 0x66, 0x81, 0x80, 0x80, 0x80, 0x98, 0xbf, 0x09, 0x08, 0x80,
+    0x00, 0x50, 0x17, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x74, 0x81, 0x80,
+    0x80, 0x80, 0x98, 0xce, 0x69, 0xc6, 0x50, 0x00, 0x08, 0x08, 0x80, 0x08, 0x40, 0x17, 0x80, 0x80,
+    0x00, 0x09, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x75, 0x82, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x09,
+    0x80, 0x80, 0x00, 0x58, 0x27, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x00, 0x08, 0x08, 0x80, 0x75,
+    0x82, 0x08, 0x08, 0x88, 0x90, 0xce, 0x09, 0x08, 0x80, 0x00, 0x48, 0x27, 0x80, 0x08, 0x08, 0x88,
+    0xf8, 0x8c, 0x08, 0x08, 0x08, 0x00, 0x73, 0x03, 0x08, 0x08, 0x88, 0x90, 0xdf, 0x09, 0x08, 0x80,
+    0x08, 0x38, 0x37, 0x80, 0x80, 0x08, 0x08, 0xf8, 0x9d, 0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08,
+    0x08, 0x90, 0x80, 0xdf, 0x09, 0x80, 0x00, 0x08, 0x38, 0x37, 0x80, 0x08, 0x08, 0x88, 0xf8, 0x9c,
+    0x80, 0x08, 0x80, 0x00, 0x72, 0x05, 0x88, 0x80, 0x80, 0x88, 0xec, 0x09, 0x88, 0x00, 0x08, 0x20,
+    0x47, 0x80, 0x08, 0x08, 0x88, 0xd8, 0xad, 0x00, 0x1f, 0xca, 0x4b, 0x00, 0x08, 0x80, 0x00, 0x72,
+    0x04, 0x08, 0x08, 0x88, 0x80, 0xed, 0x09, 0x88, 0x00, 0x08, 0x10, 0x47, 0x80, 0x08, 0x08, 0x88,
+    0xd0, 0xad, 0x00, 0x08, 0x08, 0x80, 0x72, 0x14, 0x09, 0x80, 0x80, 0x88, 0xfc, 0x0a, 0x80, 0x80,
+    0x00, 0x18, 0x47, 0x80, 0x80, 0x08, 0x08, 0xc8, 0xae, 0x80, 0x00, 0x88, 0x00, 0x71, 0x14, 0x88,
+    0x80, 0x80, 0x08, 0xfc, 0x0a, 0x08, 0x08, 0x08, 0x00, 0x47, 0x80, 0x80, 0x00, 0x88, 0xc0, 0xae,
+    0x08, 0x08, 0x80, 0x80, 0x71, 0x14, 0x88, 0x80, 0x80, 0x80, 0xfb, 0x8c, 0x00, 0x08, 0x08, 0x18,
+    0x47, 0x80, 0x80, 0x80, 0x80, 0xb0, 0xcf, 0x00, 0x88, 0x80, 0x00, 0x60, 0x14, 0x08, 0x88, 0x80,
+    0x08, 0xfb, 0x8c, 0x80, 0x00, 0x08, 0x00, 0x56, 0x81, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08,
+    0x88, 0x81, 0x71, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x80, 0x38, 0xcb, 0x47, 0x00,
+    0x18, 0x18, 0x57, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x80, 0x80, 0x00, 0x50, 0x15, 0x08,
+    0x80, 0x08, 0x88, 0xfa, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x56, 0x81, 0x08, 0x08, 0x90, 0xa0, 0xbf,
+    0x19, 0x88, 0x80, 0x00, 0x70, 0x15, 0x88, 0x80, 0x00, 0x09, 0xfa, 0x8b, 0x80, 0x08, 0x08, 0x00,
+    0x66, 0x81, 0x80, 0x00, 0x88, 0x98, 0xcf, 0x08, 0x80, 0x80, 0x00, 0x58, 0x25, 0x88, 0x80, 0x80,
+    0x08, 0xfa, 0x8c, 0x80, 0x80, 0x08, 0x00, 0x74, 0x82, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08,
+    0x80, 0x08, 0x40, 0x26, 0x08, 0x88, 0x00, 0x09, 0xf9, 0x9c, 0x00, 0x80, 0x08, 0x00, 0x74, 0x82,
+    0x08, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x38, 0x37, 0x08, 0x08, 0x08, 0x88, 0xf9,
+    0x8d, 0x80, 0x80, 0x08, 0x00, 0x73, 0x83, 0x08, 0x08, 0x80, 0x98, 0xdf, 0x08, 0x88, 0x80, 0x00,
+    0x9c, 0xd0, 0x47, 0x00, 0x20, 0x37, 0x80, 0x80, 0x80, 0x88, 0xf8, 0x9d, 0x81, 0x08, 0x08, 0x80,
+    0x73, 0x03, 0x08, 0x08, 0x88, 0x88, 0xdf, 0x09, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x80,
+    0x88, 0xf8, 0x9d, 0x81, 0x08, 0x08, 0x80, 0x73, 0x03, 0x08, 0x08, 0x88, 0x88, 0xdf, 0x09, 0x80,
+    0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x00, 0x89, 0xe8, 0x9e, 0x80, 0x00, 0x88, 0x81, 0x72, 0x03,
+    0x08, 0x08, 0x90, 0x80, 0xdf, 0x09, 0x80, 0x80, 0x18, 0x28, 0x37, 0x00, 0x08, 0x08, 0x89, 0xe0,
+    0x9e, 0x80, 0x08, 0x80, 0x00, 0x71, 0x04, 0x88, 0x80, 0x80, 0x08, 0xdd, 0x0a, 0x80, 0x80, 0x00,
+    0x10, 0x47, 0x00, 0x08, 0x08, 0x89, 0xd0, 0x9e, 0x80, 0x80, 0x80, 0x81, 0x71, 0x13, 0x08, 0x88,
+    0x80, 0x09, 0xfd, 0x0a, 0x80, 0x80, 0x00, 0x00, 0x47, 0x80, 0x80, 0x08, 0x88, 0xc0, 0xae, 0x80,
+    0x00, 0x08, 0x80, 0x71, 0x8d, 0xfc, 0x4c, 0x00, 0x14, 0x88, 0x80, 0x90, 0x08, 0xfb, 0x0c, 0x08,
+    0x08, 0x00, 0x18, 0x56, 0x80, 0x80, 0x80, 0x88, 0xb0, 0xbf, 0x80, 0x08, 0x00, 0x80, 0x71, 0x05,
+    0x80, 0x80, 0x80, 0x09, 0xfb, 0x0b, 0x88, 0x00, 0x18, 0x00, 0x57, 0x00, 0x08, 0x08, 0x98, 0xa0,
+    0xbf, 0x08, 0x08, 0x08, 0x00, 0x70, 0x15, 0x88, 0x80, 0x80, 0x88, 0xfa, 0x8b, 0x80, 0x80, 0x00,
+    0x00, 0x57, 0x81, 0x08, 0x08, 0x88, 0xa8, 0xbf, 0x08, 0x08, 0x08, 0x00, 0x70, 0x15, 0x88, 0x80,
+    0x80, 0x88, 0xfa, 0x8b, 0x80, 0x80, 0x00, 0x00, 0x66, 0x81, 0x80, 0x08, 0x88, 0xa0, 0xbf, 0x08,
+    0x08, 0x08, 0x00, 0x78, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x8b, 0x08, 0x08, 0x00, 0x80, 0x66,
+    0x81, 0x00, 0x88, 0x90, 0x90, 0xcf, 0x08, 0x80, 0x80, 0x00, 0x58, 0x25, 0x88, 0x80, 0x08, 0x88,
+    0xf9, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x74, 0x01, 0x93, 0x35, 0x4d, 0x00, 0x08, 0x08, 0x88, 0x90,
+    0xcf, 0x08, 0x08, 0x80, 0x00, 0x48, 0x26, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x8c, 0x08, 0x08, 0x80,
+    0x80, 0x74, 0x82, 0x80, 0x08, 0x90, 0x80, 0xcf, 0x08, 0x08, 0x08, 0x80, 0x30, 0x37, 0x08, 0x88,
+    0x00, 0x09, 0xf9, 0x8d, 0x80, 0x08, 0x80, 0x00, 0x73, 0x83, 0x80, 0x08, 0x88, 0x80, 0xdf, 0x09,
+    0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x08, 0x88, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73,
+    0x03, 0x08, 0x88, 0x80, 0x88, 0xdf, 0x88, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x08, 0x88,
+    0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x80, 0x90, 0x80, 0xdf, 0x09, 0x80, 0x80,
+    0x00, 0x28, 0x37, 0x80, 0x00, 0x08, 0x09, 0xf8, 0xac, 0x00, 0x08, 0x08, 0x80, 0x73, 0x05, 0x08,
+    0x88, 0x80, 0x08, 0xdd, 0x89, 0x80, 0x80, 0x00, 0x10, 0x47, 0x80, 0x00, 0x9d, 0x37, 0x4a, 0x00,
+    0x88, 0x08, 0xd8, 0xad, 0x80, 0x00, 0x08, 0x80, 0x72, 0x05, 0x08, 0x88, 0x80, 0x08, 0xec, 0x0a,
+    0x80, 0x80, 0x00, 0x18, 0x47, 0x80, 0x00, 0x08, 0x09, 0xc8, 0x9f, 0x08, 0x08, 0x08, 0x00, 0x70,
+    0x13, 0x08, 0x08, 0x88, 0x08, 0xfd, 0x89, 0x80, 0x80, 0x00, 0x18, 0x37, 0x81, 0x08, 0x08, 0x88,
+    0xd0, 0xaf, 0x00, 0x08, 0x08, 0x80, 0x61, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x8a, 0x80, 0x80,
+    0x00, 0x00, 0x47, 0x00, 0x08, 0x08, 0x88, 0xb0, 0xcf, 0x80, 0x08, 0x80, 0x81, 0x60, 0x05, 0x08,
+    0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x00, 0x57, 0x00, 0x08, 0x08, 0x88, 0xb0, 0xbf,
+    0x08, 0x08, 0x80, 0x00, 0x70, 0x05, 0x80, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x00,
+    0x47, 0x01, 0x08, 0x08, 0x88, 0xb0, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x68, 0x14, 0x08, 0x08, 0x88,
+    0xa6, 0x2e, 0x47, 0x00, 0x08, 0xfa, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x46, 0x82, 0x08, 0x08, 0x88,
+    0xa0, 0xdf, 0x08, 0x08, 0x08, 0x80, 0x50, 0x15, 0x08, 0x80, 0x08, 0x08, 0xfa, 0x8c, 0x80, 0x08,
+    0x00, 0x88, 0x46, 0x82, 0x80, 0x08, 0x88, 0x90, 0xdf, 0x08, 0x88, 0x00, 0x80, 0x40, 0x26, 0x88,
+    0x80, 0x80, 0x08, 0xf9, 0x8c, 0x08, 0x08, 0x08, 0x80, 0x65, 0x81, 0x00, 0x88, 0x80, 0x90, 0xcf,
+    0x08, 0x08, 0x08, 0x80, 0x40, 0x26, 0x88, 0x00, 0x88, 0x08, 0xf9, 0x8c, 0x80, 0x08, 0x08, 0x80,
+    0x74, 0x82, 0x80, 0x80, 0x88, 0x80, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x30, 0x37, 0x08, 0x80, 0x88,
+    0x08, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x83, 0x00, 0x88, 0x90, 0x80, 0xdf, 0x88, 0x80,
+    0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x08, 0x19, 0xf9, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x03,
+    0x08, 0x88, 0x90, 0x80, 0x0f, 0x2a, 0x43, 0x00, 0xdf, 0x88, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80,
+    0x80, 0x08, 0x09, 0xf8, 0x9c, 0x80, 0x08, 0x08, 0x80, 0x73, 0x85, 0x00, 0x88, 0x80, 0x08, 0xce,
+    0x09, 0x08, 0x80, 0x00, 0x28, 0x47, 0x80, 0x80, 0x80, 0x88, 0xe0, 0x9c, 0x08, 0x08, 0x08, 0x80,
+    0x72, 0x05, 0x08, 0x08, 0x88, 0x80, 0xdd, 0x09, 0x88, 0x00, 0x18, 0x29, 0x47, 0x80, 0x00, 0x88,
+    0x08, 0xd8, 0x9e, 0x80, 0x80, 0x00, 0x80, 0x71, 0x03, 0x00, 0x88, 0x90, 0x00, 0xee, 0x09, 0x88,
+    0x80, 0x00, 0x28, 0x37, 0x00, 0x80, 0x08, 0x09, 0xe0, 0x9e, 0x80, 0x08, 0x08, 0x80, 0x71, 0x04,
+    0x08, 0x08, 0x88, 0x08, 0xec, 0x0a, 0x80, 0x08, 0x00, 0x18, 0x47, 0x80, 0x00, 0x08, 0x88, 0xd0,
+    0xad, 0x80, 0x08, 0x08, 0x80, 0x72, 0x05, 0x08, 0x80, 0x88, 0x00, 0xec, 0x0a, 0x88, 0x80, 0x10,
+    0x08, 0x47, 0x00, 0x80, 0x08, 0x88, 0xc0, 0x9f, 0x14, 0xd4, 0x4e, 0x00, 0x08, 0x88, 0x80, 0x81,
+    0x70, 0x13, 0x08, 0x80, 0x80, 0x09, 0xfc, 0x0b, 0x08, 0x08, 0x18, 0x18, 0x47, 0x81, 0x00, 0x88,
+    0x88, 0xb0, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x71, 0x04, 0x08, 0x80, 0x80, 0x08, 0xfb, 0x0c, 0x08,
+    0x88, 0x00, 0x00, 0x46, 0x81, 0x00, 0x08, 0x88, 0xb0, 0xcf, 0x80, 0x08, 0x08, 0x80, 0x70, 0x23,
+    0x09, 0x80, 0x80, 0x08, 0xfc, 0x8b, 0x80, 0x80, 0x00, 0x00, 0x47, 0x81, 0x00, 0x08, 0x98, 0xa0,
+    0xdf, 0x80, 0x80, 0x80, 0x00, 0x58, 0x15, 0x08, 0x08, 0x88, 0x08, 0xfa, 0x0c, 0x08, 0x08, 0x08,
+    0x80, 0x46, 0x01, 0x08, 0x08, 0x98, 0xb1, 0xcf, 0x08, 0x88, 0x80, 0x81, 0x50, 0x16, 0x08, 0x80,
+    0x80, 0x08, 0xfa, 0x8c, 0x80, 0x80, 0x00, 0x80, 0x55, 0x82, 0x08, 0x08, 0x88, 0x90, 0xdf, 0x08,
+    0x08, 0x08, 0x80, 0x40, 0x16, 0x08, 0x80, 0x80, 0x08, 0xf9, 0x8c, 0x80, 0xa7, 0xd4, 0x4a, 0x00,
+    0x08, 0x18, 0x88, 0x55, 0x82, 0x80, 0x80, 0x90, 0x90, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x30, 0x37,
+    0x88, 0x80, 0x80, 0x08, 0xf9, 0x8d, 0x80, 0x80, 0x00, 0x88, 0x64, 0x82, 0x08, 0x80, 0x90, 0x80,
+    0xcf, 0x08, 0x88, 0x80, 0x00, 0x38, 0x47, 0x88, 0x00, 0x08, 0x09, 0xf8, 0x9b, 0x80, 0x00, 0x08,
+    0x80, 0x74, 0x83, 0x08, 0x80, 0x88, 0x80, 0xdf, 0x08, 0x88, 0x80, 0x00, 0x38, 0x37, 0x08, 0x80,
+    0x08, 0x09, 0xf8, 0x8d, 0x80, 0x08, 0x80, 0x80, 0x73, 0x83, 0x80, 0x80, 0x90, 0x80, 0xdf, 0x08,
+    0x88, 0x00, 0x08, 0x38, 0x37, 0x08, 0x08, 0x08, 0x09, 0xf8, 0x9c, 0x80, 0x08, 0x00, 0x90, 0x73,
+    0x85, 0x80, 0x80, 0x80, 0x88, 0xec, 0x09, 0x88, 0x00, 0x80, 0x20, 0x47, 0x88, 0x00, 0x08, 0x88,
+    0xe0, 0x9c, 0x80, 0x08, 0x08, 0x80, 0x72, 0x05, 0x88, 0x80, 0x80, 0x08, 0xdd, 0x09, 0x80, 0x08,
+    0x72, 0xd5, 0x47, 0x00, 0x00, 0x18, 0x47, 0x80, 0x80, 0x80, 0x88, 0xd0, 0xad, 0x00, 0x08, 0x08,
+    0x80, 0x72, 0x05, 0x88, 0x80, 0x80, 0x08, 0xec, 0x0a, 0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x80,
+    0x08, 0x88, 0xc0, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x71, 0x13, 0x88, 0x80, 0x80, 0x88, 0xfc, 0x0b,
+    0x80, 0x80, 0x00, 0x18, 0x57, 0x80, 0x00, 0x88, 0x08, 0xb8, 0xbf, 0x00, 0x08, 0x08, 0x80, 0x71,
+    0x05, 0x08, 0x80, 0x88, 0x80, 0xfb, 0x8a, 0x80, 0x08, 0x00, 0x18, 0x57, 0x80, 0x00, 0x88, 0x08,
+    0xb8, 0xbf, 0x00, 0x08, 0x08, 0x80, 0x71, 0x14, 0x08, 0x08, 0x88, 0x08, 0xfb, 0x8c, 0x80, 0x80,
+    0x00, 0x18, 0x47, 0x80, 0x00, 0x08, 0x88, 0xb0, 0xcf, 0x80, 0x80, 0x80, 0x81, 0x60, 0x14, 0x08,
+    0x08, 0x88, 0x08, 0xfb, 0x8c, 0x80, 0x80, 0x00, 0x80, 0x47, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xcf,
+    0x08, 0x08, 0x80, 0x00, 0xe7, 0xd8, 0x45, 0x00, 0x50, 0x06, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8b,
+    0x80, 0x80, 0x00, 0x80, 0x47, 0x01, 0x08, 0x08, 0x88, 0xb0, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x60,
+    0x15, 0x08, 0x08, 0x88, 0x08, 0xfa, 0x0c, 0x88, 0x00, 0x08, 0x80, 0x65, 0x81, 0x80, 0x80, 0x88,
+    0x90, 0xbf, 0x08, 0x88, 0x00, 0x80, 0x50, 0x17, 0x08, 0x80, 0x08, 0x88, 0xf9, 0x8b, 0x80, 0x80,
+    0x00, 0x80, 0x75, 0x81, 0x00, 0x08, 0x88, 0x98, 0xbf, 0x08, 0x08, 0x08, 0x00, 0x58, 0x17, 0x08,
+    0x80, 0x80, 0x88, 0xf8, 0x9b, 0x81, 0x08, 0x08, 0x80, 0x75, 0x01, 0x08, 0x08, 0x88, 0x88, 0xbf,
+    0x08, 0x88, 0x80, 0x00, 0x58, 0x17, 0x80, 0x80, 0x80, 0x88, 0xf8, 0x9b, 0x81, 0x08, 0x08, 0x80,
+    0x75, 0x01, 0x08, 0x08, 0x88, 0x90, 0xce, 0x09, 0x80, 0x80, 0x00, 0x48, 0x27, 0x08, 0x08, 0x08,
+    0x09, 0xf8, 0x8c, 0x80, 0x08, 0x00, 0x08, 0x72, 0xcc, 0x06, 0x4b, 0x00, 0x84, 0x08, 0x80, 0x88,
+    0x80, 0xce, 0x09, 0x80, 0x80, 0x00, 0x38, 0x47, 0x80, 0x80, 0x08, 0x88, 0xe8, 0x9d, 0x00, 0x08,
+    0x08, 0x80, 0x73, 0x03, 0x08, 0x80, 0x88, 0x80, 0xdf, 0x09, 0x08, 0x08, 0x00, 0x28, 0x47, 0x88,
+    0x00, 0x08, 0x09, 0xe0, 0x9c, 0x80, 0x08, 0x80, 0x80, 0x73, 0x04, 0x08, 0x08, 0x88, 0x80, 0xde,
+    0x09, 0x80, 0x80, 0x00, 0x18, 0x47, 0x80, 0x80, 0x08, 0x08, 0xd8, 0x9d, 0x08, 0x08, 0x08, 0x80,
+    0x72, 0x04, 0x08, 0x80, 0x90, 0x00, 0xde, 0x09, 0x08, 0x08, 0x80, 0x28, 0x47, 0x80, 0x08, 0x08,
+    0x88, 0xc0, 0x9f, 0x80, 0x08, 0x80, 0x80, 0x71, 0x03, 0x08, 0x80, 0x80, 0x08, 0xfd, 0x09, 0x88,
+    0x00, 0x08, 0x18, 0x37, 0x80, 0x00, 0x08, 0x09, 0xd0, 0x9f, 0x80, 0x08, 0x80, 0x80, 0x71, 0x03,
+    0x08, 0x80, 0x08, 0x08, 0xed, 0x0a, 0x88, 0x00, 0x08, 0x18, 0x47, 0x81, 0xab, 0x2a, 0x4a, 0x00,
+    0x08, 0x08, 0x08, 0xc0, 0xaf, 0x80, 0x08, 0x80, 0x80, 0x71, 0x13, 0x08, 0x80, 0x08, 0x08, 0xfc,
+    0x8b, 0x80, 0x80, 0x00, 0x19, 0x57, 0x81, 0x08, 0x08, 0x08, 0xb0, 0xcf, 0x00, 0x88, 0x80, 0x80,
+    0x70, 0x13, 0x08, 0x80, 0x08, 0x08, 0xfc, 0x0b, 0x80, 0x08, 0x08, 0x18, 0x47, 0x81, 0x80, 0x80,
+    0x08, 0xb0, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x60, 0x15, 0x88, 0x80, 0x80, 0x18, 0xfb, 0x0c, 0x08,
+    0x08, 0x08, 0x08, 0x46, 0x81, 0x00, 0x08, 0x88, 0xa0, 0xdf, 0x08, 0x80, 0x80, 0x80, 0x50, 0x15,
+    0x08, 0x08, 0x88, 0x18, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x08, 0x55, 0x82, 0x08, 0x08, 0x88, 0xa0,
+    0xdf, 0x08, 0x80, 0x80, 0x00, 0x48, 0x16, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x8c, 0x80, 0x80, 0x00,
+    0x88, 0x65, 0x81, 0x80, 0x80, 0x88, 0xa1, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x68, 0x16, 0x08, 0x08,
+    0x54, 0x2d, 0x49, 0x00, 0x88, 0x00, 0xf9, 0x9b, 0x00, 0x08, 0x08, 0x80, 0x75, 0x01, 0x08, 0x88,
+    0x80, 0x90, 0xbf, 0x19, 0x88, 0x80, 0x81, 0x58, 0x17, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x00,
+    0x08, 0x18, 0x88, 0x75, 0x01, 0x08, 0x08, 0x88, 0x80, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x38, 0x37,
+    0x88, 0x80, 0x80, 0x08, 0xf9, 0x8d, 0x80, 0x80, 0x00, 0x88, 0x73, 0x83, 0x80, 0x80, 0x90, 0x91,
+    0xdf, 0x08, 0x08, 0x08, 0x08, 0x38, 0x37, 0x08, 0x08, 0x08, 0x09, 0xf8, 0x8d, 0x80, 0x80, 0x80,
+    0x80, 0x73, 0x83, 0x80, 0x80, 0x90, 0x80, 0xdf, 0x08, 0x88, 0x00, 0x08, 0x28, 0x37, 0x80, 0x80,
+    0x80, 0x08, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x08, 0x88, 0x80, 0xcf, 0x89,
+    0x80, 0x80, 0x00, 0x28, 0x57, 0x80, 0x80, 0x08, 0x08, 0xd8, 0x9d, 0x80, 0x80, 0x80, 0x91, 0x72,
+    0x04, 0x08, 0x08, 0x88, 0xe5, 0x26, 0x46, 0x00, 0x80, 0xed, 0x09, 0x80, 0x80, 0x00, 0x18, 0x37,
+    0x80, 0x00, 0x08, 0x88, 0xe8, 0x9e, 0x00, 0x08, 0x08, 0x80, 0x71, 0x03, 0x08, 0x80, 0x80, 0x88,
+    0xfd, 0x89, 0x80, 0x00, 0x08, 0x28, 0x37, 0x80, 0x00, 0x08, 0x09, 0xd8, 0x9f, 0x08, 0x08, 0x08,
+    0x80, 0x71, 0x04, 0x88, 0x80, 0x80, 0x08, 0xec, 0x0a, 0x80, 0x80, 0x00, 0x18, 0x47, 0x80, 0x00,
+    0x08, 0x88, 0xb8, 0xcf, 0x00, 0x08, 0x08, 0x80, 0x61, 0x14, 0x88, 0x80, 0x80, 0x08, 0xfc, 0x8a,
+    0x80, 0x00, 0x08, 0x00, 0x47, 0x81, 0x08, 0x08, 0x88, 0xc0, 0xaf, 0x00, 0x08, 0x88, 0x81, 0x70,
+    0x13, 0x08, 0x08, 0x90, 0x08, 0xfc, 0x0b, 0x08, 0x08, 0x18, 0x08, 0x57, 0x81, 0x08, 0x08, 0x88,
+    0xb0, 0xbf, 0x08, 0x08, 0x80, 0x00, 0x70, 0x05, 0x80, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x00,
+    0x08, 0x00, 0x57, 0x00, 0x08, 0x08, 0x88, 0xb0, 0x13, 0x1a, 0x44, 0x00, 0xbf, 0x08, 0x08, 0x80,
+    0x00, 0x70, 0x24, 0x88, 0x80, 0x80, 0x19, 0xfb, 0x8d, 0x80, 0x00, 0x08, 0x80, 0x55, 0x01, 0x08,
+    0x08, 0x98, 0xa0, 0xcf, 0x08, 0x80, 0x80, 0x00, 0x58, 0x16, 0x08, 0x08, 0x08, 0x09, 0xf9, 0x9b,
+    0x81, 0x08, 0x18, 0x08, 0x66, 0x81, 0x80, 0x08, 0x90, 0x90, 0xbf, 0x19, 0x88, 0x80, 0x00, 0x50,
+    0x17, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x08, 0x08, 0x00, 0x75, 0x01, 0x08, 0x08, 0x88,
+    0x90, 0xbf, 0x09, 0x08, 0x08, 0x00, 0x58, 0x17, 0x80, 0x80, 0x00, 0x09, 0xf9, 0x9b, 0x00, 0x88,
+    0x00, 0x80, 0x75, 0x01, 0x08, 0x80, 0x90, 0x80, 0xbf, 0x09, 0x88, 0x80, 0x10, 0x48, 0x37, 0x08,
+    0x08, 0x08, 0x09, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x83, 0x00, 0x08, 0x88, 0x88, 0xdf,
+    0x88, 0x80, 0x80, 0x00, 0x38, 0x37, 0x08, 0x80, 0x08, 0x88, 0xf8, 0x8d, 0x6e, 0xd4, 0x4d, 0x00,
+    0x80, 0x08, 0x08, 0x80, 0x73, 0x83, 0x00, 0x08, 0x88, 0x88, 0xcf, 0x09, 0x88, 0x80, 0x00, 0x28,
+    0x47, 0x08, 0x80, 0x08, 0x08, 0xe8, 0x9c, 0x80, 0x08, 0x08, 0x91, 0x73, 0x85, 0x80, 0x80, 0x80,
+    0x08, 0xdd, 0x09, 0x08, 0x80, 0x18, 0x18, 0x47, 0x80, 0x80, 0x08, 0x08, 0xd8, 0x9d, 0x08, 0x08,
+    0x08, 0x80, 0x72, 0x04, 0x08, 0x80, 0x80, 0x08, 0xed, 0x89, 0x80, 0x80, 0x00, 0x28, 0x37, 0x81,
+    0x80, 0x08, 0x88, 0xe0, 0x9e, 0x08, 0x08, 0x08, 0x80, 0x71, 0x04, 0x08, 0x08, 0x88, 0x00, 0xdd,
+    0x0a, 0x80, 0x80, 0x18, 0x18, 0x47, 0x00, 0x08, 0x08, 0x88, 0xc0, 0xaf, 0x80, 0x80, 0x80, 0x81,
+    0x70, 0x04, 0x08, 0x80, 0x80, 0x08, 0xfc, 0x89, 0x80, 0x80, 0x00, 0x18, 0x46, 0x00, 0x08, 0x08,
+    0x88, 0xc0, 0xaf, 0x80, 0x80, 0x80, 0x00, 0x70, 0x04, 0x08, 0x80, 0x80, 0x08, 0xec, 0x8a, 0x80,
+    0x7f, 0xd6, 0x47, 0x00, 0x80, 0x00, 0x18, 0x47, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xcf, 0x80, 0x08,
+    0x80, 0x80, 0x61, 0x05, 0x80, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x08, 0x57, 0x81,
+    0x80, 0x08, 0x88, 0xb1, 0xcf, 0x80, 0x80, 0x80, 0x81, 0x68, 0x05, 0x80, 0x80, 0x08, 0x08, 0xfa,
+    0x8b, 0x80, 0x00, 0x08, 0x08, 0x47, 0x81, 0x00, 0x88, 0x80, 0xa0, 0xdf, 0x80, 0x08, 0x80, 0x00,
+    0x58, 0x15, 0x08, 0x88, 0x80, 0x18, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x55, 0x01, 0x08, 0x08,
+    0x88, 0xa0, 0xcf, 0x08, 0x88, 0x80, 0x81, 0x68, 0x15, 0x08, 0x08, 0x08, 0x19, 0xfa, 0x8c, 0x80,
+    0x00, 0x08, 0x80, 0x55, 0x01, 0x08, 0x08, 0x88, 0x90, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x48, 0x16,
+    0x08, 0x80, 0x08, 0x08, 0xf9, 0x8c, 0x80, 0x80, 0x00, 0x90, 0x74, 0x01, 0x08, 0x08, 0x88, 0x90,
+    0xbf, 0x08, 0x88, 0x80, 0x57, 0xd7, 0x44, 0x00, 0x81, 0x58, 0x17, 0x80, 0x80, 0x08, 0x88, 0xf8,
+    0x8b, 0x80, 0x08, 0x00, 0x90, 0x65, 0x82, 0x00, 0x88, 0x90, 0x80, 0xdf, 0x08, 0x08, 0x80, 0x80,
+    0x30, 0x27, 0x80, 0x80, 0x08, 0x88, 0xf8, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x74, 0x82, 0x80, 0x08,
+    0x90, 0x80, 0xcf, 0x08, 0x88, 0x00, 0x08, 0x38, 0x47, 0x08, 0x88, 0x00, 0x09, 0xe8, 0x9c, 0x80,
+    0x00, 0x08, 0x80, 0x73, 0x04, 0x08, 0x88, 0x80, 0x88, 0xde, 0x88, 0x08, 0x80, 0x00, 0x38, 0x37,
+    0x80, 0x00, 0x88, 0x08, 0xf8, 0x9d, 0x80, 0x08, 0x00, 0x80, 0x72, 0x84, 0x00, 0x88, 0x80, 0x88,
+    0xed, 0x88, 0x80, 0x80, 0x00, 0x28, 0x37, 0x80, 0x80, 0x08, 0x88, 0xe8, 0x9d, 0x08, 0x08, 0x08,
+    0x80, 0x73, 0x04, 0x80, 0x80, 0x90, 0x80, 0xde, 0x09, 0x08, 0x08, 0x08, 0x20, 0x47, 0x80, 0x80,
+    0x08, 0x88, 0xd8, 0xad, 0x00, 0x08, 0x08, 0x00, 0x2b, 0xdc, 0x42, 0x00, 0x72, 0x04, 0x00, 0x88,
+    0x08, 0x88, 0xde, 0x09, 0x88, 0x00, 0x08, 0x20, 0x47, 0x80, 0x80, 0x08, 0x88, 0xd0, 0x9e, 0x80,
+    0x08, 0x80, 0x81, 0x71, 0x13, 0x88, 0x80, 0x80, 0x09, 0xde, 0x0a, 0x08, 0x80, 0x18, 0x28, 0x57,
+    0x80, 0x80, 0x08, 0x88, 0xc0, 0xae, 0x80, 0x00, 0x08, 0x00, 0x71, 0x04, 0x08, 0x88, 0x80, 0x08,
+    0xfc, 0x89, 0x80, 0x00, 0x08, 0x18, 0x37, 0x81, 0x80, 0x08, 0x98, 0xd0, 0x9f, 0x08, 0x08, 0x80,
+    0x00, 0x61, 0x14, 0x08, 0x88, 0x88, 0x08, 0xfc, 0x0a, 0x88, 0x81, 0x18, 0x18, 0x47, 0x80, 0x00,
+    0x88, 0x88, 0xb0, 0xbf, 0x88, 0x00, 0x80, 0x00, 0x70, 0x06, 0x08, 0x80, 0x08, 0x88, 0xfa, 0x8a,
+    0x80, 0x00, 0x08, 0x18, 0x47, 0x00, 0x08, 0x88, 0x80, 0xb8, 0xbf, 0x08, 0x08, 0x80, 0x00, 0x70,
+    0x15, 0x08, 0x88, 0x80, 0x08, 0xfb, 0x0c, 0x08, 0x80, 0x00, 0x08, 0x46, 0x29, 0x1c, 0x4b, 0x00,
+    0x81, 0x80, 0x08, 0x90, 0xa0, 0xdf, 0x80, 0x80, 0x80, 0x00, 0x50, 0x15, 0x88, 0x80, 0x80, 0x08,
+    0xfb, 0x0c, 0x08, 0x80, 0x18, 0x08, 0x65, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xbf, 0x08, 0x08, 0x80,
+    0x00, 0x68, 0x16, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x8b, 0x08, 0x00, 0x88, 0x00, 0x66, 0x81, 0x08,
+    0x08, 0x88, 0x90, 0xbf, 0x88, 0x00, 0x90, 0x00, 0x68, 0x16, 0x08, 0x88, 0x00, 0x88, 0xf9, 0x8b,
+    0x80, 0x00, 0x08, 0x08, 0x75, 0x01, 0x08, 0x09, 0x80, 0x88, 0xbf, 0x09, 0x08, 0x80, 0x00, 0x50,
+    0x17, 0x08, 0x80, 0x08, 0x88, 0xf8, 0x9b, 0x80, 0x00, 0x08, 0x00, 0x74, 0x83, 0x08, 0x08, 0x88,
+    0x88, 0xdf, 0x08, 0x08, 0x88, 0x10, 0x38, 0x37, 0x88, 0x80, 0x00, 0x89, 0xf8, 0x8d, 0x80, 0x80,
+    0x80, 0x81, 0x73, 0x83, 0x08, 0x08, 0x88, 0x88, 0xdf, 0x08, 0x08, 0x08, 0x08, 0x30, 0x37, 0x08,
+    0xca, 0x2d, 0x48, 0x00, 0x88, 0x08, 0x88, 0xf8, 0x8d, 0x08, 0x00, 0x88, 0x81, 0x72, 0x03, 0x08,
+    0x09, 0x90, 0x80, 0xdf, 0x88, 0x80, 0x00, 0x08, 0x20, 0x37, 0x80, 0x90, 0x00, 0x09, 0xf9, 0x9c,
+    0x80, 0x00, 0x08, 0x00, 0x72, 0x85, 0x80, 0x08, 0x88, 0x80, 0xdd, 0x09, 0x08, 0x80, 0x00, 0x20,
+    0x47, 0x08, 0x88, 0x00, 0x09, 0xe8, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x72, 0x85, 0x80, 0x80, 0x90,
+    0x80, 0xec, 0x09, 0x08, 0x80, 0x08, 0x10, 0x47, 0x80, 0x80, 0x08, 0x88, 0xd0, 0x9e, 0x80, 0x00,
+    0x08, 0x80, 0x71, 0x03, 0x08, 0x88, 0x00, 0x88, 0xde, 0x0a, 0x80, 0x00, 0x08, 0x28, 0x57, 0x80,
+    0x08, 0x08, 0x08, 0xc8, 0xae, 0x00, 0x08, 0x80, 0x80, 0x72, 0x04, 0x08, 0x88, 0x80, 0x08, 0xdd,
+    0x0a, 0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x00, 0x88, 0x80, 0xc8, 0xaf, 0x00, 0x08, 0x08, 0x80,
+    0x71, 0x04, 0x08, 0x08, 0xc7, 0x29, 0x47, 0x00, 0x88, 0x08, 0xec, 0x0a, 0x88, 0x00, 0x18, 0x18,
+    0x47, 0x81, 0x80, 0x08, 0x88, 0xc8, 0xaf, 0x80, 0x00, 0x08, 0x80, 0x71, 0x04, 0x08, 0x80, 0x88,
+    0x08, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x10, 0x57, 0x81, 0x80, 0x08, 0x88, 0xb8, 0xcf, 0x80, 0x00,
+    0x08, 0x80, 0x61, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x8a, 0x80, 0x00, 0x08, 0x00, 0x47, 0x81,
+    0x08, 0x08, 0x88, 0xb0, 0xcf, 0x08, 0x08, 0x80, 0x81, 0x60, 0x14, 0x80, 0x80, 0x88, 0x08, 0xfb,
+    0x0d, 0x08, 0x08, 0x18, 0x08, 0x55, 0x81, 0x80, 0x80, 0x88, 0xa0, 0xcf, 0x08, 0x08, 0x80, 0x00,
+    0x50, 0x16, 0x88, 0x80, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x08, 0x00, 0x00, 0x56, 0x82, 0x08, 0x08,
+    0x88, 0xa8, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x40, 0x26, 0x88, 0x80, 0x80, 0x88, 0xfa, 0x8c, 0x80,
+    0x00, 0x08, 0x00, 0x74, 0x01, 0x08, 0x08, 0x88, 0xb5, 0x27, 0x45, 0x00, 0x98, 0xbf, 0x09, 0x08,
+    0x80, 0x81, 0x60, 0x25, 0x08, 0x80, 0x88, 0x08, 0xfa, 0x8d, 0x80, 0x80, 0x00, 0x80, 0x74, 0x81,
+    0x00, 0x88, 0x90, 0x90, 0xbf, 0x08, 0x08, 0x08, 0x00, 0x58, 0x26, 0x08, 0x80, 0x88, 0x08, 0xf9,
+    0x9c, 0x00, 0x08, 0x08, 0x00, 0x74, 0x01, 0x80, 0x08, 0x88, 0x90, 0xbf, 0x09, 0x08, 0x80, 0x00,
+    0x58, 0x27, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x80, 0x75, 0x82, 0x80, 0x08,
+    0x88, 0x90, 0xce, 0x09, 0x08, 0x08, 0x80, 0x30, 0x57, 0x08, 0x08, 0x08, 0x88, 0xe8, 0x9c, 0x00,
+    0x08, 0x08, 0x80, 0x73, 0x04, 0x08, 0x88, 0x80, 0x88, 0xce, 0x89, 0x00, 0x88, 0x10, 0x49, 0x27,
+    0x00, 0x88, 0x00, 0x09, 0xe8, 0x9d, 0x80, 0x08, 0x80, 0x80, 0x73, 0x04, 0x08, 0x88, 0x80, 0x80,
+    0xce, 0x89, 0x08, 0x80, 0x00, 0x28, 0x57, 0x80, 0x80, 0x80, 0x08, 0xd8, 0xce, 0x0b, 0x48, 0x00,
+    0x9d, 0x80, 0x08, 0x08, 0x80, 0x73, 0x13, 0x08, 0x08, 0x88, 0x80, 0xdf, 0x89, 0x80, 0x80, 0x00,
+    0x28, 0x47, 0x80, 0x80, 0x00, 0x88, 0xd8, 0xad, 0x80, 0x80, 0x80, 0x80, 0x72, 0x05, 0x08, 0x80,
+    0x80, 0x88, 0xec, 0x89, 0x80, 0x80, 0x00, 0x18, 0x47, 0x80, 0x00, 0x08, 0x88, 0xd0, 0xad, 0x80,
+    0x08, 0x80, 0x80, 0x72, 0x04, 0x00, 0x08, 0x88, 0x00, 0xed, 0x0a, 0x88, 0x00, 0x08, 0x18, 0x47,
+    0x00, 0x80, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x88, 0x80, 0x80, 0x71, 0x06, 0x08, 0x80, 0x80, 0x08,
+    0xfb, 0x0a, 0x08, 0x88, 0x00, 0x08, 0x47, 0x00, 0x08, 0x08, 0x08, 0xc0, 0xae, 0x08, 0x08, 0x88,
+    0x80, 0x71, 0x14, 0x08, 0x08, 0x80, 0x08, 0xfb, 0x8c, 0x80, 0x80, 0x08, 0x00, 0x37, 0x01, 0x08,
+    0x00, 0x88, 0xb0, 0xdf, 0x80, 0x08, 0x08, 0x08, 0x50, 0x15, 0x08, 0x08, 0x80, 0x08, 0xfb, 0x8c,
+    0x29, 0xdf, 0x49, 0x00, 0x80, 0x80, 0x00, 0x08, 0x46, 0x81, 0x00, 0x08, 0x88, 0xb0, 0xcf, 0x08,
+    0x88, 0x80, 0x00, 0x60, 0x15, 0x08, 0x08, 0x88, 0x08, 0xfa, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x46,
+    0x81, 0x00, 0x08, 0x88, 0xb0, 0xcf, 0x08, 0x08, 0x88, 0x00, 0x68, 0x15, 0x08, 0x80, 0x80, 0x08,
+    0xfa, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x55, 0x01, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x88, 0x80, 0x80,
+    0x00, 0x68, 0x15, 0x08, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x74, 0x01, 0x08,
+    0x08, 0x88, 0xa0, 0xbf, 0x08, 0x88, 0x80, 0x81, 0x50, 0x17, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8b,
+    0x80, 0x08, 0x18, 0x08, 0x75, 0x01, 0x08, 0x88, 0x80, 0x98, 0xce, 0x08, 0x88, 0x80, 0x81, 0x40,
+    0x27, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x8c, 0x80, 0x80, 0x00, 0x80, 0x73, 0x03, 0x08, 0x88, 0x90,
+    0x90, 0xdf, 0x09, 0x80, 0x36, 0xdc, 0x46, 0x00, 0x00, 0x00, 0x38, 0x37, 0x80, 0x80, 0x88, 0x08,
+    0xf9, 0x9d, 0x80, 0x00, 0x08, 0x81, 0x73, 0x03, 0x08, 0x08, 0x98, 0x90, 0xdf, 0x88, 0x08, 0x80,
+    0x00, 0x20, 0x47, 0x08, 0x80, 0x08, 0x09, 0xf8, 0x9b, 0x90, 0x00, 0x18, 0x80, 0x73, 0x86, 0x00,
+    0x88, 0x90, 0x80, 0xec, 0x09, 0x08, 0x80, 0x00, 0x28, 0x37, 0x80, 0x81, 0x08, 0x89, 0xf0, 0x8d,
+    0x88, 0x80, 0x00, 0x80, 0x72, 0x03, 0x00, 0x88, 0x90, 0x08, 0xcf, 0x89, 0x88, 0x00, 0x00, 0x38,
+    0x47, 0x00, 0x80, 0x08, 0x88, 0xe8, 0x9d, 0x80, 0x08, 0x08, 0x00, 0x72, 0x04, 0x08, 0x08, 0x88,
+    0x08, 0xed, 0x09, 0x88, 0x80, 0x00, 0x10, 0x37, 0x00, 0x80, 0x80, 0x88, 0xe0, 0x9e, 0x08, 0x08,
+    0x08, 0x80, 0x72, 0x03, 0x00, 0x88, 0x80, 0x08, 0xee, 0x89, 0x80, 0x80, 0x00, 0x28, 0x37, 0x00,
+    0x08, 0x08, 0x88, 0xe0, 0xad, 0x08, 0x08, 0x08, 0x38, 0xdd, 0x42, 0x00, 0x80, 0x72, 0x05, 0x08,
+    0x80, 0x80, 0x88, 0xfb, 0x0b, 0x88, 0x00, 0x08, 0x10, 0x57, 0x00, 0x08, 0x08, 0x88, 0xb8, 0xbf,
+    0x80, 0x08, 0x80, 0x00, 0x71, 0x05, 0x80, 0x80, 0x80, 0x08, 0xec, 0x8a, 0x80, 0x00, 0x08, 0x00,
+    0x47, 0x81, 0x80, 0x80, 0x90, 0xb0, 0xcf, 0x08, 0x08, 0x08, 0x00, 0x70, 0x04, 0x08, 0x80, 0x80,
+    0x88, 0xfb, 0x8b, 0x80, 0x80, 0x00, 0x00, 0x57, 0x81, 0x80, 0x80, 0x88, 0xb0, 0xbf, 0x08, 0x08,
+    0x08, 0x80, 0x70, 0x15, 0x08, 0x80, 0x08, 0x88, 0xfa, 0x8b, 0x88, 0x00, 0x08, 0x00, 0x57, 0x81,
+    0x80, 0x08, 0x80, 0xa8, 0xbf, 0x88, 0x08, 0x80, 0x00, 0x70, 0x15, 0x08, 0x88, 0x80, 0x08, 0xf9,
+    0x8c, 0x80, 0x80, 0x00, 0x80, 0x55, 0x01, 0x08, 0x08, 0x88, 0x90, 0xdf, 0x08, 0x08, 0x08, 0x00,
+    0x48, 0x16, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x80, 0x80, 0x00, 0x80, 0x45, 0xde, 0x42, 0x00,
+    0x55, 0x82, 0x08, 0x80, 0x88, 0xa0, 0xcf, 0x08, 0x09, 0x80, 0x81, 0x40, 0x17, 0x00, 0x08, 0x88,
+    0x08, 0xf9, 0x8c, 0x80, 0x08, 0x00, 0x80, 0x74, 0x81, 0x00, 0x08, 0x98, 0x90, 0xce, 0x08, 0x88,
+    0x00, 0x00, 0x48, 0x27, 0x08, 0x08, 0x88, 0x88, 0xf9, 0x8b, 0x88, 0x00, 0x18, 0x80, 0x75, 0x01,
+    0x08, 0x80, 0x88, 0x90, 0xbf, 0x09, 0x88, 0x00, 0x00, 0x58, 0x26, 0x80, 0x00, 0x08, 0x09, 0xf9,
+    0x8d, 0x80, 0x08, 0x08, 0x00, 0x73, 0x02, 0x08, 0x80, 0x90, 0x90, 0xcf, 0x09, 0x88, 0x80, 0x10,
+    0x48, 0x27, 0x08, 0x80, 0x80, 0x08, 0xf9, 0x8c, 0x08, 0x88, 0x00, 0x80, 0x73, 0x84, 0x00, 0x08,
+    0x88, 0x88, 0xce, 0x09, 0x88, 0x80, 0x00, 0x38, 0x57, 0x08, 0x80, 0x80, 0x88, 0xe0, 0x9c, 0x00,
+    0x88, 0x00, 0x80, 0x72, 0x04, 0x08, 0x08, 0x88, 0x80, 0xde, 0x09, 0x80, 0x80, 0x00, 0x28, 0x37,
+    0x35, 0x1f, 0x48, 0x00, 0x80, 0x00, 0x08, 0x09, 0xf8, 0x9d, 0x00, 0x88, 0x00, 0x80, 0x72, 0x03,
+    0x08, 0x80, 0x80, 0x88, 0xcf, 0x0a, 0x80, 0x08, 0x00, 0x28, 0x57, 0x80, 0x80, 0x80, 0x80, 0xc8,
+    0x9f, 0x80, 0x80, 0x80, 0x80, 0x72, 0x03, 0x08, 0x08, 0x88, 0x80, 0xfd, 0x09, 0x88, 0x00, 0x08,
+    0x18, 0x37, 0x00, 0x08, 0x08, 0x88, 0xd0, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x71, 0x03, 0x00, 0x88,
+    0x80, 0x88, 0xfc, 0x8a, 0x80, 0x80, 0x00, 0x18, 0x47, 0x81, 0x80, 0x80, 0x88, 0xc0, 0xaf, 0x80,
+    0x08, 0x80, 0x81, 0x70, 0x04, 0x08, 0x80, 0x80, 0x08, 0xec, 0x8a, 0x80, 0x80, 0x00, 0x18, 0x47,
+    0x81, 0x80, 0x80, 0x88, 0xc0, 0xaf, 0x80, 0x80, 0x80, 0x81, 0x61, 0x14, 0x08, 0x80, 0x80, 0x09,
+    0xfb, 0x0d, 0x88, 0x80, 0x00, 0x00, 0x46, 0x00, 0x80, 0x80, 0x88, 0xb0, 0xcf, 0x80, 0x08, 0x08,
+    0x00, 0x78, 0x23, 0x08, 0x64, 0x26, 0x45, 0x00, 0x08, 0x88, 0x08, 0xfc, 0x8b, 0x80, 0x08, 0x00,
+    0x00, 0x47, 0x01, 0x80, 0x08, 0x88, 0xb8, 0xcf, 0x88, 0x80, 0x80, 0x81, 0x61, 0x15, 0x08, 0x80,
+    0x80, 0x09, 0xfa, 0x8c, 0x80, 0x88, 0x10, 0x08, 0x46, 0x82, 0x00, 0x08, 0x89, 0xb0, 0xdf, 0x08,
+    0x88, 0x00, 0x00, 0x58, 0x15, 0x80, 0x00, 0x88, 0x08, 0xfa, 0x8c, 0x80, 0x88, 0x00, 0x00, 0x74,
+    0x01, 0x08, 0x80, 0x90, 0x90, 0xbf, 0x09, 0x88, 0x80, 0x81, 0x60, 0x25, 0x08, 0x80, 0x80, 0x08,
+    0xfa, 0x8d, 0x80, 0x08, 0x00, 0x88, 0x55, 0x01, 0x08, 0x80, 0x88, 0x90, 0xcf, 0x08, 0x88, 0x80,
+    0x00, 0x48, 0x27, 0x88, 0x80, 0x80, 0x18, 0xf9, 0x8c, 0x80, 0x80, 0x00, 0x88, 0x74, 0x01, 0x08,
+    0x88, 0x80, 0x90, 0xbf, 0x08, 0x88, 0x00, 0x80, 0x58, 0x26, 0x08, 0x80, 0x08, 0x88, 0xf9, 0x8c,
+    0x80, 0x08, 0x80, 0x80, 0x74, 0x82, 0x08, 0x80, 0xd1, 0x21, 0x45, 0x00, 0x88, 0x80, 0xbf, 0x09,
+    0x88, 0x00, 0x00, 0x59, 0x27, 0x88, 0x00, 0x88, 0x08, 0xf8, 0x9b, 0x80, 0x08, 0x00, 0x90, 0x74,
+    0x03, 0x08, 0x88, 0x80, 0x80, 0xdf, 0x09, 0x80, 0x80, 0x00, 0x28, 0x37, 0x80, 0x80, 0x80, 0x08,
+    0xf8, 0x9d, 0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x80, 0x88, 0x80, 0xdf, 0x88, 0x80, 0x80,
+    0x00, 0x28, 0x37, 0x80, 0x80, 0x80, 0x08, 0xe8, 0x9e, 0x80, 0x80, 0x00, 0x90, 0x72, 0x03, 0x00,
+    0x88, 0x80, 0x08, 0xdf, 0x09, 0x08, 0x08, 0x00, 0x29, 0x37, 0x00, 0x80, 0x08, 0x88, 0xe0, 0x9e,
+    0x80, 0x08, 0x80, 0x80, 0x72, 0x03, 0x18, 0x88, 0x80, 0x08, 0xee, 0x09, 0x88, 0x80, 0x00, 0x18,
+    0x47, 0x80, 0x80, 0x80, 0x08, 0xc8, 0xae, 0x80, 0x00, 0x88, 0x81, 0x71, 0x04, 0x08, 0x80, 0x80,
+    0x08, 0xed, 0x09, 0x88, 0x80, 0x00, 0x18, 0x47, 0x80, 0x80, 0x08, 0x88, 0xc8, 0x1c, 0x43, 0x00,
+    0xb0, 0xbf, 0x80, 0x08, 0x80, 0x81, 0x71, 0x05, 0x08, 0x80, 0x80, 0x08, 0xfc, 0x09, 0x88, 0x80,
+    0x00, 0x18, 0x37, 0x80, 0x00, 0x08, 0x89, 0xd1, 0xae, 0x80, 0x08, 0x80, 0x81, 0x70, 0x04, 0x80,
+    0x00, 0x88, 0x08, 0xfb, 0x0c, 0x88, 0x00, 0x18, 0x08, 0x56, 0x80, 0x00, 0x08, 0x88, 0xb0, 0xbf,
+    0x08, 0x08, 0x08, 0x80, 0x71, 0x05, 0x80, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x00, 0x08, 0x08, 0x08,
+    0x57, 0x81, 0x08, 0x08, 0x88, 0xb1, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x70, 0x15, 0x88, 0x80, 0x80,
+    0x08, 0xfa, 0x8b, 0x80, 0x08, 0x00, 0x80, 0x57, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xbf, 0x08, 0x08,
+    0x08, 0x80, 0x60, 0x16, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x8b, 0x08, 0x08, 0x18, 0x08, 0x66, 0x81,
+    0x80, 0x08, 0x88, 0x90, 0xbf, 0x09, 0x80, 0x80, 0x81, 0x60, 0x16, 0x08, 0x88, 0x00, 0x09, 0xf9,
+    0xe0, 0xfd, 0x49, 0x00, 0x8b, 0x08, 0x08, 0x18, 0x08, 0x56, 0x82, 0x08, 0x80, 0x88, 0xa0, 0xdf,
+    0x08, 0x08, 0x80, 0x00, 0x48, 0x26, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x8c, 0x80, 0x08, 0x08, 0x80,
+    0x65, 0x81, 0x00, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08, 0x08, 0x00, 0x38, 0x37, 0x08, 0x80, 0x08,
+    0x09, 0xf9, 0x8d, 0x80, 0x08, 0x18, 0x90, 0x64, 0x82, 0x00, 0x88, 0x90, 0x80, 0xcf, 0x09, 0x80,
+    0x80, 0x00, 0x38, 0x47, 0x08, 0x08, 0x08, 0x09, 0xe8, 0x8d, 0x80, 0x08, 0x08, 0x80, 0x73, 0x03,
+    0x08, 0x08, 0x88, 0x90, 0xcf, 0x09, 0x88, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x80, 0x08, 0xf8,
+    0x9d, 0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0x08, 0x88, 0x80, 0xdf, 0x88, 0x80, 0x80, 0x00,
+    0x38, 0x37, 0x80, 0x80, 0x08, 0x88, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x81, 0x72, 0x03, 0x08, 0x88,
+    0x80, 0x88, 0xcf, 0x89, 0x45, 0xdf, 0x45, 0x00, 0x80, 0x80, 0x10, 0x28, 0x57, 0x80, 0x80, 0x08,
+    0x88, 0xc8, 0x9e, 0x80, 0x08, 0x08, 0x81, 0x72, 0x04, 0x08, 0x88, 0x80, 0x88, 0xdd, 0x0a, 0x08,
+    0x80, 0x00, 0x38, 0x57, 0x80, 0x80, 0x80, 0x88, 0xd0, 0xad, 0x00, 0x08, 0x08, 0x00, 0x71, 0x04,
+    0x08, 0x80, 0x80, 0x88, 0xfc, 0x89, 0x80, 0x80, 0x00, 0x18, 0x47, 0x80, 0x80, 0x08, 0x88, 0xc0,
+    0x9f, 0x80, 0x80, 0x80, 0x00, 0x61, 0x04, 0x08, 0x08, 0x88, 0x08, 0xfc, 0x89, 0x80, 0x80, 0x00,
+    0x18, 0x37, 0x81, 0x08, 0x08, 0x88, 0xd0, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x61, 0x14, 0x88, 0x80,
+    0x80, 0x08, 0xfc, 0x0a, 0x88, 0x00, 0x08, 0x00, 0x47, 0x80, 0x00, 0x08, 0x88, 0xc0, 0x9f, 0x08,
+    0x88, 0x00, 0x80, 0x70, 0x13, 0x08, 0x80, 0x08, 0x88, 0xfc, 0x0b, 0x88, 0x00, 0x18, 0x18, 0x47,
+    0x81, 0x00, 0x88, 0x08, 0xb8, 0xcf, 0x88, 0x00, 0x20, 0xe5, 0x43, 0x00, 0x08, 0x80, 0x61, 0x15,
+    0x08, 0x88, 0x80, 0x08, 0xfb, 0x8b, 0x88, 0x00, 0x08, 0x10, 0x57, 0x81, 0x80, 0x80, 0x80, 0xb8,
+    0xbf, 0x88, 0x08, 0x80, 0x00, 0x71, 0x15, 0x08, 0x08, 0x08, 0x09, 0xfb, 0x8b, 0x88, 0x00, 0x18,
+    0x18, 0x57, 0x81, 0x80, 0x80, 0x88, 0xa0, 0xcf, 0x08, 0x08, 0x80, 0x00, 0x68, 0x14, 0x80, 0x80,
+    0x80, 0x08, 0xfa, 0x8d, 0x80, 0x00, 0x08, 0x08, 0x55, 0x81, 0x00, 0x88, 0x80, 0xb0, 0xcf, 0x08,
+    0x08, 0x80, 0x80, 0x50, 0x16, 0x08, 0x08, 0x08, 0x08, 0xfa, 0x8b, 0x08, 0x80, 0x08, 0x80, 0x66,
+    0x81, 0x80, 0x80, 0x80, 0xa0, 0xbf, 0x08, 0x88, 0x80, 0x00, 0x50, 0x17, 0x80, 0x80, 0x80, 0x08,
+    0xea, 0x9c, 0x00, 0x08, 0x08, 0x00, 0x74, 0x02, 0x08, 0x88, 0x80, 0x98, 0xbf, 0x89, 0x08, 0x80,
+    0x00, 0x58, 0x27, 0x80, 0x80, 0x80, 0x80, 0xf9, 0x8c, 0x08, 0x08, 0x08, 0xa6, 0xe4, 0x41, 0x00,
+    0x80, 0x64, 0x02, 0x08, 0x08, 0x08, 0x98, 0xcf, 0x09, 0x08, 0x80, 0x80, 0x30, 0x47, 0x80, 0x80,
+    0x08, 0x08, 0xf8, 0x9c, 0x80, 0x00, 0x80, 0x80, 0x73, 0x03, 0x80, 0x88, 0x80, 0x80, 0xdf, 0x09,
+    0x08, 0x80, 0x80, 0x38, 0x47, 0x80, 0x08, 0x88, 0x80, 0xe8, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x73,
+    0x04, 0x08, 0x88, 0x80, 0x88, 0xde, 0x09, 0x80, 0x00, 0x08, 0x38, 0x37, 0x00, 0x88, 0x08, 0x08,
+    0xf9, 0xac, 0x80, 0x00, 0x08, 0x00, 0x73, 0x05, 0x08, 0x88, 0x80, 0x88, 0xdd, 0x0a, 0x80, 0x00,
+    0x80, 0x20, 0x47, 0x00, 0x08, 0x88, 0x08, 0xe8, 0x9d, 0x80, 0x80, 0x00, 0x80, 0x72, 0x13, 0x08,
+    0x88, 0x80, 0x88, 0xee, 0x89, 0x80, 0x80, 0x00, 0x28, 0x47, 0x80, 0x80, 0x08, 0x08, 0xc8, 0x9f,
+    0x08, 0x08, 0x08, 0x80, 0x62, 0x04, 0x80, 0x80, 0x80, 0x88, 0xfc, 0x0a, 0x08, 0x08, 0x18, 0x18,
+    0xa4, 0xeb, 0x3e, 0x00, 0x37, 0x81, 0x80, 0x80, 0x08, 0xd8, 0xaf, 0x80, 0x80, 0x00, 0x80, 0x71,
+    0x13, 0x08, 0x08, 0x88, 0x80, 0xfc, 0x8b, 0x80, 0x80, 0x00, 0x18, 0x57, 0x81, 0x80, 0x08, 0x88,
+    0xb0, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x71, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x8b, 0x80, 0x80,
+    0x00, 0x18, 0x57, 0x81, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x70, 0x15, 0x08,
+    0x80, 0x08, 0x88, 0xfb, 0x8b, 0x80, 0x08, 0x18, 0x18, 0x57, 0x81, 0x80, 0x08, 0x80, 0xb8, 0xbf,
+    0x88, 0x80, 0x80, 0x00, 0x71, 0x15, 0x08, 0x88, 0x00, 0x88, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x18,
+    0x55, 0x01, 0x80, 0x08, 0x88, 0xb0, 0xdf, 0x08, 0x08, 0x80, 0x80, 0x50, 0x15, 0x80, 0x80, 0x80,
+    0x08, 0xfa, 0x8c, 0x80, 0x80, 0x08, 0x00, 0x65, 0x81, 0x80, 0x80, 0x80, 0x98, 0xbf, 0x09, 0x08,
+    0x80, 0x00, 0x60, 0x25, 0x7f, 0x1e, 0x46, 0x00, 0x08, 0x88, 0x00, 0x09, 0xfa, 0x9c, 0x80, 0x00,
+    0x08, 0x80, 0x56, 0x01, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x88, 0x80, 0x80, 0x00, 0x48, 0x17, 0x00,
+    0x88, 0x00, 0x09, 0xf9, 0x8b, 0x88, 0x00, 0x08, 0x80, 0x75, 0x01, 0x80, 0x08, 0x88, 0x90, 0xbf,
+    0x88, 0x08, 0x80, 0x00, 0x58, 0x17, 0x00, 0x88, 0x00, 0x09, 0xf8, 0x9b, 0x80, 0x08, 0x08, 0x80,
+    0x75, 0x01, 0x80, 0x80, 0x80, 0x88, 0xbf, 0x09, 0x88, 0x80, 0x00, 0x40, 0x37, 0x08, 0x80, 0x08,
+    0x88, 0xf8, 0x8d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x83, 0x00, 0x88, 0x80, 0x88, 0xdf, 0x08, 0x88,
+    0x80, 0x00, 0x38, 0x37, 0x08, 0x80, 0x08, 0x09, 0xf8, 0x9c, 0x08, 0x08, 0x80, 0x81, 0x73, 0x04,
+    0x08, 0x88, 0x80, 0x88, 0xde, 0x09, 0x08, 0x80, 0x00, 0x38, 0x47, 0x08, 0x08, 0x88, 0x08, 0xd8,
+    0x9e, 0x00, 0x08, 0x08, 0x80, 0x72, 0x03, 0x08, 0xb4, 0x1c, 0x43, 0x00, 0x88, 0x80, 0x80, 0xcf,
+    0x89, 0x80, 0x00, 0x08, 0x38, 0x47, 0x80, 0x80, 0x80, 0x08, 0xe8, 0x9d, 0x80, 0x00, 0x08, 0x80,
+    0x72, 0x13, 0x88, 0x80, 0x90, 0x80, 0xee, 0x09, 0x08, 0x08, 0x08, 0x28, 0x37, 0x81, 0x08, 0x08,
+    0x88, 0xe0, 0x9e, 0x08, 0x08, 0x08, 0x80, 0x72, 0x13, 0x08, 0x88, 0x80, 0x08, 0xdf, 0x09, 0x08,
+    0x08, 0x08, 0x28, 0x47, 0x80, 0x08, 0x08, 0x08, 0xc8, 0x9f, 0x80, 0x08, 0x80, 0x80, 0x71, 0x03,
+    0x08, 0x80, 0x80, 0x08, 0xfd, 0x89, 0x00, 0x88, 0x00, 0x18, 0x37, 0x00, 0x88, 0x00, 0x88, 0xd0,
+    0x9f, 0x08, 0x08, 0x80, 0x80, 0x71, 0x03, 0x80, 0x08, 0x90, 0x00, 0xed, 0x8a, 0x00, 0x08, 0x08,
+    0x00, 0x47, 0x81, 0x08, 0x08, 0x88, 0xb0, 0xcf, 0x80, 0x80, 0x80, 0x00, 0x70, 0x13, 0x08, 0x08,
+    0x88, 0x18, 0xfc, 0x8b, 0x80, 0x00, 0x08, 0x18, 0x57, 0x81, 0x88, 0x80, 0x63, 0x17, 0x42, 0x00,
+    0x80, 0xb0, 0xbf, 0x08, 0x08, 0x80, 0x80, 0x71, 0x15, 0x88, 0x80, 0x08, 0x08, 0xfa, 0x0c, 0x08,
+    0x08, 0x80, 0x08, 0x46, 0x81, 0x80, 0x80, 0x80, 0xb0, 0xcf, 0x08, 0x08, 0x80, 0x80, 0x60, 0x15,
+    0x88, 0x80, 0x80, 0x08, 0xfa, 0x8b, 0x80, 0x08, 0x18, 0x08, 0x57, 0x81, 0x08, 0x08, 0x88, 0xa0,
+    0xbf, 0x08, 0x88, 0x80, 0x81, 0x70, 0x15, 0x88, 0x80, 0x80, 0x08, 0xf9, 0x8c, 0x80, 0x00, 0x08,
+    0x08, 0x55, 0x01, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x88, 0x00, 0x08, 0x50, 0x16, 0x08, 0x08,
+    0x08, 0x08, 0xfa, 0x8c, 0x00, 0x08, 0x08, 0x80, 0x74, 0x81, 0x80, 0x80, 0x80, 0xa0, 0xbf, 0x08,
+    0x08, 0x80, 0x00, 0x58, 0x17, 0x08, 0x08, 0x88, 0x00, 0xea, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x55,
+    0x02, 0x88, 0x08, 0x88, 0x90, 0xdf, 0x88, 0x80, 0x00, 0x80, 0x30, 0x37, 0x08, 0x90, 0x80, 0x08,
+    0x98, 0x17, 0x3d, 0x00, 0xf9, 0x8d, 0x08, 0x08, 0x00, 0x88, 0x64, 0x02, 0x08, 0x88, 0x90, 0x80,
+    0xcf, 0x09, 0x08, 0x80, 0x00, 0x48, 0x27, 0x08, 0x88, 0x80, 0x08, 0xf8, 0x8c, 0x80, 0x08, 0x80,
+    0x81, 0x73, 0x03, 0x08, 0x09, 0x90, 0x90, 0xdf, 0x88, 0x80, 0x00, 0x08, 0x20, 0x37, 0x80, 0x80,
+    0x08, 0x88, 0xf8, 0x9d, 0x00, 0x08, 0x08, 0x00, 0x72, 0x03, 0x08, 0x08, 0x88, 0x88, 0xdf, 0x09,
+    0x80, 0x80, 0x00, 0x20, 0x47, 0x08, 0x88, 0x80, 0x08, 0xe8, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x73,
+    0x04, 0x08, 0x88, 0x80, 0x88, 0xde, 0x09, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x00, 0x08, 0x09,
+    0xf9, 0x9d, 0x80, 0x00, 0x08, 0x80, 0x72, 0x04, 0x08, 0x88, 0x80, 0x88, 0xfc, 0x09, 0x08, 0x80,
+    0x08, 0x10, 0x37, 0x80, 0x80, 0x08, 0x80, 0xe8, 0xad, 0x00, 0x08, 0x80, 0x80, 0x72, 0x14, 0x88,
+    0x08, 0x08, 0x08, 0xde, 0xac, 0xee, 0x48, 0x00, 0x89, 0x00, 0x80, 0x08, 0x28, 0x47, 0x80, 0x80,
+    0x08, 0x88, 0xd0, 0xad, 0x00, 0x08, 0x80, 0x00, 0x71, 0x04, 0x80, 0x80, 0x88, 0x08, 0xfc, 0x0a,
+    0x80, 0x80, 0x00, 0x18, 0x47, 0x80, 0x80, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x00, 0x08, 0x88, 0x71,
+    0x15, 0x88, 0x80, 0x08, 0x08, 0xec, 0x0a, 0x08, 0x08, 0x08, 0x10, 0x47, 0x00, 0x08, 0x08, 0x88,
+    0xb0, 0xaf, 0x08, 0x80, 0x80, 0x80, 0x71, 0x14, 0x88, 0x08, 0x80, 0x88, 0xfb, 0x0c, 0x08, 0x80,
+    0x08, 0x00, 0x46, 0x01, 0x88, 0x08, 0x08, 0xb8, 0xcf, 0x08, 0x08, 0x08, 0x80, 0x61, 0x15, 0x88,
+    0x08, 0x08, 0x88, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x00, 0x57, 0x81, 0x08, 0x08, 0x88, 0xb0, 0xbf,
+    0x08, 0x08, 0x88, 0x81, 0x61, 0x16, 0x08, 0x08, 0x08, 0x88, 0xfa, 0x8b, 0x08, 0x08, 0x08, 0x00,
+    0x57, 0x81, 0x08, 0x08, 0x80, 0xa8, 0xbf, 0x09, 0x87, 0xeb, 0x40, 0x00, 0x80, 0x80, 0x80, 0x71,
+    0x15, 0x08, 0x08, 0x08, 0x88, 0xfa, 0x8b, 0x88, 0x80, 0x00, 0x00, 0x47, 0x82, 0x00, 0x88, 0x80,
+    0xb8, 0xdf, 0x08, 0x08, 0x88, 0x00, 0x50, 0x25, 0x88, 0x80, 0x00, 0x88, 0xfa, 0x8c, 0x08, 0x08,
+    0x08, 0x00, 0x74, 0x82, 0x08, 0x80, 0x90, 0x90, 0xcf, 0x08, 0x88, 0x80, 0x00, 0x40, 0x17, 0x80,
+    0x80, 0x08, 0x88, 0xf8, 0x9b, 0x00, 0x08, 0x08, 0x00, 0x74, 0x83, 0x08, 0x08, 0x90, 0x98, 0xcf,
+    0x09, 0x80, 0x80, 0x00, 0x48, 0x27, 0x08, 0x80, 0x80, 0x88, 0xf8, 0x8c, 0x80, 0x08, 0x08, 0x80,
+    0x73, 0x84, 0x00, 0x88, 0x80, 0x88, 0xce, 0x09, 0x88, 0x80, 0x00, 0x48, 0x27, 0x80, 0x00, 0x88,
+    0x80, 0xf8, 0x9c, 0x80, 0x00, 0x88, 0x80, 0x64, 0x83, 0x00, 0x88, 0x80, 0x90, 0xcf, 0x89, 0x80,
+    0x80, 0x18, 0x38, 0x47, 0x00, 0x08, 0x08, 0x88, 0xe8, 0x9d, 0x80, 0x80, 0x38, 0xea, 0x40, 0x00,
+    0x08, 0x80, 0x73, 0x04, 0x08, 0x08, 0x88, 0x80, 0xce, 0x89, 0x80, 0x80, 0x18, 0x28, 0x57, 0x80,
+    0x80, 0x08, 0x08, 0xd8, 0x9d, 0x80, 0x08, 0x80, 0x80, 0x73, 0x04, 0x08, 0x88, 0x80, 0x80, 0xed,
+    0x09, 0x08, 0x80, 0x08, 0x28, 0x37, 0x80, 0x00, 0x08, 0x88, 0xd8, 0x9f, 0x08, 0x08, 0x08, 0x80,
+    0x72, 0x03, 0x08, 0x08, 0x80, 0x08, 0xde, 0x0a, 0x08, 0x88, 0x00, 0x28, 0x47, 0x00, 0x80, 0x18,
+    0x88, 0xc8, 0xaf, 0x80, 0x80, 0x08, 0x80, 0x71, 0x04, 0x08, 0x80, 0x80, 0x08, 0xfc, 0x89, 0x80,
+    0x80, 0x18, 0x08, 0x37, 0x81, 0x80, 0x18, 0x88, 0xd0, 0xae, 0x08, 0x08, 0x88, 0x00, 0x70, 0x05,
+    0x08, 0x80, 0x80, 0x08, 0xfb, 0x8a, 0x08, 0x08, 0x08, 0x18, 0x57, 0x80, 0x00, 0x88, 0x80, 0xb0,
+    0xbf, 0x00, 0x88, 0x80, 0x80, 0x71, 0x14, 0x08, 0x08, 0x08, 0x08, 0xfc, 0x0a, 0x88, 0x00, 0x08,
+    0x11, 0xed, 0x3d, 0x00, 0x18, 0x46, 0x01, 0x08, 0x08, 0x88, 0xb0, 0xdf, 0x08, 0x08, 0x80, 0x80,
+    0x60, 0x14, 0x08, 0x80, 0x08, 0x88, 0xfa, 0x8c, 0x80, 0x08, 0x00, 0x08, 0x56, 0x81, 0x08, 0x08,
+    0x08, 0xa8, 0xbf, 0x88, 0x80, 0x80, 0x00, 0x78, 0x15, 0x08, 0x08, 0x08, 0x08, 0xfa, 0x8c, 0x80,
+    0x00, 0x08, 0x80, 0x55, 0x82, 0x08, 0x08, 0x88, 0xa0, 0xdf, 0x08, 0x80, 0x80, 0x00, 0x58, 0x15,
+    0x08, 0x88, 0x00, 0x88, 0xf9, 0x8c, 0x80, 0x00, 0x08, 0x08, 0x55, 0x01, 0x08, 0x08, 0x88, 0x90,
+    0xdf, 0x08, 0x08, 0x80, 0x80, 0x40, 0x16, 0x08, 0x80, 0x08, 0x08, 0xfa, 0x9b, 0x80, 0x00, 0x08,
+    0x80, 0x66, 0x01, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x80, 0x48, 0x17, 0x80, 0x80,
+    0x80, 0x08, 0xe9, 0x8c, 0x80, 0x08, 0x08, 0x80, 0x74, 0x82, 0x80, 0x08, 0x80, 0x90, 0xcf, 0x08,
+    0x88, 0x00, 0x08, 0x48, 0x22, 0xf6, 0x3e, 0x00, 0x26, 0x08, 0x80, 0x08, 0x08, 0xf9, 0x8c, 0x08,
+    0x08, 0x88, 0x00, 0x73, 0x84, 0x00, 0x88, 0x80, 0x90, 0xce, 0x09, 0x88, 0x80, 0x00, 0x38, 0x57,
+    0x08, 0x80, 0x80, 0x08, 0xe8, 0x9c, 0x80, 0x00, 0x88, 0x91, 0x73, 0x04, 0x08, 0x08, 0x88, 0x80,
+    0xcf, 0x08, 0x88, 0x80, 0x00, 0x38, 0x37, 0x80, 0x80, 0x08, 0x08, 0xf8, 0x9d, 0x80, 0x00, 0x08,
+    0x80, 0x72, 0x03, 0x00, 0x09, 0x90, 0x80, 0xdf, 0x09, 0x08, 0x80, 0x00, 0x28, 0x37, 0x00, 0x90,
+    0x80, 0x08, 0xf8, 0x9d, 0x80, 0x00, 0x08, 0x80, 0x72, 0x03, 0x00, 0x98, 0x80, 0x80, 0xdf, 0x09,
+    0x08, 0x80, 0x00, 0x28, 0x37, 0x00, 0x80, 0x88, 0x88, 0xf0, 0xac, 0x80, 0x00, 0x08, 0x80, 0x72,
+    0x05, 0x08, 0x08, 0x88, 0x08, 0xec, 0x0a, 0x08, 0x80, 0x00, 0x10, 0x47, 0x80, 0x00, 0x88, 0x88,
+    0xc0, 0xaf, 0x80, 0x00, 0x08, 0x00, 0x71, 0x13, 0xa8, 0x16, 0x41, 0x00, 0x08, 0x88, 0x80, 0x09,
+    0xfd, 0x0a, 0x80, 0x80, 0x18, 0x18, 0x37, 0x81, 0x00, 0x08, 0x98, 0xd0, 0xaf, 0x80, 0x80, 0x80,
+    0x81, 0x71, 0x13, 0x08, 0x80, 0x90, 0x08, 0xfd, 0x0a, 0x88, 0x00, 0x18, 0x18, 0x37, 0x81, 0x81,
+    0x08, 0x98, 0xc0, 0xbf, 0x08, 0x09, 0x80, 0x81, 0x71, 0x05, 0x00, 0x08, 0x08, 0x88, 0xfb, 0x8b,
+    0x80, 0x80, 0x18, 0x18, 0x57, 0x00, 0x80, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x70,
+    0x15, 0x08, 0x08, 0x08, 0x08, 0xfb, 0x0c, 0x88, 0x00, 0x08, 0x18, 0x65, 0x00, 0x80, 0x08, 0x88,
+    0xa0, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x71, 0x14, 0x08, 0x80, 0x08, 0x88, 0xfb, 0x8c, 0x80, 0x80,
+    0x00, 0x08, 0x47, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x80, 0x80, 0x80, 0x60, 0x14, 0x08,
+    0x80, 0x80, 0x08, 0xfa, 0x0d, 0x88, 0x00, 0x08, 0x08, 0x55, 0x81, 0x80, 0xc3, 0x13, 0x41, 0x00,
+    0x80, 0x80, 0xb0, 0xbf, 0x09, 0x08, 0x80, 0x80, 0x70, 0x15, 0x80, 0x80, 0x80, 0x08, 0xfa, 0x8c,
+    0x80, 0x80, 0x80, 0x00, 0x74, 0x01, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x09, 0x08, 0x80, 0x00, 0x68,
+    0x25, 0x08, 0x80, 0x08, 0x09, 0xf9, 0x9c, 0x80, 0x00, 0x08, 0x80, 0x65, 0x01, 0x80, 0x08, 0x88,
+    0xa0, 0xbf, 0x09, 0x88, 0x00, 0x00, 0x50, 0x27, 0x08, 0x08, 0x88, 0x08, 0xf9, 0x8c, 0x80, 0x08,
+    0x18, 0x80, 0x64, 0x02, 0x08, 0x08, 0x98, 0x90, 0xcf, 0x09, 0x88, 0x00, 0x00, 0x48, 0x27, 0x80,
+    0x80, 0x80, 0x88, 0xf8, 0x9c, 0x80, 0x00, 0x08, 0x00, 0x73, 0x03, 0x80, 0x80, 0x88, 0x98, 0xdf,
+    0x09, 0x08, 0x80, 0x00, 0x30, 0x37, 0x80, 0x80, 0x80, 0x88, 0xf9, 0x9d, 0x80, 0x00, 0x08, 0x00,
+    0x72, 0x03, 0x00, 0x88, 0x90, 0x88, 0xdf, 0x09, 0x08, 0x08, 0x00, 0x38, 0x37, 0x00, 0x80, 0x08,
+    0xfe, 0x15, 0x3c, 0x00, 0x89, 0xf8, 0x9d, 0x80, 0x08, 0x00, 0x00, 0x72, 0x03, 0x00, 0x88, 0x90,
+    0x88, 0xcf, 0x0a, 0x88, 0x00, 0x00, 0x20, 0x57, 0x80, 0x00, 0x08, 0x89, 0xd0, 0xad, 0x80, 0x08,
+    0x00, 0x00, 0x72, 0x04, 0x00, 0x88, 0x90, 0x88, 0xed, 0x89, 0x80, 0x80, 0x10, 0x28, 0x47, 0x80,
+    0x80, 0x80, 0x88, 0xd8, 0x9d, 0x08, 0x08, 0x08, 0x00, 0x72, 0x04, 0x80, 0x80, 0x80, 0x88, 0xde,
+    0x09, 0x88, 0x80, 0x00, 0x20, 0x37, 0x81, 0x00, 0x88, 0x88, 0xe8, 0x9e, 0x88, 0x00, 0x08, 0x00,
+    0x71, 0x04, 0x08, 0x80, 0x88, 0x08, 0xdd, 0x0a, 0x88, 0x00, 0x18, 0x28, 0x47, 0x81, 0x80, 0x08,
+    0x88, 0xd0, 0xae, 0x80, 0x08, 0x00, 0x80, 0x71, 0x04, 0x00, 0x88, 0x80, 0x88, 0xfc, 0x89, 0x80,
+    0x80, 0x00, 0x18, 0x37, 0x81, 0x80, 0x08, 0x88, 0xd0, 0xae, 0x08, 0x88, 0x00, 0x80, 0x71, 0x05,
+    0x80, 0x80, 0x80, 0x88, 0xb2, 0x12, 0x3d, 0x00, 0xfb, 0x0b, 0x88, 0x00, 0x18, 0x18, 0x57, 0x00,
+    0x08, 0x08, 0x88, 0xb8, 0xbf, 0x80, 0x08, 0x80, 0x01, 0x70, 0x14, 0x80, 0x80, 0x90, 0x08, 0xfb,
+    0x8c, 0x80, 0x08, 0x00, 0x18, 0x56, 0x81, 0x80, 0x08, 0x88, 0xb0, 0xcf, 0x80, 0x08, 0x80, 0x00,
+    0x60, 0x14, 0x08, 0x80, 0x80, 0x88, 0xfb, 0x8c, 0x80, 0x80, 0x00, 0x18, 0x46, 0x82, 0x80, 0x08,
+    0x88, 0xb0, 0xdf, 0x08, 0x08, 0x08, 0x80, 0x50, 0x15, 0x00, 0x88, 0x80, 0x88, 0xfa, 0x8c, 0x08,
+    0x08, 0x00, 0x08, 0x56, 0x81, 0x00, 0x88, 0x88, 0xa0, 0xbf, 0x09, 0x08, 0x80, 0x00, 0x60, 0x16,
+    0x80, 0x80, 0x80, 0x08, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x55, 0x01, 0x80, 0x08, 0x88, 0xa0,
+    0xcf, 0x88, 0x80, 0x80, 0x00, 0x50, 0x16, 0x08, 0x80, 0x08, 0x88, 0xf9, 0x9b, 0x80, 0x00, 0x08,
+    0x80, 0x75, 0x82, 0x80, 0x80, 0x90, 0x80, 0xcf, 0x7d, 0xee, 0x45, 0x00, 0x08, 0x88, 0x80, 0x00,
+    0x30, 0x37, 0x08, 0x80, 0x80, 0x88, 0xf9, 0x8d, 0x80, 0x88, 0x00, 0x80, 0x64, 0x82, 0x00, 0x80,
+    0x80, 0xa8, 0xcf, 0x88, 0x08, 0x08, 0x08, 0x30, 0x17, 0x80, 0x00, 0x08, 0x88, 0xe9, 0x9c, 0x91,
+    0x18, 0x08, 0x00, 0x74, 0x82, 0x00, 0x80, 0x88, 0x88, 0xcf, 0x88, 0x08, 0x08, 0x00, 0x30, 0x37,
+    0x00, 0x80, 0x08, 0x88, 0xf9, 0x9d, 0x80, 0x00, 0x08, 0x80, 0x73, 0x03, 0x00, 0x88, 0x80, 0x88,
+    0xdf, 0x09, 0x88, 0x81, 0x08, 0x30, 0x37, 0x00, 0x88, 0x00, 0x88, 0xf9, 0x9d, 0x80, 0x00, 0x88,
+    0x81, 0x73, 0x03, 0x00, 0x88, 0x80, 0x98, 0xcf, 0x0a, 0x08, 0x80, 0x18, 0x38, 0x57, 0x80, 0x80,
+    0x00, 0x88, 0xd8, 0x9d, 0x08, 0x08, 0x08, 0x80, 0x72, 0x04, 0x80, 0x80, 0x80, 0x88, 0xed, 0x09,
+    0x88, 0x00, 0x08, 0x10, 0x47, 0x80, 0x80, 0x08, 0x08, 0xd8, 0xad, 0x80, 0x08, 0xf0, 0x3d, 0x00,
+    0x00, 0x08, 0x80, 0x72, 0x14, 0x08, 0x88, 0x08, 0x88, 0xed, 0x89, 0x80, 0x00, 0x18, 0x18, 0x37,
+    0x81, 0x00, 0x09, 0x88, 0xd8, 0xaf, 0x80, 0x00, 0x08, 0x80, 0x71, 0x04, 0x18, 0x88, 0x88, 0x08,
+    0xec, 0x8a, 0x80, 0x00, 0x18, 0x18, 0x47, 0x81, 0x80, 0x08, 0x88, 0xc0, 0xaf, 0x80, 0x08, 0x80,
+    0x00, 0x70, 0x13, 0x00, 0x88, 0x80, 0x08, 0xfc, 0x8b, 0x80, 0x80, 0x08, 0x10, 0x57, 0x00, 0x80,
+    0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x08, 0x80, 0x71, 0x15, 0x08, 0x88, 0x80, 0x08, 0xfb, 0x8b,
+    0x08, 0x80, 0x18, 0x18, 0x47, 0x01, 0x80, 0x08, 0x90, 0xb0, 0xdf, 0x08, 0x08, 0x08, 0x80, 0x50,
+    0x15, 0x80, 0x80, 0x00, 0x09, 0xfa, 0x8c, 0x80, 0x08, 0x08, 0x00, 0x65, 0x81, 0x80, 0x00, 0x88,
+    0xa8, 0xbf, 0x08, 0x88, 0x80, 0x81, 0x70, 0x24, 0x08, 0x88, 0x80, 0x08, 0xfa, 0x8d, 0x80, 0x00,
+    0x54, 0xf4, 0x3c, 0x00, 0x08, 0x08, 0x74, 0x81, 0x80, 0x08, 0x80, 0xa0, 0xbf, 0x08, 0x08, 0x80,
+    0x80, 0x50, 0x17, 0x08, 0x80, 0x08, 0x88, 0xf9, 0x8b, 0x80, 0x00, 0x08, 0x80, 0x56, 0x01, 0x08,
+    0x08, 0x88, 0xa0, 0xcf, 0x08, 0x88, 0x80, 0x00, 0x40, 0x17, 0x00, 0x88, 0x00, 0x09, 0xf9, 0x8c,
+    0x80, 0x00, 0x88, 0x00, 0x74, 0x81, 0x00, 0x88, 0x80, 0x98, 0xce, 0x08, 0x88, 0x80, 0x00, 0x50,
+    0x16, 0x80, 0x80, 0x80, 0x88, 0xf9, 0x9b, 0x80, 0x00, 0x88, 0x81, 0x75, 0x02, 0x88, 0x80, 0x80,
+    0x98, 0xbf, 0x89, 0x00, 0x88, 0x00, 0x50, 0x27, 0x08, 0x08, 0x08, 0x88, 0xf8, 0x8c, 0x08, 0x08,
+    0x08, 0x00, 0x73, 0x03, 0x08, 0x88, 0x80, 0x88, 0xdf, 0x09, 0x08, 0x80, 0x18, 0x38, 0x37, 0x80,
+    0x80, 0x00, 0x89, 0xf8, 0x9d, 0x80, 0x00, 0x08, 0x80, 0x73, 0x03, 0x08, 0x08, 0x90, 0x88, 0xdf,
+    0x88, 0x80, 0x80, 0x00, 0xfd, 0xf3, 0x39, 0x00, 0x38, 0x37, 0x80, 0x80, 0x08, 0x88, 0xf8, 0x9c,
+    0x88, 0x00, 0x08, 0x00, 0x72, 0x05, 0x08, 0x88, 0x80, 0x08, 0xce, 0x09, 0x88, 0x81, 0x18, 0x28,
+    0x47, 0x80, 0x80, 0x80, 0x08, 0xe8, 0x9c, 0x88, 0x00, 0x08, 0x80, 0x73, 0x04, 0x00, 0x88, 0x80,
+    0x88, 0xde, 0x09, 0x88, 0x80, 0x00, 0x20, 0x47, 0x80, 0x80, 0x80, 0x88, 0xd0, 0x9e, 0x80, 0x08,
+    0x80, 0x00, 0x71, 0x13, 0x08, 0x88, 0x80, 0x88, 0xde, 0x0a, 0x88, 0x00, 0x08, 0x20, 0x57, 0x80,
+    0x00, 0x88, 0x08, 0xc8, 0xae, 0x80, 0x08, 0x80, 0x81, 0x71, 0x14, 0x08, 0x88, 0x80, 0x08, 0xed,
+    0x89, 0x80, 0x80, 0x18, 0x18, 0x47, 0x80, 0x00, 0x08, 0x98, 0xc0, 0xae, 0x80, 0x08, 0x08, 0x00,
+    0x71, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc, 0x0a, 0x88, 0x00, 0x08, 0x00, 0x47, 0x00, 0x08, 0x08,
+    0x88, 0xb8, 0xbf, 0x08, 0x08, 0x80, 0x00, 0x70, 0xb3, 0xfc, 0x3d, 0x00, 0x15, 0x08, 0x88, 0x80,
+    0x08, 0xfb, 0x8b, 0x80, 0x00, 0x08, 0x18, 0x57, 0x00, 0x80, 0x08, 0x08, 0xb8, 0xbf, 0x08, 0x08,
+    0x80, 0x08, 0x70, 0x15, 0x08, 0x88, 0x00, 0x08, 0xfb, 0x0c, 0x08, 0x08, 0x08, 0x18, 0x55, 0x01,
+    0x88, 0x00, 0x88, 0xb0, 0xcf, 0x08, 0x08, 0x88, 0x81, 0x60, 0x15, 0x08, 0x88, 0x80, 0x80, 0xfa,
+    0x8b, 0x88, 0x00, 0x08, 0x00, 0x57, 0x81, 0x80, 0x08, 0x80, 0xa8, 0xbf, 0x88, 0x08, 0x80, 0x00,
+    0x70, 0x15, 0x08, 0x88, 0x00, 0x88, 0xfa, 0x8c, 0x80, 0x00, 0x08, 0x00, 0x55, 0x01, 0x08, 0x88,
+    0x80, 0xa0, 0xdf, 0x08, 0x08, 0x80, 0x00, 0x48, 0x17, 0x08, 0x88, 0x80, 0x08, 0xf9, 0x9a, 0x80,
+    0x00, 0x80, 0x80, 0x65, 0x82, 0x08, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x08, 0x40, 0x26,
+    0x08, 0x90, 0x00, 0x09, 0xf9, 0x8c, 0x88, 0x00, 0x08, 0x00, 0x73, 0x84, 0x19, 0x0d, 0x3f, 0x00,
+    0x80, 0x08, 0x90, 0x90, 0xde, 0x08, 0x08, 0x08, 0x18, 0x38, 0x37, 0x08, 0x80, 0x08, 0x09, 0xf9,
+    0x8d, 0x08, 0x08, 0x08, 0x00, 0x73, 0x03, 0x88, 0x08, 0x80, 0x98, 0xdf, 0x88, 0x80, 0x00, 0x08,
+    0x48, 0x26, 0x80, 0x80, 0x08, 0x88, 0xf8, 0x8d, 0x80, 0x00, 0x88, 0x00, 0x72, 0x83, 0x08, 0x08,
+    0x90, 0x80, 0xcf, 0x09, 0x08, 0x80, 0x00, 0x38, 0x47, 0x80, 0x08, 0x08, 0x09, 0xe8, 0x9d, 0x00,
+    0x08, 0x80, 0x00, 0x72, 0x03, 0x08, 0x08, 0x88, 0x88, 0xdf, 0x09, 0x80, 0x80, 0x10, 0x28, 0x37,
+    0x80, 0x80, 0x80, 0x88, 0xf8, 0xac, 0x00, 0x08, 0x08, 0x81, 0x72, 0x05, 0x08, 0x88, 0x80, 0x88,
+    0xec, 0x89, 0x80, 0x80, 0x10, 0x18, 0x47, 0x80, 0x80, 0x80, 0x88, 0xd0, 0xad, 0x80, 0x00, 0x08,
+    0x80, 0x72, 0x05, 0x08, 0x88, 0x80, 0x08, 0xec, 0x89, 0x80, 0x80, 0x18, 0x28, 0x47, 0x80, 0x80,
+    0xf0, 0x0c, 0x3c, 0x00, 0x08, 0x88, 0xc0, 0x9f, 0x08, 0x08, 0x08, 0x80, 0x71, 0x03, 0x00, 0x88,
+    0x80, 0x08, 0xfd, 0x89, 0x80, 0x80, 0x00, 0x18, 0x37, 0x80, 0x00, 0x08, 0x88, 0xd0, 0x9f, 0x08,
+    0x08, 0x08, 0x80, 0x71, 0x13, 0x88, 0x80, 0x80, 0x88, 0xfc, 0x0b, 0x80, 0x80, 0x18, 0x18, 0x57,
+    0x80, 0x80, 0x00, 0x88, 0xb8, 0xbf, 0x00, 0x08, 0x88, 0x81, 0x71, 0x05, 0x08, 0x80, 0x80, 0x88,
+    0xfb, 0x0b, 0x80, 0x80, 0x08, 0x10, 0x47, 0x81, 0x80, 0x08, 0x90, 0xb0, 0xcf, 0x08, 0x08, 0x08,
+    0x00, 0x60, 0x15, 0x88, 0x80, 0x80, 0x08, 0xfb, 0x0c, 0x08, 0x08, 0x18, 0x08, 0x46, 0x81, 0x00,
+    0x08, 0x98, 0xb0, 0xcf, 0x08, 0x08, 0x08, 0x00, 0x60, 0x24, 0x08, 0x88, 0x80, 0x09, 0xfb, 0x8d,
+    0x80, 0x80, 0x00, 0x00, 0x55, 0x01, 0x08, 0x08, 0x88, 0xa8, 0xdf, 0x08, 0x80, 0x80, 0x00, 0x40,
+    0x16, 0x80, 0x80, 0x80, 0x12, 0x0d, 0x39, 0x00, 0x88, 0xf9, 0x8c, 0x80, 0x80, 0x18, 0x08, 0x65,
+    0x81, 0x80, 0x80, 0x88, 0xa0, 0xbf, 0x08, 0x08, 0x08, 0x00, 0x60, 0x25, 0x08, 0x88, 0x80, 0x88,
+    0xf9, 0x8d, 0x80, 0x80, 0x00, 0x80, 0x64, 0x82, 0x80, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x88, 0x00,
+    0x00, 0x48, 0x17, 0x00, 0x88, 0x80, 0x08, 0xfa, 0x8b, 0x88, 0x00, 0x00, 0x80, 0x75, 0x01, 0x08,
+    0x80, 0x88, 0x90, 0xbf, 0x09, 0x88, 0x00, 0x00, 0x58, 0x17, 0x80, 0x00, 0x88, 0x08, 0xf9, 0x8b,
+    0x88, 0x00, 0x08, 0x00, 0x74, 0x02, 0x80, 0x08, 0x90, 0x90, 0xcf, 0x89, 0x80, 0x80, 0x01, 0x38,
+    0x47, 0x00, 0x08, 0x08, 0x09, 0xf9, 0x8c, 0x88, 0x00, 0x08, 0x80, 0x73, 0x84, 0x00, 0x08, 0x88,
+    0x90, 0xce, 0x09, 0x88, 0x80, 0x00, 0x30, 0x47, 0x00, 0x80, 0x88, 0x08, 0xf9, 0x9c, 0x80, 0x00,
+    0x08, 0x80, 0x74, 0x82, 0x00, 0x88, 0x90, 0x80, 0x9e, 0x0b, 0x37, 0x00, 0xde, 0x88, 0x08, 0x80,
+    0x00, 0x28, 0x37, 0x00, 0x80, 0x08, 0x88, 0xf8, 0xac, 0x80, 0x00, 0x08, 0x80, 0x73, 0x04, 0x00,
+    0x88, 0x80, 0x88, 0xde, 0x09, 0x88, 0x80, 0x00, 0x38, 0x47, 0x80, 0x00, 0x88, 0x08, 0xe8, 0x9c,
+    0x88, 0x08, 0x80, 0x81, 0x73, 0x04, 0x00, 0x88, 0x80, 0x88, 0xed, 0x0a, 0x08, 0x08, 0x00, 0x28,
+    0x47, 0x80, 0x00, 0x08, 0x88, 0xd8, 0x9e, 0x80, 0x08, 0x08, 0x00, 0x71, 0x13, 0x08, 0x80, 0x88,
+    0x88, 0xfd, 0x89, 0x08, 0x80, 0x00, 0x28, 0x37, 0x00, 0x00, 0x09, 0x88, 0xe8, 0xad, 0x80, 0x08,
+    0x00, 0x80, 0x72, 0x14, 0x08, 0x88, 0x80, 0x88, 0xed, 0x89, 0x08, 0x80, 0x00, 0x10, 0x47, 0x80,
+    0x00, 0x88, 0x88, 0xc0, 0x9f, 0x08, 0x08, 0x80, 0x80, 0x61, 0x14, 0x08, 0x88, 0x80, 0x08, 0xfc,
+    0x0a, 0x88, 0x80, 0x00, 0x18, 0x47, 0x00, 0x80, 0x08, 0x88, 0xa0, 0x9e, 0xd7, 0xfd, 0x3b, 0x00,
+    0x00, 0x09, 0x00, 0x80, 0x50, 0x05, 0x00, 0x88, 0x88, 0x08, 0xfb, 0x8b, 0x88, 0x00, 0x00, 0x18,
+    0x57, 0x00, 0x80, 0x09, 0x88, 0xb0, 0xbf, 0x88, 0x18, 0x08, 0x80, 0x71, 0x14, 0x00, 0x88, 0x08,
+    0x08, 0xfc, 0x8a, 0x88, 0x00, 0x08, 0x18, 0x56, 0x81, 0x00, 0x88, 0x88, 0xb0, 0xbf, 0x88, 0x09,
+    0x81, 0x00, 0x71, 0x15, 0x08, 0x80, 0x88, 0x09, 0xfb, 0x8b, 0x88, 0x00, 0x18, 0x10, 0x57, 0x81,
+    0x80, 0x08, 0x88, 0xb8, 0xcf, 0x08, 0x08, 0x00, 0x00, 0x50, 0x16, 0x88, 0x80, 0x08, 0x09, 0xfa,
+    0x8b, 0x80, 0x00, 0x08, 0x00, 0x66, 0x81, 0x80, 0x08, 0x88, 0xa0, 0xbf, 0x08, 0x08, 0x88, 0x81,
+    0x50, 0x17, 0x80, 0x80, 0x80, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x90, 0x75, 0x82, 0x80, 0x80,
+    0x88, 0x80, 0xbf, 0x89, 0x80, 0x00, 0x00, 0x48, 0x37, 0x08, 0x80, 0x88, 0x08, 0xf9, 0x9c, 0x80,
+    0x1f, 0xf9, 0x35, 0x00, 0x08, 0x00, 0x08, 0x74, 0x02, 0x08, 0x88, 0x80, 0x90, 0xcf, 0x09, 0x08,
+    0x80, 0x00, 0x48, 0x27, 0x08, 0x08, 0x88, 0x08, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x91, 0x75, 0x82,
+    0x80, 0x08, 0x88, 0x90, 0xce, 0x09, 0x08, 0x08, 0x00, 0x48, 0x27, 0x80, 0x80, 0x08, 0x88, 0xf8,
+    0x9c, 0x80, 0x00, 0x08, 0x80, 0x74, 0x82, 0x08, 0x80, 0x88, 0x80, 0xbf, 0x09, 0x88, 0x00, 0x18,
+    0x48, 0x37, 0x08, 0x08, 0x08, 0x09, 0xf9, 0x9c, 0x80, 0x80, 0x00, 0x80, 0x73, 0x04, 0x08, 0x08,
+    0x88, 0x90, 0xde, 0x09, 0x80, 0x80, 0x00, 0x38, 0x37, 0x80, 0x00, 0x08, 0x09, 0xf8, 0x9d, 0x80,
+    0x80, 0x08, 0x00, 0x72, 0x84, 0x80, 0x00, 0x88, 0x08, 0xce, 0x0a, 0x80, 0x80, 0x00, 0x39, 0x57,
+    0x80, 0x80, 0x00, 0x88, 0xd8, 0x9d, 0x08, 0x08, 0x08, 0x80, 0x73, 0x04, 0x08, 0x08, 0x88, 0x80,
+    0xde, 0x09, 0x80, 0x80, 0x09, 0xf9, 0x34, 0x00, 0x00, 0x28, 0x47, 0x88, 0x00, 0x88, 0x08, 0xd0,
+    0xad, 0x00, 0x08, 0x80, 0x80, 0x72, 0x04, 0x08, 0x80, 0x88, 0x00, 0xed, 0x89, 0x80, 0x00, 0x08,
+    0x18, 0x47, 0x80, 0x80, 0x08, 0x08, 0xc8, 0xae, 0x00, 0x08, 0x88, 0x80, 0x72, 0x04, 0x08, 0x80,
+    0x80, 0x08, 0xfc, 0x0a, 0x80, 0x08, 0x08, 0x00, 0x47, 0x80, 0x00, 0x08, 0x88, 0xc0, 0x9f, 0x08,
+    0x88, 0x00, 0x80, 0x61, 0x14, 0x88, 0x80, 0x80, 0x08, 0xfc, 0x0a, 0x88, 0x00, 0x08, 0x00, 0x47,
+    0x00, 0x08, 0x88, 0x80, 0xb8, 0xbf, 0x08, 0x08, 0x80, 0x00, 0x71, 0x15, 0x88, 0x80, 0x80, 0x88,
+    0xfb, 0x8b, 0x80, 0x00, 0x18, 0x18, 0x57, 0x00, 0x08, 0x08, 0x88, 0xb0, 0xbf, 0x08, 0x08, 0x08,
+    0x00, 0x70, 0x15, 0x88, 0x80, 0x80, 0x88, 0xfa, 0x8b, 0x80, 0x80, 0x18, 0x80, 0x57, 0x81, 0x80,
+    0x80, 0x90, 0xa0, 0xbf, 0x09, 0x80, 0x80, 0x81, 0x6e, 0xf9, 0x2f, 0x00, 0x70, 0x15, 0x08, 0x88,
+    0x80, 0x08, 0xf9, 0x8c, 0x80, 0x00, 0x08, 0x80, 0x65, 0x81, 0x08, 0x08, 0x88, 0xa0, 0xbf, 0x08,
+    0x08, 0x80, 0x81, 0x60, 0x25, 0x88, 0x80, 0x88, 0x08, 0xfa, 0x8c, 0x80, 0x80, 0x00, 0x08, 0x56,
+    0x81, 0x80, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x08, 0x80, 0x80, 0x40, 0x17, 0x08, 0x80, 0x08, 0x08,
+    0xfa, 0x8b, 0x80, 0x80, 0x00, 0x80, 0x75, 0x01, 0x08, 0x08, 0x88, 0x98, 0xbf, 0x08, 0x88, 0x80,
+    0x01, 0x58, 0x17, 0x08, 0x80, 0x80, 0x08, 0xf9, 0x8b, 0x08, 0x08, 0x08, 0x80, 0x65, 0x82, 0x00,
+    0x08, 0x88, 0x98, 0xcf, 0x88, 0x80, 0x80, 0x00, 0x48, 0x27, 0x08, 0x08, 0x08, 0x08, 0xf9, 0x9b,
+    0x08, 0x08, 0x08, 0x88, 0x75, 0x02, 0x08, 0x08, 0x88, 0x80, 0xcf, 0x88, 0x80, 0x80, 0x80, 0x38,
+    0x47, 0x08, 0x80, 0x80, 0x08, 0xe8, 0x9c, 0x80, 0x08, 0x08, 0x80, 0x73, 0x59, 0x00, 0x37, 0x00,
+    0x04, 0x08, 0x08, 0x90, 0x80, 0xbf, 0x0a, 0x08, 0x88, 0x01, 0x38, 0x67, 0x80, 0x80, 0x00, 0x09,
+    0xd8, 0xac, 0x80, 0x80, 0x80, 0x81, 0x73, 0x14, 0x08, 0x88, 0x80, 0x88, 0xde, 0x89, 0x80, 0x80,
+    0x00, 0x20, 0x47, 0x80, 0x80, 0x80, 0x08, 0xd8, 0x9e, 0x80, 0x80, 0x08, 0x00, 0x71, 0x03, 0x80,
+    0x80, 0x80, 0x08, 0xcf, 0x0a, 0x08, 0x80, 0x18, 0x29, 0x57, 0x80, 0x80, 0x00, 0x88, 0xd0, 0x9d,
+    0x08, 0x08, 0x08, 0x80, 0x71, 0x04, 0x80, 0x08, 0x80, 0x08, 0xdd, 0x0a, 0x08, 0x80, 0x08, 0x28,
+    0x57, 0x80, 0x80, 0x08, 0x80, 0xb8, 0xbf, 0x00, 0x08, 0x88, 0x81, 0x71, 0x05, 0x08, 0x08, 0x08,
+    0x88, 0xfb, 0x8a, 0x80, 0x80, 0x18, 0x18, 0x57, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xae, 0x80, 0x00,
+    0x88, 0x80, 0x71, 0x14, 0x88, 0x80, 0x80, 0x08, 0xfc, 0x0a, 0x80, 0x80, 0x00, 0x08, 0x37, 0x81,
+    0x39, 0x06, 0x35, 0x00, 0x80, 0x80, 0x08, 0xc0, 0xbf, 0x08, 0x80, 0x80, 0x80, 0x70, 0x15, 0x88,
+    0x80, 0x80, 0x08, 0xfb, 0x0b, 0x80, 0x80, 0x18, 0x08, 0x57, 0x80, 0x80, 0x80, 0x80, 0xb0, 0xbf,
+    0x00, 0x08, 0x88, 0x00, 0x70, 0x14, 0x08, 0x88, 0x00, 0x08, 0xfb, 0x0d, 0x80, 0x08, 0x08, 0x80,
+    0x55, 0x81, 0x80, 0x80, 0x88, 0xa1, 0xcf, 0x08, 0x08, 0x80, 0x80, 0x50, 0x16, 0x88, 0x80, 0x80,
+    0x08, 0xf9, 0x8b, 0x80, 0x08, 0x00, 0x08, 0x56, 0x01, 0x08, 0x08, 0x88, 0xa0, 0xcf, 0x08, 0x88,
+    0x80, 0x00, 0x58, 0x17, 0x88, 0x00, 0x88, 0x00, 0xfa, 0x8a, 0x88, 0x00, 0x08, 0x80, 0x65, 0x82,
+    0x08, 0x08, 0x88, 0x90, 0xcf, 0x08, 0x88, 0x00, 0x80, 0x40, 0x17, 0x08, 0x80, 0x08, 0x09, 0xf8,
+    0x9b, 0x00, 0x08, 0x08, 0x80, 0x75, 0x01, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x08, 0x88, 0x80, 0x00,
+    0x58, 0x17, 0x80, 0x80, 0x29, 0x06, 0x35, 0x00, 0x80, 0x08, 0xf9, 0x8b, 0x90, 0x00, 0x08, 0x80,
+    0x75, 0x01, 0x08, 0x80, 0x90, 0x80, 0xbf, 0x09, 0x88, 0x80, 0x00, 0x58, 0x27, 0x08, 0x08, 0x08,
+    0x09, 0xf9, 0x9b, 0x80, 0x00, 0x08, 0x00, 0x75, 0x01, 0x08, 0x08, 0x88, 0x98, 0xce, 0x09, 0x80,
+    0x80, 0x01, 0x38, 0x57, 0x88, 0x80, 0x80, 0x88, 0xe0, 0x8c, 0x80, 0x08, 0x80, 0x81, 0x72, 0x84,
+    0x08, 0x80, 0x90, 0x80, 0xde, 0x08, 0x88, 0x00, 0x08, 0x20, 0x37, 0x88, 0x81, 0x08, 0x88, 0xf8,
+    0x9c, 0x80, 0x08, 0x80, 0x00, 0x73, 0x04, 0x08, 0x80, 0x88, 0x90, 0xde, 0x09, 0x80, 0x08, 0x00,
+    0x38, 0x47, 0x08, 0x08, 0x08, 0x88, 0xe8, 0x9d, 0x81, 0x08, 0x80, 0x00, 0x73, 0x83, 0x08, 0x88,
+    0x80, 0x08, 0xdf, 0x19, 0x88, 0x00, 0x08, 0x28, 0x37, 0x80, 0x80, 0x08, 0x08, 0xe8, 0x9e, 0x00,
+    0x08, 0x88, 0x81, 0x71, 0x84, 0x08, 0x80, 0x80, 0x59, 0x06, 0x33, 0x00, 0x08, 0xdd, 0x09, 0x88,
+    0x00, 0x08, 0x28, 0x47, 0x80, 0x80, 0x08, 0x88, 0xc0, 0x9f, 0x80, 0x08, 0x80, 0x80, 0x62, 0x04,
+    0x08, 0x80, 0x80, 0x08, 0xed, 0x0a, 0x80, 0x08, 0x00, 0x08, 0x47, 0x81, 0x80, 0x88, 0x80, 0xc0,
+    0xaf, 0x00, 0x08, 0x08, 0x80, 0x71, 0x03, 0x18, 0x88, 0x90, 0x00, 0xfd, 0x0a, 0x80, 0x00, 0x08,
+    0x18, 0x37, 0x81, 0x80, 0x09, 0x08, 0xd8, 0x9f, 0x08, 0x80, 0x00, 0x80, 0x61, 0x04, 0x80, 0x80,
+    0x88, 0x08, 0xfb, 0x8c, 0x80, 0x00, 0x00, 0x18, 0x46, 0x01, 0x08, 0x88, 0x88, 0xc0, 0xbf, 0x80,
+    0x08, 0x00, 0x80, 0x71, 0x14, 0x08, 0x80, 0x88, 0x08, 0xfb, 0x8c, 0x08, 0x00, 0x18, 0x08, 0x37,
+    0x01, 0x08, 0x88, 0x88, 0xd1, 0xaf, 0x08, 0x80, 0x08, 0x92, 0x70, 0x04, 0x80, 0x08, 0x80, 0x08,
+    0xec, 0x8a, 0x08, 0x80, 0x10, 0x08, 0x56, 0x01, 0x88, 0x00, 0x89, 0xa0, 0x0e, 0x04, 0x2e, 0x00,
+    0xdf, 0x80, 0x80, 0x80, 0x81, 0x41, 0x16, 0x88, 0x80, 0x90, 0x18, 0xfa, 0x8c, 0x00, 0x80, 0x00,
+    0x88, 0x65, 0x81, 0x08, 0x08, 0x88, 0x90, 0xbf, 0x08, 0x08, 0x08, 0x81, 0x78, 0x14, 0x08, 0x80,
+    0x90, 0x19, 0xfa, 0x8c, 0x80, 0x00, 0x09, 0x18, 0x65, 0x81, 0x00, 0x08, 0x88, 0xa0, 0xbf, 0x88,
+    0x80, 0x08, 0x00, 0x78, 0x15, 0x08, 0x08, 0x80, 0x09, 0xf9, 0x8c, 0x81, 0x09, 0x18, 0x80, 0x55,
+    0x81, 0x10, 0x98, 0x80, 0x99, 0xce, 0x89, 0x80, 0x08, 0x02, 0x58, 0x17, 0x80, 0x00, 0x98, 0x19,
+    0xf9, 0x8b, 0x80, 0x89, 0x21, 0x91, 0x66, 0x81, 0x00, 0x98, 0x08, 0xa0, 0xcf, 0x08, 0x08, 0x00,
+    0x80, 0x30, 0x94, 0x8c, 0x00, 0x89, 0x00, 0x98, 0x88, 0x80, 0x11, 0x02, 0x88, 0x24, 0x19, 0xa3,
+    0x9c, 0x11, 0x94, 0x8e, 0x21, 0x11, 0x98, 0x20, 0x72, 0xa2, 0x29, 0x31, 0xd0, 0x3b, 0xb8, 0x21,
+    0x64, 0xfd, 0x17, 0x00, 0xad, 0x12, 0x12, 0x19, 0x57, 0x28, 0xb2, 0x1b, 0xa1, 0xb9, 0x8d, 0xb9,
+    0x73, 0x81, 0x32, 0x01, 0x89, 0x33, 0x99, 0xcc, 0x2a, 0xd0, 0x9d, 0x43, 0x80, 0x34, 0x11, 0x01,
+    0xd8, 0x39, 0xd3, 0x8c, 0x90, 0x88, 0x1a, 0xa3, 0x72, 0x03, 0x01, 0x18, 0xa3, 0x8c, 0xba, 0x10,
+    0xca, 0x48, 0x25, 0x21, 0x03, 0x9b, 0x30, 0xf1, 0x1c, 0x04, 0xda, 0x18, 0x80, 0x22, 0xca, 0x00,
+    0x38, 0xa2, 0x74, 0x98, 0x83, 0x9d, 0x18, 0x04, 0x9e, 0x03, 0x99, 0x91, 0x08, 0x19, 0x17, 0x18,
+    0x01, 0x32, 0xac, 0x91, 0x0e, 0xc0, 0x3a, 0xb2, 0x3b, 0x35, 0x91, 0x59, 0xa4, 0x3b, 0xa5, 0x9d,
+    0x08, 0x11, 0xaa, 0xa0, 0x68, 0xa3, 0x2a, 0x06, 0x09, 0x80, 0x98, 0x2a, 0xb1, 0x1b, 0xd9, 0x30,
+    0xd0, 0x89, 0x11, 0x51, 0x26, 0xa0, 0x8b, 0x14, 0xeb, 0x99, 0x08, 0x91, 0x72, 0x80, 0x31, 0x82,
+    0x08, 0xad, 0x28, 0x13, 0x32, 0x00, 0x0d, 0x00, 0xcd, 0x89, 0x8a, 0x25, 0xba, 0x68, 0x92, 0x10,
+    0xb1, 0x1b, 0xa9, 0x9b, 0x98, 0x0d, 0x57, 0x91, 0x1a, 0x23, 0x99, 0x19, 0xcc, 0x2b, 0x06, 0x88,
+    0xaa, 0x61, 0x92, 0x09, 0xb9, 0x19, 0x15, 0xaa, 0x39, 0x16, 0x38, 0x92, 0x8f, 0x02, 0xca, 0x9b,
+    0xa0, 0x38, 0x92, 0x63, 0x22, 0x82, 0x0a, 0xe8, 0x09, 0xb9, 0x31, 0x90, 0x3c, 0x15, 0xb0, 0xc8,
+    0x42, 0xb0, 0x1a, 0xaa, 0x20, 0x57, 0x0a, 0x83, 0x9d, 0xa9, 0x98, 0x0d, 0x83, 0x7b, 0x83, 0x8a,
+    0x72, 0xd1, 0x29, 0xb8, 0x39, 0xa1, 0x9a, 0x41, 0x01, 0x35, 0x99, 0x33, 0xd9, 0x90, 0xea, 0x99,
+    0x8a, 0x98, 0x21, 0x89, 0x37, 0x02, 0x86, 0x0a, 0x81, 0xcb, 0xda, 0xaa, 0x23, 0xb1, 0x60, 0x13,
+    0x28, 0x01, 0x08, 0x99, 0x91, 0x30, 0xdf, 0x29, 0xa0, 0xa0, 0x98, 0x00, 0x43, 0xdc, 0x60, 0x90,
+    0x32, 0xd1, 0x01, 0xb9, 0x10, 0x8d, 0x19, 0x22, 0xf3, 0xff, 0x08, 0x00, 0x19, 0x16, 0x49, 0x93,
+    0x40, 0xc9, 0x99, 0x39, 0xf8, 0x21, 0xba, 0x16, 0x09, 0x03, 0x59, 0xa2, 0x80, 0xbd, 0x00, 0x9c,
+    0x39, 0xad, 0x39, 0x01, 0x33, 0x06, 0x90, 0x09, 0xca, 0x1b, 0xb8, 0x8f, 0x13, 0x91, 0x25, 0x90,
+    0x30, 0x39, 0x11, 0xd2, 0x99, 0xa4, 0xcc, 0x19, 0xb9, 0x1d, 0x92, 0x51, 0x14, 0xd9, 0x62, 0x91,
+    0x08, 0xaa, 0x91, 0xaa, 0xbc, 0x19, 0x13, 0x80, 0x51, 0x34, 0x81, 0x0c, 0x9b, 0xb3, 0xaf, 0x13,
+    0x9c, 0xb1, 0x39, 0x17, 0x91, 0x19, 0x18, 0x90, 0x00, 0xf9, 0x51, 0xca, 0x30, 0x09, 0xa2, 0x3b,
+    0x03, 0x90, 0x1f, 0xe1, 0x49, 0x91, 0x31, 0xac, 0x21, 0xa9, 0xb1, 0xd9, 0x18, 0x43, 0xa4, 0x8a,
+    0xa5, 0x26, 0xb9, 0x13, 0x2a, 0xf1, 0x39, 0xb0, 0x51, 0x8a, 0x82, 0x2a, 0x8e, 0x31, 0x1a, 0x89,
+    0x58, 0x99, 0x98, 0x3b, 0xa6, 0x89, 0xda, 0x05, 0xb9, 0x0a, 0x21, 0x00, 0xf3, 0xff, 0x05, 0x00,
+    0xb2, 0x20, 0x02, 0x17, 0x9a, 0x95, 0x53, 0xb9, 0x1b, 0x9a, 0xaa, 0x11, 0xb1, 0x87, 0x84, 0x90,
+    0x27, 0x8b, 0x05, 0x8a, 0xa8, 0x10, 0xa9, 0xfb, 0x2a, 0x84, 0x90, 0x00, 0x42, 0x82, 0x89, 0x2b,
+    0x0d, 0x48, 0x9c, 0x1e, 0x11, 0x89, 0x22, 0x99, 0x19, 0xc4, 0x49, 0xc1, 0x10, 0xe1, 0x19, 0x80,
+    0x10, 0x82, 0x90, 0xe1, 0x90, 0xba, 0x10, 0x70, 0xa1, 0x1a, 0xa3, 0x41, 0x08, 0x33, 0xdb, 0x99,
+    0xb1, 0x4c, 0x9b, 0x4a, 0x07, 0xa9, 0x21, 0x49, 0x20, 0xad, 0x12, 0xb3, 0x9b, 0xd0, 0x92, 0xb5,
+    0x2a, 0x18, 0x41, 0x2a, 0x36, 0x0b, 0x9b, 0x4b, 0xb1, 0xf9, 0xa9, 0xb1, 0x2a, 0x04, 0x3a, 0x53,
+    0x11, 0x40, 0x09, 0x1f, 0x09, 0xac, 0xa2, 0xb1, 0x35, 0xb2, 0x7a, 0x92, 0x12, 0x9b, 0x88, 0x3c,
+    0xfa, 0x10, 0x9a, 0x13, 0x0c, 0x12, 0x43, 0x0d, 0x31, 0x88, 0xd9, 0x10, 0xbc, 0x40, 0xa8, 0x92,
+    0xfe, 0xff, 0x03, 0x00, 0x3a, 0x60, 0x10, 0xda, 0x21, 0xa8, 0x1a, 0xda, 0x11, 0x93, 0x03, 0xb1,
+    0x4b, 0x33, 0xa2, 0xaf, 0x11, 0x1a, 0x88, 0xdb, 0xb1, 0xc3, 0x69, 0x29, 0x4c, 0x18, 0x00, 0x80,
+    0x89, 0xa2, 0x3b, 0x99, 0x2d, 0x99, 0x1a, 0x33, 0x21, 0x06, 0xb2, 0x13, 0xd0, 0x90, 0x2a, 0x1b,
+    0x8f, 0x29, 0x08, 0x81, 0x13, 0x21, 0x87, 0x8a, 0xa0, 0xb3, 0x9a, 0x92, 0x2c, 0x14, 0x19, 0x20,
+    0x3b, 0x51, 0x1a, 0x1d, 0xa0, 0xa9, 0x31, 0xcb, 0x13, 0x94, 0x90, 0x91, 0x29, 0x01, 0xb0, 0x99,
+    0xb3, 0x01, 0xd2, 0x39, 0x28, 0x2d, 0x2a, 0x1a, 0x21, 0x93, 0x10, 0x91, 0x19, 0x30, 0x1f, 0x39,
+    0x1b, 0x90, 0xd0, 0x23, 0x89, 0x19, 0xbb, 0x31, 0x91, 0x99, 0x1a, 0x39, 0xb3, 0xb1, 0x93, 0x3b,
+    0x39, 0xb9, 0xb2, 0x93, 0x02, 0x09, 0x1a, 0x19, 0x90, 0x91, 0xd9, 0x03, 0x80, 0x19, 0x09, 0x01,
+    0xa1, 0x02, 0x92, 0x3c, 0x02, 0x00, 0x01, 0x00, 0x3b, 0x3b, 0xb1, 0x19, 0x93, 0xb2, 0xb3, 0xb1,
+    0x11, 0x91, 0xb3, 0x93, 0x11, 0xab, 0xa3, 0xa4, 0xb2, 0x01, 0x91, 0x0a, 0x12, 0x00, 0x3b, 0x0b,
+    0x01, 0x09, 0x39, 0x3b, 0x19, 0x09, 0x11, 0x3a, 0x2d, 0x90, 0xb1, 0xb3, 0xa2, 0x93, 0x99, 0x92,
+    0x19, 0x9b, 0x11, 0xb1, 0x94, 0x90, 0x30, 0x99, 0x99, 0x03, 0xb0, 0x93, 0x39, 0x0b, 0xa1, 0xe3,
+    0x00, 0x10, 0x29, 0x9a, 0x93, 0x91, 0x01, 0xb2, 0x11, 0x39, 0x3d, 0x3c, 0x1b, 0xa1, 0x02, 0x3b,
+    0x1b, 0x91, 0x91, 0xb2, 0x93, 0x00, 0x13, 0x0a, 0xb3, 0x00, 0x19, 0x39, 0x2d, 0x1b, 0x39, 0x90,
+    0x09, 0x11, 0x11, 0x91, 0x11, 0x4b, 0x4c, 0x2c, 0x2a, 0x1a, 0xb0, 0xb4, 0xb5, 0x91, 0xa3, 0x10,
+    0xa2, 0xa0, 0x90, 0xa2, 0x03, 0xb2, 0x10, 0x19, 0x1a, 0xb3, 0xd2, 0xa4, 0xa0, 0x01, 0x10, 0xa1,
+    0x91, 0xb3, 0xb5, 0xb1, 0x12, 0xb1, 0x13, 0x0a, 0xfe, 0xff, 0x00, 0x00, 0x39, 0x3d, 0x09, 0x4b,
+    0x09, 0x11, 0x90, 0x10, 0x91, 0x91, 0x93, 0x0b, 0x0a, 0x01, 0x39, 0x9b, 0x29, 0x11, 0xa3, 0x90,
+    0x10, 0x90, 0x00, 0xb0, 0x03, 0x92, 0xa0, 0x92, 0x99, 0x30, 0x3b, 0x4b, 0x2b, 0x9a, 0x01, 0x19,
+    0x29, 0x9b, 0x39, 0x39, 0x4b, 0x9b, 0x31, 0x09, 0xa2, 0x09, 0xb3, 0x01, 0x19, 0x3b, 0x2b, 0x91,
+    0x30, 0x99, 0x09, 0x11, 0x29, 0x3b, 0x1d, 0x19, 0xd2, 0xb3, 0xb2, 0xa5, 0xb2, 0xb5, 0x01, 0x00,
+    0x0b, 0x01, 0x90, 0x39, 0x99, 0xb3, 0xd3, 0xb3, 0xb4, 0x01, 0x20, 0x2e, 0x19, 0x19, 0x18, 0x20,
+    0x3b, 0x1d, 0x4a, 0x98, 0xa1, 0x93, 0x00, 0x20, 0x0b, 0x00, 0x91, 0x19, 0x39, 0x3b, 0x1b, 0x19,
+    0xb3, 0x91, 0x93, 0xa0, 0x91, 0x01, 0x90, 0xa1, 0x10, 0x19, 0x4a, 0xa8, 0x93, 0x01, 0x09, 0xa1,
+    0x93, 0x91, 0x19, 0x4b, 0x2b, 0x3b, 0x91, 0x3a, 0x4c, 0x1b, 0x19, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x99, 0xb2, 0xb1, 0x93, 0x91, 0x21, 0x9b, 0x10, 0x92, 0x91, 0x19, 0x3a, 0x19, 0xa9, 0x31, 0x0c,
+    0x10, 0xb3, 0xb4, 0xb4, 0xb3, 0x91, 0x91, 0x91, 0xb2, 0x21, 0x2b, 0x99, 0x01, 0xb1, 0x01, 0x91,
+    0xb3, 0xb3, 0x91, 0x31, 0x0b, 0x19, 0x20, 0x3a, 0x09, 0x2d, 0x19, 0x08, 0xd3, 0x92, 0x00, 0xb1,
+    0xb3, 0xb4, 0x92, 0x5b, 0x3d, 0x3b, 0x09, 0x90, 0x18, 0x19, 0x39, 0x3b, 0x1b, 0x19, 0x91, 0x91,
+    0xc2, 0xb4, 0x01, 0x4a, 0x4c, 0x1a, 0x90, 0x91, 0x01, 0x29, 0x3b, 0x3c, 0x0a, 0x39, 0x3a, 0x3b,
+    0x90, 0xa1, 0xb3, 0xc2, 0x93, 0x19, 0x09, 0x91, 0xb3, 0xa3, 0x92, 0x90, 0xb1, 0xb5, 0x81, 0x10,
+    0x19, 0x3b, 0x1b, 0xa2, 0xb3, 0xc3, 0xa2, 0x95, 0xb0, 0xb4, 0x93, 0x10, 0x11, 0x99, 0x90, 0x01,
+    0x3b, 0x19, 0x01, 0x19, 0x99, 0xa2, 0x00, 0x10, 0x90, 0xb9, 0x11, 0x93, 0x01, 0x01, 0x10, 0x3a,
+    0x02, 0x00, 0x00, 0x00, 0x99, 0x99, 0x10, 0x00, 0x29, 0x1b, 0x91, 0xd3, 0xa3, 0xb3, 0x93, 0x19,
+    0x19, 0x00, 0x09, 0x01, 0xa1, 0xb3, 0xb3, 0x02, 0x3b, 0x99, 0xb2, 0x11, 0x19, 0x90, 0xd3, 0x92,
+    0x81, 0x09, 0xb2, 0x92, 0x09, 0x90, 0xc3, 0xc4, 0xa3, 0x01, 0x18, 0x3a, 0x9a, 0xc3, 0xa3, 0x11,
+    0xb1, 0xb3, 0xa3, 0x30, 0x3b, 0x9a, 0x92, 0xa1, 0xa2, 0xb3, 0xb3, 0x93, 0x3a, 0x3d, 0x2a, 0x98,
+    0xb3, 0xb3, 0x91, 0xb2, 0xa2, 0xb3, 0xb3, 0x92, 0x91, 0x19, 0x30, 0x0b, 0xa0, 0xa1, 0x03, 0x01,
+    0x90, 0x90, 0xb2, 0x12, 0x2a, 0x3b, 0x5b, 0x3b, 0x1b, 0xb1, 0xb3, 0xb3, 0x93, 0x3a, 0x3c, 0x29,
+    0x3b, 0x4c, 0x3b, 0x3c, 0x2a, 0x19, 0xa9, 0xb4, 0xc4, 0xa3, 0x01, 0x19, 0x29, 0x09, 0x90, 0x01,
+    0x09, 0x19, 0x00, 0x00, 0x19, 0x39, 0x1b, 0xa1, 0xb3, 0x31, 0x4c, 0x2b, 0x2b, 0xa9, 0xb1, 0xa5,
+    0x01, 0xa0, 0xa2, 0x11, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x4a, 0x1a, 0x19, 0x19, 0x99, 0xb3, 0x11,
+    0x5b, 0x2b, 0x99, 0x03, 0x3b, 0x3b, 0x1b, 0xb3, 0xb3, 0x02, 0x4b, 0x2b, 0x99, 0xa1, 0x39, 0x19,
+    0x19, 0xa9, 0xb4, 0xb2, 0x11, 0xb1, 0xc4, 0x93, 0x10, 0xa9, 0xb2, 0xb3, 0xa2, 0x02, 0x1a, 0x19,
+    0x10, 0x00, 0x91, 0x10, 0x19, 0x3a, 0x5c, 0x3c, 0x2b, 0x19, 0x19, 0x19, 0x90, 0xa2, 0x11, 0x1b,
+    0x90, 0x92, 0x11, 0x99, 0xc3, 0xc3, 0xb3, 0xb3, 0xb2, 0x02, 0x10, 0x99, 0x91, 0xb2, 0x92, 0x19,
+    0x19, 0x10, 0x09, 0x00, 0x19, 0x39, 0x2b, 0x1a, 0x99, 0x11, 0x00, 0x00, 0x91, 0x00, 0x01, 0x90,
+    0x00, 0x91, 0x90, 0x11, 0x3a, 0x3b, 0x1b, 0x11, 0x19, 0x19, 0x1b, 0xb0, 0x93, 0xb3, 0xb3, 0xb3,
+    0xb5, 0xb2, 0x92, 0x91, 0x99, 0x30, 0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0xb1, 0xb5, 0xc2, 0xb4, 0xa2,
+    0x92, 0x91, 0x99, 0xb3, 0xb2, 0x31, 0x3c, 0x1a, 0xfe, 0xff, 0x00, 0x00, 0xb2, 0xb3, 0xb3, 0xb3,
+    0x92, 0x91, 0x1a, 0x19, 0x01, 0x91, 0x90, 0x11, 0x00, 0x91, 0xa0, 0x93, 0x91, 0x3a, 0x4b, 0x2b,
+    0x1a, 0x91, 0x91, 0xb2, 0x91, 0x01, 0x00, 0xb1, 0x93, 0x4a, 0x1b, 0x0a, 0x93, 0x91, 0x3b, 0x09,
+    0x10, 0x10, 0x3b, 0x4b, 0x3b, 0x2d, 0x09, 0xa0, 0xb3, 0xb3, 0xc3, 0x82, 0x49, 0x3b, 0x2c, 0x3a,
+    0x3b, 0x2b, 0x4b, 0x2b, 0xa9, 0xb3, 0xb3, 0x10, 0x29, 0x99, 0x90, 0x11, 0x90, 0xb2, 0x02, 0x09,
+    0x19, 0x91, 0x91, 0xb0, 0xa3, 0xc4, 0x93, 0x00, 0x19, 0x3b, 0x4d, 0x1a, 0x09, 0x00, 0x99, 0x91,
+    0x90, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x29, 0x2b, 0xb1, 0xb3, 0xa3, 0xa2, 0x91, 0x91, 0x91, 0x30,
+    0x1b, 0xa1, 0xa3, 0x10, 0x19, 0x09, 0x5b, 0x2a, 0x2a, 0xb9, 0xb3, 0x11, 0x19, 0x19, 0x10, 0x09,
+    0xb1, 0xa3, 0xb3, 0xb3, 0xb3, 0xb3, 0x11, 0x10, 0x99, 0x91, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0xb1, 0xb4, 0x92, 0x99, 0x01, 0x90, 0x90, 0xb3, 0xb3, 0xa3, 0x11, 0x1a, 0x10, 0x19, 0x19,
+    0x19, 0x90, 0xd3, 0x92, 0x81, 0x29, 0x2a, 0x99, 0x91, 0x01, 0x3a, 0x3b, 0x3b, 0x2b, 0x3a, 0x3b,
+    0x1a, 0x90, 0x91, 0x91, 0x91, 0x01, 0x00, 0xa1, 0xb3, 0xb3, 0x92, 0x10, 0x3a, 0x1a, 0x90, 0xb2,
+    0xc3, 0xb3, 0xa5, 0x01, 0x39, 0x1a, 0x00, 0x10, 0x19, 0x3a, 0x1b, 0x91, 0xb3, 0x91, 0x91, 0xb3,
+    0xb3, 0x01, 0x29, 0x1b, 0x91, 0xb2, 0x11, 0x19, 0xb1, 0xa3, 0xb3, 0x92, 0x91, 0x91, 0x91, 0x00,
+    0x91, 0xa1, 0x92, 0x39, 0x3c, 0x1a, 0x01, 0x99, 0x91, 0xb3, 0x21, 0x3b, 0x2b, 0x19, 0x09, 0x00,
+    0x19, 0x4b, 0x3b, 0x0b, 0xa2, 0x10, 0x29, 0x1a, 0x90, 0xb2, 0x02, 0x4b, 0x3b, 0x0b, 0x00, 0x10,
+    0x4b, 0x3b, 0x1b, 0x19, 0x19, 0x4b, 0x3b, 0x1c, 0x90, 0x91, 0x91, 0x91, 0x00, 0xa1, 0x92, 0x90,
+    0xfe, 0xff, 0x00, 0x00, 0x29, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xa2, 0x92, 0x90, 0xb2, 0x93, 0x99,
+    0x00, 0xb2, 0xb2, 0x93, 0x10, 0x19, 0x3b, 0x09, 0xb1, 0xb5, 0xa2, 0xb2, 0xb3, 0x11, 0x4b, 0x3b,
+    0x3d, 0x3b, 0x1a, 0x20, 0x3b, 0x3b, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0xa1, 0xb3, 0xb2,
+    0x93, 0x00, 0xa1, 0xa3, 0x01, 0xa1, 0xb3, 0x91, 0x11, 0x90, 0xa2, 0x01, 0x39, 0x3c, 0x3b, 0x19,
+    0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0xa9, 0x11, 0x91, 0x11, 0x99, 0xb2, 0x02, 0x5b, 0x3c, 0x09, 0xa1,
+    0x91, 0x90, 0xb2, 0x11, 0x19, 0x90, 0xb2, 0xa3, 0x11, 0x4b, 0x3b, 0x2c, 0x3a, 0x1a, 0x3a, 0x90,
+    0xb2, 0xb3, 0x92, 0x39, 0xab, 0x93, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0x02, 0x3b, 0x09, 0x90, 0xa1, 0xb4, 0x92, 0x09, 0x99, 0xa3, 0x91, 0x91, 0xb3, 0xa2, 0x91,
+    0x91, 0xa2, 0x11, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xb3, 0xb3, 0x92, 0x19, 0x19, 0x90, 0xa2,
+    0x11, 0x5b, 0x4c, 0x3b, 0x1a, 0x19, 0x98, 0x93, 0x91, 0xa1, 0xa3, 0x10, 0x4b, 0x1a, 0x90, 0x91,
+    0x00, 0xb1, 0x12, 0x3a, 0x3b, 0x99, 0x91, 0x19, 0x19, 0x90, 0x01, 0x00, 0xa1, 0xb3, 0x92, 0x90,
+    0x91, 0x01, 0x29, 0x1a, 0x19, 0x90, 0xb2, 0x11, 0x29, 0x0a, 0xb2, 0xb3, 0xb3, 0x02, 0x3a, 0x1b,
+    0xb2, 0xb3, 0x92, 0x90, 0x91, 0xa2, 0x11, 0x3b, 0x09, 0x00, 0x90, 0x11, 0x3b, 0x1a, 0xb2, 0xc4,
+    0xa3, 0x82, 0x3b, 0x3b, 0x99, 0xc3, 0xa3, 0x92, 0xb1, 0xc5, 0xb4, 0xa3, 0x01, 0x19, 0x3a, 0x09,
+    0x10, 0x2a, 0x99, 0x01, 0x19, 0xb1, 0xa3, 0x92, 0x00, 0x00, 0x29, 0x4b, 0x3c, 0x09, 0xb0, 0xb3,
+    0xb3, 0xb3, 0xa3, 0x11, 0x99, 0xc3, 0xa3, 0x30, 0x1a, 0x00, 0x39, 0x4c, 0x3c, 0x1a, 0xa1, 0x91,
+    0x19, 0xa1, 0xb3, 0xa3, 0x91, 0x01, 0x29, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x39, 0x1b, 0x90,
+    0xb3, 0xb3, 0x11, 0x4b, 0x3b, 0x3d, 0x2a, 0x1a, 0x91, 0xb2, 0xa3, 0x10, 0x19, 0x00, 0x39, 0x1b,
+    0xb1, 0xb4, 0xb3, 0x01, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x10, 0x5b, 0x3b, 0x0b, 0xb3, 0xa2,
+    0x11, 0x19, 0x99, 0xb2, 0x93, 0x5b, 0x4c, 0x3b, 0x1a, 0x88, 0xa1, 0xb3, 0xa3, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x91, 0x91, 0x11, 0x3a, 0x2b, 0x19, 0x2a, 0x99, 0xc3, 0xa3, 0x11, 0x90, 0x91, 0x11, 0x3a,
+    0x2b, 0x19, 0x3a, 0x3b, 0xa9, 0xb3, 0xb3, 0xa3, 0x20, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x20,
+    0x3b, 0x2b, 0x19, 0x09, 0x90, 0x11, 0x5b, 0x3c, 0x2a, 0x19, 0x19, 0x90, 0xb2, 0xb3, 0x02, 0x3a,
+    0x2b, 0x90, 0x10, 0x4b, 0x3b, 0x9b, 0xb3, 0x11, 0x3b, 0x2a, 0x09, 0x29, 0x3b, 0x1a, 0x10, 0x19,
+    0x09, 0x10, 0x19, 0x19, 0x09, 0x91, 0x91, 0x19, 0x90, 0xb3, 0xb2, 0x92, 0xff, 0xff, 0x00, 0x00,
+    0x10, 0x09, 0x91, 0x91, 0x91, 0xb1, 0x93, 0x10, 0x09, 0x00, 0x29, 0x3b, 0x1a, 0x00, 0x91, 0x00,
+    0x29, 0x3b, 0x4c, 0x3b, 0x3c, 0x2a, 0x19, 0x29, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0x92, 0x10, 0x19,
+    0x3b, 0x3b, 0x99, 0xb3, 0x91, 0x91, 0xb2, 0x92, 0x10, 0x19, 0x19, 0x3a, 0x3b, 0x1b, 0x91, 0x11,
+    0x3a, 0x1a, 0x90, 0x01, 0xa1, 0xb3, 0xb3, 0xa3, 0x30, 0x3c, 0x4b, 0x3b, 0x2b, 0x3b, 0x3b, 0x0a,
+    0x01, 0x29, 0x3b, 0x2b, 0x09, 0x10, 0x3a, 0x3b, 0x1a, 0xb1, 0x03, 0x3a, 0x4c, 0x2b, 0x1a, 0x99,
+    0x11, 0x19, 0x2a, 0x19, 0x09, 0x00, 0x19, 0x90, 0xa2, 0x20, 0x2b, 0xa0, 0xb3, 0x02, 0x3a, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x91, 0x00, 0x91, 0x91, 0x39, 0x3d, 0x3b, 0x3a, 0x19, 0x3b, 0x3b,
+    0x99, 0xb2, 0xb3, 0x93, 0x3a, 0x1a, 0xa1, 0xa3, 0x01, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x19, 0x90,
+    0xfe, 0xff, 0x00, 0x00, 0x91, 0x91, 0x11, 0x19, 0x3b, 0x19, 0x99, 0x91, 0x01, 0x19, 0x90, 0xb2,
+    0xa3, 0x01, 0x29, 0x0a, 0xb3, 0xa2, 0x11, 0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x19, 0x29, 0x1a, 0x91,
+    0x91, 0x00, 0x10, 0x3a, 0x0a, 0xc3, 0xb3, 0xb5, 0xa3, 0x10, 0x99, 0xb2, 0x02, 0x3a, 0x2b, 0x19,
+    0x99, 0xb2, 0xb3, 0x92, 0xb1, 0xb4, 0x92, 0x3a, 0x3b, 0x1b, 0x91, 0xb2, 0xb3, 0xb3, 0xb3, 0x92,
+    0x19, 0x91, 0x91, 0x91, 0x91, 0x29, 0x2b, 0xb0, 0xb5, 0xa2, 0x91, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x11, 0x3a, 0x3b, 0x0a, 0xb2, 0x92, 0x90, 0x91, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x99,
+    0xa2, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xa3, 0x91, 0xb2, 0xfd, 0xff, 0x00, 0x00, 0xa3, 0x20, 0x3b, 0x3b, 0x0a, 0xb2, 0x12, 0x5c,
+    0x3c, 0x2b, 0x19, 0x29, 0x3b, 0x09, 0xa1, 0xb3, 0x93, 0x09, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x10, 0x00, 0xa1, 0x92, 0x91, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x99, 0x91,
+    0x91, 0x19, 0x39, 0x1b, 0xb1, 0xb5, 0xa2, 0x91, 0x00, 0x91, 0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0x19,
+    0x90, 0x91, 0x01, 0x19, 0x29, 0x3b, 0x0a, 0xb2, 0xa3, 0x01, 0x00, 0x90, 0xb2, 0x92, 0x39, 0x1b,
+    0x90, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x91, 0x91, 0x00, 0xa1, 0xa3, 0x30, 0x4d, 0x1b, 0x19, 0x19,
+    0x09, 0x91, 0x10, 0x09, 0x91, 0x91, 0x91, 0x29, 0x3b, 0x2b, 0x19, 0x3b, 0x1a, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xc4, 0xa3, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x91, 0x10, 0x3a, 0x0a, 0xc3, 0xb3,
+    0xb5, 0x92, 0x00, 0xa1, 0xb3, 0x92, 0x00, 0x90, 0xfe, 0xff, 0x00, 0x00, 0xb2, 0xa3, 0x01, 0xa1,
+    0xb3, 0x93, 0x3a, 0x3b, 0x99, 0x91, 0x39, 0x3b, 0x1b, 0x39, 0x3b, 0x2b, 0x1a, 0x19, 0x91, 0x91,
+    0x10, 0x3a, 0x1b, 0x91, 0xa2, 0x11, 0x19, 0x19, 0x3a, 0x3b, 0x1b, 0x91, 0xb3, 0x11, 0x3b, 0x1a,
+    0xb2, 0xc3, 0xb4, 0xb3, 0x91, 0x39, 0x3b, 0x2b, 0x1a, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x19, 0x19, 0xb1, 0x93, 0x39, 0x1b,
+    0x09, 0xb3, 0x91, 0x11, 0x99, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x19, 0x19, 0x00, 0x00, 0x00, 0x19,
+    0x00, 0x00, 0x29, 0x3b, 0x2b, 0xb0, 0xb4, 0x92, 0x4b, 0x2b, 0x2b, 0x09, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0xb1, 0xa3, 0x21, 0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x11, 0x3a,
+    0x3b, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x21, 0x3b, 0x99, 0xff, 0xff, 0x00, 0x00,
+    0xb1, 0x93, 0x91, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xc3, 0xb4, 0x01, 0x08,
+    0x00, 0x39, 0x2b, 0x2b, 0x19, 0x3a, 0x3b, 0x1a, 0x00, 0x10, 0x2a, 0x09, 0x00, 0x19, 0xa1, 0xb3,
+    0x02, 0x3a, 0x0a, 0xa2, 0x11, 0x09, 0x91, 0x10, 0x19, 0x09, 0x00, 0xb1, 0xb3, 0x03, 0x19, 0x4b,
+    0x3b, 0x2c, 0x3a, 0x2a, 0xb0, 0xb4, 0xb3, 0x91, 0xb1, 0xa3, 0x02, 0x3a, 0x2b, 0x09, 0xa1, 0x92,
+    0x10, 0x3b, 0x2a, 0x99, 0x01, 0x19, 0x19, 0x00, 0x19, 0x90, 0xc3, 0xa3, 0x11, 0x90, 0xb2, 0x93,
+    0x19, 0x09, 0x91, 0x91, 0x10, 0x19, 0x09, 0x10, 0x19, 0x3a, 0x3b, 0x1b, 0x01, 0x29, 0x3b, 0x1a,
+    0x90, 0x91, 0x11, 0x19, 0x19, 0x19, 0x09, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x10, 0x09, 0xb1,
+    0xb4, 0x11, 0x3a, 0xa9, 0xb3, 0xa3, 0x91, 0xb2, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x0a, 0xd3, 0xa3,
+    0xfc, 0xff, 0x02, 0x00, 0x92, 0x10, 0x00, 0x90, 0x91, 0xb2, 0xb3, 0x92, 0x29, 0x0a, 0x91, 0x01,
+    0x19, 0x91, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x3a, 0x1a, 0x29, 0x3b, 0x1a, 0x90, 0x91, 0xb2,
+    0xb3, 0x93, 0x3a, 0x3b, 0x1a, 0x91, 0x39, 0x2b, 0x0a, 0xb3, 0xc3, 0xb3, 0xb4, 0xb3, 0x11, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0xb0, 0xc4, 0xb4, 0x81, 0xa1, 0xc4, 0xb3, 0xb3, 0xb2, 0x01, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x4b, 0x4b, 0x3c, 0x1b, 0x90, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x09,
+    0x10, 0x09, 0xa1, 0xa3, 0x01, 0xa1, 0xa3, 0x20, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x29, 0x3b,
+    0x3b, 0x2b, 0xb0, 0xb4, 0x92, 0x3a, 0x2b, 0x09, 0x90, 0xb2, 0xb3, 0xa3, 0x01, 0x00, 0xa1, 0xb3,
+    0xa3, 0x20, 0x3b, 0x2b, 0x19, 0x09, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x02, 0x3a, 0x3b, 0x3b, 0x2b,
+    0x09, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x00, 0x2b, 0xb0, 0xa3, 0x21, 0x3b, 0x1b, 0xb2, 0xb3,
+    0x92, 0x91, 0x10, 0x19, 0x99, 0x92, 0x3a, 0x3b, 0x2b, 0x09, 0x91, 0x29, 0x1b, 0xb2, 0xa3, 0x20,
+    0x2b, 0x09, 0x29, 0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0x92, 0x3a, 0x1a, 0xa1, 0xa3, 0x01, 0xa1, 0xb3,
+    0xc4, 0xa3, 0x82, 0x19, 0x3a, 0x3b, 0x1a, 0x39, 0x4c, 0x3c, 0x2a, 0x09, 0x19, 0x01, 0xa1, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x19, 0x00, 0x19, 0x19, 0x90, 0x91, 0x01, 0x00,
+    0x29, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x01, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x99,
+    0xb2, 0xb3, 0x21, 0x3b, 0x3b, 0x1a, 0x19, 0x00, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x91,
+    0x91, 0x39, 0x3b, 0x2b, 0x99, 0xa1, 0xa3, 0x91, 0x30, 0x3c, 0x3b, 0x19, 0x29, 0x1a, 0xa1, 0xa3,
+    0x01, 0x00, 0x00, 0x00, 0x19, 0x19, 0x19, 0x19, 0xff, 0xff, 0x00, 0x00, 0x19, 0x29, 0x3b, 0x3b,
+    0x2b, 0x99, 0xb3, 0x92, 0x3a, 0x3b, 0xa9, 0xb3, 0x21, 0x3b, 0x99, 0x91, 0xa1, 0xc3, 0xb4, 0xb3,
+    0x91, 0x29, 0x2b, 0xb0, 0xb4, 0x92, 0x99, 0xb2, 0x92, 0x29, 0x2b, 0x19, 0x3a, 0x2b, 0x99, 0xa2,
+    0x01, 0x90, 0xb2, 0x02, 0x3b, 0x2a, 0xb0, 0xa3, 0x92, 0x00, 0x90, 0x01, 0x90, 0x91, 0x91, 0x91,
+    0xc3, 0xc4, 0xa3, 0x92, 0x90, 0x92, 0x10, 0x99, 0x91, 0x11, 0x3b, 0x3b, 0x19, 0x19, 0x09, 0x91,
+    0x10, 0x4b, 0x3b, 0x3c, 0x3c, 0x1a, 0x19, 0x19, 0x99, 0xd3, 0xb3, 0x93, 0x39, 0x3b, 0x3b, 0x3b,
+    0x1a, 0x19, 0x29, 0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x09, 0x91, 0x91,
+    0x19, 0x00, 0x29, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x3a,
+    0xa9, 0xb3, 0xa3, 0x91, 0xb2, 0xa3, 0x91, 0x91, 0x91, 0xa2, 0x01, 0x39, 0x02, 0x00, 0x00, 0x00,
+    0x3b, 0x2b, 0x99, 0xb1, 0xb5, 0xc3, 0x93, 0x39, 0x3c, 0x2b, 0x91, 0x91, 0x19, 0x19, 0x29, 0x1b,
+    0x91, 0xb3, 0x91, 0x91, 0x01, 0x00, 0x90, 0xa2, 0x01, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0x92, 0x00, 0x90, 0x01, 0x00, 0xb1, 0xa3, 0x02, 0x4b, 0x4c, 0x1b, 0x90, 0xa2, 0x11, 0x19, 0x19,
+    0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0xb1, 0xb4, 0xb3, 0xa1, 0xb3, 0xa3, 0x01, 0x29, 0x3b, 0x2b,
+    0x99, 0xb2, 0x92, 0x29, 0x2b, 0x19, 0x19, 0x99, 0x91, 0x11, 0x99, 0x01, 0x39, 0x3d, 0x2a, 0x09,
+    0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x29, 0x2b, 0x19, 0x19, 0x09, 0x10, 0x09, 0xa1,
+    0xb3, 0x92, 0x19, 0x00, 0x90, 0x01, 0x00, 0x19, 0x00, 0x19, 0x19, 0x90, 0x11, 0x19, 0x99, 0x11,
+    0x5b, 0x2b, 0x1a, 0x19, 0x5b, 0x3b, 0x3c, 0x09, 0x29, 0x19, 0x19, 0x19, 0x99, 0x91, 0x01, 0x19,
+    0xff, 0xff, 0x00, 0x00, 0x91, 0x91, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xa2, 0x01, 0x90,
+    0xb2, 0x02, 0x3b, 0x2a, 0x09, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x2b, 0x09, 0x19, 0x90,
+    0xb2, 0x92, 0x29, 0x2b, 0x99, 0xc3, 0xa3, 0x02, 0x99, 0xc3, 0xb3, 0x93, 0x91, 0xc3, 0xb3, 0x93,
+    0x01, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x11,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0xa0, 0xa3, 0x01, 0x10, 0x19, 0x09, 0xa1,
+    0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x99, 0x01, 0x39, 0x3c, 0x2a, 0x19, 0x3a, 0x3b, 0x3b, 0x2b,
+    0xa0, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x3b, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x39, 0x4c, 0x2b,
+    0x3b, 0x3b, 0x3c, 0x4b, 0x2a, 0x1b, 0x19, 0x90, 0x91, 0x11, 0x3b, 0x09, 0xa1, 0x11, 0x91, 0x91,
+    0x39, 0x2b, 0xb9, 0xb5, 0xfc, 0xff, 0x03, 0x00, 0x92, 0x18, 0xb1, 0xa3, 0x92, 0xb1, 0xa3, 0x21,
+    0x3b, 0x1a, 0x91, 0x00, 0x10, 0x09, 0x10, 0x19, 0x3a, 0x1a, 0x90, 0xa2, 0x91, 0xb2, 0xc4, 0xa3,
+    0x92, 0x20, 0x3b, 0x2b, 0xb0, 0xb4, 0xb3, 0x91, 0x29, 0x3b, 0x2b, 0x99, 0xa2, 0x01, 0x90, 0xc3,
+    0xb3, 0xb5, 0xa2, 0x92, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x91, 0x39, 0x1b,
+    0xb1, 0xb4, 0xa2, 0x91, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x11, 0x3a, 0x2b, 0x09, 0x00, 0x90,
+    0xa2, 0x11, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x4b, 0x3b, 0x3d, 0x3b, 0x2a, 0xa0, 0x92, 0x39, 0x3c,
+    0x2a, 0x09, 0x90, 0x91, 0xb2, 0x92, 0x10, 0x3b, 0x3b, 0x3a, 0x2b, 0x09, 0xa1, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x92, 0x00, 0x90, 0x01, 0x19, 0x19, 0x29, 0x4b, 0x3c, 0x3b, 0x3a, 0x09, 0x00, 0x00,
+    0x10, 0x3a, 0x1a, 0xa1, 0x93, 0x3a, 0x1a, 0xa1, 0xfd, 0xff, 0x00, 0x00, 0xa3, 0x01, 0x10, 0x3a,
+    0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0xb3, 0xa1, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x91, 0x91, 0x19,
+    0x90, 0xb3, 0x01, 0x19, 0x91, 0x10, 0x19, 0x09, 0x91, 0x91, 0x10, 0x3b, 0x09, 0xb1, 0x93, 0x10,
+    0x3b, 0x4b, 0x2b, 0xa9, 0xa3, 0x11, 0x3b, 0x19, 0x19, 0x19, 0x19, 0x3a, 0x3b, 0x2b, 0x09, 0x91,
+    0x90, 0x91, 0xb3, 0x01, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x90, 0x01, 0x29, 0x3b, 0x3b, 0x2b,
+    0x99, 0xb2, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xa3, 0x20, 0x0a, 0xd3, 0xc4, 0xb3, 0x92, 0x91,
+    0x00, 0x99, 0xb2, 0x92, 0x29, 0x0a, 0xb2, 0x02, 0x4b, 0x2b, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x3a, 0x1a, 0xb1, 0x93, 0x19, 0x90, 0x91, 0x91, 0xb2, 0x11, 0x29, 0x2b, 0x99, 0xb2, 0xb3,
+    0xb3, 0x92, 0xb1, 0xb4, 0xb3, 0xa1, 0xb3, 0x02, 0x3a, 0x4c, 0x1b, 0x90, 0xfd, 0xff, 0x00, 0x00,
+    0x92, 0x29, 0x3b, 0x3b, 0x4c, 0x1b, 0xa0, 0xa4, 0xb2, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x29,
+    0x2b, 0x09, 0x29, 0x2b, 0x99, 0xc3, 0xa3, 0x11, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x19,
+    0x99, 0xb2, 0x31, 0x4d, 0x1b, 0x08, 0x29, 0x3b, 0x2b, 0x2b, 0x09, 0x10, 0x3a, 0x1a, 0xa1, 0xb3,
+    0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c, 0x2a, 0x19, 0x19, 0x19, 0x91, 0xa1, 0xb3, 0xb3,
+    0xa3, 0x11, 0x3a, 0x3b, 0xa9, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1b, 0xb3, 0xa2, 0x01, 0x91, 0x10,
+    0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x3a, 0x99, 0xa1, 0x93, 0x3a, 0x4d, 0x2b, 0x89, 0x91,
+    0x39, 0x3b, 0x2b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x99, 0x91, 0xb2, 0x92, 0x00, 0x90, 0xb2, 0xb3,
+    0xb3, 0xc3, 0xb4, 0x01, 0x39, 0x1a, 0x91, 0x39, 0x4d, 0x3c, 0x2b, 0x09, 0x80, 0x18, 0x19, 0x91,
+    0xff, 0xff, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x09, 0x91, 0x91, 0xa1, 0xb3, 0xb3, 0x11, 0x19, 0x90,
+    0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x3a, 0x4b, 0x3c, 0x99, 0xa2, 0x91, 0x91, 0x11, 0x09, 0x91, 0x91,
+    0x29, 0x1a, 0x90, 0x11, 0x19, 0x09, 0x91, 0x10, 0x3a, 0x4b, 0x3c, 0x1a, 0x90, 0x91, 0x19, 0x39,
+    0x2b, 0xa9, 0xb3, 0xa3, 0x11, 0x19, 0x99, 0xb3, 0xa2, 0x11, 0x19, 0x19, 0x99, 0x91, 0x01, 0x90,
+    0x91, 0x01, 0x00, 0x19, 0x00, 0x00, 0x39, 0x3c, 0x2a, 0xb0, 0xc4, 0xb4, 0x92, 0x18, 0x3a, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x10, 0x19, 0x09, 0x91, 0x10, 0x3a, 0x1a, 0x00,
+    0x10, 0x4b, 0x3b, 0x9b, 0xa2, 0x20, 0x3b, 0x1a, 0x00, 0x10, 0x09, 0xa1, 0xb3, 0x21, 0x3b, 0x1b,
+    0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0xb1, 0xb3, 0x93, 0x10, 0x3a, 0x3b,
+    0x3b, 0x0a, 0xb3, 0xb2, 0xfd, 0xff, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0xa1,
+    0xa3, 0x20, 0x1a, 0xb1, 0x93, 0x00, 0x90, 0xb2, 0x02, 0x3a, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x3b,
+    0x2b, 0x99, 0xb2, 0x93, 0x3a, 0x1b, 0xc3, 0xa3, 0x11, 0x29, 0x1a, 0xa1, 0xa3, 0x01, 0xb1, 0xb4,
+    0xd3, 0xb3, 0xa3, 0x92, 0xc2, 0xa3, 0x21, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x01, 0x91, 0xa1, 0xa3, 0x91, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x3a, 0x1a,
+    0xa1, 0x92, 0x00, 0xa1, 0x92, 0x00, 0x00, 0x00, 0x00, 0x39, 0x3d, 0x3b, 0x2a, 0x91, 0x91, 0x00,
+    0x91, 0x91, 0x39, 0x3b, 0x1b, 0x90, 0x91, 0x01, 0x19, 0x19, 0x19, 0x29, 0x4b, 0x3c, 0x3a, 0x3b,
+    0x3a, 0x1a, 0x29, 0x1a, 0x10, 0x19, 0x19, 0x09, 0x29, 0x2b, 0x09, 0x19, 0x90, 0xd3, 0x93, 0x18,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xc3, 0xa3, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+    0x3a, 0x3b, 0x2b, 0xa0, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb2,
+    0xb3, 0xb3, 0x92, 0x91, 0x19, 0x19, 0x19, 0x19, 0x91, 0x91, 0x39, 0x2b, 0x1a, 0x19, 0x29, 0x1a,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x0a, 0xb3,
+    0x01, 0x00, 0xa1, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x02, 0x4b, 0x2b, 0x99, 0xa1, 0x92,
+    0x91, 0x29, 0x3b, 0x1a, 0x00, 0x29, 0x1a, 0x19, 0x19, 0x90, 0xd3, 0xa3, 0x11, 0x2b, 0x1a, 0x39,
+    0x3c, 0x1a, 0xc3, 0xa3, 0x92, 0x90, 0xb2, 0x92, 0x19, 0x90, 0xb2, 0x92, 0xa1, 0x92, 0x91, 0xb1,
+    0xb3, 0xa3, 0x92, 0xb1, 0xb4, 0xc3, 0xb3, 0x93, 0x91, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xa3, 0x11,
+    0x19, 0x19, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0xa1, 0x92, 0x19, 0x19, 0x90, 0xfe, 0xff, 0x00, 0x00,
+    0x91, 0x01, 0x39, 0x3b, 0x2b, 0x1a, 0xb1, 0xb4, 0xb3, 0x91, 0x01, 0x4b, 0x3b, 0x2c, 0x09, 0xc3,
+    0xa3, 0x92, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x90, 0x91, 0x01, 0x00, 0x29, 0x3b, 0x3b,
+    0x3b, 0x1a, 0x00, 0x91, 0x19, 0x19, 0x00, 0x00, 0xb1, 0xb4, 0xc3, 0xa2, 0x03, 0x3a, 0x2b, 0x09,
+    0x10, 0x3a, 0x3b, 0x3b, 0xb9, 0xc4, 0xb4, 0xa2, 0xa2, 0x01, 0x19, 0x09, 0x10, 0x3a, 0x1a, 0x00,
+    0x00, 0xa1, 0xa3, 0x30, 0x3c, 0x3b, 0x19, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x29, 0x1a, 0x19, 0x29,
+    0x1a, 0x39, 0x3c, 0x3b, 0x39, 0x3b, 0x3c, 0x2a, 0x99, 0x30, 0x3b, 0x1b, 0x19, 0x90, 0xb2, 0x92,
+    0x90, 0xb2, 0x92, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x2b, 0x99, 0x91, 0x01, 0x29, 0x3b,
+    0x3b, 0x3b, 0x0a, 0xb2, 0x21, 0x3b, 0x2b, 0x09, 0xa1, 0xa3, 0x01, 0xa1, 0xa3, 0x01, 0xa1, 0xa3,
+    0xfe, 0xff, 0x00, 0x00, 0x01, 0xa1, 0xb3, 0x02, 0x19, 0x09, 0xa1, 0xb3, 0xb3, 0x02, 0x3a, 0x1a,
+    0x00, 0x00, 0xb1, 0xb4, 0xb3, 0x01, 0x3a, 0x2b, 0x90, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xa3, 0x20,
+    0x2b, 0x99, 0x91, 0x91, 0x11, 0x3b, 0x3b, 0x19, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x01, 0x29, 0x3b,
+    0x2b, 0x3a, 0x1a, 0xb1, 0xb3, 0x93, 0xb1, 0xb3, 0xa3, 0x92, 0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x3b,
+    0x1a, 0x10, 0x19, 0x3a, 0x1a, 0x90, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x10,
+    0x3a, 0x3b, 0x1a, 0x00, 0x39, 0x3c, 0x4b, 0x1a, 0x09, 0x10, 0x19, 0x19, 0x19, 0x09, 0x90, 0x91,
+    0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0x21, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x29, 0x3b,
+    0x2b, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2b, 0x09, 0x00, 0x90, 0xb2, 0xa3,
+    0x20, 0x3b, 0x3b, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0xb3,
+    0xb3, 0xb3, 0x92, 0x90, 0x01, 0x39, 0x3c, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0xb2, 0xa3,
+    0x20, 0x3b, 0x3b, 0x0a, 0xb2, 0xa3, 0x91, 0xc3, 0xb3, 0xb5, 0x82, 0x5a, 0x3b, 0x0a, 0x90, 0x11,
+    0x99, 0xb2, 0xb3, 0x92, 0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x3b, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x99,
+    0xb3, 0xb3, 0x91, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x99, 0x91,
+    0x91, 0x91, 0x91, 0xb1, 0xa3, 0x92, 0x90, 0x11, 0x4b, 0x4c, 0x2b, 0x89, 0x91, 0x39, 0x4c, 0x1b,
+    0x80, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x19, 0x3a, 0x1a, 0xb1, 0xb4, 0xa2,
+    0x11, 0x3a, 0x1a, 0xa1, 0x02, 0x3a, 0x3b, 0x4b, 0x3c, 0x2a, 0x3a, 0x09, 0x90, 0xb2, 0xa3, 0x20,
+    0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x1b, 0x91, 0xb3, 0xfe, 0xff, 0x00, 0x00, 0xb3, 0x11, 0x09, 0xb1,
+    0xb4, 0xa2, 0xb2, 0xa3, 0x59, 0x3d, 0x3b, 0x2a, 0x3b, 0x1a, 0x11, 0x19, 0x09, 0x10, 0x4b, 0x5c,
+    0x3b, 0x2b, 0x09, 0xa1, 0x92, 0x91, 0x00, 0x19, 0x90, 0xb2, 0xb3, 0xa3, 0x11, 0x2a, 0xa0, 0xa3,
+    0x01, 0xa1, 0xb3, 0x93, 0x3a, 0x1a, 0x90, 0x11, 0x99, 0x91, 0x01, 0x90, 0xb3, 0x92, 0x3a, 0x1b,
+    0x91, 0x11, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x09, 0xa1, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0x92,
+    0x91, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0x19, 0xb1, 0x93, 0x10, 0x3b, 0x09, 0x91, 0x10, 0x3a,
+    0x3b, 0x3b, 0x2b, 0xb0, 0xb4, 0xa2, 0x20, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x09, 0x91, 0x10, 0x3a,
+    0x3b, 0xa9, 0xa3, 0x11, 0x09, 0x00, 0x00, 0xb1, 0xb4, 0xa2, 0x01, 0x00, 0x00, 0x90, 0x91, 0x91,
+    0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x39, 0x1b, 0x19, 0x19, 0x19, 0x19, 0x90, 0xfe, 0xff, 0x00, 0x00,
+    0xb3, 0x92, 0x3a, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0x11, 0x3b, 0x1a, 0x91, 0x91, 0x91,
+    0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x4b, 0x3c, 0x2a, 0x19, 0x91, 0x91, 0xa1, 0xb3,
+    0xb3, 0xa3, 0x91, 0xc3, 0xb3, 0x93, 0x01, 0x00, 0x00, 0x00, 0x19, 0x29, 0x2b, 0x09, 0x91, 0x29,
+    0x3b, 0x3b, 0x1a, 0xb1, 0xb4, 0xb3, 0x29, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xc4, 0x93, 0x00,
+    0x2b, 0x09, 0x00, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x11, 0x19, 0x3b, 0x19, 0x99, 0xb2, 0xb3, 0x11, 0x19, 0x91, 0x00, 0x00, 0x91, 0x00, 0x10, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x1a, 0x39, 0x4c, 0x3c, 0x89, 0xa1, 0xb2, 0xb3, 0x02, 0x3a, 0x3b, 0x1a, 0xa1,
+    0xa3, 0x91, 0x11, 0x3b, 0x3b, 0x99, 0x91, 0x11, 0x19, 0x09, 0x00, 0xa1, 0xa3, 0x20, 0x2b, 0xb1,
+    0xfd, 0xff, 0x00, 0x00, 0xb3, 0x02, 0x09, 0xa1, 0xa3, 0x30, 0x3c, 0x1a, 0xb2, 0xb3, 0xb3, 0xb3,
+    0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x91, 0x91, 0x10, 0x09, 0x91, 0x91, 0x10, 0x3a, 0x4c,
+    0x1b, 0xb1, 0xb4, 0xa3, 0x39, 0x1b, 0x90, 0x01, 0x19, 0x19, 0xa1, 0xb3, 0x92, 0x10, 0x09, 0x91,
+    0x91, 0x19, 0x91, 0xa1, 0x92, 0x91, 0x00, 0x90, 0xb2, 0xb3, 0x21, 0x3b, 0x3b, 0x99, 0x91, 0x10,
+    0x3b, 0x1a, 0xb2, 0x93, 0x3a, 0x1b, 0x91, 0xa2, 0x11, 0x3a, 0x2b, 0xa0, 0xb3, 0x92, 0x00, 0x00,
+    0x00, 0xa1, 0xa3, 0x11, 0x2a, 0xa0, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x90, 0xc3, 0xa3, 0x11,
+    0x19, 0xa1, 0xd3, 0xb4, 0xb3, 0x91, 0x91, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x21, 0x3b, 0x1b, 0x01,
+    0x29, 0x4b, 0x3c, 0x99, 0xc3, 0x92, 0x11, 0x09, 0xb1, 0xb3, 0x93, 0x91, 0x91, 0x00, 0xa1, 0xb3,
+    0xb3, 0xb3, 0x92, 0x29, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x2b, 0x99, 0x11, 0x3b, 0x1a, 0x91,
+    0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0x01, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0xb3,
+    0xb3, 0x92, 0xb1, 0xa3, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x90, 0x91, 0x10, 0x19, 0x99,
+    0xb3, 0x01, 0x39, 0x3b, 0x3c, 0x1a, 0x01, 0x19, 0x19, 0x19, 0x39, 0x1b, 0x19, 0x29, 0x2b, 0x19,
+    0x4b, 0x3b, 0x2c, 0x09, 0xb3, 0xb2, 0xb3, 0xb3, 0x02, 0x3b, 0x2a, 0x99, 0x01, 0x29, 0x3b, 0x0a,
+    0xb2, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0x00, 0x90, 0xb2, 0x92, 0x19, 0x90,
+    0xb3, 0x01, 0x39, 0x1b, 0x90, 0xb3, 0x92, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x1a,
+    0x39, 0x2b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c, 0x2a, 0x19, 0x19, 0xb1, 0xb3, 0xb3,
+    0xa3, 0x11, 0x19, 0xb1, 0x93, 0x91, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x3b, 0x99, 0xb2,
+    0xb3, 0x11, 0x90, 0xd3, 0xa3, 0x92, 0x10, 0x19, 0x90, 0x91, 0x91, 0xb2, 0x93, 0x3a, 0x3b, 0x1b,
+    0x01, 0x29, 0x3b, 0x99, 0x91, 0x39, 0x1b, 0x00, 0x19, 0x90, 0xa2, 0x10, 0x90, 0xc3, 0xa3, 0x02,
+    0x4b, 0x2b, 0xb9, 0xb4, 0x92, 0x99, 0xb2, 0x21, 0x4b, 0x3c, 0x09, 0xb0, 0xb3, 0xa3, 0x20, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x91, 0xb2,
+    0xa3, 0x91, 0xc3, 0xa3, 0x21, 0x3b, 0x3b, 0x4b, 0x4d, 0x1a, 0x90, 0x91, 0x91, 0x92, 0x29, 0x3b,
+    0x3b, 0x1a, 0x19, 0x00, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0xc3, 0xb3, 0x93, 0x01, 0x10, 0x19, 0x09,
+    0x91, 0x19, 0x39, 0x2b, 0x1a, 0xa1, 0xb3, 0xa3, 0x11, 0x09, 0x10, 0x19, 0x09, 0x91, 0x10, 0x3a,
+    0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x90, 0x01, 0x29, 0x01, 0x00, 0x00, 0x00,
+    0x2b, 0x19, 0x3a, 0x2b, 0x19, 0x3b, 0x2a, 0x19, 0x19, 0x09, 0x19, 0x90, 0xb2, 0x92, 0xa1, 0x92,
+    0x91, 0x90, 0x11, 0x3b, 0x4b, 0x1b, 0x00, 0x10, 0x09, 0x10, 0x3a, 0x3b, 0x2b, 0xa0, 0xb3, 0x92,
+    0x00, 0x00, 0x29, 0x1a, 0xa1, 0xa3, 0x01, 0xa1, 0xa3, 0x30, 0x3c, 0x3b, 0x29, 0x3b, 0x1a, 0x00,
+    0x91, 0x91, 0x10, 0x3b, 0x1a, 0xb2, 0xb3, 0x92, 0x19, 0x29, 0x2b, 0x19, 0x09, 0x19, 0x90, 0xb2,
+    0xb3, 0x92, 0x19, 0x19, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x09, 0x19, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x19, 0x29, 0x3b, 0x1a, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x00, 0x00, 0xa1, 0xb3,
+    0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0xa1, 0xa3, 0x01, 0x00, 0x00, 0x19, 0x90, 0xb3, 0xb3, 0x11, 0x19,
+    0x19, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x99, 0xb2, 0x92, 0x00, 0xa1, 0x02, 0x4b,
+    0x03, 0x00, 0x02, 0x00, 0x2b, 0xb9, 0xa3, 0xb3, 0x92, 0x00, 0x90, 0xb3, 0xb2, 0xa3, 0x11, 0x3a,
+    0x3b, 0x3b, 0x1a, 0xb1, 0xb4, 0x92, 0x19, 0x19, 0x99, 0xb3, 0xb3, 0x01, 0x10, 0x09, 0x91, 0x10,
+    0x3a, 0x3b, 0x3b, 0x99, 0x91, 0x19, 0x19, 0x29, 0x4b, 0x3c, 0x89, 0x91, 0x19, 0x09, 0x29, 0x3b,
+    0x2b, 0x99, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0x01, 0x29, 0x2b, 0xa0, 0xa3, 0x11, 0x4b, 0x3b,
+    0x2c, 0x19, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0xa2, 0x11, 0x3a, 0x1a, 0xa1, 0xb3, 0x93, 0x19,
+    0x19, 0x09, 0x19, 0x00, 0x90, 0x01, 0x00, 0x90, 0x01, 0x29, 0x3b, 0x3b, 0xa9, 0xb3, 0xb3, 0xa3,
+    0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x00, 0x91, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92,
+    0x19, 0x90, 0x91, 0x01, 0x19, 0x19, 0x90, 0x01, 0x29, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0xc4, 0xa3,
+    0x92, 0x10, 0x19, 0x00, 0xff, 0xff, 0x00, 0x00, 0x19, 0x91, 0x91, 0x39, 0x1b, 0x19, 0x91, 0x90,
+    0x91, 0xc3, 0xa3, 0x21, 0x2b, 0x99, 0x01, 0x29, 0x1b, 0xb2, 0xc5, 0xa3, 0x11, 0x3b, 0x3b, 0x1b,
+    0x19, 0x91, 0x91, 0xa1, 0xb3, 0xc4, 0x93, 0x00, 0xa9, 0xb3, 0xb3, 0xa3, 0x91, 0x11, 0x19, 0x09,
+    0xb1, 0xb3, 0x93, 0x91, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x1b, 0x91, 0x11, 0x3b, 0x99, 0xb3, 0xa2,
+    0x91, 0xb3, 0xa2, 0x91, 0x11, 0x19, 0x09, 0xa1, 0xb3, 0xc4, 0xb3, 0xb4, 0xb2, 0x92, 0x10, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x19, 0x19, 0x39, 0x3b, 0x2b,
+    0x3b, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x30, 0x3c, 0x1a, 0x11, 0x4b, 0x2b, 0x3b, 0x3b, 0x2b, 0x90,
+    0x00, 0x29, 0x1a, 0x19, 0x29, 0x1a, 0x19, 0x10, 0x99, 0x91, 0x01, 0x90, 0x91, 0xb3, 0x01, 0x19,
+    0x19, 0x90, 0x91, 0x01, 0x19, 0x19, 0x19, 0x19, 0xff, 0xff, 0x00, 0x00, 0x19, 0x29, 0x1a, 0x19,
+    0x00, 0x91, 0x10, 0x5b, 0x3b, 0x3c, 0x09, 0x98, 0xa2, 0x91, 0x91, 0xb3, 0x91, 0x91, 0x01, 0x19,
+    0x19, 0x29, 0x3b, 0x99, 0x91, 0x00, 0x91, 0x10, 0x3a, 0x1a, 0x19, 0x29, 0x1a, 0xb1, 0xb5, 0x92,
+    0x18, 0x90, 0xb3, 0x91, 0xb2, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0xa1, 0x92, 0x19,
+    0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0x00, 0x10, 0x4b, 0x4c, 0x3b, 0x3c, 0x89, 0x91, 0x10,
+    0x3a, 0x3b, 0x3b, 0x1b, 0x91, 0x11, 0x3b, 0x99, 0xb3, 0x92, 0x3a, 0x1a, 0x91, 0x10, 0x3a, 0x99,
+    0x10, 0x3a, 0x3b, 0x1a, 0x29, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0x90, 0xc3, 0xb3, 0xa4, 0x01,
+    0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x2b, 0x09, 0x29, 0x2b, 0x09, 0x00,
+    0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x11, 0x90, 0xb2, 0xb3, 0xfd, 0xff, 0x00, 0x00,
+    0x92, 0x29, 0x2b, 0x99, 0x01, 0x19, 0x19, 0xb1, 0xb3, 0x93, 0x19, 0x19, 0x00, 0x19, 0x00, 0x00,
+    0x39, 0x3c, 0x2a, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0xd3, 0xb3, 0xa3, 0x93, 0x29,
+    0x3b, 0x3b, 0x4c, 0x0a, 0xc1, 0xb4, 0xa3, 0xa2, 0xa3, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x10, 0x4b,
+    0x2b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0x02, 0x2a, 0x99, 0xa2, 0x20,
+    0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x09, 0xa1, 0xa3, 0x11,
+    0x09, 0x00, 0x91, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x2b, 0x09, 0x10, 0x3a, 0x1a, 0x91, 0x91, 0x00,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3,
+    0x92, 0xa1, 0x92, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2,
+    0xfd, 0xff, 0x00, 0x00, 0x02, 0x3a, 0x3b, 0x3b, 0x0a, 0xb2, 0x21, 0x3b, 0x3b, 0x99, 0x91, 0x91,
+    0x90, 0x01, 0x29, 0x3b, 0x2b, 0x19, 0x09, 0x91, 0x91, 0x10, 0x99, 0x91, 0xb2, 0x92, 0x91, 0x90,
+    0x91, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x0a,
+    0xb2, 0x02, 0x3b, 0x2a, 0x09, 0x00, 0x19, 0x00, 0x10, 0x4b, 0x3b, 0x0b, 0x00, 0x00, 0x90, 0xb2,
+    0xb3, 0x21, 0x3b, 0x3b, 0x1b, 0xb2, 0x92, 0xb1, 0xc4, 0xb4, 0xb2, 0xa3, 0x91, 0x19, 0x90, 0x91,
+    0x01, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x19, 0x19, 0x90, 0x11, 0x3a, 0x1b, 0xc3, 0xa3, 0x21, 0x2b,
+    0x99, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x91, 0x90, 0xb2,
+    0x92, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x19, 0xb1, 0xb5, 0xb3, 0x30, 0x3d, 0x4b, 0x2b,
+    0x1a, 0xb1, 0xc3, 0xb4, 0xfc, 0xff, 0x03, 0x00, 0xb3, 0x30, 0x3d, 0x3b, 0x09, 0xb2, 0x21, 0x3b,
+    0x2b, 0x99, 0x91, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xd3, 0xb4, 0xa2, 0x81, 0x90, 0x19, 0x90,
+    0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x90, 0x01,
+    0x90, 0xb2, 0xb3, 0x93, 0x19, 0x2a, 0x99, 0xb2, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92,
+    0x91, 0x91, 0x19, 0x19, 0xb1, 0x93, 0x39, 0x2b, 0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x20, 0x3b, 0x0a, 0xb2, 0x92, 0x90, 0x91, 0x01,
+    0x19, 0x19, 0x39, 0x3d, 0x4b, 0x1b, 0x18, 0x1a, 0x19, 0x19, 0x19, 0x91, 0x91, 0x91, 0xb1, 0xc4,
+    0xb4, 0x92, 0x18, 0x3a, 0x3a, 0x2b, 0x99, 0xd3, 0xa3, 0x11, 0x3b, 0x0b, 0xb2, 0xb3, 0x92, 0x10,
+    0x19, 0x09, 0x10, 0x19, 0x3a, 0x1a, 0xa1, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0xb3, 0xb3, 0xb3, 0x92,
+    0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0xb1, 0xb3, 0xa3, 0x92, 0x91, 0x91, 0x91, 0xa1, 0x11,
+    0x29, 0x2b, 0x19, 0x99, 0xb2, 0x92, 0x19, 0x00, 0x90, 0x91, 0xb2, 0x92, 0x91, 0x90, 0x91, 0xb2,
+    0x92, 0x91, 0xb1, 0xb3, 0xb3, 0x93, 0x91, 0x19, 0x10, 0x19, 0x09, 0x00, 0xa1, 0xb3, 0xb3, 0x11,
+    0x19, 0x90, 0x91, 0x01, 0x90, 0x91, 0x01, 0x19, 0x19, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x10, 0x3a, 0x3b, 0x1a, 0x39, 0x3b, 0x2b, 0x1a, 0xb1, 0x93, 0x10, 0x19, 0x3a, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x2b, 0x19, 0x99, 0x91, 0x01, 0x19, 0x19, 0x19, 0x29, 0x3b, 0x2b, 0xa0, 0x92, 0x29, 0x2b,
+    0x09, 0x91, 0x91, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x10, 0x2a, 0x09, 0x90, 0x91, 0xb2, 0x92,
+    0x90, 0xb2, 0xb3, 0x92, 0x90, 0x91, 0x01, 0x19, 0x19, 0x29, 0x3b, 0x2b, 0x00, 0x00, 0x00, 0x00,
+    0xb0, 0x93, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x1b, 0x91, 0x01, 0x19,
+    0x91, 0x91, 0x39, 0x1b, 0xa1, 0xb3, 0x92, 0xa1, 0xb3, 0x92, 0x39, 0x1b, 0x19, 0x19, 0x90, 0x11,
+    0x3a, 0x2b, 0xa0, 0xa3, 0x11, 0x3a, 0x3b, 0x2b, 0xb1, 0xa3, 0x20, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x2a, 0x99, 0xc3, 0xa3, 0x92, 0x19, 0x00, 0x19, 0x39, 0x1b, 0x19, 0x19,
+    0x91, 0x91, 0xa1, 0xb3, 0x93, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x29, 0x4b, 0x3c, 0x1a, 0x90,
+    0x10, 0x19, 0x19, 0x19, 0x99, 0xb3, 0x92, 0x3a, 0x4b, 0x3c, 0x2a, 0x19, 0x19, 0x91, 0x91, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x19, 0x19, 0x19, 0x91, 0x91, 0x91, 0x91, 0x39, 0x3c, 0x2a, 0x99, 0xb2,
+    0xb3, 0xb3, 0x92, 0x10, 0x09, 0x19, 0x29, 0x3b, 0x1b, 0xd3, 0xc4, 0x92, 0x00, 0x19, 0x29, 0x1b,
+    0xff, 0xff, 0x00, 0x00, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x20,
+    0x3b, 0x3b, 0x3b, 0x1a, 0x00, 0xa1, 0xb3, 0xb3, 0x92, 0x00, 0x91, 0x90, 0x11, 0x19, 0x2a, 0x19,
+    0x4b, 0x3b, 0x0b, 0x10, 0x4b, 0x2b, 0x1a, 0x00, 0x00, 0x10, 0x09, 0x00, 0x10, 0x09, 0x00, 0x00,
+    0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x3a,
+    0x1a, 0x19, 0x10, 0x19, 0x3a, 0x3b, 0x4b, 0x3c, 0x4b, 0x2b, 0x1a, 0x90, 0x10, 0x09, 0xa1, 0x93,
+    0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x0a, 0xa2, 0x01, 0x90, 0xb3,
+    0xa2, 0x11, 0x19, 0x2a, 0x19, 0x19, 0x2a, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x00, 0x90, 0x01, 0x90,
+    0xb2, 0x92, 0x19, 0xb1, 0xa3, 0x92, 0x19, 0x90, 0xb2, 0x92, 0xa1, 0x92, 0x91, 0x90, 0x01, 0x29,
+    0x2b, 0x99, 0xa2, 0x10, 0xff, 0xff, 0x00, 0x00, 0x29, 0x2b, 0x19, 0x99, 0xb3, 0xb3, 0x11, 0x19,
+    0x19, 0x19, 0x99, 0x11, 0x5b, 0x2b, 0x89, 0x01, 0x39, 0x3d, 0x3b, 0x3a, 0x19, 0x19, 0x3a, 0x1b,
+    0x91, 0x01, 0x19, 0x19, 0x19, 0x19, 0x19, 0x39, 0x1b, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x00,
+    0xb1, 0xb4, 0x92, 0x99, 0xb2, 0x92, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x19, 0x29,
+    0x3b, 0x3b, 0x1a, 0x29, 0x4b, 0x3c, 0x99, 0xb3, 0x19, 0x19, 0x90, 0xb2, 0xb3, 0x93, 0x19, 0x2a,
+    0x19, 0x2a, 0x99, 0xb2, 0x92, 0xa1, 0x92, 0x00, 0xb1, 0xb4, 0xa2, 0x20, 0x3b, 0x3b, 0x3b, 0x1a,
+    0xa1, 0x92, 0x10, 0x3a, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0x01, 0x00,
+    0x19, 0x90, 0xb2, 0xb3, 0x92, 0x91, 0x10, 0x3b, 0x09, 0x91, 0x10, 0x19, 0x09, 0x91, 0x91, 0x00,
+    0xa1, 0xb3, 0x92, 0x00, 0x19, 0x29, 0x2b, 0x99, 0xfe, 0xff, 0x00, 0x00, 0x01, 0x29, 0x3b, 0x3b,
+    0x5c, 0x2b, 0x0a, 0x91, 0x20, 0x3b, 0x2b, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x90,
+    0xa2, 0x01, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0xa3, 0x01, 0x90, 0xc3, 0xa3, 0x92, 0x19, 0x19, 0x90,
+    0x91, 0x91, 0x91, 0x91, 0x91, 0xb3, 0x92, 0x3a, 0x4c, 0x1b, 0xb1, 0xb4, 0xb3, 0xb3, 0xa2, 0x91,
+    0x91, 0xa2, 0x91, 0x01, 0x10, 0x3a, 0x1a, 0xa1, 0x12, 0x3b, 0x3b, 0x2a, 0x2b, 0x99, 0xa2, 0x20,
+    0x2b, 0xb0, 0xa3, 0x92, 0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0x90, 0x91, 0x91, 0x91, 0x91, 0x11, 0x3b,
+    0x3b, 0x3a, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xa3, 0x20, 0x2b, 0x99, 0xb2, 0x92, 0x91, 0x90, 0xb2, 0xb3, 0xb3, 0xa3, 0x11, 0x09, 0x91,
+    0x10, 0x19, 0x09, 0x91, 0x29, 0x3b, 0x0a, 0xb2, 0xb3, 0x92, 0x91, 0x90, 0xfe, 0xff, 0x00, 0x00,
+    0x91, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0xa3, 0x11, 0x09, 0x91, 0x91, 0x91,
+    0x91, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x00, 0x19, 0x29, 0x2b, 0x19, 0x19, 0x09,
+    0x91, 0x19, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a,
+    0xa1, 0xb3, 0xb3, 0x93, 0x99, 0x01, 0x00, 0x90, 0xa2, 0x20, 0x2b, 0x09, 0x10, 0x3a, 0x1a, 0x91,
+    0x10, 0x3a, 0x2b, 0x09, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x91, 0xb2, 0xb3, 0x92, 0x19, 0xb1, 0xb4,
+    0xb3, 0xa1, 0xb3, 0x92, 0x29, 0x3b, 0x2b, 0x19, 0x5b, 0x4c, 0x1a, 0x90, 0xa2, 0x91, 0x92, 0x19,
+    0x19, 0x19, 0x39, 0x3b, 0x2b, 0x1a, 0x91, 0x91, 0x91, 0x91, 0xa1, 0x92, 0x91, 0x90, 0x91, 0x01,
+    0x39, 0x3d, 0x4b, 0x3b, 0x3c, 0x09, 0x29, 0x3a, 0x1a, 0xb1, 0xb4, 0xb3, 0x91, 0x19, 0x00, 0x90,
+    0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x19, 0x09, 0xb1, 0xb3, 0xa3,
+    0xb3, 0x93, 0x19, 0x1a, 0xb2, 0xb3, 0x92, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x39, 0x3d, 0x3b, 0x09,
+    0x01, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x19, 0xb1, 0xb3, 0x03,
+    0x3b, 0x1a, 0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x19, 0x91,
+    0x91, 0x39, 0x3b, 0x2b, 0x1a, 0xa1, 0xa3, 0x11, 0x2a, 0xa0, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x29,
+    0x3b, 0x3b, 0x2b, 0x99, 0x91, 0x01, 0x19, 0x19, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x3b, 0x3b,
+    0x2a, 0x19, 0x99, 0xb2, 0x02, 0x4b, 0x2b, 0x0a, 0xc3, 0xc4, 0xa3, 0x92, 0x29, 0x1a, 0x91, 0x10,
+    0x09, 0x00, 0x10, 0x3a, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x91, 0xa1, 0x92, 0x29, 0x0a, 0x01, 0x29,
+    0x1b, 0xb2, 0xc4, 0xa3, 0xfc, 0xff, 0x02, 0x00, 0x01, 0x19, 0x2a, 0x19, 0x09, 0x90, 0xb2, 0xb3,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x09, 0xa1, 0xb3, 0x02, 0x3a, 0x1a, 0x00,
+    0x00, 0xa1, 0x92, 0x00, 0x90, 0x01, 0x00, 0x90, 0xb2, 0x92, 0x00, 0x90, 0x01, 0x00, 0x00, 0x00,
+    0x10, 0x09, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0xc3, 0xc4, 0x93, 0x18, 0x2a, 0x99, 0x91, 0x29, 0x3b,
+    0x2b, 0x09, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x19, 0x09, 0xb1, 0xb3, 0x93, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x20, 0x3b, 0x3b, 0x1a, 0x00, 0x10, 0x99, 0xc3, 0xa3, 0x21, 0x3b,
+    0x2b, 0x09, 0x10, 0x4b, 0x2b, 0x1a, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0x11, 0x2a, 0x99, 0x11, 0x4b,
+    0x2b, 0xb9, 0xa3, 0x92, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x4b, 0x3c, 0x1a, 0x90, 0x91,
+    0xa1, 0xb3, 0x11, 0x39, 0x2b, 0x1a, 0x91, 0x10, 0x00, 0x00, 0x00, 0x00, 0x19, 0x09, 0x10, 0x19,
+    0x09, 0x10, 0x19, 0x09, 0x10, 0x3b, 0x3b, 0x99, 0xb2, 0xb3, 0x92, 0xb1, 0xb4, 0xb3, 0xa1, 0xa3,
+    0x30, 0x3c, 0x1a, 0xc3, 0xa3, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x19, 0x39, 0x3b, 0x2b, 0x3b, 0x1a,
+    0x09, 0xb2, 0xb3, 0xb3, 0xa3, 0x91, 0x01, 0x91, 0xb1, 0xa3, 0x92, 0x90, 0xb2, 0x92, 0x19, 0x90,
+    0x91, 0x01, 0x19, 0x19, 0x29, 0x3b, 0x2b, 0x09, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0xb0, 0x93, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b,
+    0xb0, 0xb4, 0x21, 0x3d, 0x2a, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x10, 0x19, 0x90,
+    0xb2, 0xb3, 0xa3, 0x20, 0x0a, 0xd3, 0xa3, 0x92, 0x91, 0xb2, 0xb3, 0xb3, 0xa3, 0x30, 0x3c, 0x3b,
+    0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x19, 0x19, 0x00, 0x29, 0x2b, 0xa0, 0xfd, 0xff, 0x00, 0x00,
+    0xa3, 0x11, 0x09, 0x91, 0xa1, 0xa3, 0x11, 0x2a, 0x09, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x10, 0x19,
+    0x19, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x91, 0x10, 0x99, 0x91, 0xa2, 0x11, 0x3a, 0x3b, 0x1a, 0x91,
+    0x91, 0x91, 0x29, 0x2b, 0x99, 0x01, 0x19, 0x19, 0x00, 0x19, 0x00, 0x00, 0x29, 0x2b, 0x09, 0x29,
+    0x3b, 0x0a, 0xb2, 0xa3, 0x01, 0x00, 0x10, 0x4b, 0x2b, 0x0a, 0xa2, 0x91, 0x01, 0xa1, 0xb3, 0xb3,
+    0xb3, 0x92, 0x90, 0x91, 0x01, 0x19, 0x19, 0x91, 0x91, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0x00,
+    0xb1, 0xa3, 0x02, 0x4b, 0x3b, 0x0b, 0x00, 0x10, 0x09, 0x90, 0xb2, 0xb3, 0x11, 0x29, 0x3b, 0x99,
+    0x91, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x02, 0x3a, 0x2b, 0xb0, 0xa3, 0x92, 0x90, 0xb2, 0x02, 0x09,
+    0x00, 0x91, 0x91, 0x10, 0x19, 0x19, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0xb3, 0x92, 0x3a,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x99, 0x91, 0x19, 0x00, 0x00, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x90, 0xc3, 0xb3, 0xb5, 0xa3, 0x10, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c,
+    0x2a, 0x29, 0x3b, 0x1a, 0x19, 0x29, 0xa9, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0x92, 0x00, 0x90, 0x01,
+    0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0xb3,
+    0x92, 0x00, 0x90, 0xa2, 0x20, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x39,
+    0x4c, 0x2b, 0x3b, 0x1b, 0x19, 0x29, 0x1a, 0x90, 0x91, 0x01, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x91, 0x91, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0xb1,
+    0xb4, 0x92, 0x09, 0x91, 0x90, 0x91, 0x01, 0x19, 0x00, 0x00, 0x29, 0x3b, 0x0a, 0xb2, 0x92, 0x90,
+    0xb2, 0xb3, 0xb3, 0x92, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x1b, 0x11, 0x3b, 0x1a, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x09, 0x90, 0x01, 0x29,
+    0x3b, 0x3b, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00,
+    0x00, 0xa1, 0xb3, 0x93, 0x3a, 0x3b, 0x1a, 0x19, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x29, 0x1a,
+    0x90, 0xc3, 0xb3, 0xb5, 0xa2, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0xa0, 0xb3, 0xb3, 0xa3, 0x01,
+    0xa1, 0xb3, 0x02, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x99, 0x91, 0x91, 0xb1,
+    0x93, 0x91, 0x10, 0x19, 0x19, 0x19, 0x19, 0x99, 0x11, 0x19, 0x1a, 0x91, 0xb2, 0xb3, 0x02, 0x4b,
+    0x2b, 0x3b, 0x5c, 0x3c, 0x2b, 0x19, 0x19, 0x4a, 0x3b, 0x3d, 0x1a, 0x08, 0x10, 0x09, 0x10, 0x3a,
+    0x1a, 0x19, 0x10, 0x3a, 0x3b, 0x1a, 0x10, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x1a, 0x91, 0x10,
+    0x3a, 0x3b, 0x1a, 0xb1, 0xa3, 0x21, 0x3b, 0x1b, 0x91, 0x91, 0x11, 0x19, 0x19, 0x99, 0x91, 0x01,
+    0x90, 0x91, 0x01, 0x19, 0x19, 0x29, 0x3b, 0x2b, 0x19, 0x2a, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x01, 0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0xa1, 0xa3, 0x91, 0x91, 0x01, 0x90, 0x91,
+    0x01, 0x19, 0x90, 0x91, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0x02, 0x3b, 0x1a, 0xb2, 0x92, 0x39,
+    0x1b, 0x90, 0xb2, 0x92, 0x91, 0x19, 0x19, 0x19, 0x29, 0x1a, 0x19, 0x10, 0x3a, 0x3b, 0x1a, 0x19,
+    0x19, 0x91, 0x91, 0x10, 0x19, 0x09, 0x91, 0x91, 0x19, 0xb1, 0xb4, 0x92, 0x19, 0x99, 0xc3, 0xc4,
+    0xa3, 0x92, 0x00, 0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x1a, 0x10, 0x3a, 0x1a, 0x10, 0x3a, 0x2b,
+    0x09, 0x19, 0x19, 0x90, 0xb3, 0x01, 0x29, 0x3b, 0x2b, 0xa0, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0xb3, 0xb3, 0xb3, 0x93, 0x19, 0x3b, 0x3b, 0x1a, 0x91, 0x11, 0x4b, 0x2b, 0xa9, 0xa3, 0x91,
+    0x91, 0xc3, 0xb3, 0x03, 0x29, 0x1a, 0x90, 0x11, 0x09, 0x90, 0xb3, 0xa2, 0x39, 0x3b, 0x3b, 0x2b,
+    0xa0, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x91, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0x91, 0x91, 0x19,
+    0x00, 0x00, 0x29, 0x1a, 0x00, 0x00, 0x91, 0x91, 0x10, 0x19, 0x19, 0x09, 0x91, 0x91, 0x91, 0x91,
+    0x19, 0x90, 0x01, 0x19, 0x19, 0x29, 0x3b, 0x2a, 0x2b, 0x99, 0xb2, 0x92, 0x90, 0xb2, 0xb3, 0x02,
+    0x3a, 0x0a, 0xa2, 0x01, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0x12, 0x4b, 0x4d, 0x3b, 0x1a, 0x08, 0x29,
+    0x2b, 0x2b, 0x09, 0x00, 0x10, 0x3a, 0x1a, 0x19, 0x19, 0xb1, 0x93, 0x10, 0x09, 0x00, 0x91, 0x00,
+    0x10, 0x09, 0xa1, 0xb3, 0xb3, 0x21, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x3b, 0x1b,
+    0xfe, 0xff, 0x00, 0x00, 0xb2, 0xb3, 0x92, 0x19, 0x29, 0x0a, 0xb2, 0xb3, 0xb3, 0x92, 0xa1, 0x92,
+    0x29, 0x3b, 0x3b, 0x2b, 0x09, 0x10, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0x11,
+    0x19, 0x09, 0x91, 0x91, 0x10, 0x5b, 0x3b, 0x0b, 0xb3, 0xb3, 0x11, 0x99, 0x91, 0x01, 0x90, 0x01,
+    0x29, 0x2b, 0x19, 0x19, 0x1a, 0xb2, 0xb3, 0x92, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x10,
+    0x09, 0x91, 0x91, 0x10, 0x19, 0x3b, 0x99, 0xd3, 0xb4, 0xb2, 0x82, 0x39, 0x0a, 0xa2, 0x01, 0x00,
+    0x10, 0x5b, 0x3c, 0x3a, 0x3b, 0x4b, 0x3b, 0x3b, 0x2b, 0x1a, 0x90, 0x11, 0x19, 0x19, 0x3a, 0x3b,
+    0x1a, 0xa1, 0xb3, 0xc4, 0xa3, 0x92, 0x01, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0x01, 0x39,
+    0x1b, 0x90, 0x91, 0x91, 0x01, 0x39, 0x3d, 0x2a, 0x19, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x90, 0xfe, 0xff, 0x00, 0x00, 0xa2, 0x01, 0x19, 0xa1, 0x92, 0x91, 0x90, 0xb2,
+    0xb3, 0xa3, 0x10, 0x39, 0x3c, 0x4b, 0x2a, 0x2b, 0x3b, 0x2b, 0x19, 0x19, 0x99, 0xb2, 0x92, 0x01,
+    0x4b, 0x3c, 0x19, 0x19, 0x19, 0x19, 0x90, 0x01, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0x93,
+    0xb0, 0xc4, 0xb4, 0xa2, 0x01, 0x29, 0x99, 0xb2, 0xb3, 0xa3, 0x91, 0xa2, 0x11, 0x4b, 0x2b, 0x99,
+    0xa1, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x39, 0x4d, 0x3c, 0x2b, 0x19, 0x19, 0x3a, 0x09, 0x00, 0x00,
+    0x90, 0xb2, 0xb3, 0x92, 0x00, 0x29, 0x2b, 0x19, 0x19, 0x5b, 0x3b, 0x2b, 0x1b, 0x09, 0xb3, 0xa2,
+    0x30, 0x1b, 0x00, 0x91, 0x10, 0x3a, 0x2b, 0xb1, 0xb3, 0x93, 0x3a, 0x1a, 0x19, 0x19, 0x19, 0x19,
+    0x19, 0x91, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2b, 0x99, 0xa2, 0x10,
+    0x29, 0x3b, 0x3b, 0x4c, 0x2b, 0x89, 0x91, 0x01, 0xff, 0xff, 0x00, 0x00, 0x91, 0xa1, 0xa3, 0x01,
+    0x19, 0x19, 0x91, 0x90, 0xb2, 0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x19, 0x91, 0x10, 0x3b, 0x3b, 0x99,
+    0x91, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x01, 0x29, 0x3b, 0x3b, 0x0a, 0x01, 0x29, 0x3b, 0x2b, 0x19,
+    0x3a, 0x1a, 0x00, 0x10, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x3b, 0x4b,
+    0x3c, 0x3a, 0x3b, 0x09, 0xb1, 0x93, 0x91, 0x91, 0x91, 0x19, 0x90, 0xb3, 0xb3, 0xc3, 0xc4, 0xa3,
+    0x92, 0x90, 0x11, 0x39, 0x2b, 0x1a, 0x19, 0x29, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x09,
+    0xa1, 0xa3, 0x11, 0x2a, 0xa0, 0xa3, 0x30, 0x3c, 0x3b, 0x90, 0xa2, 0x01, 0x19, 0x00, 0x29, 0x3b,
+    0x3b, 0x3b, 0x2b, 0xa0, 0xb3, 0xa3, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x01, 0x00, 0x00, 0x00,
+    0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x0a, 0xc3, 0xa3, 0x31, 0x3c, 0x2a, 0x19, 0x3a, 0x99, 0x91, 0x91,
+    0x19, 0x19, 0x90, 0x11, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x00, 0xa1, 0xb3, 0x02, 0x3a,
+    0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x3b,
+    0x2b, 0x19, 0x3a, 0x2b, 0x19, 0x2a, 0x99, 0x01, 0x90, 0x91, 0x01, 0x29, 0x3b, 0x1b, 0xc3, 0xb3,
+    0x13, 0x3a, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0xa2, 0x11, 0x4b, 0x1b, 0xa1,
+    0x93, 0x19, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x90, 0x01,
+    0x19, 0x90, 0x91, 0x01, 0x19, 0x39, 0x1b, 0xa1, 0x93, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3,
+    0x02, 0x3a, 0x2b, 0x90, 0x29, 0x3b, 0xb9, 0xb4, 0x92, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x9a, 0xb3, 0xb3, 0x92, 0x00, 0x29,
+    0x3b, 0x1a, 0x00, 0x00, 0x91, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3, 0x93, 0x19, 0x3b, 0x1a, 0xb2,
+    0xc3, 0xb4, 0x01, 0x29, 0x99, 0x91, 0xb2, 0x92, 0x91, 0x29, 0x3b, 0x3b, 0x99, 0xb1, 0xb3, 0xa3,
+    0x11, 0x90, 0x91, 0x01, 0x90, 0x91, 0x01, 0x90, 0x91, 0x01, 0x19, 0x19, 0x90, 0x91, 0xb2, 0xb3,
+    0xb3, 0x92, 0x91, 0x91, 0x10, 0x09, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0xc4, 0xa3, 0x11, 0x3b,
+    0x1b, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x4b, 0x2b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b,
+    0x99, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0x01, 0x90, 0x91, 0xb2, 0x92, 0x91, 0x29, 0x4b, 0x3c,
+    0x89, 0x91, 0x19, 0x19, 0x09, 0x19, 0x19, 0x19, 0x19, 0x19, 0x29, 0x3b, 0x2b, 0x99, 0x01, 0x90,
+    0x91, 0xb2, 0xb3, 0x92, 0xff, 0xff, 0x00, 0x00, 0x39, 0x2b, 0x3b, 0x1a, 0x90, 0x01, 0x91, 0xa1,
+    0xa3, 0x91, 0x91, 0x11, 0x3a, 0x3b, 0x1a, 0x10, 0x5b, 0x3c, 0x2a, 0x09, 0x28, 0x3b, 0x3b, 0x3b,
+    0x3b, 0x1b, 0xb2, 0xb3, 0xa3, 0x91, 0x91, 0x91, 0x11, 0x99, 0xd3, 0xa3, 0x01, 0x19, 0x99, 0x11,
+    0x19, 0x3b, 0x4b, 0x2b, 0x99, 0x01, 0x3b, 0x2a, 0x09, 0x29, 0x3b, 0x1a, 0x29, 0x3b, 0x3b, 0x2b,
+    0x09, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xa2, 0x30, 0x4d, 0x2b, 0x0a, 0xa1,
+    0x03, 0x4b, 0x4c, 0x2b, 0x1a, 0x80, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xb2, 0xa3, 0x01, 0x00,
+    0x10, 0x09, 0x00, 0x91, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0x93, 0x3a, 0x3b, 0x1a, 0x91, 0x10,
+    0x09, 0x91, 0x10, 0x5b, 0x2b, 0x3b, 0x3b, 0x1b, 0xa1, 0xa3, 0x11, 0x09, 0x10, 0x09, 0x10, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0xb3, 0xb3, 0xa3, 0x11,
+    0x3a, 0x1a, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x3a, 0x1a, 0x19, 0x10, 0x09, 0x91, 0x10,
+    0x3a, 0xa9, 0xb3, 0xa3, 0x91, 0x91, 0xb3, 0x91, 0xa2, 0x01, 0x39, 0x3c, 0x3b, 0x19, 0x29, 0x3b,
+    0x3b, 0x3b, 0x0a, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0x93, 0x3a,
+    0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x1a, 0x00, 0x91, 0x00, 0x91, 0x91, 0x91, 0x91, 0x91, 0xa1, 0xb3,
+    0xa3, 0x11, 0x19, 0x19, 0x99, 0x91, 0x01, 0x19, 0x19, 0x91, 0x19, 0x29, 0x99, 0xa1, 0xb3, 0xb3,
+    0xa3, 0x91, 0xc3, 0xb3, 0x93, 0x01, 0x00, 0xa1, 0xa3, 0x30, 0x3c, 0x1a, 0x91, 0x11, 0x3b, 0x3b,
+    0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x3a, 0x3b, 0x1a, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xb3,
+    0xb3, 0x92, 0x91, 0x10, 0x3b, 0x99, 0xb3, 0xa2, 0x91, 0x01, 0x10, 0x09, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x91, 0x10, 0x3a, 0x1a, 0xa1, 0xa3, 0x11, 0x3a, 0x1a, 0x19, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3,
+    0x93, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0x01, 0x90, 0xb2, 0xb3, 0x92, 0x91,
+    0x19, 0x90, 0xb2, 0xa3, 0x91, 0x01, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x3b, 0xb9, 0xc4, 0x93, 0x91,
+    0x10, 0x19, 0x00, 0x29, 0x3b, 0x3b, 0x0a, 0xb2, 0x92, 0x29, 0x3b, 0x4c, 0x3b, 0x3c, 0x2a, 0x19,
+    0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0xb1, 0x93, 0x39, 0x3c, 0x3b, 0x00, 0x00, 0x90,
+    0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x1a, 0x91, 0x91, 0xa1, 0xb3, 0xb3, 0x93, 0x09,
+    0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x2b, 0xb1, 0xa3, 0x11, 0x3b, 0x1a, 0xb2,
+    0xb3, 0x92, 0x19, 0x19, 0x00, 0x19, 0x19, 0x90, 0x91, 0x11, 0x19, 0x09, 0x10, 0x3a, 0x3b, 0x0a,
+    0xfe, 0xff, 0x00, 0x00, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x91, 0x10, 0x3a,
+    0x1a, 0xa1, 0xa3, 0x01, 0x90, 0xb2, 0x02, 0x3b, 0x2a, 0xa0, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3,
+    0xb3, 0xa3, 0x11, 0x99, 0x01, 0x10, 0x09, 0x90, 0xb3, 0x11, 0x4b, 0x3b, 0x3d, 0x3b, 0x3a, 0x3b,
+    0x3b, 0x2b, 0x19, 0x09, 0x19, 0x19, 0x00, 0x19, 0xb1, 0xb4, 0x92, 0x09, 0x19, 0x29, 0x2b, 0x19,
+    0x09, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0xa2, 0x91, 0x91, 0xb3, 0x91, 0x01, 0x00,
+    0x90, 0xc3, 0xa3, 0x31, 0x3c, 0x1a, 0xb3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x19, 0x19,
+    0x19, 0x19, 0xa1, 0x93, 0x3a, 0x2b, 0x90, 0x10, 0x4b, 0x3b, 0x2c, 0x19, 0x91, 0x29, 0x2b, 0xb0,
+    0xa3, 0x92, 0x90, 0x01, 0x29, 0x2b, 0x19, 0x09, 0x90, 0xb3, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b,
+    0x2b, 0xa0, 0xb3, 0x92, 0xff, 0xff, 0x00, 0x00, 0x90, 0x01, 0x19, 0x90, 0xb2, 0x92, 0x00, 0x90,
+    0x01, 0x00, 0x90, 0xb3, 0xc3, 0xb3, 0xb4, 0xb3, 0x92, 0x3a, 0x2b, 0xa0, 0x93, 0x3a, 0x3b, 0x1a,
+    0x19, 0x19, 0x19, 0x10, 0x19, 0x5b, 0x4c, 0x1a, 0x88, 0x91, 0x00, 0x19, 0x09, 0xa1, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x92, 0x29, 0x2b, 0x09, 0x00, 0x00, 0x10, 0x4b, 0x2b, 0x1a, 0x29, 0x3b, 0x0a, 0xb2,
+    0xa3, 0x01, 0x10, 0x19, 0x19, 0x19, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x00, 0x90, 0x01, 0x00,
+    0x90, 0xb2, 0xa3, 0x20, 0x3b, 0x3b, 0x0a, 0xa2, 0x11, 0x09, 0xa1, 0xb3, 0xb3, 0x92, 0x90, 0x91,
+    0x11, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x09,
+    0x00, 0x10, 0x09, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x29, 0x3b, 0xa9, 0xa3, 0x11, 0x3a, 0x1a, 0x29,
+    0x1a, 0xa1, 0x93, 0x3a, 0x3b, 0x1a, 0x19, 0xb1, 0xfc, 0xff, 0x00, 0x00, 0xc5, 0xa3, 0x92, 0x00,
+    0x90, 0x91, 0x91, 0xb1, 0xb4, 0xd3, 0xa3, 0xb2, 0x93, 0xb2, 0xa3, 0x01, 0x00, 0x10, 0x3a, 0x1a,
+    0x91, 0x10, 0x19, 0x09, 0x10, 0x19, 0x09, 0x10, 0x5b, 0x3b, 0x1b, 0x90, 0x91, 0x91, 0x91, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x2b, 0xb0, 0xa3, 0x92,
+    0x19, 0xa1, 0x92, 0x39, 0x3c, 0x1a, 0xb2, 0xb3, 0xa3, 0x20, 0x3b, 0x1a, 0x90, 0xb2, 0xb3, 0x92,
+    0x29, 0x2b, 0x99, 0x01, 0x29, 0x2b, 0x99, 0xb2, 0x02, 0x4b, 0x4c, 0x1b, 0x90, 0x81, 0x90, 0xb2,
+    0x92, 0x19, 0x29, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x29,
+    0x3b, 0x2b, 0x99, 0x01, 0x00, 0x29, 0x3b, 0x2b, 0xb0, 0xb4, 0xd3, 0xa3, 0xa2, 0xb3, 0xa3, 0x30,
+    0x3c, 0x3b, 0x00, 0x00, 0x90, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xfd, 0xff, 0x00, 0x00,
+    0xb3, 0x93, 0x19, 0x1a, 0xb2, 0xb3, 0x92, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x29, 0x2b,
+    0x99, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x91, 0x91, 0x39, 0x3c, 0x3b, 0x19, 0xa1, 0xa3, 0x11, 0x09,
+    0x00, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x3b, 0x3b, 0x99, 0xb3, 0xa2, 0x91, 0xc3, 0xb3, 0x93, 0x01,
+    0xa1, 0xb3, 0xa3, 0x91, 0xa2, 0x11, 0x5b, 0x2b, 0x89, 0x01, 0x29, 0x3b, 0x2b, 0x99, 0xb2, 0xb3,
+    0xb3, 0xb3, 0xb3, 0x92, 0x10, 0x3a, 0x3b, 0x99, 0x91, 0x91, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0xc3, 0xb4, 0x01, 0x08, 0x00, 0x39, 0x3c, 0x4b, 0x0a, 0xd3, 0xa3, 0x92, 0x20, 0x3b, 0x3b,
+    0x2b, 0xa0, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x1a, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x90, 0xc3, 0xb3,
+    0x03, 0x90, 0xb2, 0xb3, 0x92, 0x91, 0x90, 0x01, 0x00, 0x90, 0xb2, 0x92, 0x00, 0x19, 0x00, 0x90,
+    0xfe, 0xff, 0x00, 0x00, 0x11, 0x3a, 0x2b, 0x19, 0x3b, 0x2a, 0x09, 0x91, 0x91, 0x10, 0x09, 0xa1,
+    0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x09, 0x00, 0x91, 0x00, 0x10, 0x19, 0x3a, 0x3b,
+    0x1a, 0x00, 0x39, 0x1b, 0x00, 0x00, 0x00, 0xa1, 0x92, 0xb2, 0xb2, 0x92, 0xa1, 0xc3, 0xb4, 0xa2,
+    0x91, 0xa1, 0xb3, 0xb3, 0x92, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x90, 0xb2,
+    0xa3, 0x20, 0x2b, 0xa0, 0xb3, 0xb3, 0xa3, 0x01, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x91, 0x91,
+    0x10, 0x19, 0x3a, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x91, 0x91, 0x10, 0x5b, 0x3b, 0x3c, 0x09, 0x98,
+    0x91, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x29, 0x2b, 0x09, 0x00, 0x90, 0xc3, 0xb3, 0xa4, 0x20, 0x2b,
+    0x99, 0x91, 0x91, 0x91, 0x11, 0x09, 0x91, 0x91, 0x10, 0x19, 0x5b, 0x3b, 0x3c, 0x09, 0xb0, 0xb3,
+    0xb3, 0x92, 0x29, 0x3b, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x02, 0x3b, 0x4b,
+    0x3b, 0x2d, 0x09, 0xb1, 0x91, 0x91, 0x01, 0x39, 0x3c, 0xa9, 0x93, 0x29, 0x2b, 0x09, 0x00, 0x19,
+    0x90, 0xb2, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x2b, 0xb0, 0xa3, 0x92, 0x90, 0x91, 0xb2, 0x92, 0x91,
+    0x90, 0x91, 0x91, 0x11, 0x19, 0x3a, 0x4b, 0x3c, 0x89, 0xb1, 0xb3, 0x92, 0x00, 0x90, 0x01, 0x29,
+    0x3b, 0x3b, 0x2b, 0x09, 0x91, 0x10, 0x19, 0x3a, 0x1a, 0x90, 0x91, 0x01, 0x29, 0x3b, 0xa9, 0xc3,
+    0xb4, 0xb2, 0xa3, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x00, 0x10, 0x2a, 0xa0, 0xa3, 0x30, 0x2b,
+    0x1a, 0x10, 0x09, 0xa1, 0x93, 0x3a, 0x1a, 0x19, 0x00, 0x91, 0x00, 0x10, 0x3a, 0x1a, 0xa1, 0xa3,
+    0x91, 0xb2, 0xa3, 0x11, 0x4b, 0x4b, 0x2c, 0x09, 0xb1, 0x93, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3,
+    0x11, 0x99, 0x01, 0x10, 0x09, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0x02,
+    0x3a, 0x2b, 0xb0, 0xb4, 0xb2, 0xb3, 0xa3, 0x30, 0x3c, 0x2a, 0xa0, 0x92, 0x29, 0x2b, 0x09, 0x29,
+    0x2b, 0x19, 0x09, 0x90, 0x91, 0xb2, 0x92, 0x19, 0x90, 0x91, 0x91, 0x91, 0x11, 0x19, 0x99, 0x01,
+    0x29, 0x2b, 0x99, 0x91, 0x91, 0x91, 0x91, 0x11, 0x3a, 0x4d, 0x2b, 0x89, 0xa1, 0xa3, 0xb3, 0xb3,
+    0xa3, 0x20, 0x2b, 0x19, 0x4b, 0x2b, 0x99, 0x01, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0xb3,
+    0xb3, 0x92, 0x00, 0x90, 0x11, 0x09, 0x29, 0x3b, 0x3b, 0x1a, 0x00, 0x29, 0x3b, 0x2b, 0xb0, 0xb4,
+    0xb3, 0x29, 0x3b, 0x0a, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x19, 0x00, 0x00, 0x29, 0x1a, 0xa1,
+    0xb3, 0xb3, 0xb3, 0x02, 0x19, 0x09, 0x91, 0x91, 0xa1, 0xb3, 0x92, 0x29, 0x1a, 0xb1, 0xb3, 0x93,
+    0x29, 0x3b, 0x2b, 0x09, 0x39, 0x3d, 0x3b, 0xb8, 0xa3, 0x21, 0x3b, 0x2b, 0x00, 0x00, 0x00, 0x00,
+    0x09, 0x91, 0x91, 0x91, 0x91, 0x39, 0x1b, 0xd2, 0xb3, 0xa3, 0xb4, 0xc3, 0xb3, 0x93, 0x39, 0x1b,
+    0x90, 0x91, 0xb2, 0x92, 0x91, 0x91, 0x91, 0x91, 0x10, 0x19, 0x19, 0x09, 0xa1, 0xa3, 0x11, 0x2a,
+    0x09, 0x91, 0x29, 0x3b, 0xa9, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x29, 0x1a, 0x10, 0x3a, 0x3b, 0x1a,
+    0x19, 0x90, 0xb3, 0xb3, 0xb3, 0xb3, 0xa2, 0x91, 0x91, 0xb3, 0xa2, 0x91, 0xc3, 0xa3, 0x11, 0xb1,
+    0xa3, 0xa3, 0x01, 0x29, 0x1a, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x91, 0x91, 0x00,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x20, 0x2b, 0x99, 0xb2, 0x92, 0xb1, 0xb4, 0xb3, 0xa1, 0xb3,
+    0x02, 0x3a, 0x3b, 0x1a, 0x10, 0x3a, 0x4b, 0x4d, 0x3b, 0x1a, 0x19, 0x29, 0x4c, 0x1b, 0x19, 0x90,
+    0x10, 0x19, 0x19, 0x19, 0x19, 0x99, 0x91, 0xb3, 0x01, 0x39, 0x1b, 0x29, 0x3b, 0x3b, 0x99, 0x91,
+    0xff, 0xff, 0x00, 0x00, 0x91, 0x10, 0x19, 0x09, 0x10, 0x3a, 0x3b, 0x3b, 0x4b, 0x3c, 0x3b, 0x19,
+    0x90, 0x91, 0xb2, 0xa3, 0x91, 0x91, 0x11, 0x4b, 0x2b, 0x1a, 0x39, 0x2b, 0x1a, 0x91, 0x91, 0x00,
+    0x91, 0x91, 0x10, 0x3a, 0x4c, 0x2b, 0x4b, 0x3b, 0x3b, 0x19, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x99,
+    0x91, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x99, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b,
+    0x2b, 0x09, 0x00, 0x19, 0x29, 0x2b, 0x19, 0x09, 0x90, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a,
+    0x00, 0x91, 0x00, 0xa1, 0xb3, 0xb3, 0x11, 0x91, 0x91, 0x10, 0x19, 0x19, 0x3a, 0x3b, 0x1b, 0xb3,
+    0x92, 0x09, 0x00, 0x91, 0xa1, 0xa3, 0x11, 0x4b, 0x3b, 0x0b, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x0a,
+    0xa2, 0x11, 0x3a, 0x1a, 0x00, 0x10, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0x92,
+    0x29, 0x0a, 0xb2, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0x92, 0x29, 0x2b, 0x19, 0x3a, 0x3b, 0x1a, 0x90,
+    0xb2, 0xb3, 0x92, 0x90, 0x01, 0x39, 0x3d, 0x3b, 0x09, 0xb2, 0xb3, 0xb3, 0x92, 0x91, 0x90, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0xc3, 0xb3, 0x03, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x02, 0x3a, 0x3b,
+    0x3b, 0x2b, 0x19, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x90, 0x01, 0xb1, 0xa3, 0xb3,
+    0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0xc3, 0xc4, 0xa3, 0x92, 0x39,
+    0x2c, 0x19, 0x29, 0x3b, 0x3b, 0x3b, 0x2b, 0x19, 0x2a, 0x99, 0x91, 0x01, 0x90, 0x11, 0x19, 0x3b,
+    0x19, 0x19, 0x19, 0x19, 0x19, 0x99, 0x91, 0x01, 0x90, 0x91, 0x01, 0x19, 0x19, 0x19, 0x19, 0x90,
+    0x91, 0x01, 0x90, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x09, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0xa3,
+    0x11, 0x09, 0xa1, 0xa3, 0x91, 0xa2, 0x11, 0x3b, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xb3, 0xa3, 0xb2,
+    0xa3, 0x11, 0x3b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x91, 0xa1, 0xb3, 0xb3, 0xa3, 0x30, 0x3c,
+    0x3a, 0x1a, 0x19, 0x91, 0x29, 0x3b, 0x2b, 0x19, 0x09, 0x00, 0x91, 0xa1, 0xb3, 0xb3, 0x92, 0x91,
+    0x29, 0x3b, 0x2b, 0x19, 0x09, 0x19, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x90, 0x91, 0xb2,
+    0xb3, 0x93, 0x19, 0x09, 0xb1, 0xb4, 0x92, 0x3a, 0x2b, 0x99, 0x01, 0x19, 0x29, 0x2b, 0x19, 0x19,
+    0x2a, 0x99, 0xb3, 0x11, 0x4b, 0x3b, 0x2c, 0x09, 0xa2, 0x01, 0x00, 0x10, 0x3a, 0x2b, 0xa0, 0xb3,
+    0x92, 0x29, 0x3b, 0x2b, 0x19, 0x3a, 0x2b, 0x09, 0x00, 0x29, 0x3b, 0x0a, 0xc3, 0xb3, 0x13, 0x3a,
+    0x3b, 0x3b, 0x2b, 0x99, 0x91, 0x91, 0x11, 0x09, 0x90, 0xb2, 0xb3, 0x92, 0x90, 0xa2, 0x11, 0x3b,
+    0x09, 0x00, 0x29, 0x2b, 0xb0, 0xa3, 0x02, 0x2a, 0x99, 0xb2, 0x92, 0x00, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x39, 0x4c, 0x3c, 0x09, 0x90, 0x00, 0xa1, 0xb3, 0xa3, 0x11, 0x19, 0x09, 0x91, 0x91, 0x00,
+    0xa1, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0x01, 0x00, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0xa1,
+    0x92, 0x39, 0x3c, 0x1a, 0xb2, 0xb3, 0x93, 0x19, 0x3b, 0x3a, 0x3b, 0x3b, 0x3b, 0x2b, 0x99, 0x01,
+    0x19, 0x19, 0xb1, 0xb3, 0xb5, 0xc3, 0x93, 0x90, 0x92, 0x91, 0x00, 0x91, 0x19, 0x00, 0x91, 0x19,
+    0x19, 0x00, 0x19, 0x19, 0x90, 0xb3, 0x92, 0x3a, 0x1a, 0x91, 0x00, 0x00, 0x00, 0x39, 0x3c, 0x3b,
+    0x91, 0x10, 0x09, 0xa1, 0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0xb0, 0xa3, 0x31, 0x3c, 0x2a,
+    0x09, 0x29, 0x2b, 0xb0, 0xc4, 0xb4, 0xa2, 0xa2, 0x91, 0x00, 0xb1, 0xa3, 0x92, 0x19, 0x90, 0x91,
+    0x91, 0xb2, 0xb3, 0x02, 0x3b, 0x2a, 0xb0, 0xb3, 0xa3, 0x92, 0x91, 0x29, 0x3b, 0x0a, 0xb2, 0xc3,
+    0xfa, 0xff, 0x02, 0x00, 0xc5, 0x92, 0x28, 0x2b, 0x1a, 0x99, 0xb2, 0x92, 0x19, 0x00, 0x29, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x0a, 0xa2, 0x91, 0x01, 0x91, 0x00, 0x10, 0x3a,
+    0x3b, 0x3b, 0x3b, 0x2b, 0x09, 0x00, 0x90, 0xb2, 0xa3, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a,
+    0x19, 0x10, 0x99, 0x01, 0x10, 0x3a, 0x2b, 0x99, 0xb2, 0x92, 0x00, 0x90, 0xb2, 0xb3, 0xb3, 0x92,
+    0x29, 0x2b, 0x19, 0x4b, 0x3b, 0x1b, 0x09, 0x90, 0x01, 0x00, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0x29,
+    0x0a, 0xb2, 0x92, 0x90, 0x01, 0x29, 0x3b, 0x1a, 0x19, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x2b, 0x90,
+    0x39, 0x4d, 0x2b, 0x1a, 0x08, 0x09, 0x29, 0x3b, 0x2b, 0x99, 0x91, 0x91, 0x01, 0x00, 0x00, 0x90,
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xa3, 0x02, 0x2a, 0x19, 0x3b, 0x2a, 0x99, 0x11, 0x4b,
+    0x4c, 0x2b, 0x99, 0xc3, 0xfa, 0xff, 0x03, 0x00, 0xb4, 0x92, 0x00, 0x09, 0x39, 0x3c, 0x3b, 0xa1,
+    0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x10, 0x99, 0xb2, 0xb3, 0xa3, 0x20, 0x3b,
+    0x1a, 0x90, 0xa2, 0x91, 0x01, 0x10, 0x99, 0x91, 0xa2, 0x11, 0x3a, 0x2b, 0x09, 0x39, 0x3c, 0x5b,
+    0x2b, 0x09, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x3a, 0x2b, 0xb0, 0xb4, 0xc3,
+    0x92, 0x01, 0xb1, 0x93, 0x10, 0x09, 0xb1, 0xc5, 0xb4, 0xb3, 0xb3, 0x82, 0x29, 0x3a, 0x3b, 0x0a,
+    0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x00, 0x19, 0xb1, 0xb3, 0x93, 0x19, 0x39, 0x1b, 0x90, 0x01,
+    0x29, 0x2b, 0x09, 0x00, 0x00, 0x10, 0x3a, 0x0a, 0xa2, 0x01, 0x90, 0xb3, 0xb2, 0xb3, 0xb3, 0xb3,
+    0xa3, 0x11, 0x3a, 0x3b, 0x4b, 0x4d, 0x3b, 0x2a, 0x4b, 0x3c, 0x1a, 0x19, 0x19, 0x1a, 0xb1, 0xb4,
+    0xa2, 0x01, 0x91, 0x00, 0x00, 0xa1, 0xa3, 0x11, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x90, 0x91, 0x00,
+    0x91, 0x91, 0x00, 0x91, 0x10, 0x3a, 0x1a, 0x91, 0xa1, 0xb3, 0xa3, 0x91, 0x01, 0x29, 0x3b, 0x3b,
+    0x3b, 0x0a, 0xc3, 0xa3, 0x11, 0x09, 0xc3, 0xc4, 0xa3, 0xa2, 0x92, 0x91, 0xb2, 0xa3, 0x01, 0x90,
+    0xb2, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x2a, 0x90, 0x10, 0x3a, 0x1a, 0x10, 0x3a,
+    0x2b, 0x19, 0x3a, 0x2b, 0x90, 0x29, 0x3b, 0x1a, 0x00, 0x90, 0xc3, 0xb3, 0x13, 0x2a, 0x90, 0x91,
+    0x00, 0x10, 0x3a, 0x1b, 0xc3, 0xa3, 0x92, 0x00, 0x29, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0xb3, 0x92,
+    0x29, 0x2b, 0x19, 0x09, 0x90, 0xb3, 0x91, 0x91, 0xd3, 0xa3, 0x92, 0x10, 0x19, 0x19, 0x90, 0xc3,
+    0xa3, 0x92, 0x10, 0x19, 0x3b, 0x19, 0x19, 0x09, 0x91, 0x91, 0x10, 0x19, 0x09, 0x91, 0x29, 0x3b,
+    0x3b, 0x0a, 0xc3, 0xa3, 0x92, 0x90, 0xa2, 0x01, 0x29, 0x3b, 0x3b, 0x3b, 0x01, 0x00, 0x00, 0x00,
+    0x2b, 0x19, 0x19, 0x99, 0x91, 0x01, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x99, 0x01, 0x29, 0x3b, 0x9a,
+    0xb3, 0x92, 0x19, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x90, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x90, 0x01, 0xa1, 0x92, 0x91, 0xa1, 0xb3,
+    0xa3, 0x11, 0x3a, 0x3b, 0x0a, 0xb2, 0xb3, 0x92, 0x90, 0x01, 0x00, 0x19, 0x00, 0x19, 0x91, 0xa1,
+    0xa3, 0x91, 0xc3, 0xb3, 0x93, 0x11, 0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x3b, 0x19, 0x99,
+    0x91, 0x91, 0x11, 0x19, 0x09, 0x91, 0x91, 0x91, 0xb1, 0xb5, 0x92, 0x39, 0x1a, 0x91, 0x01, 0x39,
+    0x2b, 0x1a, 0x39, 0x3c, 0x3b, 0x19, 0x91, 0x10, 0x19, 0x99, 0xb3, 0x92, 0x19, 0x09, 0x91, 0xa1,
+    0xa3, 0x91, 0x01, 0x91, 0x91, 0x91, 0x19, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x3b, 0x1a,
+    0xff, 0xff, 0x00, 0x00, 0xa1, 0xa3, 0x91, 0x01, 0x29, 0x1a, 0x90, 0x11, 0x3a, 0x3b, 0x3b, 0x2b,
+    0x19, 0x99, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0xa1, 0x93, 0x3a, 0x3b,
+    0x1b, 0x91, 0x01, 0x91, 0xb1, 0xa3, 0xb3, 0xb3, 0x21, 0x3b, 0x2b, 0x09, 0x90, 0x01, 0x00, 0x19,
+    0xb1, 0xb4, 0x92, 0x19, 0x99, 0xb3, 0x11, 0x3a, 0x1a, 0x00, 0x00, 0x90, 0xa2, 0x01, 0x00, 0x91,
+    0x00, 0x00, 0x91, 0x29, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3,
+    0xb3, 0xb3, 0x02, 0x3b, 0x1a, 0x91, 0x11, 0x09, 0x91, 0x10, 0x5b, 0x3b, 0x1b, 0x09, 0x91, 0x00,
+    0x10, 0x09, 0x00, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0x92, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x93,
+    0x3a, 0x3b, 0x1a, 0x10, 0x19, 0x19, 0x3a, 0x3b, 0x1a, 0x19, 0x19, 0x91, 0x39, 0x2b, 0x1a, 0x91,
+    0xa1, 0xb3, 0xb3, 0xb3, 0xfd, 0xff, 0x00, 0x00, 0xa3, 0x11, 0x3a, 0x1a, 0x91, 0x00, 0x10, 0x3a,
+    0x1a, 0xa1, 0x93, 0x09, 0x91, 0xb1, 0xb3, 0xb5, 0x92, 0x18, 0xb1, 0xb5, 0xb2, 0xb3, 0xb3, 0x11,
+    0x19, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x10, 0x09, 0x10, 0x19, 0x09, 0xa1, 0xb3,
+    0xa3, 0x10, 0x90, 0xb2, 0x21, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x19, 0x39, 0x2b, 0x1a, 0x19,
+    0x00, 0x10, 0x3a, 0x2b, 0x09, 0x00, 0x19, 0xb1, 0xc4, 0xb4, 0xa2, 0x01, 0x08, 0x19, 0x00, 0x00,
+    0x29, 0x2b, 0xb0, 0xb4, 0xb3, 0xa1, 0x92, 0x39, 0x3c, 0x1a, 0xc3, 0xb3, 0x93, 0x11, 0x19, 0x09,
+    0x91, 0x91, 0x39, 0x2b, 0x99, 0x91, 0x19, 0x90, 0xc3, 0xa3, 0x21, 0x3b, 0x1b, 0xb2, 0xb3, 0x92,
+    0x91, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x19, 0x3a, 0x0a, 0xb2, 0x02, 0x3a, 0x3b, 0x2b,
+    0x99, 0x91, 0x01, 0x00, 0x19, 0x00, 0x29, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x99, 0xc3, 0xb3, 0xb5,
+    0xc4, 0xa3, 0x10, 0x19, 0x3a, 0x09, 0x00, 0x00, 0xb1, 0xb4, 0xc3, 0xa2, 0xa3, 0x02, 0x2a, 0xb0,
+    0x93, 0x39, 0x3c, 0x1a, 0x11, 0x3a, 0x0a, 0xc3, 0xb3, 0x03, 0x00, 0xa1, 0xb3, 0xb3, 0xa3, 0x11,
+    0x3a, 0x1a, 0x19, 0x19, 0x19, 0x19, 0x91, 0x91, 0x19, 0xb1, 0xa3, 0x21, 0x1b, 0x91, 0x01, 0x19,
+    0x90, 0xb2, 0x92, 0x29, 0x2b, 0x19, 0x99, 0x91, 0x01, 0x90, 0x01, 0x00, 0x90, 0xa2, 0x20, 0x3b,
+    0x0a, 0xb2, 0xa3, 0x20, 0x3b, 0x3b, 0x3b, 0x3b, 0x99, 0x91, 0x10, 0x5b, 0x3b, 0x1b, 0x3a, 0x3b,
+    0x9a, 0xb3, 0xb3, 0xa2, 0xa3, 0x11, 0x2a, 0xa0, 0xa3, 0x30, 0x1b, 0xb1, 0x93, 0x10, 0x2a, 0x19,
+    0x09, 0x29, 0x2b, 0x19, 0x99, 0xb2, 0xb3, 0x92, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0x92, 0xa1, 0x92,
+    0x19, 0x19, 0x29, 0x3b, 0x2b, 0x09, 0x29, 0x2b, 0xa0, 0xb3, 0xb3, 0xa3, 0xfe, 0xff, 0x00, 0x00,
+    0x30, 0x3c, 0x2a, 0x99, 0x91, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x39, 0x3b, 0x3d, 0x4b, 0x2b, 0x1a,
+    0x99, 0x91, 0xb2, 0x92, 0xa1, 0xb3, 0x93, 0x19, 0x09, 0x91, 0x29, 0x3b, 0x3b, 0x2b, 0x90, 0x00,
+    0x00, 0x91, 0x00, 0xa1, 0xb3, 0xa3, 0x01, 0x10, 0x19, 0x3a, 0x99, 0x00, 0x10, 0x19, 0x3a, 0x3b,
+    0x2b, 0x99, 0x92, 0x19, 0x09, 0xb1, 0x93, 0x19, 0x19, 0x29, 0x3b, 0x99, 0x91, 0xa1, 0xb3, 0xb3,
+    0xb3, 0xa3, 0x11, 0x09, 0x00, 0xb1, 0xb4, 0xc3, 0xa2, 0x93, 0x10, 0x3a, 0x1a, 0x91, 0x29, 0x3b,
+    0x2b, 0x99, 0xb3, 0x01, 0x00, 0xb1, 0xb4, 0xa2, 0x01, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91,
+    0x91, 0x91, 0x91, 0x91, 0xc3, 0xc4, 0x93, 0x18, 0x2a, 0x1a, 0x91, 0x10, 0x19, 0x99, 0xa2, 0x91,
+    0x91, 0xa2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a, 0x29,
+    0x01, 0x00, 0x00, 0x00, 0x3b, 0x1a, 0x10, 0x3a, 0x4b, 0x3c, 0x3b, 0x3a, 0x09, 0x00, 0x00, 0xa1,
+    0xb3, 0xb3, 0xb3, 0x92, 0x90, 0xb2, 0xb3, 0x92, 0x90, 0xb2, 0x02, 0x3b, 0x2a, 0x09, 0x39, 0x3c,
+    0x2a, 0x09, 0x19, 0x19, 0x90, 0x91, 0x11, 0x99, 0x91, 0x11, 0x19, 0x19, 0x3a, 0x3b, 0x3b, 0xa9,
+    0xb3, 0x21, 0x3b, 0x2b, 0x99, 0xb2, 0xb3, 0x92, 0x91, 0x91, 0x19, 0x19, 0x91, 0x39, 0x4c, 0x1b,
+    0x19, 0x19, 0x19, 0x19, 0x09, 0x91, 0x91, 0x39, 0x3b, 0x1b, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0x91,
+    0x91, 0x01, 0x19, 0x19, 0xb1, 0xb3, 0x93, 0x29, 0x1a, 0x19, 0x10, 0x19, 0x3a, 0x3b, 0x1b, 0x91,
+    0xb3, 0x11, 0x19, 0x09, 0x91, 0xa1, 0xb3, 0xb3, 0x11, 0x19, 0x19, 0x90, 0x91, 0x01, 0x90, 0xb3,
+    0x91, 0x01, 0x91, 0x39, 0x3c, 0x99, 0xb3, 0x11, 0x3a, 0x99, 0x00, 0x10, 0x99, 0xb2, 0xa3, 0x91,
+    0xb2, 0xb3, 0x92, 0x19, 0xff, 0xff, 0x00, 0x00, 0x90, 0xc3, 0xa3, 0x92, 0xa1, 0xb3, 0xa3, 0x91,
+    0xb3, 0xb3, 0x11, 0x19, 0x19, 0x09, 0x10, 0x19, 0x09, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91,
+    0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x0a, 0xd3, 0xb4, 0xa2, 0x81, 0xa0, 0xa3, 0x20, 0x3b, 0x1a,
+    0x19, 0x00, 0x00, 0x19, 0x90, 0x01, 0x29, 0x2b, 0x99, 0xb2, 0x92, 0x19, 0x19, 0x19, 0x91, 0x91,
+    0x00, 0xb1, 0xb3, 0x93, 0x91, 0x91, 0x19, 0x19, 0x00, 0x90, 0xb2, 0xb3, 0x92, 0x00, 0x29, 0x3b,
+    0x0a, 0xb2, 0xa3, 0x01, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x19, 0xa1, 0xc3, 0xb4, 0x92, 0x18, 0x90,
+    0x01, 0x00, 0x90, 0xa2, 0x01, 0x00, 0xa1, 0x02, 0x3a, 0x3b, 0x2b, 0x90, 0x00, 0x00, 0xa1, 0x92,
+    0xa1, 0x92, 0x39, 0x1b, 0xa1, 0xb3, 0xd4, 0xb4, 0x93, 0x18, 0x09, 0xb1, 0xb3, 0x01, 0x19, 0x29,
+    0x3b, 0x3b, 0x99, 0x00, 0x90, 0xb2, 0x92, 0xb1, 0xfc, 0xff, 0x00, 0x00, 0x93, 0x10, 0x19, 0x19,
+    0x19, 0x09, 0x00, 0x00, 0x29, 0x3b, 0x2b, 0x09, 0x00, 0x10, 0x4b, 0x2b, 0x3b, 0x3b, 0x0a, 0xc3,
+    0xb3, 0xb4, 0xb3, 0x91, 0x91, 0xb3, 0xb3, 0xb2, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x91, 0x10, 0x3a,
+    0x1b, 0x91, 0xb3, 0xb3, 0xa2, 0x91, 0x91, 0x91, 0x91, 0xb2, 0xb3, 0x92, 0x19, 0xc2, 0xb3, 0xa4,
+    0x91, 0x00, 0x91, 0xa1, 0x02, 0x3a, 0x2b, 0x09, 0x90, 0x91, 0x01, 0x39, 0x2b, 0x1a, 0x10, 0x3a,
+    0x1a, 0x10, 0x3a, 0x1a, 0xb1, 0x93, 0x91, 0xb1, 0xb3, 0x93, 0x19, 0xa1, 0xa3, 0x01, 0xb1, 0xa3,
+    0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x91, 0x39, 0x3c, 0x3b, 0x00, 0x29, 0x2b, 0x99, 0xb2, 0xb3, 0xb3,
+    0xa3, 0x01, 0x90, 0xb3, 0x01, 0x00, 0xb1, 0xb4, 0xb2, 0xa3, 0x91, 0x11, 0x99, 0xb3, 0x91, 0x11,
+    0x99, 0x91, 0x91, 0x11, 0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x01, 0x00, 0x00, 0x00,
+    0xa9, 0xb3, 0xc4, 0xb3, 0xb4, 0xa2, 0x01, 0x19, 0x99, 0xb3, 0x11, 0x09, 0xa1, 0xa3, 0x01, 0x00,
+    0x00, 0x39, 0x3c, 0x3a, 0x3b, 0x5c, 0x2b, 0x2b, 0x2a, 0x1a, 0xa1, 0xb3, 0x92, 0x10, 0x2a, 0x09,
+    0x91, 0x00, 0x00, 0xa1, 0xb3, 0x92, 0x90, 0xb2, 0x02, 0x4b, 0x3b, 0x2c, 0x09, 0x11, 0x3b, 0x3b,
+    0x99, 0xb2, 0xb3, 0xb3, 0xb3, 0x92, 0x91, 0x90, 0x91, 0xb2, 0xb3, 0x93, 0x19, 0x3b, 0x2a, 0xa0,
+    0x02, 0x3a, 0x3b, 0x3b, 0x5c, 0x3c, 0x2b, 0x19, 0x3a, 0x4b, 0x1a, 0x19, 0x99, 0xb3, 0x92, 0x5b,
+    0x3b, 0x2b, 0x3b, 0x2b, 0x99, 0x91, 0x91, 0x19, 0x91, 0x91, 0x10, 0x19, 0x99, 0x01, 0x29, 0x3b,
+    0x3b, 0x4c, 0x1b, 0xa0, 0xa4, 0x20, 0x9a, 0xc3, 0xb4, 0x81, 0x91, 0x09, 0x90, 0x11, 0x4b, 0x2b,
+    0xb9, 0xb4, 0x92, 0x19, 0x2a, 0x19, 0x19, 0x3b, 0x2a, 0x99, 0x91, 0xb2, 0xb3, 0xb3, 0xa3, 0x91,
+    0xfe, 0xff, 0x00, 0x00, 0x11, 0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x10, 0x19, 0x19, 0x19, 0x3a, 0x1a,
+    0x90, 0xa2, 0x11, 0x09, 0xb1, 0xb5, 0xb3, 0x01, 0x19, 0x3a, 0x3b, 0x1b, 0x91, 0x11, 0x19, 0x09,
+    0x10, 0x99, 0x11, 0x19, 0x09, 0x91, 0xa1, 0xb3, 0xb3, 0xa3, 0x91, 0x91, 0x11, 0x99, 0xb2, 0xb3,
+    0x92, 0x00, 0x19, 0x00, 0x00, 0x29, 0x2b, 0x09, 0x29, 0x3b, 0x0a, 0xd3, 0xb4, 0xb2, 0x92, 0x10,
+    0x3a, 0x3b, 0x1a, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x00, 0x39, 0x3c, 0x4b, 0x2a, 0x2b, 0x3b,
+    0x3b, 0x3b, 0x1a, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x91, 0x10, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3,
+    0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0xc3, 0xa3, 0x92, 0x00, 0x00, 0x00, 0x10, 0x3a, 0x3b, 0x1a,
+    0xa1, 0xb3, 0xa3, 0x91, 0x01, 0x10, 0x2a, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xb3, 0x02, 0x5b,
+    0x3c, 0x1a, 0xb1, 0xb4, 0xfb, 0xff, 0x02, 0x00, 0x82, 0xa1, 0xb3, 0x02, 0x3a, 0x2b, 0x99, 0x91,
+    0x91, 0x91, 0xa2, 0x11, 0x3a, 0x1a, 0x19, 0x00, 0x91, 0x91, 0x10, 0x99, 0xb2, 0xb3, 0xb3, 0x92,
+    0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x10, 0x3a, 0x1a, 0xa1, 0x02, 0x3a, 0x0a, 0xc3, 0x93, 0x19,
+    0x29, 0x1a, 0x90, 0xc3, 0xb3, 0xb4, 0xb3, 0xa2, 0x11, 0x09, 0xa1, 0xb3, 0xb3, 0x92, 0x91, 0xa1,
+    0x92, 0x19, 0x90, 0xb2, 0x92, 0x29, 0x2b, 0x99, 0x01, 0x39, 0x3b, 0x2b, 0x3b, 0x3b, 0x3b, 0x1a,
+    0x91, 0x91, 0x10, 0x3a, 0x3b, 0xa9, 0xb3, 0xc4, 0xb3, 0xb4, 0x81, 0xb1, 0xb3, 0xb3, 0x92, 0x29,
+    0x3b, 0x1b, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0x02, 0x3b, 0x3a, 0x1a, 0x19, 0x10, 0x09, 0x00, 0xa1,
+    0xb3, 0xb3, 0x11, 0x19, 0x91, 0x91, 0x10, 0x3a, 0x1a, 0xa1, 0x92, 0x00, 0x00, 0x39, 0x4d, 0x3c,
+    0x2b, 0x19, 0x19, 0x4a, 0x4c, 0x2b, 0x89, 0xa1, 0xfc, 0xff, 0x00, 0x00, 0x93, 0x29, 0x3b, 0x3b,
+    0x3b, 0x2b, 0x09, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x10, 0x09, 0x91, 0x10, 0x19, 0x19, 0x3a, 0x3b,
+    0x1a, 0x39, 0x3c, 0x3b, 0x19, 0x00, 0xa1, 0xb3, 0xb3, 0x11, 0x19, 0x91, 0x10, 0x3a, 0x3b, 0x3b,
+    0x3b, 0x3b, 0x1b, 0x91, 0xb3, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0x91, 0x91, 0x91, 0xb2,
+    0xb3, 0x02, 0x3a, 0x2b, 0xa0, 0xb3, 0xa3, 0x11, 0x4b, 0x2b, 0x1a, 0x00, 0x00, 0x10, 0x09, 0x00,
+    0x91, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x30, 0x3c, 0x5b, 0x2b, 0x09, 0x10, 0x3a, 0xa9, 0xb3,
+    0x92, 0xa1, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0x91, 0x00, 0x91, 0x91,
+    0x10, 0x19, 0x19, 0x09, 0x91, 0x91, 0x10, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x19, 0x29, 0x3b,
+    0x2b, 0x09, 0x29, 0x3b, 0x2b, 0x19, 0x99, 0xb2, 0xb3, 0xb3, 0x92, 0x19, 0xff, 0xff, 0x00, 0x00,
+    0x19, 0x19, 0x19, 0x29, 0x1a, 0x19, 0x00, 0x91, 0x10, 0x3a, 0x1a, 0xa1, 0x92, 0x00, 0x90, 0x01,
+    0x00, 0x19, 0x90, 0xb2, 0xb3, 0x92, 0xb1, 0xb3, 0xa3, 0x92, 0x39, 0x1b, 0x90, 0x91, 0x91, 0x01,
+    0x19, 0x00, 0xa1, 0x11, 0x10, 0x19, 0x09, 0xa1, 0xb3, 0xa3, 0x91, 0xc3, 0xb3, 0x13, 0x4b, 0x3b,
+    0x9b, 0xb2, 0x02, 0x3a, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x19, 0x99, 0x91, 0x91, 0xb2, 0x92, 0x19,
+    0x19, 0x90, 0x91, 0xb3, 0xa2, 0x91, 0x91, 0x92, 0x19, 0x09, 0x10, 0x3a, 0x3b, 0x3b, 0x0a, 0xb2,
+    0xb3, 0xb3, 0xb3, 0x02, 0x3a, 0x1a, 0xa1, 0xb3, 0xb3, 0xc4, 0xa3, 0x01, 0x09, 0x91, 0xa1, 0xb3,
+    0xb3, 0x11, 0x19, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x10, 0x3b, 0x3b, 0x3b, 0x2a, 0x99, 0xb3,
+    0x01, 0x39, 0x3b, 0x1b, 0x91, 0x91, 0x19, 0x90, 0x91, 0x91, 0x91, 0x91, 0x11, 0x19, 0x09, 0x91,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xc3, 0xb3, 0xa4, 0x91, 0xa1, 0xb3, 0x02, 0x09,
+    0x00, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x99, 0xb2, 0x92, 0x19, 0x90, 0x91, 0x91, 0xb2, 0xc4,
+    0xb3, 0x93, 0x91, 0x91, 0x91, 0x91, 0xb3, 0xb3, 0xb3, 0xa2, 0x11, 0x3b, 0x09, 0x91, 0x10, 0x19,
+    0x09, 0x91, 0x19, 0x39, 0x2b, 0x1a, 0x10, 0x3a, 0x2b, 0x90, 0x00, 0x00, 0x91, 0x39, 0x3c, 0xa9,
+    0xb4, 0x92, 0x4b, 0x3b, 0x2c, 0x19, 0x29, 0x2b, 0x99, 0xc3, 0xa3, 0x92, 0x00, 0x00, 0xb1, 0xb4,
+    0xc3, 0x92, 0x30, 0x3c, 0x4b, 0x2a, 0x2b, 0x3b, 0x2b, 0x99, 0xb3, 0x92, 0x19, 0x09, 0xa1, 0x11,
+    0x19, 0x19, 0x91, 0x10, 0x3a, 0x4c, 0x1b, 0x90, 0x92, 0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x10,
+    0x09, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x1a, 0xb1, 0xb3, 0x93, 0x91, 0xb1, 0xb3, 0xa3, 0x92, 0x19,
+    0x19, 0x19, 0x19, 0x91, 0xff, 0xff, 0x00, 0x00, 0x91, 0x10, 0x09, 0x19, 0x39, 0x3c, 0x4b, 0x3b,
+    0x2b, 0x1a, 0x39, 0x3c, 0x3b, 0x19, 0xa1, 0xa3, 0x11, 0x09, 0xa1, 0xb3, 0x92, 0x10, 0x19, 0x3b,
+    0x09, 0x91, 0x00, 0xa1, 0xb3, 0xb3, 0x11, 0x29, 0xa9, 0xb3, 0xb3, 0x11, 0x19, 0x19, 0x19, 0x00,
+    0x91, 0x10, 0x3a, 0x1a, 0x19, 0x29, 0x1a, 0x91, 0x00, 0x00, 0xa1, 0x92, 0x29, 0x3b, 0x1a, 0x19,
+    0x91, 0x91, 0x39, 0x2b, 0xa9, 0xb3, 0x93, 0x3a, 0xa9, 0xc3, 0xb4, 0xa2, 0xa1, 0xb3, 0x93, 0x3a,
+    0x1a, 0x90, 0x91, 0xb3, 0x92, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0xa3, 0x01, 0x00, 0x00, 0x29,
+    0x2b, 0x99, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x99, 0x01, 0x29, 0x3b, 0x1a, 0x19, 0x19, 0x19, 0x19,
+    0x90, 0xb2, 0x21, 0x3b, 0x1b, 0x91, 0x01, 0xa1, 0xb3, 0xa3, 0x91, 0xb2, 0xb3, 0x92, 0x19, 0xb1,
+    0xb3, 0x93, 0x91, 0x10, 0x19, 0x09, 0x91, 0x91, 0xff, 0xff, 0x00, 0x00, 0x91, 0x19, 0x90, 0xc3,
+    0xa3, 0x31, 0x2b, 0x1a, 0x10, 0x3a, 0x3b, 0x1a, 0x10, 0x3a, 0x3b, 0x2b, 0x09, 0xb1, 0xb4, 0xc3,
+    0xa2, 0xa3, 0x02, 0x4b, 0x3b, 0x1b, 0x09, 0x90, 0x01, 0x00, 0x19, 0x00, 0x90, 0xb2, 0x92, 0x29,
+    0x2b, 0x19, 0x19, 0x19, 0x19, 0x19, 0x09, 0x91, 0x91, 0x00, 0x00, 0xa1, 0xb3, 0xb3, 0x11, 0x19,
+    0x91, 0x10, 0x09, 0x91, 0x10, 0x3a, 0x3b, 0x1a, 0x91, 0x91, 0x91, 0x91, 0x19, 0x19, 0x90, 0x91,
+    0x91, 0x01, 0x19, 0x19, 0xb1, 0xb3, 0x93, 0x19, 0x19, 0x19, 0x19, 0xb1, 0xa3, 0x11, 0x19, 0xb1,
+    0xb3, 0x93, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x91, 0x91, 0x10, 0x3a, 0x3b, 0x3b, 0x2b, 0x09,
+    0x00, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0xa3, 0x10, 0x90, 0xa2, 0x20, 0x2b, 0xb0, 0xb4, 0xb3,
+    0x91, 0x00, 0x90, 0xb2, 0xb3, 0x02, 0x4b, 0x2b, 0xa9, 0xa3, 0x20, 0x1a, 0xff, 0xff, 0x00, 0x00,
+    0xa1, 0xa3, 0x01, 0x91, 0xa1, 0xb3, 0xc4, 0xa3, 0x01, 0x09, 0x91, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3,
+    0xb3, 0x92, 0x00, 0x90, 0x01, 0x29, 0x3b, 0x2b, 0x09, 0x29, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3, 0x92,
+    0x10, 0x19, 0x3b, 0x09, 0xa1, 0x92, 0x19, 0x00, 0x90, 0xb2, 0xc3, 0xb4, 0x01, 0x29, 0x99, 0xb2,
+    0x92, 0x19, 0x19, 0x19, 0x19, 0xb1, 0xa3, 0x92, 0x19, 0x90, 0xb2, 0xb3, 0xb3, 0xb3, 0x11, 0x19,
+    0x19, 0x91, 0x10, 0x3a, 0x1a, 0x00, 0x00, 0x00, 0x29, 0x3b, 0x3b, 0x2b, 0x19, 0x19, 0x3b, 0x2a,
+    0x99, 0x01, 0x19, 0x00, 0x90, 0x01, 0x91, 0x19, 0x00, 0xa1, 0x92, 0x29, 0x2b, 0x19, 0x3b, 0x3b,
+    0x09, 0xa1, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x90, 0x01, 0x29, 0x2b, 0x99, 0x01, 0x00, 0x29,
+    0x3b, 0x4c, 0x3b, 0x3c, 0x3a, 0x4c, 0x3b, 0x3b, 0x2a, 0x99, 0x11, 0x5b, 0x3b, 0x1b, 0xa0, 0xa3,
+    0xfe, 0xff, 0x00, 0x00, 0x01, 0x00, 0x91, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1,
+    0xb3, 0xb3, 0x11, 0x19, 0xb1, 0xb5, 0xc3, 0x93, 0x90, 0xa2, 0xb3, 0xb3, 0x92, 0xa1, 0xb3, 0x02,
+    0x3a, 0x2b, 0xa0, 0xa3, 0x20, 0x1a, 0xa1, 0x93, 0x3a, 0x4b, 0x3c, 0x3b, 0x19, 0x19, 0x90, 0x01,
+    0x19, 0x90, 0x01, 0x90, 0xb2, 0xa3, 0x39, 0x4c, 0x2b, 0x1a, 0xb1, 0xb3, 0x93, 0x19, 0x19, 0x19,
+    0x19, 0x4b, 0x3c, 0x19, 0x09, 0x11, 0x19, 0x19, 0x99, 0xb2, 0xb3, 0xa3, 0x11, 0x3a, 0x3b, 0x1a,
+    0x90, 0x91, 0x91, 0x11, 0x09, 0xa1, 0xa3, 0x11, 0x3a, 0x3b, 0x3b, 0x3b, 0x3b, 0x0a, 0xb2, 0xa3,
+    0x91, 0xb2, 0xa3, 0x01, 0x10, 0x19, 0x3a, 0x1a, 0x19, 0x00, 0x10, 0x3b, 0x4b, 0x4c, 0x2b, 0x89,
+    0xa1, 0xb3, 0xa3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x91, 0x01, 0x91, 0x91, 0x91, 0x91, 0x10, 0x3a,
+    0x1a, 0x00, 0x10, 0x09, 0xff, 0xff, 0x00, 0x00, 0xa1, 0xb3, 0x92, 0xa1, 0xb3, 0x92, 0x91, 0x10,
+    0x3a, 0x99, 0x00, 0x00, 0x91, 0x00, 0x91, 0x91, 0x10, 0x09, 0x19, 0x19, 0x90, 0x91, 0x91, 0xb2,
+    0x92, 0x19, 0xa1, 0xb3, 0xb3, 0xa3, 0x30, 0x1b, 0x91, 0x10, 0x09, 0xa1, 0xb3, 0xb3, 0xa3, 0x91,
+    0x01, 0x91, 0x19, 0x19, 0xb1, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x92, 0x91, 0xa1, 0x11, 0x19,
+    0x19, 0x19, 0xa1, 0xb3, 0xb3, 0xa3, 0x11, 0x3a, 0x2b, 0x90, 0x29, 0x3b, 0x2b, 0x19, 0x09, 0x29,
+    0x1a, 0x29, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0xa1, 0xb3, 0xa3, 0x01, 0x10, 0x09, 0x10, 0x3a, 0x3b,
+    0x1a, 0x39, 0x4c, 0x3c, 0x2a, 0x3a, 0x3b, 0x3b, 0x3b, 0x1a, 0xb2, 0xb3, 0x92, 0xb1, 0xb4, 0xb3,
+    0x91, 0x19, 0x29, 0x1b, 0xb2, 0xa3, 0x10, 0x90, 0x01, 0x19, 0x90, 0xb3, 0x11, 0x5b, 0x3b, 0x3c,
+    0x2a, 0x19, 0x00, 0x10, 0x3a, 0x3b, 0x3b, 0x0a, 0xfe, 0xff, 0x00, 0x00, 0xb2, 0xb3, 0x92, 0x19,
+    0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x19, 0x90, 0xd3, 0xb3, 0xa3, 0xc4, 0xb4, 0x92, 0x18, 0x3a, 0x3b,
+    0x19, 0x19, 0x3a, 0x3b, 0x1a, 0x91, 0xa1, 0xb3, 0x92, 0x39, 0x1b, 0x19, 0x19, 0x90, 0x01, 0x10,
+    0x09, 0x90, 0x01, 0x00, 0x19, 0x00, 0x90, 0xb2, 0xc3, 0xb4, 0x81, 0xa1, 0xb2, 0x92, 0x19, 0x19,
+    0x90, 0xb2, 0xb3, 0xb3, 0x92, 0x10, 0x19, 0x19, 0x19, 0x09, 0xa1, 0xa3, 0x01, 0x90, 0xa2, 0x11,
+    0x3a, 0x1a, 0x19, 0x29, 0x1a, 0x19, 0x10, 0x3a, 0x3b, 0x3b, 0xa9, 0xc3, 0xb4, 0x01, 0x29, 0x19,
+    0x99, 0x91, 0x11, 0x99, 0x91, 0xb2, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xa3, 0x11, 0x19, 0x19, 0x3b,
+    0x09, 0x10, 0x2a, 0x09, 0xa1, 0xb3, 0xb3, 0x11, 0xa0, 0xc5, 0xa3, 0x92, 0x00, 0x3a, 0x3b, 0x1a,
+    0x90, 0xb2, 0x93, 0x3a, 0x3b, 0x9a, 0xb3, 0xa3, 0x10, 0x19, 0x10, 0x19, 0x00, 0x00, 0x00, 0x00,
+    0x2a, 0xa0, 0xb3, 0x93, 0x19, 0x09, 0x10, 0x09, 0x00, 0xa1, 0xb3, 0xb3, 0x11, 0x29, 0x3b, 0x1a,
+    0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x90, 0x01, 0x90, 0xb2, 0xb3, 0x02, 0x3a, 0x0a, 0xc3, 0xa3,
+    0x21, 0x1a, 0x91, 0x10, 0x4b, 0x2b, 0x99, 0xa1, 0x92, 0xb1, 0xb3, 0xa3, 0xa2, 0xa3, 0x01, 0x90,
+    0xb2, 0xb3, 0x02, 0x3a, 0x1a, 0x90, 0xb2, 0xb3, 0x93, 0x09, 0x19, 0x29, 0x2b, 0x09, 0x10, 0x19,
+    0x2a, 0x09, 0x91, 0x91, 0xa1, 0xa3, 0xb2, 0xb3, 0x92, 0x29, 0x3b, 0x1a, 0x91, 0x10, 0x99, 0xb2,
+    0xc3, 0xb4, 0xb3, 0x01, 0x3a, 0x4b, 0x3c, 0x2a, 0x19, 0x39, 0x1b, 0xb1, 0xa3, 0xa3, 0xb2, 0xb3,
+    0xb3, 0xa3, 0x11, 0x19, 0x09, 0x00, 0x10, 0x3b, 0x3a, 0x1a, 0x00, 0x91, 0xb1, 0xc4, 0xa3, 0x02,
+    0x3b, 0x3b, 0xa9, 0xb3, 0x92, 0x90, 0xa2, 0x10, 0x19, 0x90, 0xb2, 0xb3, 0x93, 0x09, 0x00, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x19, 0x00, 0x10, 0x09, 0x2a, 0xa1, 0xb3, 0x92, 0x09, 0x91, 0x01, 0x19,
+    0x91, 0x90, 0xb2, 0xb3, 0x02, 0x3a, 0x2b, 0xa0, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x4b, 0x2b, 0x2a,
+    0x09, 0x10, 0x3a, 0x1a, 0x19, 0x19, 0x29, 0x2a, 0x3b, 0x3b, 0x0a, 0xb3, 0xa2, 0x01, 0x91, 0x91,
+    0xb1, 0xa3, 0x92, 0x39, 0x2b, 0x3b, 0x3b, 0x0a, 0xb2, 0xb3, 0x92, 0x90, 0x91, 0xa2, 0x91, 0x01,
+    0x10, 0x09, 0xb1, 0xb4, 0xb2, 0xb2, 0xc5, 0xa3, 0x92, 0x28, 0x1b, 0x19, 0x00, 0x91, 0x39, 0x3b,
+    0x0b, 0x01, 0x90, 0x00, 0x91, 0x11, 0x19, 0x3a, 0x1a, 0x19, 0xb0, 0xb3, 0xa5, 0x91, 0x00, 0x01,
+    0x29, 0x3b, 0x3b, 0x3b, 0x99, 0x91, 0x91, 0x91, 0x00, 0x29, 0x3b, 0x1b, 0x91, 0x11, 0x2a, 0x99,
+    0x91, 0xb2, 0xb3, 0x92, 0x00, 0x19, 0x19, 0x3a, 0x09, 0xa1, 0x92, 0x91, 0x91, 0x39, 0x2b, 0x2b,
+    0x19, 0x3a, 0x2b, 0x99, 0xfe, 0xff, 0x00, 0x00, 0x11, 0x4b, 0x2b, 0x1a, 0x39, 0x4c, 0x2b, 0x1b,
+    0xa1, 0xc3, 0xa3, 0x22, 0x4c, 0x1b, 0x19, 0x09, 0x39, 0x3d, 0x3b, 0x6b, 0x3b, 0x1b, 0x2a, 0x90,
+    0xb2, 0xa3, 0x91, 0xc3, 0xa3, 0x11, 0x00, 0xb1, 0x93, 0x29, 0x1b, 0xb2, 0xb3, 0x93, 0x19, 0x3b,
+    0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x3b, 0x99, 0xb3, 0x11, 0x5b, 0x1b, 0x90, 0x92, 0x00, 0xb0,
+    0x02, 0x01, 0xa1, 0xb3, 0x93, 0x3a, 0x2b, 0x19, 0x2a, 0x09, 0x01, 0x3a, 0x3b, 0x2b, 0x19, 0x19,
+    0x2a, 0x19, 0x3a, 0x3b, 0x1a, 0x91, 0x00, 0x09, 0x10, 0x29, 0x2b, 0x90, 0x91, 0x91, 0xb1, 0x93,
+    0x10, 0x2a, 0x3b, 0x3b, 0x3a, 0x3b, 0x2b, 0x09, 0xa1, 0x92, 0x91, 0x29, 0x2b, 0xb0, 0xc4, 0x93,
+    0x91, 0x01, 0x00, 0xa1, 0xb3, 0x02, 0x19, 0x3b, 0x3b, 0x3b, 0x5b, 0x3b, 0x3d, 0x2a, 0xb0, 0xb4,
+    0x02, 0x3b, 0x0b, 0xb2, 0x92, 0x29, 0x3b, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x29, 0x2b, 0xb9,
+    0xb5, 0xa2, 0x01, 0x3b, 0x5b, 0x1b, 0xa0, 0xb5, 0xb3, 0xa2, 0x91, 0x01, 0x90, 0x91, 0x01, 0x10,
+    0x3a, 0xa9, 0xb3, 0x02, 0x1a, 0x19, 0x01, 0x00, 0xa1, 0xb3, 0xb3, 0x92, 0x29, 0x3b, 0x3c, 0x5b,
+    0x2a, 0x1a, 0x39, 0x2c, 0x3a, 0x19, 0x4b, 0x4c, 0x2b, 0x09, 0x4a, 0x3b, 0x9a, 0xb3, 0xb3, 0xb3,
+    0x92, 0x91, 0x19, 0x39, 0x3c, 0x3a, 0x2c, 0x29, 0x90, 0xb3, 0x01, 0x5a, 0x3b, 0x3c, 0x4b, 0x2b,
+    0x99, 0xb3, 0xb3, 0xc5, 0xa4, 0x81, 0x18, 0x09, 0x90, 0x19, 0x29, 0x3b, 0x2b, 0xb0, 0xc4, 0x82,
+    0x00, 0x90, 0x91, 0xb1, 0x91, 0xb3, 0xb3, 0xb4, 0x92, 0x4b, 0x3b, 0x9b, 0xa2, 0x11, 0x3b, 0x09,
+    0xb1, 0x93, 0x10, 0x3b, 0x5b, 0x2b, 0x1a, 0x19, 0x19, 0x3a, 0x2b, 0x09, 0x11, 0x2a, 0x3b, 0x2b,
+    0x09, 0x29, 0x3b, 0x2c, 0x39, 0x09, 0x90, 0xc3, 0xc3, 0x92, 0x91, 0x01, 0xff, 0xff, 0x00, 0x00,
+    0x19, 0x90, 0xb2, 0x92, 0x29, 0x3b, 0x3b, 0x99, 0xb1, 0x93, 0x00, 0x19, 0x91, 0x90, 0x11, 0x29,
+    0x3b, 0x9b, 0xc3, 0xb4, 0x02, 0x3b, 0x4b, 0x3b, 0x0b, 0x2a, 0x91, 0x91, 0x29, 0x2b, 0x99, 0x00,
+    0xa2, 0x11, 0x3b, 0x3b, 0xb0, 0x93, 0x4a, 0x2b, 0xb9, 0xa3, 0x92, 0x3a, 0x3a, 0x3b, 0x3b, 0x0a,
+    0xb3, 0xa2, 0x39, 0x3b, 0x1a, 0x91, 0x91, 0x00, 0x00, 0x91, 0x91, 0x00, 0x01, 0x3a, 0x3b, 0x4b,
+    0x3d, 0x3a, 0x2a, 0x4b, 0x3b, 0x1b, 0x91, 0x91, 0xb1, 0x11, 0x39, 0x1a, 0x90, 0x91, 0x5b, 0x2a,
+    0x2a, 0x3c, 0x3b, 0xb1, 0xb5, 0xb3, 0xb2, 0x92, 0x10, 0x3b, 0x3b, 0x3b, 0x1b, 0x39, 0x1a, 0x19,
+    0x19, 0x00, 0x91, 0xa1, 0x92, 0x39, 0x2b, 0x3b, 0x1a, 0x91, 0xa1, 0xb3, 0xc3, 0xb4, 0xa2, 0x01,
+    0x09, 0x3b, 0x19, 0x90, 0x3a, 0x19, 0xa1, 0x92, 0x39, 0x2b, 0xa9, 0x92, 0xb1, 0x92, 0x39, 0x3b,
+    0x01, 0x00, 0x00, 0x00, 0x1a, 0x19, 0xa1, 0xb3, 0x02, 0x3a, 0x4b, 0x2b, 0x9a, 0xc3, 0xb3, 0xa4,
+    0x91, 0x29, 0x3b, 0x2b, 0x19, 0x1a, 0x19, 0xb2, 0xb3, 0xb3, 0xb3, 0x93, 0x19, 0x99, 0xb2, 0x93,
+    0x3a, 0x3b, 0x3b, 0x3b, 0x2a, 0x1a, 0x00, 0x00, 0x19, 0x09, 0x20, 0x2b, 0xa0, 0xb3, 0xb3, 0x10,
+    0x91, 0x11, 0x3a, 0x4b, 0x3c, 0x2a, 0x3a, 0x4b, 0x2b, 0x99, 0x39, 0x1b, 0xb0, 0xb5, 0xb3, 0xb3,
+    0x10, 0x09, 0x00, 0x10, 0x2a, 0x99, 0x01, 0x00, 0xa1, 0xb3, 0x11, 0x09, 0x19, 0x01, 0x91, 0x10,
+    0x99, 0x19, 0x01, 0x29, 0x2b, 0x2a, 0xa0, 0xb3, 0x93, 0x2a, 0x3a, 0x09, 0x09, 0x99, 0x11, 0x19,
+    0xb1, 0xb3, 0x93, 0x29, 0x2a, 0x3b, 0x3b, 0x3b, 0x9a, 0xb3, 0xb3, 0x11, 0x91, 0xd2, 0xa3, 0xa2,
+    0x11, 0x11, 0x3a, 0x3b, 0x1a, 0x19, 0x10, 0xb0, 0xa3, 0x11, 0x90, 0x10, 0x19, 0x91, 0x00, 0x00,
+    0x10, 0x19, 0x19, 0xb0, 0xfc, 0xff, 0x00, 0x00, 0xa3, 0x92, 0x29, 0x99, 0x00, 0x29, 0x1a, 0x99,
+    0x92, 0x99, 0x21, 0x3b, 0x1a, 0x19, 0x19, 0x29, 0x2b, 0x39, 0x9a, 0x91, 0xa1, 0x93, 0x19, 0x3b,
+    0x09, 0x09, 0x01, 0x91, 0x91, 0x39, 0x2c, 0x1a, 0xb3, 0x31, 0x3c, 0x39, 0x99, 0x90, 0x00, 0x00,
+    0xb1, 0xb5, 0xa2, 0x10, 0xb1, 0x93, 0x90, 0x39, 0x0b, 0x19, 0xa3, 0xb1, 0x93, 0x11, 0x3a, 0x3b,
+    0x3b, 0x1b, 0x91, 0x01, 0x19, 0x19, 0x19, 0x29, 0x99, 0x19, 0x29, 0x3c, 0x19, 0x00, 0x29, 0x3b,
+    0x2a, 0x0a, 0xa2, 0x39, 0x3c, 0x1a, 0x92, 0x00, 0x29, 0x3b, 0x0a, 0xb1, 0x13, 0x5b, 0x4c, 0x3b,
+    0x89, 0xa1, 0x82, 0x29, 0x2a, 0x3b, 0x3b, 0x19, 0x90, 0x09, 0x29, 0x1a, 0xb1, 0xa3, 0xb3, 0xc3,
+    0xb4, 0xb2, 0x92, 0x19, 0x91, 0xb1, 0x12, 0x2a, 0x2a, 0x19, 0x19, 0x99, 0x91, 0x91, 0x3c, 0x39,
+    0xa1, 0xb3, 0xb3, 0xb3, 0x92, 0x19, 0x39, 0x3b, 0x02, 0x00, 0x00, 0x00, 0x9a, 0x91, 0x11, 0x3b,
+    0x5b, 0x3b, 0x1b, 0x9a, 0x03, 0x19, 0x3b, 0x1a, 0xc3, 0xb3, 0x93, 0xb2, 0x11, 0x39, 0x2b, 0x3b,
+    0x3b, 0x99, 0x91, 0x91, 0x29, 0x3b, 0x3b, 0x0b, 0x09, 0x93, 0xb1, 0x93, 0x10, 0x3a, 0x3b, 0x2c,
+    0x28, 0x1a, 0x19, 0xa0, 0xb4, 0x11, 0x2a, 0x99, 0x91, 0x91, 0x01, 0x19, 0x01, 0x09, 0x1c, 0x10,
+    0xb3, 0xa3, 0x11, 0x99, 0xb2, 0x93, 0x19, 0x1a, 0x11, 0x19, 0x99, 0x91, 0x91, 0x11, 0x19, 0x2a,
+    0xa0, 0xb3, 0x11, 0x30, 0x3d, 0x3b, 0x3b, 0x09, 0x29, 0x09, 0x91, 0xb1, 0x11, 0x10, 0xa1, 0x91,
+    0xb3, 0xb3, 0x93, 0x0a, 0x91, 0xb3, 0x93, 0x09, 0x3a, 0x10, 0x2f, 0x3a, 0x4b, 0x1a, 0x19, 0x09,
+    0x29, 0x3b, 0x1b, 0x01, 0xa1, 0xb3, 0x92, 0x29, 0x2b, 0x19, 0x99, 0xb1, 0xb5, 0xb3, 0xb3, 0xa2,
+    0x3a, 0x3b, 0x1b, 0x30, 0x1a, 0xa1, 0xb3, 0x11, 0x20, 0x3c, 0x4b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+    0xb1, 0x21, 0x3b, 0x2b, 0x99, 0xb3, 0x92, 0x19, 0x09, 0x19, 0x3a, 0x2b, 0xa0, 0xa3, 0x93, 0x19,
+    0x0a, 0xa1, 0x93, 0x11, 0x3a, 0x2b, 0x99, 0xa2, 0xb2, 0x92, 0x90, 0x91, 0xb3, 0x11, 0x3b, 0x3b,
+    0x3b, 0x99, 0xb2, 0xb3, 0x30, 0x2b, 0x09, 0xa1, 0xb3, 0x92, 0x00, 0xa1, 0x91, 0x19, 0x91, 0xa2,
+    0xa3, 0x39, 0x3b, 0x3b, 0x3b, 0x3b, 0x1a, 0x29, 0x3b, 0x2b, 0x99, 0x29, 0x3a, 0x19, 0x0b, 0x11,
+    0x29, 0x3b, 0x3b, 0x09, 0x3b, 0x3b, 0x2a, 0x19, 0x1a, 0x20, 0x2b, 0x90, 0x09, 0x91, 0xb2, 0x91,
+    0xa3, 0xc3, 0xb4, 0x01, 0x3a, 0x99, 0xa1, 0xa3, 0xa3, 0xa2, 0x11, 0x3a, 0x3b, 0x3b, 0x2b, 0x09,
+    0x29, 0x1b, 0x19, 0x10, 0x19, 0xb1, 0x93, 0x01, 0x3a, 0x3b, 0x3b, 0x1b, 0x91, 0x91, 0xb3, 0xb2,
+    0xb3, 0xb3, 0xb3, 0xb3, 0x11, 0x5a, 0x3b, 0x2b, 0x9a, 0x91, 0x90, 0xb3, 0xc3, 0xa4, 0x91, 0x00,
+    0xff, 0xff, 0x00, 0x00, 0x91, 0x19, 0x91, 0x91, 0x91, 0xb1, 0xc4, 0x93, 0x00, 0x3a, 0x3b, 0x3b,
+    0x2c, 0x39, 0x19, 0x2a, 0x99, 0xc3, 0xc3, 0xb4, 0xb3, 0xb4, 0x01, 0x3a, 0x19, 0xd2, 0xa3, 0x82,
+    0x2a, 0x1a, 0xa2, 0x91, 0x1a, 0xa2, 0xb3, 0x93, 0x01, 0x19, 0x1a, 0x91, 0x01, 0x19, 0x29, 0x2b,
+    0x99, 0x00, 0xa0, 0x93, 0x92, 0x01, 0x99, 0xb1, 0x93, 0xb0, 0x93, 0x3b, 0x4a, 0x09, 0xb1, 0xb3,
+    0x11, 0x19, 0x91, 0x10, 0x99, 0x99, 0x02, 0x91, 0x00, 0x3a, 0x3b, 0x3a, 0x3b, 0x3b, 0x3b, 0x3d,
+    0x3a, 0x2a, 0x3a, 0x2b, 0x90, 0xd2, 0x92, 0x01, 0x2b, 0x3b, 0x3b, 0x3b, 0x19, 0x2a, 0x99, 0x3a,
+    0x19, 0x19, 0x91, 0x19, 0x39, 0x1b, 0xb1, 0x92, 0x11, 0x2a, 0x09, 0x91, 0x91, 0x19, 0x90, 0x91,
+    0xa1, 0x91, 0xb4, 0x92, 0x3b, 0x3b, 0x3b, 0x19, 0x2a, 0x99, 0xb3, 0xb2, 0xb3, 0x92, 0x10, 0x3a,
+    0x1a, 0xb3, 0x99, 0x01, 0xfe, 0xff, 0x00, 0x00, 0x09, 0x11, 0x19, 0x19, 0x00, 0x91, 0x19, 0x3a,
+    0x5b, 0x3c, 0x2a, 0x09, 0x00, 0x19, 0x91, 0xb9, 0x93, 0xa0, 0x93, 0xa1, 0xb3, 0xb3, 0xa3, 0xa3,
+    0xa2, 0xa2, 0x91, 0x91, 0xc2, 0xb4, 0xa2, 0x01, 0x4b, 0x2b, 0x1a, 0x99, 0x20, 0x19, 0x3b, 0x3b,
+    0x09, 0x91, 0x10, 0x3b, 0x99, 0x09, 0x92, 0xa1, 0x92, 0x39, 0x4c, 0x2b, 0x2b, 0xa9, 0xb3, 0x92,
+    0x19, 0x19, 0xb1, 0xd3, 0xb5, 0xa3, 0x00, 0x28, 0x1a, 0xa1, 0xa3, 0xb3, 0xb3, 0xb3, 0xb3, 0x12,
+    0x0b, 0x19, 0x92, 0xa0, 0x20, 0x3a, 0x4c, 0x0a, 0xb2, 0xb3, 0x31, 0x5c, 0x2b, 0x2b, 0x2a, 0x2a,
+    0x19, 0x99, 0x09, 0x91, 0x11, 0x2a, 0x99, 0x91, 0x01, 0x90, 0x01, 0x29, 0x3b, 0x3c, 0x3a, 0x3a,
+    0x1b, 0xd3, 0xa3, 0x02, 0x0b, 0xa1, 0xc3, 0x83, 0x39, 0x1b, 0x19, 0x29, 0x99, 0x29, 0x3b, 0x4d,
+    0x2b, 0x09, 0x08, 0x09, 0xb3, 0x10, 0x2a, 0x3a, 0x01, 0x00, 0x00, 0x00, 0x3b, 0x1b, 0xb3, 0xb2,
+    0x19, 0x39, 0x99, 0xb3, 0xb3, 0x01, 0x10, 0x19, 0x3b, 0x3b, 0x09, 0x91, 0xb0, 0x93, 0x11, 0x19,
+    0x19, 0x5b, 0x2b, 0x2b, 0x19, 0x19, 0x99, 0x10, 0x29, 0x2b, 0x90, 0x90, 0x29, 0x3a, 0x1b, 0x29,
+    0x91, 0xb1, 0xb3, 0xb3, 0x11, 0x91, 0xb1, 0x11, 0x11, 0x19, 0xb9, 0x93, 0x10, 0x90, 0xb2, 0xb3,
+    0xc2, 0x93, 0x92, 0x3b, 0x3a, 0x4b, 0x3b, 0x2c, 0x98, 0x19, 0x49, 0x1b, 0x3b, 0x2a, 0x1a, 0x19,
+    0x91, 0x20, 0x0b, 0x3a, 0x19, 0xa9, 0x21, 0x29, 0x3b, 0x3d, 0x09, 0x19, 0x92, 0x90, 0x20, 0x1a,
+    0x19, 0x10, 0x3b, 0x19, 0x3a, 0x3b, 0x0a, 0x91, 0xb1, 0xa3, 0xa3, 0x02, 0x19, 0x90, 0x19, 0x29,
+    0x0a, 0xa1, 0x93, 0x00, 0x19, 0xb1, 0x93, 0x1a, 0x01, 0x00, 0xb3, 0x19, 0x01, 0x00, 0x00, 0x00,
+    0x90, 0x01, 0x99, 0x01, 0x91, 0x91, 0x00, 0x00, 0x01, 0xb1, 0x93, 0x20, 0x02, 0x00, 0x00, 0x00,
+    0x2b, 0x1b, 0x19, 0x91, 0x00, 0x91, 0x91, 0x01, 0x91, 0x10, 0x3a, 0x2b, 0xa0, 0xa2, 0xb3, 0xb3,
+    0xb3, 0x93, 0x00, 0x19, 0x19, 0x2b, 0x90, 0x19, 0x01, 0x01, 0x3b, 0x09, 0x09, 0xb2, 0xb3, 0x11,
+    0x99, 0x91, 0xb3, 0x92, 0xb2, 0x11, 0x1a, 0x2a, 0x01, 0x19, 0x20, 0x09, 0x5b, 0x1b, 0x19, 0x09,
+    0xa1, 0xb3, 0xb2, 0x01, 0xb3, 0xb3, 0xb2, 0xb2, 0x93, 0xa0, 0x93, 0xa2, 0x91, 0x11, 0x19, 0x99,
+    0x19, 0x10, 0x91, 0x91, 0x90, 0xb3, 0xc3, 0xa3, 0x01, 0x01, 0x19, 0x19, 0x39, 0x3b, 0x1b, 0x00,
+    0x10, 0x1a, 0x91, 0xb3, 0x91, 0x39, 0x99, 0x00, 0x99, 0x92, 0x91, 0x2a, 0x19, 0xa1, 0xb3, 0xa3,
+    0x20, 0x1b, 0x00, 0x01, 0x19, 0x19, 0xa1, 0xc3, 0xa3, 0x93, 0xa1, 0xb3, 0x92, 0x00, 0x19, 0xa1,
+    0xd3, 0xb4, 0x92, 0x90, 0xa1, 0xa1, 0x93, 0x01, 0x19, 0x91, 0x20, 0x2b, 0x3d, 0x09, 0x90, 0xa1,
+    0xfd, 0xff, 0x00, 0x00, 0x11, 0x91, 0x91, 0x91, 0x91, 0x00, 0x19, 0x3b};
+#endif
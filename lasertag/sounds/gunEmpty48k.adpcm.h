@@ -0,0 +1,7 @@
+// This file was generated by executing this statement: wav2adpcm -r 48000 -k soundBank.bin bcfire01_48k.wav.c gameBoyStartup.wav.c gameOver48k.wav.c gunEmpty48k.wav.c ouch48k.wav.c pacmanDeath.wav.c powerUp48k.wav.c screamAndDie48k.wav.c
+#include <stdint.h>
+extern const uint8_t gunEmpty48k_adpcm[];
+#define GUNEMPTY48K_ADPCM_SAMPLE_RATE 48000
+#define GUNEMPTY48K_ADPCM_NUMBER_OF_SAMPLES 15456
+#define GUNEMPTY48K_ADPCM_SIZE 7972
+#define GUNEMPTY48K_ADPCM_BANK_OFFSET 163840
@@ -0,0 +1,1959 @@
+// This file was generated by executing this statement: wav2adpcm -r 48000 -k soundBank.bin bcfire01_48k.wav.c gameBoyStartup.wav.c gameOver48k.wav.c gunEmpty48k.wav.c ouch48k.wav.c pacmanDeath.wav.c powerUp48k.wav.c screamAndDie48k.wav.c
+
+#include "soundAssets.h"
+#include <stdint.h>
+
+#ifndef SOUND_ASSETS_ON_SD
+// IMA-ADPCM, 60480 samples at 48000 Hz.
+SOUND_ASSET const uint8_t powerUp48k_adpcm[31188] = {
+    0xfe, 0xff, 0x00, 0x00, 0x10, 0x0b, 0x9b, 0xbb, 0xc9, 0xb1, 0xb3, 0xb3, 0x32, 0x4b, 0x08, 0xb2,
+    0xb2, 0xba, 0xbc, 0xfb, 0xca, 0xbb, 0xcc, 0xca, 0xba, 0xba, 0xaa, 0x9b, 0xa0, 0x05, 0x53, 0x72,
+    0x31, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x32, 0x43, 0x32, 0x33, 0x43, 0x43, 0x43, 0x33,
+    0x35, 0x43, 0x42, 0x31, 0x21, 0x02, 0xa0, 0xf9, 0xda, 0xdb, 0xbc, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb,
+    0xbb, 0xbc, 0xab, 0xab, 0x9b, 0x89, 0x10, 0x42, 0x53, 0x34, 0x43, 0x43, 0x32, 0x32, 0x22, 0x11,
+    0x89, 0xba, 0xbd, 0xbd, 0xca, 0x9a, 0x89, 0x30, 0x55, 0x44, 0x35, 0x44, 0x43, 0x34, 0x43, 0x33,
+    0x24, 0x23, 0x23, 0x12, 0x01, 0xa9, 0xdb, 0xbd, 0xcc, 0xdb, 0xba, 0xac, 0xbb, 0xbb, 0xbb, 0xaa,
+    0x8a, 0x18, 0x31, 0x44, 0x24, 0x25, 0x23, 0x23, 0x12, 0x00, 0xba, 0xcd, 0xbd, 0xbd, 0xbc, 0xbc,
+    0xcb, 0xab, 0xab, 0x9a, 0xbb, 0xf8, 0x1b, 0x00, 0x89, 0x21, 0x53, 0x44, 0x44, 0x33, 0x44, 0x32,
+    0x43, 0x22, 0x22, 0x12, 0x01, 0x98, 0xaa, 0xbd, 0xcb, 0xac, 0xac, 0xaa, 0x99, 0x09, 0x21, 0x53,
+    0x35, 0x44, 0x43, 0x33, 0x34, 0x32, 0x33, 0x22, 0x20, 0x89, 0xab, 0xbe, 0xbc, 0xcc, 0xbb, 0xbb,
+    0xbc, 0xb9, 0xba, 0xa9, 0xa8, 0xa8, 0xa9, 0xbc, 0xcd, 0xdc, 0xdb, 0xcb, 0xdb, 0xbb, 0xbc, 0xbc,
+    0xcb, 0xba, 0xaa, 0xaa, 0x99, 0x00, 0x32, 0x44, 0x44, 0x43, 0x33, 0x34, 0x33, 0x33, 0x33, 0x23,
+    0x23, 0x22, 0x33, 0x35, 0x36, 0x45, 0x53, 0x34, 0x44, 0x43, 0x43, 0x33, 0x34, 0x24, 0x32, 0x22,
+    0x12, 0x81, 0xa8, 0xcc, 0xeb, 0xcb, 0xcb, 0xcb, 0xcb, 0xba, 0xbb, 0xac, 0xaa, 0xaa, 0x99, 0x89,
+    0x88, 0x08, 0x88, 0xa8, 0xca, 0xcd, 0xdb, 0xcc, 0xbb, 0xbd, 0xcb, 0xbb, 0xbb, 0xbb, 0x99, 0x18,
+    0x53, 0x54, 0x44, 0x43, 0x34, 0x34, 0x43, 0x43, 0xea, 0x04, 0x31, 0x00, 0x32, 0x33, 0x32, 0x23,
+    0x12, 0x01, 0x88, 0xaa, 0xdb, 0xbb, 0xcc, 0xaa, 0xab, 0x9a, 0x89, 0x18, 0x22, 0x44, 0x33, 0x24,
+    0x12, 0x80, 0xdb, 0xce, 0xbc, 0xbe, 0xbc, 0xbc, 0xad, 0xcb, 0xba, 0xac, 0xba, 0xaa, 0x9a, 0x99,
+    0x08, 0x21, 0x43, 0x44, 0x43, 0x43, 0x43, 0x23, 0x24, 0x32, 0x23, 0x23, 0x33, 0x32, 0x32, 0x33,
+    0x34, 0x43, 0x24, 0x34, 0x43, 0x24, 0x43, 0x32, 0x32, 0x23, 0x13, 0x01, 0xa0, 0xda, 0xdb, 0xdb,
+    0xcb, 0xbb, 0xad, 0xbb, 0xbb, 0xac, 0xab, 0xbb, 0xac, 0xcb, 0xbb, 0xbd, 0xbc, 0xcc, 0xcb, 0xbb,
+    0xad, 0xbb, 0xac, 0xab, 0xaa, 0x98, 0x11, 0x53, 0x54, 0x43, 0x34, 0x34, 0x43, 0x33, 0x33, 0x33,
+    0x12, 0x81, 0xa9, 0xdc, 0xdb, 0xcb, 0xcb, 0xab, 0xbb, 0xaa, 0x99, 0x20, 0x44, 0x44, 0x44, 0x33,
+    0x25, 0x33, 0x24, 0x22, 0x01, 0x80, 0xb9, 0xdc, 0xdb, 0xcb, 0xcb, 0xbb, 0x76, 0xfc, 0x2b, 0x00,
+    0xcb, 0xaa, 0x9a, 0x89, 0x10, 0x43, 0x35, 0x35, 0x34, 0x43, 0x33, 0x43, 0x12, 0x11, 0x90, 0xb9,
+    0xcc, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x20, 0x53, 0x44, 0x43, 0x34, 0x43, 0x32,
+    0x32, 0x21, 0x80, 0xa8, 0xcc, 0xcc, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x21, 0x35,
+    0x36, 0x34, 0x35, 0x33, 0x44, 0x32, 0x32, 0x23, 0x23, 0x22, 0x01, 0x80, 0x99, 0xbb, 0xcc, 0xcb,
+    0xcb, 0xba, 0xab, 0xbb, 0xaa, 0x99, 0x89, 0x00, 0x11, 0x12, 0x12, 0xa0, 0xdc, 0xce, 0xdc, 0xbc,
+    0xbd, 0xbd, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0x9b, 0x9a, 0x00, 0x32, 0x55, 0x53,
+    0x34, 0x34, 0x34, 0x34, 0x43, 0x32, 0x33, 0x24, 0x12, 0x12, 0x01, 0x80, 0x98, 0xba, 0xca, 0xbb,
+    0xbb, 0xaa, 0x89, 0x21, 0x35, 0x45, 0x33, 0x25, 0x22, 0x02, 0xa8, 0xdc, 0xcd, 0xcc, 0xdb, 0xcb,
+    0x1a, 0x03, 0x32, 0x00, 0xcb, 0xac, 0xbb, 0xac, 0xbb, 0xab, 0xab, 0x99, 0x08, 0x30, 0x53, 0x44,
+    0x43, 0x34, 0x33, 0x34, 0x43, 0x22, 0x23, 0x21, 0x11, 0x01, 0x00, 0x80, 0x08, 0x10, 0x42, 0x44,
+    0x44, 0x44, 0x43, 0x43, 0x43, 0x33, 0x33, 0x33, 0x23, 0x01, 0xa9, 0xcc, 0xcd, 0xbc, 0xbd, 0xdb,
+    0xbb, 0xcb, 0xcb, 0xba, 0xba, 0xaa, 0xaa, 0x99, 0x88, 0x11, 0x32, 0x44, 0x43, 0x33, 0x43, 0x32,
+    0x12, 0x02, 0x80, 0xa9, 0xcb, 0xbc, 0xbc, 0xba, 0x9a, 0x18, 0x73, 0x44, 0x44, 0x44, 0x43, 0x43,
+    0x24, 0x33, 0x34, 0x32, 0x23, 0x13, 0x02, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xbb, 0xbc, 0xcb, 0xba,
+    0xaa, 0x99, 0x09, 0x10, 0x33, 0x35, 0x34, 0x34, 0x32, 0x12, 0x80, 0xca, 0xcd, 0xcc, 0xcc, 0xbb,
+    0xbc, 0xbc, 0xbb, 0xbb, 0xba, 0x89, 0x28, 0x52, 0x44, 0x34, 0x35, 0x43, 0x33, 0x34, 0x23, 0x23,
+    0x22, 0x01, 0x88, 0xba, 0xdb, 0x0c, 0x25, 0x00, 0xdb, 0xcb, 0xbb, 0xac, 0xa9, 0x08, 0x31, 0x54,
+    0x44, 0x34, 0x43, 0x43, 0x32, 0x22, 0x02, 0x90, 0xda, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xac,
+    0xab, 0x9b, 0x9a, 0x08, 0x11, 0x53, 0x43, 0x34, 0x24, 0x33, 0x33, 0x23, 0x12, 0x90, 0xa9, 0xcc,
+    0xdb, 0xba, 0xbb, 0xaa, 0x08, 0x52, 0x54, 0x44, 0x43, 0x34, 0x34, 0x43, 0x23, 0x33, 0x22, 0x02,
+    0x90, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xab, 0xbb, 0xab, 0xaa, 0x99, 0x00, 0x31, 0x34, 0x35,
+    0x43, 0x33, 0x33, 0x23, 0x00, 0xa8, 0xcc, 0xbd, 0xcc, 0xbb, 0xbc, 0xba, 0xab, 0x89, 0x10, 0x63,
+    0x44, 0x53, 0x53, 0x42, 0x32, 0x33, 0x24, 0x22, 0x12, 0x01, 0x98, 0xca, 0xcc, 0xbc, 0xbc, 0xbc,
+    0xcb, 0xba, 0xba, 0x9a, 0x8a, 0x00, 0x42, 0x53, 0x34, 0x44, 0x42, 0x32, 0x32, 0x32, 0x21, 0x00,
+    0xa8, 0xcb, 0xbd, 0xbd, 0xbc, 0xcb, 0xbb, 0xbb, 0x7d, 0xf7, 0x2a, 0x00, 0xab, 0xa9, 0x08, 0x31,
+    0x44, 0x34, 0x44, 0x32, 0x33, 0x23, 0x12, 0x98, 0xdb, 0xcc, 0xcc, 0xcb, 0xbb, 0xbc, 0xba, 0xaa,
+    0x09, 0x20, 0x44, 0x45, 0x53, 0x33, 0x35, 0x33, 0x34, 0x32, 0x32, 0x12, 0x01, 0x99, 0xca, 0xcc,
+    0xcb, 0xac, 0xac, 0xba, 0xba, 0xaa, 0x99, 0x89, 0x10, 0x21, 0x22, 0x12, 0x80, 0xdb, 0xdd, 0xcc,
+    0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xba, 0x9a, 0x09, 0x32, 0x46, 0x34, 0x45, 0x33, 0x34, 0x43, 0x23,
+    0x33, 0x22, 0x11, 0x88, 0xb9, 0xbc, 0xcd, 0xbb, 0xcb, 0xbb, 0xaa, 0x89, 0x10, 0x43, 0x35, 0x35,
+    0x34, 0x24, 0x33, 0x22, 0x01, 0x98, 0xdb, 0xbd, 0xbd, 0xbd, 0xcb, 0xbb, 0xcb, 0xba, 0x9a, 0x99,
+    0x08, 0x22, 0x44, 0x34, 0x34, 0x43, 0x23, 0x23, 0x12, 0x81, 0xa9, 0xcc, 0xcc, 0xcb, 0xbb, 0xcb,
+    0xaa, 0x8a, 0x08, 0x41, 0x63, 0x53, 0x43, 0x24, 0x24, 0x33, 0x23, 0x33, 0x7a, 0x16, 0x2d, 0x00,
+    0x12, 0x02, 0x98, 0xba, 0xcc, 0xbc, 0xbc, 0xac, 0xab, 0xaa, 0x99, 0x08, 0x21, 0x43, 0x53, 0x23,
+    0x33, 0x11, 0xa0, 0xdc, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xab, 0xab, 0x89, 0x08,
+    0x32, 0x44, 0x34, 0x34, 0x34, 0x43, 0x32, 0x33, 0x33, 0x43, 0x32, 0x34, 0x43, 0x53, 0x43, 0x43,
+    0x34, 0x34, 0x43, 0x43, 0x23, 0x24, 0x22, 0x21, 0x01, 0x90, 0xb9, 0xbd, 0xbd, 0xbd, 0xcb, 0xac,
+    0xcb, 0xba, 0xcb, 0xba, 0xba, 0xbb, 0xbb, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xcb, 0xba, 0xbb, 0xbb,
+    0xaa, 0x89, 0x21, 0x55, 0x44, 0x53, 0x34, 0x53, 0x33, 0x34, 0x33, 0x34, 0x32, 0x23, 0x23, 0x11,
+    0x01, 0x80, 0x99, 0xba, 0xba, 0xba, 0x98, 0x21, 0x55, 0x44, 0x44, 0x43, 0x43, 0x33, 0x43, 0x23,
+    0x23, 0x12, 0x80, 0xb9, 0xdc, 0xbc, 0xcd, 0xbb, 0xbd, 0xcb, 0xac, 0xac, 0xbb, 0xbb, 0xbc, 0xcb,
+    0xdc, 0xf5, 0x2a, 0x00, 0xba, 0xbb, 0xbb, 0xac, 0xab, 0xbb, 0xab, 0xbb, 0xaa, 0x9a, 0x89, 0x10,
+    0x43, 0x45, 0x54, 0x43, 0x53, 0x53, 0x33, 0x35, 0x53, 0x33, 0x34, 0x34, 0x43, 0x43, 0x32, 0x24,
+    0x23, 0x33, 0x22, 0x22, 0x10, 0xa8, 0xca, 0xcc, 0xbc, 0xbd, 0xcb, 0xac, 0xbb, 0xcb, 0xba, 0xaa,
+    0xaa, 0xaa, 0x99, 0x99, 0xa9, 0xba, 0xdc, 0xeb, 0xcb, 0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xaa,
+    0x89, 0x18, 0x42, 0x35, 0x45, 0x43, 0x43, 0x33, 0x34, 0x33, 0x33, 0x33, 0x32, 0x11, 0x80, 0x98,
+    0xab, 0xbc, 0xbb, 0xac, 0x9a, 0x09, 0x21, 0x54, 0x53, 0x43, 0x24, 0x43, 0x22, 0x32, 0x11, 0x88,
+    0xca, 0xcd, 0xbc, 0xbd, 0xbd, 0xcb, 0xcb, 0xba, 0xac, 0xaa, 0x9a, 0x8a, 0x08, 0x21, 0x43, 0x34,
+    0x34, 0x33, 0x23, 0x12, 0x98, 0xcc, 0xcc, 0xbc, 0xbc, 0xac, 0xaa, 0x89, 0x10, 0x63, 0x34, 0x45,
+    0x33, 0x25, 0x33, 0x24, 0x6e, 0x0a, 0x2e, 0x00, 0x22, 0x12, 0x01, 0x88, 0x9a, 0xcb, 0xbb, 0xbc,
+    0xab, 0xab, 0x99, 0x99, 0x98, 0xaa, 0xcd, 0xcd, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xaa, 0x99,
+    0x08, 0x21, 0x44, 0x34, 0x35, 0x43, 0x33, 0x33, 0x33, 0x33, 0x22, 0x23, 0x32, 0x43, 0x44, 0x53,
+    0x43, 0x43, 0x23, 0x33, 0x22, 0x88, 0xeb, 0xbd, 0xbe, 0xcc, 0xbb, 0xad, 0xbb, 0xbb, 0xbb, 0x9a,
+    0x99, 0x11, 0x32, 0x35, 0x34, 0x24, 0x23, 0x13, 0x11, 0x88, 0xb9, 0xca, 0xba, 0xa9, 0x10, 0x44,
+    0x36, 0x45, 0x33, 0x35, 0x33, 0x33, 0x33, 0x23, 0x22, 0x01, 0x01, 0x11, 0x23, 0x45, 0x34, 0x44,
+    0x33, 0x32, 0x02, 0xa8, 0xdd, 0xdc, 0xdb, 0xbb, 0xbc, 0xac, 0xba, 0x99, 0x88, 0x22, 0x53, 0x34,
+    0x24, 0x23, 0x12, 0x98, 0xcd, 0xcc, 0xbd, 0xdb, 0xbb, 0xac, 0xab, 0xaa, 0x89, 0x18, 0x33, 0x36,
+    0x44, 0x42, 0x32, 0x23, 0x23, 0x12, 0x11, 0x00, 0xdc, 0x00, 0x27, 0x00, 0x08, 0x08, 0x21, 0x44,
+    0x54, 0x43, 0x34, 0x34, 0x43, 0x32, 0x22, 0x11, 0x01, 0x89, 0xab, 0xbc, 0xbc, 0xac, 0xbb, 0xac,
+    0xbc, 0xcb, 0xcc, 0xbc, 0xbd, 0xbc, 0xad, 0xac, 0xbb, 0xab, 0xab, 0x9a, 0x88, 0x22, 0x44, 0x34,
+    0x43, 0x33, 0x33, 0x11, 0x80, 0xb9, 0xdb, 0xbb, 0xab, 0x18, 0x64, 0x54, 0x44, 0x53, 0x33, 0x34,
+    0x33, 0x23, 0x12, 0x81, 0xa9, 0xdc, 0xcb, 0xbc, 0xbb, 0xac, 0x9b, 0x9a, 0x08, 0x21, 0x33, 0x35,
+    0x34, 0x32, 0x12, 0x01, 0xa9, 0xdb, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0xab, 0xaa, 0x9a, 0xbb, 0xdb,
+    0xcb, 0xcb, 0xcb, 0xbb, 0xab, 0x9a, 0x10, 0x63, 0x44, 0x44, 0x33, 0x34, 0x24, 0x22, 0x11, 0x01,
+    0x98, 0xa8, 0x89, 0x18, 0x63, 0x45, 0x35, 0x35, 0x34, 0x34, 0x33, 0x23, 0x12, 0x90, 0xca, 0xcd,
+    0xdb, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x99, 0x89, 0x08, 0x00, 0x80, 0x98, 0xc2, 0xf4, 0x23, 0x00,
+    0xcb, 0xcc, 0xbc, 0xbc, 0xab, 0x9b, 0x18, 0x53, 0x45, 0x34, 0x35, 0x33, 0x24, 0x23, 0x11, 0x80,
+    0xa9, 0xca, 0xcb, 0xaa, 0x89, 0x31, 0x46, 0x44, 0x34, 0x43, 0x33, 0x22, 0x11, 0x99, 0xcc, 0xcc,
+    0xdb, 0xca, 0xaa, 0xaa, 0x99, 0x09, 0x11, 0x32, 0x34, 0x33, 0x13, 0x90, 0xdb, 0xcd, 0xbc, 0xbc,
+    0xac, 0xab, 0x99, 0x08, 0x30, 0x53, 0x43, 0x33, 0x23, 0x12, 0x80, 0xa9, 0xac, 0xab, 0x18, 0x74,
+    0x54, 0x44, 0x53, 0x33, 0x34, 0x33, 0x22, 0x02, 0x90, 0xcb, 0xcc, 0xbc, 0xbc, 0xab, 0xbb, 0x99,
+    0x09, 0x21, 0x42, 0x33, 0x23, 0x81, 0xda, 0xdc, 0xcc, 0xbc, 0xcb, 0xab, 0xbb, 0x9a, 0x89, 0x18,
+    0x32, 0x43, 0x43, 0x12, 0x02, 0x80, 0x99, 0x89, 0x30, 0x66, 0x54, 0x44, 0x53, 0x43, 0x33, 0x34,
+    0x32, 0x22, 0x01, 0x98, 0xbb, 0xbe, 0xbc, 0xac, 0xbb, 0xba, 0x99, 0x09, 0x00, 0x12, 0x21, 0x88,
+    0x80, 0x09, 0x25, 0x00, 0xdb, 0xcd, 0xcc, 0xbc, 0xcb, 0xbb, 0xab, 0xaa, 0x08, 0x31, 0x54, 0x43,
+    0x33, 0x24, 0x22, 0x11, 0x80, 0xa9, 0xbb, 0xcb, 0x9a, 0x00, 0x53, 0x45, 0x53, 0x33, 0x33, 0x23,
+    0x02, 0x98, 0xdb, 0xbc, 0xbc, 0xab, 0x09, 0x41, 0x45, 0x35, 0x44, 0x33, 0x34, 0x22, 0x12, 0x90,
+    0xb9, 0xcd, 0xcb, 0xbc, 0xcb, 0xba, 0xba, 0x9a, 0x9a, 0x99, 0xa8, 0xaa, 0xcc, 0xdb, 0xbc, 0xcb,
+    0xbb, 0xbb, 0x9a, 0x28, 0x63, 0x44, 0x34, 0x44, 0x32, 0x33, 0x23, 0x12, 0x01, 0x90, 0xa9, 0xb9,
+    0xa9, 0x18, 0x53, 0x45, 0x44, 0x33, 0x34, 0x32, 0x12, 0x81, 0xb8, 0xeb, 0xcb, 0xcb, 0xbb, 0xba,
+    0x9a, 0x89, 0x00, 0x11, 0x11, 0x90, 0xdb, 0xdd, 0xbc, 0xbd, 0xdb, 0xba, 0xbb, 0xba, 0xba, 0xaa,
+    0xb9, 0xca, 0xdb, 0xdb, 0xcb, 0xcb, 0xcb, 0xaa, 0x89, 0x20, 0x54, 0x35, 0x36, 0x53, 0x43, 0x32,
+    0x24, 0x22, 0x22, 0x11, 0x63, 0x22, 0x31, 0x00, 0x80, 0x88, 0x9a, 0xbb, 0xba, 0xbb, 0xaa, 0x99,
+    0xa9, 0xba, 0xcd, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xba, 0xaa, 0x9a, 0x88, 0x98, 0xb8, 0xeb,
+    0xbd, 0xbe, 0xbc, 0xbc, 0xac, 0xaa, 0x8a, 0x10, 0x53, 0x44, 0x44, 0x33, 0x34, 0x33, 0x32, 0x13,
+    0x12, 0x01, 0x00, 0x10, 0x42, 0x63, 0x43, 0x44, 0x32, 0x33, 0x22, 0x00, 0xca, 0xcd, 0xcc, 0xcb,
+    0xcb, 0xbb, 0xba, 0xab, 0xa9, 0x98, 0x80, 0x00, 0x80, 0x98, 0xca, 0xdb, 0xcb, 0xbb, 0x9a, 0x19,
+    0x62, 0x44, 0x53, 0x43, 0x33, 0x23, 0x22, 0x80, 0xa9, 0xbc, 0xbd, 0xba, 0x8a, 0x20, 0x64, 0x44,
+    0x34, 0x25, 0x43, 0x22, 0x13, 0x12, 0x80, 0xa9, 0xcb, 0xbc, 0xbc, 0xcb, 0xab, 0xab, 0xaa, 0xab,
+    0xba, 0xdb, 0xcb, 0xdb, 0xcb, 0xbb, 0xbc, 0xac, 0xaa, 0x9a, 0x89, 0x00, 0x42, 0x43, 0x34, 0x34,
+    0x34, 0x33, 0x43, 0x33, 0x33, 0x25, 0x43, 0x33, 0xe9, 0x03, 0x28, 0x00, 0x44, 0x42, 0x23, 0x24,
+    0x33, 0x33, 0x32, 0x11, 0x98, 0xda, 0xcc, 0xcc, 0xcb, 0xcb, 0xbb, 0xab, 0xbb, 0x9a, 0x88, 0x11,
+    0x33, 0x25, 0x33, 0x11, 0xa8, 0xdd, 0xbd, 0xbd, 0xbc, 0xbc, 0xba, 0xab, 0x8a, 0x09, 0x21, 0x53,
+    0x33, 0x43, 0x23, 0x12, 0x01, 0x01, 0x32, 0x55, 0x55, 0x53, 0x44, 0x43, 0x43, 0x33, 0x33, 0x32,
+    0x11, 0x98, 0xca, 0xbd, 0xcc, 0xbb, 0xac, 0xab, 0xaa, 0x99, 0x80, 0x10, 0x00, 0x90, 0xc9, 0xcd,
+    0xbc, 0xbd, 0xbc, 0xba, 0xab, 0x8a, 0x10, 0x53, 0x44, 0x43, 0x43, 0x32, 0x22, 0x11, 0x80, 0x99,
+    0xbb, 0xcb, 0xaa, 0x09, 0x31, 0x46, 0x34, 0x34, 0x33, 0x23, 0x01, 0xa9, 0xcd, 0xbc, 0xcb, 0xaa,
+    0x8a, 0x21, 0x55, 0x34, 0x35, 0x34, 0x43, 0x22, 0x11, 0x88, 0xb9, 0xcd, 0xcb, 0xcb, 0xbb, 0xac,
+    0xaa, 0x99, 0x99, 0x98, 0x88, 0xa9, 0xcb, 0xcc, 0xcc, 0xbb, 0xcb, 0xba, 0xb2, 0xe2, 0x2b, 0x00,
+    0x99, 0x10, 0x53, 0x35, 0x35, 0x34, 0x24, 0x23, 0x23, 0x12, 0x00, 0x98, 0x99, 0xaa, 0x88, 0x30,
+    0x55, 0x34, 0x35, 0x34, 0x33, 0x33, 0x11, 0x90, 0xda, 0xdb, 0xcb, 0xac, 0xab, 0xaa, 0x9a, 0x09,
+    0x00, 0x11, 0x01, 0x98, 0xeb, 0xdc, 0xdb, 0xcb, 0xbb, 0xbc, 0xba, 0xab, 0xaa, 0xaa, 0xba, 0xbc,
+    0xbd, 0xbd, 0xbc, 0xbc, 0xac, 0x9a, 0x08, 0x42, 0x45, 0x45, 0x43, 0x34, 0x43, 0x33, 0x24, 0x22,
+    0x12, 0x10, 0x88, 0x99, 0xaa, 0xbb, 0xab, 0xab, 0x9a, 0x9a, 0xa9, 0xdb, 0xdc, 0xcc, 0xdb, 0xcb,
+    0xcb, 0xbb, 0xab, 0xab, 0xaa, 0x89, 0x88, 0x89, 0xca, 0xdc, 0xdc, 0xcb, 0xdb, 0xba, 0xbb, 0xaa,
+    0x09, 0x31, 0x55, 0x34, 0x35, 0x34, 0x33, 0x33, 0x33, 0x22, 0x11, 0x00, 0x10, 0x20, 0x52, 0x44,
+    0x34, 0x44, 0x32, 0x23, 0x12, 0x98, 0xcc, 0xbd, 0xcd, 0xbb, 0xbc, 0xbb, 0xba, 0xab, 0x99, 0x88,
+    0x54, 0xef, 0x2c, 0x00, 0x80, 0x00, 0x80, 0xa9, 0xcc, 0xcb, 0xcb, 0xaa, 0x89, 0x21, 0x55, 0x34,
+    0x44, 0x33, 0x33, 0x22, 0x01, 0xa9, 0xcc, 0xbc, 0xbb, 0xaa, 0x18, 0x73, 0x44, 0x44, 0x43, 0x33,
+    0x43, 0x32, 0x12, 0x01, 0x98, 0xb9, 0xbc, 0xdb, 0xba, 0xbb, 0xac, 0xba, 0xcb, 0xcb, 0xbc, 0xcc,
+    0xcb, 0xbb, 0xbc, 0xcb, 0xaa, 0xa9, 0x88, 0x18, 0x22, 0x34, 0x34, 0x43, 0x24, 0x23, 0x43, 0x33,
+    0x44, 0x43, 0x43, 0x24, 0x24, 0x33, 0x23, 0x23, 0x11, 0x90, 0xba, 0xcd, 0xdb, 0xba, 0xac, 0xab,
+    0xab, 0xaa, 0xaa, 0xaa, 0xba, 0xcb, 0xcb, 0xbb, 0xbb, 0x9a, 0x18, 0x62, 0x63, 0x33, 0x34, 0x33,
+    0x11, 0xa8, 0xdc, 0xcc, 0xbc, 0xcb, 0xaa, 0x9a, 0x08, 0x32, 0x45, 0x53, 0x32, 0x33, 0x12, 0x01,
+    0x99, 0xbb, 0xcb, 0x99, 0x41, 0x46, 0x45, 0x43, 0x34, 0x33, 0x33, 0x12, 0x80, 0xdb, 0xbd, 0xbd,
+    0xbc, 0xcb, 0xaa, 0x9b, 0xbd, 0xf6, 0x2e, 0x00, 0x9a, 0x08, 0x00, 0x11, 0x12, 0x01, 0x99, 0xdb,
+    0xdb, 0xbb, 0xab, 0x09, 0x51, 0x45, 0x35, 0x35, 0x43, 0x24, 0x32, 0x21, 0x01, 0x90, 0xa9, 0xbc,
+    0xbc, 0xcb, 0x9a, 0x99, 0x10, 0x31, 0x34, 0x24, 0x22, 0x90, 0xea, 0xcc, 0xcc, 0xcb, 0xbb, 0xbb,
+    0xab, 0x88, 0x32, 0x45, 0x44, 0x33, 0x24, 0x23, 0x11, 0x98, 0xca, 0xbc, 0xad, 0xbb, 0xab, 0x89,
+    0x20, 0x44, 0x35, 0x24, 0x24, 0x12, 0x81, 0xa8, 0xdb, 0xcc, 0xcb, 0xbb, 0xba, 0xaa, 0x08, 0x30,
+    0x44, 0x34, 0x34, 0x43, 0x22, 0x12, 0x02, 0x01, 0x01, 0x31, 0x63, 0x63, 0x43, 0x43, 0x43, 0x22,
+    0x02, 0x90, 0xdb, 0xcd, 0xbc, 0xcc, 0xcb, 0xba, 0xbb, 0xba, 0x99, 0x09, 0x11, 0x33, 0x35, 0x43,
+    0x22, 0x22, 0x11, 0x00, 0x10, 0x31, 0x46, 0x54, 0x53, 0x43, 0x43, 0x23, 0x23, 0x12, 0x88, 0xca,
+    0xcc, 0xcb, 0xac, 0xab, 0xaa, 0x89, 0x11, 0x33, 0xf2, 0x00, 0x28, 0x00, 0x35, 0x24, 0x22, 0x81,
+    0xb9, 0xdc, 0xcc, 0xca, 0xaa, 0x9a, 0x89, 0x20, 0x42, 0x43, 0x33, 0x12, 0x80, 0xcc, 0xbd, 0xcd,
+    0xbb, 0xbb, 0xbb, 0x89, 0x30, 0x54, 0x44, 0x53, 0x33, 0x33, 0x24, 0x22, 0x22, 0x01, 0x00, 0x00,
+    0x00, 0x10, 0x23, 0x34, 0x34, 0x32, 0x01, 0xd9, 0xdd, 0xcd, 0xdb, 0xdb, 0xbb, 0xbc, 0xac, 0xab,
+    0xaa, 0x89, 0x08, 0x32, 0x35, 0x35, 0x34, 0x33, 0x33, 0x32, 0x21, 0x00, 0x88, 0x88, 0x10, 0x53,
+    0x44, 0x44, 0x43, 0x23, 0x23, 0x01, 0xb9, 0xdc, 0xbd, 0xbc, 0xcb, 0xba, 0x99, 0x09, 0x31, 0x53,
+    0x34, 0x33, 0x22, 0x81, 0xc9, 0xdc, 0xdb, 0xcb, 0xba, 0xbb, 0x9a, 0x89, 0x11, 0x43, 0x44, 0x33,
+    0x33, 0x24, 0x22, 0x11, 0x11, 0x11, 0x22, 0x53, 0x53, 0x43, 0x43, 0x23, 0x23, 0x12, 0x00, 0xaa,
+    0xdc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0x9b, 0x09, 0x31, 0x5f, 0xf8, 0x1e, 0x00,
+    0x55, 0x53, 0x43, 0x32, 0x23, 0x02, 0x98, 0xdc, 0xdb, 0xac, 0xac, 0xab, 0xa9, 0x08, 0x21, 0x53,
+    0x34, 0x43, 0x22, 0x22, 0x81, 0x80, 0x89, 0x08, 0x43, 0x55, 0x44, 0x43, 0x43, 0x32, 0x12, 0x81,
+    0xb9, 0xcd, 0xdb, 0xbb, 0xcb, 0xba, 0x9a, 0x9a, 0x88, 0x88, 0x88, 0xa9, 0xba, 0xbc, 0xaa, 0x89,
+    0x62, 0x54, 0x53, 0x43, 0x23, 0x13, 0x01, 0xb8, 0xeb, 0xcb, 0xba, 0xaa, 0x08, 0x43, 0x45, 0x43,
+    0x24, 0x12, 0x81, 0xa9, 0xdc, 0xcb, 0xbb, 0xab, 0x89, 0x31, 0x55, 0x44, 0x33, 0x43, 0x22, 0x81,
+    0xa8, 0xdb, 0xbc, 0xbc, 0xac, 0xaa, 0x89, 0x00, 0x21, 0x32, 0x33, 0x01, 0xa9, 0xdd, 0xcb, 0xbb,
+    0xab, 0x18, 0x63, 0x45, 0x53, 0x33, 0x43, 0x22, 0x01, 0x98, 0xca, 0xdb, 0xcb, 0xba, 0xbb, 0xab,
+    0xab, 0xba, 0xba, 0xbc, 0xbc, 0xbb, 0x9b, 0x30, 0x56, 0x55, 0x43, 0x34, 0x34, 0x33, 0x33, 0x21,
+    0x08, 0x16, 0x2c, 0x00, 0x80, 0xa9, 0xcb, 0xcb, 0xbb, 0xab, 0x9b, 0xab, 0xcb, 0xcd, 0xdc, 0xdb,
+    0xcb, 0xbb, 0xac, 0xaa, 0x88, 0x11, 0x44, 0x34, 0x34, 0x24, 0x23, 0x11, 0x81, 0x88, 0xa9, 0x99,
+    0x18, 0x41, 0x63, 0x43, 0x23, 0x23, 0x00, 0xb9, 0xcd, 0xbc, 0xbc, 0xba, 0x9a, 0x08, 0x21, 0x32,
+    0x22, 0x91, 0xfb, 0xcc, 0xcc, 0xbb, 0xbb, 0xab, 0x99, 0x10, 0x33, 0x35, 0x34, 0x23, 0x33, 0x43,
+    0x43, 0x44, 0x44, 0x43, 0x33, 0x34, 0x22, 0x01, 0xa9, 0xdc, 0xdb, 0xbb, 0xac, 0xab, 0x9a, 0x88,
+    0x18, 0x10, 0x11, 0x80, 0x98, 0xaa, 0x89, 0x62, 0x55, 0x54, 0x43, 0x43, 0x32, 0x22, 0x80, 0xb9,
+    0xcd, 0xbc, 0xbc, 0xac, 0xab, 0xaa, 0x99, 0x89, 0x98, 0x99, 0xa9, 0xab, 0x8a, 0x40, 0x56, 0x45,
+    0x44, 0x43, 0x43, 0x23, 0x23, 0x12, 0x80, 0xa8, 0xbb, 0xbd, 0xbb, 0xac, 0xba, 0xba, 0xcc, 0xdb,
+    0xdb, 0xcb, 0xcb, 0xbb, 0xf7, 0xea, 0x30, 0x00, 0xaa, 0x8a, 0x20, 0x63, 0x34, 0x35, 0x33, 0x33,
+    0x23, 0x12, 0x00, 0x89, 0x98, 0x00, 0x21, 0x43, 0x32, 0x80, 0xfb, 0xce, 0xbc, 0xbd, 0xbb, 0xac,
+    0x99, 0x18, 0x32, 0x54, 0x33, 0x34, 0x23, 0x12, 0x00, 0x89, 0x9a, 0x99, 0x00, 0x42, 0x34, 0x24,
+    0x02, 0xc9, 0xdd, 0xcc, 0xbc, 0xac, 0xbb, 0x9b, 0x99, 0x20, 0x42, 0x44, 0x42, 0x32, 0x22, 0x23,
+    0x21, 0x22, 0x42, 0x33, 0x35, 0x43, 0x23, 0x22, 0x90, 0xda, 0xdc, 0xbc, 0xbc, 0xcb, 0xbb, 0xab,
+    0xab, 0x9a, 0x89, 0x89, 0x08, 0x11, 0x32, 0x46, 0x44, 0x53, 0x34, 0x43, 0x33, 0x24, 0x12, 0x01,
+    0x98, 0xba, 0xcc, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xbb, 0xbc, 0xcb, 0xbb, 0xba, 0x89, 0x31, 0x46,
+    0x35, 0x35, 0x33, 0x24, 0x22, 0x12, 0x10, 0x80, 0x10, 0x21, 0x43, 0x43, 0x12, 0xb8, 0xcf, 0xcd,
+    0xbc, 0xbc, 0xbb, 0xab, 0x09, 0x31, 0x54, 0x33, 0xf3, 0xfc, 0x29, 0x00, 0x24, 0x02, 0xa0, 0xdb,
+    0xbc, 0xbc, 0x9a, 0x08, 0x53, 0x45, 0x43, 0x32, 0x13, 0x01, 0xa8, 0xbc, 0xbc, 0xac, 0x89, 0x20,
+    0x53, 0x43, 0x33, 0x02, 0xb8, 0xce, 0xcc, 0xbb, 0xcb, 0x99, 0x08, 0x31, 0x44, 0x43, 0x22, 0x12,
+    0x80, 0xa9, 0xab, 0x8b, 0x38, 0x55, 0x35, 0x34, 0x23, 0x02, 0xb9, 0xce, 0xcc, 0xcb, 0xab, 0xab,
+    0x99, 0x00, 0x32, 0x43, 0x24, 0x23, 0x21, 0x11, 0x21, 0x43, 0x45, 0x44, 0x43, 0x33, 0x24, 0x01,
+    0x90, 0xca, 0xcc, 0xbc, 0xcb, 0xab, 0xab, 0xab, 0x9a, 0xaa, 0xa9, 0x99, 0x99, 0x20, 0x45, 0x45,
+    0x44, 0x34, 0x43, 0x32, 0x22, 0x02, 0x90, 0xb9, 0xdb, 0xcb, 0xba, 0xab, 0xbb, 0xba, 0xbc, 0xcc,
+    0xbb, 0xbc, 0xab, 0x89, 0x32, 0x47, 0x35, 0x34, 0x24, 0x23, 0x13, 0x81, 0xa8, 0xca, 0xcb, 0xbb,
+    0xbb, 0xcb, 0xba, 0xcb, 0xbc, 0xbc, 0xbc, 0xac, 0x9a, 0x19, 0x41, 0x45, 0x33, 0xf4, 0x2f, 0x00,
+    0x34, 0x34, 0x34, 0x22, 0x22, 0x01, 0x88, 0xa8, 0xa9, 0xaa, 0xab, 0xcb, 0xcc, 0xcc, 0xdb, 0xcb,
+    0xcb, 0xba, 0x9a, 0x89, 0x20, 0x53, 0x53, 0x33, 0x43, 0x32, 0x22, 0x11, 0x11, 0x00, 0x10, 0x08,
+    0x88, 0xba, 0xbe, 0xcd, 0xbb, 0xac, 0xab, 0x89, 0x21, 0x44, 0x53, 0x33, 0x33, 0x12, 0x80, 0xa9,
+    0xcb, 0xac, 0xab, 0xbb, 0xbb, 0xcd, 0xcc, 0xdb, 0xbc, 0xcb, 0xba, 0x99, 0x18, 0x52, 0x54, 0x43,
+    0x33, 0x34, 0x23, 0x22, 0x12, 0x80, 0xa8, 0xca, 0xcc, 0xcc, 0xcb, 0xbc, 0xbc, 0xbb, 0xab, 0x8a,
+    0x28, 0x45, 0x44, 0x34, 0x34, 0x24, 0x23, 0x12, 0x11, 0x00, 0x90, 0x98, 0xa9, 0xdb, 0xeb, 0xdb,
+    0xcc, 0xcb, 0xbc, 0xcb, 0xba, 0xaa, 0x99, 0x10, 0x42, 0x44, 0x33, 0x44, 0x32, 0x43, 0x23, 0x34,
+    0x33, 0x34, 0x23, 0x22, 0x98, 0xdb, 0xdd, 0xcb, 0xcb, 0xbb, 0xba, 0x9a, 0x09, 0x10, 0x22, 0x22,
+    0xcd, 0xf1, 0x2a, 0x00, 0x22, 0x11, 0x10, 0x33, 0x47, 0x54, 0x53, 0x33, 0x33, 0x23, 0x01, 0xca,
+    0xdc, 0xcb, 0xac, 0xbb, 0xaa, 0x9a, 0x89, 0x88, 0x80, 0x08, 0x08, 0x20, 0x55, 0x54, 0x34, 0x35,
+    0x33, 0x24, 0x12, 0x81, 0xb9, 0xdb, 0xbc, 0xbb, 0xbb, 0xab, 0xaa, 0xaa, 0xbb, 0xcc, 0xbc, 0xbb,
+    0x9a, 0x18, 0x55, 0x44, 0x44, 0x42, 0x22, 0x12, 0x11, 0x80, 0x99, 0xaa, 0xaa, 0xaa, 0xbb, 0xcc,
+    0xcc, 0xbc, 0xbd, 0xcb, 0xab, 0xaa, 0x08, 0x41, 0x34, 0x35, 0x34, 0x23, 0x23, 0x11, 0x80, 0x88,
+    0xa9, 0xa9, 0xaa, 0xcb, 0xcb, 0xbc, 0xbc, 0xbb, 0x9b, 0x09, 0x42, 0x45, 0x34, 0x24, 0x33, 0x22,
+    0x12, 0x12, 0x32, 0x53, 0x42, 0x12, 0x98, 0xdd, 0xbe, 0xcd, 0xbc, 0xbb, 0xac, 0x9b, 0x8a, 0x00,
+    0x31, 0x53, 0x33, 0x34, 0x33, 0x25, 0x34, 0x43, 0x43, 0x33, 0x23, 0x22, 0x90, 0xca, 0xcc, 0xcb,
+    0xab, 0xab, 0x89, 0x00, 0x2a, 0x03, 0x26, 0x00, 0x12, 0x12, 0x80, 0xda, 0xcc, 0xbc, 0xbc, 0xaa,
+    0x99, 0x08, 0x11, 0x11, 0x90, 0xdb, 0xcd, 0xbc, 0xbc, 0xab, 0xaa, 0x08, 0x41, 0x54, 0x34, 0x35,
+    0x44, 0x33, 0x34, 0x34, 0x32, 0x22, 0x01, 0xa8, 0xdb, 0xcc, 0xcb, 0xbb, 0xac, 0xba, 0xaa, 0xa9,
+    0x9a, 0xaa, 0xa9, 0x99, 0x18, 0x53, 0x55, 0x53, 0x43, 0x33, 0x23, 0x13, 0x81, 0xa8, 0xdb, 0xcb,
+    0xcb, 0xbb, 0xbb, 0xbc, 0xdb, 0xca, 0xaa, 0x9b, 0x89, 0x42, 0x55, 0x53, 0x34, 0x43, 0x32, 0x12,
+    0x01, 0x98, 0xba, 0xbd, 0xcb, 0xba, 0xbb, 0xcb, 0xbb, 0xbc, 0xcc, 0xba, 0xaa, 0x88, 0x31, 0x46,
+    0x44, 0x43, 0x33, 0x33, 0x23, 0x13, 0x02, 0x11, 0x80, 0x90, 0xc9, 0xdc, 0xdc, 0xbc, 0xcc, 0xbb,
+    0xbb, 0xba, 0x89, 0x10, 0x43, 0x43, 0x24, 0x32, 0x21, 0x21, 0x11, 0x22, 0x33, 0x43, 0x22, 0xa8,
+    0xec, 0xcc, 0xbc, 0xba, 0x9a, 0x10, 0x44, 0x35, 0x47, 0xfd, 0x2c, 0x00, 0x34, 0x24, 0x33, 0x32,
+    0x32, 0x43, 0x43, 0x24, 0x33, 0x12, 0xb9, 0xde, 0xbd, 0xbd, 0xbc, 0xac, 0xba, 0xa9, 0x89, 0x08,
+    0x00, 0x11, 0x21, 0x43, 0x34, 0x45, 0x34, 0x53, 0x32, 0x33, 0x12, 0x81, 0xa8, 0xbb, 0xbd, 0xcb,
+    0xaa, 0xa9, 0xa9, 0xb9, 0xba, 0xbc, 0xab, 0x08, 0x54, 0x55, 0x53, 0x33, 0x24, 0x13, 0x01, 0xa8,
+    0xcb, 0xcc, 0xcb, 0xca, 0xba, 0xbb, 0xbc, 0xac, 0xbb, 0xbb, 0x99, 0x10, 0x63, 0x34, 0x44, 0x32,
+    0x23, 0x12, 0x02, 0x11, 0x11, 0x32, 0x35, 0x34, 0x32, 0x12, 0x98, 0xbb, 0xbd, 0x9a, 0x38, 0x65,
+    0x34, 0x35, 0x23, 0x23, 0x00, 0xa9, 0xcc, 0xcc, 0xbb, 0xbc, 0xbc, 0xcc, 0xcb, 0xcb, 0xbb, 0xac,
+    0x9a, 0x09, 0x20, 0x44, 0x53, 0x33, 0x33, 0x33, 0x23, 0x12, 0x01, 0x01, 0x80, 0x98, 0xca, 0xcc,
+    0xbd, 0xbc, 0xbb, 0x9a, 0x18, 0x54, 0x44, 0x34, 0x34, 0x33, 0x33, 0x24, 0x6c, 0x12, 0x2c, 0x00,
+    0x22, 0x23, 0x22, 0x12, 0x90, 0xcd, 0xce, 0xbc, 0xbd, 0xcc, 0xba, 0xba, 0x9a, 0x89, 0x08, 0x22,
+    0x34, 0x34, 0x34, 0x43, 0x33, 0x43, 0x23, 0x22, 0x12, 0x88, 0xca, 0xcc, 0xbc, 0xcb, 0xba, 0xaa,
+    0x89, 0x10, 0x32, 0x54, 0x43, 0x43, 0x43, 0x43, 0x23, 0x24, 0x12, 0x02, 0x98, 0xeb, 0xdb, 0xcc,
+    0xbb, 0xcc, 0xba, 0xab, 0xab, 0x9a, 0x09, 0x31, 0x45, 0x44, 0x53, 0x33, 0x43, 0x33, 0x23, 0x13,
+    0x01, 0x99, 0xcb, 0xcc, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xaa, 0x9a, 0x08, 0x21, 0x44, 0x44, 0x43,
+    0x43, 0x32, 0x33, 0x32, 0x11, 0x80, 0xa9, 0xcd, 0xdb, 0xbc, 0xbc, 0xac, 0xac, 0xaa, 0xaa, 0x89,
+    0x10, 0x42, 0x35, 0x35, 0x34, 0x34, 0x33, 0x33, 0x23, 0x12, 0x88, 0xba, 0xcd, 0xbc, 0xcc, 0xbb,
+    0xbc, 0xbb, 0xbb, 0xba, 0x9a, 0x18, 0x41, 0x63, 0x43, 0x34, 0x53, 0x32, 0x32, 0x23, 0x12, 0x01,
+    0x4a, 0x14, 0x2b, 0x00, 0x98, 0xcb, 0xcc, 0xcb, 0xbc, 0xbb, 0xac, 0xba, 0x99, 0x88, 0x11, 0x43,
+    0x34, 0x34, 0x24, 0x33, 0x33, 0x22, 0x01, 0x98, 0xcc, 0xcc, 0xcc, 0xbb, 0xcb, 0xab, 0xaa, 0x09,
+    0x20, 0x44, 0x53, 0x43, 0x43, 0x32, 0x33, 0x23, 0x22, 0x11, 0x98, 0xca, 0xcd, 0xcb, 0xbc, 0xcb,
+    0xab, 0xaa, 0x89, 0x18, 0x33, 0x36, 0x44, 0x33, 0x34, 0x32, 0x23, 0x01, 0x99, 0xbd, 0xbe, 0xbd,
+    0xcb, 0xcb, 0xaa, 0x9a, 0x89, 0x10, 0x32, 0x45, 0x43, 0x34, 0x34, 0x24, 0x33, 0x23, 0x12, 0x80,
+    0xc9, 0xbd, 0xbd, 0xbd, 0xbb, 0xbc, 0xba, 0xaa, 0x99, 0x08, 0x21, 0x44, 0x44, 0x34, 0x34, 0x34,
+    0x33, 0x23, 0x13, 0x80, 0xba, 0xce, 0xbc, 0xcc, 0xba, 0xbb, 0xba, 0x9a, 0x88, 0x31, 0x63, 0x44,
+    0x43, 0x34, 0x33, 0x34, 0x22, 0x12, 0x00, 0xa9, 0xdb, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xcb, 0xaa,
+    0x8a, 0x08, 0x31, 0x45, 0x37, 0xef, 0x30, 0x00, 0x34, 0x34, 0x34, 0x33, 0x33, 0x33, 0x22, 0x01,
+    0xa9, 0xdc, 0xbd, 0xcc, 0xcb, 0xbb, 0xac, 0xaa, 0x9a, 0x88, 0x20, 0x43, 0x44, 0x34, 0x34, 0x43,
+    0x23, 0x33, 0x22, 0x10, 0x99, 0xca, 0xcc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0x9a, 0x00, 0x52,
+    0x63, 0x43, 0x43, 0x33, 0x43, 0x22, 0x22, 0x01, 0x98, 0xda, 0xcc, 0xbd, 0xdb, 0xbb, 0xbb, 0xab,
+    0x8a, 0x08, 0x31, 0x44, 0x34, 0x44, 0x43, 0x34, 0x42, 0x22, 0x22, 0x00, 0xa8, 0xcb, 0xbc, 0xbc,
+    0xbb, 0xbc, 0xca, 0xba, 0xba, 0xab, 0x89, 0x21, 0x45, 0x34, 0x34, 0x33, 0x33, 0x32, 0x32, 0x33,
+    0x34, 0x33, 0x81, 0xfb, 0xcc, 0xcc, 0xbb, 0xab, 0x9b, 0x89, 0x08, 0x00, 0x10, 0x21, 0x63, 0x44,
+    0x53, 0x33, 0x24, 0x11, 0x80, 0xa9, 0xbb, 0xac, 0xaa, 0xa9, 0xa9, 0xcb, 0xcc, 0xcb, 0xbb, 0xaa,
+    0x9a, 0x98, 0xa9, 0xbb, 0xbc, 0x9b, 0x52, 0x56, 0xfb, 0xfa, 0x22, 0x00, 0x54, 0x43, 0x43, 0x33,
+    0x34, 0x32, 0x33, 0x22, 0x80, 0xca, 0xdd, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xcb, 0xbb, 0xac, 0x9a,
+    0x09, 0x32, 0x46, 0x43, 0x24, 0x33, 0x33, 0x43, 0x43, 0x42, 0x12, 0x01, 0xc9, 0xcc, 0xcc, 0xab,
+    0xbb, 0x99, 0x08, 0x10, 0x21, 0x31, 0x43, 0x55, 0x53, 0x34, 0x33, 0x23, 0x81, 0xca, 0xcc, 0xbc,
+    0xbb, 0xbb, 0xbb, 0xbc, 0xbc, 0xbc, 0x9b, 0x19, 0x63, 0x44, 0x34, 0x33, 0x23, 0x11, 0x00, 0x21,
+    0x32, 0x35, 0x33, 0x80, 0xcd, 0xbe, 0xbd, 0xba, 0x9b, 0x89, 0x00, 0x00, 0x80, 0x89, 0x19, 0x62,
+    0x45, 0x44, 0x33, 0x22, 0x80, 0xba, 0xcd, 0xba, 0x9b, 0x8a, 0x88, 0x88, 0xaa, 0xdb, 0x9a, 0x38,
+    0x65, 0x44, 0x33, 0x24, 0x11, 0x80, 0x98, 0x99, 0x08, 0x00, 0x80, 0xea, 0xcd, 0xbc, 0xbc, 0xaa,
+    0x8a, 0x08, 0x11, 0x00, 0x98, 0xaa, 0x09, 0x64, 0x45, 0x34, 0x33, 0x13, 0xf2, 0x04, 0x28, 0x00,
+    0x81, 0xa9, 0xbb, 0x9b, 0x0a, 0x88, 0xa8, 0xcd, 0xcc, 0xaa, 0x08, 0x73, 0x53, 0x33, 0x33, 0x01,
+    0x98, 0xb9, 0xa9, 0x88, 0x88, 0xc9, 0xdd, 0xbd, 0xad, 0xab, 0xaa, 0x89, 0x98, 0xba, 0xdc, 0xcb,
+    0xab, 0x09, 0x42, 0x45, 0x43, 0x33, 0x33, 0x33, 0x34, 0x36, 0x34, 0x43, 0x22, 0x80, 0xc9, 0xdb,
+    0xcb, 0xba, 0xaa, 0x9a, 0xbb, 0xbd, 0xcc, 0xab, 0x9a, 0x10, 0x44, 0x44, 0x32, 0x22, 0x01, 0x00,
+    0x11, 0x44, 0x53, 0x23, 0x91, 0xea, 0xbd, 0xbd, 0xab, 0xaa, 0x08, 0x20, 0x11, 0x10, 0x08, 0x41,
+    0x55, 0x45, 0x34, 0x33, 0x13, 0x90, 0xba, 0xbd, 0xbb, 0x9b, 0x9a, 0xba, 0xdd, 0xbc, 0xbd, 0xaa,
+    0x08, 0x31, 0x36, 0x43, 0x22, 0x02, 0x00, 0x18, 0x21, 0x53, 0x23, 0x01, 0xea, 0xcc, 0xbc, 0xbb,
+    0x99, 0x10, 0x42, 0x32, 0x22, 0x00, 0x00, 0x42, 0x45, 0x45, 0x23, 0x23, 0x91, 0xca, 0xcd, 0xbc,
+    0x6c, 0x01, 0x34, 0x00, 0xbb, 0xaa, 0x9a, 0x89, 0x99, 0xaa, 0xaa, 0x89, 0x62, 0x55, 0x44, 0x33,
+    0x33, 0x12, 0x98, 0xaa, 0xbb, 0x89, 0x21, 0x34, 0x01, 0xea, 0xcd, 0xac, 0xaa, 0x28, 0x53, 0x34,
+    0x33, 0x81, 0xc9, 0xdb, 0xba, 0x8a, 0x18, 0x10, 0xa8, 0xdd, 0xcc, 0xbb, 0x9b, 0x10, 0x44, 0x34,
+    0x43, 0x21, 0x10, 0x00, 0x31, 0x35, 0x35, 0x23, 0x01, 0xca, 0xbd, 0xcc, 0xaa, 0x89, 0x88, 0x80,
+    0x90, 0x99, 0xaa, 0x18, 0x54, 0x45, 0x33, 0x22, 0x90, 0xca, 0xcc, 0xba, 0x99, 0x88, 0x98, 0xca,
+    0xcd, 0xcb, 0x9a, 0x18, 0x63, 0x34, 0x34, 0x22, 0x11, 0x10, 0x31, 0x54, 0x43, 0x33, 0x01, 0xc9,
+    0xcd, 0xcb, 0xab, 0x99, 0x08, 0x88, 0xba, 0xcd, 0xcc, 0xaa, 0x88, 0x32, 0x54, 0x23, 0x13, 0x81,
+    0x98, 0x09, 0x31, 0x37, 0x35, 0x22, 0x81, 0xb9, 0xbd, 0xab, 0x89, 0x21, 0x33, 0x02, 0xfb, 0xbd,
+    0xbd, 0xab, 0x89, 0x31, 0xe1, 0xf4, 0x2d, 0x00, 0x34, 0x24, 0x12, 0x80, 0xaa, 0x99, 0x30, 0x46,
+    0x34, 0x22, 0x80, 0xeb, 0xcc, 0xba, 0x9a, 0x08, 0x32, 0x23, 0x12, 0xb9, 0xbd, 0x9b, 0x51, 0x46,
+    0x44, 0x32, 0x11, 0xa8, 0xbb, 0xbc, 0x9a, 0x10, 0x22, 0x80, 0xdd, 0xcd, 0xbb, 0xab, 0x09, 0x43,
+    0x34, 0x33, 0x01, 0x90, 0x08, 0x52, 0x36, 0x35, 0x22, 0x91, 0xca, 0xbd, 0xbb, 0x9a, 0x08, 0x01,
+    0x90, 0xdb, 0xbd, 0xab, 0x08, 0x53, 0x35, 0x33, 0x03, 0x90, 0xaa, 0x89, 0x52, 0x45, 0x33, 0x02,
+    0xb8, 0xcd, 0xab, 0x9b, 0x08, 0x11, 0x91, 0xeb, 0xcd, 0xbb, 0x9b, 0x10, 0x44, 0x43, 0x22, 0x11,
+    0x08, 0x18, 0x43, 0x36, 0x24, 0x12, 0xa8, 0xcc, 0xbc, 0xac, 0x89, 0x08, 0x00, 0x98, 0xbb, 0xbc,
+    0x8a, 0x52, 0x45, 0x34, 0x23, 0x01, 0x90, 0xa9, 0x88, 0x31, 0x33, 0x81, 0xfc, 0xcd, 0xcb, 0xab,
+    0x8a, 0x08, 0x21, 0x21, 0x00, 0x00, 0x30, 0x56, 0x2e, 0xfc, 0x2b, 0x00, 0x44, 0x34, 0x23, 0x12,
+    0x98, 0xca, 0xac, 0xaa, 0x99, 0x08, 0xa8, 0xea, 0xdb, 0xbb, 0x8b, 0x20, 0x55, 0x43, 0x23, 0x81,
+    0xaa, 0xbc, 0xab, 0x18, 0x53, 0x33, 0x91, 0xdc, 0xcc, 0xab, 0x18, 0x62, 0x53, 0x22, 0x80, 0xc9,
+    0xbb, 0x9b, 0x28, 0x45, 0x33, 0x12, 0xb8, 0xbd, 0xac, 0x18, 0x63, 0x43, 0x12, 0xa8, 0xbd, 0xbd,
+    0x9b, 0x89, 0x11, 0x22, 0x90, 0xcc, 0xcb, 0x8a, 0x32, 0x47, 0x24, 0x23, 0x02, 0x80, 0x08, 0x18,
+    0x32, 0x23, 0x91, 0xfc, 0xcc, 0xcb, 0xaa, 0x9a, 0x99, 0x98, 0x9a, 0xba, 0x89, 0x41, 0x55, 0x43,
+    0x33, 0x33, 0x32, 0x32, 0x43, 0x33, 0x12, 0xb8, 0xde, 0xbc, 0xbb, 0xaa, 0x88, 0x00, 0x90, 0xc9,
+    0xba, 0x0a, 0x62, 0x54, 0x23, 0x12, 0xa9, 0xbd, 0xad, 0x9a, 0x18, 0x31, 0x23, 0x82, 0xb9, 0xac,
+    0x09, 0x64, 0x35, 0x34, 0x12, 0x98, 0xcb, 0xbc, 0xaa, 0x89, 0x21, 0x23, 0x63, 0x00, 0x22, 0x00,
+    0x13, 0x98, 0xcb, 0x89, 0x73, 0x45, 0x34, 0x22, 0x91, 0xea, 0xcc, 0xbb, 0x9c, 0x99, 0x80, 0x00,
+    0x98, 0xca, 0xaa, 0x28, 0x65, 0x44, 0x43, 0x22, 0x01, 0x98, 0x99, 0x08, 0x31, 0x33, 0x92, 0xed,
+    0xcd, 0xcb, 0x9a, 0x89, 0x21, 0x32, 0x12, 0x81, 0x99, 0x28, 0x73, 0x44, 0x33, 0x02, 0xb8, 0xcd,
+    0xac, 0x9b, 0x8a, 0x80, 0x90, 0xa8, 0xbb, 0x89, 0x63, 0x46, 0x34, 0x43, 0x22, 0x11, 0x01, 0x00,
+    0x90, 0xba, 0xbf, 0xcd, 0xbb, 0xbb, 0x9a, 0x08, 0x01, 0x11, 0x00, 0x11, 0x54, 0x44, 0x34, 0x23,
+    0x80, 0xb9, 0xad, 0x9b, 0x10, 0x33, 0x14, 0xa0, 0xce, 0xbb, 0x9a, 0x51, 0x44, 0x24, 0x12, 0x88,
+    0xaa, 0x9a, 0x08, 0x32, 0x13, 0xd9, 0xbf, 0xbd, 0xaa, 0x88, 0x21, 0x13, 0x81, 0xc9, 0xbc, 0x9a,
+    0x20, 0x35, 0x25, 0x21, 0x00, 0x21, 0x63, 0x34, 0x24, 0x02, 0xa8, 0xbb, 0xab, 0x28, 0x44, 0x22,
+    0x85, 0x06, 0x21, 0x00, 0xb0, 0xcf, 0xcc, 0xaa, 0x9a, 0x80, 0x90, 0xb9, 0xcd, 0xab, 0x19, 0x54,
+    0x45, 0x33, 0x23, 0x02, 0xa8, 0xba, 0xaa, 0x09, 0x10, 0xa8, 0xed, 0xbd, 0xbd, 0xab, 0x09, 0x31,
+    0x45, 0x33, 0x23, 0x11, 0x10, 0x52, 0x44, 0x34, 0x12, 0xa8, 0xce, 0xbc, 0xac, 0x9a, 0x08, 0x10,
+    0x01, 0x98, 0xaa, 0x08, 0x73, 0x44, 0x24, 0x22, 0x90, 0xa9, 0xab, 0x88, 0x31, 0x13, 0xa0, 0xde,
+    0xbc, 0xaa, 0x19, 0x42, 0x43, 0x12, 0x00, 0x08, 0x30, 0x44, 0x33, 0x91, 0xed, 0xbc, 0xac, 0x99,
+    0x00, 0x21, 0x01, 0x99, 0xab, 0x28, 0x56, 0x35, 0x24, 0x02, 0x98, 0xba, 0x9a, 0x18, 0x32, 0x91,
+    0xed, 0xcd, 0xbb, 0xaa, 0x10, 0x43, 0x34, 0x33, 0x22, 0x32, 0x34, 0x26, 0x23, 0x01, 0xdb, 0xdc,
+    0xbb, 0xbb, 0xab, 0xa9, 0xba, 0xbb, 0xab, 0x38, 0x56, 0x35, 0x34, 0x23, 0x12, 0x22, 0x22, 0x34,
+    0x14, 0x91, 0xeb, 0xdc, 0x46, 0x06, 0x34, 0x00, 0xab, 0xab, 0x89, 0x11, 0x11, 0x90, 0xbb, 0xad,
+    0x09, 0x62, 0x34, 0x23, 0x81, 0xcb, 0xad, 0x8b, 0x30, 0x46, 0x33, 0x12, 0xa8, 0xcb, 0xab, 0x19,
+    0x53, 0x34, 0x13, 0xb9, 0xdd, 0xbb, 0x9b, 0x09, 0x11, 0x82, 0xc9, 0xdc, 0xba, 0x08, 0x63, 0x44,
+    0x43, 0x12, 0x01, 0x80, 0x88, 0x80, 0x00, 0xa8, 0xcd, 0xbd, 0xad, 0xbb, 0xaa, 0xa9, 0x88, 0x08,
+    0x42, 0x54, 0x44, 0x24, 0x33, 0x23, 0x22, 0x10, 0x80, 0xa8, 0xcd, 0xdc, 0xcb, 0xbb, 0xab, 0x9a,
+    0x88, 0x00, 0x00, 0x11, 0x52, 0x44, 0x44, 0x33, 0x23, 0x23, 0x12, 0x12, 0x12, 0x90, 0xeb, 0xcd,
+    0xcb, 0xac, 0xaa, 0xa9, 0x9a, 0xaa, 0x9a, 0x18, 0x54, 0x54, 0x33, 0x32, 0x11, 0x01, 0x10, 0x22,
+    0x33, 0x92, 0xfc, 0xdc, 0xbb, 0xab, 0x9a, 0x00, 0x12, 0x11, 0x21, 0x42, 0x55, 0x53, 0x32, 0x12,
+    0x90, 0xca, 0xbb, 0xba, 0xa9, 0xba, 0xcc, 0xcc, 0xb2, 0xfb, 0x29, 0x00, 0xaa, 0x89, 0x21, 0x43,
+    0x02, 0xa0, 0x9a, 0x48, 0x47, 0x45, 0x33, 0x12, 0x90, 0xba, 0xcb, 0x99, 0x80, 0xa0, 0xfb, 0xbe,
+    0xbc, 0xaa, 0x08, 0x43, 0x44, 0x22, 0x02, 0x80, 0x08, 0x32, 0x36, 0x34, 0x02, 0xca, 0xbe, 0xad,
+    0x9b, 0x89, 0x00, 0x01, 0x98, 0xa9, 0x09, 0x72, 0x54, 0x43, 0x22, 0x01, 0x98, 0x9a, 0x89, 0x00,
+    0x01, 0xb8, 0xce, 0xcc, 0xba, 0x9a, 0x99, 0x99, 0xab, 0xac, 0x09, 0x52, 0x45, 0x34, 0x43, 0x32,
+    0x33, 0x33, 0x33, 0x01, 0xc9, 0xcd, 0xbc, 0xbb, 0xbb, 0xbc, 0xdb, 0xab, 0xab, 0x08, 0x31, 0x35,
+    0x33, 0x22, 0x33, 0x45, 0x35, 0x24, 0x22, 0x90, 0x99, 0x8a, 0x20, 0x43, 0x13, 0xc8, 0xcd, 0xbc,
+    0xbb, 0xba, 0xcb, 0xcd, 0xdb, 0xba, 0x8a, 0x08, 0x32, 0x44, 0x43, 0x43, 0x53, 0x33, 0x24, 0x12,
+    0x81, 0x88, 0x08, 0x08, 0x90, 0xdb, 0xbe, 0xbd, 0xbb, 0xab, 0x99, 0x99, 0xc0, 0xf9, 0x26, 0x00,
+    0xdb, 0xcb, 0xaa, 0x08, 0x44, 0x34, 0x25, 0x22, 0x22, 0x32, 0x33, 0x34, 0x33, 0x11, 0xa8, 0xdc,
+    0xdb, 0xbc, 0xcb, 0xbb, 0xba, 0x9a, 0xaa, 0xaa, 0xaa, 0x28, 0x65, 0x34, 0x34, 0x22, 0x80, 0x89,
+    0x18, 0x42, 0x34, 0x02, 0xda, 0xcc, 0x9b, 0x09, 0x32, 0x23, 0xa8, 0xbd, 0x8a, 0x65, 0x45, 0x43,
+    0x12, 0x01, 0x98, 0x80, 0x11, 0x81, 0xfb, 0xcd, 0xcc, 0xaa, 0x99, 0x80, 0x00, 0x98, 0x9a, 0x89,
+    0x63, 0x44, 0x24, 0x12, 0x88, 0x99, 0x89, 0x21, 0x33, 0x02, 0xea, 0xbc, 0xab, 0x19, 0x41, 0x12,
+    0xa8, 0xcd, 0xbc, 0xaa, 0x98, 0x88, 0x99, 0x89, 0x51, 0x56, 0x34, 0x44, 0x22, 0x23, 0x33, 0x43,
+    0x23, 0x81, 0xdb, 0xbd, 0xbc, 0xbb, 0xba, 0xaa, 0xbc, 0xbc, 0xaa, 0x18, 0x43, 0x25, 0x13, 0x81,
+    0xa8, 0x99, 0x89, 0xa8, 0xcc, 0xbe, 0xbb, 0x8a, 0x41, 0x53, 0x43, 0x22, 0x33, 0x44, 0x43, 0x13,
+    0xea, 0x06, 0x29, 0x00, 0x91, 0xeb, 0xbc, 0xab, 0x9a, 0x88, 0xa8, 0xaa, 0x9b, 0x60, 0x46, 0x44,
+    0x22, 0x02, 0x90, 0x98, 0x08, 0x01, 0x81, 0xda, 0xbd, 0xbb, 0x18, 0x55, 0x43, 0x23, 0x81, 0x98,
+    0x9a, 0x99, 0xb9, 0xde, 0xdd, 0xcb, 0xba, 0x9a, 0x09, 0x10, 0x12, 0x21, 0x43, 0x54, 0x53, 0x32,
+    0x12, 0x81, 0xa9, 0xba, 0xaa, 0xa9, 0xba, 0xcc, 0xab, 0x09, 0x52, 0x45, 0x32, 0x22, 0x81, 0x80,
+    0x98, 0xa8, 0xeb, 0xcc, 0xbb, 0xaa, 0x10, 0x44, 0x53, 0x32, 0x43, 0x43, 0x43, 0x23, 0x82, 0xca,
+    0xcd, 0xbb, 0xab, 0xaa, 0xa9, 0xca, 0xab, 0x8b, 0x51, 0x45, 0x33, 0x12, 0x98, 0xcc, 0xcb, 0xbb,
+    0xbb, 0xbd, 0xbc, 0xac, 0x89, 0x21, 0x45, 0x34, 0x34, 0x33, 0x44, 0x32, 0x12, 0x81, 0xb9, 0xbd,
+    0xbc, 0xbb, 0xbb, 0xcb, 0xcb, 0x9a, 0x18, 0x44, 0x35, 0x24, 0x12, 0x00, 0x00, 0x10, 0x11, 0x01,
+    0xca, 0xdc, 0xaa, 0x09, 0x88, 0x02, 0x28, 0x00, 0x53, 0x34, 0x23, 0x81, 0xb9, 0xcb, 0xba, 0xbc,
+    0xce, 0xcd, 0xcb, 0xab, 0xaa, 0x08, 0x20, 0x43, 0x43, 0x43, 0x53, 0x33, 0x33, 0x13, 0x81, 0xba,
+    0xbd, 0xbc, 0xac, 0xbb, 0xaa, 0x88, 0x41, 0x44, 0x34, 0x34, 0x32, 0x32, 0x22, 0x11, 0xa0, 0xeb,
+    0xbd, 0xbc, 0xbb, 0x9a, 0x09, 0x08, 0x80, 0x01, 0x33, 0x36, 0x25, 0x02, 0xa8, 0xbd, 0xbc, 0xaa,
+    0x88, 0x11, 0x11, 0x11, 0x52, 0x55, 0x44, 0x32, 0x12, 0xb9, 0xdd, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb,
+    0xac, 0x89, 0x21, 0x46, 0x44, 0x34, 0x43, 0x33, 0x23, 0x22, 0x00, 0x98, 0xca, 0xcb, 0xcc, 0xcb,
+    0xbb, 0xbc, 0xaa, 0x89, 0x00, 0x22, 0x23, 0x22, 0x21, 0x42, 0x44, 0x43, 0x22, 0x00, 0x98, 0x08,
+    0x43, 0x45, 0x33, 0x12, 0xa8, 0xdb, 0xbb, 0xcb, 0xcc, 0xcc, 0xdb, 0xbb, 0xaa, 0x09, 0x31, 0x53,
+    0x33, 0x34, 0x44, 0x43, 0x23, 0x12, 0x98, 0xda, 0xf8, 0x06, 0x2c, 0x00, 0xcb, 0xac, 0xab, 0xbb,
+    0xbb, 0xaa, 0x30, 0x47, 0x44, 0x33, 0x32, 0x11, 0x11, 0x10, 0x00, 0xb8, 0xde, 0xcc, 0xbc, 0xaa,
+    0x99, 0x00, 0x01, 0x11, 0x08, 0x10, 0x52, 0x34, 0x35, 0x32, 0x11, 0x08, 0x88, 0x11, 0x53, 0x34,
+    0x44, 0x22, 0x22, 0x91, 0xca, 0xce, 0xbc, 0xbd, 0xcb, 0xca, 0xba, 0xab, 0xaa, 0x18, 0x63, 0x44,
+    0x43, 0x43, 0x22, 0x23, 0x21, 0x01, 0x90, 0xc9, 0xbc, 0xad, 0xab, 0xaa, 0x9a, 0x99, 0xa9, 0x88,
+    0x30, 0x45, 0x33, 0x01, 0xcb, 0xbe, 0xac, 0x89, 0x20, 0x43, 0x23, 0x32, 0x63, 0x44, 0x44, 0x24,
+    0x22, 0x81, 0xa9, 0xcc, 0xcb, 0xbb, 0xac, 0xbb, 0xba, 0x8a, 0x10, 0x34, 0x36, 0x33, 0x24, 0x22,
+    0x00, 0xa8, 0xcc, 0xcd, 0xbb, 0xbb, 0x9a, 0x18, 0x42, 0x34, 0x35, 0x34, 0x44, 0x23, 0x23, 0x02,
+    0x99, 0xcb, 0xbc, 0xbc, 0xcb, 0xcb, 0xac, 0xaa, 0x89, 0x21, 0x43, 0x23, 0xc2, 0xf9, 0x2b, 0x00,
+    0x12, 0x80, 0x88, 0x10, 0x42, 0x22, 0x81, 0x9a, 0x39, 0x77, 0x36, 0x35, 0x33, 0x23, 0x00, 0xb9,
+    0xdc, 0xbc, 0xbd, 0xbc, 0xbb, 0xbb, 0xab, 0x89, 0x21, 0x63, 0x44, 0x53, 0x33, 0x23, 0x13, 0x81,
+    0x98, 0xba, 0xbb, 0xcb, 0xcb, 0xcb, 0xcb, 0x9a, 0x18, 0x42, 0x34, 0x24, 0x12, 0x90, 0xba, 0xbc,
+    0xcc, 0xba, 0xbb, 0xaa, 0x08, 0x53, 0x45, 0x53, 0x33, 0x34, 0x32, 0x11, 0x98, 0xcc, 0xdc, 0xbb,
+    0xcb, 0xaa, 0x89, 0x10, 0x31, 0x53, 0x43, 0x23, 0x33, 0x22, 0x80, 0xca, 0xdc, 0xdb, 0xbb, 0xbb,
+    0xab, 0x18, 0x52, 0x35, 0x35, 0x33, 0x23, 0x33, 0x22, 0x12, 0x90, 0xeb, 0xcd, 0xdb, 0xba, 0xaa,
+    0x99, 0x10, 0x32, 0x53, 0x33, 0x33, 0x33, 0x02, 0xa0, 0xcd, 0xdc, 0xca, 0xaa, 0x9a, 0x09, 0x21,
+    0x44, 0x44, 0x33, 0x24, 0x22, 0x80, 0xba, 0xdd, 0xcb, 0xbb, 0xac, 0x9b, 0x8a, 0x10, 0x32, 0x54,
+    0x1c, 0xf5, 0x2f, 0x00, 0x43, 0x43, 0x24, 0x33, 0x23, 0x01, 0xb9, 0xcc, 0xbb, 0xab, 0x99, 0x80,
+    0x01, 0x00, 0x01, 0x32, 0x45, 0x43, 0x02, 0xea, 0xcd, 0xbd, 0xac, 0xab, 0x9a, 0x10, 0x32, 0x45,
+    0x34, 0x33, 0x33, 0x33, 0x12, 0x01, 0xa9, 0xec, 0xcc, 0xcb, 0xbb, 0x9a, 0x18, 0x43, 0x43, 0x23,
+    0x02, 0x80, 0x98, 0xaa, 0xdb, 0xdb, 0xbc, 0xbb, 0x9b, 0x28, 0x54, 0x45, 0x43, 0x34, 0x33, 0x23,
+    0x12, 0x98, 0xda, 0xbc, 0xbc, 0xac, 0xbb, 0xbb, 0xab, 0xab, 0x89, 0x31, 0x45, 0x33, 0x13, 0x90,
+    0xda, 0xcb, 0xab, 0x9a, 0x20, 0x54, 0x45, 0x34, 0x34, 0x33, 0x33, 0x22, 0x01, 0x98, 0xfb, 0xcc,
+    0xbc, 0xbc, 0xaa, 0x99, 0x10, 0x22, 0x34, 0x43, 0x32, 0x12, 0x12, 0x00, 0x99, 0xeb, 0xdb, 0xba,
+    0x9b, 0x18, 0x42, 0x35, 0x53, 0x33, 0x33, 0x12, 0xc9, 0xce, 0xbd, 0xbc, 0xba, 0xab, 0xaa, 0xaa,
+    0x89, 0x41, 0x54, 0x34, 0x5b, 0xf2, 0x32, 0x00, 0x34, 0x33, 0x33, 0x23, 0x00, 0xa9, 0xab, 0x8b,
+    0x31, 0x46, 0x34, 0x33, 0x33, 0x23, 0x23, 0x01, 0xb9, 0xdf, 0xcc, 0xbd, 0xbd, 0xbb, 0x9a, 0x18,
+    0x42, 0x33, 0x24, 0x11, 0x12, 0x23, 0x12, 0xa8, 0xdd, 0xbc, 0xbc, 0xac, 0xab, 0x89, 0x10, 0x44,
+    0x34, 0x24, 0x12, 0x00, 0x99, 0xb9, 0xcb, 0xcc, 0xbb, 0xac, 0xaa, 0x09, 0x31, 0x47, 0x44, 0x43,
+    0x33, 0x23, 0x12, 0x10, 0x08, 0x99, 0xba, 0xcc, 0xaa, 0x09, 0x20, 0x21, 0x90, 0xca, 0xbb, 0xeb,
+    0xcc, 0xce, 0xbc, 0xbd, 0xba, 0x9a, 0x08, 0x21, 0x44, 0x53, 0x33, 0x33, 0x23, 0x23, 0x11, 0x98,
+    0xeb, 0xcc, 0xbc, 0xbb, 0xab, 0xaa, 0x08, 0x21, 0x45, 0x33, 0x33, 0x11, 0x80, 0x10, 0x32, 0x45,
+    0x22, 0x02, 0x21, 0x63, 0x54, 0x43, 0x33, 0x23, 0x80, 0xd9, 0xcc, 0xcc, 0xcb, 0xab, 0x9b, 0x8a,
+    0x00, 0x32, 0x44, 0x43, 0x43, 0x23, 0x23, 0x12, 0x04, 0x0f, 0x2b, 0x00, 0xa0, 0xdc, 0xcd, 0xcb,
+    0xbb, 0x9a, 0x08, 0x11, 0x22, 0x22, 0x33, 0x34, 0x24, 0x23, 0x12, 0x01, 0x88, 0xba, 0xbb, 0x39,
+    0x77, 0x35, 0x34, 0x14, 0x02, 0xa8, 0xdb, 0xbc, 0xbc, 0xbc, 0xab, 0xaa, 0x9a, 0x18, 0x42, 0x46,
+    0x34, 0x25, 0x23, 0x02, 0x81, 0xa9, 0xbb, 0xcd, 0xcb, 0xcb, 0xaa, 0x89, 0x08, 0x20, 0x42, 0x42,
+    0x23, 0x23, 0x12, 0x88, 0xaa, 0xcb, 0xcb, 0xab, 0x0a, 0x72, 0x54, 0x43, 0x32, 0x01, 0x90, 0xca,
+    0xdb, 0xcc, 0xbb, 0xcb, 0x9a, 0x89, 0x00, 0x43, 0x45, 0x44, 0x43, 0x23, 0x11, 0x90, 0xb9, 0xdb,
+    0xbb, 0xad, 0xbb, 0xab, 0xaa, 0x89, 0x00, 0x33, 0x37, 0x34, 0x23, 0x02, 0x99, 0xbb, 0xac, 0x99,
+    0x18, 0x41, 0x44, 0x44, 0x22, 0x12, 0x90, 0xa8, 0xba, 0xeb, 0xdc, 0xcb, 0xac, 0xaa, 0x09, 0x30,
+    0x45, 0x34, 0x25, 0x33, 0x11, 0x80, 0xb9, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xad, 0xf8, 0x30, 0x00,
+    0xcb, 0xa9, 0x08, 0x30, 0x44, 0x34, 0x33, 0x12, 0x98, 0xcb, 0xaa, 0x18, 0x44, 0x43, 0x23, 0x12,
+    0x01, 0x88, 0x99, 0xcb, 0xdb, 0xcc, 0xcc, 0xcc, 0xcb, 0x9a, 0x08, 0x32, 0x54, 0x33, 0x43, 0x32,
+    0x11, 0x81, 0xa9, 0xba, 0xab, 0xcb, 0xcb, 0xac, 0x9b, 0x09, 0x22, 0x43, 0x53, 0x32, 0x23, 0xa0,
+    0xdd, 0xcc, 0x9b, 0x89, 0x32, 0x44, 0x34, 0x33, 0x22, 0x90, 0xcb, 0xbd, 0xbb, 0xcb, 0xbc, 0xcd,
+    0xbb, 0xaa, 0x10, 0x54, 0x34, 0x25, 0x33, 0x22, 0x00, 0xaa, 0xcb, 0xaa, 0xaa, 0xaa, 0xbc, 0xbb,
+    0x0a, 0x52, 0x44, 0x43, 0x32, 0x12, 0xa0, 0xdd, 0xbd, 0xcb, 0x8a, 0x08, 0x21, 0x43, 0x43, 0x53,
+    0x33, 0x23, 0x22, 0x10, 0x88, 0xdb, 0xce, 0xcb, 0xbb, 0x8a, 0x10, 0x43, 0x33, 0x34, 0x23, 0x12,
+    0xa9, 0xcd, 0xbc, 0xab, 0xac, 0xcc, 0xbb, 0xaa, 0x10, 0x45, 0x44, 0x33, 0x43, 0x12, 0x01, 0xb9,
+    0x54, 0x0a, 0x2e, 0x00, 0xbc, 0xac, 0x99, 0x99, 0xa9, 0xba, 0x9b, 0x51, 0x45, 0x43, 0x33, 0x14,
+    0x01, 0xa9, 0xcd, 0xbc, 0xaa, 0x08, 0x22, 0x33, 0x34, 0x43, 0x32, 0x23, 0x12, 0x88, 0xbb, 0xdd,
+    0xdd, 0xdb, 0xab, 0x9b, 0x09, 0x31, 0x44, 0x43, 0x32, 0x23, 0x81, 0x99, 0x9a, 0xab, 0xbc, 0xdb,
+    0xcb, 0xbc, 0xaa, 0x89, 0x18, 0x53, 0x45, 0x23, 0x13, 0x00, 0xb9, 0xcb, 0x0a, 0x41, 0x32, 0x44,
+    0x33, 0x13, 0x80, 0x20, 0x33, 0x63, 0x44, 0x03, 0xd9, 0xbd, 0xbc, 0xbb, 0x9b, 0x19, 0x21, 0x32,
+    0x54, 0x12, 0x90, 0x89, 0x32, 0x12, 0xa8, 0xed, 0xce, 0xcc, 0xaa, 0xaa, 0xaa, 0x18, 0x34, 0x34,
+    0x33, 0x33, 0x23, 0x34, 0x45, 0x12, 0x90, 0x98, 0xaa, 0xcc, 0xbb, 0x9a, 0x20, 0x54, 0x34, 0x01,
+    0xa9, 0xaa, 0x88, 0x9a, 0x09, 0x53, 0x44, 0x34, 0x33, 0x12, 0x53, 0x37, 0x34, 0x01, 0xc9, 0xcc,
+    0xbc, 0xbc, 0xac, 0xbb, 0x60, 0xf0, 0x32, 0x00, 0x9a, 0x08, 0x01, 0x08, 0x10, 0x53, 0x35, 0x35,
+    0x22, 0x12, 0x11, 0x90, 0xda, 0xcb, 0xaa, 0x00, 0x12, 0x82, 0xca, 0xbc, 0x9a, 0x80, 0x00, 0x52,
+    0x46, 0x34, 0x43, 0x21, 0x11, 0x43, 0x45, 0x23, 0x12, 0x01, 0x90, 0xdb, 0xbd, 0xcd, 0xab, 0xab,
+    0xaa, 0xba, 0xbc, 0x9a, 0x88, 0x11, 0x44, 0x53, 0x43, 0x24, 0x13, 0x90, 0xaa, 0xba, 0xca, 0xbb,
+    0xab, 0xab, 0xac, 0x99, 0xa8, 0xaa, 0x60, 0x37, 0x34, 0x32, 0x32, 0x22, 0x32, 0x54, 0x43, 0x43,
+    0x34, 0x24, 0x02, 0xa9, 0xbb, 0xbd, 0xad, 0xbb, 0xcb, 0xba, 0x9b, 0x89, 0x88, 0x40, 0x55, 0x43,
+    0x23, 0x22, 0x01, 0xba, 0xdb, 0xcb, 0xcc, 0xab, 0xab, 0xbb, 0xbd, 0xab, 0x9b, 0x89, 0x42, 0x44,
+    0x34, 0x43, 0x43, 0x23, 0x33, 0x35, 0x43, 0x22, 0x12, 0x80, 0xba, 0xbd, 0xbc, 0xbb, 0xab, 0x88,
+    0x99, 0xdb, 0xac, 0x8a, 0x18, 0x42, 0x35, 0x35, 0x2d, 0x06, 0x29, 0x00, 0x25, 0x24, 0x01, 0x80,
+    0x88, 0x80, 0xb9, 0xdf, 0xcc, 0xcb, 0xac, 0xbb, 0xac, 0x9a, 0x09, 0x22, 0x33, 0x43, 0x43, 0x34,
+    0x24, 0x23, 0x11, 0x11, 0x11, 0x80, 0xca, 0xbc, 0x9a, 0x20, 0x32, 0x01, 0xca, 0xcc, 0xcb, 0xbc,
+    0xbd, 0xaa, 0x31, 0x46, 0x34, 0x32, 0x43, 0x43, 0x43, 0x12, 0x81, 0xa9, 0xbc, 0xdc, 0xdb, 0xac,
+    0x9b, 0x8a, 0x80, 0x01, 0x00, 0x10, 0x22, 0x23, 0x01, 0x00, 0x42, 0x34, 0x02, 0xca, 0xac, 0x19,
+    0x63, 0x33, 0x12, 0x98, 0x98, 0x98, 0xdb, 0xbb, 0x40, 0x67, 0x43, 0x22, 0x01, 0x10, 0x42, 0x24,
+    0x33, 0x32, 0x34, 0x34, 0x82, 0xba, 0xbd, 0x89, 0x11, 0x91, 0xcb, 0xad, 0x89, 0x88, 0x20, 0x64,
+    0x55, 0x34, 0x22, 0x80, 0xa9, 0xcb, 0xbb, 0xbd, 0xaa, 0x8a, 0x89, 0x99, 0xab, 0x8a, 0x52, 0x54,
+    0x43, 0x32, 0x22, 0x98, 0xcd, 0xbc, 0xab, 0x8a, 0x89, 0x89, 0xaa, 0xcb, 0xb7, 0x04, 0x21, 0x00,
+    0xcc, 0xcc, 0xaa, 0x08, 0x12, 0x82, 0xb9, 0xcd, 0xbb, 0xac, 0x9a, 0x28, 0x54, 0x34, 0x23, 0x01,
+    0xb9, 0xcc, 0xbd, 0xcc, 0xcb, 0xcb, 0xcb, 0xba, 0x9a, 0x09, 0x21, 0x45, 0x53, 0x33, 0x23, 0x81,
+    0x98, 0x99, 0x99, 0xa9, 0xaa, 0x89, 0x21, 0x82, 0xfa, 0xcc, 0xaa, 0x9a, 0xeb, 0xcc, 0xac, 0x9b,
+    0x08, 0x31, 0x54, 0x53, 0x33, 0x33, 0x12, 0x88, 0x89, 0x20, 0x44, 0x34, 0x33, 0x22, 0x22, 0x12,
+    0xa9, 0xbe, 0xad, 0xab, 0xcc, 0xdb, 0xab, 0x29, 0x55, 0x35, 0x24, 0x33, 0x33, 0x13, 0x80, 0xba,
+    0x9a, 0x31, 0x36, 0x34, 0x32, 0x34, 0x24, 0x13, 0x98, 0xcb, 0xca, 0xeb, 0xdb, 0xac, 0xab, 0x08,
+    0x21, 0x44, 0x43, 0x33, 0x23, 0x81, 0xb9, 0xbc, 0xab, 0x9a, 0x89, 0x88, 0x90, 0xa9, 0xbd, 0xcc,
+    0xbc, 0xcc, 0xcb, 0xbb, 0xbc, 0xba, 0x9a, 0x20, 0x64, 0x34, 0x23, 0x12, 0x80, 0xa9, 0xdc, 0xbb,
+    0x25, 0x05, 0x28, 0x00, 0xab, 0x19, 0x31, 0x24, 0x11, 0x11, 0x01, 0xc9, 0xce, 0xcc, 0xaa, 0xba,
+    0xba, 0xbb, 0x89, 0x31, 0x26, 0x02, 0x90, 0xb9, 0xdd, 0xdc, 0xcb, 0xbb, 0x9a, 0x09, 0x00, 0x21,
+    0x43, 0x33, 0x13, 0x01, 0xa9, 0xbc, 0xcf, 0xcc, 0xbc, 0xbd, 0xcb, 0xba, 0x9a, 0x99, 0x88, 0x11,
+    0x42, 0x33, 0x34, 0x43, 0x34, 0x34, 0x33, 0x21, 0x11, 0x31, 0x34, 0x43, 0x33, 0x24, 0xa1, 0xed,
+    0xbd, 0xad, 0xbb, 0x9a, 0x88, 0x32, 0x36, 0x35, 0x24, 0x33, 0x24, 0x23, 0x23, 0x11, 0x80, 0x88,
+    0x89, 0x08, 0x21, 0x44, 0x43, 0x23, 0x90, 0xeb, 0xbc, 0x9b, 0x30, 0x56, 0x44, 0x34, 0x25, 0x33,
+    0x22, 0x01, 0x80, 0xa9, 0xbb, 0xcd, 0xba, 0xaa, 0x99, 0x08, 0x21, 0x34, 0x34, 0x12, 0x90, 0x99,
+    0xaa, 0x19, 0x75, 0x45, 0x44, 0x33, 0x32, 0x12, 0x90, 0xeb, 0xcc, 0xcb, 0xba, 0xbb, 0xbb, 0x9b,
+    0x09, 0x21, 0x22, 0x32, 0x37, 0x0f, 0x24, 0x00, 0x34, 0x14, 0x91, 0xcb, 0xab, 0x89, 0x20, 0x32,
+    0x44, 0x34, 0x91, 0xde, 0xcd, 0xbc, 0xbc, 0xbb, 0xac, 0xaa, 0x89, 0x80, 0x11, 0x22, 0x33, 0x33,
+    0x12, 0x98, 0xeb, 0xcc, 0xbc, 0xba, 0x99, 0x89, 0x99, 0xdb, 0xdc, 0xcc, 0xcc, 0xbb, 0xbb, 0x9a,
+    0x89, 0x20, 0x43, 0x35, 0x34, 0x34, 0x32, 0x22, 0x22, 0x00, 0xa9, 0xcb, 0x9a, 0x18, 0x32, 0x35,
+    0x34, 0x01, 0xca, 0xcf, 0xcb, 0xab, 0x99, 0x10, 0x53, 0x44, 0x44, 0x33, 0x33, 0x43, 0x22, 0x22,
+    0x10, 0x98, 0xa9, 0x89, 0x10, 0x53, 0x45, 0x33, 0x24, 0x01, 0xa8, 0xcb, 0xcb, 0x99, 0x30, 0x46,
+    0x35, 0x34, 0x34, 0x23, 0x23, 0x01, 0x90, 0xaa, 0xdb, 0xbb, 0xbb, 0x8b, 0x20, 0x36, 0x35, 0x24,
+    0x23, 0x01, 0x98, 0xba, 0xab, 0x20, 0x57, 0x44, 0x43, 0x33, 0x33, 0x01, 0xb9, 0xdd, 0xcb, 0xbc,
+    0xbb, 0xcb, 0xaa, 0x98, 0x10, 0x32, 0x33, 0x24, 0x4c, 0x18, 0x27, 0x00, 0x13, 0x98, 0xcc, 0xcc,
+    0xba, 0x89, 0x28, 0x32, 0x34, 0x14, 0xb0, 0xde, 0xcc, 0xbc, 0xbc, 0xbb, 0xbb, 0xaa, 0x89, 0x18,
+    0x32, 0x44, 0x33, 0x22, 0x90, 0xdb, 0xdc, 0xcb, 0xbb, 0xaa, 0x88, 0x08, 0x80, 0xa9, 0xdc, 0xcd,
+    0xdb, 0xba, 0xaa, 0x99, 0x08, 0x22, 0x45, 0x43, 0x43, 0x32, 0x23, 0x11, 0x90, 0xcb, 0xcc, 0xaa,
+    0x9a, 0x10, 0x42, 0x43, 0x12, 0x91, 0xca, 0xbd, 0xac, 0x9a, 0x20, 0x63, 0x34, 0x35, 0x34, 0x43,
+    0x32, 0x12, 0x12, 0x00, 0xa9, 0xba, 0x9b, 0x20, 0x45, 0x36, 0x44, 0x32, 0x12, 0x00, 0x99, 0xaa,
+    0xab, 0x9a, 0x30, 0x37, 0x25, 0x23, 0x32, 0x43, 0x23, 0x01, 0x89, 0x08, 0x12, 0x01, 0x21, 0x77,
+    0x44, 0x24, 0x23, 0x22, 0x22, 0x00, 0xc9, 0xbb, 0x9b, 0x09, 0x80, 0x88, 0x21, 0x23, 0xd8, 0xce,
+    0xba, 0x98, 0x98, 0xbb, 0x8a, 0x52, 0x33, 0x12, 0x53, 0x37, 0x14, 0xa8, 0xb3, 0x20, 0x22, 0x00,
+    0xdc, 0xbc, 0xbc, 0xbd, 0xbc, 0x99, 0x88, 0x00, 0x88, 0x89, 0x80, 0xc9, 0xcc, 0xac, 0xaa, 0xba,
+    0xcd, 0xbb, 0xab, 0x9a, 0x99, 0x99, 0xa9, 0xeb, 0xde, 0xcc, 0xbb, 0xac, 0x9a, 0x09, 0x30, 0x43,
+    0x24, 0x23, 0x12, 0x01, 0x88, 0xa9, 0xbb, 0xcd, 0xbb, 0xbc, 0x9a, 0x10, 0x32, 0x33, 0xa1, 0xef,
+    0xcd, 0xcb, 0xbb, 0x99, 0x20, 0x54, 0x34, 0x34, 0x23, 0x12, 0x00, 0x88, 0xa9, 0xbb, 0xba, 0xa9,
+    0x98, 0x00, 0x63, 0x44, 0x23, 0x90, 0xfb, 0xbc, 0xbd, 0xab, 0x89, 0x53, 0x46, 0x43, 0x43, 0x22,
+    0x11, 0x88, 0xa9, 0xbb, 0xbb, 0xbb, 0x99, 0x09, 0x22, 0x34, 0x32, 0x11, 0xa9, 0xde, 0xbc, 0xad,
+    0x89, 0x31, 0x57, 0x53, 0x34, 0x33, 0x33, 0x12, 0x98, 0xb9, 0xbc, 0xbb, 0xab, 0x09, 0x21, 0x33,
+    0x22, 0x00, 0xba, 0xdd, 0xcc, 0xac, 0x9a, 0x18, 0x53, 0x45, 0x44, 0x43, 0x23, 0x02, 0x98, 0xda,
+    0x5f, 0x2c, 0x33, 0x00, 0xdb, 0xbc, 0xbb, 0xaa, 0x99, 0x88, 0x88, 0x88, 0xb9, 0xdc, 0xdb, 0xab,
+    0xaa, 0x99, 0x18, 0x32, 0x47, 0x43, 0x33, 0x23, 0x02, 0xa8, 0xec, 0xbc, 0xbc, 0xaa, 0x99, 0x10,
+    0x42, 0x43, 0x24, 0x11, 0x88, 0x89, 0x89, 0x88, 0x00, 0x52, 0x54, 0x33, 0x33, 0x21, 0x11, 0xb0,
+    0xee, 0xbd, 0xbd, 0xba, 0xab, 0x9b, 0x08, 0x43, 0x24, 0x13, 0x80, 0x98, 0xba, 0xbc, 0xad, 0x89,
+    0x21, 0x22, 0x01, 0x11, 0x32, 0x91, 0xdf, 0xcc, 0xba, 0xcb, 0xcb, 0x8a, 0x41, 0x36, 0x35, 0x43,
+    0x32, 0x23, 0x11, 0x98, 0x99, 0x08, 0x21, 0x21, 0x32, 0x34, 0x14, 0x90, 0xdb, 0xcb, 0xbb, 0xbd,
+    0xbc, 0xaa, 0x28, 0x53, 0x45, 0x53, 0x32, 0x23, 0x01, 0xb8, 0xdb, 0xbc, 0xbb, 0xaa, 0x9a, 0x09,
+    0x88, 0x98, 0xcb, 0xcd, 0xca, 0xaa, 0x9a, 0x09, 0x42, 0x55, 0x43, 0x34, 0x43, 0x23, 0x23, 0x00,
+    0xa8, 0xaa, 0xbc, 0xbb, 0xee, 0x08, 0x26, 0x00, 0x9a, 0x41, 0x44, 0x23, 0x13, 0x81, 0xc9, 0xcd,
+    0xbb, 0x9b, 0x18, 0x53, 0x35, 0x44, 0x32, 0x12, 0x11, 0x98, 0xbb, 0xbd, 0xcc, 0xba, 0xab, 0x8a,
+    0x31, 0x44, 0x33, 0x23, 0x90, 0xdc, 0xbc, 0xaa, 0x08, 0x52, 0x45, 0x43, 0x12, 0x80, 0x99, 0xbb,
+    0xbd, 0xaa, 0x08, 0x21, 0x12, 0x42, 0x33, 0x13, 0xb0, 0xdd, 0xdc, 0xcc, 0xdb, 0xaa, 0x8a, 0x10,
+    0x42, 0x34, 0x22, 0x01, 0xca, 0xcd, 0xcb, 0xaa, 0x89, 0x00, 0x11, 0x22, 0x11, 0xb9, 0xcd, 0xbc,
+    0xbc, 0xbc, 0xcb, 0xa9, 0x88, 0x10, 0x43, 0x34, 0x23, 0x01, 0xb9, 0xcd, 0xbc, 0x9a, 0x20, 0x35,
+    0x35, 0x33, 0x23, 0x90, 0xce, 0xcc, 0xbc, 0xbb, 0xac, 0x8a, 0x08, 0x22, 0x34, 0x34, 0x24, 0x01,
+    0x00, 0x98, 0xaa, 0xaa, 0x99, 0x10, 0x32, 0x44, 0x34, 0x23, 0x12, 0xc9, 0xdd, 0xbc, 0xbc, 0xab,
+    0x09, 0x63, 0x44, 0x34, 0x43, 0x32, 0x23, 0x22, 0x3a, 0xfd, 0x2c, 0x00, 0x22, 0x43, 0x43, 0x22,
+    0x21, 0x22, 0x02, 0x80, 0x08, 0x01, 0xfb, 0xcd, 0xbb, 0xab, 0x9a, 0x51, 0x57, 0x43, 0x33, 0x33,
+    0x33, 0x01, 0xa9, 0xab, 0x9a, 0xcb, 0xac, 0x0a, 0x00, 0x00, 0x10, 0x53, 0x13, 0xfb, 0xbd, 0xbb,
+    0xcb, 0x9a, 0x51, 0x45, 0x34, 0x23, 0x23, 0x12, 0xa8, 0xcc, 0xaa, 0xa9, 0xba, 0xbc, 0x99, 0xa9,
+    0xcc, 0xac, 0xaa, 0xb9, 0xcc, 0xab, 0x89, 0x21, 0x34, 0x37, 0x35, 0x23, 0x81, 0xb9, 0xdc, 0xcc,
+    0xcb, 0xaa, 0xa9, 0x99, 0x89, 0x88, 0xa9, 0xcc, 0xbb, 0xac, 0xba, 0xbb, 0x19, 0x45, 0x33, 0x32,
+    0x43, 0x33, 0xa0, 0xcd, 0xbb, 0xbc, 0xcc, 0xbc, 0xaa, 0x9a, 0xbb, 0xbb, 0xa9, 0xb9, 0xce, 0xba,
+    0x88, 0x10, 0x43, 0x47, 0x34, 0x24, 0x11, 0x00, 0x98, 0xdb, 0xab, 0x8a, 0x99, 0x99, 0x99, 0x88,
+    0xc9, 0xbb, 0x18, 0x36, 0x35, 0x44, 0x53, 0x32, 0x24, 0x34, 0x43, 0x33, 0x0c, 0xf8, 0x2e, 0x00,
+    0x33, 0x13, 0x02, 0x98, 0x89, 0x20, 0x43, 0x33, 0x23, 0x90, 0xcc, 0xbd, 0x89, 0x54, 0x46, 0x34,
+    0x44, 0x32, 0x22, 0x12, 0x12, 0x11, 0x00, 0x11, 0x01, 0x98, 0x99, 0x88, 0xb8, 0xdd, 0xbb, 0xcb,
+    0xdc, 0xbb, 0x19, 0x54, 0x34, 0x45, 0x43, 0x33, 0x01, 0x80, 0x90, 0xba, 0xbc, 0x8a, 0x08, 0x98,
+    0xaa, 0x99, 0xfa, 0xdc, 0xab, 0xab, 0xcb, 0xba, 0x09, 0x32, 0x35, 0x53, 0x43, 0x33, 0x81, 0xca,
+    0xdb, 0xeb, 0xcb, 0xac, 0xab, 0xbb, 0xcb, 0xbb, 0xba, 0xcc, 0xcb, 0xab, 0xaa, 0xaa, 0x89, 0x21,
+    0x33, 0x23, 0x12, 0x91, 0xdc, 0xcd, 0xbc, 0xcc, 0xcb, 0xcb, 0xac, 0xab, 0xab, 0xa9, 0x89, 0x00,
+    0x01, 0x98, 0x89, 0x10, 0x33, 0x47, 0x55, 0x33, 0x33, 0x21, 0x01, 0xa8, 0xcc, 0xba, 0xba, 0xbc,
+    0xbc, 0xba, 0xbb, 0x9b, 0x40, 0x45, 0x53, 0x43, 0x24, 0x23, 0x32, 0x35, 0x33, 0x24, 0x32, 0x23,
+    0x9c, 0xec, 0x29, 0x00, 0xb8, 0xcc, 0x9a, 0xba, 0xbc, 0x19, 0x22, 0xa8, 0x9c, 0x41, 0x25, 0x32,
+    0x57, 0x35, 0x33, 0x32, 0x34, 0x33, 0x01, 0x10, 0x23, 0x82, 0x9a, 0x30, 0x33, 0x98, 0x39, 0x57,
+    0x02, 0x88, 0x31, 0x45, 0x43, 0x55, 0x44, 0x24, 0x33, 0x33, 0x22, 0x81, 0x98, 0xa9, 0xbb, 0x9b,
+    0x09, 0x01, 0x10, 0x32, 0xb1, 0xcf, 0xac, 0xaa, 0xcb, 0x0a, 0x73, 0x43, 0x43, 0x43, 0x23, 0x80,
+    0xcb, 0xcb, 0xbd, 0xcd, 0xaa, 0x9a, 0xba, 0xab, 0x9a, 0xc9, 0xbc, 0xac, 0xaa, 0xcb, 0xbb, 0x28,
+    0x22, 0x11, 0x53, 0x33, 0xd8, 0xbe, 0xcb, 0xcb, 0xbc, 0xbb, 0x9a, 0xca, 0xcb, 0xaa, 0xa9, 0xbc,
+    0xaa, 0x00, 0x00, 0x99, 0x10, 0x23, 0x90, 0x9b, 0x20, 0xb1, 0xff, 0xad, 0xbb, 0xcc, 0xab, 0xab,
+    0xaa, 0xcb, 0xdb, 0xcb, 0xab, 0x9b, 0x09, 0x51, 0x54, 0x33, 0x33, 0x12, 0x01, 0xa8, 0xdb, 0x9a,
+    0x18, 0x00, 0x08, 0x52, 0xba, 0xc9, 0x24, 0x00, 0x34, 0x01, 0x20, 0x45, 0x22, 0x00, 0x62, 0x44,
+    0x34, 0x53, 0x44, 0x43, 0x12, 0x22, 0x21, 0x81, 0x88, 0x10, 0x33, 0x34, 0x34, 0x45, 0x33, 0x23,
+    0x32, 0x34, 0x23, 0x32, 0x63, 0x33, 0x43, 0x44, 0x53, 0x23, 0x33, 0x33, 0x01, 0xa9, 0xbc, 0xbc,
+    0xcc, 0x99, 0x20, 0x33, 0x44, 0x34, 0x14, 0x81, 0xa9, 0xb9, 0xcc, 0xcb, 0x89, 0x11, 0x11, 0x21,
+    0x23, 0xe8, 0xce, 0xbb, 0xcc, 0xbb, 0xbb, 0x09, 0x10, 0x21, 0x53, 0x23, 0xa0, 0xcc, 0xbb, 0xdc,
+    0xac, 0x8a, 0x11, 0x00, 0x10, 0x11, 0xf8, 0xcd, 0xbb, 0xaa, 0xac, 0x8b, 0x21, 0x13, 0x80, 0x20,
+    0x82, 0xce, 0x9c, 0x08, 0x98, 0xcb, 0x88, 0xb1, 0xee, 0xbb, 0xaa, 0xcb, 0xad, 0x0a, 0x88, 0xa8,
+    0x89, 0x22, 0xc8, 0xcc, 0x9a, 0xb9, 0xbe, 0x8a, 0x32, 0x12, 0x00, 0x34, 0xb2, 0xff, 0xba, 0x99,
+    0xba, 0x8a, 0x52, 0x34, 0x12, 0x22, 0x33, 0xb8, 0x23, 0xd3, 0x28, 0x00, 0xad, 0x28, 0x33, 0x33,
+    0x67, 0x24, 0x13, 0x10, 0x11, 0x81, 0xbb, 0x09, 0x42, 0x22, 0x54, 0x36, 0x24, 0x21, 0x21, 0x12,
+    0x90, 0x19, 0x52, 0x43, 0x32, 0x35, 0x25, 0x00, 0x99, 0x89, 0xa9, 0x9c, 0x38, 0x37, 0x23, 0x33,
+    0x34, 0x02, 0xdb, 0x9b, 0x00, 0x99, 0x29, 0x67, 0x13, 0x81, 0x10, 0x81, 0xfa, 0xac, 0x89, 0x90,
+    0x99, 0x41, 0x26, 0x02, 0x10, 0x32, 0xa0, 0xbd, 0x0b, 0x80, 0xbb, 0x39, 0x67, 0x01, 0x08, 0x00,
+    0xb8, 0xcf, 0xaa, 0x98, 0xaa, 0x0a, 0x52, 0x12, 0x80, 0x10, 0x91, 0xde, 0xab, 0x99, 0xb9, 0xac,
+    0x08, 0x91, 0xda, 0x9b, 0xaa, 0xce, 0xac, 0xaa, 0xbb, 0xbc, 0x99, 0x08, 0x90, 0x00, 0x12, 0xa0,
+    0xcd, 0xcb, 0xba, 0xbc, 0xaa, 0x00, 0x80, 0x9a, 0x8a, 0xca, 0xcd, 0xab, 0x19, 0x00, 0x11, 0x45,
+    0x34, 0x13, 0x43, 0x45, 0x22, 0x22, 0x34, 0x14, 0x01, 0x21, 0x33, 0x11, 0x3f, 0xe9, 0x20, 0x00,
+    0x31, 0x45, 0x11, 0x08, 0x63, 0x43, 0x22, 0x54, 0x34, 0x13, 0x20, 0x22, 0x81, 0x8a, 0x51, 0x43,
+    0x21, 0x63, 0x23, 0x81, 0x99, 0x00, 0xb8, 0x9c, 0x62, 0x34, 0x23, 0x64, 0x43, 0x11, 0x00, 0x21,
+    0x91, 0xac, 0x19, 0x13, 0x98, 0x70, 0x44, 0x11, 0x88, 0x21, 0x91, 0xcc, 0x09, 0x22, 0x02, 0x63,
+    0x46, 0x12, 0x00, 0x11, 0x91, 0xcc, 0x8a, 0x11, 0xb8, 0x0a, 0x43, 0xd0, 0xbe, 0x8a, 0xa9, 0xcc,
+    0x09, 0x32, 0x91, 0x9a, 0x21, 0xd0, 0xcf, 0x89, 0x00, 0xba, 0x09, 0x32, 0xb0, 0xae, 0x89, 0xfa,
+    0xcc, 0xaa, 0xb9, 0xca, 0x8a, 0x11, 0x01, 0x88, 0x11, 0xb8, 0xef, 0x8a, 0x08, 0x98, 0x31, 0x46,
+    0x13, 0x81, 0x01, 0xa8, 0xce, 0x9c, 0x8a, 0x9a, 0x8a, 0x31, 0x24, 0x80, 0x20, 0x12, 0xfb, 0x8b,
+    0x41, 0x12, 0x42, 0x46, 0x23, 0x00, 0x00, 0x91, 0xdb, 0xaa, 0x08, 0xc9, 0xaa, 0x00, 0xb0, 0xbe,
+    0x0d, 0xf5, 0x26, 0x00, 0x09, 0x81, 0xca, 0x48, 0x36, 0x12, 0x42, 0x26, 0x02, 0x99, 0x00, 0xb9,
+    0xbd, 0x18, 0x32, 0x00, 0x11, 0x82, 0xfe, 0xac, 0x9a, 0x88, 0x18, 0x55, 0x34, 0x22, 0x21, 0x12,
+    0xa8, 0xbb, 0x89, 0xb9, 0x0a, 0x74, 0x23, 0x21, 0x33, 0x13, 0xdb, 0xad, 0xab, 0xaa, 0x18, 0x66,
+    0x43, 0x32, 0x22, 0x82, 0xca, 0xbc, 0xab, 0xbb, 0x0a, 0x43, 0x22, 0x10, 0x23, 0xea, 0xbd, 0x99,
+    0xaa, 0x8c, 0x51, 0x24, 0x11, 0x42, 0x02, 0xfb, 0xac, 0x99, 0xcb, 0xab, 0x31, 0x03, 0xba, 0x38,
+    0x84, 0xdf, 0x8a, 0x22, 0x91, 0x18, 0x57, 0x01, 0x89, 0x28, 0x81, 0xbd, 0x8b, 0x00, 0xd9, 0x8b,
+    0x32, 0x03, 0xbb, 0x51, 0x83, 0xdd, 0x8a, 0x22, 0x91, 0x38, 0x57, 0x12, 0x89, 0x08, 0xa0, 0xcd,
+    0x9a, 0x08, 0x98, 0x8a, 0x21, 0x02, 0xdb, 0x09, 0x01, 0xc9, 0x8a, 0x44, 0x13, 0x10, 0x45, 0x13,
+    0x98, 0x99, 0xb9, 0xbe, 0x16, 0xfa, 0x26, 0x00, 0xab, 0x9a, 0x88, 0x10, 0x00, 0x00, 0x11, 0x00,
+    0x73, 0x46, 0x34, 0x43, 0x33, 0x43, 0x11, 0x88, 0x08, 0xa8, 0xcd, 0x0a, 0x01, 0x98, 0x38, 0x37,
+    0x91, 0x8c, 0x20, 0x81, 0x19, 0x77, 0x24, 0x22, 0x31, 0x02, 0xb8, 0xbc, 0xab, 0xba, 0x9b, 0x28,
+    0x23, 0xc9, 0xac, 0xba, 0xcd, 0x9b, 0x11, 0x12, 0x63, 0x44, 0x22, 0x32, 0x33, 0xa0, 0xbb, 0xcd,
+    0xbe, 0xac, 0x99, 0x99, 0x8a, 0x00, 0xd9, 0xdc, 0xaa, 0xba, 0xaa, 0x29, 0x54, 0x23, 0x22, 0x11,
+    0xc0, 0xcd, 0xab, 0xa9, 0xa9, 0x28, 0x33, 0x81, 0xcb, 0xdc, 0xcd, 0xac, 0x99, 0x99, 0x18, 0x32,
+    0x23, 0x01, 0x98, 0xcc, 0xcb, 0x9a, 0x09, 0x51, 0x44, 0x43, 0x33, 0x32, 0x12, 0xc8, 0xbc, 0xcb,
+    0xbb, 0x9c, 0x40, 0x25, 0x22, 0x32, 0x03, 0xfb, 0xbb, 0x09, 0x11, 0x73, 0x36, 0x25, 0x22, 0x10,
+    0x01, 0xa8, 0xab, 0x28, 0x32, 0x22, 0x64, 0x23, 0x56, 0x07, 0x24, 0x00, 0xa0, 0xba, 0x88, 0xcb,
+    0x9d, 0x31, 0x26, 0x22, 0x54, 0x43, 0x12, 0x10, 0x12, 0x91, 0xab, 0x0a, 0x02, 0x98, 0x50, 0x34,
+    0xc8, 0xbd, 0xba, 0xcd, 0xac, 0x09, 0x11, 0x21, 0x52, 0x22, 0xa8, 0xbc, 0xcb, 0xdb, 0xaa, 0x18,
+    0x21, 0x80, 0x98, 0xda, 0xbf, 0xbc, 0xaa, 0xbb, 0x8a, 0x08, 0x98, 0xab, 0xca, 0xdc, 0xbc, 0xab,
+    0xbb, 0xbc, 0xaa, 0x88, 0x98, 0x10, 0x33, 0x81, 0xbe, 0xbc, 0xcc, 0xbc, 0x0a, 0x22, 0x23, 0x43,
+    0x03, 0xfa, 0xae, 0xbb, 0xba, 0x9a, 0x31, 0x45, 0x22, 0x23, 0x22, 0x80, 0x08, 0x41, 0x35, 0x34,
+    0x35, 0x43, 0x21, 0x11, 0x22, 0x81, 0x20, 0x11, 0xab, 0x8d, 0x21, 0x22, 0x75, 0x35, 0x24, 0x11,
+    0x22, 0x81, 0xaa, 0x41, 0x36, 0x34, 0x54, 0x33, 0x02, 0x08, 0x80, 0x98, 0x9b, 0x72, 0x34, 0x12,
+    0x32, 0x24, 0xb8, 0xac, 0x08, 0x91, 0x9a, 0x74, 0x24, 0x01, 0x32, 0x35, 0x4d, 0x0d, 0x22, 0x00,
+    0x02, 0x08, 0x42, 0x80, 0xac, 0x18, 0x03, 0xa9, 0x30, 0x05, 0xfc, 0xbc, 0xba, 0xbd, 0xac, 0x89,
+    0x11, 0x00, 0x21, 0x03, 0xeb, 0xbc, 0xab, 0xac, 0xab, 0x10, 0x13, 0x98, 0xbb, 0xde, 0xcd, 0xcb,
+    0xaa, 0xaa, 0x99, 0x00, 0x80, 0x99, 0xba, 0xbc, 0xbe, 0xab, 0x99, 0x09, 0x10, 0x42, 0x12, 0x81,
+    0xb9, 0xec, 0xcc, 0xab, 0xab, 0x9a, 0x30, 0x45, 0x32, 0x81, 0xb9, 0xcf, 0xcc, 0x9a, 0x08, 0x22,
+    0x45, 0x43, 0x12, 0x01, 0x80, 0x88, 0x09, 0x45, 0x26, 0x33, 0x43, 0x12, 0x80, 0x9a, 0xa9, 0xba,
+    0x8a, 0x63, 0x33, 0x43, 0x45, 0x23, 0x12, 0x32, 0x43, 0x10, 0x41, 0x36, 0x24, 0x33, 0x25, 0x01,
+    0xaa, 0xbc, 0xcc, 0xac, 0x89, 0x10, 0x31, 0x53, 0x33, 0x02, 0x98, 0x88, 0x00, 0x00, 0x66, 0x44,
+    0x12, 0x11, 0x01, 0xd9, 0xbd, 0xaa, 0xbb, 0xac, 0x19, 0x10, 0x80, 0x10, 0x01, 0xb9, 0xac, 0x09,
+    0x74, 0x06, 0x18, 0x00, 0x80, 0x99, 0x8b, 0xa9, 0xff, 0xaf, 0xab, 0xdb, 0xac, 0xab, 0xa9, 0xba,
+    0x8a, 0x00, 0xa9, 0x9b, 0x08, 0xca, 0xab, 0x52, 0x44, 0x33, 0x44, 0x12, 0xb8, 0xdc, 0xcb, 0xbb,
+    0x9b, 0x28, 0x54, 0x53, 0x33, 0x24, 0x22, 0x10, 0x00, 0x10, 0x31, 0x35, 0x35, 0x34, 0x22, 0x81,
+    0xa9, 0xdc, 0xcc, 0xaa, 0x9a, 0x8a, 0x11, 0x43, 0x33, 0x33, 0x22, 0x81, 0xa9, 0xab, 0xca, 0xcb,
+    0xab, 0xdb, 0xcb, 0xbb, 0xbc, 0x9a, 0x99, 0x28, 0x62, 0x42, 0x42, 0x34, 0x35, 0x63, 0x43, 0x34,
+    0x34, 0x43, 0x22, 0x11, 0x80, 0xba, 0xcc, 0xab, 0xbb, 0xab, 0x10, 0x11, 0x11, 0x23, 0xf8, 0xdc,
+    0xba, 0xbd, 0xbc, 0x9a, 0x99, 0x89, 0x21, 0x82, 0xb9, 0xec, 0xdc, 0xcc, 0xbb, 0xbb, 0x9b, 0x89,
+    0x21, 0x34, 0x34, 0x23, 0x11, 0x88, 0xaa, 0x09, 0x73, 0x54, 0x63, 0x33, 0x34, 0x32, 0x22, 0x12,
+    0x11, 0x11, 0x21, 0x10, 0x48, 0x06, 0x19, 0x00, 0x20, 0x12, 0xa9, 0x0a, 0x34, 0x32, 0x65, 0x25,
+    0x90, 0xba, 0xdc, 0xcd, 0xab, 0x8a, 0x88, 0x30, 0x44, 0x02, 0xa9, 0xec, 0xcc, 0xcb, 0xab, 0x9a,
+    0x08, 0x21, 0x22, 0x43, 0x02, 0xa9, 0x09, 0x80, 0xaa, 0x73, 0x25, 0x01, 0x42, 0x24, 0x02, 0x52,
+    0x24, 0x01, 0x00, 0xa0, 0xec, 0xaa, 0x88, 0x09, 0x52, 0x25, 0x12, 0x11, 0xa8, 0xcf, 0xaa, 0xbb,
+    0xbb, 0x19, 0x11, 0x99, 0x20, 0xc0, 0xcf, 0x99, 0xa0, 0xaa, 0x28, 0x82, 0xcc, 0x8a, 0xb9, 0xbd,
+    0x38, 0x44, 0x31, 0x44, 0x02, 0xc9, 0xab, 0xcb, 0x9b, 0x72, 0x35, 0x44, 0x43, 0x12, 0x81, 0x88,
+    0xba, 0xac, 0x00, 0x21, 0x41, 0x25, 0x92, 0xaa, 0xaa, 0xdc, 0xaa, 0x20, 0x12, 0x31, 0x24, 0x91,
+    0x99, 0x10, 0x01, 0x73, 0x24, 0x90, 0xbc, 0xde, 0xbc, 0xac, 0x99, 0x99, 0x21, 0x32, 0x12, 0x10,
+    0x90, 0xcb, 0x8a, 0x31, 0x55, 0x35, 0x24, 0x23, 0x18, 0x03, 0x24, 0x00, 0x01, 0xa9, 0xac, 0xbb,
+    0xac, 0x8a, 0x90, 0xb9, 0xaa, 0xdb, 0xac, 0x40, 0x55, 0x53, 0x34, 0x33, 0x10, 0x99, 0xcc, 0xbb,
+    0x8a, 0x10, 0x62, 0x33, 0x82, 0xc9, 0xdc, 0xad, 0xab, 0x88, 0x20, 0x54, 0x33, 0x12, 0x02, 0x98,
+    0xbb, 0x89, 0x01, 0x40, 0x34, 0x92, 0xeb, 0xcb, 0xcc, 0xaa, 0x00, 0x22, 0x43, 0x24, 0x90, 0xa9,
+    0xbb, 0xad, 0x31, 0x37, 0x43, 0x34, 0x02, 0xba, 0xbd, 0xcc, 0xbb, 0x89, 0x08, 0x10, 0x31, 0xa8,
+    0xbc, 0xcb, 0xbd, 0x0a, 0x32, 0x23, 0x54, 0x13, 0xc9, 0xab, 0xca, 0xac, 0x29, 0x24, 0x01, 0x08,
+    0xfb, 0xbf, 0x9c, 0x9a, 0x89, 0x52, 0x33, 0x22, 0x03, 0xc8, 0xbd, 0x8a, 0x09, 0x62, 0x44, 0x23,
+    0x11, 0x80, 0xcb, 0xab, 0x88, 0x20, 0x54, 0x33, 0x00, 0xa9, 0xda, 0xbb, 0x28, 0x54, 0x43, 0x34,
+    0x12, 0x80, 0x98, 0x9a, 0x18, 0x46, 0x43, 0x43, 0x22, 0x90, 0xaa, 0xbb, 0x1e, 0x0c, 0x23, 0x00,
+    0xbd, 0x8a, 0x01, 0x11, 0x31, 0x92, 0xdd, 0xaa, 0xba, 0x8b, 0x73, 0x24, 0x32, 0x24, 0x90, 0xbb,
+    0x99, 0xa9, 0x58, 0x36, 0x03, 0xaa, 0xdc, 0xce, 0xbb, 0xaa, 0x89, 0x28, 0x23, 0x90, 0xbc, 0xdc,
+    0xcb, 0x0a, 0x21, 0x43, 0x43, 0x12, 0xba, 0xad, 0xcb, 0xaa, 0x10, 0x12, 0xa0, 0xeb, 0xdd, 0xbc,
+    0xaa, 0x89, 0x18, 0x32, 0x23, 0x90, 0xaa, 0xcb, 0x9b, 0x72, 0x35, 0x34, 0x33, 0x03, 0xa0, 0xaa,
+    0xba, 0x8a, 0x51, 0x33, 0x13, 0x81, 0xeb, 0xbd, 0x8a, 0x10, 0x64, 0x44, 0x43, 0x22, 0x22, 0x01,
+    0x08, 0x21, 0x44, 0x44, 0x34, 0x22, 0x81, 0xa9, 0xcd, 0xbb, 0x8a, 0x18, 0x42, 0x25, 0x02, 0x90,
+    0xbb, 0xbd, 0x0a, 0x52, 0x44, 0x44, 0x12, 0x81, 0x99, 0xbb, 0xac, 0x19, 0x31, 0x33, 0x23, 0xea,
+    0xce, 0xbb, 0xac, 0x89, 0x32, 0x43, 0x24, 0x82, 0xc9, 0xbc, 0xbb, 0x9a, 0x42, 0x35, 0x33, 0x01,
+    0xfb, 0x0c, 0x27, 0x00, 0xea, 0xbd, 0xbc, 0xaa, 0x09, 0x21, 0x23, 0x01, 0xca, 0xce, 0xac, 0x9a,
+    0x18, 0x31, 0x35, 0x11, 0xa9, 0xcc, 0xbd, 0xaa, 0x18, 0x21, 0x53, 0x13, 0xb8, 0xcc, 0xdb, 0xab,
+    0x08, 0x32, 0x44, 0x33, 0x02, 0xaa, 0xcb, 0xbc, 0x89, 0x52, 0x33, 0x34, 0x23, 0xa8, 0xcb, 0xaa,
+    0x9a, 0x62, 0x45, 0x22, 0x23, 0x82, 0xb9, 0xab, 0x99, 0x48, 0x47, 0x24, 0x22, 0x02, 0xb8, 0xbd,
+    0xaa, 0x89, 0x50, 0x35, 0x33, 0x21, 0x90, 0xfb, 0xaa, 0x88, 0x28, 0x73, 0x23, 0x01, 0x88, 0xda,
+    0xac, 0x89, 0x10, 0x42, 0x43, 0x82, 0xa9, 0xdb, 0xbc, 0x9a, 0x21, 0x63, 0x43, 0x12, 0x80, 0xba,
+    0xbd, 0x9b, 0x19, 0x42, 0x35, 0x14, 0x11, 0xa8, 0xcb, 0xab, 0x88, 0x31, 0x37, 0x14, 0x11, 0x98,
+    0xdb, 0xaa, 0x08, 0x21, 0x46, 0x23, 0x80, 0xb9, 0xcd, 0xac, 0x09, 0x20, 0x53, 0x24, 0x80, 0xa9,
+    0xeb, 0xac, 0x89, 0x00, 0x01, 0x06, 0x2a, 0x00, 0x21, 0x33, 0xa0, 0xcd, 0xbc, 0xbc, 0x8a, 0x11,
+    0x11, 0x02, 0xea, 0xbc, 0xbc, 0xab, 0x20, 0x53, 0x22, 0x03, 0xd9, 0xbd, 0xab, 0xab, 0x20, 0x35,
+    0x01, 0x00, 0xfa, 0xbc, 0x8a, 0x88, 0x20, 0x36, 0x81, 0x99, 0xa9, 0xbe, 0x19, 0x34, 0x33, 0x46,
+    0x02, 0xaa, 0xaa, 0xbc, 0x8c, 0x32, 0x24, 0x32, 0x13, 0xfb, 0xab, 0xaa, 0x9a, 0x61, 0x24, 0x12,
+    0x21, 0xa9, 0xbd, 0x09, 0x10, 0x54, 0x44, 0x02, 0x80, 0xb9, 0xcc, 0xaa, 0x18, 0x42, 0x44, 0x22,
+    0x91, 0xc9, 0xab, 0xab, 0x28, 0x56, 0x33, 0x33, 0x02, 0xb9, 0xac, 0x89, 0x30, 0x47, 0x34, 0x11,
+    0x80, 0xda, 0xbb, 0x8a, 0x21, 0x73, 0x34, 0x02, 0x88, 0xb9, 0xcd, 0x89, 0x21, 0x33, 0x36, 0x03,
+    0xa8, 0xbb, 0xcc, 0x9b, 0x30, 0x43, 0x32, 0x02, 0xec, 0xbc, 0xbb, 0x9a, 0x30, 0x35, 0x13, 0x80,
+    0xfb, 0xbc, 0x9c, 0x89, 0x10, 0x43, 0x12, 0xa0, 0xc3, 0x05, 0x2c, 0x00, 0xeb, 0xdb, 0xab, 0x88,
+    0x11, 0x23, 0x13, 0xc8, 0xcd, 0xcb, 0x9a, 0x18, 0x43, 0x33, 0x12, 0xc8, 0xcd, 0xab, 0x8a, 0x20,
+    0x45, 0x23, 0x01, 0xa8, 0xcc, 0xab, 0x09, 0x42, 0x34, 0x25, 0x81, 0x99, 0xbb, 0x9b, 0x38, 0x37,
+    0x34, 0x33, 0x91, 0xda, 0xab, 0x9b, 0x40, 0x54, 0x33, 0x23, 0x80, 0xcb, 0xbc, 0x8a, 0x20, 0x45,
+    0x33, 0x13, 0xa8, 0xcc, 0xbb, 0x89, 0x41, 0x44, 0x23, 0x01, 0xca, 0xbd, 0xba, 0x19, 0x52, 0x34,
+    0x33, 0x81, 0xda, 0xbc, 0x9b, 0x09, 0x53, 0x34, 0x23, 0x80, 0xcb, 0xcc, 0x9a, 0x00, 0x43, 0x34,
+    0x11, 0xa8, 0xdc, 0xbb, 0x9a, 0x30, 0x63, 0x33, 0x01, 0xca, 0xcd, 0xbb, 0x9a, 0x28, 0x42, 0x24,
+    0x81, 0xcb, 0xcc, 0xbb, 0x8a, 0x21, 0x43, 0x33, 0x80, 0xdc, 0xcb, 0x9a, 0x19, 0x44, 0x43, 0x12,
+    0x90, 0xda, 0xbb, 0x99, 0x41, 0x44, 0x34, 0x12, 0x88, 0xba, 0xbb, 0x19, 0x62, 0xfd, 0x26, 0x00,
+    0x63, 0x44, 0x32, 0x01, 0xa9, 0xbb, 0x9b, 0x20, 0x45, 0x34, 0x11, 0xb9, 0xcd, 0xcb, 0x99, 0x20,
+    0x32, 0x24, 0x91, 0xda, 0xdb, 0xba, 0x89, 0x20, 0x33, 0x22, 0x90, 0xdd, 0xab, 0x9a, 0x28, 0x44,
+    0x33, 0x01, 0xca, 0xbd, 0xac, 0x08, 0x43, 0x44, 0x14, 0x01, 0xaa, 0xdb, 0xab, 0x19, 0x41, 0x43,
+    0x12, 0xb8, 0xcd, 0xbc, 0x9b, 0x09, 0x31, 0x23, 0xb0, 0xcf, 0xcc, 0xab, 0x8a, 0x21, 0x34, 0x22,
+    0xa0, 0xbe, 0xad, 0x9b, 0x18, 0x53, 0x24, 0x12, 0x90, 0xbb, 0xab, 0x38, 0x56, 0x44, 0x32, 0x01,
+    0x88, 0x99, 0x18, 0x54, 0x35, 0x34, 0x22, 0x80, 0x99, 0x9a, 0x28, 0x54, 0x34, 0x23, 0x01, 0xaa,
+    0xbc, 0x9b, 0x10, 0x44, 0x23, 0x81, 0xeb, 0xcc, 0xab, 0x9a, 0x10, 0x22, 0x01, 0xda, 0xcd, 0xbc,
+    0xab, 0x99, 0x10, 0x11, 0x81, 0xcb, 0xcc, 0xac, 0x8b, 0x18, 0x21, 0x33, 0x82, 0xcb, 0xbd, 0xbb,
+    0xb4, 0xf9, 0x23, 0x00, 0x09, 0x53, 0x44, 0x22, 0x82, 0xc9, 0xdb, 0xaa, 0x89, 0x41, 0x53, 0x12,
+    0x80, 0xdb, 0xbc, 0xac, 0x89, 0x00, 0x12, 0xa0, 0xec, 0xcc, 0xbb, 0x9a, 0x08, 0x22, 0x01, 0xc9,
+    0xcd, 0xbc, 0x9a, 0x10, 0x52, 0x33, 0x12, 0x98, 0xbb, 0x9b, 0x72, 0x54, 0x33, 0x23, 0x81, 0x88,
+    0x19, 0x73, 0x44, 0x34, 0x32, 0x01, 0x88, 0x08, 0x31, 0x56, 0x43, 0x22, 0x11, 0x98, 0x99, 0x00,
+    0x53, 0x25, 0x13, 0x81, 0xcb, 0xbc, 0x9a, 0x18, 0x43, 0x23, 0x90, 0xdd, 0xcc, 0xaa, 0x99, 0x10,
+    0x22, 0x81, 0xca, 0xbd, 0xad, 0x8a, 0x10, 0x32, 0x12, 0xa0, 0xfb, 0xcb, 0xaa, 0x18, 0x41, 0x34,
+    0x11, 0x98, 0xea, 0xcb, 0x99, 0x09, 0x32, 0x34, 0x02, 0xa9, 0xce, 0xac, 0xaa, 0x18, 0x41, 0x12,
+    0x91, 0xdc, 0xcd, 0xaa, 0x8a, 0x10, 0x33, 0x03, 0xb8, 0xdf, 0xac, 0x9b, 0x09, 0x31, 0x24, 0x02,
+    0xb9, 0xce, 0xaa, 0x89, 0xf3, 0xe6, 0x2b, 0x00, 0x52, 0x53, 0x12, 0x01, 0xaa, 0xbb, 0x19, 0x73,
+    0x44, 0x24, 0x11, 0x88, 0xaa, 0x89, 0x30, 0x45, 0x34, 0x22, 0x80, 0xb9, 0xab, 0x08, 0x63, 0x34,
+    0x22, 0x98, 0xcb, 0xbc, 0x9a, 0x21, 0x43, 0x14, 0xb0, 0xeb, 0xcb, 0xab, 0x08, 0x11, 0x12, 0xa0,
+    0xcd, 0xcb, 0xaa, 0x19, 0x22, 0x22, 0x80, 0xdc, 0xac, 0x8a, 0x28, 0x45, 0x33, 0x22, 0x80, 0xaa,
+    0x09, 0x42, 0x56, 0x43, 0x12, 0x11, 0x98, 0x09, 0x31, 0x44, 0x34, 0x23, 0x88, 0xcb, 0xcc, 0x9a,
+    0x80, 0x31, 0x23, 0xb8, 0xce, 0xdc, 0xab, 0x9a, 0x88, 0x10, 0x81, 0xca, 0xeb, 0xbc, 0x9a, 0x89,
+    0x10, 0x13, 0xb0, 0xdc, 0xbd, 0xac, 0x89, 0x20, 0x44, 0x22, 0x00, 0xb9, 0xcc, 0x9a, 0x21, 0x54,
+    0x34, 0x12, 0x80, 0xaa, 0xab, 0x41, 0x55, 0x43, 0x13, 0x90, 0xca, 0xcb, 0x8a, 0x30, 0x53, 0x23,
+    0x90, 0xcd, 0xbc, 0xab, 0x18, 0x32, 0x24, 0x92, 0x34, 0xff, 0x23, 0x00, 0xdc, 0xcc, 0xaa, 0x0a,
+    0x31, 0x23, 0x03, 0xda, 0xcd, 0xba, 0x09, 0x52, 0x43, 0x22, 0x80, 0xcb, 0xbb, 0x8b, 0x41, 0x45,
+    0x23, 0x02, 0xa8, 0xbb, 0x09, 0x54, 0x45, 0x33, 0x12, 0xa0, 0xcb, 0xaa, 0x10, 0x45, 0x34, 0x12,
+    0x80, 0xba, 0xab, 0x29, 0x54, 0x44, 0x12, 0x98, 0xbc, 0xad, 0x9a, 0x10, 0x43, 0x23, 0x81, 0xdb,
+    0xbc, 0xab, 0x10, 0x44, 0x33, 0x82, 0xea, 0xcc, 0xba, 0x89, 0x31, 0x34, 0x22, 0x98, 0xcc, 0xac,
+    0x89, 0x32, 0x44, 0x13, 0xa0, 0xdc, 0xbc, 0xaa, 0x18, 0x43, 0x33, 0x12, 0xb9, 0xdc, 0x9a, 0x09,
+    0x33, 0x24, 0x91, 0xfb, 0xcc, 0xaa, 0x89, 0x20, 0x43, 0x12, 0x80, 0xbb, 0xad, 0x89, 0x10, 0x33,
+    0x83, 0xea, 0xcc, 0xbb, 0x8a, 0x31, 0x44, 0x33, 0x12, 0x80, 0x99, 0x18, 0x43, 0x34, 0x23, 0x90,
+    0xcb, 0xa9, 0x21, 0x57, 0x44, 0x32, 0x34, 0x32, 0x33, 0x34, 0x22, 0x22, 0xbc, 0x06, 0x1e, 0x00,
+    0x88, 0xa9, 0x89, 0x29, 0x44, 0x34, 0x34, 0x32, 0x42, 0x43, 0x34, 0x33, 0x81, 0xfb, 0xbc, 0xbd,
+    0xaa, 0x89, 0x09, 0x01, 0x90, 0xab, 0xcb, 0xba, 0x88, 0x90, 0xea, 0xec, 0xbc, 0xbc, 0xac, 0x9b,
+    0x99, 0x08, 0x10, 0x02, 0x12, 0x12, 0x89, 0x89, 0xba, 0x8a, 0x90, 0xdd, 0xcd, 0xbe, 0xbc, 0x8a,
+    0x38, 0x55, 0x33, 0x23, 0x90, 0xdc, 0xbb, 0xab, 0x88, 0x01, 0xb8, 0xee, 0xdb, 0xab, 0x0a, 0x21,
+    0x35, 0x22, 0xa8, 0xdc, 0xac, 0x9a, 0x10, 0x33, 0x24, 0x90, 0xdb, 0xac, 0x19, 0x73, 0x34, 0x23,
+    0x02, 0xa9, 0xbb, 0x0a, 0x73, 0x35, 0x33, 0x02, 0xa8, 0xbb, 0x19, 0x65, 0x44, 0x33, 0x11, 0x98,
+    0xab, 0x9a, 0x31, 0x37, 0x24, 0x01, 0xc9, 0xcb, 0x9b, 0x18, 0x44, 0x33, 0x01, 0xca, 0xcd, 0xab,
+    0x89, 0x11, 0x33, 0x01, 0xdb, 0xbd, 0xac, 0x89, 0x22, 0x43, 0x12, 0xa8, 0xcd, 0xbb, 0x9a, 0x20,
+    0xd9, 0xff, 0x24, 0x00, 0x43, 0x23, 0x90, 0xbc, 0xbc, 0x9b, 0x28, 0x43, 0x22, 0x01, 0xc9, 0xbc,
+    0xaa, 0xaa, 0x99, 0xba, 0xac, 0x9a, 0x9c, 0xaa, 0xed, 0xcc, 0xbb, 0x9c, 0x18, 0x12, 0x12, 0xe9,
+    0xcf, 0xcb, 0xaa, 0x89, 0x32, 0x43, 0x12, 0xc9, 0xcc, 0xab, 0x19, 0x73, 0x33, 0x23, 0x91, 0xdb,
+    0xab, 0x18, 0x64, 0x44, 0x22, 0x02, 0x98, 0xab, 0x89, 0x42, 0x36, 0x24, 0x12, 0xa8, 0xba, 0xab,
+    0x30, 0x55, 0x43, 0x01, 0x98, 0xcb, 0x9c, 0x09, 0x21, 0x33, 0x03, 0xeb, 0xbc, 0xad, 0x8a, 0x10,
+    0x22, 0x13, 0xb9, 0xbe, 0xac, 0x9b, 0x11, 0x23, 0x12, 0xc8, 0xcd, 0xab, 0x09, 0x42, 0x45, 0x22,
+    0x01, 0xa8, 0xaa, 0x08, 0x53, 0x45, 0x33, 0x12, 0x80, 0x99, 0x20, 0x53, 0x35, 0x25, 0x81, 0x98,
+    0xdb, 0xab, 0x88, 0x10, 0x32, 0x82, 0xea, 0xcc, 0xcc, 0x9a, 0x98, 0x00, 0x11, 0xa9, 0xcb, 0xcd,
+    0xbb, 0x8a, 0x08, 0x31, 0x6c, 0xfd, 0x1f, 0x00, 0x82, 0xdb, 0xdc, 0xbc, 0x9b, 0x00, 0x42, 0x34,
+    0x12, 0x98, 0xeb, 0xab, 0x18, 0x42, 0x45, 0x23, 0x01, 0xa8, 0xba, 0x1a, 0x54, 0x35, 0x34, 0x01,
+    0xa9, 0xcc, 0xaa, 0x08, 0x42, 0x43, 0x02, 0xc9, 0xbd, 0xbc, 0x99, 0x21, 0x33, 0x23, 0xd9, 0xcd,
+    0xac, 0x9a, 0x18, 0x33, 0x32, 0xa0, 0xdd, 0xac, 0x9b, 0x20, 0x35, 0x24, 0x02, 0xb8, 0xbc, 0xbb,
+    0x18, 0x54, 0x34, 0x22, 0x80, 0xba, 0x9b, 0x40, 0x55, 0x34, 0x23, 0x01, 0xba, 0xac, 0x0a, 0x32,
+    0x47, 0x22, 0x02, 0x99, 0xbb, 0x8a, 0x41, 0x54, 0x33, 0x81, 0xba, 0xbf, 0xab, 0x88, 0x32, 0x44,
+    0x02, 0xa8, 0xcc, 0xbb, 0x0a, 0x41, 0x34, 0x23, 0xa8, 0xce, 0xac, 0x9b, 0x18, 0x33, 0x34, 0x82,
+    0xc9, 0xcc, 0x9a, 0x18, 0x34, 0x34, 0x01, 0xca, 0xcd, 0xab, 0x8a, 0x31, 0x34, 0x23, 0x91, 0xdb,
+    0xbb, 0x9a, 0x30, 0x35, 0x13, 0xc9, 0xce, 0xcb, 0xfd, 0xf8, 0x2d, 0x00, 0x9a, 0x08, 0x33, 0x33,
+    0x02, 0xb9, 0xbd, 0x9c, 0x08, 0x32, 0x33, 0xa8, 0xce, 0xbc, 0xab, 0x10, 0x43, 0x35, 0x12, 0x81,
+    0x89, 0x89, 0x32, 0x35, 0x33, 0x91, 0xea, 0xab, 0x0a, 0x52, 0x45, 0x24, 0x33, 0x22, 0x21, 0x43,
+    0x43, 0x32, 0x02, 0xa8, 0xbc, 0xac, 0x0a, 0x42, 0x63, 0x33, 0x22, 0x13, 0x23, 0x22, 0x14, 0x91,
+    0xfa, 0xeb, 0xbb, 0xac, 0x99, 0x19, 0x11, 0x22, 0x23, 0x12, 0x08, 0xa8, 0xce, 0xdb, 0xdb, 0xcb,
+    0xbb, 0xcb, 0xba, 0xba, 0x89, 0x30, 0x73, 0x33, 0x13, 0x91, 0xda, 0xbc, 0xab, 0x99, 0x89, 0xb9,
+    0xde, 0xbb, 0xab, 0x30, 0x57, 0x43, 0x22, 0x81, 0xba, 0xbc, 0xab, 0x09, 0x01, 0xa8, 0xdd, 0xcc,
+    0x9a, 0x10, 0x54, 0x43, 0x12, 0x90, 0xcb, 0xac, 0x8a, 0x20, 0x33, 0x82, 0xea, 0xbc, 0x9b, 0x41,
+    0x55, 0x43, 0x12, 0x98, 0xcb, 0xab, 0x08, 0x52, 0x24, 0x12, 0xa9, 0xcc, 0xa8, 0xfe, 0x29, 0x00,
+    0xaa, 0x30, 0x55, 0x34, 0x12, 0x90, 0xcb, 0xab, 0x19, 0x52, 0x34, 0x02, 0xb8, 0xcd, 0xab, 0x08,
+    0x53, 0x34, 0x12, 0xa0, 0xcc, 0xac, 0x99, 0x21, 0x43, 0x02, 0xb9, 0xdd, 0xba, 0x09, 0x32, 0x35,
+    0x13, 0xb0, 0xdc, 0xbb, 0x8a, 0x21, 0x25, 0x12, 0xb8, 0xcd, 0xbb, 0x09, 0x42, 0x44, 0x12, 0x90,
+    0xbc, 0xcb, 0x09, 0x41, 0x33, 0x23, 0xb9, 0xdd, 0xab, 0x09, 0x43, 0x35, 0x12, 0x90, 0xcb, 0xac,
+    0x09, 0x32, 0x44, 0x01, 0xb8, 0xcd, 0xab, 0x08, 0x52, 0x34, 0x22, 0x90, 0xbb, 0xac, 0x09, 0x43,
+    0x25, 0x02, 0xb9, 0xcd, 0x9b, 0x18, 0x53, 0x34, 0x13, 0x90, 0xcb, 0xbb, 0x09, 0x52, 0x43, 0x11,
+    0xba, 0xcd, 0x9a, 0x18, 0x54, 0x43, 0x12, 0x90, 0xbb, 0xad, 0x89, 0x20, 0x32, 0x91, 0xeb, 0xbd,
+    0xab, 0x18, 0x63, 0x43, 0x22, 0x90, 0xca, 0xbb, 0x9a, 0x21, 0x43, 0x12, 0xca, 0xcd, 0xab, 0x08,
+    0x0f, 0xfc, 0x26, 0x00, 0x44, 0x34, 0x23, 0x98, 0xeb, 0xcb, 0x9a, 0x00, 0x32, 0x22, 0x98, 0xcb,
+    0xab, 0x31, 0x67, 0x33, 0x23, 0x90, 0xdb, 0xbc, 0xab, 0x08, 0x21, 0x11, 0xb8, 0xcd, 0xaa, 0x29,
+    0x55, 0x43, 0x13, 0x90, 0xdb, 0xcb, 0x8a, 0x10, 0x43, 0x22, 0x90, 0xcb, 0xab, 0x29, 0x55, 0x43,
+    0x12, 0xb9, 0xbe, 0xad, 0x99, 0x20, 0x42, 0x22, 0x81, 0xa9, 0x9a, 0x51, 0x45, 0x43, 0x02, 0xa8,
+    0xbd, 0xac, 0x8a, 0x10, 0x32, 0x13, 0xa9, 0xbd, 0xab, 0x30, 0x65, 0x23, 0x02, 0xc9, 0xbc, 0xac,
+    0x08, 0x42, 0x43, 0x02, 0x98, 0xcb, 0x9a, 0x20, 0x44, 0x23, 0xb0, 0xed, 0xbb, 0x9c, 0x18, 0x32,
+    0x43, 0x01, 0xa8, 0xba, 0x18, 0x64, 0x34, 0x23, 0xa1, 0xeb, 0xcb, 0x9a, 0x20, 0x42, 0x12, 0x90,
+    0xbc, 0xbc, 0x09, 0x43, 0x35, 0x12, 0xa0, 0xcc, 0xab, 0x09, 0x53, 0x44, 0x12, 0x90, 0xb9, 0xaa,
+    0x18, 0x34, 0x25, 0x80, 0xae, 0x06, 0x27, 0x00, 0xcc, 0xcc, 0xaa, 0x88, 0x22, 0x33, 0x01, 0xb9,
+    0xcb, 0x08, 0x64, 0x34, 0x33, 0x91, 0xca, 0xcb, 0x8a, 0x20, 0x33, 0x01, 0xfb, 0xbd, 0xbb, 0x09,
+    0x41, 0x33, 0x03, 0xc9, 0xcc, 0xaa, 0x10, 0x44, 0x24, 0x02, 0xa9, 0xcb, 0x8a, 0x40, 0x34, 0x24,
+    0x90, 0xeb, 0xcb, 0x9b, 0x09, 0x20, 0x01, 0xb9, 0xbd, 0x9c, 0x18, 0x45, 0x34, 0x32, 0x00, 0x98,
+    0x99, 0x20, 0x34, 0x23, 0xc8, 0xdd, 0xbc, 0x9a, 0x08, 0x31, 0x23, 0x80, 0xca, 0x9b, 0x38, 0x56,
+    0x43, 0x12, 0x80, 0xba, 0xbb, 0x20, 0x55, 0x34, 0x22, 0x81, 0xa9, 0xab, 0x9a, 0x00, 0x90, 0xfb,
+    0xbd, 0xbd, 0xaa, 0x18, 0x63, 0x43, 0x33, 0x33, 0x21, 0x22, 0x22, 0x23, 0x82, 0xfb, 0xcd, 0xcb,
+    0xab, 0x9a, 0x80, 0x01, 0x98, 0xb9, 0xab, 0x40, 0x55, 0x34, 0x12, 0xb8, 0xcd, 0xbb, 0x8a, 0x31,
+    0x35, 0x02, 0xb9, 0xbf, 0xab, 0x18, 0x53, 0x23, 0xa9, 0x00, 0x23, 0x00, 0xa8, 0xcf, 0xcc, 0xaa,
+    0x08, 0x21, 0x24, 0x12, 0x81, 0x89, 0x30, 0x45, 0x25, 0x22, 0xa8, 0xcc, 0xbc, 0x9b, 0x89, 0x11,
+    0x10, 0x98, 0x9a, 0x19, 0x55, 0x44, 0x33, 0x11, 0x98, 0xaa, 0x88, 0x42, 0x43, 0x02, 0xa8, 0xbc,
+    0x8b, 0x41, 0x45, 0x23, 0x81, 0xdb, 0xbc, 0x9b, 0x09, 0x22, 0x22, 0x00, 0x8a, 0x30, 0x77, 0x34,
+    0x34, 0x23, 0x02, 0x98, 0xb9, 0xcb, 0xdb, 0xdb, 0xbb, 0xbc, 0x9a, 0x08, 0x22, 0x24, 0x22, 0x10,
+    0x10, 0x52, 0x53, 0x32, 0x90, 0xdc, 0xcc, 0xaa, 0x08, 0x31, 0x33, 0x81, 0xdd, 0xbc, 0xac, 0x89,
+    0x21, 0x22, 0xa0, 0xec, 0xcb, 0x9a, 0x28, 0x44, 0x24, 0x11, 0x98, 0xaa, 0x88, 0x53, 0x34, 0x23,
+    0xb8, 0xbf, 0xad, 0x9a, 0x10, 0x21, 0x12, 0x98, 0xcb, 0x09, 0x73, 0x44, 0x33, 0x02, 0xa9, 0xcc,
+    0x9a, 0x10, 0x34, 0x22, 0x90, 0xcc, 0xbb, 0x08, 0x54, 0x34, 0x13, 0x90, 0x6c, 0x04, 0x25, 0x00,
+    0xcc, 0xbb, 0x89, 0x31, 0x35, 0x12, 0xb8, 0xdb, 0x9b, 0x38, 0x55, 0x33, 0x12, 0xa8, 0xdb, 0xab,
+    0x89, 0x21, 0x22, 0x90, 0xcc, 0xbc, 0x0a, 0x52, 0x35, 0x24, 0x81, 0xa9, 0xac, 0x9b, 0x89, 0x80,
+    0xd9, 0xdc, 0xac, 0xaa, 0x20, 0x54, 0x23, 0x13, 0x98, 0xcb, 0x9a, 0x10, 0x33, 0x82, 0xec, 0xbe,
+    0xcb, 0x89, 0x21, 0x34, 0x13, 0xa0, 0xeb, 0xab, 0x88, 0x42, 0x23, 0x82, 0xcb, 0xbc, 0x1a, 0x73,
+    0x34, 0x14, 0x01, 0xa9, 0xab, 0x0a, 0x21, 0x13, 0xc9, 0xde, 0xbb, 0x8a, 0x31, 0x54, 0x32, 0x01,
+    0x98, 0x08, 0x63, 0x44, 0x23, 0x01, 0xb9, 0xad, 0x9b, 0x08, 0x12, 0x01, 0xcb, 0xbd, 0xab, 0x28,
+    0x35, 0x24, 0x80, 0xba, 0xbb, 0x1a, 0x45, 0x44, 0x12, 0x00, 0x08, 0x20, 0x44, 0x23, 0x91, 0xce,
+    0xbd, 0xcb, 0x9a, 0x89, 0x88, 0x98, 0x9a, 0x09, 0x62, 0x44, 0x33, 0x22, 0x80, 0xa9, 0x89, 0x10,
+    0xc4, 0x01, 0x1a, 0x00, 0x01, 0xd8, 0xec, 0xcb, 0xab, 0x99, 0x89, 0xa9, 0xbc, 0xad, 0x9a, 0x30,
+    0x44, 0x24, 0x11, 0x88, 0x88, 0x31, 0x55, 0x32, 0x12, 0x80, 0x9a, 0x89, 0x11, 0x82, 0xfa, 0xce,
+    0xbc, 0xab, 0x8a, 0x20, 0x52, 0x42, 0x33, 0x35, 0x44, 0x33, 0x23, 0x01, 0xa9, 0xac, 0xab, 0x9a,
+    0x99, 0xba, 0xbb, 0x9c, 0x28, 0x45, 0x24, 0x03, 0x80, 0xaa, 0x09, 0x54, 0x35, 0x24, 0x12, 0x80,
+    0x89, 0x08, 0x12, 0x12, 0xd9, 0xdd, 0xbc, 0xbb, 0x9a, 0x09, 0x89, 0xdb, 0xcc, 0xbb, 0x99, 0x42,
+    0x36, 0x44, 0x12, 0x02, 0x98, 0xa9, 0xaa, 0xcb, 0xdc, 0xcc, 0xbc, 0xbb, 0x9a, 0x20, 0x53, 0x33,
+    0x12, 0x98, 0xba, 0x8a, 0x20, 0x23, 0xc0, 0xee, 0xbb, 0x9a, 0x41, 0x45, 0x32, 0x80, 0xca, 0xbc,
+    0x9a, 0x20, 0x33, 0x13, 0xd9, 0xbc, 0x8b, 0x62, 0x45, 0x23, 0x01, 0xaa, 0xbb, 0x19, 0x54, 0x34,
+    0x03, 0xb8, 0xbe, 0x9a, 0x6e, 0xfe, 0x22, 0x00, 0x28, 0x44, 0x23, 0x80, 0xba, 0xab, 0x51, 0x46,
+    0x24, 0x01, 0xb9, 0xbd, 0x9b, 0x19, 0x42, 0x22, 0xa0, 0xca, 0x9a, 0x62, 0x44, 0x24, 0x81, 0xb9,
+    0xbc, 0xab, 0x18, 0x33, 0x13, 0xc9, 0xcd, 0x9a, 0x28, 0x34, 0x14, 0x90, 0xcc, 0xbb, 0x8a, 0x31,
+    0x35, 0x02, 0xba, 0xbe, 0x9a, 0x20, 0x34, 0x12, 0xb8, 0xce, 0xaa, 0x09, 0x22, 0x12, 0xda, 0xbe,
+    0xad, 0x9b, 0x08, 0x21, 0x22, 0x11, 0x21, 0x54, 0x53, 0x23, 0x82, 0xc9, 0xbc, 0xbc, 0x9b, 0x9a,
+    0xaa, 0xba, 0x8a, 0x62, 0x55, 0x43, 0x22, 0x00, 0x99, 0x9a, 0x10, 0x32, 0x23, 0xb8, 0xbf, 0xab,
+    0x30, 0x47, 0x43, 0x22, 0x00, 0x88, 0x00, 0x33, 0x24, 0x91, 0xec, 0xcb, 0xaa, 0x09, 0x22, 0x24,
+    0x33, 0x44, 0x44, 0x35, 0x23, 0x12, 0xb9, 0xbe, 0xbc, 0xab, 0xaa, 0x99, 0x9a, 0x0a, 0x51, 0x55,
+    0x34, 0x33, 0x12, 0x99, 0xbc, 0xbc, 0xbb, 0xdb, 0x84, 0x01, 0x26, 0x00, 0xbb, 0xad, 0x9a, 0x18,
+    0x53, 0x43, 0x22, 0x01, 0x98, 0x89, 0x88, 0xa8, 0xec, 0xbd, 0xbd, 0xab, 0x89, 0x10, 0x33, 0x33,
+    0x23, 0x23, 0x34, 0x43, 0x12, 0xc8, 0xdd, 0xcc, 0xcb, 0xab, 0xaa, 0x18, 0x51, 0x63, 0x33, 0x24,
+    0x13, 0x02, 0x00, 0x99, 0xbb, 0xdd, 0xcb, 0xbb, 0xaa, 0x18, 0x44, 0x44, 0x43, 0x32, 0x22, 0x11,
+    0x00, 0x98, 0xca, 0xcb, 0xcb, 0x9a, 0x09, 0x10, 0x33, 0x36, 0x44, 0x43, 0x23, 0x22, 0x80, 0xb9,
+    0xbc, 0xbd, 0xbb, 0xbc, 0xbb, 0xab, 0x10, 0x54, 0x44, 0x32, 0x23, 0x23, 0x22, 0x02, 0xca, 0xdf,
+    0xbc, 0xbc, 0xaa, 0x09, 0x20, 0x23, 0x23, 0x12, 0x32, 0x44, 0x33, 0x91, 0xfc, 0xcc, 0xcb, 0xaa,
+    0x99, 0x00, 0x11, 0x12, 0x33, 0x35, 0x43, 0x12, 0x90, 0xcb, 0xbc, 0xba, 0xaa, 0xcb, 0xcc, 0xbb,
+    0x8a, 0x51, 0x45, 0x33, 0x13, 0x81, 0x89, 0x09, 0x21, 0x22, 0xa8, 0xcf, 0xfc, 0xfc, 0x22, 0x00,
+    0xac, 0x9b, 0x20, 0x35, 0x44, 0x22, 0x22, 0x22, 0x33, 0x12, 0xc8, 0xcd, 0xbc, 0x9b, 0x09, 0x31,
+    0x43, 0x23, 0x33, 0x55, 0x53, 0x33, 0x13, 0x90, 0xdb, 0xbc, 0xbb, 0xab, 0x99, 0x88, 0x18, 0x42,
+    0x63, 0x33, 0x23, 0x11, 0x00, 0x10, 0x12, 0xb8, 0xff, 0xbd, 0xcb, 0x9a, 0x10, 0x42, 0x23, 0x01,
+    0x99, 0xaa, 0x18, 0x41, 0x12, 0xc9, 0xbf, 0xbd, 0xaa, 0x89, 0x10, 0x22, 0x33, 0x34, 0x34, 0x14,
+    0x91, 0xdc, 0xbc, 0xac, 0x9a, 0x00, 0x80, 0xb8, 0xbc, 0x9c, 0x31, 0x57, 0x43, 0x22, 0x01, 0x99,
+    0x9a, 0x99, 0x98, 0xb9, 0xce, 0xcb, 0xbb, 0x99, 0x00, 0x12, 0x32, 0x54, 0x45, 0x34, 0x33, 0x03,
+    0xb9, 0xcd, 0xaa, 0x09, 0x31, 0x22, 0x90, 0xbd, 0xac, 0x19, 0x53, 0x25, 0x12, 0x98, 0xcb, 0xab,
+    0x0a, 0x31, 0x33, 0x43, 0x32, 0x63, 0x34, 0x32, 0x00, 0xb9, 0x8a, 0x62, 0x44, 0x12, 0xda, 0xbf,
+    0x82, 0x01, 0x26, 0x00, 0xbd, 0xaa, 0x08, 0x21, 0x33, 0x12, 0x11, 0x42, 0x55, 0x34, 0x33, 0x02,
+    0xb9, 0xbe, 0xad, 0xab, 0xab, 0xab, 0x9a, 0x18, 0x53, 0x44, 0x32, 0x02, 0x80, 0x88, 0x28, 0x32,
+    0x13, 0xe9, 0xdd, 0xbb, 0xab, 0x18, 0x43, 0x32, 0x00, 0xb9, 0xac, 0x99, 0x10, 0x12, 0x99, 0xcd,
+    0xbc, 0xbc, 0xba, 0xaa, 0x28, 0x56, 0x46, 0x43, 0x33, 0x02, 0xa8, 0xbc, 0xbd, 0xbb, 0xbb, 0xbc,
+    0xbb, 0xac, 0x19, 0x63, 0x54, 0x43, 0x33, 0x23, 0x01, 0x90, 0xb9, 0xcc, 0xbb, 0xcb, 0x9a, 0x8a,
+    0x88, 0x80, 0x80, 0x21, 0x45, 0x45, 0x33, 0x33, 0x00, 0xa9, 0xac, 0x9b, 0x08, 0x10, 0x01, 0xa8,
+    0xa9, 0x11, 0x56, 0x34, 0x33, 0x02, 0xc9, 0xdd, 0xcc, 0xbc, 0xbc, 0xaa, 0x89, 0x41, 0x44, 0x34,
+    0x43, 0x22, 0x12, 0x00, 0x98, 0xca, 0xcc, 0xcc, 0xbb, 0xac, 0xaa, 0x88, 0x21, 0x34, 0x34, 0x33,
+    0x33, 0x11, 0x01, 0x98, 0x86, 0x01, 0x1b, 0x00, 0x99, 0xba, 0xdb, 0xbc, 0xcc, 0xba, 0xaa, 0x89,
+    0x21, 0x44, 0x34, 0x32, 0x81, 0xc9, 0xbc, 0xbc, 0xaa, 0x88, 0x01, 0x80, 0x00, 0x53, 0x67, 0x53,
+    0x24, 0x23, 0x81, 0xb9, 0xdc, 0xbb, 0xac, 0xaa, 0x9a, 0x89, 0x20, 0x54, 0x34, 0x34, 0x33, 0x22,
+    0x01, 0x00, 0x98, 0xca, 0xbd, 0xbd, 0xac, 0x89, 0x10, 0x33, 0x23, 0x01, 0x98, 0x09, 0x52, 0x44,
+    0x33, 0x01, 0xa9, 0xcb, 0xaa, 0xa8, 0xb8, 0xda, 0xbb, 0x88, 0x35, 0x36, 0x11, 0xba, 0xbf, 0xbc,
+    0x99, 0x00, 0x90, 0xd9, 0xdb, 0x9a, 0x41, 0x46, 0x43, 0x13, 0x81, 0xb9, 0xbc, 0xbb, 0xba, 0xba,
+    0xbc, 0xbc, 0xbb, 0x09, 0x31, 0x44, 0x33, 0x42, 0x42, 0x33, 0x34, 0x12, 0x90, 0xc9, 0xa9, 0x98,
+    0x91, 0xfa, 0xcd, 0xbd, 0xab, 0x8a, 0x21, 0x44, 0x32, 0x13, 0x11, 0x11, 0x11, 0x13, 0x00, 0x9a,
+    0xab, 0x60, 0x73, 0x34, 0x33, 0x12, 0x01, 0x80, 0x36, 0x01, 0x10, 0x00, 0xa9, 0xdc, 0xcd, 0xcc,
+    0xbb, 0x8a, 0x20, 0x44, 0x34, 0x24, 0x21, 0x11, 0x22, 0x33, 0x24, 0x02, 0xa8, 0xdc, 0xbc, 0xbb,
+    0xac, 0xba, 0xaa, 0xaa, 0x89, 0x11, 0x35, 0x35, 0x35, 0x33, 0x24, 0x12, 0x88, 0xbd, 0xcd, 0xbb,
+    0xab, 0x8a, 0x11, 0x14, 0x13, 0x01, 0xa9, 0xab, 0xbc, 0xcb, 0xcc, 0xcc, 0xbb, 0xbb, 0x08, 0x44,
+    0x44, 0x33, 0x12, 0x91, 0xb8, 0xbb, 0xcb, 0xba, 0xbc, 0xcc, 0xba, 0x99, 0x0a, 0x89, 0x8a, 0x9b,
+    0x49, 0x75, 0x35, 0x35, 0x33, 0x23, 0x12, 0x80, 0x99, 0xfb, 0xeb, 0xcb, 0xcb, 0x9a, 0x18, 0x42,
+    0x53, 0x33, 0x33, 0x24, 0x22, 0x23, 0x00, 0xb9, 0xdc, 0xcb, 0x99, 0x08, 0x21, 0x21, 0x00, 0x98,
+    0x18, 0x22, 0x33, 0xb1, 0xdf, 0xbc, 0x9a, 0x01, 0x34, 0x33, 0x00, 0x89, 0x51, 0x47, 0x35, 0x24,
+    0x11, 0xa8, 0xdb, 0xcb, 0xac, 0xbc, 0xbc, 0xad, 0xba, 0x89, 0x31, 0x35, 0x1c, 0xfe, 0x1e, 0x00,
+    0x35, 0x33, 0x33, 0x12, 0x02, 0xb9, 0xdc, 0xdb, 0xbb, 0xab, 0x89, 0x10, 0x22, 0x11, 0x00, 0x21,
+    0x11, 0x80, 0xea, 0xde, 0xbb, 0xaa, 0x10, 0x64, 0x53, 0x22, 0x11, 0x11, 0x00, 0x10, 0x12, 0x88,
+    0xab, 0xdd, 0xbc, 0xba, 0xca, 0xab, 0x9a, 0x89, 0x31, 0x67, 0x23, 0x34, 0x43, 0x12, 0x12, 0x01,
+    0xc9, 0xbc, 0xbd, 0xad, 0xaa, 0x80, 0x21, 0x44, 0x24, 0x22, 0x12, 0x01, 0xaa, 0xbb, 0xdd, 0xba,
+    0x89, 0x88, 0x20, 0x34, 0x13, 0x32, 0x14, 0xa8, 0xac, 0xfb, 0xbd, 0xaa, 0x89, 0x18, 0x54, 0x24,
+    0x21, 0x21, 0x91, 0xa9, 0x89, 0xda, 0xba, 0x90, 0xca, 0x9d, 0xb9, 0xfc, 0xaa, 0x99, 0xab, 0x19,
+    0x42, 0x32, 0x57, 0x33, 0x43, 0x24, 0x13, 0x80, 0xa8, 0xcd, 0xad, 0xab, 0xba, 0x9a, 0x18, 0x00,
+    0x30, 0x24, 0x11, 0x30, 0x23, 0x88, 0x72, 0x24, 0x23, 0x46, 0x33, 0x32, 0x43, 0x81, 0xca, 0xcb,
+    0x64, 0x02, 0x1c, 0x00, 0xdd, 0xbb, 0xab, 0xbb, 0x8b, 0x10, 0x00, 0x41, 0x34, 0x22, 0x62, 0x33,
+    0x22, 0x45, 0x34, 0x22, 0x24, 0x12, 0xa9, 0xbb, 0xcf, 0xbc, 0xcb, 0xbb, 0xac, 0x89, 0x08, 0x31,
+    0x36, 0x33, 0x43, 0x33, 0x10, 0x10, 0x81, 0xa9, 0x09, 0x91, 0x9b, 0x30, 0xc1, 0xcf, 0xba, 0xce,
+    0xac, 0x9a, 0xb9, 0x89, 0x22, 0x23, 0x55, 0x44, 0x12, 0x32, 0x12, 0xa8, 0x89, 0xa9, 0xbb, 0x09,
+    0xb8, 0xbf, 0xaa, 0xeb, 0xbc, 0x9a, 0xbb, 0xac, 0x11, 0x43, 0x55, 0x35, 0x14, 0x23, 0x23, 0x88,
+    0x99, 0xda, 0xbd, 0xac, 0xba, 0xbb, 0x09, 0x01, 0x20, 0x43, 0x12, 0x10, 0x34, 0x23, 0x41, 0x45,
+    0x13, 0x53, 0x34, 0x13, 0x21, 0x91, 0xdd, 0xcb, 0xcb, 0xbc, 0xaa, 0xa9, 0xa9, 0x10, 0x23, 0x43,
+    0x35, 0x14, 0x21, 0x32, 0x13, 0x42, 0x35, 0x12, 0x11, 0x82, 0xfa, 0xbb, 0xdc, 0xcc, 0xab, 0xbb,
+    0xac, 0x8a, 0x10, 0x21, 0x0a, 0xfb, 0x1d, 0x00, 0x35, 0x25, 0x31, 0x42, 0x12, 0x10, 0x22, 0x01,
+    0x10, 0x43, 0x81, 0x19, 0x98, 0xcf, 0xbc, 0xca, 0xbc, 0x9b, 0x98, 0x09, 0x62, 0x34, 0x42, 0x34,
+    0x23, 0x01, 0x01, 0xa8, 0xbb, 0x9a, 0xd9, 0x8a, 0x01, 0xc9, 0xab, 0xd9, 0xdd, 0xbb, 0xbb, 0xbd,
+    0x9a, 0x80, 0x10, 0x73, 0x24, 0x22, 0x43, 0x02, 0x88, 0x89, 0xda, 0xbb, 0x99, 0xa9, 0x09, 0x25,
+    0x00, 0x18, 0x13, 0xc9, 0x2a, 0x34, 0x10, 0x66, 0x24, 0x22, 0x53, 0x12, 0x00, 0x08, 0xca, 0xae,
+    0xaa, 0xca, 0x99, 0x21, 0x21, 0x41, 0x24, 0x81, 0x89, 0xb8, 0xce, 0x9a, 0x89, 0x89, 0x62, 0x33,
+    0x23, 0x33, 0xa1, 0xce, 0xbb, 0xcd, 0xac, 0xaa, 0x9a, 0x89, 0x32, 0x34, 0x53, 0x33, 0x80, 0xa9,
+    0xda, 0xbc, 0x9b, 0x9a, 0x8a, 0x21, 0x13, 0x12, 0x81, 0xed, 0xad, 0xbb, 0xbc, 0x19, 0x51, 0x63,
+    0x53, 0x43, 0x43, 0x32, 0x23, 0x02, 0x01, 0x88, 0xd2, 0x02, 0x17, 0x00, 0x09, 0x11, 0x33, 0x46,
+    0x33, 0x23, 0x22, 0xa1, 0xea, 0xb9, 0xcc, 0xab, 0x88, 0x88, 0x31, 0x26, 0x90, 0xb9, 0xfc, 0xdc,
+    0xbb, 0xbc, 0xcc, 0xaa, 0xba, 0xba, 0x99, 0xba, 0xbc, 0xaa, 0xdc, 0xab, 0x98, 0x98, 0x31, 0x37,
+    0x34, 0x63, 0x33, 0x23, 0x33, 0x13, 0x00, 0x30, 0x22, 0x50, 0x55, 0x24, 0x42, 0x53, 0x12, 0x22,
+    0x22, 0x01, 0x88, 0x11, 0xa9, 0x29, 0x24, 0xa8, 0x18, 0xc0, 0xef, 0xab, 0xeb, 0xbc, 0xab, 0xdb,
+    0xab, 0xaa, 0xb9, 0xab, 0x99, 0xea, 0xab, 0x99, 0xdb, 0x8b, 0x08, 0xa9, 0x38, 0x35, 0x11, 0x72,
+    0x13, 0x08, 0x41, 0x13, 0x20, 0x65, 0x33, 0x53, 0x44, 0x23, 0x33, 0x44, 0x11, 0x11, 0x12, 0x80,
+    0x08, 0x13, 0x88, 0x38, 0x04, 0xcc, 0x9a, 0xc9, 0xce, 0xaa, 0xcb, 0xad, 0x9a, 0xa9, 0xab, 0x09,
+    0xca, 0xac, 0xa8, 0xcd, 0x9c, 0x99, 0xbb, 0x8c, 0x98, 0xba, 0x09, 0x02, 0xab, 0xf5, 0x1b, 0x00,
+    0x99, 0x51, 0x82, 0xab, 0x64, 0x24, 0x43, 0x36, 0x14, 0x23, 0x35, 0x12, 0x11, 0x13, 0x80, 0x28,
+    0x22, 0xb9, 0x48, 0x36, 0x12, 0x33, 0x14, 0x98, 0x89, 0xfa, 0xad, 0x9a, 0xca, 0xac, 0x88, 0xb8,
+    0x9b, 0x99, 0xec, 0x9b, 0xa9, 0xdc, 0xbb, 0xba, 0xbd, 0x89, 0x08, 0xaa, 0x19, 0x33, 0x33, 0x44,
+    0x33, 0x55, 0x45, 0x12, 0x21, 0x23, 0x81, 0x09, 0x21, 0xb8, 0xac, 0x09, 0x99, 0x68, 0x46, 0x34,
+    0x43, 0x33, 0x11, 0x11, 0x81, 0xda, 0xbb, 0xba, 0xba, 0xcc, 0xbb, 0x1a, 0x23, 0xc8, 0xab, 0xea,
+    0xef, 0xab, 0xaa, 0xba, 0xbb, 0x9a, 0x9a, 0x09, 0x63, 0x53, 0x42, 0x22, 0x21, 0x32, 0x11, 0x88,
+    0xa9, 0xb9, 0x9a, 0xfb, 0xcf, 0x09, 0x01, 0x90, 0x52, 0x36, 0x12, 0x32, 0x45, 0x12, 0x12, 0x01,
+    0xa8, 0x9a, 0xba, 0xbb, 0x99, 0xcd, 0x0a, 0x45, 0x80, 0xa9, 0x98, 0xbe, 0x8b, 0xb9, 0xdf, 0x8a,
+    0xf5, 0xfb, 0x2b, 0x00, 0x01, 0x99, 0x20, 0x35, 0x10, 0x53, 0x13, 0x89, 0x08, 0xea, 0xad, 0x89,
+    0xca, 0xab, 0x98, 0xdc, 0x8a, 0x32, 0x02, 0x30, 0x34, 0x11, 0x56, 0x23, 0x01, 0x41, 0x13, 0x88,
+    0x00, 0xfa, 0xac, 0x20, 0x91, 0xbb, 0x20, 0xc8, 0xac, 0x32, 0x03, 0x89, 0x01, 0xeb, 0x9b, 0x42,
+    0x53, 0x53, 0x23, 0x52, 0x43, 0x80, 0x9a, 0x00, 0xea, 0x9b, 0x88, 0xde, 0xac, 0x08, 0x01, 0x99,
+    0x10, 0x13, 0x99, 0x28, 0x35, 0x92, 0x8a, 0x73, 0x13, 0x98, 0x08, 0xc8, 0xbe, 0x18, 0x82, 0xce,
+    0x9b, 0x08, 0xaa, 0x09, 0x63, 0x12, 0x88, 0x61, 0x24, 0xa8, 0x0b, 0x54, 0x01, 0x09, 0x33, 0xa1,
+    0xae, 0x28, 0x12, 0x88, 0x11, 0xf9, 0x9c, 0x30, 0x23, 0x00, 0x52, 0x44, 0x12, 0x80, 0x09, 0x10,
+    0x80, 0x61, 0x14, 0xfa, 0xab, 0x08, 0xa0, 0x9b, 0x88, 0xfb, 0xad, 0x99, 0xaa, 0x0a, 0x32, 0x03,
+    0x30, 0x47, 0x13, 0x80, 0xd0, 0x01, 0x28, 0x00, 0x18, 0x34, 0x13, 0xca, 0xdb, 0xcc, 0xab, 0x09,
+    0x91, 0xbc, 0x09, 0x11, 0x88, 0x62, 0x33, 0x22, 0x56, 0x24, 0x01, 0x88, 0x10, 0x12, 0x88, 0x62,
+    0x33, 0xb9, 0x8c, 0x33, 0xa1, 0xac, 0x88, 0xee, 0xbc, 0xa9, 0xdb, 0xac, 0x18, 0x21, 0x11, 0x43,
+    0x23, 0x81, 0x31, 0x35, 0xa2, 0xde, 0xbb, 0xbb, 0xcd, 0xaa, 0x88, 0x99, 0x89, 0x22, 0xb0, 0x9c,
+    0x30, 0x22, 0x41, 0x26, 0xa0, 0x9c, 0x40, 0x34, 0x22, 0x32, 0x23, 0x80, 0xa9, 0x30, 0x36, 0x23,
+    0x41, 0x35, 0x82, 0x99, 0xaa, 0x9a, 0x73, 0x26, 0x01, 0x10, 0x44, 0x53, 0x54, 0x33, 0x12, 0x00,
+    0x81, 0xb8, 0xcd, 0xcb, 0xcb, 0x9a, 0x98, 0xaa, 0x8a, 0x30, 0x44, 0x33, 0x44, 0x22, 0xa0, 0xab,
+    0x18, 0x92, 0xcc, 0x28, 0x14, 0xb9, 0x28, 0x26, 0xa9, 0x28, 0x37, 0x80, 0xa9, 0xa9, 0xcc, 0x1a,
+    0x45, 0x03, 0x98, 0x28, 0x54, 0x12, 0x41, 0x45, 0x9b, 0x16, 0x30, 0x00, 0x33, 0x11, 0x33, 0x14,
+    0xba, 0x09, 0x01, 0xec, 0xac, 0xcb, 0xcc, 0xaa, 0x08, 0x00, 0x88, 0x11, 0x81, 0x98, 0x20, 0x13,
+    0xfc, 0xbc, 0x9a, 0xeb, 0xbd, 0x8a, 0x98, 0x98, 0x08, 0x00, 0xdb, 0xab, 0xa9, 0xdb, 0xcb, 0xcb,
+    0xcc, 0xab, 0x8a, 0x80, 0x00, 0x41, 0x36, 0x33, 0x21, 0x33, 0x12, 0x08, 0x62, 0x12, 0xca, 0x9b,
+    0x80, 0x00, 0x11, 0x12, 0x21, 0x35, 0x92, 0x09, 0x74, 0x33, 0x34, 0x36, 0x34, 0x12, 0x80, 0xaa,
+    0x10, 0x13, 0xd9, 0xcc, 0xaa, 0x99, 0x31, 0x36, 0x43, 0x23, 0x11, 0x88, 0xd9, 0xde, 0x9b, 0x09,
+    0x90, 0x9a, 0x19, 0x34, 0x45, 0x45, 0x23, 0x23, 0x11, 0x81, 0x89, 0x88, 0x88, 0x99, 0x08, 0x63,
+    0x34, 0x43, 0x63, 0x34, 0x33, 0x24, 0x33, 0x80, 0x9a, 0x31, 0x24, 0x90, 0xab, 0x8a, 0x31, 0x34,
+    0x12, 0x31, 0x65, 0x34, 0x13, 0xb8, 0xbb, 0xcc, 0xcd, 0xbb, 0xcb, 0xdc, 0x48, 0x14, 0x2d, 0x00,
+    0xab, 0x99, 0x99, 0x09, 0x20, 0x01, 0x99, 0x9a, 0xdb, 0xdd, 0xbc, 0xac, 0x99, 0xa8, 0xdb, 0xbb,
+    0x9a, 0x10, 0x01, 0xea, 0xcb, 0x99, 0xca, 0xbb, 0x89, 0x98, 0x88, 0x21, 0x91, 0xeb, 0xcb, 0xaa,
+    0x19, 0xa0, 0xcf, 0xaa, 0xa9, 0xab, 0x41, 0x23, 0xfa, 0xbc, 0xbc, 0xdb, 0xba, 0xbc, 0x9b, 0x10,
+    0x33, 0x23, 0x23, 0x44, 0x45, 0x12, 0x80, 0x98, 0xca, 0xbe, 0x8a, 0x00, 0x98, 0x38, 0x36, 0x13,
+    0x80, 0x18, 0x98, 0xbb, 0x50, 0x24, 0x81, 0x20, 0x54, 0x44, 0x45, 0x43, 0x12, 0x10, 0x22, 0x02,
+    0x98, 0x40, 0x44, 0x33, 0x43, 0x24, 0x82, 0x00, 0x32, 0x33, 0x00, 0x08, 0xb9, 0xad, 0x48, 0x44,
+    0x44, 0x35, 0x34, 0x22, 0x42, 0x23, 0x11, 0x41, 0x34, 0x25, 0x12, 0x00, 0x88, 0x21, 0x33, 0x01,
+    0x80, 0xc9, 0xbe, 0xbb, 0xbb, 0xbc, 0x9b, 0x18, 0x11, 0xb8, 0xcc, 0x19, 0x47, 0x44, 0x53, 0x22,
+    0xcc, 0x1d, 0x27, 0x00, 0x01, 0x09, 0x00, 0x80, 0xdb, 0xdd, 0xcc, 0xba, 0xaa, 0xbc, 0xac, 0x99,
+    0x88, 0x99, 0x98, 0xba, 0xab, 0x10, 0x13, 0xa1, 0xde, 0xcb, 0x09, 0x00, 0xa9, 0xba, 0xfb, 0xcc,
+    0xaa, 0xbb, 0xce, 0x9a, 0x99, 0xaa, 0xaa, 0xdb, 0xbd, 0x8a, 0x21, 0x80, 0x89, 0xb9, 0xdb, 0x18,
+    0x23, 0x90, 0x09, 0x12, 0xdc, 0xcc, 0xdc, 0xcb, 0x09, 0x32, 0x02, 0x90, 0xba, 0x9b, 0x71, 0x34,
+    0x12, 0x12, 0xa8, 0xcc, 0x9a, 0xa8, 0x99, 0x73, 0x35, 0x02, 0x88, 0x9a, 0x19, 0x65, 0x35, 0x33,
+    0x01, 0x88, 0x10, 0x23, 0x33, 0x54, 0x22, 0x88, 0x10, 0x91, 0xce, 0x39, 0x57, 0x12, 0x00, 0x11,
+    0x90, 0x8b, 0x73, 0x23, 0x10, 0x31, 0x23, 0x00, 0x52, 0x33, 0x21, 0x55, 0x12, 0x98, 0xca, 0xdb,
+    0x8a, 0x42, 0x22, 0x21, 0x23, 0x91, 0x19, 0x47, 0x03, 0x09, 0x42, 0x03, 0xfb, 0x9a, 0x80, 0x99,
+    0x19, 0x44, 0xa1, 0xce, 0x03, 0x15, 0x2e, 0x00, 0x9a, 0x00, 0xa8, 0x1a, 0x53, 0xa1, 0x8c, 0x62,
+    0x82, 0xaa, 0x51, 0x02, 0xeb, 0x8a, 0x98, 0xcd, 0x0a, 0x00, 0xc9, 0x9b, 0x88, 0xa9, 0x09, 0x11,
+    0xa0, 0x9b, 0x99, 0xcc, 0x19, 0x02, 0xbc, 0x2a, 0x83, 0xff, 0x9a, 0x00, 0xc9, 0xab, 0x88, 0xfc,
+    0xac, 0x8a, 0x98, 0xbb, 0x8a, 0x01, 0xdb, 0x8b, 0x64, 0x12, 0x80, 0x42, 0x14, 0xca, 0x9b, 0x00,
+    0xda, 0x8b, 0x31, 0xb0, 0xae, 0x10, 0x01, 0x09, 0x55, 0x23, 0x88, 0x98, 0xcc, 0xab, 0x89, 0x10,
+    0x73, 0x34, 0x02, 0x20, 0x24, 0x98, 0x58, 0x36, 0x01, 0x8a, 0x11, 0xb9, 0x9f, 0x30, 0x24, 0x02,
+    0x42, 0x24, 0x90, 0x99, 0x43, 0x13, 0x98, 0x51, 0x13, 0xec, 0x0a, 0x23, 0xa1, 0x1b, 0x37, 0x92,
+    0x9b, 0x64, 0x14, 0x88, 0x31, 0x24, 0xb8, 0x8a, 0x11, 0xd9, 0xac, 0x09, 0xa0, 0xbe, 0x8a, 0x01,
+    0x88, 0x29, 0x34, 0x12, 0x88, 0x11, 0xa0, 0xcd, 0x81, 0x0e, 0x27, 0x00, 0x9a, 0x21, 0x12, 0x21,
+    0x44, 0xa1, 0xce, 0x9a, 0x98, 0xda, 0xbc, 0xbb, 0xbf, 0xbd, 0xac, 0xa9, 0x88, 0x08, 0x32, 0x33,
+    0x22, 0x73, 0x45, 0x12, 0x00, 0x00, 0xc8, 0xcd, 0xab, 0xba, 0xcc, 0xaa, 0x99, 0x98, 0x19, 0x44,
+    0x24, 0x22, 0x33, 0x13, 0xa9, 0xab, 0xba, 0xcd, 0xbc, 0xaa, 0x08, 0x32, 0x36, 0x44, 0x22, 0x90,
+    0x08, 0x80, 0xea, 0x9b, 0x80, 0xea, 0xab, 0x31, 0x35, 0x73, 0x44, 0x22, 0x01, 0x11, 0x80, 0x9a,
+    0x9a, 0xa8, 0xdb, 0xac, 0x8a, 0x89, 0x89, 0x61, 0x45, 0x22, 0x42, 0x35, 0x02, 0x88, 0x10, 0x91,
+    0xcc, 0x19, 0x81, 0xda, 0xab, 0x89, 0x99, 0x20, 0x45, 0x34, 0x82, 0xca, 0x9b, 0x18, 0x80, 0x18,
+    0x43, 0xf9, 0xbe, 0x8b, 0x32, 0x35, 0x43, 0x22, 0xb8, 0xcf, 0x9b, 0x08, 0x12, 0x11, 0x11, 0xe8,
+    0xce, 0x9a, 0x10, 0x22, 0x33, 0x24, 0xa0, 0xbe, 0xaa, 0x09, 0x21, 0x53, 0x08, 0x01, 0x34, 0x00,
+    0x12, 0xa8, 0xcc, 0xac, 0x9a, 0x20, 0x22, 0x33, 0x01, 0xc9, 0xbc, 0x9b, 0x88, 0x21, 0x11, 0x08,
+    0x82, 0xfc, 0xab, 0x18, 0xb9, 0x2a, 0x77, 0x02, 0x99, 0x22, 0xa1, 0xbe, 0x09, 0x02, 0x99, 0x42,
+    0x15, 0x88, 0x18, 0x98, 0x1a, 0x37, 0x03, 0x00, 0x54, 0xa1, 0xcc, 0x08, 0x12, 0x88, 0x30, 0x37,
+    0x82, 0xcb, 0x8a, 0x32, 0x01, 0x20, 0x67, 0x02, 0xba, 0x19, 0x23, 0x90, 0x50, 0x35, 0x92, 0xbb,
+    0x9a, 0x99, 0x18, 0x43, 0x21, 0x32, 0xe8, 0xbd, 0x39, 0x26, 0x88, 0x40, 0x14, 0xb9, 0x8c, 0x23,
+    0xa1, 0x8b, 0x43, 0xc1, 0xbb, 0x09, 0x99, 0x28, 0x92, 0xcf, 0x08, 0x81, 0xce, 0x19, 0x81, 0xeb,
+    0x09, 0x13, 0xb9, 0x9a, 0x88, 0xcc, 0x19, 0x01, 0x8a, 0x31, 0xfa, 0xff, 0x89, 0x88, 0x80, 0x11,
+    0x01, 0xb9, 0xeb, 0xbb, 0x2a, 0x43, 0x01, 0x21, 0xb3, 0xff, 0xab, 0x20, 0x80, 0x10, 0x24, 0xa0,
+    0x6b, 0xed, 0x2f, 0x00, 0xcd, 0x89, 0x88, 0x00, 0x43, 0x14, 0xa0, 0xba, 0x9b, 0x99, 0x09, 0x62,
+    0x14, 0x80, 0xa9, 0x89, 0x08, 0x20, 0x44, 0x44, 0x23, 0x81, 0x10, 0x23, 0xc9, 0x8c, 0x73, 0x13,
+    0x10, 0x62, 0x13, 0x80, 0x88, 0x18, 0x54, 0x22, 0x21, 0x44, 0x02, 0xb9, 0x29, 0x35, 0x22, 0x65,
+    0x33, 0x02, 0x80, 0x89, 0x09, 0x11, 0x32, 0x74, 0x23, 0xb0, 0xad, 0x00, 0x88, 0x40, 0x46, 0x13,
+    0x98, 0x88, 0x98, 0x8a, 0x41, 0x44, 0x13, 0xb8, 0xcd, 0x9a, 0x98, 0x89, 0x51, 0x14, 0xc9, 0xbb,
+    0x9b, 0x99, 0x88, 0x63, 0x13, 0xfb, 0xbb, 0xaa, 0x98, 0x99, 0x41, 0x02, 0xfb, 0xbc, 0xbb, 0xaa,
+    0x18, 0x11, 0xa8, 0xbb, 0xde, 0xad, 0x8a, 0x08, 0x00, 0x80, 0xa9, 0xdd, 0xbb, 0xab, 0x8a, 0x31,
+    0x80, 0xab, 0xda, 0xdd, 0xcb, 0x19, 0x22, 0x80, 0x00, 0x90, 0xdb, 0xac, 0x89, 0x12, 0x23, 0x23,
+    0xda, 0xbd, 0xbc, 0x8a, 0x88, 0xe3, 0x23, 0x00, 0x41, 0x53, 0x32, 0x81, 0x89, 0xab, 0x09, 0x54,
+    0x45, 0x24, 0x81, 0x89, 0x98, 0x99, 0x38, 0x56, 0x23, 0x21, 0x11, 0xa8, 0x09, 0x45, 0x43, 0x23,
+    0x33, 0x03, 0x99, 0x52, 0x34, 0x54, 0x34, 0x12, 0x01, 0x01, 0x02, 0x10, 0x44, 0x03, 0x89, 0x43,
+    0x23, 0x53, 0x46, 0x34, 0x01, 0x10, 0x01, 0x08, 0x52, 0x43, 0x12, 0x01, 0x88, 0xcb, 0x9a, 0x21,
+    0x63, 0x24, 0x81, 0x08, 0x11, 0x80, 0x42, 0x57, 0x02, 0xb8, 0xa9, 0xca, 0xbc, 0x89, 0x42, 0x23,
+    0x98, 0x10, 0x98, 0xde, 0xac, 0x9a, 0xba, 0xbd, 0xac, 0xbb, 0x99, 0x80, 0x10, 0x44, 0x12, 0xea,
+    0xac, 0xaa, 0xbc, 0x9c, 0x08, 0xa0, 0xdd, 0xbb, 0xbb, 0xcd, 0xab, 0x08, 0x90, 0xba, 0x8a, 0xb0,
+    0xbd, 0x38, 0x15, 0xc8, 0xbb, 0xdc, 0xdc, 0xab, 0x88, 0x10, 0x10, 0x02, 0xa8, 0xdb, 0xbc, 0xac,
+    0x99, 0xc9, 0xac, 0x8a, 0xb9, 0x8c, 0x52, 0x24, 0x91, 0xdd, 0x2a, 0x00, 0x11, 0x11, 0x80, 0xbb,
+    0x1a, 0x23, 0x32, 0x26, 0xb0, 0xbe, 0xbc, 0xac, 0x09, 0x43, 0x02, 0x42, 0x37, 0x12, 0x52, 0x35,
+    0x23, 0x00, 0x10, 0xa8, 0xcc, 0x09, 0x53, 0x33, 0x34, 0x44, 0x33, 0x01, 0x18, 0x42, 0x02, 0x99,
+    0x51, 0x23, 0x88, 0x72, 0x36, 0x21, 0x31, 0x34, 0x01, 0x00, 0x31, 0x22, 0x33, 0x24, 0x11, 0x81,
+    0xc9, 0xbd, 0x20, 0x23, 0x28, 0x67, 0x24, 0x11, 0x42, 0x24, 0x82, 0x88, 0x99, 0xdc, 0xbb, 0xab,
+    0x88, 0x21, 0x21, 0x22, 0x23, 0xea, 0xad, 0x99, 0xda, 0xad, 0x9a, 0xb8, 0xcb, 0x08, 0x22, 0x90,
+    0x88, 0xb9, 0xdf, 0xcb, 0xab, 0xab, 0xbc, 0xcb, 0xaa, 0xdc, 0xcc, 0x9a, 0xa9, 0xcb, 0x89, 0x00,
+    0x98, 0x19, 0x22, 0xb0, 0xbd, 0xba, 0xde, 0xbc, 0xba, 0xbb, 0xbb, 0x9a, 0x89, 0x08, 0x90, 0xdc,
+    0xab, 0xdb, 0xcc, 0x9a, 0x88, 0x98, 0x18, 0x44, 0x02, 0x10, 0x42, 0x02, 0x39, 0xd5, 0x23, 0x00,
+    0xba, 0x8b, 0x22, 0x98, 0x2a, 0x57, 0x03, 0xb8, 0x0b, 0x22, 0xd9, 0x2a, 0x77, 0x14, 0x21, 0x53,
+    0x33, 0x22, 0x31, 0x33, 0x82, 0xa9, 0x30, 0x24, 0x23, 0x65, 0x44, 0x23, 0x11, 0x42, 0x23, 0x81,
+    0x18, 0x44, 0x12, 0x31, 0x46, 0x24, 0x22, 0x23, 0x23, 0x12, 0x11, 0x21, 0x35, 0x23, 0x11, 0x43,
+    0x14, 0x90, 0x28, 0x25, 0x91, 0x8a, 0x52, 0x24, 0x33, 0x47, 0x33, 0x01, 0x80, 0x80, 0xca, 0xbc,
+    0x9b, 0xba, 0xcc, 0x9a, 0x10, 0x80, 0x98, 0xb0, 0xee, 0xcc, 0xab, 0xba, 0xaa, 0x8a, 0x99, 0xb9,
+    0xcc, 0xac, 0xa9, 0xda, 0xdb, 0xcb, 0xcb, 0xac, 0xab, 0xaa, 0xba, 0xbc, 0xcc, 0xdb, 0xab, 0xab,
+    0x9a, 0x8a, 0x9a, 0xcb, 0xba, 0xcb, 0xcb, 0xbb, 0xcb, 0xcd, 0xdb, 0xba, 0xaa, 0x9a, 0x8a, 0x99,
+    0xb9, 0xab, 0xcc, 0xbc, 0xaa, 0xba, 0xbc, 0x9a, 0x00, 0xba, 0x59, 0x26, 0x90, 0x9b, 0x20, 0xa2,
+    0xe8, 0xd7, 0x1a, 0x00, 0xaf, 0x38, 0x24, 0x00, 0x08, 0x52, 0x13, 0x10, 0x53, 0x45, 0x33, 0x20,
+    0x54, 0x34, 0x12, 0x32, 0x55, 0x13, 0x01, 0x31, 0x43, 0x01, 0x09, 0x63, 0x33, 0x32, 0x45, 0x44,
+    0x13, 0x11, 0x33, 0x32, 0x22, 0x52, 0x35, 0x23, 0x22, 0x33, 0x35, 0x14, 0x21, 0x36, 0x12, 0x11,
+    0x08, 0x42, 0x01, 0x51, 0x35, 0x32, 0x11, 0x28, 0x33, 0x88, 0x63, 0x33, 0x33, 0x82, 0x30, 0x14,
+    0x51, 0x25, 0x88, 0x81, 0xee, 0xaa, 0x9a, 0x10, 0x00, 0x51, 0x04, 0xca, 0x99, 0x98, 0x90, 0xbc,
+    0x10, 0xfa, 0xbd, 0xa9, 0x89, 0x81, 0x9a, 0x80, 0xfc, 0xcb, 0xbb, 0x0a, 0xa8, 0xab, 0x88, 0xbc,
+    0xcd, 0xac, 0x09, 0xb8, 0xbc, 0xcb, 0xbb, 0xdc, 0xaa, 0x11, 0x81, 0xa9, 0xcc, 0xbb, 0xed, 0x9b,
+    0x89, 0x98, 0xa8, 0x9a, 0x00, 0xb9, 0x9c, 0x89, 0x88, 0xfa, 0xae, 0x89, 0xa9, 0xba, 0x8a, 0x43,
+    0xd8, 0xac, 0x21, 0xa8, 0xe7, 0xdb, 0x24, 0x00, 0xac, 0x19, 0x33, 0xb8, 0x3a, 0x37, 0x22, 0x01,
+    0x0a, 0x23, 0xfc, 0x8a, 0x11, 0x33, 0x14, 0x72, 0x25, 0x81, 0x21, 0x10, 0x11, 0xb9, 0x59, 0x24,
+    0x31, 0x46, 0x42, 0x33, 0x01, 0x53, 0x02, 0x10, 0x11, 0x41, 0x03, 0x0a, 0x55, 0x11, 0x43, 0x22,
+    0x63, 0x02, 0x18, 0x23, 0x43, 0x35, 0x20, 0x45, 0x82, 0x18, 0x01, 0x20, 0x92, 0x8b, 0x34, 0x90,
+    0x20, 0x52, 0x57, 0x82, 0x28, 0x13, 0xb9, 0x99, 0x09, 0x53, 0x81, 0x63, 0x12, 0x20, 0x82, 0x8b,
+    0x14, 0xfb, 0xaa, 0xcc, 0xab, 0xcb, 0x8a, 0x01, 0x00, 0x11, 0x8a, 0x43, 0xe9, 0x19, 0x84, 0xaa,
+    0xc9, 0xad, 0xb9, 0xcd, 0x89, 0xc9, 0xab, 0xcd, 0xab, 0xa9, 0xad, 0x10, 0x90, 0x98, 0xa9, 0x89,
+    0xea, 0x8c, 0x81, 0xa9, 0x99, 0xbd, 0x09, 0xea, 0x8b, 0x92, 0xcb, 0xdc, 0xac, 0xaa, 0xcc, 0x8a,
+    0x90, 0x89, 0x98, 0x38, 0x15, 0x10, 0x46, 0x01, 0x30, 0xed, 0x2b, 0x00, 0x08, 0xa8, 0x9b, 0xcb,
+    0x9c, 0x91, 0xbb, 0x99, 0xbf, 0x09, 0xa8, 0x48, 0x14, 0x11, 0x12, 0x8a, 0x53, 0x22, 0x55, 0x22,
+    0x52, 0x81, 0x1a, 0x24, 0x88, 0x42, 0x01, 0x80, 0xfb, 0x0a, 0x00, 0x19, 0x23, 0x50, 0x16, 0xa9,
+    0x71, 0x14, 0x21, 0x43, 0x24, 0x82, 0x08, 0x23, 0x90, 0x09, 0x90, 0x8a, 0xf8, 0x9c, 0x41, 0x02,
+    0x21, 0x44, 0x34, 0x80, 0x48, 0x25, 0x80, 0x20, 0x21, 0x12, 0xa8, 0x72, 0x14, 0x00, 0x01, 0x08,
+    0xb8, 0xcd, 0x09, 0xa8, 0x9b, 0x99, 0x19, 0x13, 0x39, 0x77, 0x02, 0x21, 0x13, 0x08, 0x21, 0x02,
+    0xd9, 0x9c, 0xb8, 0xef, 0x8a, 0x98, 0xba, 0x9a, 0xaa, 0xa9, 0xba, 0x09, 0x64, 0x02, 0xba, 0x49,
+    0xa1, 0xdf, 0x19, 0x81, 0xba, 0x9a, 0x98, 0xdb, 0xaa, 0x99, 0x80, 0xfa, 0xaf, 0x8a, 0xa9, 0xbc,
+    0x18, 0x13, 0xc9, 0x09, 0x12, 0x01, 0x98, 0x62, 0x23, 0xfb, 0xbc, 0x88, 0xb8, 0xf1, 0x2a, 0x00,
+    0xb9, 0xae, 0x10, 0x81, 0xcb, 0x9a, 0x28, 0x91, 0xab, 0x73, 0x05, 0xba, 0x19, 0x33, 0xa1, 0x29,
+    0x47, 0x90, 0xab, 0x88, 0x20, 0x91, 0x1a, 0x47, 0x90, 0xbc, 0x28, 0x13, 0xba, 0x71, 0x15, 0xa9,
+    0x18, 0x22, 0x21, 0x54, 0x43, 0x12, 0x08, 0x89, 0x89, 0x89, 0x28, 0x33, 0xb0, 0x0c, 0x32, 0x43,
+    0x74, 0x54, 0x23, 0x98, 0x18, 0x12, 0xca, 0x39, 0x57, 0x80, 0x09, 0x21, 0x91, 0x9b, 0x52, 0x23,
+    0x88, 0x89, 0x08, 0x02, 0xdc, 0x68, 0x35, 0xa9, 0x1a, 0x25, 0xea, 0x09, 0x33, 0xb8, 0x29, 0x14,
+    0xa9, 0x09, 0x90, 0x0b, 0x25, 0xe8, 0x1b, 0x34, 0xe9, 0x1b, 0x35, 0xa8, 0x1b, 0x24, 0xd9, 0x8b,
+    0x01, 0xca, 0x09, 0x12, 0x99, 0x20, 0x80, 0x1a, 0x12, 0x88, 0x64, 0x83, 0xcd, 0x8b, 0x81, 0xdc,
+    0x1b, 0x34, 0xa1, 0xae, 0x18, 0x91, 0xcc, 0x19, 0x35, 0xa1, 0xac, 0x20, 0x83, 0xcd, 0x38, 0x25,
+    0xf7, 0x05, 0x2e, 0x00, 0xb8, 0xac, 0x11, 0xb0, 0xae, 0x30, 0x14, 0xc9, 0x9a, 0x00, 0x98, 0xbc,
+    0x50, 0x26, 0xc8, 0x8b, 0x52, 0xb0, 0x9c, 0x53, 0x92, 0xac, 0x19, 0x82, 0xbc, 0x2a, 0x43, 0x90,
+    0xac, 0x10, 0x02, 0xda, 0x39, 0x36, 0xb0, 0x9d, 0x31, 0xb0, 0x9d, 0x53, 0x81, 0xab, 0x18, 0x81,
+    0xbc, 0x29, 0x26, 0x90, 0xab, 0x31, 0x92, 0xac, 0x71, 0x14, 0xb0, 0x8a, 0x32, 0xb0, 0x8d, 0x62,
+    0x02, 0xaa, 0x09, 0x13, 0xb9, 0x29, 0x47, 0x81, 0x8a, 0x20, 0x91, 0x18, 0x35, 0x22, 0x11, 0xb8,
+    0x8c, 0x32, 0x92, 0x50, 0x27, 0xa1, 0x9a, 0x42, 0x03, 0x18, 0x47, 0x82, 0xaa, 0x20, 0x81, 0xab,
+    0x72, 0x13, 0xb8, 0x9a, 0x20, 0x01, 0xba, 0x71, 0x27, 0xb8, 0xab, 0x53, 0x83, 0xbb, 0x70, 0x15,
+    0xca, 0x0a, 0x32, 0xc8, 0xab, 0x41, 0x82, 0xcd, 0x1a, 0x32, 0xb8, 0x8d, 0x52, 0x81, 0xac, 0x38,
+    0x13, 0xca, 0x0b, 0x34, 0xc7, 0x0a, 0x2c, 0x00, 0xc8, 0xad, 0x20, 0x91, 0xcb, 0x8a, 0x21, 0xd8,
+    0xac, 0x31, 0x02, 0xbc, 0x29, 0x14, 0xba, 0x0a, 0x21, 0xa1, 0xca, 0x9b, 0x8a, 0xa9, 0xde, 0x9b,
+    0x11, 0xfa, 0xad, 0x10, 0x90, 0xbb, 0x31, 0x84, 0xa9, 0x28, 0x34, 0x12, 0x90, 0x21, 0x02, 0xef,
+    0x9b, 0x18, 0xc9, 0x9c, 0x10, 0xb0, 0x9e, 0x30, 0x03, 0x29, 0x54, 0x81, 0x18, 0x22, 0xb8, 0x40,
+    0x25, 0xa9, 0x09, 0x12, 0xa8, 0x8a, 0x72, 0x26, 0x91, 0x9b, 0x71, 0x02, 0xcb, 0x38, 0x27, 0xb0,
+    0x0b, 0x45, 0x82, 0x8a, 0x72, 0x12, 0x98, 0x19, 0x32, 0xa1, 0xbb, 0x48, 0x13, 0xeb, 0x8b, 0x54,
+    0x82, 0x99, 0x73, 0x13, 0xa8, 0x30, 0x15, 0xa0, 0x08, 0x13, 0xb0, 0xac, 0x10, 0x12, 0x80, 0x09,
+    0x56, 0x03, 0xa9, 0x40, 0x26, 0xa8, 0x0b, 0x33, 0xd0, 0xad, 0x28, 0x23, 0xa9, 0x0a, 0x45, 0x83,
+    0xa9, 0x40, 0x24, 0xc9, 0xbb, 0x88, 0xea, 0xcc, 0x03, 0x0c, 0x2c, 0x00, 0x89, 0x80, 0x98, 0x99,
+    0x08, 0x31, 0x24, 0x90, 0x31, 0x05, 0xfb, 0xbb, 0xaa, 0xbc, 0xbd, 0xba, 0x89, 0xb8, 0xce, 0x0a,
+    0x33, 0xb0, 0xae, 0x20, 0xa1, 0xcf, 0x89, 0x81, 0xba, 0x9c, 0x20, 0x91, 0xbc, 0x19, 0x36, 0xa1,
+    0xab, 0x20, 0xc0, 0xbf, 0x8a, 0xa8, 0xcd, 0x89, 0x00, 0xb9, 0x18, 0x34, 0x13, 0x42, 0x45, 0x81,
+    0x98, 0x10, 0x13, 0xfb, 0xad, 0x10, 0x91, 0xcc, 0x29, 0x24, 0x98, 0x1a, 0x55, 0x01, 0x99, 0x30,
+    0x25, 0x90, 0xaa, 0x41, 0x24, 0xb8, 0x19, 0x36, 0x81, 0x09, 0x42, 0x03, 0x98, 0x08, 0x21, 0x80,
+    0xda, 0x8b, 0x73, 0x24, 0x00, 0x51, 0x35, 0x12, 0x22, 0x24, 0x02, 0x10, 0x01, 0xc9, 0xac, 0xaa,
+    0x9a, 0x88, 0x08, 0x28, 0x55, 0x33, 0x45, 0x34, 0x11, 0x18, 0x34, 0x93, 0xcc, 0x89, 0x12, 0xa8,
+    0xbc, 0x0a, 0x12, 0xc9, 0x0a, 0x45, 0xa1, 0xae, 0x18, 0x91, 0xcd, 0x8b, 0x00, 0x0d, 0x26, 0x00,
+    0x00, 0x98, 0x89, 0x98, 0x8a, 0x73, 0x13, 0xa8, 0x9a, 0xa8, 0xec, 0xcd, 0xab, 0xab, 0xbd, 0xab,
+    0x09, 0xc9, 0xad, 0x20, 0x24, 0xa0, 0x9b, 0x31, 0xa1, 0xbe, 0xab, 0xc9, 0xcc, 0xab, 0x88, 0xd9,
+    0xac, 0x29, 0x12, 0xb8, 0x9b, 0x90, 0xfb, 0x9a, 0x88, 0xdc, 0xac, 0x18, 0x82, 0xaa, 0x30, 0x36,
+    0x12, 0x33, 0x25, 0x90, 0x9b, 0x30, 0xb2, 0xff, 0x8d, 0x10, 0xa8, 0x9b, 0x42, 0x13, 0x99, 0x73,
+    0x34, 0x80, 0x19, 0x44, 0x03, 0xca, 0x19, 0x24, 0xa0, 0x9c, 0x51, 0x82, 0xaa, 0x30, 0x25, 0x98,
+    0x19, 0x43, 0x82, 0x99, 0x18, 0x44, 0x33, 0x12, 0x43, 0x45, 0x32, 0x32, 0x24, 0x01, 0x11, 0x02,
+    0xfb, 0xac, 0x99, 0xaa, 0x8b, 0x11, 0x81, 0x28, 0x57, 0x35, 0x23, 0x12, 0x32, 0x34, 0x03, 0xca,
+    0x9a, 0x99, 0xba, 0xdb, 0xcc, 0xab, 0x88, 0x98, 0x30, 0x13, 0xda, 0x39, 0x27, 0xa1, 0xaa, 0x18,
+    0x0f, 0x0d, 0x1d, 0x00, 0x11, 0x21, 0xc0, 0xbe, 0x3a, 0x35, 0xb0, 0xbe, 0x99, 0x99, 0xdd, 0xbc,
+    0x9a, 0xcb, 0xbc, 0x89, 0x80, 0xcb, 0x0a, 0x54, 0x13, 0xa0, 0x8a, 0x42, 0x83, 0xcc, 0xac, 0xa9,
+    0xbc, 0xbc, 0xa9, 0xdb, 0x9c, 0x89, 0x01, 0xa8, 0xaa, 0x89, 0x31, 0x24, 0xa0, 0xbc, 0x1a, 0x36,
+    0x03, 0xbb, 0x3a, 0x37, 0x82, 0x99, 0x20, 0xc0, 0xbf, 0x18, 0x91, 0xde, 0xaa, 0x11, 0x01, 0x00,
+    0x43, 0x44, 0x43, 0x34, 0x24, 0x12, 0x42, 0x43, 0x80, 0xaa, 0x20, 0xc8, 0xae, 0x19, 0x02, 0xcc,
+    0x8b, 0x52, 0x01, 0x88, 0x62, 0x24, 0x80, 0x20, 0x35, 0x02, 0x80, 0x32, 0x13, 0x98, 0x9a, 0xda,
+    0xcc, 0x99, 0x98, 0xec, 0xbb, 0x8a, 0x90, 0x99, 0x42, 0x24, 0x88, 0x61, 0x37, 0x02, 0x88, 0x40,
+    0x33, 0xb8, 0xbc, 0x88, 0xea, 0xad, 0x0a, 0xa0, 0xcd, 0x8b, 0x21, 0x81, 0x8a, 0x61, 0x23, 0x81,
+    0x52, 0x25, 0x81, 0x0a, 0x76, 0x06, 0x2b, 0x00, 0x52, 0x82, 0xda, 0x0a, 0x01, 0xea, 0xab, 0x10,
+    0xa0, 0xbe, 0x18, 0x14, 0xa0, 0x0a, 0x46, 0x12, 0x89, 0x51, 0x14, 0x80, 0x89, 0x23, 0x92, 0xcc,
+    0x19, 0x90, 0xdc, 0xab, 0x10, 0xa0, 0xcc, 0x19, 0x22, 0x91, 0x18, 0x55, 0x12, 0x88, 0x42, 0x24,
+    0xa0, 0x9c, 0x10, 0x82, 0xdd, 0xab, 0x88, 0xcb, 0xac, 0x89, 0x98, 0xdb, 0x89, 0x21, 0x81, 0x09,
+    0x52, 0x24, 0x80, 0x18, 0x33, 0x92, 0xcb, 0xac, 0xca, 0xbc, 0xcb, 0xcb, 0xbd, 0xbb, 0x09, 0x01,
+    0xdb, 0x8c, 0x40, 0x33, 0x22, 0x33, 0x13, 0x20, 0x67, 0x33, 0x91, 0xbb, 0x29, 0x45, 0x91, 0xdb,
+    0x8a, 0x00, 0x80, 0x10, 0x00, 0xcc, 0x2a, 0x57, 0x13, 0x80, 0x18, 0x63, 0x43, 0x12, 0x81, 0x00,
+    0x30, 0x33, 0x81, 0xcb, 0xaa, 0xa9, 0x88, 0x22, 0xe9, 0xae, 0x38, 0x27, 0x02, 0x08, 0x41, 0x33,
+    0x22, 0x32, 0x24, 0x90, 0x89, 0x21, 0xb0, 0xcf, 0x2b, 0x11, 0x25, 0x00, 0x8b, 0xa9, 0xdc, 0xbb,
+    0x9a, 0xdb, 0xbb, 0x19, 0x81, 0xeb, 0x0a, 0x43, 0x91, 0x09, 0x74, 0x13, 0xc9, 0x9b, 0x18, 0xe9,
+    0xad, 0x8a, 0x90, 0xcd, 0xab, 0x09, 0xa8, 0xbb, 0x38, 0x16, 0xa8, 0x09, 0x44, 0x82, 0xbb, 0x30,
+    0x14, 0xda, 0x8b, 0x12, 0xd9, 0xad, 0x18, 0x81, 0xdc, 0x09, 0x33, 0xb1, 0xbc, 0x18, 0x13, 0x99,
+    0x72, 0x37, 0x81, 0x89, 0x52, 0x23, 0x90, 0x09, 0x42, 0x81, 0xab, 0x19, 0x03, 0xec, 0x8c, 0x41,
+    0x13, 0x99, 0x61, 0x34, 0x81, 0x89, 0x43, 0x13, 0x09, 0x62, 0x14, 0xb0, 0x9b, 0x41, 0x03, 0xaa,
+    0x40, 0x25, 0xc9, 0x9b, 0x21, 0xd0, 0xad, 0x09, 0x12, 0xa9, 0x0a, 0x54, 0x02, 0xaa, 0x30, 0x26,
+    0x81, 0x19, 0x13, 0xf8, 0xbe, 0xaa, 0x88, 0x99, 0xbb, 0x9a, 0xb9, 0xbe, 0x8b, 0x10, 0xa0, 0xab,
+    0x48, 0x23, 0xfb, 0xac, 0x08, 0x11, 0x09, 0x52, 0x02, 0xec, 0x9a, 0x08, 0xe4, 0xf5, 0x26, 0x00,
+    0xb8, 0xcc, 0x9b, 0xb9, 0xce, 0xab, 0x08, 0x00, 0x31, 0x56, 0x22, 0x01, 0x10, 0x43, 0x33, 0x22,
+    0x22, 0x01, 0xfb, 0xbc, 0xab, 0x89, 0x20, 0x55, 0x24, 0x82, 0xb9, 0x0a, 0x64, 0x43, 0x23, 0x22,
+    0x91, 0xcb, 0x29, 0x45, 0x23, 0x11, 0x10, 0x90, 0xbb, 0x49, 0x36, 0x82, 0xbc, 0xbb, 0xba, 0x8a,
+    0x76, 0x34, 0x01, 0xa9, 0x99, 0x10, 0x42, 0x55, 0x12, 0xb8, 0xbe, 0xab, 0xaa, 0x89, 0x21, 0x23,
+    0xc0, 0xbd, 0x9b, 0x09, 0x30, 0x55, 0x33, 0x91, 0xcb, 0xab, 0xbb, 0xbd, 0x8a, 0x21, 0x02, 0xc9,
+    0xcc, 0xdc, 0xbc, 0x0b, 0x32, 0x14, 0x99, 0xbc, 0xdb, 0x9a, 0x20, 0x36, 0x23, 0x90, 0x99, 0x98,
+    0x99, 0x28, 0x36, 0xa1, 0xcf, 0xab, 0xaa, 0x89, 0x31, 0x34, 0x81, 0xbc, 0x1a, 0x44, 0x25, 0x34,
+    0x23, 0x90, 0xba, 0x8a, 0x21, 0x22, 0x43, 0x24, 0xa0, 0xbb, 0x20, 0x13, 0xda, 0x0a, 0x63, 0x34,
+    0xaa, 0xfd, 0x26, 0x00, 0x44, 0x33, 0x91, 0xcc, 0x9b, 0x72, 0x45, 0x33, 0x23, 0x90, 0xcc, 0xab,
+    0x19, 0x43, 0x33, 0x81, 0xda, 0xcc, 0xbb, 0x28, 0x44, 0x24, 0x11, 0x80, 0x99, 0x9a, 0x10, 0x22,
+    0x80, 0xbb, 0x8b, 0x98, 0xbb, 0xac, 0xfc, 0xcc, 0x8a, 0x22, 0x25, 0x23, 0x90, 0xec, 0xcc, 0x9a,
+    0x10, 0x34, 0x34, 0x01, 0xc9, 0xcc, 0xaa, 0x18, 0x32, 0x23, 0x91, 0xdc, 0xbd, 0xbc, 0x8a, 0x18,
+    0x23, 0x24, 0x12, 0x90, 0xcc, 0xbb, 0x99, 0x08, 0x11, 0x33, 0x91, 0xdf, 0xbd, 0xba, 0x9b, 0x18,
+    0x45, 0x34, 0x13, 0x00, 0xa9, 0xac, 0x8a, 0x52, 0x35, 0x34, 0x02, 0xa8, 0xcc, 0xaa, 0x20, 0x44,
+    0x24, 0x11, 0xa9, 0xcc, 0xab, 0x99, 0x10, 0x22, 0x11, 0x80, 0x00, 0x99, 0x20, 0x55, 0x02, 0x9a,
+    0x19, 0x32, 0x02, 0x90, 0xfd, 0xdf, 0xab, 0x18, 0x44, 0x24, 0x23, 0x01, 0xa9, 0x9b, 0x51, 0x35,
+    0x43, 0x22, 0x81, 0xdb, 0xe7, 0x1a, 0x36, 0x00, 0x9c, 0x09, 0x21, 0x33, 0x33, 0x92, 0xdc, 0xab,
+    0x18, 0x80, 0xba, 0xac, 0xb9, 0xbd, 0x09, 0x22, 0xe0, 0xcc, 0x8a, 0x88, 0x80, 0x40, 0x34, 0xb1,
+    0xce, 0xbb, 0xa9, 0x8a, 0x41, 0x45, 0x81, 0x9a, 0x89, 0x12, 0x22, 0x34, 0x14, 0xb8, 0xaf, 0x8a,
+    0x80, 0x98, 0x9a, 0x10, 0xea, 0xbc, 0x39, 0x35, 0x24, 0x32, 0x13, 0xfa, 0xbc, 0x09, 0x11, 0x90,
+    0x99, 0xa8, 0xde, 0xab, 0x09, 0x02, 0x80, 0x21, 0x23, 0xc9, 0x9c, 0x41, 0x34, 0x22, 0x12, 0x80,
+    0xcb, 0x29, 0x57, 0x23, 0x81, 0xb9, 0xcb, 0xbb, 0x09, 0x31, 0x13, 0xb9, 0xcb, 0x19, 0x56, 0x45,
+    0x44, 0x22, 0x12, 0x00, 0x00, 0x42, 0x34, 0x14, 0xa0, 0xdc, 0xbc, 0xbb, 0x08, 0x31, 0x14, 0x01,
+    0xba, 0xcd, 0xaa, 0x10, 0x44, 0x44, 0x22, 0x80, 0xb9, 0xbc, 0x99, 0x20, 0x44, 0x12, 0xa0, 0xdb,
+    0xac, 0xab, 0x09, 0x32, 0x23, 0x01, 0x80, 0x98, 0xe5, 0x06, 0x23, 0x00, 0x48, 0x57, 0x23, 0x91,
+    0xca, 0xcc, 0x9b, 0x18, 0x43, 0x02, 0xe9, 0xcd, 0xcb, 0x9b, 0x18, 0x53, 0x33, 0x11, 0xb8, 0xcc,
+    0xaa, 0x20, 0x54, 0x43, 0x12, 0xa0, 0xcb, 0xbb, 0x9a, 0x10, 0x34, 0x02, 0xc9, 0xcc, 0xac, 0x89,
+    0x30, 0x44, 0x23, 0x02, 0xa0, 0xcb, 0xaa, 0x8a, 0x18, 0x11, 0xb0, 0xdf, 0xdb, 0xab, 0xaa, 0x08,
+    0x52, 0x43, 0x22, 0x11, 0x98, 0x9a, 0x20, 0x56, 0x45, 0x43, 0x22, 0x00, 0x99, 0xba, 0x9b, 0x30,
+    0x45, 0x33, 0x23, 0xb8, 0xcf, 0xac, 0x9a, 0x18, 0x52, 0x43, 0x13, 0x90, 0xdb, 0xcb, 0xab, 0x89,
+    0x31, 0x33, 0x81, 0xfb, 0xcc, 0xbb, 0x8a, 0x20, 0x35, 0x24, 0x11, 0x99, 0xca, 0xbb, 0x18, 0x46,
+    0x53, 0x32, 0x12, 0xa0, 0xca, 0x9a, 0x09, 0x11, 0x33, 0x22, 0xb8, 0xcd, 0xab, 0x18, 0x52, 0x44,
+    0x22, 0x90, 0xeb, 0xcc, 0xaa, 0x9a, 0x18, 0x21, 0x22, 0xa0, 0xec, 0xdb, 0x90, 0xf2, 0x37, 0x00,
+    0xcb, 0xba, 0x88, 0x21, 0x32, 0x33, 0x02, 0xb9, 0xac, 0x19, 0x64, 0x44, 0x43, 0x23, 0x02, 0x98,
+    0xa9, 0xab, 0x89, 0x21, 0x32, 0x43, 0x34, 0x33, 0x23, 0x02, 0xfb, 0xcd, 0xbb, 0x8a, 0x40, 0x55,
+    0x43, 0x23, 0x81, 0xca, 0xbd, 0xcc, 0xaa, 0x99, 0x80, 0x01, 0x00, 0x90, 0xb9, 0xcb, 0x9a, 0x09,
+    0x30, 0x54, 0x44, 0x43, 0x43, 0x33, 0x14, 0x12, 0x11, 0x88, 0xba, 0xdb, 0xbc, 0xbb, 0x8a, 0x42,
+    0x45, 0x24, 0x03, 0xa8, 0xdc, 0xcb, 0xaa, 0x10, 0x44, 0x44, 0x32, 0x01, 0xb8, 0xbc, 0xbd, 0xcb,
+    0xaa, 0x89, 0x08, 0x10, 0x22, 0x22, 0x88, 0xa9, 0xaa, 0xbb, 0x70, 0x55, 0x34, 0x43, 0x22, 0x01,
+    0xba, 0xdb, 0xba, 0xbb, 0xaa, 0x99, 0x98, 0x18, 0x53, 0x44, 0x33, 0x33, 0x81, 0xdc, 0xcc, 0xab,
+    0x8a, 0x31, 0x45, 0x33, 0x12, 0xa8, 0xec, 0xcb, 0xbb, 0xbc, 0x9a, 0x08, 0x20, 0x44, 0x53, 0x33,
+    0xed, 0xfb, 0x31, 0x00, 0x33, 0x33, 0x22, 0x22, 0x21, 0x32, 0x13, 0xc9, 0xbd, 0xcd, 0xcb, 0xba,
+    0x99, 0x08, 0x18, 0x42, 0x33, 0x81, 0xeb, 0xbd, 0xbd, 0xaa, 0x31, 0x56, 0x43, 0x33, 0x02, 0xc8,
+    0xbd, 0xbd, 0xba, 0x9a, 0x00, 0x22, 0x33, 0x33, 0x11, 0x90, 0x88, 0x00, 0x63, 0x45, 0x43, 0x23,
+    0x23, 0x12, 0x00, 0x08, 0x11, 0x12, 0x22, 0x24, 0x81, 0xcc, 0xcc, 0xcd, 0xbc, 0xad, 0xbb, 0xab,
+    0x8a, 0x31, 0x44, 0x24, 0x13, 0x81, 0xcb, 0xcc, 0xac, 0xab, 0x99, 0x10, 0x43, 0x35, 0x33, 0x33,
+    0x01, 0xc9, 0xbd, 0xbd, 0xbb, 0x9a, 0x30, 0x46, 0x34, 0x24, 0x13, 0x81, 0xa9, 0xbb, 0xab, 0x18,
+    0x64, 0x34, 0x34, 0x21, 0x98, 0xdb, 0xcc, 0xac, 0xab, 0xaa, 0x89, 0x11, 0x22, 0x12, 0x98, 0xcc,
+    0xbd, 0xbc, 0x9b, 0x19, 0x63, 0x45, 0x53, 0x23, 0x23, 0x80, 0xb9, 0xbe, 0xbc, 0x9b, 0x19, 0x52,
+    0x44, 0x33, 0x13, 0x90, 0xff, 0x17, 0x34, 0x00, 0xda, 0xbc, 0xbc, 0xaa, 0x08, 0x32, 0x36, 0x33,
+    0x23, 0x90, 0xca, 0xbd, 0xbb, 0x9a, 0x08, 0x33, 0x34, 0x14, 0x91, 0xc9, 0xbc, 0xbc, 0xbb, 0x8a,
+    0x31, 0x55, 0x53, 0x43, 0x23, 0x12, 0x00, 0xba, 0xcd, 0xcb, 0xbb, 0x99, 0x31, 0x46, 0x44, 0x32,
+    0x12, 0xa0, 0xeb, 0xbc, 0xbc, 0xab, 0x8a, 0x20, 0x53, 0x43, 0x33, 0x11, 0x98, 0xdb, 0xdb, 0xaa,
+    0x89, 0x10, 0x33, 0x34, 0x23, 0x02, 0x90, 0x99, 0x9a, 0x18, 0x53, 0x44, 0x34, 0x33, 0x02, 0xb9,
+    0xcf, 0xcc, 0xbb, 0xac, 0x09, 0x20, 0x44, 0x34, 0x24, 0x22, 0x80, 0xb9, 0xbe, 0xbd, 0xab, 0xaa,
+    0x18, 0x42, 0x44, 0x33, 0x24, 0x01, 0x90, 0xca, 0xcb, 0xcb, 0xab, 0x9a, 0x08, 0x32, 0x45, 0x43,
+    0x33, 0x43, 0x32, 0x21, 0x00, 0xa9, 0xdb, 0xcb, 0xba, 0xcb, 0xab, 0xbb, 0xbc, 0xbb, 0x8b, 0x20,
+    0x55, 0x54, 0x33, 0x23, 0x12, 0x98, 0xdc, 0xdb, 0x65, 0xff, 0x37, 0x00, 0xbb, 0xab, 0x09, 0x52,
+    0x35, 0x35, 0x33, 0x23, 0x81, 0xa9, 0xcd, 0xdb, 0xcb, 0xab, 0xab, 0x9a, 0x20, 0x63, 0x34, 0x34,
+    0x24, 0x12, 0x01, 0x99, 0xdb, 0xdb, 0xbb, 0xbb, 0xab, 0x09, 0x20, 0x34, 0x35, 0x24, 0x33, 0x21,
+    0x00, 0xa9, 0xcc, 0xbc, 0xbc, 0xcb, 0x9a, 0x89, 0x21, 0x45, 0x34, 0x35, 0x43, 0x22, 0x01, 0xb9,
+    0xcd, 0xbc, 0xbc, 0xbb, 0x9b, 0x89, 0x31, 0x44, 0x34, 0x33, 0x33, 0x11, 0xa0, 0xcb, 0xbd, 0xad,
+    0xbb, 0xab, 0x89, 0x30, 0x55, 0x53, 0x34, 0x33, 0x23, 0x12, 0x90, 0xdb, 0xcc, 0xbc, 0xbb, 0xbb,
+    0x99, 0x20, 0x44, 0x35, 0x34, 0x33, 0x23, 0x12, 0x88, 0xaa, 0xcc, 0xcb, 0xbb, 0xaa, 0x89, 0x20,
+    0x34, 0x45, 0x32, 0x23, 0x12, 0x80, 0xdb, 0xbc, 0xbd, 0xbc, 0xbb, 0xaa, 0x88, 0x32, 0x56, 0x53,
+    0x43, 0x33, 0x33, 0x12, 0xa8, 0xfb, 0xdb, 0xbb, 0xbc, 0xaa, 0x9a, 0x08, 0x32, 0xe4, 0x38, 0x00,
+    0x21, 0x34, 0x34, 0x33, 0x23, 0x82, 0xa8, 0xcc, 0xbc, 0xbc, 0xbb, 0xaa, 0x09, 0x31, 0x54, 0x43,
+    0x43, 0x22, 0x12, 0x01, 0xa8, 0xca, 0xcd, 0xdb, 0xbb, 0xbc, 0xab, 0x9a, 0x88, 0x21, 0x53, 0x34,
+    0x34, 0x33, 0x22, 0x01, 0xa8, 0xdb, 0xcb, 0xaa, 0x9a, 0x88, 0x11, 0x32, 0x53, 0x43, 0x32, 0x01,
+    0xa8, 0xdb, 0xcc, 0xcb, 0xcb, 0xbb, 0xcb, 0x9a, 0x08, 0x53, 0x45, 0x53, 0x33, 0x34, 0x42, 0x22,
+    0x23, 0x12, 0x90, 0xca, 0xbd, 0xbc, 0xac, 0xaa, 0x89, 0x10, 0x31, 0x35, 0x34, 0x34, 0x32, 0x22,
+    0x11, 0x00, 0x88, 0xba, 0xcc, 0xbc, 0xbc, 0x89, 0x52, 0x55, 0x34, 0x34, 0x33, 0x12, 0x81, 0xb9,
+    0xdc, 0xbc, 0xbc, 0xac, 0xab, 0x99, 0x09, 0x10, 0x31, 0x43, 0x43, 0x43, 0x22, 0x02, 0xa0, 0xca,
+    0xbc, 0xac, 0x9a, 0x09, 0x31, 0x54, 0x53, 0x34, 0x43, 0x22, 0x01, 0xb9, 0xce, 0xbc, 0xbc, 0xac,
+    0x11, 0xfb, 0x35, 0x00, 0xab, 0x9a, 0x09, 0x32, 0x35, 0x35, 0x33, 0x22, 0x01, 0xa9, 0xcb, 0xbc,
+    0xac, 0xab, 0x9b, 0x09, 0x42, 0x44, 0x34, 0x43, 0x12, 0x01, 0x98, 0xca, 0xcc, 0xbd, 0xbc, 0xbc,
+    0xbb, 0xaa, 0x8a, 0x00, 0x32, 0x35, 0x35, 0x34, 0x24, 0x12, 0x01, 0xa8, 0xcb, 0xac, 0xbb, 0xba,
+    0xa9, 0x98, 0x00, 0x31, 0x43, 0x22, 0x98, 0xec, 0xbc, 0xcc, 0xaa, 0x9a, 0x89, 0x20, 0x44, 0x45,
+    0x34, 0x44, 0x32, 0x23, 0x33, 0x32, 0x23, 0x23, 0x02, 0xa9, 0xcd, 0xbc, 0xcb, 0xaa, 0x99, 0x00,
+    0x20, 0x43, 0x33, 0x23, 0x82, 0xda, 0xcd, 0xab, 0x9a, 0x20, 0x63, 0x34, 0x53, 0x33, 0x35, 0x45,
+    0x42, 0x32, 0x22, 0x02, 0x00, 0xa9, 0xcc, 0xcc, 0xbc, 0xcc, 0xbb, 0xbb, 0xba, 0x9a, 0x99, 0x20,
+    0x43, 0x36, 0x44, 0x33, 0x23, 0x22, 0x00, 0x80, 0x88, 0x88, 0xa8, 0xda, 0xdb, 0xbb, 0xcb, 0xaa,
+    0xaa, 0xbb, 0xbc, 0xbc, 0x20, 0x00, 0x23, 0x00, 0xbb, 0xac, 0xbc, 0xcc, 0xaa, 0x09, 0x52, 0x45,
+    0x34, 0x32, 0x12, 0x00, 0x98, 0xa9, 0xaa, 0xba, 0xcc, 0xab, 0x0a, 0x42, 0x46, 0x33, 0x33, 0x01,
+    0xa9, 0xcd, 0xcc, 0xdb, 0xcb, 0xac, 0xbb, 0xba, 0x99, 0x09, 0x10, 0x31, 0x63, 0x44, 0x34, 0x34,
+    0x23, 0x12, 0x90, 0xb9, 0xbd, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0x99, 0x88, 0x98, 0xa9, 0xdb, 0xbb,
+    0x8a, 0x51, 0x55, 0x34, 0x35, 0x43, 0x32, 0x23, 0x22, 0x12, 0x00, 0x88, 0x08, 0x18, 0x10, 0x21,
+    0x33, 0x35, 0x43, 0x43, 0x13, 0x81, 0x98, 0x98, 0xb9, 0xfc, 0xce, 0xce, 0xbc, 0xbd, 0xbb, 0xbb,
+    0x89, 0x30, 0x55, 0x34, 0x35, 0x33, 0x24, 0x11, 0x81, 0x98, 0xa9, 0xa9, 0x99, 0x99, 0xca, 0xdc,
+    0xdb, 0xcb, 0xbb, 0xbc, 0xaa, 0x89, 0x21, 0x54, 0x34, 0x35, 0x23, 0x33, 0x12, 0x22, 0x21, 0x22,
+    0x12, 0x98, 0xdc, 0xdc, 0xcb, 0xbc, 0xcb, 0xbb, 0x2a, 0xf9, 0x32, 0x00, 0xbb, 0xaa, 0x09, 0x32,
+    0x45, 0x43, 0x32, 0x12, 0x11, 0x80, 0x80, 0x98, 0xa9, 0xbc, 0xbc, 0xcb, 0x9a, 0xaa, 0xaa, 0xab,
+    0x8a, 0x51, 0x56, 0x44, 0x33, 0x22, 0x81, 0xba, 0xce, 0xbb, 0xbc, 0xab, 0xac, 0xab, 0xbb, 0xcb,
+    0xab, 0xcb, 0xa9, 0x08, 0x73, 0x54, 0x35, 0x44, 0x33, 0x34, 0x32, 0x12, 0x80, 0xa9, 0xdb, 0xbc,
+    0xbc, 0xbb, 0xcb, 0xab, 0xcb, 0xba, 0xcb, 0xaa, 0x9a, 0x08, 0x41, 0x45, 0x44, 0x33, 0x34, 0x23,
+    0x11, 0x90, 0xa9, 0x99, 0x08, 0x53, 0x44, 0x32, 0x13, 0x90, 0xdb, 0xcc, 0xcb, 0xba, 0x89, 0x20,
+    0x63, 0x24, 0x24, 0x01, 0x90, 0xbb, 0xbd, 0xbc, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0xba, 0xaa, 0x8a,
+    0x18, 0x64, 0x54, 0x54, 0x43, 0x43, 0x23, 0x12, 0x81, 0xa9, 0xca, 0xca, 0xaa, 0xab, 0xbb, 0xbb,
+    0xac, 0xbb, 0xcb, 0xbd, 0xcc, 0xba, 0x8a, 0x20, 0x55, 0x44, 0x43, 0x32, 0xe6, 0x09, 0x32, 0x00,
+    0x22, 0x11, 0x90, 0xa8, 0xdb, 0xcb, 0xdb, 0xba, 0xbb, 0xbb, 0xac, 0xbb, 0xba, 0x08, 0x73, 0x45,
+    0x44, 0x33, 0x24, 0x22, 0x81, 0x98, 0xbb, 0xbd, 0xad, 0xbb, 0xac, 0xba, 0xaa, 0xbb, 0xcc, 0xbb,
+    0xbc, 0xab, 0x09, 0x63, 0x45, 0x44, 0x33, 0x34, 0x33, 0x22, 0x02, 0x80, 0x99, 0xba, 0xbc, 0xbc,
+    0xbc, 0xbd, 0xbc, 0xbc, 0xbb, 0xaa, 0x08, 0x41, 0x35, 0x35, 0x34, 0x33, 0x22, 0x01, 0x98, 0xba,
+    0xbd, 0xac, 0xcb, 0xba, 0xba, 0xbc, 0xbc, 0xbb, 0xab, 0x8a, 0x31, 0x37, 0x36, 0x35, 0x24, 0x33,
+    0x43, 0x12, 0x02, 0x81, 0xa8, 0xba, 0xbd, 0xbd, 0xbc, 0xbc, 0xcb, 0xcb, 0xca, 0xba, 0x9a, 0x09,
+    0x30, 0x54, 0x34, 0x34, 0x34, 0x22, 0x21, 0x00, 0x88, 0xa9, 0xbb, 0xcb, 0xbb, 0xaa, 0xbc, 0xcb,
+    0xbb, 0xad, 0xab, 0x88, 0x31, 0x57, 0x34, 0x43, 0x22, 0x12, 0x80, 0xa8, 0xbc, 0xbc, 0xba, 0xaa,
+    0xac, 0x00, 0x2c, 0x00, 0xaa, 0xba, 0xcd, 0xcc, 0xcb, 0xbc, 0xac, 0x99, 0x08, 0x43, 0x44, 0x34,
+    0x34, 0x24, 0x22, 0x22, 0x11, 0x12, 0x21, 0x21, 0x21, 0x11, 0xb9, 0xdf, 0xcc, 0xcb, 0xbb, 0xab,
+    0x9a, 0x09, 0x10, 0x11, 0x80, 0xb8, 0xcc, 0xcb, 0xba, 0xba, 0x09, 0x53, 0x45, 0x53, 0x32, 0x22,
+    0x11, 0x90, 0xca, 0xaa, 0x9a, 0x18, 0x43, 0x33, 0x35, 0x44, 0x23, 0x32, 0x22, 0x23, 0x32, 0x33,
+    0x11, 0x31, 0x25, 0xd8, 0xed, 0xcd, 0xcc, 0xcb, 0xbb, 0xbb, 0xab, 0x8a, 0x09, 0x00, 0x80, 0x88,
+    0x10, 0x41, 0x54, 0x45, 0x44, 0x34, 0x33, 0x24, 0x22, 0x11, 0x00, 0x99, 0x98, 0x89, 0x18, 0x12,
+    0x80, 0xc9, 0xdd, 0xcd, 0xcb, 0xac, 0x9b, 0x89, 0x11, 0x43, 0x34, 0x24, 0x01, 0xa0, 0xda, 0xbb,
+    0xac, 0xaa, 0x99, 0x18, 0x22, 0x53, 0x23, 0x23, 0x32, 0x43, 0x53, 0x53, 0x44, 0x34, 0x34, 0x23,
+    0x12, 0x80, 0xa8, 0xcb, 0xe9, 0x1b, 0x2b, 0x00, 0xba, 0xac, 0xbb, 0xcb, 0xdc, 0xcb, 0xac, 0xcb,
+    0xbb, 0xbb, 0xad, 0xab, 0x9a, 0x9a, 0x88, 0x11, 0x42, 0x43, 0x33, 0x22, 0x43, 0x34, 0x42, 0x43,
+    0x34, 0x53, 0x43, 0x33, 0x23, 0x22, 0x02, 0x80, 0x89, 0x89, 0x18, 0x22, 0xa8, 0xdf, 0xcd, 0xcc,
+    0xcc, 0xca, 0xba, 0xaa, 0x89, 0x89, 0x00, 0x11, 0x01, 0x88, 0xa9, 0xaa, 0x48, 0x55, 0x44, 0x33,
+    0x34, 0x32, 0x32, 0x12, 0x22, 0x43, 0x44, 0x53, 0x43, 0x23, 0x33, 0x24, 0x11, 0x80, 0x99, 0xcb,
+    0xbb, 0x99, 0x99, 0x9a, 0xdc, 0xbe, 0xbd, 0xbb, 0xbc, 0x9a, 0x9a, 0x89, 0x10, 0x02, 0x08, 0x41,
+    0x34, 0x46, 0x44, 0x33, 0x33, 0x45, 0x33, 0x33, 0x23, 0x21, 0x00, 0x00, 0xaa, 0xbb, 0xbd, 0x9c,
+    0x28, 0x21, 0x21, 0x56, 0x43, 0x23, 0x11, 0xd9, 0xde, 0xcb, 0xbb, 0xbc, 0xbb, 0xab, 0x9a, 0xaa,
+    0xbb, 0xdc, 0xcb, 0xac, 0x9a, 0x88, 0x21, 0x64, 0x52, 0xee, 0x31, 0x00, 0x53, 0x32, 0x34, 0x33,
+    0x12, 0x11, 0x12, 0x10, 0x10, 0x12, 0x81, 0xa9, 0xdd, 0xcd, 0xbd, 0xcc, 0xbb, 0xbb, 0xbc, 0xaa,
+    0xaa, 0xaa, 0x09, 0x10, 0x11, 0x31, 0x23, 0x91, 0xaa, 0xba, 0xce, 0xac, 0x08, 0x52, 0x45, 0x44,
+    0x43, 0x24, 0x33, 0x42, 0x12, 0x01, 0x00, 0x21, 0x12, 0x22, 0x32, 0x90, 0x8a, 0x80, 0xfb, 0xcd,
+    0xba, 0xcb, 0xcb, 0xbc, 0xbc, 0xbc, 0xab, 0x09, 0x10, 0x32, 0x65, 0x34, 0x34, 0x24, 0x22, 0x02,
+    0x80, 0x01, 0x01, 0x18, 0x42, 0x24, 0x23, 0x23, 0x02, 0x88, 0x31, 0x47, 0x44, 0x32, 0x43, 0x43,
+    0x23, 0x22, 0x01, 0xb9, 0xbd, 0xab, 0xda, 0xcb, 0xab, 0xcc, 0xcc, 0xbc, 0xcc, 0xbb, 0xac, 0x9a,
+    0x99, 0x88, 0x08, 0x00, 0x21, 0x32, 0x45, 0x24, 0x43, 0x43, 0x33, 0x32, 0x32, 0x23, 0x98, 0xa9,
+    0xcc, 0xbe, 0xbb, 0xba, 0xaa, 0x99, 0x00, 0x99, 0xaa, 0x99, 0x99, 0xdc, 0xce, 0xff, 0x20, 0x00,
+    0xce, 0xbc, 0xbd, 0xbc, 0xaa, 0x9a, 0xaa, 0x88, 0x91, 0xeb, 0xcc, 0xbc, 0xbc, 0x9b, 0x89, 0x21,
+    0x44, 0x45, 0x43, 0x23, 0x23, 0x11, 0x80, 0x80, 0x00, 0x32, 0x33, 0x46, 0x43, 0x12, 0x90, 0xc9,
+    0xcc, 0x9c, 0x9a, 0x98, 0x10, 0x42, 0x34, 0x35, 0x33, 0x22, 0x11, 0x11, 0x10, 0x00, 0xb9, 0xcb,
+    0x9a, 0xab, 0xcb, 0xcd, 0xcb, 0x8a, 0x01, 0x00, 0x10, 0xb0, 0xce, 0xaa, 0xb9, 0xcf, 0xaa, 0x08,
+    0x00, 0x30, 0x46, 0x22, 0x11, 0x33, 0x23, 0xb8, 0xcb, 0x9a, 0x9a, 0x40, 0x77, 0x33, 0x53, 0x43,
+    0x43, 0x22, 0x02, 0x81, 0xa9, 0xdb, 0xba, 0xbb, 0xcc, 0xbb, 0x9a, 0xca, 0xdd, 0xcb, 0xcb, 0xcb,
+    0xbb, 0xa9, 0xaa, 0xaa, 0x08, 0x10, 0x00, 0x12, 0x01, 0x30, 0x46, 0x44, 0x53, 0x34, 0x33, 0x44,
+    0x24, 0x12, 0x10, 0x21, 0x23, 0x33, 0x35, 0x23, 0x00, 0x08, 0x01, 0xa8, 0xce, 0x9a, 0x98, 0xc9,
+    0xcc, 0x0e, 0x25, 0x00, 0xaa, 0x99, 0xfc, 0xbc, 0x9a, 0xdb, 0xcd, 0xaa, 0x99, 0x99, 0x08, 0x22,
+    0x81, 0x98, 0x00, 0x90, 0xdc, 0xbc, 0xa9, 0x98, 0x18, 0x65, 0x34, 0x24, 0x42, 0x33, 0x02, 0xa9,
+    0x9a, 0xa8, 0x9b, 0x71, 0x35, 0x32, 0x53, 0x34, 0x13, 0x01, 0x90, 0xc9, 0xab, 0xaa, 0x89, 0x28,
+    0x43, 0x12, 0x21, 0xd0, 0xff, 0xcb, 0xaa, 0xbb, 0xbb, 0x99, 0xa9, 0xab, 0x09, 0x98, 0xec, 0xcb,
+    0xaa, 0xab, 0xaa, 0x18, 0x53, 0x33, 0x54, 0x44, 0x12, 0x80, 0x20, 0x43, 0x22, 0x54, 0x34, 0x14,
+    0x32, 0x34, 0x13, 0x01, 0x10, 0x12, 0x11, 0x00, 0x32, 0x14, 0x88, 0x20, 0x92, 0xff, 0xaf, 0xaa,
+    0xbb, 0xbb, 0x8a, 0x88, 0x88, 0x10, 0x12, 0xca, 0xcd, 0xcb, 0xbc, 0xbb, 0xab, 0x9a, 0x38, 0x54,
+    0x33, 0x44, 0x11, 0xba, 0xbd, 0xba, 0xac, 0x9a, 0x32, 0x35, 0x43, 0x35, 0x33, 0x01, 0x10, 0x11,
+    0x88, 0x18, 0x51, 0x54, 0xc9, 0x02, 0x2a, 0x00, 0x34, 0x45, 0x33, 0x23, 0x01, 0x08, 0x81, 0xa9,
+    0x0a, 0x43, 0x02, 0x10, 0x44, 0xa0, 0xce, 0xab, 0xeb, 0xcc, 0xbb, 0xbc, 0xcb, 0xaa, 0x99, 0xa9,
+    0xba, 0xcb, 0xcb, 0xbb, 0xab, 0xaa, 0x89, 0x30, 0x36, 0x34, 0x34, 0x44, 0x43, 0x33, 0x35, 0x24,
+    0x23, 0x35, 0x34, 0x32, 0x34, 0x23, 0x12, 0x20, 0x22, 0x01, 0x20, 0x45, 0x12, 0x00, 0x98, 0xfb,
+    0xce, 0xbb, 0xcb, 0xbc, 0xbb, 0xbb, 0xcb, 0xaa, 0xab, 0xbc, 0xcc, 0xcb, 0xbc, 0xba, 0xac, 0x8a,
+    0x08, 0x11, 0x31, 0x34, 0x12, 0x01, 0x11, 0x12, 0x10, 0x56, 0x34, 0x34, 0x45, 0x24, 0x32, 0x22,
+    0x13, 0x00, 0x08, 0x01, 0x11, 0x53, 0x45, 0x23, 0x23, 0x02, 0xa0, 0xcc, 0xbd, 0xcb, 0xca, 0xba,
+    0x89, 0x00, 0x88, 0x18, 0x80, 0xde, 0xcb, 0xba, 0xbc, 0x9c, 0x08, 0x12, 0x32, 0x54, 0x22, 0x90,
+    0x88, 0x99, 0xbc, 0x9c, 0x10, 0x43, 0x54, 0x53, 0x0f, 0xf9, 0x31, 0x00, 0x43, 0x22, 0x11, 0x12,
+    0x00, 0x08, 0x41, 0x45, 0x43, 0x44, 0x34, 0x32, 0x22, 0x32, 0x00, 0x88, 0x00, 0x80, 0x11, 0x36,
+    0x34, 0x21, 0x33, 0x91, 0xcd, 0xbc, 0xcc, 0xcc, 0xaa, 0x9a, 0xba, 0x9a, 0xaa, 0xdc, 0xbc, 0xbc,
+    0xcc, 0xac, 0xab, 0xaa, 0xaa, 0x99, 0x88, 0x98, 0xa9, 0x89, 0xa8, 0xdc, 0x8a, 0x22, 0x22, 0x65,
+    0x45, 0x33, 0x42, 0x42, 0x12, 0x01, 0x11, 0x22, 0x31, 0x32, 0x35, 0x33, 0x23, 0x10, 0x11, 0xd9,
+    0xce, 0xab, 0xcc, 0xbc, 0xac, 0xa9, 0xba, 0xac, 0xaa, 0xcd, 0xcb, 0xab, 0xbb, 0xbc, 0xaa, 0xa9,
+    0xab, 0x9a, 0x98, 0x98, 0x08, 0x12, 0x80, 0x20, 0x53, 0x44, 0x46, 0x45, 0x33, 0x34, 0x43, 0x23,
+    0x31, 0x43, 0x24, 0x33, 0x63, 0x33, 0x32, 0x32, 0x45, 0x22, 0x21, 0x32, 0x23, 0x98, 0x10, 0x24,
+    0x02, 0x30, 0x27, 0x91, 0xbb, 0x9a, 0xc9, 0xbd, 0x9a, 0x98, 0xeb, 0xcb, 0xa7, 0x1a, 0x2c, 0x00,
+    0xaa, 0xba, 0xbc, 0xac, 0x99, 0xeb, 0xcc, 0x9a, 0xa8, 0xa9, 0x18, 0x33, 0xb0, 0xab, 0x10, 0xb0,
+    0x8c, 0x75, 0x24, 0x32, 0x43, 0x35, 0x22, 0x43, 0x44, 0x23, 0x12, 0x12, 0x22, 0x32, 0x44, 0x35,
+    0x24, 0x12, 0x01, 0x98, 0xcb, 0xbb, 0xbb, 0xbb, 0xcb, 0xcd, 0xcb, 0xcb, 0xbc, 0xbc, 0xca, 0xeb,
+    0xcb, 0xbb, 0xcb, 0xbb, 0xaa, 0x99, 0xca, 0xbb, 0xbc, 0xbd, 0xbc, 0xaa, 0x9a, 0xa9, 0x89, 0x88,
+    0x00, 0x18, 0x63, 0x25, 0x02, 0x80, 0x22, 0x12, 0x41, 0x57, 0x25, 0x13, 0x33, 0x24, 0x82, 0x80,
+    0x32, 0x23, 0x20, 0x63, 0x33, 0x00, 0x30, 0x36, 0x03, 0x88, 0x88, 0xea, 0xcd, 0x9a, 0x80, 0x08,
+    0x28, 0x32, 0xa0, 0xce, 0xbb, 0xbb, 0xac, 0x9a, 0x99, 0x9a, 0xaa, 0x8a, 0x73, 0x25, 0x11, 0x20,
+    0x22, 0xda, 0x8b, 0x73, 0x43, 0x43, 0x45, 0x23, 0x01, 0x11, 0x33, 0x23, 0x52, 0x44, 0x22, 0x12,
+    0xfc, 0x1d, 0x2e, 0x00, 0x53, 0x24, 0x33, 0x42, 0x33, 0x03, 0x88, 0x9a, 0x88, 0x10, 0x54, 0x35,
+    0x23, 0x98, 0x9a, 0x9a, 0xdb, 0xab, 0x89, 0xba, 0xcf, 0xaa, 0x98, 0xaa, 0x9b, 0x80, 0xfb, 0xcf,
+    0xbb, 0xbc, 0xbb, 0x9a, 0x89, 0xa8, 0xcc, 0xcb, 0xba, 0xbb, 0xbc, 0x8a, 0xa9, 0xeb, 0xab, 0x8a,
+    0xaa, 0xab, 0x62, 0x82, 0xfb, 0xac, 0x99, 0xcb, 0x8a, 0x43, 0x12, 0x88, 0x30, 0x13, 0xba, 0x49,
+    0x47, 0x02, 0x10, 0x42, 0x02, 0x08, 0x73, 0x34, 0x02, 0x00, 0x88, 0xbb, 0xad, 0x19, 0x43, 0x23,
+    0x32, 0x33, 0xa1, 0xcc, 0x9b, 0x00, 0x80, 0x9a, 0xaa, 0xee, 0xbc, 0x8a, 0x00, 0xb8, 0xce, 0xbc,
+    0xcd, 0xcb, 0x9a, 0x88, 0x88, 0x00, 0x01, 0x90, 0xda, 0x9a, 0x08, 0x12, 0x12, 0x34, 0x13, 0x00,
+    0x72, 0x47, 0x23, 0x12, 0x23, 0x02, 0x98, 0x38, 0x47, 0x34, 0x53, 0x34, 0x23, 0x01, 0x21, 0x33,
+    0x22, 0x43, 0x34, 0x02, 0x35, 0x1c, 0x2a, 0x00, 0x00, 0x41, 0x43, 0x22, 0x22, 0x22, 0xc8, 0xce,
+    0xab, 0x99, 0x00, 0x51, 0x34, 0x03, 0xb9, 0xac, 0xaa, 0xcc, 0xaa, 0x89, 0xd9, 0xbc, 0x8b, 0x98,
+    0xca, 0x8a, 0x12, 0xfa, 0xcd, 0xaa, 0xa9, 0x9a, 0x51, 0x25, 0x12, 0x00, 0x11, 0x98, 0x9a, 0x31,
+    0x24, 0x11, 0x42, 0x45, 0x22, 0x32, 0x46, 0x24, 0x11, 0x00, 0x98, 0xa8, 0x18, 0x64, 0x34, 0x22,
+    0x11, 0x80, 0xca, 0xcc, 0xbb, 0xcb, 0xcb, 0xcb, 0xab, 0xcc, 0xcb, 0xaa, 0xb9, 0xeb, 0xdb, 0xbb,
+    0xbc, 0xac, 0x9a, 0x98, 0xa9, 0xaa, 0xaa, 0xcc, 0xbc, 0xbb, 0xab, 0xba, 0xaa, 0x98, 0x98, 0x8a,
+    0x72, 0x26, 0x12, 0x00, 0x11, 0x01, 0x20, 0x66, 0x34, 0x32, 0x53, 0x24, 0x12, 0x10, 0x31, 0x23,
+    0x11, 0x44, 0x33, 0x11, 0x41, 0x36, 0x23, 0x11, 0x21, 0x91, 0xbb, 0x8a, 0x32, 0x12, 0x54, 0x35,
+    0x13, 0xa8, 0xcb, 0xbb, 0xbb, 0xcb, 0xbb, 0xbb, 0xe4, 0xfd, 0x1e, 0x00, 0xce, 0x9b, 0x51, 0x23,
+    0x88, 0x19, 0x81, 0xed, 0x9b, 0x20, 0x22, 0x62, 0x46, 0x23, 0x81, 0x11, 0x43, 0x22, 0x32, 0x45,
+    0x22, 0x11, 0x53, 0x35, 0x23, 0x34, 0x33, 0x13, 0x80, 0x99, 0x00, 0x20, 0x64, 0x44, 0x22, 0x80,
+    0x88, 0x88, 0x98, 0xab, 0x18, 0xd9, 0xce, 0xaa, 0x88, 0xa9, 0x0a, 0x10, 0xfa, 0xcf, 0xbb, 0xbc,
+    0xac, 0x9a, 0x89, 0x98, 0xdb, 0xbb, 0xac, 0xbb, 0xcb, 0x9a, 0xa9, 0xdc, 0xab, 0x9a, 0xb9, 0x9b,
+    0x41, 0x83, 0xde, 0xbb, 0xab, 0xcc, 0x9a, 0x42, 0x03, 0x88, 0x30, 0x13, 0xb9, 0x58, 0x37, 0x12,
+    0x10, 0x34, 0x03, 0x18, 0x73, 0x26, 0x11, 0x00, 0x88, 0xc9, 0xba, 0x08, 0x33, 0x22, 0x32, 0x33,
+    0xb8, 0xcf, 0x9a, 0x08, 0x98, 0xaa, 0xbb, 0xcf, 0xad, 0x8a, 0x08, 0xa8, 0xcc, 0xcc, 0xbc, 0xad,
+    0x9a, 0x89, 0x10, 0x10, 0x21, 0x01, 0xb8, 0x8a, 0x61, 0x24, 0x33, 0x53, 0x43, 0xdd, 0x2b, 0x00,
+    0x23, 0x10, 0x62, 0x55, 0x32, 0x21, 0x32, 0x02, 0x98, 0x38, 0x46, 0x33, 0x54, 0x34, 0x13, 0x01,
+    0x11, 0x13, 0x12, 0x41, 0x33, 0x90, 0xaa, 0x21, 0x23, 0x22, 0x42, 0xa1, 0xdf, 0xcc, 0xac, 0x9a,
+    0x09, 0x31, 0x44, 0x12, 0xa8, 0xac, 0xa9, 0xca, 0xab, 0x09, 0xc9, 0xae, 0x8a, 0x00, 0xa8, 0x18,
+    0x34, 0xd0, 0xce, 0xaa, 0xa9, 0x8a, 0x72, 0x34, 0x13, 0x11, 0x12, 0x80, 0xaa, 0x18, 0x01, 0xa9,
+    0x09, 0x33, 0x13, 0x62, 0x56, 0x43, 0x02, 0xb8, 0xdb, 0xbc, 0xab, 0x28, 0x36, 0x33, 0x11, 0x00,
+    0xc9, 0xce, 0xbb, 0xcb, 0xbc, 0xac, 0xaa, 0xcb, 0xbc, 0x99, 0x98, 0xba, 0xcc, 0xdc, 0xcb, 0xaa,
+    0x9a, 0x89, 0x88, 0x80, 0x00, 0x90, 0xda, 0xcc, 0xba, 0xaa, 0xba, 0x99, 0xba, 0xad, 0x30, 0x46,
+    0x12, 0x01, 0x00, 0x90, 0x89, 0x30, 0x35, 0x33, 0x57, 0x44, 0x23, 0x12, 0x31, 0x22, 0x22, 0x52,
+    0xce, 0xe3, 0x2c, 0x00, 0x33, 0x23, 0x44, 0x55, 0x23, 0x43, 0x32, 0x33, 0x34, 0x33, 0x43, 0x22,
+    0x32, 0x44, 0x44, 0x24, 0x12, 0x22, 0x22, 0x01, 0x89, 0x90, 0xca, 0x9b, 0x10, 0xa1, 0xbe, 0xac,
+    0xba, 0xbc, 0xcb, 0xfb, 0xbc, 0xbc, 0xba, 0xab, 0xaa, 0x99, 0xaa, 0x99, 0xea, 0xcc, 0xbc, 0xbb,
+    0xaa, 0x9a, 0x89, 0x99, 0x9a, 0x19, 0x53, 0x12, 0x01, 0x01, 0xea, 0xbc, 0x29, 0x45, 0x34, 0x46,
+    0x43, 0x22, 0x11, 0x01, 0x98, 0x88, 0x31, 0x35, 0x34, 0x33, 0x43, 0x44, 0x23, 0x22, 0x11, 0xa8,
+    0xbc, 0x0a, 0x01, 0xca, 0x48, 0x37, 0x12, 0x99, 0xdc, 0xdd, 0xbb, 0xba, 0xca, 0xca, 0xaa, 0xaa,
+    0xaa, 0xbb, 0xbe, 0xbd, 0xba, 0xbb, 0xcb, 0xbb, 0xbb, 0x8b, 0x32, 0x24, 0x11, 0x98, 0xbb, 0xcd,
+    0xbb, 0xaa, 0x28, 0x73, 0x55, 0x33, 0x13, 0x01, 0x22, 0x23, 0x33, 0x35, 0x24, 0x21, 0x54, 0x34,
+    0x43, 0x33, 0x33, 0x11, 0xca, 0xfe, 0x2b, 0x00, 0x81, 0xba, 0xac, 0x0a, 0x42, 0x65, 0x53, 0x12,
+    0x81, 0x00, 0x11, 0x00, 0x42, 0x34, 0x01, 0x42, 0x35, 0x13, 0x20, 0x53, 0x12, 0x98, 0xca, 0xde,
+    0xbb, 0x9a, 0x08, 0x01, 0x90, 0xda, 0xcb, 0xdb, 0xbb, 0xbc, 0xaa, 0xaa, 0x98, 0xc9, 0xcc, 0x8a,
+    0x88, 0x21, 0x13, 0xe8, 0xbd, 0x8a, 0x09, 0x38, 0x47, 0x24, 0x33, 0x53, 0x12, 0x00, 0x21, 0x34,
+    0x34, 0x43, 0x22, 0x23, 0x32, 0x43, 0x43, 0x23, 0x81, 0x98, 0xdb, 0xce, 0xab, 0x08, 0x11, 0x11,
+    0x23, 0xc0, 0xbf, 0xbb, 0xcb, 0xbc, 0x9a, 0xa8, 0xdb, 0xac, 0xab, 0x9a, 0x88, 0x98, 0xfb, 0xcc,
+    0xbc, 0xba, 0x9a, 0x89, 0x18, 0x32, 0x14, 0x90, 0xbb, 0xcd, 0xbb, 0x9a, 0xa9, 0xbb, 0x09, 0x42,
+    0x54, 0x53, 0x22, 0x42, 0x33, 0x02, 0xa9, 0x89, 0x30, 0x77, 0x36, 0x33, 0x32, 0x32, 0x12, 0x00,
+    0x08, 0x88, 0x89, 0x20, 0x24, 0x12, 0x32, 0x53, 0x60, 0x16, 0x26, 0x00, 0x44, 0x81, 0xec, 0xbb,
+    0xcc, 0xcb, 0x9b, 0x89, 0x9a, 0x20, 0x25, 0xb8, 0xcd, 0xba, 0xbd, 0xbb, 0x99, 0x99, 0x18, 0x44,
+    0x13, 0x32, 0x35, 0x23, 0x43, 0x24, 0x98, 0x0a, 0x53, 0x44, 0x43, 0x35, 0x24, 0x11, 0x01, 0xa8,
+    0xbc, 0x9c, 0x10, 0x12, 0x00, 0x00, 0x02, 0x98, 0x38, 0x04, 0xee, 0xac, 0x9a, 0xeb, 0xbb, 0x89,
+    0x10, 0x00, 0x22, 0xb0, 0xef, 0xba, 0xa9, 0xba, 0x9b, 0x18, 0x32, 0x23, 0x13, 0x81, 0x08, 0x63,
+    0x24, 0xa0, 0xce, 0xbb, 0x89, 0x41, 0x44, 0x34, 0x33, 0x02, 0x90, 0xca, 0xac, 0x20, 0x45, 0x22,
+    0x33, 0x25, 0x32, 0x54, 0x24, 0x80, 0x00, 0x11, 0x98, 0x9b, 0x00, 0x80, 0x61, 0x45, 0x22, 0xa8,
+    0xba, 0xbb, 0xcd, 0xbc, 0x9a, 0x88, 0xaa, 0xab, 0xb9, 0xdf, 0xab, 0x80, 0xd9, 0xbd, 0xbb, 0xbc,
+    0xbb, 0x09, 0x98, 0x89, 0x08, 0x12, 0x80, 0xc9, 0xaa, 0x20, 0x33, 0x54, 0xf4, 0xd7, 0x27, 0x00,
+    0x55, 0x33, 0x34, 0x44, 0x33, 0x22, 0x43, 0x34, 0x22, 0x11, 0x11, 0x33, 0x37, 0x35, 0x34, 0x23,
+    0x23, 0x21, 0x22, 0x01, 0x00, 0x21, 0x13, 0x90, 0x09, 0x02, 0xe9, 0xac, 0x80, 0xfb, 0xaf, 0xbb,
+    0xeb, 0xbc, 0x9a, 0x99, 0x98, 0x99, 0xb9, 0xdd, 0xbc, 0xbb, 0xcb, 0xbb, 0xbc, 0xba, 0xbc, 0xad,
+    0x99, 0x98, 0xaa, 0x89, 0xb8, 0xce, 0x9b, 0x99, 0x98, 0x31, 0x47, 0x32, 0x32, 0x33, 0x22, 0x11,
+    0x43, 0x36, 0x25, 0x33, 0x43, 0x33, 0x43, 0x35, 0x35, 0x33, 0x12, 0x12, 0x80, 0x28, 0x54, 0x34,
+    0x43, 0x32, 0x12, 0x98, 0xaa, 0x88, 0xa9, 0xaa, 0xa8, 0xec, 0xad, 0x8b, 0x08, 0x88, 0xb9, 0xfb,
+    0xdc, 0xdb, 0xaa, 0xaa, 0xa9, 0x89, 0x00, 0xa8, 0xcd, 0xcb, 0xbb, 0xcc, 0x9a, 0x9a, 0xcb, 0xbb,
+    0x99, 0x80, 0x00, 0x20, 0x12, 0xda, 0xbd, 0x9a, 0xaa, 0x9b, 0x73, 0x37, 0x12, 0x21, 0x32, 0x81,
+    0x78, 0xe6, 0x2a, 0x00, 0x20, 0x46, 0x02, 0x00, 0x52, 0x24, 0x22, 0x54, 0x33, 0x22, 0x33, 0x35,
+    0x02, 0x08, 0x42, 0x33, 0x32, 0x34, 0x24, 0x01, 0x10, 0x24, 0xa1, 0xcc, 0x89, 0x80, 0xba, 0x9b,
+    0xb9, 0xdf, 0x9b, 0x01, 0xb8, 0xce, 0xaa, 0xbb, 0xbd, 0xaa, 0xaa, 0xcc, 0xac, 0x9a, 0xbb, 0xbd,
+    0xab, 0xaa, 0xcb, 0xbb, 0xba, 0xbc, 0x9b, 0x20, 0x02, 0xeb, 0xac, 0x8a, 0x18, 0x32, 0x24, 0x90,
+    0xcc, 0x8a, 0x63, 0x24, 0x81, 0x88, 0x98, 0xba, 0x0b, 0x55, 0x34, 0x32, 0x45, 0x23, 0xa0, 0x0a,
+    0x53, 0x03, 0x00, 0x31, 0xc1, 0xad, 0x62, 0x35, 0x00, 0x08, 0x02, 0xd9, 0xbc, 0x89, 0xaa, 0x9d,
+    0x51, 0x33, 0x81, 0x09, 0x01, 0xc8, 0x9b, 0x11, 0xf8, 0xcc, 0x09, 0x22, 0x20, 0x72, 0x43, 0x02,
+    0x89, 0x98, 0xca, 0xbc, 0x30, 0x45, 0x23, 0x42, 0x24, 0x13, 0x31, 0x34, 0x04, 0x88, 0x08, 0x23,
+    0x22, 0x74, 0x35, 0x23, 0xe2, 0x2e, 0x32, 0x00, 0x12, 0x23, 0x80, 0xcc, 0xaa, 0x88, 0x88, 0x20,
+    0x44, 0x12, 0x00, 0x32, 0x92, 0xde, 0xbb, 0xba, 0xcd, 0xab, 0x99, 0xa8, 0x9a, 0x18, 0xb0, 0xff,
+    0xbb, 0xad, 0xcb, 0xaa, 0x98, 0x88, 0x99, 0x9a, 0xba, 0xdc, 0xcb, 0xab, 0xba, 0xbd, 0xab, 0x9a,
+    0xba, 0x0a, 0x34, 0x93, 0xce, 0xac, 0xbc, 0xbc, 0x9a, 0x01, 0x01, 0x30, 0x54, 0x23, 0x01, 0x21,
+    0x22, 0x00, 0x30, 0x46, 0x12, 0x41, 0x55, 0x24, 0x23, 0x33, 0x23, 0x00, 0x18, 0x32, 0x43, 0x64,
+    0x44, 0x43, 0x22, 0x22, 0x12, 0x12, 0x32, 0x33, 0x23, 0x80, 0x42, 0x47, 0x43, 0x42, 0x23, 0x02,
+    0xa9, 0xaa, 0xb9, 0xcd, 0x9a, 0x10, 0x02, 0x19, 0x63, 0x13, 0xb8, 0x8a, 0xd9, 0xde, 0xbc, 0xab,
+    0xca, 0xba, 0x9a, 0x99, 0xba, 0xad, 0xaa, 0xfb, 0xcc, 0xba, 0xba, 0xbb, 0xab, 0xaa, 0xdb, 0xbb,
+    0x8a, 0xb9, 0xbc, 0xbc, 0xcc, 0xcb, 0x8a, 0x08, 0xef, 0xbb, 0x2d, 0x00, 0x00, 0x10, 0x44, 0x33,
+    0x80, 0x19, 0x01, 0xb9, 0x58, 0x47, 0x12, 0x30, 0x47, 0x43, 0x22, 0x33, 0x24, 0x00, 0x21, 0x33,
+    0x02, 0x31, 0x56, 0x34, 0x42, 0x53, 0x22, 0x11, 0x22, 0x24, 0x01, 0x88, 0x10, 0x11, 0x10, 0x54,
+    0x33, 0x80, 0x28, 0x43, 0xa1, 0xcd, 0x9a, 0xa9, 0xcb, 0xab, 0xa8, 0xed, 0xbb, 0x9a, 0xb9, 0xde,
+    0xac, 0x9a, 0xba, 0xac, 0xaa, 0xb9, 0xbe, 0x9b, 0x88, 0xeb, 0xcc, 0x9a, 0xa9, 0xbb, 0x8a, 0x98,
+    0xca, 0x8b, 0x21, 0x03, 0xca, 0x9a, 0x08, 0xcb, 0xac, 0x09, 0x90, 0x1a, 0x67, 0x24, 0x12, 0x20,
+    0x43, 0x24, 0x33, 0x33, 0x12, 0x21, 0x46, 0x34, 0x33, 0x33, 0x34, 0x44, 0x34, 0x23, 0x12, 0x22,
+    0x43, 0x43, 0x22, 0x23, 0x12, 0x11, 0x62, 0x23, 0x91, 0x89, 0x42, 0x13, 0x98, 0x20, 0x12, 0xba,
+    0x71, 0x24, 0xfa, 0xad, 0x9a, 0x99, 0xba, 0xbb, 0xbc, 0xae, 0x8a, 0x88, 0x48, 0x19, 0x2a, 0x00,
+    0xa8, 0xbd, 0xbc, 0xbb, 0xdb, 0xcb, 0xbb, 0xcc, 0xaa, 0x09, 0x08, 0x99, 0x89, 0x00, 0xa8, 0xbb,
+    0xca, 0xec, 0xdb, 0xbb, 0x9a, 0xbc, 0xad, 0x19, 0x13, 0x98, 0x1a, 0x24, 0xda, 0x8c, 0x42, 0xa1,
+    0xbd, 0x29, 0x22, 0x98, 0x61, 0x35, 0x91, 0x8a, 0x42, 0x81, 0xca, 0x8a, 0x81, 0xa9, 0x61, 0x46,
+    0x02, 0x00, 0x21, 0x13, 0x88, 0x41, 0x25, 0x01, 0x31, 0x47, 0x23, 0x32, 0x45, 0x22, 0x90, 0x99,
+    0xa9, 0xba, 0x29, 0x46, 0x24, 0x12, 0x43, 0x44, 0x32, 0x11, 0x01, 0xa8, 0xcc, 0x89, 0x21, 0x01,
+    0x20, 0x56, 0x22, 0x81, 0x80, 0xc9, 0xcd, 0xac, 0x9a, 0xa9, 0xba, 0x89, 0x31, 0xa0, 0xcd, 0xab,
+    0xca, 0xbe, 0xac, 0xbb, 0xcd, 0xab, 0x19, 0x11, 0xa8, 0xaa, 0xdb, 0xdc, 0xaa, 0x99, 0xc9, 0xab,
+    0x89, 0x11, 0x08, 0x20, 0x01, 0x98, 0x80, 0xfa, 0xbf, 0x9b, 0x89, 0x00, 0x54, 0x24, 0x11, 0x42,
+    0x34, 0xd9, 0x2f, 0x00, 0x36, 0x01, 0x88, 0x31, 0x23, 0x21, 0x46, 0x23, 0x98, 0x30, 0x37, 0x23,
+    0x01, 0x21, 0x02, 0x08, 0x62, 0x34, 0x22, 0x32, 0x37, 0x14, 0x01, 0x11, 0x32, 0x23, 0x33, 0x02,
+    0xeb, 0xac, 0x89, 0x98, 0xba, 0xcd, 0xaa, 0x8a, 0xa8, 0xbc, 0xcc, 0xca, 0x89, 0x31, 0x91, 0xdc,
+    0x89, 0x11, 0x11, 0x32, 0x93, 0xef, 0xbb, 0xbb, 0xcd, 0xac, 0x9a, 0x89, 0x99, 0x99, 0xa9, 0x89,
+    0x10, 0x32, 0x91, 0xfd, 0xbb, 0x19, 0x34, 0x13, 0x32, 0x14, 0x91, 0x89, 0xa0, 0xff, 0xcb, 0x9a,
+    0x98, 0x88, 0x21, 0x43, 0x43, 0x43, 0x22, 0x00, 0x00, 0x11, 0x21, 0x22, 0x10, 0x73, 0x47, 0x33,
+    0x23, 0x91, 0xcb, 0xbc, 0xcb, 0xaa, 0x99, 0xaa, 0x28, 0x56, 0x13, 0x10, 0x42, 0x02, 0xca, 0x89,
+    0x01, 0xdb, 0x1a, 0x54, 0x02, 0x88, 0x51, 0x13, 0xc9, 0xbb, 0xaa, 0xcd, 0x8b, 0x42, 0x24, 0x98,
+    0x18, 0x23, 0x90, 0x9a, 0x14, 0x01, 0x25, 0x00, 0x01, 0xf9, 0xae, 0x9a, 0x80, 0x80, 0x52, 0x44,
+    0x12, 0x80, 0x99, 0xa9, 0x19, 0x32, 0x01, 0x28, 0x34, 0x23, 0x74, 0x44, 0x81, 0x89, 0x31, 0x13,
+    0xcb, 0x1b, 0x43, 0x12, 0x73, 0x35, 0x02, 0x9a, 0x18, 0x23, 0x90, 0x30, 0x36, 0x12, 0x80, 0x90,
+    0xb9, 0xad, 0xab, 0xa9, 0xfc, 0xce, 0xab, 0x28, 0x12, 0x00, 0x11, 0xa1, 0xce, 0x09, 0x01, 0xda,
+    0xad, 0x9a, 0xba, 0xcd, 0x9a, 0xaa, 0xbc, 0xcb, 0xba, 0xcc, 0xac, 0x99, 0x80, 0xa8, 0xba, 0xa9,
+    0xbb, 0x9a, 0x98, 0xde, 0xac, 0x09, 0x80, 0x00, 0x32, 0x82, 0x09, 0x56, 0x12, 0xb9, 0x8a, 0x11,
+    0x21, 0x74, 0x35, 0x33, 0x44, 0x34, 0x24, 0x22, 0x22, 0x43, 0x22, 0x11, 0x11, 0x22, 0x53, 0x55,
+    0x34, 0x12, 0x00, 0x43, 0x24, 0x32, 0x53, 0x12, 0x00, 0x31, 0x25, 0x81, 0x10, 0x43, 0x92, 0xaa,
+    0x8a, 0xca, 0xac, 0x30, 0x14, 0xea, 0xbc, 0x9a, 0xb9, 0x25, 0x29, 0x00, 0x98, 0xb9, 0xbc, 0xbc,
+    0xce, 0xab, 0x99, 0xb9, 0xbe, 0x0a, 0x98, 0xda, 0xac, 0xba, 0xcc, 0x9a, 0x89, 0xdb, 0xac, 0xaa,
+    0x88, 0x88, 0x88, 0x98, 0xa9, 0xa9, 0x98, 0xfb, 0xbf, 0xab, 0x99, 0xb9, 0xcb, 0xaa, 0xaa, 0x38,
+    0x46, 0x03, 0x88, 0x18, 0x21, 0x12, 0x02, 0xb9, 0x8c, 0x73, 0x34, 0x12, 0x80, 0x18, 0x54, 0x34,
+    0x22, 0xa0, 0xcb, 0x29, 0x47, 0x22, 0x00, 0x32, 0x43, 0x21, 0x44, 0x14, 0x01, 0x30, 0x37, 0x02,
+    0x99, 0x28, 0x44, 0x22, 0x31, 0x23, 0xc9, 0x8c, 0x55, 0x34, 0x11, 0x31, 0x44, 0x22, 0x33, 0x35,
+    0x14, 0x10, 0x21, 0x23, 0xb8, 0x9a, 0x53, 0x24, 0x22, 0x34, 0x12, 0x08, 0x73, 0x24, 0x01, 0x98,
+    0x89, 0x08, 0x00, 0x10, 0x10, 0x90, 0x20, 0x46, 0x92, 0xdf, 0xab, 0xab, 0xbd, 0xcb, 0xcb, 0xcc,
+    0xaa, 0xaa, 0xba, 0xcb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbd, 0xbc, 0xab, 0xbb, 0x5c, 0xed, 0x2e, 0x00,
+    0xbc, 0xbc, 0xbd, 0xbb, 0xbb, 0xab, 0xbc, 0xbd, 0xac, 0x9a, 0xab, 0x9a, 0x89, 0xda, 0xab, 0x99,
+    0xca, 0xad, 0x8a, 0x80, 0x99, 0x09, 0x32, 0x23, 0x55, 0x45, 0x33, 0x11, 0x21, 0x43, 0x33, 0x44,
+    0x44, 0x33, 0x33, 0x45, 0x34, 0x33, 0x43, 0x24, 0x33, 0x33, 0x34, 0x34, 0x32, 0x35, 0x35, 0x33,
+    0x43, 0x24, 0x33, 0x33, 0x34, 0x34, 0x12, 0x22, 0x33, 0x23, 0x22, 0x44, 0x33, 0x22, 0x23, 0x33,
+    0x03, 0x88, 0x64, 0x34, 0x81, 0x99, 0x99, 0xca, 0x9b, 0x09, 0xd8, 0xde, 0xbc, 0xca, 0xba, 0xcb,
+    0xbb, 0xcb, 0xdb, 0xbb, 0xbc, 0xbc, 0xac, 0xbb, 0xbb, 0xbd, 0xcc, 0xcb, 0xaa, 0xa9, 0xbb, 0xbc,
+    0xcb, 0xbc, 0xbc, 0xba, 0xdb, 0xcb, 0xab, 0xaa, 0xcb, 0xab, 0xab, 0xab, 0xaa, 0x89, 0xb9, 0xdd,
+    0xbb, 0xaa, 0xaa, 0xac, 0x99, 0xa9, 0x9a, 0x08, 0x90, 0x09, 0x63, 0x35, 0x24, 0x02, 0x08, 0x38,
+    0xd3, 0x96, 0x21, 0x00, 0x47, 0x45, 0x24, 0x23, 0x21, 0x52, 0x43, 0x42, 0x42, 0x33, 0x22, 0x42,
+    0x34, 0x24, 0x33, 0x45, 0x33, 0x32, 0x32, 0x34, 0x43, 0x43, 0x44, 0x22, 0x21, 0x32, 0x34, 0x34,
+    0x32, 0x23, 0x32, 0x32, 0x43, 0x33, 0x33, 0x23, 0x54, 0x34, 0x24, 0x11, 0x22, 0x21, 0x21, 0x12,
+    0x81, 0xba, 0xcb, 0xaa, 0xcb, 0xcc, 0xcb, 0xaa, 0xaa, 0xdd, 0xce, 0xcb, 0xaa, 0xbb, 0xcb, 0xbb,
+    0xbe, 0xbc, 0x9b, 0xa9, 0xcb, 0xcb, 0xbb, 0xbe, 0xbb, 0xbb, 0xbc, 0xad, 0xab, 0xbb, 0xbd, 0xbb,
+    0xbb, 0xbb, 0xbc, 0xbc, 0xcc, 0xbb, 0xbb, 0x99, 0xaa, 0xbc, 0xbb, 0xbc, 0xaa, 0x9a, 0xca, 0xbd,
+    0xac, 0x9a, 0x9a, 0x99, 0x89, 0x89, 0x08, 0x31, 0x23, 0x98, 0x50, 0x36, 0x24, 0x32, 0x47, 0x34,
+    0x53, 0x34, 0x34, 0x22, 0x42, 0x43, 0x33, 0x32, 0x33, 0x43, 0x43, 0x44, 0x34, 0x23, 0x33, 0x53,
+    0x33, 0x43, 0x43, 0x32, 0xd5, 0x0a, 0x30, 0x00, 0x33, 0x24, 0x43, 0x53, 0x33, 0x33, 0x35, 0x23,
+    0x22, 0x33, 0x34, 0x24, 0x23, 0x13, 0x12, 0x21, 0x53, 0x53, 0x32, 0x12, 0x00, 0x21, 0x32, 0x22,
+    0x33, 0x22, 0xa0, 0xed, 0xab, 0x99, 0xfa, 0xbc, 0xab, 0xec, 0xcc, 0xaa, 0xa9, 0xdb, 0xbb, 0xba,
+    0xcc, 0xbb, 0xaa, 0xbb, 0xbe, 0xbb, 0xbb, 0xdb, 0xcb, 0xba, 0xbb, 0xcc, 0xba, 0xaa, 0xcb, 0xbc,
+    0xac, 0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xbc, 0xbb, 0xac, 0xab, 0xa9, 0xa9, 0xba, 0xbc, 0xcc, 0xab,
+    0x89, 0x80, 0xa9, 0x89, 0x00, 0xba, 0x38, 0x67, 0x12, 0x11, 0x21, 0x21, 0x20, 0x73, 0x45, 0x24,
+    0x23, 0x32, 0x34, 0x24, 0x34, 0x35, 0x23, 0x23, 0x24, 0x24, 0x43, 0x42, 0x22, 0x33, 0x34, 0x22,
+    0x43, 0x33, 0x33, 0x45, 0x33, 0x24, 0x33, 0x34, 0x33, 0x35, 0x32, 0x33, 0x35, 0x14, 0x12, 0x32,
+    0x12, 0x31, 0x54, 0x23, 0x02, 0x80, 0x98, 0x00, 0x0f, 0x32, 0x20, 0x00, 0x01, 0x80, 0x12, 0xf9,
+    0xef, 0x99, 0x98, 0xba, 0x9b, 0x98, 0xeb, 0xad, 0xab, 0x9a, 0xab, 0x9a, 0xaa, 0xea, 0xcc, 0x9a,
+    0x08, 0x80, 0x99, 0x98, 0xda, 0xcc, 0xab, 0xbb, 0xbc, 0xdb, 0xcb, 0xbb, 0xbc, 0xbc, 0xac, 0x89,
+    0x99, 0xa9, 0x9b, 0x8a, 0x99, 0x09, 0x74, 0x33, 0x12, 0x41, 0x33, 0x90, 0x99, 0x11, 0x33, 0x33,
+    0x92, 0xac, 0x39, 0x12, 0x74, 0x77, 0x14, 0x11, 0x21, 0x33, 0x32, 0x44, 0x44, 0x32, 0x23, 0x11,
+    0x10, 0x80, 0x99, 0x10, 0x91, 0xec, 0xbc, 0xcb, 0xbb, 0x08, 0x11, 0x11, 0x53, 0x02, 0x89, 0x73,
+    0x33, 0x32, 0x45, 0x13, 0xa9, 0xab, 0xbb, 0xbe, 0xab, 0xcc, 0xdc, 0xdb, 0xbb, 0xac, 0xab, 0xab,
+    0xbb, 0xba, 0xcd, 0xab, 0xaa, 0xba, 0xab, 0x99, 0xdb, 0xdc, 0xba, 0xbb, 0xbc, 0xba, 0xaa, 0xbc,
+    0xbd, 0xbc, 0xbb, 0xbb, 0x8a, 0x99, 0xa9, 0x89, 0xa8, 0xcd, 0x19, 0x44, 0x2f, 0xc4, 0x24, 0x00,
+    0x12, 0x00, 0x32, 0xb1, 0xcf, 0x1a, 0x52, 0x22, 0x21, 0x44, 0x12, 0x10, 0x52, 0x46, 0x33, 0x33,
+    0x34, 0x33, 0x43, 0x43, 0x54, 0x43, 0x32, 0x22, 0x32, 0x43, 0x42, 0x43, 0x44, 0x32, 0x32, 0x22,
+    0x34, 0x34, 0x33, 0x34, 0x25, 0x13, 0x11, 0x31, 0x33, 0x22, 0x53, 0x34, 0x13, 0x08, 0x30, 0x44,
+    0x22, 0x53, 0x34, 0x24, 0x21, 0x31, 0x43, 0x22, 0x33, 0x25, 0x02, 0x90, 0xda, 0xbd, 0xaa, 0xaa,
+    0xcc, 0xbc, 0xdb, 0xdb, 0xbb, 0xab, 0xa9, 0xba, 0xbc, 0xba, 0xdc, 0xcb, 0xab, 0x9a, 0xba, 0xcc,
+    0xbc, 0xcc, 0xbc, 0xab, 0xba, 0xcb, 0xbc, 0xbc, 0xbc, 0xac, 0xaa, 0xab, 0xab, 0xaa, 0xbc, 0xbd,
+    0xab, 0xba, 0xbb, 0xac, 0xba, 0xcd, 0xbd, 0xba, 0xaa, 0xbb, 0xac, 0xbb, 0xbc, 0xad, 0xab, 0xba,
+    0x9a, 0x89, 0x00, 0x10, 0x11, 0x01, 0x41, 0x56, 0x53, 0x22, 0x22, 0x32, 0x24, 0x22, 0x43, 0x46,
+    0x36, 0xa6, 0x2f, 0x00, 0x23, 0x23, 0x34, 0x24, 0x12, 0x42, 0x45, 0x24, 0x23, 0x32, 0x34, 0x33,
+    0x34, 0x36, 0x43, 0x23, 0x33, 0x43, 0x33, 0x44, 0x33, 0x44, 0x32, 0x33, 0x22, 0x43, 0x34, 0x24,
+    0x33, 0x34, 0x22, 0x11, 0x42, 0x34, 0x14, 0x12, 0x43, 0x32, 0x01, 0x21, 0x44, 0x22, 0x21, 0x32,
+    0x33, 0x90, 0x09, 0x20, 0x02, 0xc9, 0xcd, 0xcb, 0xcb, 0xcc, 0xbc, 0xbb, 0xac, 0xcb, 0xcb, 0xaa,
+    0xcb, 0xbd, 0xac, 0x99, 0xc9, 0xcb, 0xbb, 0xdb, 0xdb, 0xbb, 0xba, 0xcb, 0xcc, 0xab, 0xbc, 0xdb,
+    0xba, 0xab, 0xbb, 0xbc, 0xcb, 0xcb, 0xbb, 0xaa, 0xab, 0xbb, 0xac, 0xbc, 0xbc, 0xac, 0xaa, 0xca,
+    0xbb, 0xca, 0xca, 0xcb, 0xbb, 0xab, 0xbb, 0xbc, 0xab, 0xcb, 0xcb, 0x99, 0x88, 0x88, 0x09, 0x01,
+    0x00, 0x41, 0x36, 0x12, 0x10, 0x73, 0x23, 0x23, 0x44, 0x34, 0x32, 0x31, 0x54, 0x34, 0x32, 0x53,
+    0x53, 0x22, 0x21, 0x34, 0x0d, 0xb9, 0x2d, 0x00, 0x35, 0x42, 0x33, 0x33, 0x33, 0x34, 0x44, 0x33,
+    0x35, 0x32, 0x23, 0x43, 0x34, 0x43, 0x32, 0x34, 0x34, 0x12, 0x32, 0x44, 0x32, 0x32, 0x44, 0x33,
+    0x22, 0x42, 0x34, 0x34, 0x33, 0x43, 0x43, 0x23, 0x33, 0x53, 0x33, 0x22, 0x23, 0x24, 0x23, 0x23,
+    0x01, 0x21, 0x32, 0x81, 0x08, 0x44, 0x14, 0x88, 0x89, 0x18, 0x20, 0x18, 0x72, 0x35, 0xa0, 0xae,
+    0x09, 0x81, 0xc9, 0xbb, 0xcd, 0xce, 0xdb, 0xab, 0xbb, 0xbc, 0xcb, 0xac, 0xbb, 0xbc, 0xac, 0x9a,
+    0xa9, 0xbb, 0xbd, 0xdb, 0xbb, 0xac, 0xbb, 0xbc, 0xbc, 0xbd, 0xbc, 0xbb, 0xcb, 0xac, 0xab, 0xac,
+    0xbb, 0xac, 0xac, 0xaa, 0xbb, 0xcb, 0xbb, 0xdb, 0xcb, 0x9a, 0xaa, 0xac, 0xaa, 0xca, 0xab, 0xba,
+    0xeb, 0xcb, 0xca, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xad, 0x18, 0x88, 0x08, 0x32, 0x82, 0xaa,
+    0x80, 0x98, 0x48, 0x25, 0xa1, 0x8a, 0xb9, 0x8b, 0xf6, 0x9b, 0x14, 0x00, 0x77, 0x34, 0x34, 0x34,
+    0x43, 0x43, 0x35, 0x33, 0x34, 0x34, 0x32, 0x22, 0x32, 0x35, 0x34, 0x34, 0x35, 0x33, 0x34, 0x53,
+    0x43, 0x33, 0x33, 0x33, 0x44, 0x32, 0x43, 0x34, 0x34, 0x43, 0x43, 0x43, 0x42, 0x33, 0x32, 0x24,
+    0x24, 0x12, 0x33, 0x24, 0x23, 0x43, 0x33, 0x33, 0x35, 0x34, 0x43, 0x34, 0x32, 0x42, 0x43, 0x22,
+    0x32, 0x24, 0x00, 0x10, 0x80, 0xa9, 0x10, 0x81, 0x09, 0x52, 0x12, 0x18, 0x44, 0x13, 0x00, 0xb8,
+    0xdf, 0xcb, 0xbb, 0xad, 0xab, 0xbc, 0xbd, 0xbb, 0xbc, 0xcc, 0xba, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb,
+    0xbc, 0xbb, 0xdb, 0xbb, 0xbb, 0xbc, 0xac, 0xba, 0xcb, 0xbb, 0xbc, 0xbc, 0xcb, 0xcb, 0xbb, 0xbd,
+    0xcb, 0xac, 0xab, 0xbb, 0xac, 0xaa, 0xba, 0x9c, 0x9a, 0xaa, 0xab, 0xca, 0xdb, 0xab, 0xbc, 0xbc,
+    0xaa, 0xba, 0xac, 0xaa, 0xba, 0x9b, 0x18, 0x98, 0x09, 0x33, 0x90, 0x71, 0x39, 0x8f, 0x21, 0x00,
+    0x37, 0x33, 0x63, 0x33, 0x43, 0x43, 0x34, 0x43, 0x34, 0x33, 0x53, 0x42, 0x22, 0x32, 0x34, 0x33,
+    0x33, 0x34, 0x33, 0x54, 0x43, 0x34, 0x43, 0x43, 0x33, 0x44, 0x32, 0x33, 0x24, 0x32, 0x32, 0x43,
+    0x23, 0x34, 0x33, 0x44, 0x32, 0x33, 0x35, 0x33, 0x34, 0x24, 0x23, 0x33, 0x43, 0x32, 0x43, 0x32,
+    0x11, 0x11, 0x00, 0x88, 0x88, 0x9a, 0x9a, 0xb9, 0xbd, 0xab, 0xf9, 0xbc, 0x9b, 0xb9, 0xcc, 0x9a,
+    0xb9, 0xbc, 0x9a, 0xca, 0xbb, 0xaa, 0xdd, 0xbd, 0xdc, 0xbc, 0xbd, 0xbb, 0xbc, 0xbb, 0xbc, 0xbc,
+    0xcb, 0xbb, 0xcb, 0xaa, 0xbb, 0xcb, 0xcb, 0xcb, 0xac, 0xbb, 0xac, 0xab, 0xcb, 0xcb, 0xbc, 0xbb,
+    0xac, 0xbb, 0xa9, 0xaa, 0xab, 0xb9, 0xba, 0xac, 0x9a, 0xaa, 0xab, 0xdb, 0xcd, 0xbd, 0xba, 0xbc,
+    0xba, 0xaa, 0xcc, 0xcb, 0xac, 0xac, 0xab, 0xab, 0xaa, 0xa9, 0x89, 0x10, 0x52, 0x54, 0x44, 0x43,
+    0x6f, 0xc7, 0x2b, 0x00, 0x33, 0x34, 0x33, 0x43, 0x43, 0x23, 0x32, 0x42, 0x12, 0x10, 0x21, 0x23,
+    0x43, 0x45, 0x43, 0x33, 0x34, 0x43, 0x33, 0x35, 0x43, 0x23, 0x22, 0x12, 0x10, 0x31, 0x54, 0x44,
+    0x43, 0x43, 0x33, 0x24, 0x43, 0x34, 0x43, 0x43, 0x33, 0x22, 0x33, 0x34, 0x43, 0x44, 0x43, 0x32,
+    0x22, 0x13, 0x02, 0x00, 0x00, 0xa8, 0xcb, 0xcb, 0xdc, 0xcb, 0xaa, 0x9a, 0x88, 0x42, 0x53, 0x33,
+    0x34, 0x23, 0x23, 0x33, 0x34, 0x12, 0x81, 0xca, 0xdd, 0xcb, 0xaa, 0x99, 0x00, 0x21, 0x12, 0xb9,
+    0xcd, 0xcd, 0xbc, 0xcb, 0xbc, 0xbc, 0xbc, 0xcc, 0xbb, 0xab, 0xbb, 0xab, 0x9a, 0xb9, 0xeb, 0xdb,
+    0xcb, 0xcb, 0xab, 0xab, 0xbb, 0xbb, 0xac, 0xcb, 0x9a, 0x08, 0x43, 0x43, 0x43, 0x01, 0xba, 0xcd,
+    0xdb, 0xcb, 0xbb, 0xbc, 0xcc, 0xbb, 0xbb, 0xbb, 0x9a, 0x00, 0x11, 0x21, 0x12, 0x98, 0xbb, 0xbd,
+    0xcc, 0xaa, 0x99, 0x88, 0x53, 0xc2, 0x1e, 0x00, 0x31, 0x56, 0x34, 0x45, 0x53, 0x33, 0x43, 0x22,
+    0x22, 0x01, 0x80, 0x00, 0x88, 0x80, 0x21, 0x53, 0x44, 0x54, 0x43, 0x33, 0x43, 0x23, 0x12, 0x11,
+    0x01, 0x99, 0xaa, 0xcb, 0x9b, 0x40, 0x47, 0x35, 0x45, 0x33, 0x43, 0x43, 0x32, 0x32, 0x23, 0x22,
+    0x00, 0x98, 0xa9, 0xaa, 0x08, 0x53, 0x35, 0x35, 0x43, 0x23, 0x22, 0x11, 0x88, 0xba, 0xdc, 0xdb,
+    0xdb, 0xab, 0xab, 0x99, 0x28, 0x44, 0x44, 0x33, 0x33, 0x33, 0x21, 0x00, 0x90, 0xcb, 0xcc, 0xcc,
+    0xbb, 0xbb, 0x9a, 0x20, 0x35, 0x35, 0x32, 0x13, 0x90, 0xcc, 0xcd, 0xcc, 0xbc, 0xcb, 0xac, 0xbb,
+    0xbb, 0xab, 0x9a, 0x08, 0x11, 0x23, 0x23, 0x11, 0xb9, 0xbf, 0xbd, 0xcb, 0xac, 0xbb, 0xba, 0xaa,
+    0x0a, 0x30, 0x54, 0x53, 0x33, 0x12, 0x90, 0xea, 0xcc, 0xcc, 0xbb, 0xad, 0xcb, 0xba, 0xaa, 0xab,
+    0x99, 0x89, 0x10, 0x21, 0x11, 0x90, 0xc9, 0xbc, 0x8c, 0xce, 0x23, 0x00, 0xbd, 0xbb, 0x9b, 0x89,
+    0x52, 0x54, 0x44, 0x34, 0x35, 0x33, 0x34, 0x33, 0x12, 0x01, 0x98, 0xcb, 0xbc, 0xbc, 0xcb, 0xba,
+    0xaa, 0x99, 0x00, 0x32, 0x44, 0x43, 0x33, 0x33, 0x33, 0x22, 0x33, 0x34, 0x35, 0x46, 0x44, 0x53,
+    0x53, 0x33, 0x34, 0x24, 0x33, 0x33, 0x33, 0x22, 0x12, 0x80, 0xa9, 0xbb, 0xbc, 0xaa, 0x8a, 0x08,
+    0x11, 0x22, 0x32, 0x32, 0x32, 0x33, 0x82, 0xcc, 0xcd, 0xbb, 0x8b, 0x62, 0x46, 0x45, 0x53, 0x33,
+    0x34, 0x34, 0x32, 0x33, 0x23, 0x11, 0x90, 0xdb, 0xcc, 0xbc, 0xbc, 0xbc, 0xba, 0xcb, 0xab, 0xbb,
+    0xbc, 0xbb, 0xbb, 0xbc, 0xcb, 0xcb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0xbb, 0x9c, 0x9a,
+    0x9a, 0xa9, 0xaa, 0xdc, 0xcc, 0xbc, 0xbd, 0xcc, 0xbb, 0xbc, 0xcb, 0xbb, 0xba, 0xbb, 0xba, 0x9a,
+    0x9a, 0x99, 0xa9, 0xba, 0xbd, 0xbe, 0xbd, 0xbc, 0xbc, 0xab, 0xab, 0x99, 0x9f, 0xd2, 0x20, 0x00,
+    0x88, 0x32, 0x36, 0x35, 0x44, 0x32, 0x33, 0x12, 0x11, 0x98, 0xaa, 0xbb, 0xaa, 0x9a, 0x41, 0x47,
+    0x44, 0x44, 0x44, 0x33, 0x34, 0x33, 0x24, 0x22, 0x22, 0x12, 0x12, 0x22, 0x23, 0x43, 0x34, 0x44,
+    0x53, 0x43, 0x24, 0x33, 0x23, 0x22, 0x01, 0x88, 0x88, 0x00, 0x21, 0x44, 0x34, 0x37, 0x44, 0x44,
+    0x43, 0x43, 0x23, 0x33, 0x22, 0x12, 0x01, 0x08, 0x88, 0x9a, 0xba, 0xca, 0xab, 0x8a, 0x10, 0x42,
+    0x34, 0x14, 0xa0, 0xdc, 0xcd, 0xdb, 0xbb, 0xac, 0xbb, 0xcb, 0xaa, 0xab, 0x99, 0x10, 0x34, 0x36,
+    0x33, 0x14, 0x01, 0xa8, 0xcb, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xcc, 0xca, 0xaa, 0xaa, 0xbb, 0xcb,
+    0xcc, 0xbc, 0xbd, 0xbc, 0xcb, 0xbb, 0xbb, 0xba, 0xba, 0xaa, 0xa9, 0x18, 0x42, 0x35, 0x34, 0x24,
+    0x02, 0x90, 0xaa, 0xcb, 0xbc, 0xbc, 0xcb, 0xbc, 0xac, 0xbb, 0xaa, 0x9a, 0x80, 0x80, 0xa9, 0xeb,
+    0x74, 0xd8, 0x21, 0x00, 0xdc, 0xcb, 0xcb, 0xba, 0xbb, 0x9a, 0x99, 0x20, 0x73, 0x53, 0x53, 0x53,
+    0x23, 0x24, 0x22, 0x12, 0x12, 0x11, 0x21, 0x11, 0x22, 0x43, 0x34, 0x35, 0x35, 0x34, 0x43, 0x22,
+    0x12, 0x80, 0x88, 0xb9, 0xdb, 0xbb, 0xbc, 0x9b, 0x28, 0x56, 0x44, 0x35, 0x34, 0x43, 0x33, 0x33,
+    0x24, 0x23, 0x23, 0x01, 0x81, 0x80, 0x88, 0x21, 0x54, 0x34, 0x35, 0x33, 0x24, 0x11, 0x81, 0x98,
+    0xca, 0xbc, 0xcc, 0xcb, 0xac, 0xaa, 0x8a, 0x10, 0x44, 0x34, 0x34, 0x33, 0x23, 0x12, 0x11, 0x88,
+    0xa9, 0xcc, 0xcc, 0xcb, 0xaa, 0x89, 0x20, 0x44, 0x34, 0x33, 0x12, 0xa0, 0xdc, 0xbd, 0xcd, 0xcb,
+    0xbc, 0xbb, 0xbc, 0xbb, 0xaa, 0x9a, 0x88, 0x21, 0x22, 0x22, 0x02, 0xb9, 0xbf, 0xcc, 0xcb, 0xbb,
+    0xcb, 0xaa, 0x9b, 0x0a, 0x30, 0x44, 0x34, 0x34, 0x22, 0x90, 0xeb, 0xcc, 0xcc, 0xbb, 0xcc, 0xba,
+    0xbb, 0xac, 0xaa, 0x99, 0x5e, 0xcf, 0x2c, 0x00, 0x88, 0x10, 0x20, 0x11, 0x88, 0xb9, 0xcd, 0xcb,
+    0xab, 0x9b, 0x09, 0x41, 0x55, 0x53, 0x34, 0x35, 0x43, 0x32, 0x33, 0x22, 0x00, 0x98, 0xcb, 0xdb,
+    0xbb, 0xbc, 0xbb, 0xaa, 0x99, 0x18, 0x41, 0x53, 0x33, 0x43, 0x33, 0x32, 0x22, 0x32, 0x53, 0x53,
+    0x44, 0x54, 0x43, 0x34, 0x44, 0x33, 0x43, 0x33, 0x33, 0x32, 0x23, 0x11, 0x80, 0xa9, 0xca, 0xab,
+    0xab, 0x99, 0x08, 0x11, 0x22, 0x33, 0x32, 0x32, 0x33, 0x81, 0xfb, 0xdb, 0xcb, 0x89, 0x41, 0x56,
+    0x44, 0x44, 0x33, 0x34, 0x34, 0x32, 0x33, 0x23, 0x11, 0x90, 0xcb, 0xbe, 0xcc, 0xcb, 0xbb, 0xbb,
+    0xcb, 0xcb, 0xba, 0xca, 0xba, 0xba, 0xba, 0xbc, 0xbc, 0xbc, 0xbd, 0xbb, 0xac, 0xbb, 0xaa, 0xab,
+    0xba, 0xaa, 0x99, 0x89, 0x88, 0x98, 0xda, 0xdd, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb,
+    0xbb, 0xab, 0xa9, 0x89, 0x88, 0x88, 0xa9, 0xeb, 0xac, 0xdf, 0x1e, 0x00, 0xeb, 0xdb, 0xbb, 0xcb,
+    0xbb, 0xaa, 0x99, 0x10, 0x63, 0x53, 0x34, 0x34, 0x33, 0x23, 0x11, 0x90, 0xbb, 0xbd, 0xad, 0xab,
+    0x9b, 0x09, 0x53, 0x46, 0x34, 0x45, 0x33, 0x34, 0x33, 0x33, 0x32, 0x22, 0x21, 0x10, 0x11, 0x21,
+    0x42, 0x54, 0x53, 0x34, 0x53, 0x32, 0x33, 0x22, 0x01, 0x99, 0xcb, 0xbc, 0xcb, 0xaa, 0x8a, 0x20,
+    0x54, 0x54, 0x34, 0x35, 0x43, 0x33, 0x33, 0x32, 0x21, 0x01, 0x08, 0x98, 0x98, 0x99, 0x09, 0x10,
+    0x43, 0x35, 0x34, 0x11, 0xb8, 0xdf, 0xbd, 0xbd, 0xcc, 0xbb, 0xac, 0xbb, 0xbb, 0xaa, 0x8a, 0x00,
+    0x32, 0x35, 0x25, 0x33, 0x32, 0x11, 0x80, 0xa9, 0xba, 0xdb, 0xba, 0xab, 0xbb, 0xab, 0x99, 0xba,
+    0xcd, 0xdd, 0xcd, 0xcc, 0xcc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0x89, 0x28, 0x42, 0x44,
+    0x33, 0x34, 0x32, 0x22, 0x12, 0x23, 0x32, 0x44, 0x33, 0x43, 0x34, 0x34, 0xb7, 0xf3, 0x24, 0x00,
+    0x34, 0x42, 0x12, 0x81, 0xb9, 0xce, 0xcc, 0xbc, 0xcb, 0xbb, 0xbb, 0xbb, 0xab, 0x99, 0x18, 0x42,
+    0x45, 0x43, 0x24, 0x33, 0x24, 0x22, 0x33, 0x34, 0x34, 0x34, 0x34, 0x43, 0x32, 0x24, 0x33, 0x33,
+    0x23, 0x01, 0xc9, 0xdc, 0xdb, 0xbb, 0xbc, 0xac, 0xba, 0xaa, 0x9b, 0x8a, 0x18, 0x32, 0x45, 0x34,
+    0x43, 0x33, 0x43, 0x32, 0x43, 0x43, 0x34, 0x44, 0x33, 0x43, 0x33, 0x43, 0x23, 0x24, 0x22, 0x01,
+    0xa8, 0xeb, 0xdb, 0xbb, 0xbb, 0xac, 0xaa, 0xab, 0xaa, 0x9a, 0x08, 0x52, 0x34, 0x34, 0x24, 0x22,
+    0x21, 0x22, 0x44, 0x53, 0x34, 0x34, 0x33, 0x34, 0x33, 0x33, 0x34, 0x22, 0x00, 0xca, 0xce, 0xcc,
+    0xcb, 0xac, 0xbb, 0xba, 0xac, 0xab, 0xbb, 0xbb, 0xbb, 0x9a, 0x99, 0xa9, 0xdb, 0xbd, 0xbd, 0xbb,
+    0xab, 0x9a, 0x89, 0x99, 0x99, 0xba, 0xbb, 0xa9, 0xca, 0xec, 0xcd, 0xcd, 0xbc, 0xad, 0xac, 0xba,
+    0x17, 0xe6, 0x2c, 0x00, 0xab, 0xbb, 0xbb, 0xcb, 0xba, 0x9a, 0x9a, 0x89, 0x98, 0xa9, 0xdb, 0xbc,
+    0xbc, 0xaa, 0x89, 0x32, 0x37, 0x44, 0x33, 0x44, 0x33, 0x34, 0x34, 0x33, 0x22, 0x02, 0x90, 0xa9,
+    0x89, 0x10, 0x44, 0x35, 0x35, 0x43, 0x43, 0x34, 0x43, 0x24, 0x33, 0x33, 0x32, 0x22, 0x23, 0x35,
+    0x35, 0x35, 0x35, 0x24, 0x24, 0x43, 0x32, 0x33, 0x34, 0x32, 0x23, 0x12, 0x01, 0x00, 0x00, 0x32,
+    0x44, 0x34, 0x35, 0x32, 0x33, 0x42, 0x32, 0x11, 0x81, 0xb9, 0xce, 0xcc, 0xba, 0xab, 0x89, 0x10,
+    0x53, 0x53, 0x33, 0x43, 0x33, 0x43, 0x12, 0x01, 0xa9, 0xcd, 0xbd, 0xcb, 0xba, 0xaa, 0x9a, 0x89,
+    0x99, 0xa9, 0xcb, 0xeb, 0xcb, 0xcc, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xaa, 0x9a, 0x88, 0x10, 0x22,
+    0x33, 0x34, 0x32, 0x11, 0xa9, 0xce, 0xcd, 0xdb, 0xca, 0xaa, 0xaa, 0x89, 0x09, 0x00, 0x11, 0x11,
+    0x81, 0xa8, 0xcd, 0xbe, 0x44, 0xff, 0x23, 0x00, 0xcd, 0xdb, 0xca, 0xaa, 0xab, 0x9a, 0x88, 0x00,
+    0x22, 0x42, 0x33, 0x22, 0x02, 0xb0, 0xec, 0xbc, 0xbd, 0xbc, 0xab, 0xaa, 0x09, 0x21, 0x35, 0x34,
+    0x24, 0x23, 0x01, 0xa0, 0xeb, 0xcc, 0xcc, 0xbb, 0xbc, 0xba, 0xaa, 0x08, 0x21, 0x53, 0x34, 0x43,
+    0x32, 0x12, 0x81, 0xa9, 0xdb, 0xbc, 0xbc, 0xbb, 0x9a, 0x18, 0x63, 0x44, 0x43, 0x43, 0x22, 0x12,
+    0x80, 0xba, 0xcc, 0xcc, 0xbb, 0xcb, 0xaa, 0x89, 0x20, 0x44, 0x44, 0x43, 0x43, 0x22, 0x12, 0x01,
+    0x98, 0xba, 0xbc, 0xbc, 0xbb, 0x9a, 0x18, 0x53, 0x45, 0x34, 0x43, 0x23, 0x13, 0x01, 0xa8, 0xda,
+    0xcb, 0xbb, 0xcb, 0x99, 0x00, 0x53, 0x45, 0x53, 0x33, 0x34, 0x32, 0x12, 0x01, 0x98, 0xca, 0xbb,
+    0xbc, 0xbb, 0x9a, 0x10, 0x44, 0x45, 0x34, 0x43, 0x33, 0x32, 0x11, 0x80, 0xa8, 0xbb, 0xad, 0x9b,
+    0x0a, 0x41, 0x45, 0x45, 0x43, 0x34, 0x42, 0x22, 0x01, 0x14, 0x2a, 0x00, 0x12, 0x01, 0x80, 0xa9,
+    0xbb, 0xcb, 0xab, 0x9a, 0x20, 0x54, 0x44, 0x34, 0x34, 0x43, 0x22, 0x11, 0x80, 0xa8, 0xba, 0xcc,
+    0xba, 0xab, 0x89, 0x20, 0x45, 0x44, 0x34, 0x43, 0x23, 0x22, 0x01, 0x98, 0xca, 0xcb, 0xbc, 0xbc,
+    0xaa, 0xaa, 0x08, 0x21, 0x42, 0x33, 0x23, 0x90, 0xec, 0xdc, 0xcc, 0xcb, 0xbc, 0xbb, 0xbc, 0xab,
+    0xaa, 0x89, 0x08, 0x22, 0x32, 0x24, 0x12, 0x81, 0xda, 0xdc, 0xdb, 0xbc, 0xbc, 0xcb, 0xab, 0xab,
+    0xab, 0xaa, 0xaa, 0xbb, 0xbd, 0xcc, 0xdb, 0xcb, 0xbc, 0xdb, 0xbb, 0xbb, 0xac, 0xaa, 0x98, 0x00,
+    0x10, 0x22, 0x23, 0x21, 0x81, 0xa9, 0xce, 0xcd, 0xdb, 0xbb, 0xbc, 0xbb, 0xaa, 0x89, 0x09, 0x00,
+    0x08, 0xa8, 0xca, 0xdb, 0xbd, 0xdc, 0xcb, 0xcb, 0xcb, 0xaa, 0x99, 0x00, 0x22, 0x34, 0x44, 0x32,
+    0x33, 0x33, 0x23, 0x22, 0x90, 0xda, 0xdb, 0xaa, 0x8a, 0x31, 0x45, 0x35, 0xe8, 0xdb, 0x22, 0x00,
+    0x33, 0x24, 0x22, 0x12, 0x01, 0x90, 0xca, 0xdc, 0xcb, 0xab, 0x9a, 0x31, 0x46, 0x35, 0x44, 0x33,
+    0x43, 0x32, 0x33, 0x24, 0x23, 0x22, 0x11, 0x21, 0x31, 0x45, 0x35, 0x45, 0x42, 0x32, 0x32, 0x22,
+    0x22, 0x12, 0x11, 0x88, 0xaa, 0xcb, 0xab, 0x19, 0x64, 0x45, 0x53, 0x43, 0x33, 0x43, 0x33, 0x43,
+    0x33, 0x33, 0x24, 0x23, 0x43, 0x43, 0x34, 0x35, 0x34, 0x33, 0x24, 0x12, 0x01, 0x80, 0x98, 0xbb,
+    0xbd, 0xbc, 0xbc, 0xaa, 0x09, 0x41, 0x45, 0x53, 0x33, 0x24, 0x33, 0x33, 0x24, 0x22, 0x22, 0x11,
+    0x00, 0x00, 0x21, 0x44, 0x34, 0x34, 0x23, 0x81, 0xc9, 0xcd, 0xbc, 0xbd, 0xcb, 0xbc, 0xbb, 0xac,
+    0xaa, 0x09, 0x20, 0x42, 0x33, 0x24, 0x11, 0x90, 0xb9, 0xcd, 0xbc, 0xbd, 0xbc, 0xbc, 0xba, 0xaa,
+    0x88, 0x18, 0x10, 0x00, 0xba, 0xbf, 0xcd, 0xdb, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x99,
+    0xe4, 0x08, 0x24, 0x00, 0x98, 0x99, 0xcb, 0xcd, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xba, 0x9a,
+    0x08, 0x32, 0x44, 0x33, 0x12, 0xa8, 0xdc, 0xdc, 0xcb, 0xbc, 0xbc, 0xbc, 0xca, 0xaa, 0xaa, 0x99,
+    0x88, 0x00, 0x80, 0x98, 0xba, 0xbd, 0xcc, 0xab, 0xac, 0xba, 0x9a, 0x0a, 0x40, 0x44, 0x45, 0x33,
+    0x33, 0x12, 0x90, 0xdb, 0xcc, 0xcb, 0xcb, 0xbb, 0xac, 0xab, 0x9a, 0x18, 0x42, 0x35, 0x34, 0x33,
+    0x22, 0x00, 0x99, 0xa9, 0xba, 0xaa, 0x9a, 0x19, 0x73, 0x55, 0x35, 0x45, 0x42, 0x22, 0x12, 0x01,
+    0x90, 0xa8, 0xaa, 0xba, 0xbb, 0xba, 0x89, 0x51, 0x55, 0x35, 0x35, 0x33, 0x24, 0x12, 0x11, 0x80,
+    0x08, 0x08, 0x10, 0x41, 0x43, 0x45, 0x35, 0x44, 0x43, 0x33, 0x33, 0x23, 0x11, 0x88, 0xb9, 0xca,
+    0xba, 0xaa, 0x89, 0x41, 0x45, 0x54, 0x43, 0x34, 0x33, 0x24, 0x23, 0x12, 0x10, 0x80, 0x08, 0x00,
+    0x32, 0x45, 0x35, 0x34, 0xd0, 0x2d, 0x2a, 0x00, 0x44, 0x32, 0x24, 0x32, 0x12, 0x81, 0x98, 0xcb,
+    0xcb, 0xab, 0x99, 0x20, 0x44, 0x44, 0x43, 0x43, 0x23, 0x24, 0x22, 0x11, 0x88, 0xcb, 0xdb, 0xab,
+    0x8a, 0x10, 0x44, 0x34, 0x34, 0x34, 0x42, 0x22, 0x22, 0x01, 0xb8, 0xdd, 0xdb, 0xcb, 0xab, 0xab,
+    0xaa, 0xa9, 0xa9, 0xba, 0xac, 0xbb, 0xbc, 0xcb, 0xbc, 0xbd, 0xbc, 0xab, 0x8b, 0x18, 0x53, 0x34,
+    0x24, 0x23, 0x12, 0x98, 0xda, 0xdc, 0xcc, 0xcc, 0xbb, 0xad, 0xbb, 0xac, 0xaa, 0xaa, 0xa9, 0xaa,
+    0xab, 0xba, 0xcb, 0xcb, 0xdb, 0xbb, 0xac, 0xbb, 0xa9, 0x09, 0x18, 0x11, 0x11, 0x00, 0x90, 0xeb,
+    0xcd, 0xbe, 0xcd, 0xcb, 0xcb, 0xba, 0xaa, 0xaa, 0xaa, 0xa9, 0xab, 0xba, 0xaa, 0xbb, 0xcc, 0xcd,
+    0xcc, 0xcb, 0xbb, 0xab, 0x09, 0x10, 0x33, 0x53, 0x32, 0x43, 0x34, 0x33, 0x14, 0x81, 0xdb, 0xdc,
+    0xbb, 0xbb, 0x8a, 0x08, 0x11, 0x11, 0x00, 0x08, 0x71, 0xb4, 0x1e, 0x00, 0x31, 0x63, 0x23, 0x91,
+    0xed, 0xcc, 0xcb, 0x9a, 0x10, 0x52, 0x34, 0x43, 0x33, 0x33, 0x34, 0x44, 0x32, 0x13, 0x01, 0x99,
+    0xbb, 0x8b, 0x41, 0x46, 0x44, 0x33, 0x43, 0x22, 0x33, 0x33, 0x34, 0x12, 0x98, 0xbc, 0xae, 0xab,
+    0x89, 0x32, 0x36, 0x35, 0x43, 0x24, 0x24, 0x43, 0x33, 0x33, 0x23, 0x11, 0x01, 0x10, 0x42, 0x44,
+    0x34, 0x34, 0x43, 0x23, 0x24, 0x32, 0x23, 0x12, 0x00, 0xaa, 0xab, 0x9b, 0x38, 0x65, 0x44, 0x53,
+    0x33, 0x44, 0x32, 0x33, 0x33, 0x12, 0x80, 0xa9, 0xab, 0xbb, 0x89, 0x41, 0x54, 0x44, 0x34, 0x35,
+    0x43, 0x43, 0x12, 0x02, 0x00, 0xa9, 0xca, 0xba, 0xbc, 0xba, 0xbb, 0xbb, 0x8a, 0x08, 0x10, 0x81,
+    0xd9, 0xdd, 0xdb, 0xcb, 0xbb, 0xab, 0xab, 0x89, 0x18, 0x34, 0x46, 0x43, 0x23, 0x13, 0x80, 0xdb,
+    0xcc, 0xbd, 0xbc, 0xbc, 0xcb, 0xbb, 0xbb, 0xab, 0x99, 0x89, 0x88, 0xa8, 0x00, 0x23, 0x20, 0x00,
+    0xca, 0xcc, 0xbc, 0xbc, 0xbc, 0xcc, 0xab, 0xbb, 0xab, 0x89, 0x28, 0x31, 0x23, 0x11, 0xa9, 0xdc,
+    0xcc, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbb, 0xaa, 0x89, 0x89, 0xa9, 0xca, 0xdb, 0xcb, 0xbc, 0xdb,
+    0xcb, 0xcb, 0xbb, 0xab, 0x9a, 0x08, 0x32, 0x43, 0x33, 0x22, 0x01, 0xb9, 0xdd, 0xdc, 0xcc, 0xcb,
+    0xac, 0xbb, 0xaa, 0x9a, 0x98, 0x80, 0x88, 0x80, 0x80, 0x98, 0xca, 0xce, 0xbd, 0xbd, 0xcb, 0xba,
+    0xa9, 0x89, 0x88, 0x88, 0x08, 0x88, 0x00, 0x90, 0xea, 0xec, 0xdb, 0xcb, 0xab, 0x9a, 0x08, 0x22,
+    0x53, 0x42, 0x32, 0x34, 0x33, 0x23, 0x91, 0xfb, 0xcc, 0xbc, 0xbc, 0xaa, 0x99, 0x89, 0x00, 0x12,
+    0x34, 0x45, 0x53, 0x23, 0x33, 0x22, 0x10, 0x08, 0x11, 0x44, 0x44, 0x34, 0x53, 0x32, 0x34, 0x43,
+    0x43, 0x32, 0x11, 0x90, 0xb9, 0xcb, 0xab, 0x8a, 0x10, 0x43, 0x35, 0x45, 0x34, 0x35, 0x34, 0x24,
+    0x17, 0xf1, 0x32, 0x00, 0x23, 0x12, 0x11, 0x01, 0x21, 0x33, 0x35, 0x34, 0x34, 0x34, 0x35, 0x53,
+    0x33, 0x33, 0x12, 0x81, 0x99, 0xbb, 0xab, 0xab, 0x9a, 0x89, 0x20, 0x73, 0x46, 0x44, 0x43, 0x23,
+    0x22, 0x01, 0x80, 0x89, 0x08, 0x10, 0x21, 0x32, 0x34, 0x46, 0x54, 0x43, 0x24, 0x13, 0x02, 0x99,
+    0xdb, 0xbb, 0xbc, 0xac, 0xbb, 0xbb, 0xac, 0x8a, 0x28, 0x44, 0x53, 0x22, 0x02, 0x98, 0xcb, 0xcb,
+    0xba, 0xbb, 0xbb, 0xbc, 0xbb, 0x09, 0x73, 0x44, 0x34, 0x32, 0x01, 0xb9, 0xcc, 0xdb, 0xba, 0xac,
+    0xbb, 0xbb, 0xac, 0x8a, 0x10, 0x44, 0x43, 0x13, 0x81, 0xc9, 0xcc, 0xbc, 0xcb, 0xac, 0xbb, 0xac,
+    0xab, 0x89, 0x10, 0x53, 0x34, 0x43, 0x12, 0x81, 0x88, 0xaa, 0xba, 0xbc, 0xad, 0xac, 0xaa, 0x89,
+    0x21, 0x35, 0x33, 0x02, 0xd9, 0xce, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0x9a, 0x10, 0x32,
+    0x35, 0x34, 0x22, 0x12, 0x9a, 0xfb, 0x25, 0x00, 0x01, 0x88, 0xba, 0xeb, 0xcb, 0xab, 0xab, 0x88,
+    0x31, 0x43, 0x13, 0xb0, 0xee, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xcb, 0xba, 0xaa, 0x99, 0x00, 0x11,
+    0x33, 0x43, 0x43, 0x22, 0x11, 0x00, 0xa9, 0xcb, 0xbb, 0xaa, 0x28, 0x63, 0x34, 0x34, 0x22, 0x02,
+    0xa8, 0xdd, 0xcd, 0xcc, 0xdb, 0xbb, 0xbb, 0x9c, 0x9a, 0x08, 0x10, 0x31, 0x33, 0x35, 0x34, 0x33,
+    0x23, 0x80, 0xb9, 0xbc, 0x9a, 0x20, 0x55, 0x35, 0x53, 0x32, 0x33, 0x43, 0x23, 0x23, 0x91, 0xea,
+    0xdc, 0xbb, 0xcb, 0xa9, 0x08, 0x10, 0x22, 0x32, 0x43, 0x44, 0x43, 0x34, 0x22, 0x01, 0xa8, 0x9a,
+    0x19, 0x64, 0x54, 0x53, 0x32, 0x43, 0x22, 0x33, 0x34, 0x23, 0x12, 0x90, 0xdb, 0xbc, 0xac, 0x8a,
+    0x08, 0x21, 0x32, 0x24, 0x43, 0x53, 0x34, 0x34, 0x24, 0x12, 0x81, 0x80, 0x00, 0x52, 0x44, 0x44,
+    0x23, 0x43, 0x22, 0x22, 0x23, 0x33, 0x12, 0x90, 0x67, 0x1b, 0x21, 0x00, 0xcc, 0xbd, 0xcb, 0x9a,
+    0x18, 0x31, 0x44, 0x33, 0x34, 0x43, 0x43, 0x43, 0x32, 0x12, 0x81, 0xa9, 0xab, 0x9b, 0x28, 0x63,
+    0x53, 0x23, 0x32, 0x12, 0x22, 0x22, 0x01, 0xa9, 0xcf, 0xcc, 0xcb, 0xaa, 0x89, 0x21, 0x63, 0x43,
+    0x32, 0x33, 0x33, 0x32, 0x12, 0x90, 0xdc, 0xcc, 0xcc, 0xbb, 0xbb, 0xaa, 0x9a, 0x88, 0x00, 0x08,
+    0x89, 0xaa, 0xba, 0xcc, 0xbc, 0xcc, 0xbc, 0xcb, 0xab, 0x99, 0x10, 0x43, 0x34, 0x23, 0x81, 0xca,
+    0xdd, 0xcb, 0xbc, 0xdb, 0xbb, 0xbd, 0xcb, 0xab, 0xbb, 0xaa, 0x99, 0x99, 0xaa, 0xcd, 0xdb, 0xba,
+    0xab, 0xaa, 0xa9, 0xbb, 0xcd, 0xbb, 0xac, 0x99, 0x10, 0x00, 0xc8, 0xdd, 0xbc, 0xad, 0xaa, 0x99,
+    0x99, 0xbb, 0xbe, 0xcd, 0xba, 0xbb, 0xaa, 0xbb, 0xbe, 0xbd, 0xbd, 0xba, 0xaa, 0x89, 0x80, 0x80,
+    0x98, 0xab, 0x9a, 0x21, 0x37, 0x34, 0x11, 0xa8, 0xcb, 0x9a, 0x30, 0x37, 0x5e, 0xef, 0x20, 0x00,
+    0x33, 0x92, 0xdd, 0xcd, 0xcb, 0xbb, 0xcb, 0xcb, 0xbc, 0xbc, 0xbc, 0xaa, 0x09, 0x20, 0x33, 0x34,
+    0x32, 0x32, 0x35, 0x45, 0x43, 0x33, 0x22, 0x12, 0x11, 0x32, 0x45, 0x33, 0x13, 0xb0, 0xed, 0xdb,
+    0xcb, 0xba, 0xac, 0xcb, 0xbb, 0xcb, 0xaa, 0x08, 0x31, 0x45, 0x43, 0x33, 0x33, 0x24, 0x34, 0x34,
+    0x43, 0x32, 0x12, 0x12, 0x22, 0x33, 0x35, 0x23, 0x81, 0xcc, 0xbe, 0xbd, 0xcb, 0xba, 0xbb, 0xbc,
+    0xab, 0xab, 0x08, 0x52, 0x54, 0x43, 0x33, 0x32, 0x33, 0x33, 0x44, 0x33, 0x43, 0x22, 0x12, 0x22,
+    0x43, 0x34, 0x33, 0x13, 0xb8, 0xce, 0xcd, 0xbb, 0xcb, 0xab, 0xbb, 0xcb, 0x9a, 0x09, 0x31, 0x45,
+    0x44, 0x32, 0x23, 0x22, 0x21, 0x22, 0x32, 0x34, 0x24, 0x33, 0x43, 0x34, 0x35, 0x34, 0x33, 0x01,
+    0xb9, 0xce, 0xcb, 0xac, 0xcb, 0xaa, 0xab, 0xab, 0x9a, 0x18, 0x43, 0x44, 0x32, 0x13, 0x01, 0x80,
+    0xe2, 0x16, 0x25, 0x00, 0x88, 0x18, 0x21, 0x34, 0x44, 0x44, 0x44, 0x53, 0x33, 0x43, 0x11, 0x90,
+    0xcb, 0xcc, 0xcb, 0xcb, 0xba, 0xbb, 0xac, 0xaa, 0x89, 0x10, 0x32, 0x23, 0x02, 0xa8, 0xbc, 0xac,
+    0x9a, 0x00, 0x22, 0x44, 0x44, 0x35, 0x45, 0x43, 0x32, 0x12, 0x98, 0xda, 0xcc, 0xbb, 0xbc, 0xbb,
+    0xac, 0xbb, 0xbb, 0x8a, 0x18, 0x33, 0x34, 0x12, 0x90, 0xba, 0xac, 0x09, 0x32, 0x36, 0x34, 0x43,
+    0x34, 0x45, 0x43, 0x23, 0x12, 0xb8, 0xdd, 0xbc, 0xbc, 0xbb, 0xbb, 0xac, 0xab, 0xab, 0x8a, 0x20,
+    0x54, 0x33, 0x24, 0x02, 0x80, 0x08, 0x10, 0x53, 0x34, 0x33, 0x23, 0x11, 0x32, 0x63, 0x32, 0x91,
+    0xfc, 0xcd, 0xcc, 0xba, 0xbb, 0xaa, 0xa9, 0x9a, 0x9a, 0x89, 0x30, 0x46, 0x34, 0x34, 0x21, 0x00,
+    0x88, 0x00, 0x32, 0x44, 0x23, 0x11, 0x99, 0xaa, 0x9a, 0x10, 0x90, 0xfe, 0xec, 0xcb, 0xac, 0xaa,
+    0x9a, 0x08, 0x08, 0x08, 0x8c, 0xe8, 0x25, 0x00, 0x08, 0x21, 0x55, 0x34, 0x34, 0x22, 0x01, 0x88,
+    0x89, 0x21, 0x44, 0x43, 0x12, 0x81, 0x99, 0x08, 0x32, 0x35, 0x02, 0xfa, 0xdc, 0xcb, 0xaa, 0x89,
+    0x10, 0x22, 0x12, 0x11, 0x41, 0x64, 0x53, 0x43, 0x22, 0x02, 0x80, 0x89, 0x20, 0x53, 0x34, 0x23,
+    0x22, 0x00, 0x21, 0x63, 0x43, 0x33, 0x91, 0xda, 0xcc, 0xaa, 0x89, 0x20, 0x43, 0x22, 0x12, 0x22,
+    0x55, 0x34, 0x35, 0x23, 0x01, 0xa9, 0xba, 0xaa, 0x10, 0x42, 0x23, 0x02, 0x89, 0x20, 0x65, 0x54,
+    0x32, 0x12, 0xa8, 0xcb, 0xac, 0x9a, 0x00, 0x12, 0x01, 0xb9, 0xdb, 0xaa, 0x00, 0x12, 0xd8, 0xdf,
+    0xcc, 0xbc, 0xcb, 0x9a, 0x8a, 0x98, 0x80, 0x18, 0x30, 0x73, 0x43, 0x43, 0x13, 0x02, 0xa8, 0xcb,
+    0xcb, 0xcb, 0xbb, 0xbd, 0xbc, 0xbc, 0xbc, 0xba, 0xbb, 0xcb, 0xcb, 0xcb, 0xbb, 0xac, 0xaa, 0x88,
+    0x20, 0x43, 0x44, 0x34, 0x53, 0x33, 0x33, 0x23, 0x62, 0x01, 0x22, 0x00, 0x02, 0xa8, 0xdc, 0xcc,
+    0xbc, 0xbc, 0xcb, 0xba, 0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0x88, 0x21, 0x32, 0x32, 0x25, 0x44, 0x45,
+    0x34, 0x35, 0x43, 0x33, 0x23, 0x23, 0x22, 0x12, 0xa0, 0xfb, 0xcc, 0xbc, 0xbc, 0xbb, 0xba, 0x9a,
+    0xaa, 0x99, 0x99, 0x20, 0x45, 0x44, 0x33, 0x43, 0x22, 0x22, 0x44, 0x34, 0x45, 0x32, 0x23, 0x23,
+    0x23, 0x32, 0x33, 0x14, 0x90, 0xfb, 0xbc, 0xbc, 0xbb, 0xab, 0x9a, 0xba, 0xcb, 0xbb, 0x99, 0x31,
+    0x46, 0x43, 0x23, 0x12, 0x22, 0x54, 0x44, 0x44, 0x33, 0x33, 0x32, 0x22, 0x33, 0x34, 0x23, 0x80,
+    0xdc, 0xbd, 0xbd, 0xbb, 0xab, 0xcb, 0xbb, 0xbd, 0xcb, 0xaa, 0x99, 0x00, 0x01, 0x11, 0x00, 0x20,
+    0x44, 0x46, 0x34, 0x43, 0x23, 0x22, 0x21, 0x32, 0x33, 0x12, 0xb0, 0xde, 0xcc, 0xbc, 0xbb, 0xbb,
+    0xbc, 0xbc, 0xbc, 0xac, 0xab, 0x8a, 0x09, 0x08, 0x00, 0x10, 0x31, 0x55, 0xdb, 0xf1, 0x25, 0x00,
+    0x44, 0x34, 0x43, 0x32, 0x32, 0x33, 0x34, 0x24, 0x23, 0x01, 0xa8, 0xdb, 0xcb, 0xbb, 0xcb, 0xbc,
+    0xcc, 0xcb, 0xab, 0xab, 0x8a, 0x88, 0x01, 0x21, 0x42, 0x54, 0x54, 0x43, 0x34, 0x33, 0x34, 0x33,
+    0x43, 0x43, 0x23, 0x23, 0x02, 0x80, 0xaa, 0xbc, 0xdb, 0xcb, 0xbc, 0xcc, 0xbb, 0xcb, 0xba, 0xa9,
+    0x98, 0x08, 0x10, 0x42, 0x44, 0x44, 0x53, 0x33, 0x43, 0x33, 0x33, 0x33, 0x33, 0x13, 0x81, 0xca,
+    0xdc, 0xbc, 0xbd, 0xdb, 0xbb, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0xaa, 0x89, 0x20, 0x52, 0x53,
+    0x34, 0x33, 0x34, 0x33, 0x33, 0x23, 0x22, 0x90, 0xcc, 0xcd, 0xcc, 0xbb, 0xbc, 0xbc, 0xbc, 0xac,
+    0xac, 0xba, 0x9a, 0x9a, 0x88, 0x88, 0x00, 0x21, 0x63, 0x53, 0x43, 0x33, 0x23, 0x23, 0x22, 0x22,
+    0x33, 0x22, 0xa8, 0xec, 0xbc, 0xbc, 0xaa, 0x9a, 0xa9, 0xba, 0xbc, 0x9c, 0x19, 0x54, 0x44, 0x43,
+    0xeb, 0xf0, 0x25, 0x00, 0x23, 0x23, 0x43, 0x34, 0x35, 0x34, 0x33, 0x12, 0x11, 0x00, 0x22, 0x33,
+    0x34, 0x01, 0xb9, 0xbd, 0x9a, 0x38, 0x46, 0x43, 0x22, 0x12, 0x21, 0x63, 0x44, 0x34, 0x43, 0x12,
+    0x01, 0x00, 0x21, 0x43, 0x24, 0x13, 0x80, 0xca, 0xcb, 0xaa, 0x89, 0x99, 0xeb, 0xdc, 0xcb, 0xbb,
+    0xa9, 0x08, 0x11, 0x00, 0x88, 0x8a, 0x18, 0x64, 0x43, 0x14, 0x01, 0xb9, 0xcb, 0x9c, 0x9a, 0x98,
+    0xba, 0xde, 0xdb, 0xcb, 0xbb, 0xac, 0xcb, 0xcb, 0xdb, 0xbb, 0xac, 0xab, 0xa9, 0x89, 0x88, 0x80,
+    0x00, 0x22, 0x34, 0x35, 0x23, 0x12, 0x98, 0xba, 0xcb, 0xaa, 0x9b, 0xba, 0xcc, 0xbc, 0xbd, 0xbb,
+    0xbd, 0xeb, 0xcb, 0xcc, 0xcb, 0xca, 0xaa, 0xaa, 0x99, 0x09, 0x10, 0x43, 0x44, 0x44, 0x33, 0x25,
+    0x43, 0x33, 0x43, 0x33, 0x35, 0x33, 0x34, 0x34, 0x33, 0x33, 0x33, 0x12, 0x88, 0xbc, 0xce, 0xcb,
+    0xbc, 0xcb, 0xab, 0xba, 0x5e, 0xf8, 0x23, 0x00, 0x89, 0x10, 0x44, 0x54, 0x53, 0x33, 0x35, 0x33,
+    0x44, 0x32, 0x23, 0x43, 0x22, 0x22, 0x12, 0x11, 0x81, 0x98, 0xca, 0xcc, 0xcc, 0xcb, 0xcb, 0xbb,
+    0xcb, 0xaa, 0x9b, 0x8a, 0x18, 0x42, 0x35, 0x44, 0x43, 0x33, 0x24, 0x33, 0x32, 0x22, 0x12, 0x00,
+    0x98, 0xba, 0xbc, 0xbc, 0xbd, 0xcc, 0xdb, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xac, 0xba,
+    0xaa, 0x99, 0x88, 0x20, 0x22, 0x34, 0x34, 0x34, 0x43, 0x32, 0x33, 0x23, 0x11, 0x80, 0xb9, 0xdc,
+    0xdc, 0xbc, 0xcd, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xba, 0xbb, 0xaa, 0x9a, 0x18, 0x31, 0x45, 0x53,
+    0x43, 0x33, 0x34, 0x33, 0x24, 0x32, 0x12, 0x12, 0x00, 0x88, 0xa9, 0xbb, 0xbd, 0xbc, 0xbd, 0xbc,
+    0xcb, 0xbb, 0xbb, 0xaa, 0x9a, 0x10, 0x52, 0x45, 0x44, 0x43, 0x34, 0x34, 0x33, 0x34, 0x23, 0x24,
+    0x22, 0x32, 0x22, 0x21, 0x12, 0x22, 0x22, 0x22, 0x74, 0x0f, 0x1c, 0x00, 0x12, 0x01, 0xa9, 0xdd,
+    0xbc, 0xbd, 0xcb, 0xbb, 0xac, 0xaa, 0x89, 0x20, 0x54, 0x44, 0x44, 0x33, 0x44, 0x32, 0x33, 0x33,
+    0x33, 0x23, 0x22, 0x00, 0xa9, 0xdb, 0xbc, 0xbd, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xac,
+    0xaa, 0x99, 0x08, 0x31, 0x63, 0x34, 0x34, 0x33, 0x24, 0x12, 0x01, 0x88, 0xca, 0xcc, 0xbc, 0xbd,
+    0xbc, 0xcb, 0xca, 0xaa, 0xab, 0xbb, 0xac, 0xab, 0xbb, 0xaa, 0x99, 0x89, 0x00, 0x31, 0x63, 0x53,
+    0x34, 0x34, 0x33, 0x24, 0x21, 0x00, 0x88, 0xba, 0xdc, 0xdb, 0xcb, 0xbc, 0xcb, 0xba, 0xbb, 0xbb,
+    0xbb, 0xac, 0xbb, 0xab, 0x89, 0x20, 0x54, 0x44, 0x34, 0x35, 0x35, 0x34, 0x34, 0x34, 0x33, 0x33,
+    0x33, 0x22, 0x01, 0x98, 0xcb, 0xcd, 0xdb, 0xbb, 0xac, 0xbb, 0xab, 0xaa, 0x89, 0x18, 0x42, 0x54,
+    0x34, 0x35, 0x34, 0x43, 0x43, 0x33, 0x33, 0x34, 0x33, 0x22, 0x11, 0x80, 0x5a, 0x12, 0x21, 0x00,
+    0xb9, 0xeb, 0xcb, 0xdb, 0xbb, 0xbc, 0xcb, 0xaa, 0x9a, 0x89, 0x00, 0x22, 0x43, 0x53, 0x43, 0x33,
+    0x34, 0x33, 0x22, 0x11, 0x11, 0x00, 0x00, 0x08, 0xa9, 0xdb, 0xbc, 0xbd, 0xdb, 0xcb, 0xbc, 0xcc,
+    0xbc, 0xbc, 0xcb, 0xbb, 0xcb, 0xba, 0xba, 0xab, 0xaa, 0x89, 0x10, 0x42, 0x53, 0x43, 0x43, 0x43,
+    0x43, 0x33, 0x33, 0x23, 0x01, 0xb9, 0xdd, 0xcc, 0xbc, 0xbd, 0xad, 0xac, 0xbb, 0xac, 0xaa, 0xa9,
+    0x88, 0x11, 0x43, 0x35, 0x35, 0x34, 0x34, 0x33, 0x43, 0x22, 0x12, 0x11, 0x88, 0xaa, 0xbc, 0xbd,
+    0xbc, 0xbc, 0xcb, 0xba, 0xab, 0xab, 0x99, 0x08, 0x41, 0x63, 0x43, 0x44, 0x33, 0x44, 0x42, 0x22,
+    0x23, 0x22, 0x12, 0x01, 0x88, 0xa9, 0xbb, 0xcd, 0xbb, 0xac, 0xbb, 0x9a, 0x99, 0x89, 0x88, 0x99,
+    0xa9, 0x9a, 0xaa, 0xba, 0xcc, 0xbb, 0xbb, 0x31, 0x77, 0x34, 0x44, 0x43, 0x23, 0x33, 0x33, 0x23,
+    0xe6, 0x06, 0x17, 0x00, 0x12, 0xa8, 0xdc, 0xcd, 0xbc, 0xbc, 0xac, 0xcb, 0xca, 0xba, 0xba, 0xbb,
+    0xaa, 0x88, 0x21, 0x34, 0x45, 0x53, 0x43, 0x34, 0x43, 0x33, 0x23, 0x13, 0x80, 0xa9, 0xdc, 0xdb,
+    0xbc, 0xbc, 0xbc, 0xcb, 0xaa, 0xaa, 0x89, 0x10, 0x32, 0x54, 0x53, 0x43, 0x33, 0x25, 0x33, 0x32,
+    0x32, 0x21, 0x01, 0x80, 0xb9, 0xcc, 0xcc, 0xcb, 0xac, 0xcb, 0xba, 0xba, 0xab, 0xaa, 0x89, 0x10,
+    0x43, 0x36, 0x34, 0x35, 0x33, 0x34, 0x43, 0x32, 0x22, 0x12, 0x00, 0x88, 0xb9, 0xca, 0xcb, 0xcb,
+    0xcb, 0xcb, 0xba, 0xbc, 0xca, 0xbb, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xbb, 0xba, 0x98, 0x10, 0x63,
+    0x34, 0x35, 0x34, 0x34, 0x42, 0x21, 0x22, 0x10, 0x98, 0xba, 0xce, 0xeb, 0xca, 0xcb, 0xcb, 0xbb,
+    0xbc, 0xbc, 0xbb, 0xac, 0xab, 0xaa, 0x99, 0x88, 0x21, 0x43, 0x44, 0x53, 0x33, 0x33, 0x33, 0x23,
+    0x01, 0xa9, 0xeb, 0xcc, 0x59, 0xf7, 0x1e, 0x00, 0xdb, 0xcb, 0xbb, 0xad, 0xab, 0xab, 0xab, 0x9b,
+    0x9a, 0x89, 0x20, 0x42, 0x44, 0x34, 0x34, 0x25, 0x24, 0x43, 0x33, 0x33, 0x24, 0x23, 0x22, 0x12,
+    0x10, 0x80, 0x98, 0x99, 0xaa, 0x09, 0x40, 0x73, 0x44, 0x44, 0x43, 0x34, 0x34, 0x25, 0x24, 0x43,
+    0x33, 0x53, 0x32, 0x24, 0x24, 0x33, 0x33, 0x34, 0x32, 0x33, 0x33, 0x23, 0x12, 0x12, 0x00, 0x80,
+    0x88, 0x08, 0x20, 0x44, 0x44, 0x35, 0x44, 0x34, 0x53, 0x33, 0x34, 0x34, 0x33, 0x34, 0x43, 0x32,
+    0x22, 0x12, 0x00, 0xa8, 0xdc, 0xbc, 0xbe, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbb, 0xbb,
+    0xbb, 0xba, 0xb9, 0x99, 0xa9, 0x99, 0xaa, 0xcb, 0xcc, 0xcc, 0xbc, 0xbd, 0xbd, 0xbc, 0xbd, 0xcb,
+    0xdb, 0xca, 0xba, 0xcb, 0xbb, 0xbb, 0xbc, 0xab, 0xbb, 0xab, 0xab, 0x99, 0x89, 0x08, 0x11, 0x22,
+    0x33, 0x42, 0x22, 0x12, 0x10, 0x9a, 0xae, 0xae, 0x30, 0xe5, 0x16, 0x00, 0xcb, 0xac, 0xac, 0xac,
+    0xab, 0xbb, 0xbb, 0x9a, 0x29, 0x62, 0x44, 0x45, 0x53, 0x43, 0x34, 0x44, 0x33, 0x34, 0x24, 0x24,
+    0x33, 0x33, 0x34, 0x33, 0x33, 0x34, 0x23, 0x24, 0x33, 0x33, 0x43, 0x43, 0x42, 0x32, 0x34, 0x53,
+    0x43, 0x43, 0x24, 0x34, 0x43, 0x33, 0x34, 0x24, 0x33, 0x33, 0x24, 0x32, 0x22, 0x12, 0x12, 0x01,
+    0x00, 0x98, 0xa9, 0xca, 0xbb, 0xac, 0xbb, 0xab, 0x9a, 0x10, 0x31, 0x26, 0x33, 0x13, 0xb1, 0xec,
+    0xcd, 0xbd, 0xcc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xcb, 0xcb, 0xcb, 0xbb, 0xac, 0xac, 0xbb, 0xbb,
+    0xcb, 0xba, 0xcb, 0xab, 0xbc, 0xbc, 0xbc, 0xcc, 0xbb, 0xcc, 0xca, 0xba, 0xbb, 0xcb, 0xab, 0xbb,
+    0xac, 0xbb, 0xcb, 0xbb, 0xcb, 0xbb, 0xcb, 0xab, 0xab, 0xbb, 0xbb, 0xbc, 0xbc, 0xbc, 0xbd, 0xcc,
+    0xbb, 0xbc, 0xcb, 0xaa, 0x9a, 0x99, 0x00, 0x32, 0x53, 0x43, 0x43, 0x23, 0xbe, 0xd4, 0x1d, 0x00,
+    0x24, 0x33, 0x43, 0x34, 0x53, 0x33, 0x44, 0x32, 0x24, 0x33, 0x32, 0x43, 0x32, 0x34, 0x35, 0x35,
+    0x44, 0x43, 0x34, 0x43, 0x43, 0x42, 0x22, 0x32, 0x32, 0x33, 0x43, 0x33, 0x44, 0x33, 0x34, 0x34,
+    0x33, 0x34, 0x24, 0x33, 0x33, 0x44, 0x42, 0x33, 0x34, 0x44, 0x32, 0x24, 0x23, 0x23, 0x22, 0x11,
+    0x81, 0x80, 0x80, 0x08, 0x21, 0x43, 0x35, 0x44, 0x33, 0x33, 0x23, 0x12, 0x88, 0xb8, 0xba, 0xbc,
+    0xcb, 0xcb, 0xbc, 0xbe, 0xbe, 0xbd, 0xcd, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xab, 0xbb, 0xba, 0xaa,
+    0xbb, 0xcc, 0xcb, 0xcc, 0xcb, 0xbc, 0xcb, 0xcb, 0xbb, 0xac, 0xac, 0xcb, 0xca, 0xba, 0xbc, 0xcb,
+    0xbb, 0xbc, 0xba, 0xab, 0xab, 0x9a, 0x99, 0x89, 0x99, 0xaa, 0xbc, 0xbe, 0xcc, 0xcb, 0xbb, 0xbc,
+    0xbb, 0xbb, 0xbb, 0xbb, 0xbb, 0xcb, 0xbb, 0xbb, 0x9c, 0x89, 0x31, 0x56, 0x44, 0x34, 0x44, 0x33,
+    0x13, 0xcc, 0x28, 0x00, 0x43, 0x32, 0x32, 0x21, 0x12, 0x11, 0x11, 0x43, 0x44, 0x44, 0x53, 0x43,
+    0x43, 0x33, 0x34, 0x33, 0x34, 0x34, 0x43, 0x43, 0x43, 0x43, 0x33, 0x34, 0x32, 0x43, 0x22, 0x21,
+    0x12, 0x22, 0x32, 0x34, 0x35, 0x35, 0x34, 0x34, 0x34, 0x33, 0x34, 0x32, 0x23, 0x33, 0x33, 0x43,
+    0x33, 0x53, 0x32, 0x22, 0x13, 0x01, 0xa8, 0xdb, 0xbc, 0xbc, 0xac, 0x9a, 0x09, 0x21, 0x53, 0x43,
+    0x23, 0x12, 0xa8, 0xec, 0xcc, 0xdb, 0xcb, 0xcb, 0xbb, 0xcb, 0xbb, 0xbc, 0xbc, 0xdb, 0xbb, 0xcc,
+    0xbb, 0xcb, 0xbb, 0xbb, 0xbb, 0xbb, 0xab, 0xbb, 0xcc, 0xdb, 0xcb, 0xcc, 0xcb, 0xbb, 0xad, 0xbb,
+    0xac, 0xba, 0xab, 0xbb, 0xcb, 0xbb, 0xcc, 0xbb, 0xdb, 0xba, 0xbb, 0xab, 0xaa, 0x99, 0x80, 0x10,
+    0x00, 0x99, 0xdb, 0xdc, 0xcb, 0xac, 0xab, 0x9b, 0x08, 0x31, 0x45, 0x44, 0x33, 0x43, 0x32, 0x22,
+    0x22, 0x22, 0x53, 0x63, 0x1b, 0xcc, 0x26, 0x00, 0x43, 0x44, 0x43, 0x24, 0x43, 0x32, 0x23, 0x33,
+    0x33, 0x43, 0x53, 0x43, 0x53, 0x43, 0x43, 0x43, 0x33, 0x43, 0x22, 0x32, 0x12, 0x22, 0x23, 0x43,
+    0x53, 0x43, 0x34, 0x43, 0x33, 0x43, 0x32, 0x32, 0x22, 0x32, 0x33, 0x35, 0x35, 0x34, 0x44, 0x32,
+    0x32, 0x22, 0x00, 0xa8, 0xcb, 0xcc, 0xbb, 0xbc, 0xaa, 0x9a, 0x89, 0x88, 0x88, 0xba, 0xdc, 0xdc,
+    0xcb, 0xcb, 0xbb, 0xbb, 0xba, 0xab, 0xba, 0xdb, 0xcc, 0xcc, 0xcc, 0xbc, 0xbc, 0xbc, 0xac, 0xbb,
+    0xbb, 0xba, 0xba, 0xaa, 0xab, 0xcb, 0xbc, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xaa, 0xab, 0xbb,
+    0xcc, 0xcc, 0xdb, 0xcb, 0xbc, 0xbb, 0xbc, 0xaa, 0xaa, 0x89, 0x18, 0x21, 0x32, 0x43, 0x12, 0x02,
+    0x00, 0x98, 0x08, 0x32, 0x55, 0x44, 0x34, 0x34, 0x33, 0x23, 0x11, 0x88, 0x99, 0x99, 0x40, 0x74,
+    0x44, 0x44, 0x34, 0x44, 0x32, 0x43, 0x32, 0x32, 0x77, 0xec, 0x2c, 0x00, 0x32, 0x32, 0x42, 0x42,
+    0x42, 0x33, 0x34, 0x34, 0x42, 0x22, 0x22, 0x21, 0x12, 0x22, 0x53, 0x53, 0x53, 0x34, 0x53, 0x33,
+    0x43, 0x32, 0x22, 0x12, 0x02, 0x00, 0x00, 0x08, 0x11, 0x21, 0x43, 0x32, 0x13, 0x81, 0xcb, 0xcd,
+    0xcc, 0xbb, 0xba, 0x9a, 0x10, 0x42, 0x44, 0x33, 0x22, 0x90, 0xdc, 0xcd, 0xbc, 0xbd, 0xbc, 0xbb,
+    0xcb, 0xba, 0xbb, 0xbb, 0xbc, 0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0x9a, 0xaa,
+    0xcb, 0xcc, 0xcc, 0xbc, 0xbd, 0xcb, 0xbb, 0xbc, 0xba, 0xba, 0xaa, 0xab, 0xba, 0xca, 0xbb, 0xcc,
+    0xba, 0xac, 0xaa, 0xa9, 0x00, 0x21, 0x34, 0x34, 0x24, 0x12, 0x81, 0xb8, 0xdb, 0xbc, 0xbb, 0xba,
+    0x08, 0x32, 0x47, 0x43, 0x24, 0x43, 0x32, 0x32, 0x33, 0x53, 0x53, 0x53, 0x53, 0x43, 0x43, 0x33,
+    0x34, 0x33, 0x33, 0x33, 0x22, 0x23, 0x22, 0x33, 0x35, 0x44, 0x33, 0x35, 0xf2, 0x00, 0x20, 0x00,
+    0x33, 0x43, 0x23, 0x33, 0x33, 0x43, 0x53, 0x34, 0x44, 0x43, 0x34, 0x24, 0x43, 0x22, 0x23, 0x21,
+    0x01, 0x80, 0x98, 0xa9, 0xaa, 0xaa, 0xba, 0xaa, 0xcb, 0xbc, 0xbd, 0xbd, 0xcb, 0xbb, 0xac, 0x99,
+    0x00, 0x33, 0x36, 0x34, 0x24, 0x22, 0x00, 0xca, 0xcd, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb, 0xbb, 0xcb,
+    0xba, 0xbc, 0xca, 0xbb, 0xbb, 0xbc, 0xbb, 0xbb, 0x9a, 0x89, 0x18, 0x21, 0x22, 0x11, 0xc9, 0xfc,
+    0xdb, 0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xac, 0xab, 0xbb, 0xbb, 0xcb, 0xab, 0xbb, 0xac, 0xa9, 0x08,
+    0x31, 0x54, 0x44, 0x43, 0x43, 0x23, 0x23, 0x12, 0x00, 0x99, 0xbb, 0xbd, 0xbb, 0xac, 0x99, 0x09,
+    0x11, 0x23, 0x26, 0x33, 0x54, 0x42, 0x43, 0x44, 0x43, 0x25, 0x34, 0x43, 0x43, 0x32, 0x33, 0x32,
+    0x31, 0x20, 0x00, 0x00, 0x00, 0x01, 0x23, 0x25, 0x35, 0x53, 0x32, 0x34, 0x42, 0x33, 0x34, 0x34,
+    0xee, 0x02, 0x17, 0x00, 0x44, 0x43, 0x43, 0x33, 0x24, 0x33, 0x33, 0x22, 0x01, 0x91, 0xa8, 0xba,
+    0xdb, 0xb9, 0x99, 0x09, 0x28, 0x41, 0x51, 0x31, 0x32, 0x33, 0x43, 0x33, 0x26, 0x24, 0x33, 0x24,
+    0x22, 0x08, 0xad, 0xbe, 0xcd, 0xdb, 0xcb, 0xca, 0xab, 0xbb, 0xac, 0xaa, 0xaa, 0x99, 0x99, 0x88,
+    0x89, 0x98, 0xa9, 0xda, 0xcb, 0xfb, 0xc9, 0xca, 0xcb, 0xcb, 0xbc, 0xac, 0xbc, 0xac, 0xcb, 0xbb,
+    0xca, 0xaa, 0xab, 0xa9, 0x99, 0x08, 0x11, 0x23, 0x25, 0x23, 0x33, 0x20, 0x9b, 0xce, 0xeb, 0xdb,
+    0xca, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xab, 0xbb, 0xab, 0x9a, 0x88, 0x33, 0x56, 0x53, 0x43, 0x53,
+    0x32, 0x43, 0x32, 0x22, 0x11, 0x00, 0x9a, 0xbc, 0xdc, 0xca, 0xba, 0xbb, 0xcb, 0xaa, 0xaa, 0x89,
+    0x28, 0x51, 0x63, 0x53, 0x53, 0x43, 0x34, 0x24, 0x24, 0x33, 0x33, 0x23, 0x12, 0x01, 0xa8, 0xca,
+    0xbc, 0xbd, 0xcb, 0xbb, 0x25, 0x00, 0x18, 0x00, 0xbb, 0xbb, 0xac, 0x99, 0x09, 0x20, 0x63, 0x44,
+    0x44, 0x43, 0x34, 0x34, 0x43, 0x33, 0x23, 0x23, 0x12, 0x88, 0xca, 0xdb, 0xbc, 0xcc, 0xbb, 0xcb,
+    0xbb, 0xac, 0xbb, 0xba, 0xaa, 0x99, 0x88, 0x22, 0x36, 0x35, 0x35, 0x34, 0x34, 0x43, 0x22, 0x22,
+    0x10, 0xa8, 0xca, 0xcc, 0xdb, 0xcb, 0xcb, 0xba, 0xbc, 0xba, 0xcb, 0xba, 0xaa, 0x9a, 0x89, 0x18,
+    0x42, 0x44, 0x44, 0x43, 0x43, 0x33, 0x33, 0x23, 0x13, 0x01, 0xa9, 0xbd, 0xcc, 0xbc, 0xbc, 0xbc,
+    0xca, 0xbb, 0xbb, 0xbb, 0xbb, 0xba, 0x89, 0x30, 0x73, 0x63, 0x43, 0x53, 0x33, 0x34, 0x33, 0x24,
+    0x22, 0x12, 0x00, 0x98, 0xba, 0xcc, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xab, 0xba, 0x99, 0x10,
+    0x53, 0x35, 0x36, 0x34, 0x44, 0x33, 0x43, 0x32, 0x23, 0x12, 0x02, 0x90, 0xb8, 0xca, 0xbc, 0xbc,
+    0xbc, 0xbc, 0xcb, 0xca, 0xba, 0xba, 0xaa, 0x8a, 0x40, 0xff, 0x13, 0x00, 0x29, 0x51, 0x44, 0x34,
+    0x35, 0x24, 0x43, 0x22, 0x22, 0x11, 0x80, 0xa8, 0xca, 0xcb, 0xbc, 0xbb, 0xbc, 0xbc, 0xbb, 0xbc,
+    0xbc, 0xbb, 0xac, 0xab, 0x9b, 0x09, 0x31, 0x55, 0x43, 0x24, 0x24, 0x23, 0x11, 0x81, 0xa8, 0xcc,
+    0xcb, 0xac, 0xbb, 0xbb, 0xaa, 0x9a, 0x89, 0x9a, 0xaa, 0xad, 0xae, 0xcb, 0xbb, 0xab, 0x9a, 0x21,
+    0x35, 0x36, 0x34, 0x24, 0x22, 0x01, 0x98, 0xdb, 0xcb, 0xcb, 0xba, 0x99, 0x11, 0x53, 0x44, 0x24,
+    0x33, 0x13, 0x02, 0x88, 0x9c, 0xad, 0xba, 0x9a, 0x18, 0x51, 0x53, 0x24, 0x24, 0x23, 0x21, 0x88,
+    0xb9, 0xbc, 0xbb, 0x9b, 0x40, 0x54, 0x45, 0x43, 0x43, 0x33, 0x22, 0x12, 0x00, 0x9a, 0xac, 0xcb,
+    0xba, 0x9a, 0x29, 0x38, 0x41, 0x12, 0x00, 0xad, 0xbf, 0xbc, 0xbd, 0xbb, 0xba, 0x98, 0x22, 0x64,
+    0x53, 0x33, 0x34, 0x33, 0x23, 0x12, 0x90, 0xbb, 0xbf, 0xbc, 0xbd, 0xdb, 0x95, 0x00, 0x18, 0x00,
+    0xba, 0xbc, 0xbb, 0xac, 0xac, 0xaa, 0xba, 0x99, 0x98, 0x12, 0x34, 0x35, 0x35, 0x25, 0x33, 0x24,
+    0x33, 0x31, 0x10, 0x99, 0xbd, 0xdd, 0xcb, 0xbc, 0xcc, 0xba, 0xbb, 0xab, 0x9a, 0x09, 0x31, 0x45,
+    0x44, 0x33, 0x34, 0x24, 0x23, 0x23, 0x21, 0x10, 0x80, 0x98, 0xaa, 0xdb, 0xda, 0xcb, 0xdb, 0xcb,
+    0xcb, 0xbb, 0xba, 0xaa, 0x18, 0x63, 0x45, 0x34, 0x44, 0x43, 0x32, 0x32, 0x12, 0x01, 0x99, 0xbb,
+    0xcd, 0xbb, 0xcb, 0xaa, 0x9a, 0x89, 0x08, 0x10, 0x10, 0x10, 0x18, 0x11, 0x35, 0x56, 0x63, 0x43,
+    0x34, 0x43, 0x33, 0x22, 0x01, 0xa9, 0xcd, 0xcc, 0xcb, 0xcb, 0xaa, 0xaa, 0x89, 0x18, 0x32, 0x34,
+    0x25, 0x23, 0x22, 0x01, 0x90, 0xa9, 0xaa, 0xaa, 0x89, 0x21, 0x23, 0x84, 0xd8, 0xce, 0xdd, 0xcb,
+    0xbc, 0xcb, 0xab, 0x9a, 0x08, 0x31, 0x45, 0x53, 0x23, 0x33, 0x13, 0x81, 0xba, 0xdc, 0xbc, 0xcb,
+    0x20, 0xfe, 0x20, 0x00, 0xbb, 0xaa, 0x8a, 0x88, 0x11, 0x13, 0x13, 0x82, 0xa8, 0xca, 0xcb, 0x89,
+    0x41, 0x46, 0x35, 0x35, 0x43, 0x23, 0x12, 0x98, 0xda, 0xcc, 0xbc, 0xcb, 0xbb, 0x9a, 0x89, 0x21,
+    0x44, 0x44, 0x33, 0x43, 0x32, 0x12, 0x11, 0x80, 0x98, 0x98, 0x08, 0x00, 0x13, 0x33, 0x20, 0xcb,
+    0xcf, 0xcc, 0xbc, 0xcb, 0xaa, 0x8a, 0x20, 0x54, 0x44, 0x34, 0x43, 0x33, 0x23, 0x22, 0x80, 0xb9,
+    0xdb, 0xbc, 0xcb, 0xba, 0xaa, 0x99, 0x09, 0x00, 0x01, 0x11, 0x00, 0x91, 0x11, 0x52, 0x54, 0x44,
+    0x53, 0x43, 0x23, 0x23, 0x02, 0x98, 0xbd, 0xce, 0xcb, 0xbb, 0xac, 0xab, 0x9a, 0x09, 0x20, 0x33,
+    0x26, 0x24, 0x23, 0x13, 0x02, 0x92, 0xa8, 0xca, 0xdb, 0xcb, 0xbc, 0xdb, 0xca, 0xbb, 0xac, 0xbb,
+    0xac, 0xa9, 0x88, 0x20, 0x63, 0x53, 0x43, 0x33, 0x34, 0x32, 0x12, 0x81, 0xa9, 0xcd, 0xdb, 0xbc,
+    0xac, 0xac, 0xac, 0xaa, 0x58, 0xfc, 0x1b, 0x00, 0xaa, 0x99, 0x08, 0x22, 0x45, 0x34, 0x35, 0x43,
+    0x24, 0x33, 0x32, 0x22, 0x01, 0xa8, 0xda, 0xeb, 0xca, 0xbb, 0xbc, 0xac, 0xab, 0xab, 0xaa, 0x89,
+    0x11, 0x44, 0x54, 0x43, 0x34, 0x44, 0x42, 0x22, 0x32, 0x12, 0x01, 0x90, 0xcb, 0xcc, 0xbc, 0xbc,
+    0xbc, 0xab, 0xbb, 0x9b, 0x8a, 0x08, 0x32, 0x45, 0x53, 0x34, 0x43, 0x24, 0x24, 0x33, 0x33, 0x32,
+    0x11, 0x80, 0xca, 0xcd, 0xcc, 0xcb, 0xcb, 0xbb, 0xac, 0xaa, 0x9a, 0x08, 0x11, 0x34, 0x44, 0x34,
+    0x43, 0x33, 0x34, 0x32, 0x22, 0x22, 0x10, 0x98, 0xda, 0xdb, 0xcc, 0xcb, 0xbc, 0xcb, 0xbb, 0xcb,
+    0xaa, 0x99, 0x08, 0x32, 0x54, 0x34, 0x34, 0x34, 0x33, 0x33, 0x23, 0x12, 0x81, 0xb9, 0xeb, 0xcb,
+    0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xac, 0xab, 0x9a, 0x89, 0x10, 0x63, 0x53, 0x34, 0x34, 0x34, 0x24,
+    0x32, 0x22, 0x01, 0x88, 0xba, 0xcc, 0xcc, 0xbb, 0xd3, 0x00, 0x24, 0x00, 0xbc, 0xbb, 0xcb, 0xaa,
+    0x9a, 0x99, 0x08, 0x11, 0x53, 0x63, 0x43, 0x43, 0x43, 0x43, 0x23, 0x33, 0x22, 0x01, 0x98, 0xcb,
+    0xcd, 0xcb, 0xcb, 0xbb, 0xac, 0xab, 0xa9, 0x89, 0x18, 0x21, 0x53, 0x53, 0x33, 0x44, 0x32, 0x24,
+    0x33, 0x33, 0x33, 0x12, 0x81, 0xba, 0xbe, 0xbe, 0xbc, 0xbc, 0xac, 0xbb, 0xaa, 0x9a, 0x88, 0x21,
+    0x53, 0x34, 0x34, 0x34, 0x24, 0x23, 0x23, 0x32, 0x11, 0x81, 0x98, 0xac, 0xbd, 0xbd, 0xcc, 0xca,
+    0xba, 0xcb, 0xaa, 0x99, 0x89, 0x11, 0x43, 0x44, 0x43, 0x34, 0x23, 0x24, 0x12, 0x11, 0x90, 0xb8,
+    0xdb, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xaa, 0x9a, 0x08, 0x32, 0x64, 0x43, 0x53, 0x42, 0x32,
+    0x42, 0x21, 0x01, 0x91, 0xa9, 0xcc, 0xbc, 0xbd, 0xcb, 0xcb, 0xba, 0xaa, 0xa9, 0x08, 0x31, 0x63,
+    0x53, 0x24, 0x34, 0x33, 0x43, 0x32, 0x12, 0x01, 0x98, 0xda, 0xdb, 0xcb, 0x84, 0x00, 0x1b, 0x00,
+    0xbc, 0xcb, 0xbb, 0xcb, 0xaa, 0x9a, 0x09, 0x20, 0x53, 0x44, 0x44, 0x43, 0x43, 0x32, 0x24, 0x22,
+    0x12, 0x00, 0xa8, 0xbc, 0xbd, 0xbd, 0xbc, 0xbc, 0xba, 0xab, 0xaa, 0x8a, 0x00, 0x33, 0x45, 0x25,
+    0x34, 0x34, 0x34, 0x33, 0x43, 0x33, 0x12, 0x02, 0xa0, 0xdb, 0xcc, 0xcc, 0xdb, 0xba, 0xcb, 0xba,
+    0xaa, 0x9a, 0x08, 0x30, 0x53, 0x44, 0x43, 0x43, 0x33, 0x24, 0x33, 0x32, 0x12, 0x11, 0x98, 0xca,
+    0xdc, 0xdb, 0xdb, 0xbb, 0xbc, 0xcb, 0xab, 0xab, 0x8a, 0x88, 0x32, 0x45, 0x44, 0x33, 0x35, 0x33,
+    0x33, 0x33, 0x22, 0x01, 0x98, 0xcb, 0xbd, 0xbd, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xaa, 0x99,
+    0x10, 0x63, 0x53, 0x34, 0x44, 0x33, 0x43, 0x23, 0x23, 0x12, 0x90, 0xa9, 0xcc, 0xcc, 0xbb, 0xcc,
+    0xba, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x20, 0x53, 0x54, 0x43, 0x53, 0x33, 0x34, 0x33, 0x24, 0x22,
+    0x19, 0x07, 0x23, 0x00, 0x01, 0x90, 0xca, 0xcc, 0xdb, 0xbb, 0xbc, 0xbb, 0xbb, 0xab, 0x99, 0x18,
+    0x31, 0x44, 0x44, 0x33, 0x25, 0x24, 0x23, 0x33, 0x33, 0x23, 0x02, 0x80, 0xca, 0xdc, 0xdb, 0xcb,
+    0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0x88, 0x21, 0x44, 0x44, 0x43, 0x33, 0x34, 0x23, 0x23, 0x13, 0x11,
+    0x90, 0xb9, 0xbc, 0xbe, 0xbc, 0xbc, 0xbc, 0xcb, 0xbb, 0xba, 0xaa, 0x89, 0x21, 0x53, 0x35, 0x35,
+    0x34, 0x33, 0x34, 0x22, 0x12, 0x00, 0xa9, 0xbc, 0xbd, 0xcc, 0xbb, 0xac, 0xbb, 0xba, 0x9a, 0x99,
+    0x00, 0x32, 0x45, 0x53, 0x43, 0x43, 0x43, 0x32, 0x22, 0x13, 0x01, 0x99, 0xbc, 0xbe, 0xcc, 0xcb,
+    0xbb, 0xbb, 0xbb, 0x9a, 0x09, 0x21, 0x54, 0x34, 0x44, 0x33, 0x34, 0x33, 0x32, 0x23, 0x01, 0x98,
+    0xcb, 0xbe, 0xbc, 0xcc, 0xbb, 0xbc, 0xbb, 0xab, 0x9b, 0x09, 0x21, 0x35, 0x27, 0x34, 0x43, 0x24,
+    0x33, 0x33, 0x22, 0x01, 0x05, 0x03, 0x16, 0x00, 0xa0, 0xca, 0xdc, 0xcb, 0xbc, 0xcb, 0xbb, 0xcb,
+    0xaa, 0xa9, 0x98, 0x11, 0x33, 0x36, 0x35, 0x25, 0x24, 0x33, 0x24, 0x23, 0x22, 0x02, 0x90, 0xba,
+    0xbe, 0xcd, 0xcb, 0xbb, 0xbc, 0xac, 0xab, 0xaa, 0x99, 0x08, 0x22, 0x35, 0x45, 0x43, 0x33, 0x35,
+    0x42, 0x22, 0x23, 0x22, 0x01, 0x90, 0xba, 0xce, 0xdb, 0xbc, 0xcb, 0xac, 0xbb, 0xcb, 0xaa, 0x99,
+    0x88, 0x21, 0x63, 0x53, 0x43, 0x34, 0x43, 0x33, 0x33, 0x24, 0x12, 0x11, 0x98, 0xca, 0xcc, 0xcc,
+    0xcb, 0xcb, 0xcb, 0xba, 0xbb, 0xaa, 0x9a, 0x08, 0x32, 0x55, 0x53, 0x43, 0x34, 0x33, 0x34, 0x33,
+    0x32, 0x21, 0x80, 0xb9, 0xcd, 0xcc, 0xcb, 0xbc, 0xcb, 0xab, 0xac, 0xaa, 0x99, 0x09, 0x20, 0x53,
+    0x34, 0x35, 0x25, 0x24, 0x33, 0x33, 0x23, 0x13, 0x01, 0xa9, 0xbd, 0xcd, 0xbc, 0xbc, 0xcb, 0xbb,
+    0xbb, 0xbb, 0x9a, 0x88, 0x21, 0x54, 0x53, 0x34, 0x05, 0xfb, 0x2c, 0x00, 0x53, 0x33, 0x43, 0x32,
+    0x23, 0x12, 0x00, 0xb9, 0xeb, 0xbc, 0xbd, 0xbc, 0xcb, 0xba, 0xab, 0xaa, 0x8a, 0x08, 0x32, 0x45,
+    0x53, 0x43, 0x43, 0x33, 0x43, 0x22, 0x22, 0x11, 0x98, 0xc9, 0xcc, 0xbc, 0xbc, 0xbc, 0xbb, 0xcb,
+    0xa9, 0x89, 0x08, 0x22, 0x44, 0x53, 0x33, 0x34, 0x34, 0x32, 0x23, 0x22, 0x11, 0x98, 0xda, 0xeb,
+    0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xaa, 0x88, 0x21, 0x44, 0x34, 0x44, 0x33, 0x34, 0x23, 0x23, 0x21,
+    0x80, 0xa8, 0xcb, 0xbc, 0xbd, 0xcc, 0xbb, 0xad, 0xbb, 0xab, 0x9a, 0x08, 0x42, 0x44, 0x44, 0x33,
+    0x34, 0x33, 0x24, 0x12, 0x00, 0x99, 0xdb, 0xcb, 0xac, 0xbb, 0xac, 0xbb, 0xbb, 0xbb, 0xbb, 0x99,
+    0x30, 0x55, 0x44, 0x53, 0x33, 0x43, 0x32, 0x23, 0x12, 0x80, 0xc9, 0xcd, 0xcb, 0xbc, 0xba, 0xab,
+    0x9a, 0x89, 0x00, 0x01, 0x23, 0x44, 0x44, 0x53, 0x33, 0x34, 0x32, 0x22, 0x39, 0x06, 0x22, 0x00,
+    0x11, 0x90, 0xb9, 0xce, 0xcc, 0xbc, 0xbc, 0xac, 0xaa, 0x99, 0x10, 0x42, 0x43, 0x43, 0x33, 0x34,
+    0x43, 0x33, 0x33, 0x23, 0x81, 0xa8, 0xcc, 0xdb, 0xdb, 0xbb, 0xbd, 0xad, 0xac, 0xba, 0x9a, 0x08,
+    0x31, 0x35, 0x35, 0x43, 0x33, 0x34, 0x32, 0x43, 0x12, 0x11, 0x98, 0xba, 0xcc, 0xbc, 0xbc, 0xcb,
+    0xcb, 0xbc, 0xcb, 0xbb, 0x9a, 0x09, 0x21, 0x35, 0x35, 0x34, 0x43, 0x33, 0x43, 0x33, 0x32, 0x12,
+    0x80, 0xb9, 0xdb, 0xbc, 0xbb, 0xbd, 0xbc, 0xcc, 0xcb, 0xbb, 0xbb, 0x9a, 0x08, 0x31, 0x44, 0x43,
+    0x34, 0x43, 0x43, 0x24, 0x33, 0x23, 0x22, 0x00, 0x88, 0x9a, 0xba, 0xdb, 0xcc, 0xbd, 0xbd, 0xbc,
+    0xac, 0xab, 0x99, 0x89, 0x18, 0x20, 0x42, 0x53, 0x34, 0x35, 0x34, 0x33, 0x23, 0x13, 0x11, 0x01,
+    0x80, 0xa8, 0xeb, 0xdc, 0xbc, 0xcc, 0xbb, 0xcb, 0x9a, 0x9a, 0x99, 0x08, 0x10, 0x42, 0x44, 0x44,
+    0x67, 0xfb, 0x2b, 0x00, 0x43, 0x33, 0x33, 0x22, 0x11, 0x00, 0x88, 0xa9, 0xcc, 0xcc, 0xbd, 0xbc,
+    0xcb, 0xba, 0xaa, 0x99, 0x88, 0x18, 0x21, 0x44, 0x54, 0x43, 0x34, 0x33, 0x32, 0x12, 0x00, 0x99,
+    0xba, 0xcc, 0xcb, 0xbc, 0xbd, 0xbb, 0xbb, 0xaa, 0x88, 0x31, 0x53, 0x34, 0x34, 0x44, 0x53, 0x33,
+    0x34, 0x33, 0x22, 0x81, 0xa8, 0xdb, 0xbc, 0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0x9a, 0x18, 0x42, 0x54,
+    0x33, 0x44, 0x32, 0x33, 0x34, 0x43, 0x33, 0x22, 0x02, 0xa9, 0xdc, 0xcc, 0xcb, 0xcb, 0xab, 0xac,
+    0xba, 0x9a, 0x8a, 0x10, 0x42, 0x44, 0x33, 0x34, 0x23, 0x23, 0x32, 0x22, 0x23, 0x01, 0xb8, 0xcf,
+    0xcc, 0xcc, 0xbb, 0xbc, 0xcb, 0xba, 0xaa, 0x9a, 0x89, 0x21, 0x53, 0x34, 0x34, 0x23, 0x13, 0x11,
+    0x08, 0x89, 0x98, 0xa8, 0xda, 0xcc, 0xdc, 0xbb, 0xbc, 0xac, 0xaa, 0x9a, 0x99, 0x10, 0x52, 0x44,
+    0x44, 0x33, 0x34, 0x22, 0xeb, 0xfc, 0x24, 0x00, 0x12, 0x88, 0xa9, 0xaa, 0xaa, 0x9a, 0x9a, 0x9b,
+    0xad, 0xba, 0x9a, 0x31, 0x56, 0x44, 0x53, 0x43, 0x34, 0x44, 0x33, 0x34, 0x33, 0x22, 0x80, 0xb9,
+    0xcc, 0xcb, 0xaa, 0xab, 0xa9, 0x9a, 0x99, 0x08, 0x31, 0x45, 0x35, 0x44, 0x43, 0x42, 0x42, 0x33,
+    0x53, 0x32, 0x21, 0x80, 0xbb, 0xbf, 0xcc, 0xca, 0xaa, 0xba, 0xaa, 0x9a, 0x9a, 0x89, 0x18, 0x22,
+    0x34, 0x34, 0x33, 0x43, 0x43, 0x43, 0x33, 0x23, 0x80, 0xec, 0xcd, 0xcc, 0xbb, 0xbc, 0xbb, 0xbb,
+    0xab, 0xaa, 0x89, 0x08, 0x31, 0x34, 0x34, 0x33, 0x23, 0x12, 0x22, 0x33, 0x25, 0x13, 0xb8, 0xdf,
+    0xdc, 0xcb, 0xac, 0xbb, 0xaa, 0x9a, 0x08, 0x20, 0x34, 0x45, 0x43, 0x43, 0x32, 0x23, 0x12, 0x11,
+    0x10, 0x10, 0x01, 0x02, 0x98, 0xcc, 0xbd, 0xbd, 0xbb, 0x9a, 0x10, 0x54, 0x54, 0x53, 0x43, 0x33,
+    0x25, 0x33, 0x32, 0x12, 0x01, 0x88, 0xa9, 0xba, 0xbd, 0x06, 0x1a, 0x00, 0xbb, 0xbc, 0xcc, 0xca,
+    0xbb, 0xac, 0xab, 0x88, 0x41, 0x54, 0x34, 0x45, 0x33, 0x34, 0x33, 0x33, 0x13, 0x81, 0xa9, 0xbd,
+    0xbd, 0xcc, 0xba, 0xac, 0xbb, 0xcb, 0xba, 0xbb, 0xab, 0x9a, 0x18, 0x42, 0x45, 0x53, 0x33, 0x34,
+    0x23, 0x13, 0x11, 0xa9, 0xcc, 0xbd, 0xbd, 0xdb, 0xba, 0xbb, 0xbb, 0xac, 0xab, 0xab, 0xaa, 0x89,
+    0x28, 0x52, 0x44, 0x43, 0x43, 0x33, 0x33, 0x22, 0x01, 0xa8, 0xcc, 0xbd, 0xbd, 0xbb, 0xbc, 0xba,
+    0xaa, 0x99, 0x8a, 0x08, 0x11, 0x53, 0x44, 0x35, 0x53, 0x33, 0x43, 0x23, 0x23, 0x12, 0x01, 0xa8,
+    0xcb, 0xcd, 0xbb, 0xbc, 0xba, 0x99, 0x00, 0x22, 0x44, 0x53, 0x43, 0x53, 0x43, 0x43, 0x33, 0x34,
+    0x22, 0x22, 0x11, 0x00, 0xa9, 0xcc, 0xcc, 0xdb, 0xbb, 0xac, 0xab, 0xa9, 0x88, 0x10, 0x42, 0x43,
+    0x44, 0x53, 0x43, 0x33, 0x34, 0x33, 0x23, 0x13, 0x01, 0x99, 0xcc, 0xcc, 0xe6, 0x06, 0x20, 0x00,
+    0xcc, 0xcb, 0xac, 0xac, 0xba, 0xaa, 0x9a, 0x8a, 0x08, 0x21, 0x63, 0x53, 0x53, 0x33, 0x34, 0x33,
+    0x33, 0x33, 0x12, 0x80, 0xba, 0xce, 0xcc, 0xdb, 0xbb, 0xbc, 0xcb, 0xba, 0xaa, 0xaa, 0x89, 0x00,
+    0x42, 0x44, 0x53, 0x53, 0x32, 0x43, 0x32, 0x23, 0x22, 0x01, 0x88, 0xca, 0xcc, 0xcc, 0xbb, 0xcc,
+    0xba, 0xbb, 0xbb, 0xba, 0x99, 0x08, 0x32, 0x45, 0x44, 0x43, 0x43, 0x42, 0x22, 0x23, 0x12, 0x02,
+    0x80, 0xb9, 0xdb, 0xcc, 0xbb, 0xad, 0xbb, 0xac, 0xaa, 0xaa, 0x89, 0x10, 0x32, 0x54, 0x43, 0x24,
+    0x24, 0x23, 0x33, 0x13, 0x13, 0x00, 0x99, 0xcb, 0xdb, 0xcb, 0xba, 0xbb, 0xba, 0x99, 0x08, 0x32,
+    0x55, 0x53, 0x33, 0x43, 0x33, 0x22, 0x11, 0x88, 0xbb, 0xbf, 0xcc, 0xcb, 0xcb, 0xaa, 0x9a, 0x09,
+    0x21, 0x44, 0x44, 0x53, 0x33, 0x44, 0x32, 0x23, 0x32, 0x01, 0x98, 0xcb, 0xcd, 0xdb, 0xcb, 0xac,
+    0x7b, 0x00, 0x23, 0x00, 0xcb, 0xba, 0xba, 0x9a, 0x09, 0x20, 0x53, 0x44, 0x43, 0x53, 0x32, 0x43,
+    0x22, 0x22, 0x01, 0x90, 0xba, 0xbe, 0xcc, 0xbc, 0xac, 0xac, 0xbb, 0xab, 0xab, 0x89, 0x18, 0x43,
+    0x44, 0x53, 0x33, 0x44, 0x32, 0x32, 0x22, 0x12, 0x80, 0xaa, 0xdc, 0xcb, 0xbc, 0xbc, 0xbc, 0xbb,
+    0xab, 0xab, 0x99, 0x10, 0x34, 0x45, 0x43, 0x34, 0x43, 0x33, 0x23, 0x23, 0x12, 0x80, 0xb9, 0xbc,
+    0xcd, 0xcb, 0xcb, 0xbb, 0xbb, 0xac, 0x99, 0x09, 0x31, 0x63, 0x34, 0x44, 0x33, 0x34, 0x23, 0x33,
+    0x12, 0x01, 0xa9, 0xdb, 0xdb, 0xcb, 0xbb, 0xcb, 0xcb, 0xaa, 0x9a, 0x8a, 0x10, 0x33, 0x46, 0x43,
+    0x34, 0x43, 0x23, 0x24, 0x12, 0x01, 0x98, 0xcb, 0xcc, 0xcb, 0xcb, 0xab, 0xac, 0xba, 0xaa, 0xaa,
+    0x8a, 0x18, 0x31, 0x45, 0x53, 0x43, 0x42, 0x33, 0x43, 0x23, 0x22, 0x00, 0xb9, 0xcc, 0xcc, 0xbb,
+    0xbc, 0xcb, 0xba, 0xcb, 0x08, 0xfe, 0x1b, 0x00, 0xba, 0xba, 0xaa, 0x9a, 0x80, 0x22, 0x54, 0x63,
+    0x43, 0x34, 0x44, 0x32, 0x24, 0x12, 0x12, 0x10, 0x88, 0xa9, 0xca, 0xcb, 0xbd, 0xbc, 0xbc, 0xad,
+    0xbb, 0xcb, 0xaa, 0xab, 0x89, 0x20, 0x63, 0x44, 0x44, 0x43, 0x33, 0x43, 0x32, 0x22, 0x12, 0x11,
+    0x88, 0xba, 0xbe, 0xbd, 0xbd, 0xdb, 0xbb, 0xcb, 0xbb, 0xba, 0x9b, 0x89, 0x21, 0x45, 0x44, 0x43,
+    0x43, 0x33, 0x33, 0x24, 0x12, 0x02, 0x80, 0xb9, 0xeb, 0xcb, 0xcc, 0xca, 0xbb, 0xcb, 0xbb, 0xba,
+    0xaa, 0x89, 0x21, 0x44, 0x44, 0x34, 0x33, 0x25, 0x32, 0x22, 0x12, 0x01, 0x98, 0xb9, 0xbc, 0xbd,
+    0xbc, 0xbc, 0xcb, 0xab, 0xbb, 0xab, 0x89, 0x20, 0x63, 0x34, 0x35, 0x43, 0x33, 0x23, 0x12, 0x01,
+    0xa8, 0xca, 0xbc, 0xad, 0xab, 0xaa, 0x99, 0x80, 0x21, 0x42, 0x44, 0x43, 0x44, 0x33, 0x34, 0x24,
+    0x13, 0x12, 0x98, 0xcb, 0xbe, 0xbd, 0xcc, 0xbb, 0x07, 0xff, 0x20, 0x00, 0xcb, 0xaa, 0x8a, 0x18,
+    0x31, 0x44, 0x44, 0x33, 0x34, 0x34, 0x32, 0x33, 0x23, 0x01, 0x90, 0xdb, 0xcc, 0xbd, 0xbc, 0xcc,
+    0xbb, 0xbb, 0xac, 0x9a, 0x88, 0x11, 0x53, 0x53, 0x43, 0x33, 0x34, 0x23, 0x14, 0x12, 0x11, 0x98,
+    0xb9, 0xcc, 0xbc, 0xcc, 0xcb, 0xcb, 0xba, 0xab, 0xaa, 0x89, 0x20, 0x53, 0x44, 0x43, 0x43, 0x23,
+    0x24, 0x22, 0x11, 0x81, 0x88, 0xba, 0xcc, 0xcb, 0xac, 0xcb, 0xbb, 0xbb, 0xab, 0x9a, 0x18, 0x53,
+    0x45, 0x53, 0x33, 0x34, 0x33, 0x33, 0x22, 0x01, 0x99, 0xcc, 0xbc, 0xcc, 0xbb, 0xbb, 0xac, 0xab,
+    0xa9, 0x98, 0x11, 0x63, 0x53, 0x44, 0x33, 0x34, 0x24, 0x23, 0x13, 0x11, 0xa8, 0xda, 0xcc, 0xdb,
+    0xbb, 0xac, 0xbb, 0xbb, 0xaa, 0x99, 0x18, 0x31, 0x54, 0x53, 0x53, 0x42, 0x32, 0x33, 0x33, 0x23,
+    0x01, 0xa8, 0xdc, 0xdb, 0xbc, 0xad, 0xbb, 0xac, 0xab, 0xa9, 0x99, 0x00, 0x2b, 0xfb, 0x1b, 0x00,
+    0x21, 0x43, 0x35, 0x44, 0x33, 0x34, 0x33, 0x33, 0x23, 0x12, 0x90, 0xdb, 0xcc, 0xcc, 0xcb, 0xbb,
+    0xcb, 0xba, 0x9a, 0x89, 0x18, 0x32, 0x44, 0x53, 0x33, 0x25, 0x33, 0x43, 0x22, 0x22, 0x02, 0x00,
+    0xaa, 0xcc, 0xbd, 0xbc, 0xbc, 0xbb, 0xbb, 0x9b, 0x09, 0x30, 0x44, 0x35, 0x34, 0x34, 0x43, 0x32,
+    0x23, 0x22, 0x02, 0x81, 0xb8, 0xdb, 0xcc, 0xcc, 0xca, 0xbb, 0xcb, 0xab, 0x9a, 0x08, 0x30, 0x73,
+    0x43, 0x43, 0x43, 0x33, 0x32, 0x23, 0x21, 0x80, 0xa8, 0xbc, 0xcd, 0xdb, 0xbb, 0xbd, 0xcb, 0xca,
+    0xaa, 0x9a, 0x99, 0x00, 0x42, 0x34, 0x35, 0x44, 0x32, 0x33, 0x33, 0x12, 0x82, 0xa0, 0xca, 0xcc,
+    0xdb, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xab, 0x9b, 0x09, 0x21, 0x55, 0x53, 0x43, 0x43, 0x33, 0x33,
+    0x23, 0x12, 0x81, 0xb8, 0xdb, 0xcc, 0xcb, 0xcb, 0xbb, 0xbc, 0xab, 0xbb, 0xaa, 0x88, 0x31, 0x55,
+    0x63, 0xfd, 0x1a, 0x00, 0x53, 0x34, 0x43, 0x24, 0x23, 0x23, 0x12, 0x81, 0x99, 0xbc, 0xbd, 0xad,
+    0xac, 0xbb, 0xbb, 0xbb, 0xab, 0x9a, 0x10, 0x53, 0x54, 0x53, 0x43, 0x43, 0x33, 0x33, 0x33, 0x21,
+    0x88, 0xca, 0xcd, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb, 0xba, 0xaa, 0x09, 0x20, 0x63, 0x53, 0x34, 0x34,
+    0x34, 0x43, 0x23, 0x23, 0x11, 0x90, 0xca, 0xcc, 0xcc, 0xbb, 0xad, 0xbb, 0xbb, 0xab, 0x9a, 0x09,
+    0x20, 0x52, 0x44, 0x43, 0x34, 0x43, 0x33, 0x24, 0x23, 0x11, 0x00, 0xaa, 0xcc, 0xbd, 0xbc, 0xbc,
+    0xac, 0xab, 0x9b, 0x9a, 0x88, 0x11, 0x34, 0x44, 0x53, 0x33, 0x34, 0x43, 0x32, 0x22, 0x12, 0x81,
+    0xa9, 0xeb, 0xdb, 0xdb, 0xba, 0xac, 0xab, 0x9a, 0x99, 0x10, 0x22, 0x35, 0x35, 0x34, 0x43, 0x33,
+    0x33, 0x23, 0x22, 0x01, 0x99, 0xbc, 0xbe, 0xbd, 0xbc, 0xac, 0xbb, 0xbb, 0x9a, 0x08, 0x32, 0x45,
+    0x44, 0x33, 0x25, 0x33, 0xce, 0x01, 0x1b, 0x00, 0x32, 0x22, 0x11, 0x98, 0xba, 0xcd, 0xdb, 0xcb,
+    0xcb, 0xcb, 0xba, 0xab, 0xab, 0x8a, 0x00, 0x53, 0x34, 0x36, 0x43, 0x43, 0x23, 0x33, 0x21, 0x00,
+    0xa8, 0xcb, 0xbd, 0xbc, 0xbd, 0xcb, 0xbb, 0xcb, 0xba, 0xaa, 0x99, 0x08, 0x32, 0x45, 0x44, 0x43,
+    0x24, 0x43, 0x22, 0x23, 0x11, 0x81, 0xa9, 0xcb, 0xcc, 0xcb, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xaa,
+    0x99, 0x10, 0x34, 0x36, 0x35, 0x35, 0x43, 0x33, 0x33, 0x33, 0x21, 0x80, 0xba, 0xdc, 0xcb, 0xbc,
+    0xbc, 0xcb, 0xbb, 0xca, 0xa9, 0xa9, 0x80, 0x31, 0x63, 0x53, 0x43, 0x34, 0x33, 0x34, 0x23, 0x22,
+    0x00, 0xa8, 0xbc, 0xcd, 0xcb, 0xcb, 0xbb, 0xac, 0xbb, 0xaa, 0x9a, 0x08, 0x21, 0x54, 0x34, 0x35,
+    0x34, 0x43, 0x33, 0x43, 0x21, 0x00, 0x98, 0xca, 0xcc, 0xdb, 0xbb, 0xdb, 0xba, 0xba, 0xaa, 0x9a,
+    0x08, 0x30, 0x44, 0x44, 0x34, 0x34, 0x34, 0x33, 0x2f, 0x02, 0x1d, 0x00, 0x43, 0x12, 0x02, 0x88,
+    0xca, 0xbc, 0xbd, 0xcc, 0xba, 0xac, 0xab, 0xaa, 0x9a, 0x89, 0x20, 0x43, 0x44, 0x44, 0x33, 0x25,
+    0x33, 0x24, 0x22, 0x11, 0x80, 0xa9, 0xcc, 0xbc, 0xbd, 0xcb, 0xba, 0xcb, 0x9a, 0x9a, 0x88, 0x00,
+    0x32, 0x35, 0x35, 0x34, 0x34, 0x33, 0x34, 0x22, 0x12, 0x00, 0xaa, 0xbd, 0xcd, 0xcb, 0xca, 0xba,
+    0xba, 0xaa, 0x89, 0x00, 0x31, 0x44, 0x34, 0x34, 0x43, 0x43, 0x32, 0x22, 0x22, 0x00, 0xaa, 0xcc,
+    0xbd, 0xcc, 0xcb, 0xba, 0xbb, 0xaa, 0x99, 0x11, 0x44, 0x34, 0x35, 0x43, 0x33, 0x24, 0x22, 0x12,
+    0x81, 0x98, 0xcb, 0xbd, 0xbd, 0xbc, 0xcc, 0xba, 0xab, 0xab, 0x8a, 0x18, 0x43, 0x45, 0x44, 0x33,
+    0x34, 0x43, 0x22, 0x22, 0x01, 0x90, 0xaa, 0xbd, 0xcd, 0xbb, 0xcc, 0xab, 0xac, 0xab, 0x9a, 0x8a,
+    0x00, 0x43, 0x45, 0x43, 0x34, 0x34, 0x33, 0x43, 0x12, 0x11, 0x88, 0xb9, 0x39, 0x04, 0x19, 0x00,
+    0xbd, 0xcc, 0xbc, 0xcb, 0xbb, 0xbb, 0xac, 0xaa, 0x99, 0x18, 0x32, 0x55, 0x53, 0x33, 0x35, 0x42,
+    0x22, 0x22, 0x02, 0x80, 0xa9, 0xcc, 0xbc, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xaa, 0x89, 0x18, 0x41,
+    0x63, 0x43, 0x34, 0x34, 0x43, 0x32, 0x23, 0x21, 0x80, 0xa9, 0xdc, 0xcb, 0xbc, 0xcb, 0xbb, 0xac,
+    0xaa, 0x99, 0x89, 0x10, 0x33, 0x35, 0x45, 0x33, 0x34, 0x24, 0x33, 0x23, 0x12, 0x81, 0xb9, 0xdc,
+    0xbc, 0xcc, 0xbb, 0xcb, 0xaa, 0x9b, 0x99, 0x18, 0x21, 0x44, 0x43, 0x34, 0x34, 0x33, 0x24, 0x23,
+    0x22, 0x11, 0x90, 0xba, 0xce, 0xdb, 0xcb, 0xca, 0xba, 0xaa, 0x9a, 0x88, 0x11, 0x43, 0x35, 0x34,
+    0x24, 0x33, 0x24, 0x12, 0x11, 0x81, 0x98, 0xca, 0xdb, 0xdb, 0xbb, 0xcc, 0xba, 0xab, 0xaa, 0x99,
+    0x20, 0x63, 0x53, 0x43, 0x43, 0x33, 0x23, 0x13, 0x01, 0x98, 0xdb, 0xdb, 0xcb, 0xac, 0xbb, 0xac,
+    0x2a, 0xff, 0x17, 0x00, 0xbb, 0xaa, 0x9a, 0x09, 0x22, 0x45, 0x35, 0x34, 0x35, 0x33, 0x24, 0x22,
+    0x02, 0x90, 0xc9, 0xcc, 0xdb, 0xcb, 0xca, 0xaa, 0xba, 0x9a, 0x8a, 0x08, 0x31, 0x63, 0x53, 0x43,
+    0x43, 0x43, 0x33, 0x33, 0x23, 0x12, 0x98, 0xdb, 0xfb, 0xbb, 0xcc, 0xbb, 0xcb, 0xba, 0xaa, 0x89,
+    0x08, 0x22, 0x35, 0x35, 0x44, 0x42, 0x23, 0x24, 0x32, 0x22, 0x02, 0x91, 0xb9, 0xcd, 0xbc, 0xbd,
+    0xdb, 0xba, 0xab, 0xab, 0x9a, 0x09, 0x30, 0x63, 0x53, 0x43, 0x33, 0x44, 0x32, 0x32, 0x32, 0x21,
+    0x00, 0x99, 0xbd, 0xbd, 0xbd, 0xad, 0xbb, 0xac, 0xab, 0xaa, 0x89, 0x18, 0x33, 0x45, 0x34, 0x34,
+    0x34, 0x43, 0x32, 0x22, 0x12, 0x01, 0xa0, 0xca, 0xdc, 0xcb, 0xcb, 0xbc, 0xbb, 0xbb, 0xac, 0x99,
+    0x08, 0x21, 0x34, 0x36, 0x53, 0x33, 0x43, 0x32, 0x23, 0x13, 0x02, 0x90, 0xba, 0xcd, 0xcc, 0xcb,
+    0xbb, 0xad, 0xbb, 0xbb, 0xb7, 0xfd, 0x19, 0x00, 0xb9, 0x88, 0x28, 0x53, 0x44, 0x43, 0x43, 0x43,
+    0x32, 0x32, 0x22, 0x10, 0x90, 0xb8, 0xcc, 0xbc, 0xcc, 0xbb, 0xbc, 0xcb, 0xba, 0xaa, 0x99, 0x18,
+    0x42, 0x44, 0x53, 0x43, 0x33, 0x33, 0x24, 0x22, 0x01, 0x90, 0xb9, 0xcc, 0xdb, 0xca, 0xbb, 0xac,
+    0xbb, 0xbb, 0xab, 0x8a, 0x29, 0x52, 0x44, 0x34, 0x35, 0x43, 0x32, 0x23, 0x13, 0x11, 0x99, 0xda,
+    0xcb, 0xbc, 0xbc, 0xac, 0xbb, 0xba, 0xab, 0x9a, 0x89, 0x02, 0x35, 0x45, 0x43, 0x34, 0x24, 0x33,
+    0x24, 0x21, 0x10, 0x99, 0xcb, 0xcc, 0xcb, 0xcb, 0xbb, 0xbb, 0xab, 0xaa, 0x99, 0x18, 0x31, 0x44,
+    0x44, 0x53, 0x43, 0x32, 0x34, 0x42, 0x21, 0x11, 0x88, 0xaa, 0xcc, 0xcc, 0xca, 0xca, 0xaa, 0xaa,
+    0xaa, 0x99, 0x88, 0x20, 0x40, 0x51, 0x41, 0x42, 0x42, 0x33, 0x34, 0x33, 0x24, 0x12, 0x02, 0x98,
+    0xbb, 0xce, 0xdb, 0xba, 0xac, 0x9c, 0xab, 0xb9, 0x47, 0xff, 0x0e, 0x00, 0xa9, 0x99, 0x89, 0x28,
+    0x50, 0x61, 0x41, 0x43, 0x34, 0x34, 0x33, 0x25, 0x22, 0x21, 0x00, 0xb9, 0xeb, 0xcb, 0xcb, 0xbc,
+    0xcb, 0xba, 0xbb, 0xac, 0xa9, 0x89, 0x29, 0x41, 0x44, 0x34, 0x26, 0x24, 0x43, 0x32, 0x23, 0x12,
+    0x01, 0xa8, 0xdb, 0xcc, 0xdb, 0xbb, 0xcb, 0xcb, 0xaa, 0xaa, 0xa9, 0x08, 0x10, 0x34, 0x35, 0x26,
+    0x34, 0x33, 0x34, 0x33, 0x23, 0x02, 0x90, 0xca, 0xcc, 0xbd, 0xcb, 0xac, 0xbb, 0xbb, 0xba, 0x99,
+    0x09, 0x31, 0x44, 0x44, 0x43, 0x43, 0x43, 0x23, 0x23, 0x23, 0x11, 0x89, 0xbb, 0xbf, 0xbd, 0xcb,
+    0xcb, 0xba, 0xaa, 0xa9, 0x08, 0x30, 0x43, 0x35, 0x34, 0x34, 0x33, 0x43, 0x12, 0x03, 0x91, 0xa8,
+    0xbc, 0xcd, 0xcb, 0xbc, 0xca, 0xaa, 0x9a, 0x89, 0x11, 0x34, 0x45, 0x43, 0x43, 0x23, 0x33, 0x12,
+    0x92, 0xb0, 0xeb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xbb, 0xaa, 0x89, 0x30, 0xb7, 0xfe, 0x0b, 0x00,
+    0x73, 0x53, 0x34, 0x34, 0x34, 0x33, 0x33, 0x22, 0x81, 0xb9, 0xdc, 0xcc, 0xdb, 0xbb, 0xcb, 0xab,
+    0xab, 0x9b, 0x89, 0x20, 0x53, 0x44, 0x53, 0x43, 0x42, 0x32, 0x33, 0x32, 0x21, 0x80, 0xca, 0xcc,
+    0xbc, 0xbd, 0xcb, 0xbb, 0xcb, 0xaa, 0x99, 0x08, 0x21, 0x43, 0x35, 0x35, 0x43, 0x33, 0x24, 0x33,
+    0x22, 0x11, 0x80, 0xba, 0xcd, 0xad, 0xbc, 0xbc, 0xca, 0xaa, 0xaa, 0x99, 0x80, 0x31, 0x53, 0x34,
+    0x34, 0x34, 0x24, 0x23, 0x23, 0x13, 0x11, 0x98, 0xd9, 0xda, 0xcb, 0xcb, 0xbb, 0xbc, 0xba, 0xab,
+    0x89, 0x29, 0x41, 0x53, 0x43, 0x24, 0x24, 0x22, 0x32, 0x11, 0x10, 0x98, 0xb9, 0xcb, 0xcc, 0xca,
+    0xba, 0xbb, 0xcb, 0xa9, 0x09, 0x38, 0x60, 0x41, 0x23, 0x24, 0x22, 0x82, 0xb1, 0xe9, 0xca, 0xac,
+    0xac, 0xbb, 0xba, 0x98, 0x11, 0x25, 0x35, 0x25, 0x34, 0x43, 0x32, 0x23, 0x13, 0x92, 0xc0, 0xda,
+    0xa0, 0x00, 0x0c, 0x00, 0xcc, 0xbc, 0xcc, 0xbb, 0xdb, 0xb9, 0xa9, 0x98, 0x11, 0x24, 0x36, 0x53,
+    0x33, 0x25, 0x33, 0x32, 0x22, 0x11, 0x98, 0xbb, 0xbf, 0xbd, 0xbc, 0xbc, 0xcb, 0xab, 0xab, 0x9a,
+    0x09, 0x31, 0x64, 0x43, 0x53, 0x33, 0x34, 0x33, 0x33, 0x32, 0x10, 0xa9, 0xeb, 0xdb, 0xbc, 0xbc,
+    0xcb, 0xcb, 0xaa, 0x9b, 0x9a, 0x08, 0x31, 0x54, 0x53, 0x43, 0x43, 0x33, 0x43, 0x22, 0x21, 0x00,
+    0xa8, 0xcb, 0xbd, 0xbd, 0xdb, 0xba, 0xac, 0xaa, 0x9b, 0x8a, 0x08, 0x31, 0x35, 0x45, 0x43, 0x33,
+    0x34, 0x43, 0x22, 0x11, 0x81, 0xa8, 0xcb, 0xbd, 0xcc, 0xcb, 0xca, 0xaa, 0xab, 0xaa, 0x89, 0x18,
+    0x41, 0x53, 0x34, 0x34, 0x25, 0x33, 0x33, 0x23, 0x13, 0x91, 0xb8, 0xcd, 0xeb, 0xca, 0xca, 0xba,
+    0xbb, 0xba, 0xaa, 0x89, 0x20, 0x43, 0x45, 0x43, 0x34, 0x43, 0x33, 0x33, 0x32, 0x21, 0x90, 0xba,
+    0xce, 0xdb, 0xbb, 0xcc, 0x9b, 0xff, 0x1e, 0x00, 0xba, 0xbb, 0xba, 0x99, 0x88, 0x22, 0x54, 0x53,
+    0x43, 0x33, 0x34, 0x33, 0x33, 0x13, 0x02, 0x99, 0xcc, 0xcc, 0xcb, 0xbc, 0xac, 0xbb, 0xbb, 0xab,
+    0x99, 0x01, 0x43, 0x35, 0x35, 0x44, 0x32, 0x43, 0x22, 0x22, 0x02, 0x80, 0xb9, 0xcc, 0xbc, 0xbd,
+    0xbc, 0xcb, 0xba, 0xaa, 0xaa, 0x88, 0x11, 0x34, 0x45, 0x24, 0x34, 0x43, 0x32, 0x23, 0x12, 0x02,
+    0xa0, 0xca, 0xcc, 0xbc, 0xbc, 0xbc, 0xac, 0xab, 0xab, 0x9a, 0x08, 0x30, 0x63, 0x34, 0x44, 0x43,
+    0x32, 0x43, 0x22, 0x02, 0x82, 0x90, 0xbb, 0xcd, 0xbc, 0xbc, 0xcb, 0xcb, 0xaa, 0xba, 0x99, 0x19,
+    0x20, 0x44, 0x53, 0x34, 0x43, 0x33, 0x34, 0x32, 0x22, 0x01, 0x88, 0xbb, 0xaf, 0xbc, 0xbc, 0xbc,
+    0xbb, 0xac, 0xaa, 0x9a, 0x09, 0x20, 0x53, 0x44, 0x43, 0x43, 0x43, 0x32, 0x33, 0x31, 0x11, 0x88,
+    0xbb, 0xcd, 0xbc, 0xad, 0xac, 0xbb, 0xbb, 0xab, 0x9c, 0xfe, 0x13, 0x00, 0x9b, 0x89, 0x20, 0x44,
+    0x63, 0x33, 0x35, 0x43, 0x33, 0x23, 0x23, 0x12, 0x90, 0xc9, 0xeb, 0xcb, 0xbc, 0xcb, 0xbb, 0xbb,
+    0xac, 0x9a, 0x88, 0x10, 0x52, 0x53, 0x43, 0x43, 0x33, 0x24, 0x33, 0x32, 0x11, 0x80, 0xba, 0xcd,
+    0xdb, 0xcb, 0xcb, 0xbb, 0xbb, 0xbb, 0xaa, 0x88, 0x11, 0x25, 0x35, 0x35, 0x43, 0x43, 0x32, 0x33,
+    0x32, 0x11, 0x90, 0xba, 0xcd, 0xcc, 0xcb, 0xca, 0xba, 0xbb, 0xba, 0xaa, 0x08, 0x30, 0x63, 0x53,
+    0x43, 0x43, 0x33, 0x24, 0x33, 0x22, 0x30, 0x09, 0x9c, 0xad, 0xbc, 0xcc, 0xca, 0xba, 0xca, 0xa9,
+    0x99, 0x08, 0x28, 0x33, 0x45, 0x53, 0x42, 0x32, 0x33, 0x33, 0x23, 0x03, 0x90, 0xc9, 0xbc, 0xaf,
+    0xcb, 0xbb, 0xac, 0xbb, 0xbb, 0x9a, 0x0a, 0x10, 0x15, 0x35, 0x63, 0x32, 0x43, 0x23, 0x14, 0x03,
+    0x12, 0x18, 0x9a, 0xdb, 0xbc, 0xbc, 0xbc, 0xac, 0x9c, 0xab, 0xa9, 0x98, 0x60, 0xff, 0x09, 0x00,
+    0x00, 0x32, 0x54, 0x43, 0x43, 0x33, 0x34, 0x33, 0x22, 0x12, 0x10, 0x9b, 0xeb, 0xcb, 0xbc, 0xdb,
+    0xbb, 0xbb, 0xcb, 0xb9, 0xa1, 0x91, 0x04, 0x25, 0x43, 0x43, 0x33, 0x24, 0x33, 0x22, 0x93, 0xb3,
+    0xd3, 0xb9, 0xbb, 0xaf, 0xca, 0xaa, 0x8c, 0xab, 0x99, 0x2a, 0x4b, 0x38, 0x62, 0x40, 0x21, 0x04,
+    0x13, 0x23, 0x20, 0x00, 0xb1, 0xb1, 0xb9, 0x0d, 0x9b, 0x9b, 0x1c, 0x1d, 0x1b, 0x1a, 0xa9, 0xa3,
+    0x03, 0x13, 0x31, 0x31, 0x30, 0x11, 0xa2, 0xa3, 0xb1, 0x91, 0xa9, 0xb9, 0x91, 0x29, 0x2b, 0x90,
+    0x03, 0x12, 0x11, 0x02, 0x11, 0x90, 0xb2, 0xd3, 0xb2, 0xc2, 0xb1, 0xf3, 0xa1, 0x08, 0x09, 0x09,
+    0x10, 0x39, 0x49, 0x28, 0x03, 0x85, 0x83, 0x93, 0x12, 0x19, 0x3b, 0x1e, 0x0a, 0x0b, 0x1d, 0x1c,
+    0xb9, 0xb2, 0x00, 0x19, 0x91, 0xa4, 0x95, 0x22, 0x48, 0x38, 0x40, 0x49, 0x29, 0x98, 0x09, 0x0b,
+    0x16, 0x00, 0x00, 0x00, 0x0d, 0x0c, 0x0b, 0x0e, 0x0a, 0x09, 0x2a, 0x19, 0x13, 0x41, 0x11, 0x13,
+    0x05, 0x12, 0x21, 0x39, 0x29, 0x1a, 0x0a, 0xab, 0xab, 0x8c, 0x0d, 0x9b, 0x8a, 0x1b, 0x1a, 0x92,
+    0x13, 0x15, 0x12, 0x33};
+#endif
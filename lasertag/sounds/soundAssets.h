@@ -0,0 +1,31 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef SOUNDASSETS_H_
+#define SOUNDASSETS_H_
+
+// Where the generated sound arrays (*.adpcm.c, see Makefile) live.
+// - By default they are const and linked into their own .sound_assets output
+//   section (lscript.ld), so they stay out of .data and the map file shows
+//   their size on its own line.
+// - With SOUND_ASSETS_ON_SD the arrays are left out of the program. The mixer
+//   streams the sounds from the bank that "make assets" writes
+//   (soundBank.bin), which must be on the SD card (see soundStream.h), and
+//   sound_service() must be called from the main loop.
+
+// Uncomment to stream the sounds from the SD card.
+// #define SOUND_ASSETS_ON_SD 1
+
+#if defined(__ELF__)
+#define SOUND_ASSET __attribute__((section(".sound_assets"), aligned(4)))
+#else
+#define SOUND_ASSET // Section names are object-format specific.
+#endif
+
+#endif /* SOUNDASSETS_H_ */
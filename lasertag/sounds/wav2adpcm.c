@@ -0,0 +1,336 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+// Converts a sound to a const IMA-ADPCM array (see adpcm.h) for the sounds
+// library. For every input, writes name.adpcm.c with
+//   SOUND_ASSET const uint8_t name_adpcm[] = {...};
+// (see soundAssets.h) and name.adpcm.h with its declaration and
+// NAME_ADPCM_SAMPLE_RATE, NAME_ADPCM_NUMBER_OF_SAMPLES, NAME_ADPCM_SIZE and
+// NAME_ADPCM_BANK_OFFSET, where name is the input file name without .wav or
+// .wav.c.
+//
+// The bank starts with a header sector (the magic and the size of the rest),
+// then holds every input in order, each padded to whole SD sectors.
+// NAME_ADPCM_BANK_OFFSET is where an input starts, after the header. The bank
+// is written to its own partition of the card for SOUND_ASSETS_ON_SD (see
+// soundStream.h).
+//
+// The input is either a 16-bit PCM .wav file (stereo is mixed down to mono) or
+// an array written by wav2c (name.wav.c), whose samples are offset binary.
+//
+// Usage: ./wav2adpcm [-r rate] [-o directory] [-k bank] input...
+//   -r sets the sample rate of wav2c inputs (default 48000), a .wav file has
+//      its own.
+//   -o writes the output files to directory instead of the current one.
+//   -k also writes the bank to the file bank.
+
+#include "adpcm.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define WAV2ADPCM_DEFAULT_SAMPLE_RATE 48000
+#define WAV2ADPCM_MAX_NAME_LENGTH 256
+#define WAV2ADPCM_BYTES_PER_LINE 16
+#define WAV2ADPCM_OFFSET_BINARY_SIGN 0x8000 // wav2c samples are offset binary.
+#define WAV2ADPCM_PCM_FORMAT 1               // WAVE_FORMAT_PCM.
+#define WAV2ADPCM_SECTOR_SIZE 512 // Bank alignment, as soundStream.h reads it.
+#define WAV2ADPCM_BANK_MAGIC "LTSB" // SOUND_STREAM_BANK_MAGIC.
+
+typedef struct {
+  int16_t *samples;
+  uint32_t sampleCount;
+  uint32_t sampleRate;
+} wav2adpcm_sound_t;
+
+static char wav2adpcm_command[1024]; // Recorded in the generated files.
+static uint32_t wav2adpcm_bankOffset; // Where the next input goes in the bank.
+static FILE *wav2adpcm_bank;          // NULL without -k.
+
+// Reads the whole file, with a terminating 0 so it can be parsed as text.
+// Returns NULL if it cannot be read.
+static uint8_t *wav2adpcm_readFile(const char *fileName, uint32_t *size) {
+  FILE *file = fopen(fileName, "rb");
+  if (!file)
+    return NULL;
+  fseek(file, 0, SEEK_END);
+  *size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *data = malloc(*size + 1);
+  if (data && fread(data, 1, *size, file) != *size) {
+    free(data);
+    data = NULL;
+  }
+  if (data)
+    data[*size] = 0;
+  fclose(file);
+  return data;
+}
+
+static uint32_t wav2adpcm_read16(const uint8_t *data) {
+  return data[0] | data[1] << 8;
+}
+
+static uint32_t wav2adpcm_read32(const uint8_t *data) {
+  return wav2adpcm_read16(data) | wav2adpcm_read16(data + 2) << 16;
+}
+
+// Parses a RIFF file with a 16-bit PCM fmt chunk. Returns false if it is not
+// one.
+static bool wav2adpcm_parseWav(const uint8_t *data, uint32_t size,
+                               wav2adpcm_sound_t *sound) {
+  if (size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4))
+    return false;
+  uint32_t channelCount = 0;
+  for (uint32_t offset = 12; offset + 8 <= size;) {
+    const uint8_t *chunk = data + offset;
+    uint32_t chunkSize = wav2adpcm_read32(chunk + 4);
+    if (chunkSize > size - offset - 8)
+      return false;
+    if (!memcmp(chunk, "fmt ", 4) && chunkSize >= 16) {
+      channelCount = wav2adpcm_read16(chunk + 10);
+      sound->sampleRate = wav2adpcm_read32(chunk + 12);
+      if (wav2adpcm_read16(chunk + 8) != WAV2ADPCM_PCM_FORMAT ||
+          wav2adpcm_read16(chunk + 22) != 16 || channelCount == 0)
+        return false;
+    } else if (!memcmp(chunk, "data", 4) && channelCount > 0) {
+      sound->sampleCount = chunkSize / (2 * channelCount);
+      sound->samples = malloc(sound->sampleCount * sizeof(int16_t) + 1);
+      for (uint32_t i = 0; i < sound->sampleCount; i++) {
+        int32_t sum = 0;
+        for (uint32_t channel = 0; channel < channelCount; channel++)
+          sum += (int16_t)wav2adpcm_read16(chunk + 8 +
+                                           2 * (i * channelCount + channel));
+        sound->samples[i] = sum / (int32_t)channelCount;
+      }
+      return true;
+    }
+    offset += 8 + chunkSize + (chunkSize & 1); // Chunks are word aligned.
+  }
+  return false;
+}
+
+// Parses the numbers between the braces of a wav2c array. Returns false if
+// there are none.
+static bool wav2adpcm_parseWav2c(const char *text, wav2adpcm_sound_t *sound) {
+  const char *start = strchr(text, '{');
+  if (!start)
+    return false;
+  uint32_t capacity = 0;
+  sound->sampleCount = 0;
+  sound->samples = NULL;
+  for (const char *p = start + 1; *p && *p != '}';) {
+    if (!isdigit((unsigned char)*p)) {
+      p++;
+      continue;
+    }
+    char *end;
+    long value = strtol(p, &end, 10);
+    p = end;
+    if (sound->sampleCount == capacity) {
+      capacity = capacity ? 2 * capacity : 4096;
+      sound->samples = realloc(sound->samples, capacity * sizeof(int16_t));
+    }
+    if (value > UINT16_MAX)
+      value = UINT16_MAX;
+    sound->samples[sound->sampleCount++] =
+        (int16_t)(value - WAV2ADPCM_OFFSET_BINARY_SIGN);
+  }
+  return sound->sampleCount > 0;
+}
+
+// Writes the header sector at the start of the bank: the magic, then the size
+// of the sounds so far (uint32, little-endian). Returns false if it cannot be
+// written.
+static bool wav2adpcm_writeBankHeader() {
+  uint8_t header[WAV2ADPCM_SECTOR_SIZE] = {0};
+  uint32_t magicSize = strlen(WAV2ADPCM_BANK_MAGIC);
+  memcpy(header, WAV2ADPCM_BANK_MAGIC, magicSize);
+  for (uint32_t i = 0; i < sizeof(uint32_t); i++)
+    header[magicSize + i] = (wav2adpcm_bankOffset >> (8 * i)) & 0xFF;
+  return fseek(wav2adpcm_bank, 0, SEEK_SET) == 0 &&
+         fwrite(header, 1, sizeof(header), wav2adpcm_bank) == sizeof(header);
+}
+
+// Appends encoded to the bank, padded to whole sectors. Returns false if it
+// cannot be written.
+static bool wav2adpcm_writeBank(const uint8_t encoded[], uint32_t size) {
+  static const uint8_t padding[WAV2ADPCM_SECTOR_SIZE];
+  uint32_t paddingSize =
+      (WAV2ADPCM_SECTOR_SIZE - size % WAV2ADPCM_SECTOR_SIZE) %
+      WAV2ADPCM_SECTOR_SIZE;
+  if (wav2adpcm_bank &&
+      (fwrite(encoded, 1, size, wav2adpcm_bank) != size ||
+       fwrite(padding, 1, paddingSize, wav2adpcm_bank) != paddingSize))
+    return false;
+  wav2adpcm_bankOffset += size + paddingSize;
+  return true;
+}
+
+// Writes name.adpcm.c and name.adpcm.h to directory and adds the sound to the
+// bank. Returns false if a file cannot be written.
+static bool wav2adpcm_write(const char *directory, const char *name,
+                            const wav2adpcm_sound_t *sound) {
+  uint32_t size = ADPCM_ENCODED_SIZE(sound->sampleCount);
+  uint8_t *encoded = malloc(size + 1);
+  adpcm_encode(sound->samples, sound->sampleCount, encoded);
+  uint32_t bankOffset = wav2adpcm_bankOffset;
+  if (!wav2adpcm_writeBank(encoded, size)) {
+    free(encoded);
+    return false;
+  }
+  char macroName[WAV2ADPCM_MAX_NAME_LENGTH];
+  for (uint32_t i = 0; i <= strlen(name); i++)
+    macroName[i] = toupper((unsigned char)name[i]);
+  char fileName[2 * WAV2ADPCM_MAX_NAME_LENGTH];
+  snprintf(fileName, sizeof(fileName), "%s/%s.adpcm.c", directory, name);
+  FILE *file = fopen(fileName, "w");
+  if (!file) {
+    free(encoded);
+    return false;
+  }
+  fprintf(file,
+          "// This file was generated by executing this statement: %s\n\n"
+          "#include \"soundAssets.h\"\n"
+          "#include <stdint.h>\n\n"
+          "#ifndef SOUND_ASSETS_ON_SD\n"
+          "// IMA-ADPCM, %lu samples at %lu Hz.\n"
+          "SOUND_ASSET const uint8_t %s_adpcm[%lu] = {",
+          wav2adpcm_command, (unsigned long)sound->sampleCount,
+          (unsigned long)sound->sampleRate, name, (unsigned long)size);
+  for (uint32_t i = 0; i < size; i++)
+    fprintf(file, "%s0x%02x%s", i % WAV2ADPCM_BYTES_PER_LINE ? " " : "\n    ",
+            encoded[i], i + 1 < size ? "," : "");
+  fprintf(file, "};\n#endif\n");
+  fclose(file);
+  free(encoded);
+  snprintf(fileName, sizeof(fileName), "%s/%s.adpcm.h", directory, name);
+  file = fopen(fileName, "w");
+  if (!file)
+    return false;
+  fprintf(file,
+          "// This file was generated by executing this statement: %s\n"
+          "#include <stdint.h>\n"
+          "extern const uint8_t %s_adpcm[];\n"
+          "#define %s_ADPCM_SAMPLE_RATE %lu\n"
+          "#define %s_ADPCM_NUMBER_OF_SAMPLES %lu\n"
+          "#define %s_ADPCM_SIZE %lu\n"
+          "#define %s_ADPCM_BANK_OFFSET %lu\n",
+          wav2adpcm_command, name, macroName,
+          (unsigned long)sound->sampleRate, macroName,
+          (unsigned long)sound->sampleCount, macroName, (unsigned long)size,
+          macroName, (unsigned long)bankOffset);
+  fclose(file);
+  return true;
+}
+
+// Name of the array: the file name without its directory and .wav or .wav.c,
+// anything that cannot be in a C name becomes '_'.
+static void wav2adpcm_getName(const char *fileName, char *name) {
+  const char *slash = strrchr(fileName, '/');
+  snprintf(name, WAV2ADPCM_MAX_NAME_LENGTH, "%s", slash ? slash + 1 : fileName);
+  char *extension = strstr(name, ".wav");
+  if (extension)
+    *extension = 0;
+  for (char *p = name; *p; p++)
+    if (!isalnum((unsigned char)*p))
+      *p = '_';
+}
+
+// Converts one input. Returns false if it cannot be read or written.
+static bool wav2adpcm_convert(const char *fileName, const char *directory,
+                              uint32_t sampleRate) {
+  uint32_t size;
+  uint8_t *data = wav2adpcm_readFile(fileName, &size);
+  if (!data) {
+    fprintf(stderr, "wav2adpcm: cannot read %s.\n", fileName);
+    return false;
+  }
+  wav2adpcm_sound_t sound = {NULL, 0, sampleRate};
+  bool parsed = wav2adpcm_parseWav(data, size, &sound) ||
+                wav2adpcm_parseWav2c((const char *)data, &sound);
+  free(data);
+  if (!parsed) {
+    fprintf(stderr, "wav2adpcm: %s is not a 16-bit PCM .wav or wav2c file.\n",
+            fileName);
+    return false;
+  }
+  char name[WAV2ADPCM_MAX_NAME_LENGTH];
+  wav2adpcm_getName(fileName, name);
+  bool written = wav2adpcm_write(directory, name, &sound);
+  if (written)
+    printf("%s: %lu samples at %lu Hz, %lu bytes (was %lu).\n", name,
+           (unsigned long)sound.sampleCount, (unsigned long)sound.sampleRate,
+           (unsigned long)ADPCM_ENCODED_SIZE(sound.sampleCount),
+           (unsigned long)(sound.sampleCount * sizeof(uint16_t)));
+  else
+    fprintf(stderr, "wav2adpcm: cannot write %s to %s.\n", name, directory);
+  free(sound.samples);
+  return written;
+}
+
+// Records the command line, without the directory of the program, since the
+// bank offsets depend on all of it.
+static void wav2adpcm_setCommand(int argc, char *argv[]) {
+  const char *slash = strrchr(argv[0], '/');
+  snprintf(wav2adpcm_command, sizeof(wav2adpcm_command), "%s",
+           slash ? slash + 1 : argv[0]);
+  for (int i = 1; i < argc; i++) {
+    size_t length = strlen(wav2adpcm_command);
+    snprintf(&wav2adpcm_command[length], sizeof(wav2adpcm_command) - length,
+             " %s", argv[i]);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  uint32_t sampleRate = WAV2ADPCM_DEFAULT_SAMPLE_RATE;
+  const char *directory = ".";
+  const char *bankName = NULL;
+  int option;
+  while ((option = getopt(argc, argv, "r:o:k:")) != -1) {
+    switch (option) {
+    case 'r':
+      sampleRate = atol(optarg);
+      break;
+    case 'o':
+      directory = optarg;
+      break;
+    case 'k':
+      bankName = optarg;
+      break;
+    default:
+      optind = argc + 1; // Print the usage.
+    }
+  }
+  if (optind >= argc) {
+    fprintf(stderr, "usage: %s [-r rate] [-o directory] [-k bank] input...\n",
+            argv[0]);
+    return 1;
+  }
+  // The header is written again with the size once every input is in.
+  if (bankName && (!(wav2adpcm_bank = fopen(bankName, "wb")) ||
+                   !wav2adpcm_writeBankHeader())) {
+    fprintf(stderr, "wav2adpcm: cannot write %s.\n", bankName);
+    return 1;
+  }
+  wav2adpcm_setCommand(argc, argv);
+  bool success = true;
+  for (int i = optind; i < argc; i++)
+    success &= wav2adpcm_convert(argv[i], directory, sampleRate);
+  if (wav2adpcm_bank) {
+    bool headerWritten = wav2adpcm_writeBankHeader();
+    if (fclose(wav2adpcm_bank) != 0 || !headerWritten) {
+      fprintf(stderr, "wav2adpcm: cannot write %s.\n", bankName);
+      success = false;
+    }
+  }
+  return success ? 0 : 1;
+}
@@ -0,0 +1,208 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "tickScheduler.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct {
+  uint16_t countdown; // Ticks until the task runs again.
+  volatile uint32_t runCount;
+  volatile uint32_t maxCycles;
+  volatile uint64_t totalCycles;
+} tickScheduler_taskData_t;
+
+static tickScheduler_task_t tasks[TICK_SCHEDULER_MAX_TASKS];
+static tickScheduler_taskData_t taskData[TICK_SCHEDULER_MAX_TASKS];
+static uint16_t taskCount;
+static volatile uint16_t maxTasksPerTick;
+static volatile uint32_t maxTickCycles;
+
+bool tickScheduler_init(const tickScheduler_task_t newTasks[],
+                        uint16_t newTaskCount) {
+  taskCount = 0;
+  maxTasksPerTick = 0;
+  maxTickCycles = 0;
+  memset(taskData, 0, sizeof(taskData));
+  if (newTaskCount > TICK_SCHEDULER_MAX_TASKS) {
+    printf("tickScheduler_init: %d tasks, at most %d.\n\r", newTaskCount,
+           TICK_SCHEDULER_MAX_TASKS);
+    return false;
+  }
+  for (uint16_t i = 0; i < newTaskCount; i++) {
+    if (newTasks[i].divisor == 0 ||
+        newTasks[i].phase >= newTasks[i].divisor) {
+      printf("tickScheduler_init: %s has divisor %d and phase %d.\n\r",
+             newTasks[i].name, newTasks[i].divisor, newTasks[i].phase);
+      return false;
+    }
+  }
+  for (uint16_t i = 0; i < newTaskCount; i++) {
+    tasks[i] = newTasks[i];
+    taskData[i].countdown = newTasks[i].phase; // Runs on tick phase first.
+  }
+  taskCount = newTaskCount;
+  return true;
+}
+
+// One cycle-counter read per task that runs, each read ends one task and
+// starts the next.
+void tickScheduler_tick() {
+  uint32_t startCycles = profiler_getCycles();
+  uint32_t lastCycles = startCycles;
+  uint16_t runCount = 0;
+  for (uint16_t i = 0; i < taskCount; i++) {
+    tickScheduler_taskData_t *data = &taskData[i];
+    if (data->countdown > 0) {
+      data->countdown--;
+      continue;
+    }
+    data->countdown = tasks[i].divisor - 1;
+    tasks[i].function();
+    uint32_t cycles = profiler_getCycles();
+    uint32_t duration = cycles - lastCycles;
+    lastCycles = cycles;
+    data->runCount++;
+    data->totalCycles += duration;
+    if (duration > data->maxCycles)
+      data->maxCycles = duration;
+    runCount++;
+  }
+  if (runCount > maxTasksPerTick)
+    maxTasksPerTick = runCount;
+  if (lastCycles - startCycles > maxTickCycles)
+    maxTickCycles = lastCycles - startCycles;
+}
+
+uint16_t tickScheduler_getTaskCount() { return taskCount; }
+
+const char *tickScheduler_getTaskName(uint16_t task) {
+  return tasks[task].name;
+}
+
+void tickScheduler_getStatistics(uint16_t task,
+                                 tickScheduler_statistics_t *statistics) {
+  const tickScheduler_taskData_t *data = &taskData[task];
+  memset(statistics, 0, sizeof(*statistics));
+  statistics->runCount = data->runCount;
+  statistics->maxCycles = data->maxCycles;
+  if (data->runCount > 0)
+    statistics->meanCycles = (double)data->totalCycles / data->runCount;
+}
+
+uint16_t tickScheduler_getMaxTasksPerTick() { return maxTasksPerTick; }
+
+uint32_t tickScheduler_getMaxTickCycles() { return maxTickCycles; }
+
+// One line per task, then the worst tick.
+void tickScheduler_printStatistics() {
+  printf("%-20s %5s %10s %9s %9s (us)\n\r", "task", "rate", "runs", "mean",
+         "max");
+  for (uint16_t i = 0; i < taskCount; i++) {
+    tickScheduler_statistics_t statistics;
+    tickScheduler_getStatistics(i, &statistics);
+    printf("%-20s 1/%-3d %10lu %9.3lf %9.3lf\n\r", tasks[i].name,
+           tasks[i].divisor, (unsigned long)statistics.runCount,
+           profiler_cyclesToMicros(statistics.meanCycles),
+           profiler_cyclesToMicros(statistics.maxCycles));
+  }
+  printf("Longest tick: %.3lf us, at most %d tasks in one tick.\n\r",
+         profiler_cyclesToMicros(maxTickCycles), maxTasksPerTick);
+}
+
+/*********************************************************************************************************
+****************************************** Test Functions
+******************************************
+**********************************************************************************************************/
+
+#define TEST_TICK_COUNT 10000 // Ticks run by the test.
+#define TEST_TASK_COUNT 7
+#define TEST_MAX_TASKS_PER_TICK 2 // The fast task and one of the others.
+
+static uint32_t testTick;                   // Tick the scheduler is on.
+static uint32_t testRunCounts[TEST_TASK_COUNT];
+static bool testRanOnWrongTick;
+
+static void tickScheduler_testTask(uint16_t task);
+
+static void tickScheduler_testTask0() { tickScheduler_testTask(0); }
+static void tickScheduler_testTask1() { tickScheduler_testTask(1); }
+static void tickScheduler_testTask2() { tickScheduler_testTask(2); }
+static void tickScheduler_testTask3() { tickScheduler_testTask(3); }
+static void tickScheduler_testTask4() { tickScheduler_testTask(4); }
+static void tickScheduler_testTask5() { tickScheduler_testTask(5); }
+static void tickScheduler_testTask6() { tickScheduler_testTask(6); }
+
+// Same layout as the lasertag table: one task every tick, one every 10 ticks
+// and five every 100 ticks, none of them on the same tick.
+static const tickScheduler_task_t testTasks[TEST_TASK_COUNT] = {
+    {"every tick", tickScheduler_testTask0, 1, 0},
+    {"every 10 ticks", tickScheduler_testTask1, 10, 5},
+    {"every 100, phase 10", tickScheduler_testTask2, 100, 10},
+    {"every 100, phase 30", tickScheduler_testTask3, 100, 30},
+    {"every 100, phase 50", tickScheduler_testTask4, 100, 50},
+    {"every 100, phase 70", tickScheduler_testTask5, 100, 70},
+    {"every 100, phase 90", tickScheduler_testTask6, 100, 90}};
+
+// Counts the run and checks that it is on a tick where the task is due.
+static void tickScheduler_testTask(uint16_t task) {
+  testRunCounts[task]++;
+  if (testTick % testTasks[task].divisor != testTasks[task].phase) {
+    printf("tickScheduler_runTest: %s ran on tick %lu.\n\r",
+           testTasks[task].name, (unsigned long)testTick);
+    testRanOnWrongTick = true;
+  }
+}
+
+// Prints and returns false if actual != expected.
+static bool tickScheduler_testEqual(const char *name, uint32_t actual,
+                                    uint32_t expected) {
+  if (actual == expected)
+    return true;
+  printf("tickScheduler_runTest: %s is %lu, expected %lu.\n\r", name,
+         (unsigned long)actual, (unsigned long)expected);
+  return false;
+}
+
+// Runs the test table for TEST_TICK_COUNT ticks, then tries a few bad tables.
+bool tickScheduler_runTest() {
+  printf("******** tickScheduler_runTest() **********\n\r");
+  bool success = tickScheduler_init(testTasks, TEST_TASK_COUNT);
+  testRanOnWrongTick = false;
+  memset(testRunCounts, 0, sizeof(testRunCounts));
+  for (testTick = 0; testTick < TEST_TICK_COUNT; testTick++)
+    tickScheduler_tick();
+  success &= !testRanOnWrongTick;
+  for (uint16_t i = 0; i < TEST_TASK_COUNT; i++) {
+    tickScheduler_statistics_t statistics;
+    tickScheduler_getStatistics(i, &statistics);
+    uint32_t expected = TEST_TICK_COUNT / testTasks[i].divisor;
+    success &= tickScheduler_testEqual(testTasks[i].name, testRunCounts[i],
+                                       expected);
+    success &= tickScheduler_testEqual("run count statistic",
+                                       statistics.runCount, expected);
+  }
+  success &= tickScheduler_testEqual("max tasks per tick",
+                                     tickScheduler_getMaxTasksPerTick(),
+                                     TEST_MAX_TASKS_PER_TICK);
+  tickScheduler_printStatistics();
+  // Bad tables are rejected and leave no tasks to run.
+  const tickScheduler_task_t zeroDivisor[] = {
+      {"zero divisor", tickScheduler_testTask0, 0, 0}};
+  const tickScheduler_task_t latePhase[] = {
+      {"late phase", tickScheduler_testTask0, 10, 10}};
+  success &= !tickScheduler_init(zeroDivisor, 1);
+  success &= !tickScheduler_init(latePhase, 1);
+  success &= !tickScheduler_init(testTasks, TICK_SCHEDULER_MAX_TASKS + 1);
+  success &= tickScheduler_testEqual("task count after a bad table",
+                                     tickScheduler_getTaskCount(), 0);
+  printf("tickScheduler_runTest %s.\n\r", success ? "passed" : "failed");
+  return success;
+}
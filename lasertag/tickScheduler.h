@@ -0,0 +1,78 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef TICKSCHEDULER_H_
+#define TICKSCHEDULER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Runs the state-machine tick functions from isr_function(). Every task in the
+// table has a rate divisor and a phase: it runs on the ticks where
+// tick % divisor == phase, so a task with divisor 100 runs at 1 kHz. Giving the
+// slow tasks different phases spreads them over the ticks, so the longest tick
+// is the fast tasks plus one or two slow ones instead of all of them at once.
+// Each tick only decrements a countdown per task, no division.
+//
+// A task on a divided rate sees fewer ticks, so it must count its timeouts in
+// its own ticks (see LOCKOUT_TIMER_EXPIRE_VALUE in lockoutTimer.h).
+//
+// Every task run is timed with profiler_getCycles(). The statistics are read by
+// the main loop while the ISR updates them, so a snapshot may mix two ticks.
+
+#define TICK_SCHEDULER_MAX_TASKS 16 // Size of the task table.
+
+typedef void (*tickScheduler_function_t)();
+
+typedef struct {
+  const char *name;                  // Shown in the statistics.
+  tickScheduler_function_t function; // Called on every divisor-th tick.
+  uint16_t divisor;                  // 1 runs every tick.
+  uint16_t phase;                    // First tick it runs on, < divisor.
+} tickScheduler_task_t;
+
+typedef struct {
+  uint32_t runCount; // Times the task ran.
+  uint32_t maxCycles;
+  double meanCycles;
+} tickScheduler_statistics_t;
+
+// Copies the task table and clears the statistics. Returns false, and runs no
+// tasks, if there are more than TICK_SCHEDULER_MAX_TASKS, a divisor is 0 or a
+// phase is not below its divisor. Call before interrupts are enabled;
+// profiler_init() must have enabled the cycle counter.
+bool tickScheduler_init(const tickScheduler_task_t tasks[], uint16_t taskCount);
+
+// Runs the tasks that are due on this tick. Call once from isr_function().
+void tickScheduler_tick();
+
+// Returns the number of tasks in the table.
+uint16_t tickScheduler_getTaskCount();
+
+// Returns the name of task.
+const char *tickScheduler_getTaskName(uint16_t task);
+
+// Fills statistics for task.
+void tickScheduler_getStatistics(uint16_t task,
+                                 tickScheduler_statistics_t *statistics);
+
+// Returns the most tasks that ran in a single tick.
+uint16_t tickScheduler_getMaxTasksPerTick();
+
+// Returns the longest tick, in cycles, from the first task to the last.
+uint32_t tickScheduler_getMaxTickCycles();
+
+// Prints the statistics of every task to the UART.
+void tickScheduler_printStatistics();
+
+// Runs a table of test tasks and checks when and how often each one ran, and
+// that bad tables are rejected. Returns true if everything matches.
+bool tickScheduler_runTest();
+
+#endif /* TICKSCHEDULER_H_ */
@@ -0,0 +1,38 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#include "tickTasks.h"
+#include "autoReloadTimer.h"
+#include "hitLedTimer.h"
+#include "invincibilityTimer.h"
+#include "ledTimer.h"
+#include "lockoutTimer.h"
+#include "sound.h"
+#include "tickScheduler.h"
+#include "transmitter.h"
+#include "trigger.h"
+
+#define TICK_TASKS_COUNT 8
+
+// The slow tasks are on multiples of 10, the sound task is in between them.
+// The trigger and the invincibility timer count 100 kHz ticks (tickTasks.h).
+static const tickScheduler_task_t tickTasks[TICK_TASKS_COUNT] = {
+    {"transmitter", transmitter_tick, 1, 0},
+    {"sound", sound_tick, TICK_TASKS_SOUND_DIVISOR, 5},
+    {"trigger", trigger_tick, 1, 0},
+    {"lockoutTimer", lockoutTimer_tick, TICK_TASKS_SLOW_DIVISOR, 10},
+    {"hitLedTimer", hitLedTimer_tick, TICK_TASKS_SLOW_DIVISOR, 20},
+    {"invincibilityTimer", invincibilityTimer_tick, 1, 0},
+    {"autoReloadTimer", autoReloadTimer_tick, TICK_TASKS_SLOW_DIVISOR, 40},
+    {"ledTimer", ledTimer_tick, TICK_TASKS_SLOW_DIVISOR, 50}};
+
+void tickTasks_init() {
+  ledTimer_setTicksPerMs(TICK_TASKS_SLOW_TICKS_PER_MS);
+  tickScheduler_init(tickTasks, TICK_TASKS_COUNT);
+}
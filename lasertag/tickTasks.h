@@ -0,0 +1,46 @@
+/*
+This software is provided for student assignment use in the Department of
+Electrical and Computer Engineering, Brigham Young University, Utah, USA.
+Users agree to not re-host, or redistribute the software, in source or binary
+form, to other persons or other institutions. Users may modify and use the
+source code for personal or educational use.
+For questions, contact Brad Hutchings or Jeff Goeders, https://ece.byu.edu/
+*/
+
+#ifndef TICKTASKS_H_
+#define TICKTASKS_H_
+
+// The lasertag task table for tickScheduler.h. The transmitter needs every
+// 100 kHz tick (its waveform is counted in ticks). The sound FIFO is topped up
+// at 10 kHz, so it only has to hold 100 us of audio (5 samples at 48 kHz).
+// The timers that count milliseconds run at 1 kHz, each on its own phase, so a
+// tick runs at most one of them (or the sound task) next to the every-tick
+// tasks.
+//
+// A task on the slow rate counts its timeouts in its own ticks. The lockout,
+// hit-LED and auto-reload timers define theirs in ms and convert them with
+// TICK_TASKS_MS_TO_SLOW_TICKS(). The ledTimer is told its rate with
+// ledTimer_setTicksPerMs(). The trigger and the invincibility timer still
+// count their debounce and invincibility times in 100 kHz ticks, so they run on
+// every tick until they are converted.
+
+#define TICK_TASKS_TICK_RATE_HZ 100000 // isr_function() rate.
+#define TICK_TASKS_SOUND_DIVISOR 10    // sound_tick() at 10 kHz.
+#define TICK_TASKS_SLOW_DIVISOR 100    // The ms timers at 1 kHz.
+#define TICK_TASKS_SLOW_TICKS_PER_MS                                           \
+  (TICK_TASKS_TICK_RATE_HZ / 1000 / TICK_TASKS_SLOW_DIVISOR)
+// Converts ms to slow ticks, multiplying first so the rate need not be a whole
+// number of ticks per ms.
+#define TICK_TASKS_MS_TO_SLOW_TICKS(ms)                                        \
+  ((ms) * TICK_TASKS_TICK_RATE_HZ / (1000 * TICK_TASKS_SLOW_DIVISOR))
+
+// ledTimer_setTicksPerMs() takes whole ticks per ms.
+#if TICK_TASKS_SLOW_TICKS_PER_MS < 1
+#error "TICK_TASKS_SLOW_DIVISOR is too large for a 1 ms slow tick."
+#endif
+
+// Registers the lasertag tick functions with tickScheduler_init(). Call from
+// isr_init(), after profiler_init().
+void tickTasks_init();
+
+#endif /* TICKTASKS_H_ */